@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// This test builds against the header-only core component, so it must
+// not reference any symbol defined in a translation unit of the full
+// library (such as the named Angle constants or Pair/Unpair). If it
+// fails to link, a core header grew a compiled dependency.
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/Angle.hh"
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/Matrix3.hh"
+#include "ignition/math/Matrix4.hh"
+#include "ignition/math/Pose3.hh"
+#include "ignition/math/Quaternion.hh"
+#include "ignition/math/Vector2.hh"
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/Vector4.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(CoreHeadersTest, Vectors)
+{
+  math::Vector2d v2(3, 4);
+  EXPECT_DOUBLE_EQ(5.0, v2.Length());
+
+  math::Vector3d v3 = math::Vector3d::UnitX + math::Vector3d::UnitY;
+  EXPECT_DOUBLE_EQ(1.0, v3.Dot(math::Vector3d::UnitX));
+  EXPECT_EQ(math::Vector3d::UnitZ,
+      math::Vector3d::UnitX.Cross(math::Vector3d::UnitY));
+
+  math::Vector4d v4(1, 2, 3, 4);
+  EXPECT_DOUBLE_EQ(30.0, v4.Dot(v4));
+}
+
+/////////////////////////////////////////////////
+TEST(CoreHeadersTest, Matrices)
+{
+  math::Matrix3d m3 = math::Matrix3d::Identity;
+  EXPECT_EQ(m3, m3 * math::Matrix3d::Identity);
+
+  math::Matrix4d m4 = math::Matrix4d::Identity;
+  m4.SetTranslation(math::Vector3d(1, 2, 3));
+  EXPECT_EQ(math::Vector3d(2, 4, 6), m4 * math::Vector3d(1, 2, 3));
+  EXPECT_EQ(math::Matrix4d::Identity, m4 * m4.Inverse());
+}
+
+/////////////////////////////////////////////////
+TEST(CoreHeadersTest, QuaternionPose)
+{
+  const math::Quaterniond rot(0, 0, IGN_PI_2);
+  const math::Vector3d rotated = rot.RotateVector(math::Vector3d::UnitX);
+  EXPECT_NEAR(0.0, rotated.X(), 1e-12);
+  EXPECT_NEAR(1.0, rotated.Y(), 1e-12);
+
+  const math::Pose3d pose(math::Vector3d(1, 0, 0), rot);
+  const math::Pose3d composed = pose * pose;
+  EXPECT_NEAR(1.0, composed.Pos().X(), 1e-12);
+  EXPECT_NEAR(1.0, composed.Pos().Y(), 1e-12);
+}
+
+/////////////////////////////////////////////////
+TEST(CoreHeadersTest, AngleHelpers)
+{
+  // Angle values and arithmetic are constexpr and header only; the
+  // named constants (Angle::Zero etc.) are not part of the core.
+  math::Angle a(IGN_PI);
+  a.Normalize();
+  EXPECT_DOUBLE_EQ(IGN_PI, a.Radian());
+  EXPECT_DOUBLE_EQ(180.0, a.Degree());
+
+  EXPECT_DOUBLE_EQ(4.0, math::clamp(5.0, 0.0, 4.0));
+  EXPECT_TRUE(math::equal(1.0, 1.0 + 1e-9, 1e-6));
+  EXPECT_EQ(8u, math::roundUpPowerOfTwo(5u));
+}
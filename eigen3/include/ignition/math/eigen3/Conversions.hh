@@ -160,6 +160,60 @@ namespace ignition
 
         return pose;
       }
+
+      /// \typedef Matrix3dRowMajor
+      /// \brief A 3x3 row-major Eigen matrix. ignition::math::Matrix3d
+      /// stores its entries row-major, so zero-copy views over it use
+      /// this type rather than the column-major Eigen::Matrix3d.
+      using Matrix3dRowMajor = Eigen::Matrix<double, 3, 3, Eigen::RowMajor>;
+
+      /// \brief Get a writable zero-copy Eigen view of an
+      /// ignition::math::Vector3d. The three components are guaranteed
+      /// to be laid out contiguously, so the view reads and writes the
+      /// vector's own storage with no conversion copy. The vector must
+      /// outlive the view.
+      /// \param[in] _v ignition::math::Vector3d to view.
+      /// \return An Eigen::Map over the vector's storage.
+      inline Eigen::Map<Eigen::Vector3d> view(ignition::math::Vector3d &_v)
+      {
+        return Eigen::Map<Eigen::Vector3d>(&_v[0]);
+      }
+
+      /// \brief Get a read-only zero-copy Eigen view of an
+      /// ignition::math::Vector3d. The vector must outlive the view.
+      /// \param[in] _v ignition::math::Vector3d to view.
+      /// \return A const Eigen::Map over the vector's storage.
+      inline Eigen::Map<const Eigen::Vector3d> view(
+          const ignition::math::Vector3d &_v)
+      {
+        // The const accessor returns by value, so the address of the
+        // storage has to be obtained through the mutable overload; the
+        // returned map is const and never writes through it.
+        return Eigen::Map<const Eigen::Vector3d>(
+            &const_cast<ignition::math::Vector3d &>(_v)[0]);
+      }
+
+      /// \brief Get a writable zero-copy Eigen view of an
+      /// ignition::math::Matrix3d. The nine entries are guaranteed to
+      /// be laid out contiguously in row-major order, so the view reads
+      /// and writes the matrix's own storage with no conversion copy.
+      /// The matrix must outlive the view.
+      /// \param[in] _m ignition::math::Matrix3d to view.
+      /// \return An Eigen::Map over the matrix's storage.
+      inline Eigen::Map<Matrix3dRowMajor> view(ignition::math::Matrix3d &_m)
+      {
+        return Eigen::Map<Matrix3dRowMajor>(&_m(0, 0));
+      }
+
+      /// \brief Get a read-only zero-copy Eigen view of an
+      /// ignition::math::Matrix3d. The matrix must outlive the view.
+      /// \param[in] _m ignition::math::Matrix3d to view.
+      /// \return A const Eigen::Map over the matrix's storage.
+      inline Eigen::Map<const Matrix3dRowMajor> view(
+          const ignition::math::Matrix3d &_m)
+      {
+        return Eigen::Map<const Matrix3dRowMajor>(&_m(0, 0));
+      }
     }
   }
 }
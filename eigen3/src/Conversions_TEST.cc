@@ -181,3 +181,53 @@ TEST(EigenConversions, ConvertPose3)
     EXPECT_EQ(iPose, iPose2);
   }
 }
+
+/////////////////////////////////////////////////
+/// Check zero-copy views
+TEST(EigenConversions, ViewVector3)
+{
+  ignition::math::Vector3d vec(1.5, -2.5, 8.0);
+
+  // Reads see the vector's storage.
+  auto constView = ignition::math::eigen3::view(
+      static_cast<const ignition::math::Vector3d &>(vec));
+  EXPECT_DOUBLE_EQ(vec.X(), constView(0));
+  EXPECT_DOUBLE_EQ(vec.Y(), constView(1));
+  EXPECT_DOUBLE_EQ(vec.Z(), constView(2));
+
+  // Writes through the view land in the vector, and changes to the
+  // vector are visible through the view.
+  auto mutableView = ignition::math::eigen3::view(vec);
+  mutableView(1) = 4.25;
+  EXPECT_DOUBLE_EQ(4.25, vec.Y());
+  vec.Z(-1.0);
+  EXPECT_DOUBLE_EQ(-1.0, mutableView(2));
+
+  // Views compose with Eigen expressions.
+  Eigen::Vector3d doubled = mutableView * 2.0;
+  EXPECT_DOUBLE_EQ(2.0 * vec.X(), doubled(0));
+}
+
+/////////////////////////////////////////////////
+/// Check zero-copy views
+TEST(EigenConversions, ViewMatrix3)
+{
+  ignition::math::Matrix3d mat(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  const ignition::math::Matrix3d &constMat = mat;
+
+  auto constView = ignition::math::eigen3::view(constMat);
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    for (std::size_t j = 0; j < 3; ++j)
+      EXPECT_DOUBLE_EQ(mat(i, j), constView(i, j));
+  }
+
+  auto mutableView = ignition::math::eigen3::view(mat);
+  mutableView(2, 0) = -7.0;
+  EXPECT_DOUBLE_EQ(-7.0, mat(2, 0));
+
+  // The view agrees with the copying conversion, transposes included.
+  Eigen::Matrix3d copy = ignition::math::eigen3::convert(mat);
+  EXPECT_TRUE(copy.isApprox(mutableView));
+  EXPECT_TRUE(copy.transpose().isApprox(mutableView.transpose()));
+}
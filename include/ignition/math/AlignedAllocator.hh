@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_ALIGNEDALLOCATOR_HH_
+#define IGNITION_MATH_ALIGNEDALLOCATOR_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Parallel.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \file
+    /// \brief Opt-in alignment guarantees for the math types.
+    ///
+    /// The plain types promise only their natural alignment, which
+    /// forces vectorized consumers onto unaligned loads. The Aligned
+    /// wrapper raises a type's alignment, and AlignedAllocator makes
+    /// containers honor it on the heap; AlignedVector combines the two
+    /// so every element of a std::vector of wrapped math types sits on
+    /// an alignment boundary.
+
+    /// \brief The default alignment for vectorized consumers, wide
+    /// enough for 256-bit vector loads.
+    constexpr std::size_t kSimdAlignment = 32;
+
+    /// \brief Check a pointer's alignment.
+    /// \param[in] _ptr The pointer.
+    /// \param[in] _alignment The required alignment in bytes; must be a
+    /// power of two.
+    /// \return True if _ptr is aligned to _alignment bytes.
+    inline bool IsAligned(const void *_ptr, const std::size_t _alignment)
+    {
+      return (reinterpret_cast<std::uintptr_t>(_ptr) &
+              (_alignment - 1)) == 0;
+    }
+
+    /// \brief A math type with a stronger alignment guarantee.
+    ///
+    /// Aligned<T, A> is layout-compatible with T (it adds no members)
+    /// and usable anywhere a T is, but every instance — on the stack,
+    /// as a struct member, or as a container element through
+    /// AlignedAllocator — starts on an A-byte boundary.
+    /// \tparam T The math type to wrap.
+    /// \tparam Alignment The guaranteed alignment in bytes; must be a
+    /// power of two at least alignof(T).
+    template<typename T, std::size_t Alignment = kSimdAlignment>
+    struct alignas(Alignment) Aligned : public T
+    {
+      static_assert((Alignment & (Alignment - 1)) == 0 &&
+          Alignment >= alignof(T),
+          "Alignment must be a power of two at least alignof(T)");
+
+      // Inherit all of T's constructors.
+      using T::T;
+
+      /// \brief Default constructor.
+      public: Aligned() = default;
+
+      /// \brief Construct from the unaligned type.
+      /// \param[in] _value The value to copy.
+      public: Aligned(const T &_value) : T(_value)  // NOLINT(runtime/explicit)
+      {
+      }
+    };
+
+    /// \brief A minimal standard allocator returning storage aligned
+    /// beyond what operator new guarantees.
+    /// \tparam T The element type.
+    /// \tparam Alignment The alignment in bytes; must be a power of two
+    /// at least alignof(T).
+    template<typename T, std::size_t Alignment = kSimdAlignment>
+    class AlignedAllocator
+    {
+      static_assert((Alignment & (Alignment - 1)) == 0 &&
+          Alignment >= alignof(T),
+          "Alignment must be a power of two at least alignof(T)");
+
+      /// \brief The allocated type.
+      public: using value_type = T;
+
+      /// \brief Rebind to another element type at the same alignment.
+      public: template<typename U>
+              struct rebind
+      {
+        /// \brief The rebound allocator type.
+        using other = AlignedAllocator<U, Alignment>;
+      };
+
+      /// \brief Constructor.
+      public: AlignedAllocator() = default;
+
+      /// \brief Converting constructor from a rebound allocator.
+      public: template<typename U>
+              AlignedAllocator(const AlignedAllocator<U, Alignment> &)
+      {
+      }
+
+      /// \brief Allocate aligned storage.
+      /// \param[in] _count Number of elements.
+      /// \return Storage for _count elements aligned to Alignment
+      /// bytes.
+      public: T *Allocate(const std::size_t _count)
+      {
+        return static_cast<T *>(::operator new(
+            _count * sizeof(T), std::align_val_t(Alignment)));
+      }
+
+      /// \brief Release storage obtained from Allocate.
+      /// \param[in] _ptr The storage.
+      public: void Deallocate(T *_ptr)
+      {
+        ::operator delete(_ptr, std::align_val_t(Alignment));
+      }
+
+      /// \brief Standard allocator interface; forwards to Allocate.
+      /// \param[in] _count Number of elements.
+      /// \return The aligned storage.
+      public: T *allocate(const std::size_t _count)
+      {
+        return this->Allocate(_count);
+      }
+
+      /// \brief Standard allocator interface; forwards to Deallocate.
+      /// \param[in] _ptr The storage.
+      public: void deallocate(T *_ptr, const std::size_t)
+      {
+        this->Deallocate(_ptr);
+      }
+    };
+
+    /// \brief Allocators at the same alignment are interchangeable.
+    template<typename T, typename U, std::size_t A>
+    bool operator==(const AlignedAllocator<T, A> &,
+        const AlignedAllocator<U, A> &)
+    {
+      return true;
+    }
+
+    /// \brief Allocators at the same alignment are interchangeable.
+    template<typename T, typename U, std::size_t A>
+    bool operator!=(const AlignedAllocator<T, A> &,
+        const AlignedAllocator<U, A> &)
+    {
+      return false;
+    }
+
+    /// \brief A std::vector whose elements are all aligned to
+    /// _Alignment bytes: the wrapper spaces the elements and the
+    /// allocator aligns the buffer.
+    template<typename T, std::size_t Alignment = kSimdAlignment>
+    using AlignedVector = std::vector<Aligned<T, Alignment>,
+        AlignedAllocator<Aligned<T, Alignment>, Alignment>>;
+
+    /// \brief The conventional huge page size on x86-64 and most
+    /// AArch64 configurations. Blocks of at least this size that start
+    /// on this boundary are eligible for transparent huge page
+    /// backing.
+    constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+    /// \brief Node argument meaning "no binding requested".
+    constexpr int kAnyNumaNode = -1;
+
+    /// \brief Customization point for the batch containers' backing
+    /// storage.
+    ///
+    /// The library itself stays dependency-free: the default hooks
+    /// ignore the node argument and serve aligned operator new, which
+    /// under the operating system's first-touch policy already places
+    /// pages on the node that first writes them (see FirstTouch()).
+    /// Applications that need explicit binding or reserved huge pages
+    /// install their own hooks once at startup - backed by libnuma,
+    /// mmap or an arena - and every NumaAllocator in the process
+    /// routes through them.
+    struct NumaAllocationHooks
+    {
+      /// \brief Allocate raw storage.
+      /// Invoked as Allocate(size, alignment, node); node is
+      /// kAnyNumaNode when no binding was requested.
+      void *(*Allocate)(std::size_t, std::size_t, int);
+
+      /// \brief Release storage obtained from Allocate.
+      /// Invoked as Deallocate(pointer, size, alignment).
+      void (*Deallocate)(void *, std::size_t, std::size_t);
+    };
+
+    /// \brief The default allocation hook: aligned operator new, with
+    /// the node ignored.
+    /// \param[in] _size Number of bytes.
+    /// \param[in] _alignment Required alignment in bytes.
+    /// \return The storage.
+    inline void *DefaultNumaAllocate(const std::size_t _size,
+        const std::size_t _alignment, int)
+    {
+      return ::operator new(_size, std::align_val_t(_alignment));
+    }
+
+    /// \brief The default deallocation hook.
+    /// \param[in] _ptr The storage.
+    /// \param[in] _alignment Alignment the storage was requested with.
+    inline void DefaultNumaDeallocate(void *_ptr, std::size_t,
+        const std::size_t _alignment)
+    {
+      ::operator delete(_ptr, std::align_val_t(_alignment));
+    }
+
+    /// \brief Get the installed allocation hooks.
+    /// \return Mutable reference to the process-wide hooks.
+    inline NumaAllocationHooks &NumaHooks()
+    {
+      static NumaAllocationHooks hooks =
+          {&DefaultNumaAllocate, &DefaultNumaDeallocate};
+      return hooks;
+    }
+
+    /// \brief Install allocation hooks. Install them before any
+    /// container allocates, and never uninstall them while storage
+    /// they served is still live.
+    /// \param[in] _hooks The hooks; null members restore the
+    /// defaults.
+    inline void SetNumaAllocationHooks(const NumaAllocationHooks &_hooks)
+    {
+      NumaHooks().Allocate =
+          _hooks.Allocate ? _hooks.Allocate : &DefaultNumaAllocate;
+      NumaHooks().Deallocate =
+          _hooks.Deallocate ? _hooks.Deallocate : &DefaultNumaDeallocate;
+    }
+
+    /// \brief A standard allocator routing through the
+    /// NumaAllocationHooks customization point, carrying an optional
+    /// NUMA node and huge-page preference.
+    ///
+    /// With the default hooks the node is a hint only; first-touch
+    /// placement (FirstTouch()) is what actually spreads the pages.
+    /// The huge-page preference is honored portably by raising the
+    /// alignment of requests of at least kHugePageSize to the huge
+    /// page boundary, which makes them eligible for transparent huge
+    /// pages; installed hooks can honor both options exactly.
+    /// \tparam T The element type.
+    template<typename T>
+    class NumaAllocator
+    {
+      /// \brief The allocated type.
+      public: using value_type = T;
+
+      /// \brief Rebind to another element type with the same options.
+      public: template<typename U>
+              struct rebind
+      {
+        /// \brief The rebound allocator type.
+        using other = NumaAllocator<U>;
+      };
+
+      /// \brief Constructor.
+      /// \param[in] _node The NUMA node to bind to, or kAnyNumaNode.
+      /// \param[in] _hugePages Prefer huge-page backed storage for
+      /// blocks of at least kHugePageSize.
+      public: explicit NumaAllocator(const int _node = kAnyNumaNode,
+                  const bool _hugePages = false)
+        : node(_node), hugePages(_hugePages)
+      {
+      }
+
+      /// \brief Converting constructor from a rebound allocator.
+      /// \param[in] _other The allocator to copy the options from.
+      public: template<typename U>
+              NumaAllocator(const NumaAllocator<U> &_other)
+        : node(_other.Node()), hugePages(_other.HugePages())
+      {
+      }
+
+      /// \brief Get the NUMA node.
+      /// \return The node, or kAnyNumaNode.
+      public: int Node() const
+      {
+        return this->node;
+      }
+
+      /// \brief Get the huge-page preference.
+      /// \return True when huge pages are preferred.
+      public: bool HugePages() const
+      {
+        return this->hugePages;
+      }
+
+      /// \brief Standard allocator interface.
+      /// \param[in] _count Number of elements.
+      /// \return The storage.
+      public: T *allocate(const std::size_t _count)
+      {
+        return static_cast<T *>(NumaHooks().Allocate(
+            _count * sizeof(T), this->Alignment(_count * sizeof(T)),
+            this->node));
+      }
+
+      /// \brief Standard allocator interface.
+      /// \param[in] _ptr The storage.
+      /// \param[in] _count Number of elements it was requested for.
+      public: void deallocate(T *_ptr, const std::size_t _count)
+      {
+        NumaHooks().Deallocate(_ptr, _count * sizeof(T),
+            this->Alignment(_count * sizeof(T)));
+      }
+
+      /// \brief Alignment for a request of a given size.
+      /// \param[in] _size Number of bytes.
+      /// \return kHugePageSize for huge-page eligible requests,
+      /// kSimdAlignment otherwise.
+      private: std::size_t Alignment(const std::size_t _size) const
+      {
+        const std::size_t base = std::max(alignof(T), kSimdAlignment);
+        return this->hugePages && _size >= kHugePageSize ?
+            kHugePageSize : base;
+      }
+
+      /// \brief The NUMA node, or kAnyNumaNode.
+      private: int node;
+
+      /// \brief True when huge pages are preferred.
+      private: bool hugePages;
+    };
+
+    /// \brief Allocators with the same options are interchangeable.
+    template<typename T, typename U>
+    bool operator==(const NumaAllocator<T> &_a, const NumaAllocator<U> &_b)
+    {
+      return _a.Node() == _b.Node() && _a.HugePages() == _b.HugePages();
+    }
+
+    /// \brief Allocators with different options are not.
+    template<typename T, typename U>
+    bool operator!=(const NumaAllocator<T> &_a, const NumaAllocator<U> &_b)
+    {
+      return !(_a == _b);
+    }
+
+    /// \brief A std::vector whose storage is served through the
+    /// NumaAllocationHooks customization point.
+    template<typename T>
+    using NumaVector = std::vector<T, NumaAllocator<T>>;
+
+    /// \brief Initialize an array in parallel so that under the
+    /// operating system's first-touch policy each page faults in on
+    /// the node of the worker that writes it.
+    ///
+    /// The range is split with the deterministic per-worker
+    /// partitioning of ParallelFor(), so a later deterministic loop
+    /// over the same range on the same pool finds its slice of the
+    /// data on its own node. Touch the storage this way once, right
+    /// after allocating it and before any other thread writes it.
+    /// \param[out] _data The array; must be uninitialized or
+    /// trivially overwritable.
+    /// \param[in] _count Number of elements.
+    /// \param[in] _value Value to store in every element.
+    template<typename T>
+    void FirstTouch(T *_data, const std::size_t _count,
+        const T &_value = T())
+    {
+      ParallelFor(0, _count,
+          [_data, &_value](const std::size_t _i)
+          {
+            _data[_i] = _value;
+          }, 1024, true);
+    }
+
+    typedef Aligned<Vector3d> Vector3dAligned;
+    typedef Aligned<Vector3f> Vector3fAligned;
+    typedef Aligned<Matrix4d> Matrix4dAligned;
+    typedef Aligned<Matrix4f> Matrix4fAligned;
+    typedef Aligned<Pose3d> Pose3dAligned;
+    typedef Aligned<Pose3f> Pose3fAligned;
+    }
+  }
+}
+#endif
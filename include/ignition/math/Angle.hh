@@ -17,6 +17,7 @@
 #ifndef IGNITION_MATH_ANGLE_HH_
 #define IGNITION_MATH_ANGLE_HH_
 
+#include <cstddef>
 #include <iostream>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/config.hh>
@@ -55,6 +56,12 @@ namespace ignition
     /// radians. An example of this are the stream insertion (<<) and
     /// extraction (>>) operators.
     ///
+    /// Angle is a constexpr value type: construction, unit conversion
+    /// and arithmetic fold at compile time, and the class is meant to
+    /// be passed by value. The literals in ignition::math::literals
+    /// (for example 90.0_ign_deg) build angles whose degree-to-radian
+    /// conversion is done by the compiler.
+    ///
     /// ## Example
     ///
     /// \snippet examples/angle_example.cc complete
@@ -78,7 +85,7 @@ namespace ignition
 
       /// \brief Default constructor that initializes an Angle to zero
       /// radians/degrees.
-      public: Angle();
+      public: constexpr Angle() = default;
 
       /// \brief Conversion constructor that initializes an Angle to the
       /// specified radians. This constructor supports implicit conversion
@@ -90,59 +97,130 @@ namespace ignition
       //
       /// \param[in] _radian The radians used to initialize this Angle.
       // cppcheck-suppress noExplicitConstructor
-      public: Angle(const double _radian);
+      public: constexpr Angle(const double _radian)
+              : value(_radian)
+              {
+              }
 
       /// \brief Copy constructor that initializes this Angle to the value
       /// contained in the _angle parameter.
       /// \param[in] _angle Angle to copy
-      public: Angle(const Angle &_angle);
+      public: Angle(const Angle &_angle) = default;
+
+      /// \brief Copy assignment operator.
+      /// \param[in] _angle Angle to copy.
+      /// \return Reference to this.
+      public: Angle &operator=(const Angle &_angle) = default;
 
       /// \brief Destructor
-      public: virtual ~Angle();
+      public: ~Angle() = default;
 
       /// \brief Set the value from an angle in radians.
       /// \param[in] _radian Radian value.
       /// \sa SetRadian(double)
-      public: void Radian(double _radian);
+      public: void Radian(double _radian)
+              {
+                this->value = _radian;
+              }
 
       /// \brief Set the value from an angle in radians.
       /// \param[in] _radian Radian value.
-      public: void SetRadian(double _radian);
+      public: void SetRadian(double _radian)
+              {
+                this->value = _radian;
+              }
 
       /// \brief Set the value from an angle in degrees
       /// \param[in] _degree Degree value
       /// \sa SetDegree(double)
-      public: void Degree(double _degree);
+      public: void Degree(double _degree)
+              {
+                this->value = _degree * IGN_PI / 180.0;
+              }
 
       /// \brief Set the value from an angle in degrees
       /// \param[in] _degree Degree value
-      public: void SetDegree(double _degree);
+      public: void SetDegree(double _degree)
+              {
+                this->value = _degree * IGN_PI / 180.0;
+              }
 
       /// \brief Get the angle in radians.
       /// \return Double containing the angle's radian value.
-      public: double Radian() const;
+      public: constexpr double Radian() const
+              {
+                return this->value;
+              }
 
       /// \brief Get the angle in degrees.
       /// \return Double containing the angle's degree value.
-      public: double Degree() const;
+      public: constexpr double Degree() const
+              {
+                return this->value * 180.0 / IGN_PI;
+              }
+
+      /// \brief Normalize a buffer of angles, in radians, into the
+      /// range -Pi to Pi in one pass. Equivalent to calling
+      /// Normalize() on an Angle per element, without the per-element
+      /// object round-trip. The buffers may alias for in-place
+      /// normalization.
+      /// \param[in] _radians Angles in radians.
+      /// \param[out] _out Normalized angles in radians.
+      /// \param[in] _count Number of values.
+      public: static void NormalizeBatch(const double *_radians,
+                  double *_out, const size_t _count);
+
+      /// \brief Normalize a buffer of angles, in radians, into the
+      /// range [-Pi, Pi) using a branchless floor-based wrap instead
+      /// of the atan2(sin, cos) mapping. Several times faster than
+      /// NormalizeBatch on large buffers and exact for angles that are
+      /// representable multiples of the wrap, but results can differ
+      /// from Normalize() by about a unit in the last place, and +Pi
+      /// maps to -Pi. The buffers may alias for in-place
+      /// normalization.
+      /// \param[in] _radians Angles in radians.
+      /// \param[out] _out Normalized angles in radians.
+      /// \param[in] _count Number of values.
+      public: static void NormalizeBatchFast(const double *_radians,
+                  double *_out, const size_t _count);
+
+      /// \brief Compute the shortest signed angular distance from each
+      /// angle in _a to the corresponding angle in _b, in radians,
+      /// wrapped into [-Pi, Pi). Uses the same branchless wrap as
+      /// NormalizeBatchFast. The output buffer may alias either input.
+      /// \param[in] _a Start angles in radians.
+      /// \param[in] _b End angles in radians.
+      /// \param[out] _out Shortest distances _b - _a in radians.
+      /// \param[in] _count Number of values.
+      public: static void ShortestDistanceBatch(const double *_a,
+                  const double *_b, double *_out, const size_t _count);
 
       /// \brief Normalize the angle in the range -Pi to Pi. This
       /// modifies the value contained in this Angle instance.
       /// \sa Normalized()
-      public: void Normalize();
+      public: void Normalize()
+              {
+                this->value = atan2(sin(this->value), cos(this->value));
+              }
 
       /// \brief Return the normalized angle in the range -Pi to Pi. This
       /// does not modify the value contained in this Angle instance.
       /// \return The normalized value of this Angle.
-      public: Angle Normalized() const;
+      public: Angle Normalized() const
+              {
+                return atan2(sin(this->value), cos(this->value));
+              }
 
       /// \brief Return the angle's radian value
       /// \return double containing the angle's radian value
-      public: double operator()() const;
+      public: constexpr double operator()() const
+              {
+                return this->value;
+              }
 
       /// \brief Dereference operator
       /// \return Double containing the angle's radian value
-      public: inline double operator*() const
+      public: constexpr double operator*() const
               {
                 return value;
               }
@@ -150,72 +228,124 @@ namespace ignition
       /// \brief Subtraction operator, result = this - _angle.
       /// \param[in] _angle Angle for subtraction.
       /// \return The new angle.
-      public: Angle operator-(const Angle &_angle) const;
+      public: constexpr Angle operator-(const Angle _angle) const
+              {
+                return Angle(this->value - _angle.value);
+              }
 
       /// \brief Addition operator, result = this + _angle.
       /// \param[in] _angle Angle for addition.
       /// \return The new angle.
-      public: Angle operator+(const Angle &_angle) const;
+      public: constexpr Angle operator+(const Angle _angle) const
+              {
+                return Angle(this->value + _angle.value);
+              }
 
       /// \brief Multiplication operator, result = this * _angle.
       /// \param[in] _angle Angle for multiplication.
       /// \return The new angle
-      public: Angle operator*(const Angle &_angle) const;
+      public: constexpr Angle operator*(const Angle _angle) const
+              {
+                return Angle(this->value * _angle.value);
+              }
 
       /// \brief Division operator, result = this / _angle.
       /// \param[in] _angle Angle for division.
       /// \return The new angle.
-      public: Angle operator/(const Angle &_angle) const;
+      public: constexpr Angle operator/(const Angle _angle) const
+              {
+                return Angle(this->value / _angle.value);
+              }
 
       /// \brief Subtraction set operator, this = this - _angle.
       /// \param[in] _angle Angle for subtraction.
       /// \return The new angle.
-      public: Angle operator-=(const Angle &_angle);
+      public: Angle operator-=(const Angle _angle)
+              {
+                this->value -= _angle.value;
+                return *this;
+              }
 
       /// \brief Addition set operator, this = this + _angle.
       /// \param[in] _angle Angle for addition.
       /// \return The new angle.
-      public: Angle operator+=(const Angle &_angle);
+      public: Angle operator+=(const Angle _angle)
+              {
+                this->value += _angle.value;
+                return *this;
+              }
 
       /// \brief Multiplication set operator, this = this * _angle.
       /// \param[in] _angle Angle for multiplication.
       /// \return The new angle.
-      public: Angle operator*=(const Angle &_angle);
+      public: Angle operator*=(const Angle _angle)
+              {
+                this->value *= _angle.value;
+                return *this;
+              }
 
       /// \brief Division set operator, this = this / _angle.
       /// \param[in] _angle Angle for division.
       /// \return The new angle.
-      public: Angle operator/=(const Angle &_angle);
+      public: Angle operator/=(const Angle _angle)
+              {
+                this->value /= _angle.value;
+                return *this;
+              }
 
-      /// \brief Equality operator, result = this == _angle.
+      /// \brief Equality operator, result = this == _angle. Angles
+      /// within 0.001 radian of each other compare equal.
       /// \param[in] _angle Angle to check for equality.
       /// \return True if this == _angle.
-      public: bool operator==(const Angle &_angle) const;
+      public: constexpr bool operator==(const Angle _angle) const
+              {
+                const double diff = this->value - _angle.value;
+                return (diff < 0 ? -diff : diff) <= 0.001;
+              }
 
       /// \brief Inequality operator
       /// \param[in] _angle Angle to check for inequality.
       /// \return True if this != _angle.
-      public: bool operator!=(const Angle &_angle) const;
+      public: constexpr bool operator!=(const Angle _angle) const
+              {
+                return !(*this == _angle);
+              }
 
       /// \brief Less than operator.
       /// \param[in] _angle Angle to check.
       /// \return True if this < _angle.
-      public: bool operator<(const Angle &_angle) const;
+      public: constexpr bool operator<(const Angle _angle) const
+              {
+                return this->value < _angle.value;
+              }
 
       /// \brief Less than or equal operator.
       /// \param[in] _angle Angle to check.
       /// \return True if this <= _angle.
-      public: bool operator<=(const Angle &_angle) const;
+      public: constexpr bool operator<=(const Angle _angle) const
+              {
+                const double diff = this->value - _angle.value;
+                return this->value < _angle.value ||
+                    (diff < 0 ? -diff : diff) <= 1e-6;
+              }
 
       /// \brief Greater than operator.
       /// \param[in] _angle Angle to check.
       /// \return True if this > _angle.
-      public: bool operator>(const Angle &_angle) const;
+      public: constexpr bool operator>(const Angle _angle) const
+              {
+                return this->value > _angle.value;
+              }
 
       /// \brief Greater than or equal operator.
       /// \param[in] _angle Angle to check.
       /// \return True if this >= _angle.
-      public: bool operator>=(const Angle &_angle) const;
+      public: constexpr bool operator>=(const Angle _angle) const
+              {
+                const double diff = this->value - _angle.value;
+                return this->value > _angle.value ||
+                    (diff < 0 ? -diff : diff) <= 1e-6;
+              }
 
       /// \brief Stream insertion operator. Outputs in radians.
       /// \param[in] _out Output stream.
@@ -244,6 +374,56 @@ namespace ignition
       /// The angle in radians
       private: double value{0};
     };
+
+    /// \brief Get a normalized copy of an angle, in the range -Pi to
+    /// Pi. A free, pass-by-value spelling of Angle::Normalized for
+    /// code that prefers non-member calls.
+    /// \param[in] _angle The angle to normalize.
+    /// \return The normalized angle.
+    inline Angle normalized(const Angle _angle)
+    {
+      return _angle.Normalized();
+    }
+
+    /// \brief Angle literals, e.g. 90.0_ign_deg or 1.57_ign_rad.
+    /// The unit conversion of a degree literal folds at compile time.
+    inline namespace literals
+    {
+      /// \brief A radian literal.
+      /// \param[in] _radians The angle in radians.
+      /// \return The angle.
+      constexpr Angle operator"" _ign_rad(const long double _radians)
+      {
+        return Angle(static_cast<double>(_radians));
+      }
+
+      /// \brief An integral radian literal.
+      /// \param[in] _radians The angle in radians.
+      /// \return The angle.
+      constexpr Angle operator"" _ign_rad(
+          const unsigned long long _radians)
+      {
+        return Angle(static_cast<double>(_radians));
+      }
+
+      /// \brief A degree literal; the value is stored in radians.
+      /// \param[in] _degrees The angle in degrees.
+      /// \return The angle.
+      constexpr Angle operator"" _ign_deg(const long double _degrees)
+      {
+        return Angle(static_cast<double>(_degrees) * IGN_PI / 180.0);
+      }
+
+      /// \brief An integral degree literal; the value is stored in
+      /// radians.
+      /// \param[in] _degrees The angle in degrees.
+      /// \return The angle.
+      constexpr Angle operator"" _ign_deg(
+          const unsigned long long _degrees)
+      {
+        return Angle(static_cast<double>(_degrees) * IGN_PI / 180.0);
+      }
+    }
     }
   }
 }
@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_AXISALIGNEDBOX_HH_
 #define IGNITION_MATH_AXISALIGNEDBOX_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <tuple>
 #include <ignition/math/config.hh>
@@ -36,6 +38,83 @@ namespace ignition
     // Forward declaration of private data
     class AxisAlignedBoxPrivate;
 
+    /// \brief A ray prepared for repeated box intersection tests.
+    /// The direction is normalized and its reciprocal cached once at
+    /// construction, so casting the ray against many boxes with
+    /// AxisAlignedBox::IntersectBatch performs no divisions and no
+    /// per-axis branches. Distances follow the IntersectDist
+    /// convention: measured along the normalized direction, reported
+    /// minus the minimum distance.
+    class PreparedRay
+    {
+      /// \brief Constructor.
+      /// \param[in] _origin Origin of the ray.
+      /// \param[in] _dir Direction of the ray; normalized internally.
+      /// \param[in] _min Minimum allowed distance.
+      /// \param[in] _max Maximum allowed distance.
+      public: PreparedRay(const Vector3d &_origin, const Vector3d &_dir,
+                  const double _min = 0, const double _max = 1000)
+        : origin(_origin), dir(_dir), minDist(_min), maxDist(_max)
+      {
+        this->dir.Normalize();
+        // Zero components produce infinities, which the min/max
+        // ordering of the slab test handles.
+        this->invDir.Set(1.0 / this->dir.X(),
+                         1.0 / this->dir.Y(),
+                         1.0 / this->dir.Z());
+      }
+
+      /// \brief Get the ray origin.
+      /// \return The origin.
+      public: const Vector3d &Origin() const
+      {
+        return this->origin;
+      }
+
+      /// \brief Get the normalized ray direction.
+      /// \return The direction.
+      public: const Vector3d &Direction() const
+      {
+        return this->dir;
+      }
+
+      /// \brief Get the cached reciprocal of the direction.
+      /// \return The componentwise inverse direction.
+      public: const Vector3d &InverseDirection() const
+      {
+        return this->invDir;
+      }
+
+      /// \brief Get the minimum allowed distance.
+      /// \return The minimum distance.
+      public: double MinDist() const
+      {
+        return this->minDist;
+      }
+
+      /// \brief Get the maximum allowed distance.
+      /// \return The maximum distance.
+      public: double MaxDist() const
+      {
+        return this->maxDist;
+      }
+
+      /// \brief Ray origin.
+      private: Vector3d origin;
+
+      /// \brief Normalized ray direction.
+      private: Vector3d dir;
+
+      /// \brief Componentwise reciprocal of the direction.
+      private: Vector3d invDir;
+
+      /// \brief Minimum allowed distance.
+      private: double minDist;
+
+      /// \brief Maximum allowed distance.
+      private: double maxDist;
+    };
+
     /// \class AxisAlignedBox AxisAlignedBox.hh ignition/math/AxisAlignedBox.hh
     /// \brief Mathematical representation of a box that is aligned along
     /// an X,Y,Z axis.
@@ -97,6 +176,30 @@ namespace ignition
       /// \param[in]  _box AxisAlignedBox to add to this box
       public: void Merge(const AxisAlignedBox &_box);
 
+      /// \brief Build the bounding box of a point set in one pass.
+      ///
+      /// The six bound components accumulate in locals over a single
+      /// sweep of the array, instead of one Merge call per point, so
+      /// the loop reduces to component-wise min/max the compiler can
+      /// vectorize.
+      /// \param[in] _points Array of points; may be null when
+      /// \p _count is zero.
+      /// \param[in] _count Number of points.
+      /// \return The tightest box containing every point, or a
+      /// default (inverted) box for an empty set.
+      public: static AxisAlignedBox FromPoints(const Vector3d *_points,
+                  const size_t _count);
+
+      /// \brief Merge an array of boxes in one pass.
+      /// \param[in] _boxes Array of boxes; may be null when \p _count
+      /// is zero. Default (inverted) boxes are absorbed without
+      /// affecting the result, as with Merge.
+      /// \param[in] _count Number of boxes.
+      /// \return The union bound, or a default (inverted) box for an
+      /// empty set.
+      public: static AxisAlignedBox MergeAll(const AxisAlignedBox *_boxes,
+                  const size_t _count);
+
       /// \brief Assignment operator. Set this box to the parameter
       /// \param[in]  _b AxisAlignedBox to copy
       /// \return The new box.
@@ -167,6 +270,28 @@ namespace ignition
       /// \return True if this box intersects _box.
       public: bool Intersects(const AxisAlignedBox &_box) const;
 
+      /// \brief Branchless variant of Intersects. All six separating
+      /// plane comparisons are evaluated and combined bitwise instead
+      /// of short-circuiting, so broadphase pair loops whose outcome
+      /// the branch predictor cannot learn pay a fixed cost rather
+      /// than repeated mispredictions. Results match Intersects under
+      /// the same precondition on corner ordering.
+      /// \param[in] _box AxisAlignedBox to check for intersection with
+      /// this box.
+      /// \return True if this box intersects _box.
+      public: bool IntersectsBranchless(const AxisAlignedBox &_box) const;
+
+      /// \brief Check whether a box intersects any box in an array,
+      /// returning on the first hit. The per-pair test is the
+      /// branchless variant, so the only data-dependent branch in the
+      /// scan is the early exit itself.
+      /// \param[in] _box Query box.
+      /// \param[in] _boxes Array of boxes to test against.
+      /// \param[in] _count Number of boxes in the array.
+      /// \return True if _box intersects at least one array element.
+      public: static bool IntersectsAny(const AxisAlignedBox &_box,
+                  const AxisAlignedBox *_boxes, const std::size_t _count);
+
       /// \brief Check if a point lies inside the box.
       /// \param[in] _p Point to check.
       /// \return True if the point is inside the box.
@@ -232,6 +357,27 @@ namespace ignition
       public: std::tuple<bool, double, Vector3d> Intersect(
                   const Line3d &_line) const;
 
+      /// \brief Cast one prepared ray against many boxes with the
+      /// branchless slab method. The ray's reciprocal direction is
+      /// cached in the PreparedRay, so the per-box loop performs only
+      /// multiplies and min/max operations, with no divisions and no
+      /// data-dependent branches for BVH leaves to mispredict.
+      /// \param[in] _ray The prepared ray.
+      /// \param[in] _boxes Array of boxes to test.
+      /// \param[in] _count Number of boxes.
+      /// \param[out] _hits Destination array of _count flags; an
+      /// element is set to 1 when the ray hits the corresponding box
+      /// within the ray's distance range and 0 otherwise.
+      /// \param[out] _dists Optional destination array of _count
+      /// distances, following the IntersectDist convention: distance
+      /// from the ray start to the closest intersection, minus the
+      /// ray's minimum distance, and zero on a miss. Pass nullptr when
+      /// distances are not needed.
+      /// \return The number of boxes hit.
+      public: static size_t IntersectBatch(const PreparedRay &_ray,
+                  const AxisAlignedBox *_boxes, const size_t _count,
+                  uint8_t *_hits, double *_dists = nullptr);
+
       /// \brief Get the volume of the box in m^3.
       /// \return Volume of the box in m^3.
       public: double Volume() const;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_AXISALIGNEDBOXTREE_HH_
+#define IGNITION_MATH_AXISALIGNEDBOXTREE_HH_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Frustum.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declaration of private data
+    class AxisAlignedBoxTreePrivate;
+
+    /// \brief A bounding volume hierarchy over a set of axis aligned
+    /// boxes, for broadphase queries against many boxes at once.
+    ///
+    /// The tree is built bottom-up over a Morton-code (Z-order) sort of
+    /// the box centers and stored in one contiguous node array, so
+    /// queries walk cache-friendly memory instead of chasing pointers.
+    /// Build() is linear up to the sort; queries are logarithmic for
+    /// localized volumes.
+    class IGNITION_MATH_VISIBLE AxisAlignedBoxTree
+    {
+      /// \brief Default constructor. The tree starts empty.
+      public: AxisAlignedBoxTree();
+
+      /// \brief Destructor
+      public: ~AxisAlignedBoxTree();
+
+      /// \brief Build the hierarchy from an array of boxes. Any
+      /// previous contents are discarded. The boxes are copied into the
+      /// tree; query results refer to their indices in this array.
+      /// \param[in] _boxes Array of boxes.
+      /// \param[in] _n Number of boxes.
+      public: void Build(const AxisAlignedBox *_boxes, size_t _n);
+
+      /// \brief Get the number of boxes in the tree.
+      /// \return Box count.
+      public: size_t Count() const;
+
+      /// \brief Get one of the stored boxes.
+      /// \param[in] _index Index of the box, as used in query results.
+      /// \return The box, or an empty default box for an invalid index.
+      public: AxisAlignedBox Box(size_t _index) const;
+
+      /// \brief Find all stored boxes that intersect a volume.
+      /// \param[in] _box Query volume.
+      /// \param[out] _result Indices of the intersecting boxes. The
+      /// vector is cleared first.
+      public: void Intersecting(const AxisAlignedBox &_box,
+                  std::vector<size_t> &_result) const;
+
+      /// \brief Find all intersecting pairs among the stored boxes.
+      /// \param[out] _pairs Each intersecting pair exactly once, with
+      /// first < second. The vector is cleared first.
+      public: void IntersectAll(
+                  std::vector<std::pair<size_t, size_t>> &_pairs) const;
+
+      /// \brief Find all stored boxes hit by a ray.
+      /// \param[in] _origin Origin of the ray.
+      /// \param[in] _dir Direction of the ray. The direction will be
+      /// normalized.
+      /// \param[in] _min Minimum distance along the ray to check.
+      /// \param[in] _max Maximum distance along the ray to check.
+      /// \param[out] _result Indices of the boxes hit by the ray. The
+      /// vector is cleared first.
+      public: void RayQuery(const Vector3d &_origin, const Vector3d &_dir,
+                  double _min, double _max,
+                  std::vector<size_t> &_result) const;
+
+      /// \brief Find all stored boxes that intersect a frustum.
+      /// Interior nodes whose bounds miss the frustum are pruned, so
+      /// culling a large scene touches only the nodes near the frustum.
+      /// \param[in] _frustum Query frustum.
+      /// \param[out] _result Indices of the intersecting boxes. The
+      /// vector is cleared first.
+      public: void FrustumQuery(const Frustum &_frustum,
+                  std::vector<size_t> &_result) const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<AxisAlignedBoxTreePrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
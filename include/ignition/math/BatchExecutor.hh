@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_BATCHEXECUTOR_HH_
+#define IGNITION_MATH_BATCHEXECUTOR_HH_
+
+#include <cstddef>
+#include <string>
+
+#include <ignition/math/Export.hh>
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Quaternion.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE
+    {
+    /// \brief Execution backend for the library's batch kernels.
+    ///
+    /// The default backend runs the existing CPU implementations,
+    /// Matrix4::TransformPoints and Quaternion::RotateVectors, so
+    /// callers that route their batch work through
+    /// BatchExecutor::Active() get today's behavior unchanged. A
+    /// process that links an accelerator runtime can subclass this
+    /// interface, implement the kernels with its own device code, and
+    /// install the instance with SetActive; every call site using the
+    /// executor then dispatches to the device without duplicating any
+    /// math code. The buffer hooks exist for the same reason: device
+    /// backends typically need pinned or device-visible staging
+    /// memory, so buffers that will flow through an executor should
+    /// come from its AllocateBuffer rather than the global allocator.
+    ///
+    /// Backends are expected to match the CPU kernels' semantics,
+    /// including aliasing support (_out may equal _in) and the
+    /// degenerate-quaternion behavior of RotateVectors.
+    class IGNITION_MATH_VISIBLE BatchExecutor
+    {
+      /// \brief Destructor.
+      public: virtual ~BatchExecutor();
+
+      /// \brief Get the backend's name, for diagnostics.
+      /// \return The backend name. The default backend is named "cpu".
+      public: virtual std::string Name() const;
+
+      /// \brief Transform an array of points, _out[i] = _tf * _in[i].
+      /// \param[in] _tf Affine transform to apply.
+      /// \param[in] _in Array of points to transform.
+      /// \param[out] _out Destination array; must hold _n elements
+      /// and may alias _in.
+      /// \param[in] _n Number of points.
+      public: virtual void TransformPoints(const Matrix4d &_tf,
+                  const Vector3d *_in, Vector3d *_out, size_t _n) const;
+
+      /// \brief Rotate an array of vectors by a quaternion.
+      /// \param[in] _q Rotation to apply.
+      /// \param[in] _in Array of vectors to rotate.
+      /// \param[out] _out Destination array; must hold _n elements
+      /// and may alias _in.
+      /// \param[in] _n Number of vectors.
+      public: virtual void RotateVectors(const Quaterniond &_q,
+                  const Vector3d *_in, Vector3d *_out, size_t _n) const;
+
+      /// \brief Allocate a buffer suitable for this backend's
+      /// transfer path. The default backend returns 64-byte aligned
+      /// memory; device backends typically return pinned host memory
+      /// so transfers can run asynchronously.
+      /// \param[in] _bytes Number of bytes to allocate.
+      /// \return Pointer to the buffer, or nullptr when _bytes is
+      /// zero or the allocation fails. Release with FreeBuffer on the
+      /// same backend.
+      public: virtual void *AllocateBuffer(size_t _bytes) const;
+
+      /// \brief Free a buffer obtained from AllocateBuffer.
+      /// \param[in] _ptr Buffer to free. A nullptr is ignored.
+      public: virtual void FreeBuffer(void *_ptr) const;
+
+      /// \brief Get the active executor. This is the CPU default
+      /// unless a backend has been installed with SetActive.
+      /// \return Reference to the active executor.
+      public: static BatchExecutor &Active();
+
+      /// \brief Install an execution backend. The library does not
+      /// take ownership: the caller must keep _executor alive until
+      /// it is uninstalled, and buffers allocated from a backend must
+      /// be freed before it goes away.
+      /// \param[in] _executor Backend to make active, or nullptr to
+      /// restore the CPU default.
+      /// \return The previously active executor, or nullptr if the
+      /// CPU default was active.
+      public: static BatchExecutor *SetActive(BatchExecutor *_executor);
+    };
+    }
+  }
+}
+#endif
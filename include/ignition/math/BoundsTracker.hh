@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_BOUNDSTRACKER_HH_
+#define IGNITION_MATH_BOUNDSTRACKER_HH_
+
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class BoundsTrackerPrivate;
+
+    /// \brief Incremental world-bounds maintenance over a set of
+    /// member AxisAlignedBoxes.
+    ///
+    /// Recomputing the merged bounds of a dynamic scene from scratch is
+    /// O(n) per frame even when almost nothing moved. A BoundsTracker
+    /// keeps the member boxes in the leaves of a binary tree of partial
+    /// merges, so updating or removing one member only recomputes the
+    /// merges on its root path — O(log n) — and the up-to-date total
+    /// bounds are always available in O(1) at the root.
+    ///
+    /// Note the tracked bounds never shrink below the true merge; they
+    /// are exact, not conservative, because every ancestor merge on the
+    /// changed path is recomputed from its two children.
+    class IGNITION_MATH_VISIBLE BoundsTracker
+    {
+      /// \brief Constructor.
+      public: BoundsTracker();
+
+      /// \brief Destructor.
+      public: virtual ~BoundsTracker();
+
+      /// \brief Track a new member box.
+      /// \param[in] _box The member's bounds.
+      /// \return An id identifying the member in later calls. Ids of
+      /// removed members are reused.
+      public: size_t Add(const AxisAlignedBox &_box);
+
+      /// \brief Replace a member's bounds, recomputing only the
+      /// O(log n) partial merges the member contributes to.
+      /// \param[in] _id Id returned by Add.
+      /// \param[in] _box The member's new bounds.
+      /// \return True if _id names a tracked member.
+      public: bool Update(const size_t _id, const AxisAlignedBox &_box);
+
+      /// \brief Stop tracking a member.
+      /// \param[in] _id Id returned by Add.
+      /// \return True if _id named a tracked member.
+      public: bool Remove(const size_t _id);
+
+      /// \brief Get a member's current bounds.
+      /// \param[in] _id Id returned by Add.
+      /// \param[out] _box The member's bounds; untouched when _id is
+      /// unknown.
+      /// \return True if _id names a tracked member.
+      public: bool Box(const size_t _id, AxisAlignedBox &_box) const;
+
+      /// \brief Get the number of tracked members.
+      /// \return The member count.
+      public: size_t Count() const;
+
+      /// \brief Get the merged bounds of all tracked members.
+      /// \return The total bounds, or a default (empty) AxisAlignedBox
+      /// when nothing is tracked.
+      public: AxisAlignedBox Bounds() const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<BoundsTrackerPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
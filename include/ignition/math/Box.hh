@@ -18,8 +18,10 @@
 #define IGNITION_MATH_BOX_HH_
 
 #include <ignition/math/config.hh>
+#include <ignition/math/AxisAlignedBox.hh>
 #include <ignition/math/MassMatrix3.hh>
 #include <ignition/math/Material.hh>
+#include <ignition/math/Pose3.hh>
 #include <ignition/math/Vector3.hh>
 
 namespace ignition
@@ -165,6 +167,41 @@ namespace ignition
       /// could be due to an invalid size (<=0) or density (<=0).
       public: bool MassMatrix(MassMatrix3<Precision> &_massMat) const;
 
+      /// \brief Get the axis aligned bounding box of the box at a
+      /// given pose.
+      /// \param[in] _pose Pose of the box center in the world frame.
+      /// \return The world frame bounding box, in double precision.
+      public: AxisAlignedBox AxisAlignedBoundingBox(
+                  const Pose3d &_pose = Pose3d::Zero) const;
+
+      /// \brief Compute AxisAlignedBoundingBox for many boxes in one
+      /// call.
+      /// \param[in] _boxes Array of boxes.
+      /// \param[in] _poses Array of _count poses, one per box.
+      /// \param[in] _count Number of boxes.
+      /// \param[out] _aabbs Destination array of _count bounding
+      /// boxes.
+      public: static void AxisAlignedBoundingBoxBatch(
+                  const Box<Precision> *_boxes, const Pose3d *_poses,
+                  const size_t _count, AxisAlignedBox *_aabbs);
+
+      /// \brief Get the corner of the box farthest along a direction,
+      /// in the box's local frame. This is the support function used
+      /// by GJK-style collision algorithms.
+      /// \param[in] _dir The direction; it need not be normalized. A
+      /// zero direction component picks the positive face.
+      /// \return The support point.
+      public: Vector3<Precision> SupportPoint(
+                  const Vector3<Precision> &_dir) const;
+
+      /// \brief Compute SupportPoint for many directions in one call.
+      /// \param[in] _dirs Array of directions.
+      /// \param[in] _count Number of directions.
+      /// \param[out] _points Destination array of _count support
+      /// points.
+      public: void SupportPointBatch(const Vector3<Precision> *_dirs,
+                  const size_t _count, Vector3<Precision> *_points) const;
+
       /// \brief Size of the box.
       private: Vector3<Precision> size = Vector3<Precision>::Zero;
 
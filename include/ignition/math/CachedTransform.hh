@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_CACHEDTRANSFORM_HH_
+#define IGNITION_MATH_CACHEDTRANSFORM_HH_
+
+#include <cstdint>
+
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class CachedTransform CachedTransform.hh
+    /// ignition/math/CachedTransform.hh
+    /// \brief A Matrix4 wrapper that memoizes the inverse and the
+    /// determinant.
+    ///
+    /// Matrix4::Inverse() and Matrix4::Determinant() run a full cofactor
+    /// expansion on every call. For transforms that change rarely but are
+    /// queried often, such as scene-graph node transforms, this wrapper
+    /// computes each quantity once after a mutation and answers
+    /// subsequent queries from the cache. A version counter, bumped by
+    /// every mutator, lets dependents detect changes cheaply.
+    template<typename T>
+    class CachedTransform
+    {
+      /// \brief Default constructor. The transform starts as identity.
+      public: CachedTransform()
+      : matrix(Matrix4<T>::Identity)
+      {
+      }
+
+      /// \brief Constructor.
+      /// \param[in] _m The initial transform.
+      public: explicit CachedTransform(const Matrix4<T> &_m)
+      : matrix(_m)
+      {
+      }
+
+      /// \brief Constructor from a pose.
+      /// \param[in] _pose The initial transform as a pose.
+      public: explicit CachedTransform(const Pose3<T> &_pose)
+      : matrix(_pose)
+      {
+      }
+
+      /// \brief Get the current transform.
+      /// \return The transform.
+      public: const Matrix4<T> &Matrix() const
+      {
+        return this->matrix;
+      }
+
+      /// \brief Set the transform, invalidating the cached inverse and
+      /// determinant.
+      /// \param[in] _m The new transform.
+      public: void SetMatrix(const Matrix4<T> &_m)
+      {
+        this->matrix = _m;
+        this->Invalidate();
+      }
+
+      /// \brief Set the transform from a pose, invalidating the cached
+      /// inverse and determinant.
+      /// \param[in] _pose The new transform as a pose.
+      public: void SetPose(const Pose3<T> &_pose)
+      {
+        this->matrix = Matrix4<T>(_pose);
+        this->Invalidate();
+      }
+
+      /// \brief Get the inverse of the transform. The cofactor expansion
+      /// runs only on the first call after a mutation; later calls read
+      /// the cached matrix.
+      /// \return The cached inverse.
+      public: const Matrix4<T> &Inverse() const
+      {
+        if (!this->inverseValid)
+        {
+          this->inverse = this->matrix.Inverse();
+          this->inverseValid = true;
+        }
+        return this->inverse;
+      }
+
+      /// \brief Get the determinant of the transform, computed on the
+      /// first call after a mutation and cached afterwards.
+      /// \return The cached determinant.
+      public: T Determinant() const
+      {
+        if (!this->determinantValid)
+        {
+          this->determinant = this->matrix.Determinant();
+          this->determinantValid = true;
+        }
+        return this->determinant;
+      }
+
+      /// \brief Get the version of the transform. The version increases
+      /// by one on every mutation, so dependents can compare versions
+      /// instead of matrices to detect changes.
+      /// \return The version counter.
+      public: uint64_t Version() const
+      {
+        return this->version;
+      }
+
+      /// \brief Drop the cached values and bump the version.
+      private: void Invalidate()
+      {
+        this->inverseValid = false;
+        this->determinantValid = false;
+        ++this->version;
+      }
+
+      /// \brief The current transform.
+      private: Matrix4<T> matrix;
+
+      /// \brief Cached inverse, valid when inverseValid is true.
+      private: mutable Matrix4<T> inverse;
+
+      /// \brief Cached determinant, valid when determinantValid is true.
+      private: mutable T determinant = T(0);
+
+      /// \brief True while the cached inverse matches the transform.
+      private: mutable bool inverseValid = false;
+
+      /// \brief True while the cached determinant matches the transform.
+      private: mutable bool determinantValid = false;
+
+      /// \brief Mutation counter.
+      private: uint64_t version = 0;
+    };
+
+    typedef CachedTransform<double> CachedTransformd;
+    typedef CachedTransform<float> CachedTransformf;
+    }
+  }
+}
+#endif
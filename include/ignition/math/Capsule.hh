@@ -18,8 +18,12 @@
 #define IGNITION_MATH_CAPSULE_HH_
 
 #include <optional>
+#include <cstddef>
+#include <cstdint>
+#include "ignition/math/AxisAlignedBox.hh"
 #include "ignition/math/MassMatrix3.hh"
 #include "ignition/math/Material.hh"
+#include "ignition/math/Pose3.hh"
 
 namespace ignition
 {
@@ -90,6 +94,19 @@ namespace ignition
       /// std::nullopt is returned.
       public: std::optional< MassMatrix3<Precision> > MassMatrix() const;
 
+      /// \brief Compute the mass matrix of many capsules in one call.
+      /// Each element behaves like MassMatrix; the batch form exists so
+      /// bulk shape setup runs as one loop over packed parameters.
+      /// \param[in] _capsules Array of capsules.
+      /// \param[in] _count Number of capsules.
+      /// \param[out] _massMats Destination array of _count mass
+      /// matrices; elements with invalid parameters are left untouched.
+      /// \param[out] _valid Destination array of _count flags, 1 where
+      /// the mass matrix was computed and 0 otherwise.
+      public: static void MassMatrixBatch(
+                  const Capsule<Precision> *_capsules, const size_t _count,
+                  MassMatrix3<Precision> *_massMats, uint8_t *_valid);
+
       /// \brief Check if this capsule is equal to the provided capsule.
       /// Radius, length, and material properties will be checked.
       public: bool operator==(const Capsule &_capsule) const;
@@ -108,6 +125,18 @@ namespace ignition
       /// if radius, length or _mass is <= 0.
       public: Precision DensityFromMass(const Precision _mass) const;
 
+      /// \brief Compute DensityFromMass over arrays of capsules and
+      /// masses.
+      /// \param[in] _capsules Array of capsules.
+      /// \param[in] _masses Array of _count masses in kg.
+      /// \param[out] _densities Destination array of _count densities
+      /// in kg/m^3, NaN where the scalar call would return NaN.
+      /// \param[in] _count Number of capsules.
+      public: static void DensityFromMassBatch(
+                  const Capsule<Precision> *_capsules,
+                  const Precision *_masses, Precision *_densities,
+                  const size_t _count);
+
       /// \brief Set the density of this capsule based on a mass value.
       /// Density is computed using
       /// Precision DensityFromMass(const Precision _mass) const. The
@@ -122,9 +151,52 @@ namespace ignition
       /// \sa Precision DensityFromMass(const Precision _mass) const
       public: bool SetDensityFromMass(const Precision _mass);
 
+      /// \brief Get the axis aligned bounding box of the capsule at a
+      /// given pose.
+      /// \param[in] _pose Pose of the capsule center in the world
+      /// frame.
+      /// \return The world frame bounding box, in double precision.
+      public: AxisAlignedBox AxisAlignedBoundingBox(
+                  const Pose3d &_pose = Pose3d::Zero) const;
+
+      /// \brief Compute AxisAlignedBoundingBox for many capsules in
+      /// one call.
+      /// \param[in] _capsules Array of capsules.
+      /// \param[in] _poses Array of _count poses, one per capsule.
+      /// \param[in] _count Number of capsules.
+      /// \param[out] _boxes Destination array of _count bounding
+      /// boxes.
+      public: static void AxisAlignedBoundingBoxBatch(
+                  const Capsule<Precision> *_capsules,
+                  const Pose3d *_poses, const size_t _count,
+                  AxisAlignedBox *_boxes);
+
+      /// \brief Get the point of the capsule farthest along a
+      /// direction, in the capsule's local frame, where the axis is
+      /// aligned with the z axis. This is the support function used by
+      /// GJK-style collision algorithms.
+      /// \param[in] _dir The direction; it need not be normalized. A
+      /// zero direction returns the top cap sphere center.
+      /// \return The support point.
+      public: Vector3<Precision> SupportPoint(
+                  const Vector3<Precision> &_dir) const;
+
+      /// \brief Compute SupportPoint for many directions in one call.
+      /// \param[in] _dirs Array of directions.
+      /// \param[in] _count Number of directions.
+      /// \param[out] _points Destination array of _count support
+      /// points.
+      public: void SupportPointBatch(const Vector3<Precision> *_dirs,
+                  const size_t _count, Vector3<Precision> *_points) const;
+
       /// \brief Radius of the capsule.
       private: Precision radius = 0.0;
 
+      /// \brief Volume derived from radius and length, computed on the
+      /// first Volume() call and invalidated (set negative) by the
+      /// setters.
+      private: mutable Precision cachedVolume = -1.0;
+
       /// \brief Length of the capsule.
       private: Precision length = 0.0;
 
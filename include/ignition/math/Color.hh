@@ -109,6 +109,35 @@ namespace ignition
       /// \param[in] _v Value(0..1)
       public: void SetFromHSV(const float _h, const float _s, const float _v);
 
+      /// \brief Convert many HSV triplets to colors in one call. The
+      /// conversion uses a branch-free formulation, so large ramps (for
+      /// example heatmap lookups) convert at memory speed; the results
+      /// match SetFromHSV to floating point rounding. Alpha is set to 1.
+      /// \param[in] _hsv Array of HSV triplets, in the layout returned
+      /// by HSV().
+      /// \param[out] _colors One color per input triplet.
+      /// \param[in] _count Number of triplets.
+      public: static void BatchFromHSV(const Vector3f *_hsv,
+                  Color *_colors, size_t _count);
+
+      /// \brief Convert many HSV triplets directly to packed RGBA8
+      /// values, skipping the intermediate Color and the float-to-byte
+      /// conversion downstream. Alpha is set to 255.
+      /// \param[in] _hsv Array of HSV triplets.
+      /// \param[out] _rgba One packed value per triplet, in the same
+      /// byte order as AsRGBA().
+      /// \param[in] _count Number of triplets.
+      public: static void BatchFromHSV(const Vector3f *_hsv,
+                  RGBA *_rgba, size_t _count);
+
+      /// \brief Convert many colors to HSV triplets in one call,
+      /// matching the results of HSV().
+      /// \param[in] _colors Array of colors.
+      /// \param[out] _hsv One HSV triplet per color.
+      /// \param[in] _count Number of colors.
+      public: static void BatchToHSV(const Color *_colors,
+                  Vector3f *_hsv, size_t _count);
+
       /// \brief Get the color in YUV colorspace
       /// \return the YUV  color
       public: Vector3f YUV() const;
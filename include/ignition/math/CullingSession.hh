@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_CULLINGSESSION_HH_
+#define IGNITION_MATH_CULLINGSESSION_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Frustum.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class CullingSessionPrivate;
+
+    /// \brief Repeated frustum culling of a persistent set of boxes,
+    /// exploiting frame-to-frame coherence.
+    ///
+    /// Frustum::Contains and Frustum::ContainsBatch reevaluate every
+    /// box from scratch each frame, but in steady state very few
+    /// objects change culling state. The session groups the boxes into
+    /// spatially coherent blocks along the Z-order curve and remembers,
+    /// for each group and each box, the plane that rejected it last
+    /// frame. A group whose merged bounds fail their cached plane
+    /// rejects all of its members with one test, a group entirely
+    /// inside the frustum accepts all of its members with six, and only
+    /// boxes in groups straddling the boundary are tested
+    /// individually, against just the planes their group straddles.
+    /// Results match Frustum::Contains exactly.
+    class IGNITION_MATH_VISIBLE CullingSession
+    {
+      /// \brief Default constructor. The session starts empty.
+      public: CullingSession();
+
+      /// \brief Destructor.
+      public: ~CullingSession();
+
+      /// \brief Set the boxes to cull, replacing any previous set and
+      /// resetting all cached culling state.
+      /// \param[in] _boxes Array of _count boxes, copied. Box indices
+      /// reported by the session match this array.
+      /// \param[in] _count Number of boxes.
+      public: void SetBoxes(const AxisAlignedBox *_boxes,
+                  const std::size_t _count);
+
+      /// \brief Get the number of boxes in the session.
+      /// \return The box count.
+      public: std::size_t Count() const;
+
+      /// \brief Move one box. Its group's bounds are enlarged to keep
+      /// them conservative, so after many large moves the groups lose
+      /// tightness; rebuild with SetBoxes when that happens.
+      /// \param[in] _index Index of the box to update.
+      /// \param[in] _box The new box.
+      /// \return True on success, false if _index is out of range.
+      public: bool UpdateBox(const std::size_t _index,
+                  const AxisAlignedBox &_box);
+
+      /// \brief Cull the boxes against a frustum.
+      /// \param[in] _frustum The frustum to test against.
+      /// \param[out] _results Destination array of Count() flags; an
+      /// element is set to 1 if the corresponding box intersects the
+      /// frustum and 0 otherwise.
+      /// \return The number of visible boxes.
+      public: std::size_t Cull(const Frustum &_frustum,
+                  uint8_t *_results);
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<CullingSessionPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
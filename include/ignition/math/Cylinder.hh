@@ -17,8 +17,13 @@
 #ifndef IGNITION_MATH_CYLINDER_HH_
 #define IGNITION_MATH_CYLINDER_HH_
 
+#include <cstddef>
+#include <cstdint>
+
+#include "ignition/math/AxisAlignedBox.hh"
 #include "ignition/math/MassMatrix3.hh"
 #include "ignition/math/Material.hh"
+#include "ignition/math/Pose3.hh"
 #include "ignition/math/Quaternion.hh"
 
 namespace ignition
@@ -123,6 +128,20 @@ namespace ignition
       /// (<=0).
       public: bool MassMatrix(MassMatrix3d &_massMat) const;
 
+      /// \brief Compute the mass matrix of an array of cylinders in
+      /// one loop, for bulk shape setup. Each element behaves exactly
+      /// like MassMatrix.
+      /// \param[in] _cylinders Array of cylinders.
+      /// \param[in] _count Number of cylinders.
+      /// \param[out] _massMats Destination array of _count mass
+      /// matrices; elements that fail validation are left untouched.
+      /// \param[out] _valid Destination array of _count flags, 1 where
+      /// the computation succeeded and 0 where it failed.
+      public: static void MassMatrixBatch(
+                  const Cylinder<Precision> *_cylinders,
+                  const size_t _count, MassMatrix3d *_massMats,
+                  uint8_t *_valid);
+
       /// \brief Check if this cylinder is equal to the provided cylinder.
       /// Radius, length, and material properties will be checked.
       public: bool operator==(const Cylinder &_cylinder) const;
@@ -141,6 +160,18 @@ namespace ignition
       /// returned if radius, length or _mass is <= 0.
       public: Precision DensityFromMass(const Precision _mass) const;
 
+      /// \brief Compute DensityFromMass over arrays of cylinders and
+      /// masses.
+      /// \param[in] _cylinders Array of cylinders.
+      /// \param[in] _masses Array of _count masses in kg.
+      /// \param[out] _densities Destination array of _count densities
+      /// in kg/m^3, negative where the scalar call would be.
+      /// \param[in] _count Number of cylinders.
+      public: static void DensityFromMassBatch(
+                  const Cylinder<Precision> *_cylinders,
+                  const Precision *_masses, Precision *_densities,
+                  const size_t _count);
+
       /// \brief Set the density of this cylinder based on a mass value.
       /// Density is computed using
       /// Precision DensityFromMass(const Precision _mass) const. The
@@ -155,9 +186,53 @@ namespace ignition
       /// \sa Precision DensityFromMass(const Precision _mass) const
       public: bool SetDensityFromMass(const Precision _mass);
 
+      /// \brief Get the axis aligned bounding box of the cylinder at
+      /// a given pose. The cylinder's rotational offset is applied
+      /// before the pose rotation.
+      /// \param[in] _pose Pose of the cylinder center in the world
+      /// frame.
+      /// \return The world frame bounding box, in double precision.
+      public: AxisAlignedBox AxisAlignedBoundingBox(
+                  const Pose3d &_pose = Pose3d::Zero) const;
+
+      /// \brief Compute AxisAlignedBoundingBox for many cylinders in
+      /// one call.
+      /// \param[in] _cylinders Array of cylinders.
+      /// \param[in] _poses Array of _count poses, one per cylinder.
+      /// \param[in] _count Number of cylinders.
+      /// \param[out] _boxes Destination array of _count bounding
+      /// boxes.
+      public: static void AxisAlignedBoundingBoxBatch(
+                  const Cylinder<Precision> *_cylinders,
+                  const Pose3d *_poses, const size_t _count,
+                  AxisAlignedBox *_boxes);
+
+      /// \brief Get the point of the cylinder farthest along a
+      /// direction, in the cylinder's local frame, honoring the
+      /// rotational offset. This is the support function used by
+      /// GJK-style collision algorithms.
+      /// \param[in] _dir The direction; it need not be normalized. A
+      /// direction along the axis returns the cap center; a zero
+      /// direction returns the top cap center.
+      /// \return The support point.
+      public: Vector3<Precision> SupportPoint(
+                  const Vector3<Precision> &_dir) const;
+
+      /// \brief Compute SupportPoint for many directions in one call.
+      /// \param[in] _dirs Array of directions.
+      /// \param[in] _count Number of directions.
+      /// \param[out] _points Destination array of _count support
+      /// points.
+      public: void SupportPointBatch(const Vector3<Precision> *_dirs,
+                  const size_t _count, Vector3<Precision> *_points) const;
+
       /// \brief Radius of the cylinder.
       private: Precision radius = 0.0;
 
+      /// \brief Cached volume, recomputed lazily after the radius or
+      /// length changes. Negative when stale.
+      private: mutable Precision cachedVolume = -1.0;
+
       /// \brief Length of the cylinder.
       private: Precision length = 0.0;
 
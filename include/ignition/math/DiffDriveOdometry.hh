@@ -105,6 +105,50 @@ namespace ignition
       public: bool Update(const Angle &_leftPos, const Angle &_rightPos,
                           const clock::time_point &_time);
 
+      /// \brief Plain data snapshot of the odometry state, so bulk
+      /// consumers can read every field with one call instead of one
+      /// accessor each.
+      public: struct State
+      {
+        /// \brief The x position in meters.
+        double x;
+
+        /// \brief The y position in meters.
+        double y;
+
+        /// \brief The heading in radians.
+        double heading;
+
+        /// \brief The linear velocity in meters/second.
+        double linearVelocity;
+
+        /// \brief The angular velocity in radians/second.
+        double angularVelocity;
+      };
+
+      /// \brief Updates the odometry with a whole stream of encoder
+      /// samples in one pass, as produced by log replay.
+      ///
+      /// Equivalent to calling Update() per sample, but wheel
+      /// positions are plain radians and timestamps plain seconds, so
+      /// the loop performs no Angle or chrono conversions per sample.
+      /// \param[in] _leftPos Array of left wheel positions in radians.
+      /// \param[in] _rightPos Array of right wheel positions in
+      /// radians.
+      /// \param[in] _times Array of sample times in seconds since the
+      /// last update, strictly increasing. The internal update time
+      /// advances by the last entry.
+      /// \param[in] _count Number of samples.
+      /// \return The number of samples that updated the velocity
+      /// estimate, i.e. those with a non-zero time step.
+      public: size_t UpdateBatch(const double *_leftPos,
+                  const double *_rightPos, const double *_times,
+                  const size_t _count);
+
+      /// \brief Get a snapshot of the current state.
+      /// \return The current position, heading and velocities.
+      public: State CurrentState() const;
+
       /// \brief Get the heading.
       /// \return The heading in radians.
       public: const Angle &Heading() const;
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_DUALQUATERNION_HH_
+#define IGNITION_MATH_DUALQUATERNION_HH_
+
+#include <cstddef>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Quaternion.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class DualQuaternion DualQuaternion.hh ignition/math/DualQuaternion.hh
+    /// \brief A dual quaternion: a rigid transform encoded as a real
+    /// quaternion carrying the rotation and a dual quaternion part
+    /// carrying the translation.
+    ///
+    /// Dual quaternions compose like poses but, unlike Pose3, blend
+    /// linearly: a weighted sum of unit dual quaternions, renormalized,
+    /// is the dual linear blend (DLB) used for skinning and for fusing
+    /// nearby sensor poses. Converting through this class keeps the
+    /// whole blend in one pass instead of converting to an external
+    /// representation and back.
+    template<typename T>
+    class DualQuaternion
+    {
+      /// \brief Default constructor; the identity transform.
+      public: DualQuaternion()
+      : real(1, 0, 0, 0), dual(0, 0, 0, 0)
+      {
+      }
+
+      /// \brief Constructor from the two quaternion parts.
+      /// \param[in] _real The real (rotation) part.
+      /// \param[in] _dual The dual (translation) part.
+      public: DualQuaternion(const Quaternion<T> &_real,
+                  const Quaternion<T> &_dual)
+      : real(_real), dual(_dual)
+      {
+      }
+
+      /// \brief Constructor from a pose.
+      /// \param[in] _pose The pose; its rotation should be normalized.
+      public: explicit DualQuaternion(const Pose3<T> &_pose)
+      : real(_pose.Rot())
+      {
+        const Vector3<T> &p = _pose.Pos();
+        this->dual = Quaternion<T>(0, p.X() / 2, p.Y() / 2, p.Z() / 2) *
+            this->real;
+      }
+
+      /// \brief Copy constructor.
+      /// \param[in] _dq Dual quaternion to copy.
+      public: DualQuaternion(const DualQuaternion<T> &_dq) = default;
+
+      /// \brief Assignment operator.
+      /// \param[in] _dq Dual quaternion to copy.
+      /// \return This dual quaternion.
+      public: DualQuaternion<T> &operator=(
+                  const DualQuaternion<T> &_dq) = default;
+
+      /// \brief Destructor.
+      public: ~DualQuaternion() = default;
+
+      /// \brief Get the real (rotation) part.
+      /// \return The real part.
+      public: const Quaternion<T> &Real() const
+      {
+        return this->real;
+      }
+
+      /// \brief Get the dual (translation) part.
+      /// \return The dual part.
+      public: const Quaternion<T> &Dual() const
+      {
+        return this->dual;
+      }
+
+      /// \brief Get the pose this dual quaternion encodes.
+      /// \return The pose; valid when the dual quaternion is
+      /// normalized.
+      public: Pose3<T> Pose() const
+      {
+        // t = 2 * dual * real^-1; for a unit real part the inverse is
+        // the conjugate.
+        const Quaternion<T> t = this->dual * this->real.Inverse();
+        return Pose3<T>(
+            Vector3<T>(2 * t.X(), 2 * t.Y(), 2 * t.Z()), this->real);
+      }
+
+      /// \brief Compose two transforms. Matches Pose3 composition:
+      /// _dq is applied first, then this transform.
+      /// \param[in] _dq The transform applied first.
+      /// \return The composed transform.
+      public: DualQuaternion<T> operator*(
+                  const DualQuaternion<T> &_dq) const
+      {
+        return DualQuaternion<T>(this->real * _dq.real,
+            this->real * _dq.dual + this->dual * _dq.real);
+      }
+
+      /// \brief Add two dual quaternions part-wise. Together with
+      /// scalar multiplication this is the algebra blends are built
+      /// from; the sum of unit dual quaternions is not unit.
+      /// \param[in] _dq Dual quaternion to add.
+      /// \return The part-wise sum.
+      public: DualQuaternion<T> operator+(
+                  const DualQuaternion<T> &_dq) const
+      {
+        return DualQuaternion<T>(this->real + _dq.real,
+            this->dual + _dq.dual);
+      }
+
+      /// \brief Scale both parts.
+      /// \param[in] _f Scale factor.
+      /// \return The scaled dual quaternion.
+      public: DualQuaternion<T> operator*(const T _f) const
+      {
+        return DualQuaternion<T>(this->real * _f, this->dual * _f);
+      }
+
+      /// \brief Equality operator.
+      /// \param[in] _dq Dual quaternion to compare against, using the
+      /// Quaternion tolerance for both parts.
+      /// \return True when both parts match.
+      public: bool operator==(const DualQuaternion<T> &_dq) const
+      {
+        return this->real == _dq.real && this->dual == _dq.dual;
+      }
+
+      /// \brief Inequality operator.
+      /// \param[in] _dq Dual quaternion to compare against.
+      /// \return True when some part differs.
+      public: bool operator!=(const DualQuaternion<T> &_dq) const
+      {
+        return !(*this == _dq);
+      }
+
+      /// \brief Normalize this dual quaternion in place so the real
+      /// part is unit and the dual part stays orthogonal to it.
+      public: void Normalize()
+      {
+        const T length = this->real.Dot(this->real);
+        if (length <= T(0))
+        {
+          *this = DualQuaternion<T>();
+          return;
+        }
+
+        const T inv = T(1) / sqrt(length);
+        this->real = this->real * inv;
+        this->dual = this->dual * inv;
+
+        // Remove the component of the dual part along the real part,
+        // which a pure rigid transform does not have.
+        const T drift = this->real.Dot(this->dual);
+        this->dual = this->dual - this->real * drift;
+      }
+
+      /// \brief Get a normalized copy of this dual quaternion.
+      /// \return The normalized dual quaternion.
+      public: DualQuaternion<T> Normalized() const
+      {
+        DualQuaternion<T> result = *this;
+        result.Normalize();
+        return result;
+      }
+
+      /// \brief Blend an array of transforms with dual linear
+      /// blending (DLB): the weighted part-wise sum, taken on one
+      /// hemisphere, renormalized. This is the standard skinning
+      /// blend; it is exact for two transforms sharing a rotation
+      /// axis and shortest-path for nearby rotations.
+      /// \param[in] _dqs Array of unit dual quaternions.
+      /// \param[in] _weights Array of _count blend weights; they do
+      /// not need to sum to one, the normalization absorbs the scale.
+      /// \param[in] _count Number of transforms. Zero yields the
+      /// identity.
+      /// \return The blended unit dual quaternion.
+      public: static DualQuaternion<T> Blend(
+                  const DualQuaternion<T> *_dqs, const T *_weights,
+                  const size_t _count)
+      {
+        if (_count == 0)
+          return DualQuaternion<T>();
+
+        DualQuaternion<T> sum = _dqs[0] * _weights[0];
+        for (size_t i = 1; i < _count; ++i)
+        {
+          // q and -q encode the same rotation; accumulate each term
+          // on the hemisphere of the first so weights do not cancel.
+          const T sign =
+              _dqs[i].real.Dot(_dqs[0].real) < T(0) ? T(-1) : T(1);
+          sum = sum + _dqs[i] * (sign * _weights[i]);
+        }
+
+        sum.Normalize();
+        return sum;
+      }
+
+      /// \brief Blend an array of poses with dual linear blending in
+      /// one pass: each pose is converted, accumulated and the result
+      /// renormalized without materializing the converted array.
+      /// \param[in] _poses Array of poses.
+      /// \param[in] _weights Array of _count blend weights.
+      /// \param[in] _count Number of poses. Zero yields the identity
+      /// pose.
+      /// \return The blended pose.
+      public: static Pose3<T> BlendPoses(const Pose3<T> *_poses,
+                  const T *_weights, const size_t _count)
+      {
+        if (_count == 0)
+          return Pose3<T>();
+
+        const DualQuaternion<T> first(_poses[0]);
+        DualQuaternion<T> sum = first * _weights[0];
+        for (size_t i = 1; i < _count; ++i)
+        {
+          const DualQuaternion<T> dq(_poses[i]);
+          const T sign =
+              dq.real.Dot(first.real) < T(0) ? T(-1) : T(1);
+          sum = sum + dq * (sign * _weights[i]);
+        }
+
+        sum.Normalize();
+        return sum.Pose();
+      }
+
+      /// \brief Blend rows of transforms with dual linear blending,
+      /// e.g. one row of joint transforms per skinned vertex. Each
+      /// output is the blend of the same _width transforms weighted
+      /// by its row of _weights.
+      /// \param[in] _dqs Array of _width unit dual quaternions.
+      /// \param[in] _weights Array of _rows * _width weights, row
+      /// major.
+      /// \param[in] _rows Number of blends to compute.
+      /// \param[in] _width Number of transforms per blend.
+      /// \param[out] _out Array of _rows blended unit dual
+      /// quaternions.
+      public: static void BlendBatch(const DualQuaternion<T> *_dqs,
+                  const T *_weights, const size_t _rows,
+                  const size_t _width, DualQuaternion<T> *_out)
+      {
+        for (size_t row = 0; row < _rows; ++row)
+          _out[row] = Blend(_dqs, _weights + row * _width, _width);
+      }
+
+      /// \brief The real (rotation) part.
+      private: Quaternion<T> real;
+
+      /// \brief The dual (translation) part.
+      private: Quaternion<T> dual;
+    };
+
+    typedef DualQuaternion<double> DualQuaterniond;
+    typedef DualQuaternion<float> DualQuaternionf;
+    }
+  }
+}
+#endif
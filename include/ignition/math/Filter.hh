@@ -17,6 +17,11 @@
 #ifndef IGNITION_MATH_FILTER_HH_
 #define IGNITION_MATH_FILTER_HH_
 
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/Quaternion.hh>
@@ -93,6 +98,34 @@ namespace ignition
         return this->y0;
       }
 
+      /// \brief Update the filter's output, keeping the state out of
+      /// the denormal range.
+      ///
+      /// When the input goes quiet, the feedback term decays
+      /// exponentially and eventually lands in the denormal range,
+      /// where each multiply can cost around a hundred times a normal
+      /// one. For floating point T this update injects a DC offset
+      /// far below the filter's resolution and removes it again, which
+      /// rounds a denormal state to zero; for other element types it
+      /// is the plain update, and a ScopedFlushDenormals guard around
+      /// the processing loop provides the same protection in hardware.
+      /// \param[in] _x New input.
+      /// \return The filter's output.
+      /// \sa ScopedFlushDenormals
+      public: const T& ProcessDenormalSafe(const T &_x)
+      {
+        this->y0 = a0 * _x + b1 * this->y0;
+        if constexpr (std::is_floating_point<T>::value)
+        {
+          // Adding and subtracting a tiny constant leaves normal
+          // values unchanged but absorbs denormals into the rounding.
+          constexpr T kOffset = static_cast<T>(1e-30);
+          this->y0 += kOffset;
+          this->y0 -= kOffset;
+        }
+        return this->y0;
+      }
+
       /// \brief Input gain control.
       protected: double a0 = 0;
 
@@ -150,6 +183,209 @@ namespace ignition
       }
     };
 
+    /// \class OnePoleVector3Bank Filter.hh ignition/math/Filter.hh
+    /// \brief A bank of one-pole Vector3d filters with contiguous
+    /// state, one filter per tracked object. One ProcessBatch call
+    /// per frame advances every filter with a branch-free fused
+    /// update, replacing per-object Process calls and their virtual
+    /// dispatch; the shared coefficients match OnePole::Fc.
+    class OnePoleVector3Bank
+    {
+      /// \brief Constructor.
+      /// \param[in] _channels Number of filters in the bank.
+      public: explicit OnePoleVector3Bank(const std::size_t _channels = 0)
+      {
+        this->Resize(_channels);
+      }
+
+      /// \brief Constructor.
+      /// \param[in] _channels Number of filters in the bank.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      public: OnePoleVector3Bank(const std::size_t _channels,
+                  const double _fc, const double _fs)
+      {
+        this->Resize(_channels);
+        this->Fc(_fc, _fs);
+      }
+
+      /// \brief Set the number of filters, resetting all state.
+      /// \param[in] _channels Number of filters in the bank.
+      public: void Resize(const std::size_t _channels)
+      {
+        this->y.assign(_channels, math::Vector3d::Zero);
+      }
+
+      /// \brief Get the number of filters.
+      /// \return The filter count.
+      public: std::size_t ChannelCount() const
+      {
+        return this->y.size();
+      }
+
+      /// \brief Set the cutoff frequency and sample rate of every
+      /// filter. Same coefficient formulas as OnePole::Fc.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      public: void Fc(const double _fc, const double _fs)
+      {
+        this->b1 = exp(-2.0 * IGN_PI * _fc / _fs);
+        this->a0 = 1.0 - this->b1;
+      }
+
+      /// \brief Set the output of every filter.
+      /// \param[in] _frame Array of ChannelCount() values.
+      public: void Set(const Vector3d *_frame)
+      {
+        std::copy(_frame, _frame + this->y.size(), this->y.begin());
+      }
+
+      /// \brief Get the current output of a filter.
+      /// \param[in] _channel Filter index; must be below
+      /// ChannelCount().
+      /// \return The filter's output.
+      public: const Vector3d &Value(const std::size_t _channel) const
+      {
+        return this->y[_channel];
+      }
+
+      /// \brief Advance every filter by one sample. Equivalent to
+      /// OnePole<Vector3d>::Process per element.
+      /// \param[in] _in Input frame of ChannelCount() values.
+      /// \param[out] _out Output frame of ChannelCount() values; may
+      /// alias _in.
+      public: void ProcessBatch(const Vector3d *_in, Vector3d *_out)
+      {
+        const double c0 = this->a0;
+        const double c1 = this->b1;
+        const std::size_t n = this->y.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          this->y[i] = c0 * _in[i] + c1 * this->y[i];
+          _out[i] = this->y[i];
+        }
+      }
+
+      /// \brief Input gain coefficient, shared by every filter.
+      private: double a0 = 0.0;
+
+      /// \brief Feedback coefficient, shared by every filter.
+      private: double b1 = 0.0;
+
+      /// \brief Per-filter state.
+      private: std::vector<Vector3d> y;
+    };
+
+    /// \class OnePoleQuaternionBank Filter.hh ignition/math/Filter.hh
+    /// \brief A bank of one-pole quaternion filters with contiguous
+    /// state, one filter per tracked pose. Each update reproduces
+    /// OnePoleQuaternion::Process exactly, including Slerp's linear
+    /// fast path when the state and input are nearly aligned — the
+    /// common case for frame-to-frame tracking — so most elements
+    /// cost a lerp and a normalize instead of the trigonometric
+    /// slerp.
+    class OnePoleQuaternionBank
+    {
+      /// \brief Constructor.
+      /// \param[in] _channels Number of filters in the bank.
+      public: explicit OnePoleQuaternionBank(const std::size_t _channels = 0)
+      {
+        this->Resize(_channels);
+      }
+
+      /// \brief Constructor.
+      /// \param[in] _channels Number of filters in the bank.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      public: OnePoleQuaternionBank(const std::size_t _channels,
+                  const double _fc, const double _fs)
+      {
+        this->Resize(_channels);
+        this->Fc(_fc, _fs);
+      }
+
+      /// \brief Set the number of filters, resetting every state to
+      /// the identity rotation.
+      /// \param[in] _channels Number of filters in the bank.
+      public: void Resize(const std::size_t _channels)
+      {
+        this->y.assign(_channels, math::Quaterniond::Identity);
+      }
+
+      /// \brief Get the number of filters.
+      /// \return The filter count.
+      public: std::size_t ChannelCount() const
+      {
+        return this->y.size();
+      }
+
+      /// \brief Set the cutoff frequency and sample rate of every
+      /// filter. Same coefficient formulas as OnePole::Fc.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      public: void Fc(const double _fc, const double _fs)
+      {
+        this->a0 = 1.0 - exp(-2.0 * IGN_PI * _fc / _fs);
+      }
+
+      /// \brief Set the output of every filter.
+      /// \param[in] _frame Array of ChannelCount() values.
+      public: void Set(const Quaterniond *_frame)
+      {
+        std::copy(_frame, _frame + this->y.size(), this->y.begin());
+      }
+
+      /// \brief Get the current output of a filter.
+      /// \param[in] _channel Filter index; must be below
+      /// ChannelCount().
+      /// \return The filter's output.
+      public: const Quaterniond &Value(const std::size_t _channel) const
+      {
+        return this->y[_channel];
+      }
+
+      /// \brief Advance every filter by one sample. Equivalent to
+      /// OnePoleQuaternion::Process per element.
+      /// \param[in] _in Input frame of ChannelCount() values.
+      /// \param[out] _out Output frame of ChannelCount() values; may
+      /// alias _in.
+      public: void ProcessBatch(const Quaterniond *_in, Quaterniond *_out)
+      {
+        const double t = this->a0;
+        const std::size_t n = this->y.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          // Same math as Quaterniond::Slerp(t, y, x) with the
+          // coefficient hoisted: the trigonometric path only runs
+          // when the state and input have drifted apart.
+          const Quaterniond &x = _in[i];
+          Quaterniond &state = this->y[i];
+          const double fCos = state.Dot(x);
+          if (std::abs(fCos) < 1 - 1e-03)
+          {
+            const double fSin = sqrt(1 - (fCos*fCos));
+            const double fAngle = atan2(fSin, fCos);
+            const double fInvSin = 1.0 / fSin;
+            const double fCoeff0 = sin((1.0 - t) * fAngle) * fInvSin;
+            const double fCoeff1 = sin(t * fAngle) * fInvSin;
+            state = state * fCoeff0 + x * fCoeff1;
+          }
+          else
+          {
+            state = state * (1.0 - t) + x * t;
+            state.Normalize();
+          }
+          _out[i] = state;
+        }
+      }
+
+      /// \brief Interpolation coefficient, shared by every filter.
+      private: double a0 = 0.0;
+
+      /// \brief Per-filter state.
+      private: std::vector<Quaterniond> y;
+    };
+
     /// \class BiQuad Filter.hh ignition/math/Filter.hh
     /// \brief Bi-quad filter base class.
     /// \sa http://www.earlevel.com/main/2003/03/02/the-bilinear-z-transform/
@@ -226,6 +462,180 @@ namespace ignition
       protected: T x1{}, x2{}, y1{}, y2{};
     };
 
+    /// \class FilterBank Filter.hh ignition/math/Filter.hh
+    /// \brief A bank of low-pass bi-quad filters processing many
+    /// channels in lockstep.
+    ///
+    /// BiQuad dispatches one virtual Process() call per sample per
+    /// channel. The bank instead stores the coefficients and the filter
+    /// state of every channel in parallel arrays, so one frame updates
+    /// all channels in a single branch-free loop the compiler can
+    /// vectorize. Frames are interleaved: sample \p s of channel
+    /// \p c lives at index <tt>s * ChannelCount() + c</tt>.
+    class FilterBank
+    {
+      /// \brief Constructor.
+      /// \param[in] _channels Number of channels in the bank.
+      public: explicit FilterBank(const std::size_t _channels = 0)
+      {
+        this->Resize(_channels);
+      }
+
+      /// \brief Set the number of channels, resetting all coefficients
+      /// and state.
+      /// \param[in] _channels Number of channels in the bank.
+      public: void Resize(const std::size_t _channels)
+      {
+        this->a0.assign(_channels, 0.0);
+        this->a1.assign(_channels, 0.0);
+        this->a2.assign(_channels, 0.0);
+        this->b1.assign(_channels, 0.0);
+        this->b2.assign(_channels, 0.0);
+        this->x1.assign(_channels, 0.0);
+        this->x2.assign(_channels, 0.0);
+        this->y1.assign(_channels, 0.0);
+        this->y2.assign(_channels, 0.0);
+      }
+
+      /// \brief Get the number of channels.
+      /// \return The channel count.
+      public: std::size_t ChannelCount() const
+      {
+        return this->a0.size();
+      }
+
+      /// \brief Set the cutoff frequency of every channel. Same
+      /// coefficient formulas as BiQuad::Fc.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      /// \param[in] _q Q coefficient.
+      public: void Fc(const double _fc, const double _fs,
+                  const double _q = 0.5)
+      {
+        for (std::size_t c = 0; c < this->a0.size(); ++c)
+          this->ChannelFc(c, _fc, _fs, _q);
+      }
+
+      /// \brief Set the cutoff frequency of a single channel.
+      /// \param[in] _channel Channel index.
+      /// \param[in] _fc Cutoff frequency.
+      /// \param[in] _fs Sample rate.
+      /// \param[in] _q Q coefficient.
+      /// \return True on success, false if _channel is out of range.
+      public: bool ChannelFc(const std::size_t _channel, const double _fc,
+                  const double _fs, const double _q = 0.5)
+      {
+        if (_channel >= this->a0.size())
+          return false;
+
+        const double k = tan(IGN_PI * _fc / _fs);
+        const double kQuadDenom = k * k + k / _q + 1.0;
+        this->a0[_channel] = k * k / kQuadDenom;
+        this->a1[_channel] = 2 * this->a0[_channel];
+        this->a2[_channel] = this->a0[_channel];
+        this->b1[_channel] = 2 * (k * k - 1.0) / kQuadDenom;
+        this->b2[_channel] = (k * k - k / _q + 1.0) / kQuadDenom;
+        return true;
+      }
+
+      /// \brief Set the state of every channel as if it had been
+      /// outputting the given frame forever, like BiQuad::Set.
+      /// \param[in] _frame Array of ChannelCount() values.
+      public: void Set(const double *_frame)
+      {
+        const std::size_t n = this->a0.size();
+        for (std::size_t c = 0; c < n; ++c)
+        {
+          this->x1[c] = this->x2[c] = _frame[c];
+          this->y1[c] = this->y2[c] = _frame[c];
+        }
+      }
+
+      /// \brief Reset the state of every channel to zero.
+      public: void Reset()
+      {
+        std::fill(this->x1.begin(), this->x1.end(), 0.0);
+        std::fill(this->x2.begin(), this->x2.end(), 0.0);
+        std::fill(this->y1.begin(), this->y1.end(), 0.0);
+        std::fill(this->y2.begin(), this->y2.end(), 0.0);
+      }
+
+      /// \brief Filter a block of interleaved frames, continuing from
+      /// the current state. In-place operation (_out == _in) is
+      /// allowed.
+      /// \param[in] _in Input array of _sampleCount frames of
+      /// ChannelCount() values each.
+      /// \param[out] _out Output array, same layout as _in.
+      /// \param[in] _count Number of frames.
+      public: void ProcessBatch(const double *_in, double *_out,
+                  const std::size_t _count)
+      {
+        const std::size_t n = this->a0.size();
+        for (std::size_t s = 0; s < _count; ++s)
+          this->ProcessFrame(_in + s * n, _out + s * n);
+      }
+
+      /// \brief Filter a block of interleaved frames forward and then
+      /// backward, cancelling the filter's phase lag. Intended for
+      /// offline log processing; the effective magnitude response is
+      /// squared. The state is primed from the first input frame before
+      /// the forward pass and from the last forward output before the
+      /// backward pass to suppress edge transients, and is left at the
+      /// result of the backward pass.
+      /// \param[in] _in Input array of _count frames of ChannelCount()
+      /// values each.
+      /// \param[out] _out Output array, same layout as _in. In-place
+      /// operation (_out == _in) is allowed.
+      /// \param[in] _count Number of frames.
+      public: void ProcessZeroPhase(const double *_in, double *_out,
+                  const std::size_t _count)
+      {
+        if (_count == 0)
+          return;
+
+        const std::size_t n = this->a0.size();
+
+        this->Set(_in);
+        this->ProcessBatch(_in, _out, _count);
+
+        this->Set(_out + (_count - 1) * n);
+        for (std::size_t s = _count; s > 0; --s)
+          this->ProcessFrame(_out + (s - 1) * n, _out + (s - 1) * n);
+      }
+
+      /// \brief Advance every channel by one frame. Same difference
+      /// equation as BiQuad::Process, over parallel arrays.
+      /// \param[in] _in Input frame of ChannelCount() values.
+      /// \param[out] _out Output frame of ChannelCount() values.
+      private: void ProcessFrame(const double *_in, double *_out)
+      {
+        const std::size_t n = this->a0.size();
+        for (std::size_t c = 0; c < n; ++c)
+        {
+          const double x = _in[c];
+          const double y = this->a0[c] * x +
+                           this->a1[c] * this->x1[c] +
+                           this->a2[c] * this->x2[c] -
+                           this->b1[c] * this->y1[c] -
+                           this->b2[c] * this->y2[c];
+          this->x2[c] = this->x1[c];
+          this->x1[c] = x;
+          this->y2[c] = this->y1[c];
+          this->y1[c] = y;
+          _out[c] = y;
+        }
+      }
+
+      /// \brief Per-channel input gain coefficients.
+      private: std::vector<double> a0, a1, a2;
+
+      /// \brief Per-channel feedback coefficients.
+      private: std::vector<double> b1, b2;
+
+      /// \brief Per-channel filter state.
+      private: std::vector<double> x1, x2, y1, y2;
+    };
+
     /// \class BiQuadVector3 Filter.hh ignition/math/Filter.hh
     /// \brief BiQuad vector3 filter
     class BiQuadVector3 : public BiQuad<math::Vector3d>
@@ -0,0 +1,455 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_FORMAT_HH_
+#define IGNITION_MATH_FORMAT_HH_
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// __cpp_lib_to_chars is only defined by <charconv> (via <version>),
+// so the header has to be included before the macro can be tested;
+// 201611L is the value that marks floating-point support.
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define IGNITION_MATH_FORMAT_USE_TO_CHARS 1
+#endif
+
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Quaternion.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief Write a double into a character buffer without going
+    /// through iostreams.
+    ///
+    /// Stream insertion pays for locale handling and per-component
+    /// precision manipulation; this writes the shortest representation
+    /// that round-trips the value, via std::to_chars where the
+    /// standard library provides it. The output is not null
+    /// terminated.
+    /// \param[in] _buffer Destination buffer.
+    /// \param[in] _size Room in the buffer, in characters.
+    /// \param[in] _value Value to format.
+    /// \return Number of characters written, or zero if the buffer is
+    /// too small, in which case its contents are unspecified.
+    inline size_t AppendTo(char *_buffer, const size_t _size,
+        const double _value)
+    {
+#if defined(IGNITION_MATH_FORMAT_USE_TO_CHARS)
+      const std::to_chars_result result =
+          std::to_chars(_buffer, _buffer + _size, _value);
+      if (result.ec != std::errc())
+        return 0;
+      return static_cast<size_t>(result.ptr - _buffer);
+#else
+      // %.17g round-trips every double, at the cost of longer output.
+      const int written =
+          std::snprintf(_buffer, _size, "%.17g", _value);
+      if (written <= 0 || static_cast<size_t>(written) >= _size)
+        return 0;
+      return static_cast<size_t>(written);
+#endif
+    }
+
+    /// \brief Write a vector as "x y z", matching the layout of its
+    /// stream operator.
+    /// \param[in] _buffer Destination buffer.
+    /// \param[in] _size Room in the buffer, in characters.
+    /// \param[in] _v Vector to format.
+    /// \return Number of characters written, or zero if the buffer is
+    /// too small.
+    template<typename T>
+    size_t AppendTo(char *_buffer, const size_t _size, const Vector3<T> &_v)
+    {
+      const double values[3] = {static_cast<double>(_v.X()),
+          static_cast<double>(_v.Y()), static_cast<double>(_v.Z())};
+      size_t used = 0;
+      for (int i = 0; i < 3; ++i)
+      {
+        if (i > 0)
+        {
+          if (used + 1 > _size)
+            return 0;
+          _buffer[used++] = ' ';
+        }
+        const size_t written =
+            AppendTo(_buffer + used, _size - used, values[i]);
+        if (0 == written)
+          return 0;
+        used += written;
+      }
+      return used;
+    }
+
+    /// \brief Write a quaternion as its Euler angles "roll pitch yaw",
+    /// matching the layout of its stream operator.
+    /// \param[in] _buffer Destination buffer.
+    /// \param[in] _size Room in the buffer, in characters.
+    /// \param[in] _q Quaternion to format.
+    /// \return Number of characters written, or zero if the buffer is
+    /// too small.
+    template<typename T>
+    size_t AppendTo(char *_buffer, const size_t _size,
+        const Quaternion<T> &_q)
+    {
+      return AppendTo(_buffer, _size, _q.Euler());
+    }
+
+    /// \brief Write a pose as "x y z roll pitch yaw", matching the
+    /// layout of its stream operator.
+    /// \param[in] _buffer Destination buffer.
+    /// \param[in] _size Room in the buffer, in characters.
+    /// \param[in] _pose Pose to format.
+    /// \return Number of characters written, or zero if the buffer is
+    /// too small.
+    template<typename T>
+    size_t AppendTo(char *_buffer, const size_t _size, const Pose3<T> &_pose)
+    {
+      size_t used = AppendTo(_buffer, _size, _pose.Pos());
+      if (0 == used || used + 1 > _size)
+        return 0;
+      _buffer[used++] = ' ';
+      const size_t written =
+          AppendTo(_buffer + used, _size - used, _pose.Rot());
+      if (0 == written)
+        return 0;
+      return used + written;
+    }
+
+    /// \brief Write a matrix as its 16 entries in row-major order,
+    /// space separated, matching the layout of its stream operator.
+    /// \param[in] _buffer Destination buffer.
+    /// \param[in] _size Room in the buffer, in characters.
+    /// \param[in] _m Matrix to format.
+    /// \return Number of characters written, or zero if the buffer is
+    /// too small.
+    template<typename T>
+    size_t AppendTo(char *_buffer, const size_t _size, const Matrix4<T> &_m)
+    {
+      size_t used = 0;
+      for (int row = 0; row < 4; ++row)
+      {
+        for (int col = 0; col < 4; ++col)
+        {
+          if (row > 0 || col > 0)
+          {
+            if (used + 1 > _size)
+              return 0;
+            _buffer[used++] = ' ';
+          }
+          const size_t written = AppendTo(_buffer + used, _size - used,
+              static_cast<double>(_m(row, col)));
+          if (0 == written)
+            return 0;
+          used += written;
+        }
+      }
+      return used;
+    }
+
+    /// \brief Format a value through its AppendTo overload.
+    /// \param[in] _value Value to format.
+    /// \return The formatted string.
+    template<typename T>
+    std::string ToString(const T &_value)
+    {
+      // Large enough for a Matrix4 of worst-case doubles.
+      char buffer[512];
+      const size_t written = AppendTo(buffer, sizeof(buffer), _value);
+      return std::string(buffer, written);
+    }
+
+    /// \brief Parse a double from the front of a text fragment
+    /// without locale or stream overhead.
+    /// \param[in] _text Text to parse; leading whitespace is skipped.
+    /// On success the consumed characters are removed from the view.
+    /// \param[out] _value The parsed value, untouched on failure.
+    /// \return True if a value was parsed.
+    inline bool FromString(std::string_view &_text, double &_value)
+    {
+      size_t start = 0;
+      while (start < _text.size() &&
+          (' ' == _text[start] || '\t' == _text[start] ||
+           '\n' == _text[start] || '\r' == _text[start]))
+      {
+        ++start;
+      }
+#if defined(IGNITION_MATH_FORMAT_USE_TO_CHARS)
+      double value;
+      const std::from_chars_result result = std::from_chars(
+          _text.data() + start, _text.data() + _text.size(), value);
+      if (result.ec != std::errc())
+        return false;
+      _value = value;
+      _text.remove_prefix(
+          static_cast<size_t>(result.ptr - _text.data()));
+      return true;
+#else
+      // Bounce through a buffer so strtod cannot run past the view.
+      char buffer[64];
+      const size_t length =
+          std::min(_text.size() - start, sizeof(buffer) - 1);
+      std::memcpy(buffer, _text.data() + start, length);
+      buffer[length] = '\0';
+      char *end = nullptr;
+      const double value = std::strtod(buffer, &end);
+      if (end == buffer)
+        return false;
+      _value = value;
+      _text.remove_prefix(start + static_cast<size_t>(end - buffer));
+      return true;
+#endif
+    }
+
+    /// \brief Parse a vector from "x y z", the layout produced by
+    /// both the stream operator and AppendTo.
+    /// \param[in] _text Text to parse. On success the consumed
+    /// characters are removed from the view, so arrays of values can
+    /// be parsed by repeated calls.
+    /// \param[out] _value The parsed vector, untouched on failure.
+    /// \return True if all three components were parsed.
+    template<typename T>
+    bool FromString(std::string_view &_text, Vector3<T> &_value)
+    {
+      std::string_view text = _text;
+      double x, y, z;
+      if (!FromString(text, x) || !FromString(text, y) ||
+          !FromString(text, z))
+      {
+        return false;
+      }
+      _value.Set(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z));
+      _text = text;
+      return true;
+    }
+
+    /// \brief Parse a quaternion from "roll pitch yaw", the layout
+    /// produced by both the stream operator and AppendTo.
+    /// \param[in] _text Text to parse. On success the consumed
+    /// characters are removed from the view.
+    /// \param[out] _value The parsed quaternion, untouched on
+    /// failure.
+    /// \return True if all three angles were parsed.
+    template<typename T>
+    bool FromString(std::string_view &_text, Quaternion<T> &_value)
+    {
+      Vector3<T> euler;
+      if (!FromString(_text, euler))
+        return false;
+      _value.Euler(euler);
+      return true;
+    }
+
+    /// \brief Parse a pose from "x y z roll pitch yaw", the layout
+    /// produced by both the stream operator and AppendTo.
+    /// \param[in] _text Text to parse. On success the consumed
+    /// characters are removed from the view.
+    /// \param[out] _value The parsed pose, untouched on failure.
+    /// \return True if all six values were parsed.
+    template<typename T>
+    bool FromString(std::string_view &_text, Pose3<T> &_value)
+    {
+      std::string_view text = _text;
+      Vector3<T> pos;
+      Quaternion<T> rot;
+      if (!FromString(text, pos) || !FromString(text, rot))
+        return false;
+      _value.Set(pos, rot);
+      _text = text;
+      return true;
+    }
+
+    /// \brief Write an array of vectors as raw doubles, three per
+    /// vector, in host byte order (little endian on every supported
+    /// platform). The resulting file can be mapped or bulk-read back
+    /// with ReadArray.
+    /// \param[in] _out Destination stream, opened in binary mode.
+    /// \param[in] _values Array of vectors; may be null when
+    /// \p _count is zero.
+    /// \param[in] _count Number of vectors.
+    /// \return True if the stream is still good after writing.
+    template<typename T>
+    bool WriteArray(std::ostream &_out, const Vector3<T> *_values,
+        const size_t _count)
+    {
+      double staging[3 * 128];
+      size_t i = 0;
+      while (i < _count)
+      {
+        const size_t chunk = std::min<size_t>(128, _count - i);
+        for (size_t j = 0; j < chunk; ++j)
+        {
+          staging[3 * j] = static_cast<double>(_values[i + j].X());
+          staging[3 * j + 1] = static_cast<double>(_values[i + j].Y());
+          staging[3 * j + 2] = static_cast<double>(_values[i + j].Z());
+        }
+        _out.write(reinterpret_cast<const char *>(staging),
+            static_cast<std::streamsize>(3 * chunk * sizeof(double)));
+        i += chunk;
+      }
+      return _out.good();
+    }
+
+    /// \brief Read an array of vectors written by WriteArray.
+    /// \param[in] _in Source stream, opened in binary mode.
+    /// \param[out] _values Destination array with room for \p _count
+    /// vectors.
+    /// \param[in] _count Number of vectors to read.
+    /// \return True if every vector was read.
+    template<typename T>
+    bool ReadArray(std::istream &_in, Vector3<T> *_values,
+        const size_t _count)
+    {
+      double staging[3 * 128];
+      size_t i = 0;
+      while (i < _count)
+      {
+        const size_t chunk = std::min<size_t>(128, _count - i);
+        _in.read(reinterpret_cast<char *>(staging),
+            static_cast<std::streamsize>(3 * chunk * sizeof(double)));
+        if (!_in.good())
+          return false;
+        for (size_t j = 0; j < chunk; ++j)
+        {
+          _values[i + j].Set(static_cast<T>(staging[3 * j]),
+              static_cast<T>(staging[3 * j + 1]),
+              static_cast<T>(staging[3 * j + 2]));
+        }
+        i += chunk;
+      }
+      return true;
+    }
+
+    /// \brief Write an array of poses as raw doubles, seven per pose
+    /// (position x y z, then quaternion w x y z), in host byte order.
+    /// The quaternion is stored directly rather than as Euler angles
+    /// so the round trip is bit exact.
+    /// \param[in] _out Destination stream, opened in binary mode.
+    /// \param[in] _values Array of poses; may be null when \p _count
+    /// is zero.
+    /// \param[in] _count Number of poses.
+    /// \return True if the stream is still good after writing.
+    template<typename T>
+    bool WriteArray(std::ostream &_out, const Pose3<T> *_values,
+        const size_t _count)
+    {
+      double staging[7 * 64];
+      size_t i = 0;
+      while (i < _count)
+      {
+        const size_t chunk = std::min<size_t>(64, _count - i);
+        for (size_t j = 0; j < chunk; ++j)
+        {
+          const Pose3<T> &pose = _values[i + j];
+          staging[7 * j] = static_cast<double>(pose.Pos().X());
+          staging[7 * j + 1] = static_cast<double>(pose.Pos().Y());
+          staging[7 * j + 2] = static_cast<double>(pose.Pos().Z());
+          staging[7 * j + 3] = static_cast<double>(pose.Rot().W());
+          staging[7 * j + 4] = static_cast<double>(pose.Rot().X());
+          staging[7 * j + 5] = static_cast<double>(pose.Rot().Y());
+          staging[7 * j + 6] = static_cast<double>(pose.Rot().Z());
+        }
+        _out.write(reinterpret_cast<const char *>(staging),
+            static_cast<std::streamsize>(7 * chunk * sizeof(double)));
+        i += chunk;
+      }
+      return _out.good();
+    }
+
+    /// \brief Read an array of poses written by WriteArray.
+    /// \param[in] _in Source stream, opened in binary mode.
+    /// \param[out] _values Destination array with room for \p _count
+    /// poses.
+    /// \param[in] _count Number of poses to read.
+    /// \return True if every pose was read.
+    template<typename T>
+    bool ReadArray(std::istream &_in, Pose3<T> *_values,
+        const size_t _count)
+    {
+      double staging[7 * 64];
+      size_t i = 0;
+      while (i < _count)
+      {
+        const size_t chunk = std::min<size_t>(64, _count - i);
+        _in.read(reinterpret_cast<char *>(staging),
+            static_cast<std::streamsize>(7 * chunk * sizeof(double)));
+        if (!_in.good())
+          return false;
+        for (size_t j = 0; j < chunk; ++j)
+        {
+          _values[i + j].Set(
+              Vector3<T>(static_cast<T>(staging[7 * j]),
+                  static_cast<T>(staging[7 * j + 1]),
+                  static_cast<T>(staging[7 * j + 2])),
+              Quaternion<T>(static_cast<T>(staging[7 * j + 3]),
+                  static_cast<T>(staging[7 * j + 4]),
+                  static_cast<T>(staging[7 * j + 5]),
+                  static_cast<T>(staging[7 * j + 6])));
+        }
+        i += chunk;
+      }
+      return true;
+    }
+
+    /// \brief Format an array of poses, one per line, in one pass.
+    /// \param[in] _poses Array of poses; may be null when \p _count is
+    /// zero.
+    /// \param[in] _count Number of poses.
+    /// \param[in] _separator Character between poses; there is none
+    /// after the last pose.
+    /// \return The formatted string.
+    template<typename T>
+    std::string ToString(const Pose3<T> *_poses, const size_t _count,
+        const char _separator = '\n')
+    {
+      std::string result;
+      // Typical pose lines are well under 64 characters.
+      result.reserve(_count * 64);
+      char buffer[256];
+      for (size_t i = 0; i < _count; ++i)
+      {
+        const size_t written =
+            AppendTo(buffer, sizeof(buffer), _poses[i]);
+        if (i > 0)
+          result.push_back(_separator);
+        result.append(buffer, written);
+      }
+      return result;
+    }
+    }
+  }
+}
+#endif
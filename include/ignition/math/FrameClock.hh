@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_FRAMECLOCK_HH_
+#define IGNITION_MATH_FRAMECLOCK_HH_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <ignition/math/SignalStats.hh>
+#include <ignition/math/Stopwatch.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class FrameClockPrivate;
+
+    /// \brief A fixed-timestep frame pacer with drift-free tick
+    /// scheduling, per-phase budget tracking and overrun statistics.
+    ///
+    /// A soft-real-time loop that advances its deadline by repeatedly
+    /// adding the step accumulates floating point and scheduling drift;
+    /// FrameClock instead derives every deadline from the start epoch
+    /// and the tick count, so tick N is always scheduled at
+    /// epoch + N * step no matter how late individual frames ran.
+    /// Update() reports how many fixed steps the caller should simulate
+    /// to catch up with wall time.
+    ///
+    /// Work inside a frame can be split into named phases bracketed by
+    /// BeginPhase()/EndPhase(). Each phase runs on its own Stopwatch
+    /// and feeds SignalStats with its elapsed time and, when a budget
+    /// is set, with the amount by which it exceeded the budget, giving
+    /// frame pacing instrumentation without a bolt-on layer.
+    ///
+    /// All Update() overloads taking an explicit time point make the
+    /// clock deterministic for testing and for loops that sample time
+    /// once per iteration.
+    class IGNITION_MATH_VISIBLE FrameClock
+    {
+      /// \brief Constructor.
+      /// \param[in] _step The fixed step of one tick. Values that are
+      /// not positive fall back to one millisecond.
+      public: explicit FrameClock(const clock::duration &_step);
+
+      /// \brief Destructor.
+      public: ~FrameClock();
+
+      /// \brief Get the fixed step of one tick.
+      /// \return The step.
+      public: clock::duration Step() const;
+
+      /// \brief Start the clock, recording the scheduling epoch.
+      /// \return True if the clock was started; false if it was
+      /// already running.
+      public: bool Start();
+
+      /// \brief Start the clock at a given epoch.
+      /// \param[in] _now The scheduling epoch.
+      /// \return True if the clock was started; false if it was
+      /// already running.
+      public: bool Start(const clock::time_point &_now);
+
+      /// \brief Get whether the clock is running.
+      /// \return True if the clock has been started.
+      public: bool Running() const;
+
+      /// \brief Advance the clock to the current wall time.
+      /// \return The number of fixed steps to simulate; see
+      /// Update(const clock::time_point &).
+      public: uint64_t Update();
+
+      /// \brief Advance the clock to a given time.
+      /// The returned count is the number of whole steps between the
+      /// epoch and \p _now that have not been consumed yet; a paced
+      /// loop simulates that many fixed steps. A value greater than
+      /// one means the previous frame overran, and the excess is
+      /// recorded in OverrunStats().
+      /// \param[in] _now The current time; must not precede the epoch.
+      /// \return The number of fixed steps to simulate, or zero when
+      /// the clock is not running.
+      public: uint64_t Update(const clock::time_point &_now);
+
+      /// \brief Get the number of ticks consumed by Update() calls.
+      /// \return The tick count.
+      public: uint64_t TickCount() const;
+
+      /// \brief Get the scheduled time of the next tick, computed
+      /// drift-free from the epoch and the tick count.
+      /// \return epoch + (TickCount() + 1) * Step(), or the epoch when
+      /// the clock is not running.
+      public: clock::time_point NextTickTime() const;
+
+      /// \brief Get statistics over the intervals between tick
+      /// advancing Update() calls, in seconds.
+      /// \return The interval statistics.
+      public: SignalStats FrameStats() const;
+
+      /// \brief Get statistics over frame overruns: the time missed
+      /// beyond one step whenever an Update() had to report more than
+      /// one tick, in seconds. Zero is recorded for frames that kept
+      /// pace, so the mean reflects the overall schedule health.
+      /// \return The overrun statistics.
+      public: SignalStats OverrunStats() const;
+
+      /// \brief Set the budget of a phase. A phase with a budget
+      /// records how far each EndPhase() ran over it.
+      /// \param[in] _phase Name of the phase.
+      /// \param[in] _budget The budget.
+      public: void SetPhaseBudget(const std::string &_phase,
+                  const clock::duration &_budget);
+
+      /// \brief Get the budget of a phase.
+      /// \param[in] _phase Name of the phase.
+      /// \return The budget, or a zero duration when none was set.
+      public: clock::duration PhaseBudget(const std::string &_phase) const;
+
+      /// \brief Start timing a phase of the current frame. Phases do
+      /// not nest.
+      /// \param[in] _phase Name of the phase; created on first use.
+      /// \return True if the phase was started; false if another
+      /// phase is still running.
+      public: bool BeginPhase(const std::string &_phase);
+
+      /// \brief Stop timing the running phase, recording its elapsed
+      /// time, and its budget overrun when a budget is set, into the
+      /// phase statistics.
+      /// \return True if a phase was running.
+      public: bool EndPhase();
+
+      /// \brief Get the elapsed time recorded by the most recent
+      /// completed run of a phase.
+      /// \param[in] _phase Name of the phase.
+      /// \return The elapsed time, or a zero duration for an unknown
+      /// phase.
+      public: clock::duration PhaseElapsed(const std::string &_phase) const;
+
+      /// \brief Get statistics over a phase's elapsed times, in
+      /// seconds.
+      /// \param[in] _phase Name of the phase.
+      /// \return The statistics; empty for an unknown phase.
+      public: SignalStats PhaseStats(const std::string &_phase) const;
+
+      /// \brief Get statistics over a phase's budget overruns, in
+      /// seconds. Zero is recorded for runs within budget; nothing is
+      /// recorded while no budget is set.
+      /// \param[in] _phase Name of the phase.
+      /// \return The statistics; empty for an unknown phase.
+      public: SignalStats PhaseOverrunStats(
+                  const std::string &_phase) const;
+
+      /// \brief Reset the clock: stop it and clear the tick count and
+      /// all statistics. The step and phase budgets are kept.
+      public: void Reset();
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<FrameClockPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
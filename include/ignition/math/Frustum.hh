@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_FRUSTUM_HH_
 #define IGNITION_MATH_FRUSTUM_HH_
 
+#include <cstdint>
+
 #include <ignition/math/Angle.hh>
 #include <ignition/math/AxisAlignedBox.hh>
 #include <ignition/math/Plane.hh>
@@ -148,6 +150,16 @@ namespace ignition
       /// \return Plane of the frustum.
       public: Planed Plane(const FrustumPlane _plane) const;
 
+      /// \brief Get one of the eight corner points of the frustum.
+      /// The points are cached, so shadow casters and debug drawing
+      /// do not need to re-derive them from the planes.
+      /// \param[in] _index Corner index in [0, 8): 0-3 are the near
+      /// plane's top-left, top-right, bottom-left and bottom-right
+      /// corners, 4-7 the same corners of the far plane. An
+      /// out-of-range index returns the first corner.
+      /// \return The corner point in world coordinates.
+      public: const Vector3d &Vertex(const unsigned int _index) const;
+
       /// \brief Check if a box lies inside the pyramid frustum.
       /// \param[in] _b Box to check.
       /// \return True if the box is inside the pyramid frustum.
@@ -158,6 +170,46 @@ namespace ignition
       /// \return True if the point is inside the pyramid frustum.
       public: bool Contains(const Vector3d &_p) const;
 
+      /// \brief Check many boxes against the frustum in one call.
+      /// Equivalent to calling Contains on every box, but the plane
+      /// parameters are loaded once and the plane that rejected the
+      /// previous box is tested first, which exploits the spatial
+      /// coherence of culling workloads where most boxes are rejected by
+      /// the same plane.
+      /// \param[in] _boxes Array of boxes to check.
+      /// \param[in] _n Number of boxes.
+      /// \param[out] _results Destination array of _n flags; an element is
+      /// set to 1 if the corresponding box intersects the frustum and 0
+      /// otherwise.
+      public: void ContainsBatch(const AxisAlignedBox *_boxes, size_t _n,
+                  uint8_t *_results) const;
+
+      /// \brief Check if a sphere lies inside or intersects the
+      /// pyramid frustum. One dot product and compare per plane, with
+      /// no corner selection, so it is the cheapest cull for entities
+      /// that carry bounding spheres. Like the box test this is
+      /// conservative: a sphere outside the frustum but close to an
+      /// edge or corner can be reported as contained.
+      /// \param[in] _center Center of the sphere.
+      /// \param[in] _radius Radius of the sphere.
+      /// \return True if the sphere is at least partially inside.
+      public: bool Contains(const Vector3d &_center,
+                  const double _radius) const;
+
+      /// \brief Check many spheres against the frustum in one call.
+      /// Equivalent to calling Contains per sphere, but the plane
+      /// parameters are loaded once and the plane that rejected the
+      /// previous sphere is tested first, as in the box batch.
+      /// \param[in] _centers Array of sphere centers.
+      /// \param[in] _radii Array of sphere radii, one per center.
+      /// \param[in] _n Number of spheres.
+      /// \param[out] _results Destination array of _n flags; an
+      /// element is set to 1 if the corresponding sphere is at least
+      /// partially inside the frustum and 0 otherwise.
+      public: void ContainsBatch(const Vector3d *_centers,
+                  const double *_radii, size_t _n,
+                  uint8_t *_results) const;
+
       /// \brief Get the pose of the frustum
       /// \return Pose of the frustum
       /// \sa SetPose
@@ -177,10 +229,134 @@ namespace ignition
       /// a property of the frustum is changed.
       private: void ComputePlanes();
 
+      /// \brief Transform the cached local-frame corner points and
+      /// planes by the pose. This is all a pose change needs to do.
+      private: void ApplyPose();
+
       /// \internal
       /// \brief Private data pointer
       private: FrustumPrivate *dataPtr;
     };
+
+    // Forward declaration of private data
+    class MultiViewFrustumPrivate;
+
+    /// \brief A set of frusta sharing one set of intrinsics (near,
+    /// far, field of view and aspect ratio) but posed independently,
+    /// e.g. the per-eye views of a stereo or VR rig.
+    ///
+    /// The canonical plane geometry is computed once from the
+    /// intrinsics; each view's planes are derived from it by a rigid
+    /// transform of its pose, so adding or re-posing a view costs no
+    /// trigonometry. The culling queries answer all views at once
+    /// with a bit mask per object, sweeping the object list a single
+    /// time instead of once per view.
+    class IGNITION_MATH_VISIBLE MultiViewFrustum
+    {
+      /// \brief Maximum number of views; one bit of the visibility
+      /// mask per view.
+      public: static const unsigned int MaxViews = 32;
+
+      /// \brief Constructor, with the intrinsics shared by every
+      /// view. The parameters have the meaning of the Frustum
+      /// constructor. The frustum starts with no views.
+      /// \param[in] _near Near plane distance.
+      /// \param[in] _far Far plane distance.
+      /// \param[in] _fov Horizontal field of view.
+      /// \param[in] _aspectRatio Width divided by height of the near
+      /// or far planes.
+      public: MultiViewFrustum(const double _near,
+                  const double _far,
+                  const math::Angle &_fov,
+                  const double _aspectRatio);
+
+      /// \brief Destructor
+      public: virtual ~MultiViewFrustum();
+
+      /// \brief Add a view at a pose.
+      /// \param[in] _pose Pose of the view's vertex.
+      /// \return True on success, or false when MaxViews views
+      /// already exist.
+      public: bool AddView(const Pose3d &_pose);
+
+      /// \brief Get the number of views.
+      /// \return View count.
+      public: size_t ViewCount() const;
+
+      /// \brief Set the pose of a view. Only the rigid transform of
+      /// the canonical planes is redone. An invalid index is ignored.
+      /// \param[in] _view View index.
+      /// \param[in] _pose New pose of the view's vertex.
+      public: void SetViewPose(const size_t _view, const Pose3d &_pose);
+
+      /// \brief Get the pose of a view.
+      /// \param[in] _view View index.
+      /// \return The view's pose, or Pose3d::Zero for an invalid
+      /// index.
+      public: Pose3d ViewPose(const size_t _view) const;
+
+      /// \brief Check a box against every view.
+      /// \param[in] _b Box to check.
+      /// \return A visibility mask with bit i set when view i
+      /// contains the box, matching Frustum::Contains per view.
+      public: uint32_t Contains(const AxisAlignedBox &_b) const;
+
+      /// \brief Check a point against every view.
+      /// \param[in] _p Point to check.
+      /// \return A visibility mask with bit i set when view i
+      /// contains the point.
+      public: uint32_t Contains(const Vector3d &_p) const;
+
+      /// \brief Check many boxes against every view in one pass over
+      /// the boxes. Equivalent to calling Contains on every box; the
+      /// per-box setup is shared across the views.
+      /// \param[in] _boxes Array of boxes to check.
+      /// \param[in] _n Number of boxes.
+      /// \param[out] _masks Destination array of _n visibility masks.
+      public: void ContainsBatch(const AxisAlignedBox *_boxes, size_t _n,
+                  uint32_t *_masks) const;
+
+      /// \brief Get the near distance shared by the views.
+      /// \return Near distance.
+      public: double Near() const;
+
+      /// \brief Set the near distance shared by the views.
+      /// \param[in] _near Near distance.
+      public: void SetNear(const double _near);
+
+      /// \brief Get the far distance shared by the views.
+      /// \return Far distance.
+      public: double Far() const;
+
+      /// \brief Set the far distance shared by the views.
+      /// \param[in] _far Far distance.
+      public: void SetFar(const double _far);
+
+      /// \brief Get the horizontal field of view shared by the views.
+      /// \return The field of view.
+      public: math::Angle FOV() const;
+
+      /// \brief Set the horizontal field of view shared by the views.
+      /// \param[in] _fov The field of view.
+      public: void SetFOV(const math::Angle &_fov);
+
+      /// \brief Get the aspect ratio shared by the views.
+      /// \return The aspect ratio.
+      public: double AspectRatio() const;
+
+      /// \brief Set the aspect ratio shared by the views.
+      /// \param[in] _aspectRatio The aspect ratio.
+      public: void SetAspectRatio(const double _aspectRatio);
+
+      /// \brief Rebuild the derived planes of one view from the
+      /// canonical planes and the view's pose.
+      /// \param[in] _view View index.
+      private: void ComputeViewPlanes(const size_t _view);
+
+      /// \internal
+      /// \brief Private data pointer
+      private: MultiViewFrustumPrivate *dataPtr;
+    };
     }
   }
 }
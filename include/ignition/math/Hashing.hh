@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_HASHING_HH_
+#define IGNITION_MATH_HASHING_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Quaternion.hh>
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Vector4.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief Finalize a 64-bit hash value by multiply-xorshift mixing
+    /// (the splitmix64 finalizer). Every input bit affects every output
+    /// bit, so keys that differ in a single coordinate bit, such as
+    /// adjacent grid cells, land in unrelated buckets.
+    /// \param[in] _x Value to mix.
+    /// \return The mixed value.
+    inline std::uint64_t MixHash64(std::uint64_t _x)
+    {
+      _x += 0x9e3779b97f4a7c15ULL;
+      _x = (_x ^ (_x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      _x = (_x ^ (_x >> 27)) * 0x94d049bb133111ebULL;
+      return _x ^ (_x >> 31);
+    }
+
+    /// \brief Fold one more 64-bit value into a running hash.
+    /// \param[in] _seed Hash so far.
+    /// \param[in] _value Value to fold in.
+    /// \return The combined hash.
+    inline std::uint64_t HashCombine(const std::uint64_t _seed,
+                                     const std::uint64_t _value)
+    {
+      return MixHash64(_seed ^ (MixHash64(_value) +
+          0x9e3779b97f4a7c15ULL + (_seed << 6) + (_seed >> 2)));
+    }
+
+    /// \brief Get the bit pattern of a scalar as a 64-bit key.
+    /// Floating-point values are keyed by their exact bits, so +0.0
+    /// and -0.0 are distinct keys and a NaN is a valid key equal to
+    /// itself; see BitwiseEqual.
+    /// \param[in] _value Scalar to reinterpret.
+    /// \return The value's bits, zero extended.
+    template<typename T>
+    inline std::uint64_t HashBits(const T _value)
+    {
+      static_assert(sizeof(T) <= sizeof(std::uint64_t),
+          "HashBits requires a scalar of at most 64 bits");
+      std::uint64_t bits = 0;
+      std::memcpy(&bits, &_value, sizeof(T));
+      return bits;
+    }
+
+    /// \brief Hasher for unordered containers keyed by math types,
+    /// hashing the exact bit patterns of the components through
+    /// MixHash64. Specializations cover the Vector2, Vector3, Vector4,
+    /// Quaternion and Pose3 instantiations.
+    ///
+    /// Pair it with BitwiseEqual: the types' operator== compares with
+    /// a tolerance, which is not transitive and disagrees with any
+    /// hash function, so std::equal_to must not be used as the
+    /// KeyEqual of a hashed container. UnorderedMap and UnorderedSet
+    /// below bundle the correct pair.
+    template<typename KeyT> struct BitwiseHash;
+
+    /// \brief Bit-exact equality for unordered containers keyed by
+    /// math types: two keys are equal when every component has the
+    /// same bit pattern. Unlike the types' tolerance-based operator==
+    /// this is transitive and consistent with BitwiseHash; note that
+    /// +0.0 and -0.0 are distinct keys and a NaN key equals itself.
+    template<typename KeyT> struct BitwiseEqual;
+
+    /// \brief BitwiseHash for Vector2.
+    template<typename T> struct BitwiseHash<Vector2<T>>
+    {
+      /// \brief Hash a vector.
+      /// \param[in] _v Vector to hash.
+      /// \return The hash value.
+      public: std::size_t operator()(const Vector2<T> &_v) const
+      {
+        return static_cast<std::size_t>(
+            HashCombine(MixHash64(HashBits(_v.X())), HashBits(_v.Y())));
+      }
+    };
+
+    /// \brief BitwiseHash for Vector3.
+    template<typename T> struct BitwiseHash<Vector3<T>>
+    {
+      /// \brief Hash a vector.
+      /// \param[in] _v Vector to hash.
+      /// \return The hash value.
+      public: std::size_t operator()(const Vector3<T> &_v) const
+      {
+        std::uint64_t h = MixHash64(HashBits(_v.X()));
+        h = HashCombine(h, HashBits(_v.Y()));
+        return static_cast<std::size_t>(HashCombine(h, HashBits(_v.Z())));
+      }
+    };
+
+    /// \brief BitwiseHash for Vector4.
+    template<typename T> struct BitwiseHash<Vector4<T>>
+    {
+      /// \brief Hash a vector.
+      /// \param[in] _v Vector to hash.
+      /// \return The hash value.
+      public: std::size_t operator()(const Vector4<T> &_v) const
+      {
+        std::uint64_t h = MixHash64(HashBits(_v.X()));
+        h = HashCombine(h, HashBits(_v.Y()));
+        h = HashCombine(h, HashBits(_v.Z()));
+        return static_cast<std::size_t>(HashCombine(h, HashBits(_v.W())));
+      }
+    };
+
+    /// \brief BitwiseHash for Quaternion. A rotation and its negation
+    /// are distinct keys; Normalize() before keying when they should
+    /// not be.
+    template<typename T> struct BitwiseHash<Quaternion<T>>
+    {
+      /// \brief Hash a quaternion.
+      /// \param[in] _q Quaternion to hash.
+      /// \return The hash value.
+      public: std::size_t operator()(const Quaternion<T> &_q) const
+      {
+        std::uint64_t h = MixHash64(HashBits(_q.W()));
+        h = HashCombine(h, HashBits(_q.X()));
+        h = HashCombine(h, HashBits(_q.Y()));
+        return static_cast<std::size_t>(HashCombine(h, HashBits(_q.Z())));
+      }
+    };
+
+    /// \brief BitwiseHash for Pose3.
+    template<typename T> struct BitwiseHash<Pose3<T>>
+    {
+      /// \brief Hash a pose.
+      /// \param[in] _p Pose to hash.
+      /// \return The hash value.
+      public: std::size_t operator()(const Pose3<T> &_p) const
+      {
+        return static_cast<std::size_t>(HashCombine(
+            BitwiseHash<Vector3<T>>()(_p.Pos()),
+            BitwiseHash<Quaternion<T>>()(_p.Rot())));
+      }
+    };
+
+    /// \brief BitwiseEqual for Vector2.
+    template<typename T> struct BitwiseEqual<Vector2<T>>
+    {
+      /// \brief Compare two vectors bit-exactly.
+      /// \param[in] _a First vector.
+      /// \param[in] _b Second vector.
+      /// \return True when every component has the same bit pattern.
+      public: bool operator()(const Vector2<T> &_a,
+                  const Vector2<T> &_b) const
+      {
+        return HashBits(_a.X()) == HashBits(_b.X()) &&
+               HashBits(_a.Y()) == HashBits(_b.Y());
+      }
+    };
+
+    /// \brief BitwiseEqual for Vector3.
+    template<typename T> struct BitwiseEqual<Vector3<T>>
+    {
+      /// \brief Compare two vectors bit-exactly.
+      /// \param[in] _a First vector.
+      /// \param[in] _b Second vector.
+      /// \return True when every component has the same bit pattern.
+      public: bool operator()(const Vector3<T> &_a,
+                  const Vector3<T> &_b) const
+      {
+        return HashBits(_a.X()) == HashBits(_b.X()) &&
+               HashBits(_a.Y()) == HashBits(_b.Y()) &&
+               HashBits(_a.Z()) == HashBits(_b.Z());
+      }
+    };
+
+    /// \brief BitwiseEqual for Vector4.
+    template<typename T> struct BitwiseEqual<Vector4<T>>
+    {
+      /// \brief Compare two vectors bit-exactly.
+      /// \param[in] _a First vector.
+      /// \param[in] _b Second vector.
+      /// \return True when every component has the same bit pattern.
+      public: bool operator()(const Vector4<T> &_a,
+                  const Vector4<T> &_b) const
+      {
+        return HashBits(_a.X()) == HashBits(_b.X()) &&
+               HashBits(_a.Y()) == HashBits(_b.Y()) &&
+               HashBits(_a.Z()) == HashBits(_b.Z()) &&
+               HashBits(_a.W()) == HashBits(_b.W());
+      }
+    };
+
+    /// \brief BitwiseEqual for Quaternion.
+    template<typename T> struct BitwiseEqual<Quaternion<T>>
+    {
+      /// \brief Compare two quaternions bit-exactly.
+      /// \param[in] _a First quaternion.
+      /// \param[in] _b Second quaternion.
+      /// \return True when every component has the same bit pattern.
+      public: bool operator()(const Quaternion<T> &_a,
+                  const Quaternion<T> &_b) const
+      {
+        return HashBits(_a.W()) == HashBits(_b.W()) &&
+               HashBits(_a.X()) == HashBits(_b.X()) &&
+               HashBits(_a.Y()) == HashBits(_b.Y()) &&
+               HashBits(_a.Z()) == HashBits(_b.Z());
+      }
+    };
+
+    /// \brief BitwiseEqual for Pose3.
+    template<typename T> struct BitwiseEqual<Pose3<T>>
+    {
+      /// \brief Compare two poses bit-exactly.
+      /// \param[in] _a First pose.
+      /// \param[in] _b Second pose.
+      /// \return True when every component has the same bit pattern.
+      public: bool operator()(const Pose3<T> &_a, const Pose3<T> &_b) const
+      {
+        return BitwiseEqual<Vector3<T>>()(_a.Pos(), _b.Pos()) &&
+               BitwiseEqual<Quaternion<T>>()(_a.Rot(), _b.Rot());
+      }
+    };
+
+    /// \brief An unordered map keyed by a math type through the
+    /// matched BitwiseHash / BitwiseEqual pair, e.g. a hash-grid
+    /// broadphase keyed by Vector3i cell coordinates:
+    /// UnorderedMap<Vector3i, Cell>.
+    template<typename KeyT, typename ValueT>
+    using UnorderedMap = std::unordered_map<KeyT, ValueT,
+        BitwiseHash<KeyT>, BitwiseEqual<KeyT>>;
+
+    /// \brief An unordered set keyed by a math type through the
+    /// matched BitwiseHash / BitwiseEqual pair.
+    template<typename KeyT>
+    using UnorderedSet = std::unordered_set<KeyT,
+        BitwiseHash<KeyT>, BitwiseEqual<KeyT>>;
+    }
+  }
+}
+#endif
@@ -18,6 +18,7 @@
 #define IGNITION_MATH_FUNCTIONS_HH_
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -34,6 +35,10 @@
 #include <ignition/math/config.hh>
 #include "ignition/math/Export.hh"
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 /// \brief The default tolerance value used by MassMatrix3::IsValid(),
 /// MassMatrix3::IsPositive(), and MassMatrix3::ValidMoments()
 template <typename T>
@@ -593,6 +598,63 @@ namespace ignition
       return static_cast<T>(std::round(_a * p) / p);
     }
 
+    /// \brief Clamp an array of values in one call. The output may
+    /// alias the input for an in-place clamp. The loop is branch free,
+    /// so the compiler can vectorize it where a hand written loop
+    /// around clamp() often will not.
+    /// \param[in] _values array of values
+    /// \param[in] _count number of values
+    /// \param[in] _min minimum
+    /// \param[in] _max maximum
+    /// \param[out] _out destination array; must have room for
+    /// _count values
+    template<typename T>
+    inline void clampBatch(const T *_values, const size_t _count,
+        const T _min, const T _max, T *_out)
+    {
+      for (size_t i = 0; i < _count; ++i)
+        _out[i] = std::max(std::min(_values[i], _max), _min);
+    }
+
+    /// \brief Round an array of values to a given number of decimal
+    /// places in one call. The power-of-ten factor is computed once
+    /// instead of once per value, and the output may alias the input.
+    /// Each value matches precision() exactly.
+    /// \param[in] _values array of values
+    /// \param[in] _count number of values
+    /// \param[in] _precision number of decimal places
+    /// \param[out] _out destination array; must have room for
+    /// _count values
+    template<typename T>
+    inline void precisionBatch(const T *_values, const size_t _count,
+        const unsigned int &_precision, T *_out)
+    {
+      const auto p = std::pow(10, _precision);
+      for (size_t i = 0; i < _count; ++i)
+        _out[i] = static_cast<T>(std::round(_values[i] * p) / p);
+    }
+
+    /// \brief Get the minimum and maximum of an array of values in a
+    /// single branch free pass.
+    /// \param[in] _values array of values
+    /// \param[in] _count number of values
+    /// \return a pair holding the minimum and maximum. For an empty
+    /// array the pair holds the largest and lowest representable
+    /// values, mirroring min() and max().
+    template<typename T>
+    inline std::pair<T, T> minmaxBatch(const T *_values,
+        const size_t _count)
+    {
+      T minValue = std::numeric_limits<T>::max();
+      T maxValue = std::numeric_limits<T>::lowest();
+      for (size_t i = 0; i < _count; ++i)
+      {
+        minValue = std::min(minValue, _values[i]);
+        maxValue = std::max(maxValue, _values[i]);
+      }
+      return {minValue, maxValue};
+    }
+
     /// \brief Sort two numbers, such that _a <= _b
     /// \param[out] _a the first number
     /// \param[out] _b the second number
@@ -619,6 +681,149 @@ namespace ignition
       sort2(_a, _b);
     }
 
+    /// \brief Sort two numbers without branching, such that _a <= _b.
+    /// Compiles to min/max instructions, so fixed sorting networks
+    /// built from it vectorize where the branchy sort2 would not.
+    /// \param[out] _a the first number
+    /// \param[out] _b the second number
+    template<typename T>
+    inline void sort2Branchless(T &_a, T &_b)
+    {
+      const T lo = std::min(_a, _b);
+      _b = std::max(_a, _b);
+      _a = lo;
+    }
+
+    /// \brief Sort a fixed-size array with a branchless sorting
+    /// network. The compare-swap schedule (odd-even transposition)
+    /// depends only on N, so the loops fully unroll and the filter
+    /// loops around them vectorize. Intended for the small windows of
+    /// order-statistics filters; for large N prefer std::sort.
+    /// \param[in, out] _values array of N values, sorted ascending on
+    /// return.
+    template<std::size_t N, typename T>
+    inline void sortN(T *_values)
+    {
+      for (std::size_t round = 0; round < N; ++round)
+      {
+        for (std::size_t i = round % 2; i + 1 < N; i += 2)
+          sort2Branchless(_values[i], _values[i + 1]);
+      }
+    }
+
+    /// \brief Median of three values without branching.
+    /// \param[in] _a the first value
+    /// \param[in] _b the second value
+    /// \param[in] _c the third value
+    /// \return the median of the three values.
+    template<typename T>
+    inline T median3(T _a, T _b, T _c)
+    {
+      return std::max(std::min(_a, _b),
+                      std::min(std::max(_a, _b), _c));
+    }
+
+    /// \brief Median of five values with a seven compare-swap
+    /// network, without branching.
+    /// \param[in] _a the first value
+    /// \param[in] _b the second value
+    /// \param[in] _c the third value
+    /// \param[in] _d the fourth value
+    /// \param[in] _e the fifth value
+    /// \return the median of the five values.
+    template<typename T>
+    inline T median5(T _a, T _b, T _c, T _d, T _e)
+    {
+      sort2Branchless(_a, _b);
+      sort2Branchless(_d, _e);
+      sort2Branchless(_a, _d);
+      sort2Branchless(_b, _e);
+      sort2Branchless(_b, _c);
+      sort2Branchless(_c, _d);
+      sort2Branchless(_b, _c);
+      return _c;
+    }
+
+    /// \brief Sliding median filter of width five over a signal.
+    /// Each output is the median of the input window centered on it;
+    /// windows are clamped at the edges, replicating the border
+    /// samples. Every window runs the branchless median5 network, so
+    /// the per-sample loop has no data-dependent branches.
+    /// \param[in] _in input array of _count values.
+    /// \param[out] _out output array of _count values; must not alias
+    /// _in.
+    /// \param[in] _count number of values.
+    template<typename T>
+    inline void medianFilter5(const T *_in, T *_out, const size_t _count)
+    {
+      for (size_t i = 0; i < _count; ++i)
+      {
+        const size_t i0 = i >= 2 ? i - 2 : 0;
+        const size_t i1 = i >= 1 ? i - 1 : 0;
+        const size_t i3 = std::min(i + 1, _count - 1);
+        const size_t i4 = std::min(i + 2, _count - 1);
+        _out[i] = median5(_in[i0], _in[i1], _in[i], _in[i3], _in[i4]);
+      }
+    }
+
+    /// \brief 3x3 median filter over a row-major image, the despeckle
+    /// pass of depth image processing. Each output pixel is the median
+    /// of its 3x3 neighborhood, computed with the 19 compare-swap
+    /// median-of-nine network, so the inner loop is branchless and
+    /// vectorizes. Neighborhoods are clamped at the image borders,
+    /// replicating the edge pixels.
+    /// \param[in] _in input image of _width * _height values.
+    /// \param[in] _width image width; must be positive.
+    /// \param[in] _height image height; must be positive.
+    /// \param[out] _out output image of _width * _height values; must
+    /// not alias _in.
+    template<typename T>
+    inline void medianFilter3x3(const T *_in, const size_t _width,
+        const size_t _height, T *_out)
+    {
+      if (_width == 0 || _height == 0)
+        return;
+
+      for (size_t y = 0; y < _height; ++y)
+      {
+        const T *rowUp = _in + (y > 0 ? y - 1 : 0) * _width;
+        const T *row = _in + y * _width;
+        const T *rowDown = _in + std::min(y + 1, _height - 1) * _width;
+
+        for (size_t x = 0; x < _width; ++x)
+        {
+          const size_t xl = x > 0 ? x - 1 : 0;
+          const size_t xr = std::min(x + 1, _width - 1);
+
+          T p0 = rowUp[xl], p1 = rowUp[x], p2 = rowUp[xr];
+          T p3 = row[xl], p4 = row[x], p5 = row[xr];
+          T p6 = rowDown[xl], p7 = rowDown[x], p8 = rowDown[xr];
+
+          // Median-of-nine exchange network.
+          sort2Branchless(p1, p2);
+          sort2Branchless(p4, p5);
+          sort2Branchless(p7, p8);
+          sort2Branchless(p0, p1);
+          sort2Branchless(p3, p4);
+          sort2Branchless(p6, p7);
+          sort2Branchless(p1, p2);
+          sort2Branchless(p4, p5);
+          sort2Branchless(p7, p8);
+          sort2Branchless(p0, p3);
+          sort2Branchless(p5, p8);
+          sort2Branchless(p4, p7);
+          sort2Branchless(p3, p6);
+          sort2Branchless(p1, p4);
+          sort2Branchless(p2, p5);
+          sort2Branchless(p4, p7);
+          sort2Branchless(p4, p2);
+          sort2Branchless(p6, p4);
+          sort2Branchless(p4, p2);
+          _out[y * _width + x] = p4;
+        }
+      }
+    }
+
     /// \brief Is this a power of 2?
     /// \param[in] _x the number
     /// \return true if _x is a power of 2, false otherwise
@@ -648,6 +853,125 @@ namespace ignition
       return _x;
     }
 
+    /// \brief Interleave the lower 10 bits of three coordinates into a
+    /// 30-bit 3D Morton (Z-order) code. Points sorted by Morton code
+    /// are ordered along a space filling curve, which keeps spatial
+    /// neighbors close in memory. Uses the BMI2 bit-deposit instruction
+    /// when the compiler targets it.
+    /// \param[in] _x X coordinate, only the lower 10 bits are used.
+    /// \param[in] _y Y coordinate, only the lower 10 bits are used.
+    /// \param[in] _z Z coordinate, only the lower 10 bits are used.
+    /// \return The 30-bit Morton code.
+    inline uint32_t mortonEncode3d(uint32_t _x, uint32_t _y, uint32_t _z)
+    {
+#if defined(__BMI2__)
+      return _pdep_u32(_x, 0x09249249u) |
+             _pdep_u32(_y, 0x12492492u) |
+             _pdep_u32(_z, 0x24924924u);
+#else
+      auto spread = [](uint32_t _v)
+      {
+        _v &= 0x3ffu;
+        _v = (_v | (_v << 16)) & 0x030000ffu;
+        _v = (_v | (_v << 8)) & 0x0300f00fu;
+        _v = (_v | (_v << 4)) & 0x030c30c3u;
+        _v = (_v | (_v << 2)) & 0x09249249u;
+        return _v;
+      };
+      return spread(_x) | (spread(_y) << 1) | (spread(_z) << 2);
+#endif
+    }
+
+    /// \brief Recover the three 10-bit coordinates interleaved into a
+    /// 30-bit 3D Morton (Z-order) code by mortonEncode3d.
+    /// \param[in] _code The Morton code.
+    /// \param[out] _x Recovered X coordinate.
+    /// \param[out] _y Recovered Y coordinate.
+    /// \param[out] _z Recovered Z coordinate.
+    inline void mortonDecode3d(uint32_t _code,
+        uint32_t &_x, uint32_t &_y, uint32_t &_z)
+    {
+#if defined(__BMI2__)
+      _x = _pext_u32(_code, 0x09249249u);
+      _y = _pext_u32(_code, 0x12492492u);
+      _z = _pext_u32(_code, 0x24924924u);
+#else
+      auto compact = [](uint32_t _v)
+      {
+        _v &= 0x09249249u;
+        _v = (_v | (_v >> 2)) & 0x030c30c3u;
+        _v = (_v | (_v >> 4)) & 0x0300f00fu;
+        _v = (_v | (_v >> 8)) & 0x030000ffu;
+        _v = (_v | (_v >> 16)) & 0x3ffu;
+        return _v;
+      };
+      _x = compact(_code);
+      _y = compact(_code >> 1);
+      _z = compact(_code >> 2);
+#endif
+    }
+
+    /// \brief Compute an index permutation that orders points along a
+    /// 3D Morton (Z-order) curve. Processing points in this order keeps
+    /// spatial neighbors close in memory, which improves cache behavior
+    /// of clustering and tree builds. The points themselves are not
+    /// moved.
+    /// \param[in] _points Array of points with X()/Y()/Z() accessors,
+    /// such as Vector3d.
+    /// \param[in] _count Number of points.
+    /// \param[out] _indices Destination array of _count indices,
+    /// filled with the permutation 0.._count-1 in spatial order.
+    template<typename V>
+    inline void sortSpatially(const V *_points, size_t _count,
+        uint32_t *_indices)
+    {
+      if (_count == 0)
+        return;
+
+      // Normalize the cloud into the unit cube so the full 10 bits per
+      // axis are used regardless of the data's scale.
+      double minC[3], maxC[3];
+      for (int a = 0; a < 3; ++a)
+      {
+        minC[a] = MAX_D;
+        maxC[a] = LOW_D;
+      }
+      for (size_t i = 0; i < _count; ++i)
+      {
+        const double c[3] = {static_cast<double>(_points[i].X()),
+                             static_cast<double>(_points[i].Y()),
+                             static_cast<double>(_points[i].Z())};
+        for (int a = 0; a < 3; ++a)
+        {
+          minC[a] = std::min(minC[a], c[a]);
+          maxC[a] = std::max(maxC[a], c[a]);
+        }
+      }
+
+      double scale[3];
+      for (int a = 0; a < 3; ++a)
+        scale[a] = maxC[a] > minC[a] ? 1023.0 / (maxC[a] - minC[a]) : 0.0;
+
+      std::vector<uint32_t> codes(_count);
+      for (size_t i = 0; i < _count; ++i)
+      {
+        const uint32_t qx = static_cast<uint32_t>(
+            (static_cast<double>(_points[i].X()) - minC[0]) * scale[0]);
+        const uint32_t qy = static_cast<uint32_t>(
+            (static_cast<double>(_points[i].Y()) - minC[1]) * scale[1]);
+        const uint32_t qz = static_cast<uint32_t>(
+            (static_cast<double>(_points[i].Z()) - minC[2]) * scale[2]);
+        codes[i] = mortonEncode3d(qx, qy, qz);
+        _indices[i] = static_cast<uint32_t>(i);
+      }
+
+      std::sort(_indices, _indices + _count,
+          [&codes](uint32_t _a, uint32_t _b)
+          {
+            return codes[_a] < codes[_b];
+          });
+    }
+
     /// \brief Round a number up to the nearest multiple. For example, if
     /// the input number is 12 and the multiple is 10, the result is 20.
     /// If the input number is negative, then the nearest multiple will be
@@ -1073,6 +1397,128 @@ namespace ignition
     using PairOutput = uint64_t;
 #endif
 
+    namespace detail
+    {
+      /// \brief Sine usable in constant expressions: the argument is
+      /// reduced to [-pi/2, pi/2] by symmetry and summed as a Taylor
+      /// series through the x^21 term, accurate to about one double
+      /// ulp. std::sin is not constexpr in C++17, so the compile-time
+      /// table builders below need their own.
+      /// \param[in] _x Angle in radians.
+      /// \return sin(_x).
+      constexpr double constexprSin(const double _x)
+      {
+        // Reduce to r in [-pi, pi].
+        constexpr double twoPi = 2.0 * IGN_PI;
+        double r = _x - twoPi *
+            static_cast<double>(static_cast<long long>(
+                _x / twoPi + (_x < 0 ? -0.5 : 0.5)));
+        // Fold into [-pi/2, pi/2]: sin(pi - r) == sin(r).
+        if (r > 0.5 * IGN_PI)
+          r = IGN_PI - r;
+        else if (r < -0.5 * IGN_PI)
+          r = -IGN_PI - r;
+
+        double term = r;
+        double sum = r;
+        const double r2 = r * r;
+        for (int n = 1; n <= 10; ++n)
+        {
+          term *= -r2 / static_cast<double>((2 * n) * (2 * n + 1));
+          sum += term;
+        }
+        return sum;
+      }
+
+      /// \brief Exponential usable in constant expressions: the
+      /// argument is split as _x = k ln2 + r, exp(r) summed as a
+      /// Taylor series and the power of two applied by repeated
+      /// multiplication.
+      /// \param[in] _x The exponent.
+      /// \return exp(_x).
+      constexpr double constexprExp(const double _x)
+      {
+        constexpr double ln2 = 0.69314718055994530942;
+        const long long k = static_cast<long long>(
+            _x / ln2 + (_x < 0 ? -0.5 : 0.5));
+        const double r = _x - static_cast<double>(k) * ln2;
+
+        double term = 1.0;
+        double sum = 1.0;
+        for (int n = 1; n <= 16; ++n)
+        {
+          term *= r / static_cast<double>(n);
+          sum += term;
+        }
+
+        double scale = 1.0;
+        for (long long i = 0; i < (k < 0 ? -k : k); ++i)
+          scale *= 2.0;
+        return k < 0 ? sum / scale : sum * scale;
+      }
+    }
+
+    /// \brief Build a sine lookup table at compile time:
+    /// entry i is sin(2 pi i / N). Assign the result to a constexpr
+    /// variable and the table lives in .rodata, with no startup
+    /// generation cost.
+    /// \tparam N Number of entries; one full period.
+    /// \return The table.
+    template<std::size_t N>
+    constexpr std::array<double, N> makeSinTable()
+    {
+      static_assert(N > 0, "makeSinTable requires at least one entry");
+      std::array<double, N> table{};
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        table[i] = detail::constexprSin(
+            2.0 * IGN_PI * static_cast<double>(i) / static_cast<double>(N));
+      }
+      return table;
+    }
+
+    /// \brief Build a cosine lookup table at compile time:
+    /// entry i is cos(2 pi i / N). Together with makeSinTable this
+    /// provides chirp-z / FFT twiddle factors as compile-time
+    /// constants.
+    /// \tparam N Number of entries; one full period.
+    /// \return The table.
+    template<std::size_t N>
+    constexpr std::array<double, N> makeCosTable()
+    {
+      static_assert(N > 0, "makeCosTable requires at least one entry");
+      std::array<double, N> table{};
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        table[i] = detail::constexprSin(0.5 * IGN_PI +
+            2.0 * IGN_PI * static_cast<double>(i) / static_cast<double>(N));
+      }
+      return table;
+    }
+
+    /// \brief Build a normalized Gaussian convolution kernel at
+    /// compile time, centered on the middle entry.
+    /// \tparam N Number of taps; usually odd.
+    /// \param[in] _sigma Standard deviation in taps.
+    /// \return The kernel; the entries sum to one.
+    template<std::size_t N>
+    constexpr std::array<double, N> makeGaussianKernel(const double _sigma)
+    {
+      static_assert(N > 0, "makeGaussianKernel requires at least one tap");
+      std::array<double, N> kernel{};
+      const double center = 0.5 * static_cast<double>(N - 1);
+      double sum = 0.0;
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        const double d = static_cast<double>(i) - center;
+        kernel[i] = detail::constexprExp(-d * d / (2.0 * _sigma * _sigma));
+        sum += kernel[i];
+      }
+      for (std::size_t i = 0; i < N; ++i)
+        kernel[i] /= sum;
+      return kernel;
+    }
+
     /// \brief A pairing function that maps two values to a unique third
     /// value. This is an implement of Szudzik's function.
     /// \param[in] _a First value, must be a non-negative integer. On
@@ -1098,6 +1544,191 @@ namespace ignition
     /// \sa Pair
     std::tuple<PairInput, PairInput> IGNITION_MATH_VISIBLE Unpair(
         const PairOutput _key);
+
+    /// \brief Extract the indices of the changed elements from an
+    /// EqualBatch mask: the elements whose bit is clear, i.e. that
+    /// compared unequal. Zero words, the common case when nothing
+    /// moved, are skipped with one compare each, so the cost tracks
+    /// the number of changes rather than the number of elements.
+    /// \param[in] _mask Bitmask as written by EqualBatch: bit i set
+    /// when element i compared equal within tolerance.
+    /// \param[in] _count Number of elements the mask covers.
+    /// \param[out] _indices Buffer receiving the changed indices in
+    /// ascending order.
+    /// \param[in] _capacity Capacity of _indices; changes beyond it
+    /// are counted but not written.
+    /// \return The number of changed elements, which may exceed
+    /// _capacity.
+    inline std::size_t ChangedIndices(const uint64_t *_mask,
+        const std::size_t _count, std::size_t *_indices,
+        const std::size_t _capacity)
+    {
+      // De Bruijn lookup giving the bit index of an isolated set bit;
+      // portable trailing-zero count without compiler builtins.
+      static const int kBitIndex64[64] =
+      {
+        0,  1,  2, 53,  3,  7, 54, 27,  4, 38, 41,  8, 34, 55, 48, 28,
+        62, 5, 39, 46, 44, 42, 22,  9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52, 6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+      };
+
+      std::size_t found = 0;
+      const std::size_t words = (_count + 63) / 64;
+      for (std::size_t w = 0; w < words; ++w)
+      {
+        const std::size_t base = w * 64;
+        const std::size_t bits = std::min<std::size_t>(64, _count - base);
+
+        // Invert so set bits mark changes, masking off the slack of a
+        // final partial word.
+        uint64_t changed = ~_mask[w];
+        if (bits < 64)
+          changed &= (uint64_t(1) << bits) - 1;
+        while (changed != 0)
+        {
+          const uint64_t lsb = changed & (~changed + 1);
+          const int bit =
+              kBitIndex64[(lsb * 0x022fdd63cc95386dULL) >> 58];
+          if (found < _capacity)
+            _indices[found] = base + static_cast<std::size_t>(bit);
+          ++found;
+          changed &= changed - 1;
+        }
+      }
+      return found;
+    }
+
+    /// \class GaussLegendre Helpers.hh ignition/math/Helpers.hh
+    /// \brief Fixed-order Gauss-Legendre quadrature with compile-time
+    /// nodes.
+    ///
+    /// Integrates an N-point rule, exact for polynomials of degree
+    /// 2N - 1, over one interval or a batch of intervals. The nodes
+    /// and weights are constexpr on the unit interval, so the
+    /// evaluation loop unrolls completely and the integrand is the
+    /// only runtime cost per node. The 5-point rule is the one the
+    /// spline classes use internally for arc lengths.
+    /// \tparam N Number of nodes, 1 to 5.
+    template<unsigned int N>
+    class GaussLegendre
+    {
+      static_assert(N >= 1 && N <= 5,
+          "GaussLegendre supports 1 to 5 nodes");
+
+      /// \brief Number of nodes of this rule.
+      public: static constexpr unsigned int kNodeCount = N;
+
+      /// \brief Get the nodes of the rule, mapped to [0, 1] in
+      /// ascending order.
+      /// \return The nodes.
+      public: static constexpr std::array<double, N> Nodes()
+      {
+        if constexpr (N == 1)
+        {
+          return {0.5};
+        }
+        else if constexpr (N == 2)
+        {
+          return {0.21132486540518713, 0.78867513459481287};
+        }
+        else if constexpr (N == 3)
+        {
+          return {0.11270166537925831, 0.5, 0.88729833462074169};
+        }
+        else if constexpr (N == 4)
+        {
+          return {0.06943184420297371, 0.33000947820757187,
+                  0.66999052179242813, 0.93056815579702629};
+        }
+        else
+        {
+          return {0.04691007703066800, 0.23076534494715845, 0.5,
+                  0.76923465505284155, 0.95308992296933200};
+        }
+      }
+
+      /// \brief Get the weights of the rule, normalized to sum to 1
+      /// and ordered like Nodes().
+      /// \return The weights.
+      public: static constexpr std::array<double, N> Weights()
+      {
+        if constexpr (N == 1)
+        {
+          return {1.0};
+        }
+        else if constexpr (N == 2)
+        {
+          return {0.5, 0.5};
+        }
+        else if constexpr (N == 3)
+        {
+          return {0.27777777777777778, 0.44444444444444444,
+                  0.27777777777777778};
+        }
+        else if constexpr (N == 4)
+        {
+          return {0.17392742256872693, 0.32607257743127307,
+                  0.32607257743127307, 0.17392742256872693};
+        }
+        else
+        {
+          return {0.11846344252809456, 0.23931433524968326,
+                  0.28444444444444444, 0.23931433524968326,
+                  0.11846344252809456};
+        }
+      }
+
+      /// \brief Integrate a function over one interval.
+      /// \param[in] _f Integrand, invoked as _f(x) for x in
+      /// [_from, _to]; must return a value that supports addition and
+      /// scaling by double, e.g. double or Vector3d.
+      /// \param[in] _from Lower bound.
+      /// \param[in] _to Upper bound.
+      /// \return The integral estimate; negated when _from > _to, as
+      /// usual.
+      public: template<typename Functor>
+      static auto Integrate(const Functor &_f, const double _from,
+          const double _to) -> decltype(_f(0.0) * 1.0)
+      {
+        constexpr auto nodes = Nodes();
+        constexpr auto weights = Weights();
+        const double h = _to - _from;
+
+        auto sum = _f(_from + nodes[0] * h) * weights[0];
+        for (unsigned int i = 1; i < N; ++i)
+          sum = sum + _f(_from + nodes[i] * h) * weights[i];
+        return sum * h;
+      }
+
+      /// \brief Integrate a function over a batch of intervals, e.g.
+      /// the spans of a piecewise trajectory. The integrand is
+      /// evaluated N times per span with the setup hoisted out of the
+      /// loop; summing the results gives the integral over the union
+      /// of the spans.
+      /// \param[in] _f Integrand, as in the single-interval overload.
+      /// \param[in] _from Array of _count lower bounds.
+      /// \param[in] _to Array of _count upper bounds.
+      /// \param[out] _results Array of _count integral estimates.
+      /// \param[in] _count Number of intervals.
+      public: template<typename Functor>
+      static void Integrate(const Functor &_f, const double *_from,
+          const double *_to, double *_results, const size_t _count)
+      {
+        constexpr auto nodes = Nodes();
+        constexpr auto weights = Weights();
+
+        for (size_t s = 0; s < _count; ++s)
+        {
+          const double a = _from[s];
+          const double h = _to[s] - a;
+          double sum = 0.0;
+          for (unsigned int i = 0; i < N; ++i)
+            sum += weights[i] * _f(a + nodes[i] * h);
+          _results[s] = sum * h;
+        }
+      }
+    };
     }
   }
 }
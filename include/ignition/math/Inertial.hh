@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_INERTIAL_HH_
 #define IGNITION_MATH_INERTIAL_HH_
 
+#include <cstdint>
+
 #include <ignition/math/config.hh>
 #include "ignition/math/MassMatrix3.hh"
 #include "ignition/math/Pose3.hh"
@@ -85,6 +87,7 @@ namespace ignition
                   const T _tolerance = IGN_MASSMATRIX3_DEFAULT_TOLERANCE<T>)
       {
         this->massMatrix = _m;
+        ++this->moiVersion;
         return this->massMatrix.IsValid(_tolerance);
       }
 
@@ -103,6 +106,7 @@ namespace ignition
       public: bool SetPose(const Pose3<T> &_pose)
       {
         this->pose = _pose;
+        ++this->moiVersion;
         return this->massMatrix.IsValid();
       }
 
@@ -128,10 +132,29 @@ namespace ignition
       /// in this class’s documentation.
       public: Matrix3<T> Moi() const
       {
-        auto R = Matrix3<T>(this->pose.Rot());
+        auto R = this->pose.Rot().RotationMatrix();
         return R * this->massMatrix.Moi() * R.Transposed();
       }
 
+      /// \brief Get the moment of inertia matrix in this object's frame
+      /// F, cached between calls.
+      ///
+      /// Moi() rebuilds the R * L * R^T rotation sandwich on every
+      /// call, which dominates aggregation loops that query the same
+      /// Inertial many times. This accessor computes the product once
+      /// and reuses it until SetMassMatrix(), SetPose() or one of the
+      /// other mutators invalidates the cache.
+      /// \return The same matrix Moi() returns.
+      public: const Matrix3<T> &CachedMoi() const
+      {
+        if (this->moiCacheVersion != this->moiVersion)
+        {
+          this->moiCache = this->Moi();
+          this->moiCacheVersion = this->moiVersion;
+        }
+        return this->moiCache;
+      }
+
       /// \brief Set the inertial pose rotation without affecting the
       /// MOI in the base coordinate frame.
       /// \param[in] _q New rotation for inertial pose.
@@ -140,7 +163,8 @@ namespace ignition
       {
         auto moi = this->Moi();
         this->pose.Rot() = _q;
-        auto R = Matrix3<T>(_q);
+        ++this->moiVersion;
+        auto R = _q.RotationMatrix();
         return this->massMatrix.SetMoi(R.Transposed() * moi * R);
       }
 
@@ -161,12 +185,13 @@ namespace ignition
       {
         this->pose.Rot() *= this->MassMatrix().PrincipalAxesOffset(_tol) *
                             _q.Inverse();
+        ++this->moiVersion;
         const auto moments = this->MassMatrix().PrincipalMoments(_tol);
         const auto diag = Matrix3<T>(
             moments[0], 0, 0,
             0, moments[1], 0,
             0, 0, moments[2]);
-        const auto R = Matrix3<T>(_q);
+        const auto R = _q.RotationMatrix();
         return this->massMatrix.SetMoi(R * diag * R.Transposed());
       }
 
@@ -177,6 +202,7 @@ namespace ignition
       {
         this->massMatrix = _inertial.MassMatrix();
         this->pose = _inertial.Pose();
+        ++this->moiVersion;
 
         return *this;
       }
@@ -253,6 +279,7 @@ namespace ignition
         }
         this->massMatrix = MassMatrix3<T>(mass, ixxyyzz, ixyxzyz);
         this->pose = Pose3<T>(com, Quaternion<T>::Identity);
+        ++this->moiVersion;
 
         return *this;
       }
@@ -267,10 +294,145 @@ namespace ignition
         return Inertial<T>(*this) += _inertial;
       }
 
+      /// \brief Origin-frame accumulator used by SumInertials: the
+      /// total mass, mass-weighted center of mass, and inertia about
+      /// the base frame origin of a group of bodies. Two accumulators
+      /// combine by plain addition, so groups can be reduced in any
+      /// order, including in parallel.
+      private: struct OriginSum
+      {
+        /// \brief Total mass of the group.
+        T mass = 0;
+
+        /// \brief Mass-weighted sum of the centers of mass.
+        Vector3<T> weightedCom;
+
+        /// \brief Diagonal of the inertia about the origin.
+        Vector3<T> ixxyyzz;
+
+        /// \brief Off-diagonal of the inertia about the origin.
+        Vector3<T> ixyxzyz;
+
+        /// \brief Merge another group into this one.
+        /// \param[in] _other Accumulator to merge.
+        /// \return Reference to this object.
+        OriginSum &operator+=(const OriginSum &_other)
+        {
+          this->mass += _other.mass;
+          this->weightedCom += _other.weightedCom;
+          this->ixxyyzz += _other.ixxyyzz;
+          this->ixyxzyz += _other.ixyxzyz;
+          return *this;
+        }
+      };
+
+      /// \brief Reduce a range of inertials into an origin-frame
+      /// accumulator with a pairwise (tree) reduction: short runs are
+      /// summed sequentially and longer ranges are split in half and
+      /// combined. Addends at each level have similar magnitude, which
+      /// bounds the rounding error growth at O(log n) instead of the
+      /// O(n) of a left fold.
+      /// \param[in] _inertials Array of inertials.
+      /// \param[in] _count Number of inertials.
+      /// \return Accumulated mass, weighted center of mass, and
+      /// inertia about the base frame origin.
+      private: static OriginSum SumAboutOrigin(
+                  const Inertial<T> *_inertials, size_t _count)
+      {
+        // Leaf: accumulate a short run sequentially.
+        if (_count <= 8)
+        {
+          OriginSum sum;
+          for (size_t i = 0; i < _count; ++i)
+          {
+            const T m = _inertials[i].MassMatrix().Mass();
+            const auto moi = _inertials[i].Moi();
+            const auto c = _inertials[i].Pose().Pos();
+
+            sum.mass += m;
+            sum.weightedCom += m * c;
+
+            // Inertia about the base frame origin: rotated body
+            // inertia plus the parallel axis term for the offset c.
+            sum.ixxyyzz.X() += moi(0, 0) +
+                m * (std::pow(c[1], 2) + std::pow(c[2], 2));
+            sum.ixxyyzz.Y() += moi(1, 1) +
+                m * (std::pow(c[2], 2) + std::pow(c[0], 2));
+            sum.ixxyyzz.Z() += moi(2, 2) +
+                m * (std::pow(c[0], 2) + std::pow(c[1], 2));
+            sum.ixyxzyz.X() += moi(0, 1) - m * c[0] * c[1];
+            sum.ixyxzyz.Y() += moi(0, 2) - m * c[0] * c[2];
+            sum.ixyxzyz.Z() += moi(1, 2) - m * c[1] * c[2];
+          }
+          return sum;
+        }
+
+        // The two halves are independent and could be reduced on
+        // separate threads.
+        const size_t half = _count / 2;
+        OriginSum sum = SumAboutOrigin(_inertials, half);
+        sum += SumAboutOrigin(_inertials + half, _count - half);
+        return sum;
+      }
+
+      /// \brief Combine an array of inertials in a single pass.
+      ///
+      /// Folding operator+= over hundreds of links rebuilds the
+      /// combined mass matrix once per link, and its sequential
+      /// rounding error grows with the link count. This reducer
+      /// accumulates every body's inertia about the base frame origin
+      /// with a pairwise tree reduction, then shifts the total to the
+      /// combined center of mass once at the end. The result matches
+      /// the chained operator+= fold up to that rounding difference.
+      /// \param[in] _inertials Array of inertials, all expressed in
+      /// the same base frame.
+      /// \param[in] _count Number of inertials.
+      /// \return The combined inertial, with an identity rotation and
+      /// the combined center of mass as its pose. A default Inertial
+      /// when the total mass is not positive.
+      public: static Inertial<T> SumInertials(
+                  const Inertial<T> *_inertials, size_t _count)
+      {
+        const OriginSum origin = SumAboutOrigin(_inertials, _count);
+        const T mass = origin.mass;
+        Vector3<T> ixxyyzz = origin.ixxyyzz;
+        Vector3<T> ixyxzyz = origin.ixyxzyz;
+
+        if (mass <= 0)
+        {
+          return Inertial<T>();
+        }
+
+        // Shift the accumulated inertia from the origin to the
+        // combined center of mass.
+        const Vector3<T> com = origin.weightedCom / mass;
+        ixxyyzz.X() -= mass * (std::pow(com[1], 2) + std::pow(com[2], 2));
+        ixxyyzz.Y() -= mass * (std::pow(com[2], 2) + std::pow(com[0], 2));
+        ixxyyzz.Z() -= mass * (std::pow(com[0], 2) + std::pow(com[1], 2));
+        ixyxzyz.X() += mass * com[0] * com[1];
+        ixyxzyz.Y() += mass * com[0] * com[2];
+        ixyxzyz.Z() += mass * com[1] * com[2];
+
+        return Inertial<T>(MassMatrix3<T>(mass, ixxyyzz, ixyxzyz),
+            Pose3<T>(com, Quaternion<T>::Identity));
+      }
+
       /// \brief Mass and inertia matrix of the object expressed in the
       /// center of mass reference frame.
       private: MassMatrix3<T> massMatrix;
 
+      /// \brief Cached moment of inertia in the frame F, rebuilt lazily
+      /// by CachedMoi() whenever a setter has bumped moiVersion past
+      /// moiCacheVersion.
+      private: mutable Matrix3<T> moiCache;
+
+      /// \brief Version of the mass matrix and pose state. Incremented
+      /// by every setter.
+      private: mutable uint64_t moiVersion = 1;
+
+      /// \brief Version of the state captured in moiCache.
+      private: mutable uint64_t moiCacheVersion = 0;
+
       /// \brief Pose offset of center of mass reference frame relative
       /// to a base frame.
       private: Pose3<T> pose;
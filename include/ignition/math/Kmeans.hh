@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_KMEANS_HH_
 #define IGNITION_MATH_KMEANS_HH_
 
+#include <cstddef>
+#include <functional>
 #include <vector>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/Helpers.hh>
@@ -32,6 +34,37 @@ namespace ignition
     // Forward declare private data
     class KmeansPrivate;
 
+    /// \brief Squared Euclidean distance metric for nearest-centroid
+    /// queries. Dropping the square root does not change which
+    /// centroid is closest, so this is the default metric for argmin
+    /// scans.
+    struct SquaredEuclideanDistance
+    {
+      /// \brief Evaluate the metric.
+      /// \param[in] _a First point.
+      /// \param[in] _b Second point.
+      /// \return The squared Euclidean distance between the points.
+      public: static double Evaluate(const Vector3d &_a, const Vector3d &_b)
+      {
+        return (_a - _b).SquaredLength();
+      }
+    };
+
+    /// \brief Manhattan (L1) distance metric for nearest-centroid
+    /// queries.
+    struct ManhattanDistance
+    {
+      /// \brief Evaluate the metric.
+      /// \param[in] _a First point.
+      /// \param[in] _b Second point.
+      /// \return The sum of the absolute coordinate differences.
+      public: static double Evaluate(const Vector3d &_a, const Vector3d &_b)
+      {
+        return std::abs(_a.X() - _b.X()) + std::abs(_a.Y() - _b.Y()) +
+               std::abs(_a.Z() - _b.Z());
+      }
+    };
+
     /// \class Kmeans Kmeans.hh math/gzmath.hh
     /// \brief K-Means clustering algorithm. Given a set of observations,
     /// k-means partitions the observations into k sets so as to minimize the
@@ -55,7 +88,23 @@ namespace ignition
       /// \return True if the vector is not empty or false otherwise.
       public: bool Observations(const std::vector<Vector3d> &_obs);
 
-      /// \brief Add observations to the cluster.
+      /// \brief Set the observations to cluster as a non-owning view of
+      /// a caller-owned buffer, e.g. an mmap'd point set. No copy is
+      /// made: the clustering passes read straight from the buffer,
+      /// which must stay valid and unchanged while Cluster() runs. A
+      /// later Observations() or AppendObservations() call leaves view
+      /// mode; UpdateObservations() is rejected while viewing, since
+      /// the caller can edit their own buffer directly.
+      /// \param[in] _obs Buffer of observations.
+      /// \param[in] _count Number of observations.
+      /// \return True if the buffer is non-null and non-empty or false
+      /// otherwise.
+      public: bool ObservationsView(const Vector3d *_obs,
+                  const size_t _count);
+
+      /// \brief Add observations to the cluster. When the observations
+      /// are a view, they are copied into owned storage once and growth
+      /// is owned from then on.
       /// \param[in] _obs Vector of observations.
       /// \return True if the _obs vector is not empty or false otherwise.
       public: bool AppendObservations(const std::vector<Vector3d> &_obs);
@@ -75,14 +124,232 @@ namespace ignition
                            std::vector<Vector3d> &_centroids,
                            std::vector<unsigned int> &_labels);
 
+      /// \brief Telemetry reported after each iteration of a budgeted
+      /// Cluster() run.
+      public: struct IterationInfo
+      {
+        /// \brief Iteration number, starting at 1.
+        public: unsigned int iteration;
+
+        /// \brief Number of observations whose label changed during
+        /// the iteration.
+        public: size_t changed;
+
+        /// \brief Largest distance any centroid moved during the
+        /// iteration.
+        public: double maxMovement;
+      };
+
+      /// \brief Callback invoked after each iteration of a budgeted
+      /// Cluster() run. Return false to stop iterating; the result so
+      /// far is still produced.
+      public: using IterationCallback =
+          std::function<bool(const IterationInfo &)>;
+
+      /// \brief Executes the k-means algorithm under an explicit
+      /// budget, with per-iteration telemetry. Identical to Cluster()
+      /// except that iteration also stops when the iteration or time
+      /// budget is exhausted or the callback returns false, so a
+      /// frame-budgeted pipeline can trade accuracy for latency. The
+      /// partial result on early exit is valid: every observation is
+      /// labeled with its closest centroid of the last iteration.
+      /// \param[in] _k Number of partitions to cluster.
+      /// \param[out] _centroids Vector of centroids, as in Cluster().
+      /// \param[out] _labels Vector of labels, as in Cluster().
+      /// \param[in] _maxIterations Iteration budget; zero means
+      /// unlimited.
+      /// \param[in] _maxSeconds Time budget in seconds, checked after
+      /// each iteration; zero or negative means unlimited.
+      /// \param[in] _callback Optional per-iteration callback
+      /// reporting the telemetry; return false to stop.
+      /// \return True when the operation succeeded, with the failure
+      /// modes of Cluster().
+      public: bool ClusterBudgeted(int _k,
+                           std::vector<Vector3d> &_centroids,
+                           std::vector<unsigned int> &_labels,
+                           const unsigned int _maxIterations,
+                           const double _maxSeconds = 0.0,
+                           const IterationCallback &_callback = nullptr);
+
+      /// \brief Re-cluster after small changes to the observations,
+      /// reusing the labels and centroids from the previous run as the
+      /// starting assignment. Intended for tracking workloads that
+      /// cluster nearly identical point sets every frame: a steady-state
+      /// frame converges in one or two iterations instead of a cold run.
+      /// Falls back to Cluster() if there is no previous result for the
+      /// same _k and observation count.
+      /// \param[in] _k Number of partitions to cluster.
+      /// \param[out] _centroids Vector of centroids, as in Cluster().
+      /// \param[out] _labels Vector of labels, as in Cluster().
+      /// \param[in] _movementThreshold Iteration stops once no centroid
+      /// moved farther than this during the last pass.
+      /// \return True when the operation succeeded, with the failure
+      /// modes of Cluster().
+      public: bool ClusterIncremental(int _k,
+                           std::vector<Vector3d> &_centroids,
+                           std::vector<unsigned int> &_labels,
+                           const double _movementThreshold = 1e-6);
+
+      /// \brief Replace individual observations in place, keeping the
+      /// labels attached to them, so ClusterIncremental() can warm
+      /// start from the previous assignment.
+      /// \param[in] _indices Indices of the observations to replace.
+      /// \param[in] _obs New values, one per index.
+      /// \return True on success, or false if the vectors are empty,
+      /// their sizes differ, or an index is out of range.
+      public: bool UpdateObservations(const std::vector<size_t> &_indices,
+                           const std::vector<Vector3d> &_obs);
+
+      /// \brief Executes mini-batch k-means. Instead of full passes
+      /// over the observations, each iteration samples a small batch
+      /// and moves the assigned centroids toward the samples with a
+      /// per-centroid learning rate that decays with the number of
+      /// samples the centroid has absorbed. The result is approximate,
+      /// but for very large observation sets it converges in a small
+      /// fraction of the wall-clock time of Cluster(). One full
+      /// assignment pass at the end produces the labels.
+      /// \param[in] _k Number of partitions to cluster.
+      /// \param[out] _centroids Vector of centroids, as in Cluster().
+      /// \param[out] _labels Vector of labels, as in Cluster().
+      /// \param[in] _batchSize Number of observations sampled per
+      /// iteration.
+      /// \param[in] _maxIterations Upper bound on iterations.
+      /// \param[in] _movementThreshold Iteration stops early once no
+      /// centroid moved farther than this during the last batch.
+      /// \return True when the operation succeeded, with the failure
+      /// modes of Cluster() plus a zero _batchSize.
+      public: bool ClusterMiniBatch(int _k,
+                           std::vector<Vector3d> &_centroids,
+                           std::vector<unsigned int> &_labels,
+                           const size_t _batchSize = 1024,
+                           const unsigned int _maxIterations = 100,
+                           const double _movementThreshold = 1e-4);
+
+      /// \brief Find the centroid closest to a point under a
+      /// compile-time metric. The metric is a policy type with a
+      /// static Evaluate(a, b) member, so the comparison loop inlines
+      /// and vectorizes; SquaredEuclideanDistance and
+      /// ManhattanDistance are provided, and callers may supply their
+      /// own. The internal clustering paths use the squared Euclidean
+      /// specialization, which returns the same labels as the plain
+      /// Euclidean scan without a square root per comparison.
+      /// \param[in] _p Point to check.
+      /// \param[in] _centroids Array of centroids.
+      /// \param[in] _count Number of centroids; must be positive.
+      /// \return The index of the centroid minimizing the metric.
+      public: template<typename MetricT = SquaredEuclideanDistance>
+              static unsigned int ClosestCentroid(const Vector3d &_p,
+                  const Vector3d *_centroids, const size_t _count)
+      {
+        double min = MAX_D;
+        unsigned int minIdx = 0;
+        for (auto i = 0u; i < _count; ++i)
+        {
+          const double d = MetricT::Evaluate(_p, _centroids[i]);
+          if (d < min)
+          {
+            min = d;
+            minIdx = i;
+          }
+        }
+        return minIdx;
+      }
+
       /// \brief Given an observation, it returns the closest centroid to it.
       /// \param[in] _p Point to check.
       /// \return The index of the closest centroid to the point _p.
       private: unsigned int ClosestCentroid(const Vector3d &_p) const;
 
+      /// \brief Run one assignment/update pass of Lloyd's algorithm
+      /// over the current state.
+      /// \param[in] _k Number of partitions.
+      /// \param[out] _maxMovement Largest distance any centroid moved.
+      /// \return The number of observations that changed cluster.
+      private: size_t IterateOnce(int _k, double &_maxMovement);
+
       /// \brief Private data pointer
       private: KmeansPrivate *dataPtr;
     };
+
+    // Forward declare private data
+    class KmeansNdPrivate;
+
+    /// \brief K-means clustering over points of arbitrary dimension.
+    ///
+    /// Kmeans is fixed to Vector3d observations, which forces
+    /// embedding and descriptor workloads of 16 to 128 dimensions to
+    /// downproject before clustering. This class keeps the
+    /// observations in a flat row-major buffer and scans the
+    /// centroids in cache-sized blocks, so the distance kernel is a
+    /// plain loop over contiguous doubles that the compiler can
+    /// vectorize at any dimension. Seeding, pruning and convergence
+    /// match Kmeans::Cluster(); at dimension three the two classes
+    /// produce the same clustering, and Kmeans remains the
+    /// convenient API for Vector3d data.
+    class IGNITION_MATH_VISIBLE KmeansNd
+    {
+      /// \brief Constructor.
+      /// \param[in] _dimension Number of coordinates per point. Must
+      /// be positive; a zero dimension leaves the object unable to
+      /// accept observations.
+      public: explicit KmeansNd(const unsigned int _dimension);
+
+      /// \brief Destructor.
+      public: virtual ~KmeansNd();
+
+      /// \brief Get the number of coordinates per point.
+      /// \return The dimension given to the constructor.
+      public: unsigned int Dimension() const;
+
+      /// \brief Set the observations to cluster, copying them out of
+      /// a strided buffer: coordinate j of point i is read from
+      /// _obs[i * _stride + j], so rows of a wider matrix can be
+      /// clustered without repacking.
+      /// \param[in] _obs Buffer of observations.
+      /// \param[in] _count Number of points.
+      /// \param[in] _stride Distance in doubles between consecutive
+      /// points; 0 means tightly packed (equal to the dimension).
+      /// \return True on success, or false when the buffer is empty
+      /// or the stride is smaller than the dimension.
+      public: bool Observations(const double *_obs, const size_t _count,
+                  const size_t _stride = 0);
+
+      /// \brief Add observations to cluster, with the layout rules
+      /// of Observations().
+      /// \param[in] _obs Buffer of observations.
+      /// \param[in] _count Number of points.
+      /// \param[in] _stride Distance in doubles between consecutive
+      /// points; 0 means tightly packed.
+      /// \return True on success, or false when the buffer is empty
+      /// or the stride is smaller than the dimension.
+      public: bool AppendObservations(const double *_obs,
+                  const size_t _count, const size_t _stride = 0);
+
+      /// \brief Get the number of stored observations.
+      /// \return The observation count.
+      public: size_t ObservationCount() const;
+
+      /// \brief Executes the k-means algorithm.
+      /// \param[in] _k Number of partitions to cluster.
+      /// \param[out] _centroids Flat row-major centroid buffer,
+      /// resized to _k * Dimension().
+      /// \param[out] _labels Vector of labels, one per observation.
+      /// \return True when the operation succeeded, with the failure
+      /// modes of Kmeans::Cluster().
+      public: bool Cluster(int _k,
+                           std::vector<double> &_centroids,
+                           std::vector<unsigned int> &_labels);
+
+      /// \brief Run one assignment/update pass of Lloyd's algorithm
+      /// over the current state.
+      /// \param[in] _k Number of partitions.
+      /// \param[out] _maxMovement Largest distance any centroid moved.
+      /// \return The number of observations that changed cluster.
+      private: size_t IterateOnce(int _k, double &_maxMovement);
+
+      /// \brief Private data pointer
+      private: KmeansNdPrivate *dataPtr;
+    };
     }
   }
 }
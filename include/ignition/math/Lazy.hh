@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_LAZY_HH_
+#define IGNITION_MATH_LAZY_HH_
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Vector4.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief Opt-in expression templates for small vector arithmetic.
+    ///
+    /// The regular Vector3 / Vector4 operators materialize a temporary
+    /// per operation, so a chain like `a + b * s - c.Cross(d)` walks the
+    /// components several times. Wrapping the first operand with
+    /// lazy::Ref fuses the whole chain into a single per-component loop
+    /// with no temporaries:
+    ///
+    /// \code
+    /// Vector3d r = (lazy::Ref(a) + b * s - lazy::Cross(c, d)).Eval();
+    /// \endcode
+    ///
+    /// Expressions hold references to their operands, so they must be
+    /// evaluated before any operand goes out of scope; they are meant to
+    /// be consumed on the same line they are built.
+    namespace lazy
+    {
+      /// \brief Number of components of a vector type usable in lazy
+      /// expressions. Specialized for Vector3 and Vector4.
+      template<typename VectorT>
+      struct Dimension;
+
+      template<typename T>
+      struct Dimension<Vector3<T>>
+      {
+        public: static constexpr std::size_t value = 3;
+      };
+
+      template<typename T>
+      struct Dimension<Vector4<T>>
+      {
+        public: static constexpr std::size_t value = 4;
+      };
+
+      /// \brief Leaf expression: a reference to a concrete vector.
+      template<typename VectorT>
+      class VectorRef
+      {
+        /// \brief Component type.
+        public: using Scalar =
+            typename std::decay<decltype(VectorT()[0])>::type;
+
+        /// \brief Number of components.
+        public: static constexpr std::size_t kSize =
+            Dimension<VectorT>::value;
+
+        /// \brief Constructor.
+        /// \param[in] _v Vector to reference. Must outlive the expression.
+        public: explicit VectorRef(const VectorT &_v)
+        : vec(_v)
+        {
+        }
+
+        /// \brief Get one component.
+        /// \param[in] _i Component index.
+        /// \return The component value.
+        public: Scalar Component(const std::size_t _i) const
+        {
+          return this->vec[_i];
+        }
+
+        /// \brief Referenced vector.
+        private: const VectorT &vec;
+      };
+
+      /// \brief Whether a type is a lazy expression (has kSize).
+      template<typename E, typename = void>
+      struct IsExpression : std::false_type
+      {
+      };
+
+      template<typename E>
+      struct IsExpression<E, std::void_t<decltype(E::kSize)>>
+          : std::true_type
+      {
+      };
+
+      /// \brief Lift a value into expression form: vectors are wrapped
+      /// in a VectorRef, expressions pass through unchanged.
+      template<typename E,
+          typename std::enable_if<IsExpression<E>::value, int>::type = 0>
+      E Lift(const E &_e)
+      {
+        return _e;
+      }
+
+      template<typename VectorT,
+          typename std::enable_if<!IsExpression<VectorT>::value,
+              int>::type = 0>
+      VectorRef<VectorT> Lift(const VectorT &_v)
+      {
+        return VectorRef<VectorT>(_v);
+      }
+
+      /// \brief Component-wise sum of two expressions.
+      template<typename L, typename R>
+      class SumExpr
+      {
+        public: using Scalar = typename L::Scalar;
+        public: static constexpr std::size_t kSize = L::kSize;
+        static_assert(L::kSize == R::kSize, "dimension mismatch");
+
+        public: SumExpr(const L &_l, const R &_r)
+        : left(_l), right(_r)
+        {
+        }
+
+        public: Scalar Component(const std::size_t _i) const
+        {
+          return this->left.Component(_i) + this->right.Component(_i);
+        }
+
+        private: const L left;
+        private: const R right;
+      };
+
+      /// \brief Component-wise difference of two expressions.
+      template<typename L, typename R>
+      class DiffExpr
+      {
+        public: using Scalar = typename L::Scalar;
+        public: static constexpr std::size_t kSize = L::kSize;
+        static_assert(L::kSize == R::kSize, "dimension mismatch");
+
+        public: DiffExpr(const L &_l, const R &_r)
+        : left(_l), right(_r)
+        {
+        }
+
+        public: Scalar Component(const std::size_t _i) const
+        {
+          return this->left.Component(_i) - this->right.Component(_i);
+        }
+
+        private: const L left;
+        private: const R right;
+      };
+
+      /// \brief An expression scaled by a scalar.
+      template<typename E>
+      class ScaleExpr
+      {
+        public: using Scalar = typename E::Scalar;
+        public: static constexpr std::size_t kSize = E::kSize;
+
+        public: ScaleExpr(const E &_e, const Scalar _s)
+        : expr(_e), scale(_s)
+        {
+        }
+
+        public: Scalar Component(const std::size_t _i) const
+        {
+          return this->expr.Component(_i) * this->scale;
+        }
+
+        private: const E expr;
+        private: const Scalar scale;
+      };
+
+      /// \brief Cross product of two 3-component expressions.
+      template<typename L, typename R>
+      class CrossExpr
+      {
+        public: using Scalar = typename L::Scalar;
+        public: static constexpr std::size_t kSize = 3;
+        static_assert(L::kSize == 3 && R::kSize == 3,
+            "cross product requires 3 components");
+
+        public: CrossExpr(const L &_l, const R &_r)
+        : left(_l), right(_r)
+        {
+        }
+
+        public: Scalar Component(const std::size_t _i) const
+        {
+          const std::size_t j = (_i + 1) % 3;
+          const std::size_t k = (_i + 2) % 3;
+          return this->left.Component(j) * this->right.Component(k) -
+                 this->left.Component(k) * this->right.Component(j);
+        }
+
+        private: const L left;
+        private: const R right;
+      };
+
+      /// \brief Wrap a vector so that subsequent operators build lazy
+      /// expressions instead of temporaries.
+      /// \param[in] _v Vector to wrap. Must outlive the expression.
+      /// \return A leaf expression referencing \p _v.
+      template<typename VectorT>
+      VectorRef<VectorT> Ref(const VectorT &_v)
+      {
+        return VectorRef<VectorT>(_v);
+      }
+
+      /// \brief Build a lazy cross product node.
+      /// \param[in] _l Left operand, a vector or expression.
+      /// \param[in] _r Right operand, a vector or expression.
+      /// \return A cross product expression.
+      template<typename L, typename R>
+      auto Cross(const L &_l, const R &_r)
+      {
+        return CrossExpr<decltype(Lift(_l)), decltype(Lift(_r))>(
+            Lift(_l), Lift(_r));
+      }
+
+      /// \brief Lazy addition. At least one operand must already be an
+      /// expression; the other may be a plain vector.
+      template<typename L, typename R,
+          typename std::enable_if<IsExpression<L>::value ||
+              IsExpression<R>::value, int>::type = 0>
+      auto operator+(const L &_l, const R &_r)
+      {
+        return SumExpr<decltype(Lift(_l)), decltype(Lift(_r))>(
+            Lift(_l), Lift(_r));
+      }
+
+      /// \brief Lazy subtraction. At least one operand must already be
+      /// an expression; the other may be a plain vector.
+      template<typename L, typename R,
+          typename std::enable_if<IsExpression<L>::value ||
+              IsExpression<R>::value, int>::type = 0>
+      auto operator-(const L &_l, const R &_r)
+      {
+        return DiffExpr<decltype(Lift(_l)), decltype(Lift(_r))>(
+            Lift(_l), Lift(_r));
+      }
+
+      /// \brief Lazy scaling of an expression by a scalar.
+      template<typename E,
+          typename std::enable_if<IsExpression<E>::value, int>::type = 0>
+      auto operator*(const E &_e, const typename E::Scalar _s)
+      {
+        return ScaleExpr<E>(_e, _s);
+      }
+
+      /// \brief Lazy scaling of an expression by a scalar.
+      template<typename E,
+          typename std::enable_if<IsExpression<E>::value, int>::type = 0>
+      auto operator*(const typename E::Scalar _s, const E &_e)
+      {
+        return ScaleExpr<E>(_e, _s);
+      }
+
+      /// \brief Evaluate an expression into a concrete vector in a
+      /// single per-component loop.
+      /// \param[in] _e Expression to evaluate.
+      /// \return The materialized vector.
+      template<typename E,
+          typename std::enable_if<IsExpression<E>::value, int>::type = 0>
+      auto Eval(const E &_e)
+      {
+        using Scalar = typename E::Scalar;
+        typename std::conditional<E::kSize == 3,
+            Vector3<Scalar>, Vector4<Scalar>>::type result;
+        for (std::size_t i = 0; i < E::kSize; ++i)
+          result[i] = _e.Component(i);
+        return result;
+      }
+
+      /// \brief Eager dot product of two expressions or vectors,
+      /// evaluated without materializing either operand.
+      /// \param[in] _l Left operand, a vector or expression.
+      /// \param[in] _r Right operand, a vector or expression.
+      /// \return The dot product.
+      template<typename L, typename R>
+      auto Dot(const L &_l, const R &_r)
+      {
+        auto l = Lift(_l);
+        auto r = Lift(_r);
+        using E = decltype(l);
+        typename E::Scalar sum = 0;
+        for (std::size_t i = 0; i < E::kSize; ++i)
+          sum += l.Component(i) * r.Component(i);
+        return sum;
+      }
+    }
+    }
+  }
+}
+#endif
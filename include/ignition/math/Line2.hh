@@ -18,6 +18,8 @@
 #define IGNITION_MATH_LINE2_HH_
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <ignition/math/Vector2.hh>
 #include <ignition/math/config.hh>
 
@@ -251,6 +253,67 @@ namespace ignition
         return true;
       }
 
+      /// \brief Intersect many segment pairs in one call:
+      /// _linesA[i] against _linesB[i].
+      ///
+      /// The kernel uses the parametric orientation-predicate
+      /// formulation — two cross products locate the intersection on
+      /// each segment — with the in-range tests folded into sign and
+      /// magnitude comparisons, so the loop is free of early-out
+      /// branches and vectorizes. Unlike Intersect, near-parallel
+      /// pairs (cross product within _epsilon of zero) never report an
+      /// intersection, including the collinear-overlap case Intersect
+      /// resolves with per-endpoint Within tests.
+      /// \param[in] _linesA Array of _count segments.
+      /// \param[in] _linesB Array of _count segments.
+      /// \param[out] _points _points[i] is the intersection point of
+      /// pair i; only valid where _intersect[i] is 1.
+      /// \param[out] _intersect _intersect[i] is 1 if pair i
+      /// intersects and 0 otherwise.
+      /// \param[in] _count Number of segment pairs.
+      /// \param[in] _epsilon Cross products within this bound of zero
+      /// are treated as parallel.
+      /// \return The number of intersecting pairs.
+      public: static size_t IntersectBatch(const Line2<T> *_linesA,
+                  const Line2<T> *_linesB, Vector2<T> *_points,
+                  uint8_t *_intersect, const size_t _count,
+                  const double _epsilon = 1e-6)
+      {
+        size_t found = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const Vector2<T> &a0 = _linesA[i][0];
+          const Vector2<T> &b0 = _linesB[i][0];
+          const T rX = _linesA[i][1].X() - a0.X();
+          const T rY = _linesA[i][1].Y() - a0.Y();
+          const T sX = _linesB[i][1].X() - b0.X();
+          const T sY = _linesB[i][1].Y() - b0.Y();
+          const T qpX = b0.X() - a0.X();
+          const T qpY = b0.Y() - a0.Y();
+
+          // a = a0 + t * r and b = b0 + u * s meet where
+          // t = (qp x s) / (r x s) and u = (qp x r) / (r x s); the
+          // [0, 1] range tests compare the numerators against the
+          // denominator instead of dividing, so no branch guards the
+          // parallel case.
+          const T denom = rX * sY - rY * sX;
+          const T tNum = qpX * sY - qpY * sX;
+          const T uNum = qpX * rY - qpY * rX;
+          const T absDenom = std::abs(denom);
+
+          const bool hit =
+              (absDenom > static_cast<T>(_epsilon)) &
+              (tNum * denom >= T(0)) & (std::abs(tNum) <= absDenom) &
+              (uNum * denom >= T(0)) & (std::abs(uNum) <= absDenom);
+
+          const T t = tNum / (hit ? denom : T(1));
+          _points[i].Set(a0.X() + t * rX * hit, a0.Y() + t * rY * hit);
+          _intersect[i] = hit;
+          found += hit;
+        }
+        return found;
+      }
+
       /// \brief Get the length of the line
       /// \return The length of the line.
       public: T Length() const
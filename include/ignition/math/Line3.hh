@@ -18,6 +18,8 @@
 #define IGNITION_MATH_LINE3_HH_
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/config.hh>
 
@@ -229,6 +231,114 @@ namespace ignition
         return true;
       }
 
+      /// \brief Compute the shortest line between many segment pairs
+      /// in one call. Equivalent to calling Distance per pair; the
+      /// batch form keeps the solver inlined in one loop so
+      /// narrowphase sweeps avoid the per-call overhead.
+      /// \param[in] _linesA Array of first segments.
+      /// \param[in] _linesB Array of second segments.
+      /// \param[out] _results Destination array of _count shortest
+      /// lines; a pair with a degenerate segment leaves its entry
+      /// untouched.
+      /// \param[out] _valid Destination array of _count flags; an
+      /// element is set to 1 if a solution was found for the
+      /// corresponding pair and 0 otherwise.
+      /// \param[in] _count Number of segment pairs.
+      /// \param[in] _epsilon Error tolerance.
+      /// \return The number of pairs with a solution.
+      public: static size_t DistanceBatch(const Line3<T> *_linesA,
+                  const Line3<T> *_linesB, Line3<T> *_results,
+                  uint8_t *_valid, const size_t _count,
+                  const double _epsilon = 1e-6)
+      {
+        size_t found = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          _valid[i] = _linesA[i].Distance(_linesB[i], _results[i],
+              _epsilon) ? 1 : 0;
+          found += _valid[i];
+        }
+        return found;
+      }
+
+      /// \brief Compute the squared distance between many segment
+      /// pairs in one call, without building the connecting lines or
+      /// taking square roots. This is the right call for capsule
+      /// narrowphase tests, which compare the result against a squared
+      /// radius sum.
+      /// \param[in] _linesA Array of first segments.
+      /// \param[in] _linesB Array of second segments.
+      /// \param[out] _distSq Destination array of _count squared
+      /// distances; a pair with a degenerate segment gets MAX_D.
+      /// \param[in] _count Number of segment pairs.
+      /// \param[in] _epsilon Error tolerance.
+      /// \return The number of pairs with a solution.
+      public: static size_t DistanceSquaredBatch(const Line3<T> *_linesA,
+                  const Line3<T> *_linesB, double *_distSq,
+                  const size_t _count, const double _epsilon = 1e-6)
+      {
+        size_t found = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const Line3<T> &a = _linesA[i];
+          const Line3<T> &b = _linesB[i];
+          const Vector3<T> p13 = a[0] - b[0];
+          const Vector3<T> p43 = b[1] - b[0];
+          const Vector3<T> p21 = a[1] - a[0];
+
+          if ((std::abs(p43.X()) < _epsilon &&
+               std::abs(p43.Y()) < _epsilon &&
+               std::abs(p43.Z()) < _epsilon) ||
+              (std::abs(p21.X()) < _epsilon &&
+               std::abs(p21.Y()) < _epsilon &&
+               std::abs(p21.Z()) < _epsilon))
+          {
+            _distSq[i] = MAX_D;
+            continue;
+          }
+
+          const double d1343 = p13.Dot(p43);
+          const double d4321 = p43.Dot(p21);
+          const double d1321 = p13.Dot(p21);
+          const double d4343 = p43.Dot(p43);
+          const double d2121 = p21.Dot(p21);
+
+          const double denom = d2121 * d4343 - d4321 * d4321;
+
+          if (std::abs(denom) < _epsilon)
+          {
+            // Parallel segments: the same endpoint selection as
+            // Distance, on squared distances since squaring preserves
+            // the ordering.
+            const double d1 = (a[0] - b[0]).SquaredLength();
+            const double d2 = (a[0] - b[1]).SquaredLength();
+            const double d3 = (a[1] - b[0]).SquaredLength();
+            const double d4 = (a[1] - b[1]).SquaredLength();
+            double best = d4;
+            if (d1 <= d2 && d1 <= d3 && d1 <= d4)
+              best = d1;
+            else if (d2 <= d3 && d2 <= d4)
+              best = d2;
+            else if (d3 <= d4)
+              best = d3;
+            _distSq[i] = best;
+            ++found;
+            continue;
+          }
+
+          const double numer = d1343 * d4321 - d1321 * d4343;
+          const double mua = clamp(numer / denom, 0.0, 1.0);
+          const double mub =
+              clamp((d1343 + d4321 * mua) / d4343, 0.0, 1.0);
+
+          const Vector3<T> diff =
+              (a[0] + (p21 * mua)) - (b[0] + (p43 * mub));
+          _distSq[i] = diff.Dot(diff);
+          ++found;
+        }
+        return found;
+      }
+
       /// \brief Check if this line intersects the given line segment.
       /// \param[in] _line The line to check for intersection.
       /// \param[in] _epsilon The error bounds within which the intersection
@@ -312,6 +422,36 @@ namespace ignition
         return false;
       }
 
+      /// \brief Intersect many segment pairs in one call:
+      /// _linesA[i] against _linesB[i]. Equivalent to calling
+      /// Intersect per pair, kept in one loop like DistanceBatch; the
+      /// 3D test needs the parallel special case, so unlike
+      /// Line2::IntersectBatch it is not fully branchless.
+      /// \param[in] _linesA Array of _count segments.
+      /// \param[in] _linesB Array of _count segments.
+      /// \param[out] _points _points[i] is the intersection point of
+      /// pair i; only valid where _intersect[i] is 1.
+      /// \param[out] _intersect _intersect[i] is 1 if pair i
+      /// intersects and 0 otherwise.
+      /// \param[in] _count Number of segment pairs.
+      /// \param[in] _epsilon The error bounds within which the
+      /// intersection check reports true.
+      /// \return The number of intersecting pairs.
+      public: static size_t IntersectBatch(const Line3<T> *_linesA,
+                  const Line3<T> *_linesB, Vector3<T> *_points,
+                  uint8_t *_intersect, const size_t _count,
+                  const double _epsilon = 1e-6)
+      {
+        size_t found = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          _intersect[i] = _linesA[i].Intersect(_linesB[i], _points[i],
+              _epsilon) ? 1 : 0;
+          found += _intersect[i];
+        }
+        return found;
+      }
+
       /// \brief Check if the given point is between the start and end
       /// points of the line segment.
       /// \param[in] _pt Point to check.
@@ -698,6 +698,132 @@ namespace ignition
         return Vector3<T>(moment0, moment1, moment2);
       }
 
+      /// \brief Compute principal moments for an array of mass matrices.
+      ///
+      /// Validation pipelines that check many auto-generated bodies pay
+      /// the trig-heavy eigen decomposition once per body when calling
+      /// PrincipalMoments() in a loop. This batch form processes the
+      /// bodies in blocks: a first pass per block evaluates the cubic
+      /// characteristic polynomial coefficients, which is pure
+      /// arithmetic the compiler can vectorize, and the acos/cos root
+      /// extraction then runs only for the bodies that are not already
+      /// diagonal or degenerate.
+      /// \param[in] _matrices Array of mass matrices.
+      /// \param[out] _moments Destination array; must have room for
+      /// \p _count entries. Each entry matches what
+      /// PrincipalMoments(_tol) returns for the same matrix.
+      /// \param[in] _count Number of matrices.
+      /// \param[in] _tol Relative tolerance, as in PrincipalMoments().
+      public: static void BatchPrincipalMoments(
+                  const MassMatrix3<T> *_matrices, Vector3<T> *_moments,
+                  size_t _count, const T _tol = 1e-6)
+      {
+        static const size_t kBlock = 32;
+        T bs[kBlock];
+        T ps[kBlock];
+        T qs[kBlock];
+        T tols[kBlock];
+
+        for (size_t base = 0; base < _count; base += kBlock)
+        {
+          const size_t n = std::min(kBlock, _count - base);
+
+          // First pass: coefficients of the characteristic cubic, with
+          // the same naming as PrincipalMoments().
+          for (size_t i = 0; i < n; ++i)
+          {
+            const Vector3<T> Id = _matrices[base + i].DiagonalMoments();
+            const Vector3<T> Ip = _matrices[base + i].OffDiagonalMoments();
+            tols[i] = _tol * Id.Max();
+            const T b = Id.Sum();
+            const T c = Id[0]*Id[1] - std::pow(Ip[0], 2)
+                      + Id[0]*Id[2] - std::pow(Ip[1], 2)
+                      + Id[1]*Id[2] - std::pow(Ip[2], 2);
+            const T d = Id[0]*std::pow(Ip[2], 2)
+                      + Id[1]*std::pow(Ip[1], 2)
+                      + Id[2]*std::pow(Ip[0], 2)
+                      - Id[0]*Id[1]*Id[2]
+                      - 2*Ip[0]*Ip[1]*Ip[2];
+            bs[i] = b;
+            ps[i] = std::pow(b, 2) - 3*c;
+            qs[i] = 2*std::pow(b, 3) - 9*b*c - 27*d;
+          }
+
+          // Second pass: trig only where a decomposition is needed.
+          for (size_t i = 0; i < n; ++i)
+          {
+            const MassMatrix3<T> &m = _matrices[base + i];
+            if (m.OffDiagonalMoments().Equal(Vector3<T>::Zero, tols[i]))
+            {
+              _moments[base + i] = m.DiagonalMoments();
+              continue;
+            }
+            if (ps[i] < std::pow(tols[i], 2))
+            {
+              _moments[base + i] = bs[i] / 3.0 * Vector3<T>::One;
+              continue;
+            }
+
+            const T delta = acos(
+                clamp<T>(0.5 * qs[i] / std::pow(ps[i], 1.5), -1, 1));
+            const T twoSqrtP = 2*sqrt(ps[i]);
+            T moment0 = (bs[i] + twoSqrtP * cos(delta / 3.0)) / 3.0;
+            T moment1 =
+                (bs[i] + twoSqrtP * cos((delta + 2*IGN_PI)/3.0)) / 3.0;
+            T moment2 =
+                (bs[i] + twoSqrtP * cos((delta - 2*IGN_PI)/3.0)) / 3.0;
+            sort3(moment0, moment1, moment2);
+            _moments[base + i] = Vector3<T>(moment0, moment1, moment2);
+          }
+        }
+      }
+
+      /// \brief Check positive definiteness for an array of mass
+      /// matrices without any eigen decomposition.
+      ///
+      /// Each check evaluates the same leading principal minors as
+      /// IsPositive(), with the determinant expanded directly on the
+      /// stored moment vectors so no Matrix3 is constructed. Use this
+      /// when only validity is needed; it is orders of magnitude
+      /// cheaper than computing principal moments.
+      /// \param[in] _matrices Array of mass matrices.
+      /// \param[out] _positive Destination array; must have room for
+      /// \p _count entries. Each entry matches what
+      /// IsPositive(_tolerance) returns for the same matrix.
+      /// \param[in] _count Number of matrices.
+      /// \param[in] _tolerance The amount of error to accept, as in
+      /// IsPositive().
+      /// \return The number of positive definite matrices.
+      public: static size_t BatchIsPositive(
+                  const MassMatrix3<T> *_matrices, bool *_positive,
+                  size_t _count, const T _tolerance =
+                  IGN_MASSMATRIX3_DEFAULT_TOLERANCE<T>)
+      {
+        size_t positiveCount = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const MassMatrix3<T> &m = _matrices[i];
+          const Vector3<T> Id = m.DiagonalMoments();
+          const Vector3<T> Ip = m.OffDiagonalMoments();
+          const T epsilon = Epsilon(Id, _tolerance);
+          // Determinant of the symmetric moment of inertia matrix,
+          // expanded so the Matrix3 construction in Moi() is skipped.
+          const T det = Id[0]*Id[1]*Id[2]
+              + 2*Ip[0]*Ip[1]*Ip[2]
+              - Id[0]*std::pow(Ip[2], 2)
+              - Id[1]*std::pow(Ip[1], 2)
+              - Id[2]*std::pow(Ip[0], 2);
+          const bool positive = (m.Mass() > 0) &&
+              (Id[0] + epsilon > 0) &&
+              (Id[0] * Id[1] - std::pow(Ip[0], 2) + epsilon > 0) &&
+              (det + epsilon > 0);
+          _positive[i] = positive;
+          if (positive)
+            ++positiveCount;
+        }
+        return positiveCount;
+      }
+
       /// \brief Compute rotational offset of principal axes.
       /// \param[in] _tol Relative tolerance given by absolute value
       /// of _tol.
@@ -1274,6 +1400,215 @@ namespace ignition
 
     typedef MassMatrix3<double> MassMatrix3d;
     typedef MassMatrix3<float> MassMatrix3f;
+
+    /// \class IncrementalMoments MassMatrix3.hh ignition/math/MassMatrix3.hh
+    /// \brief Streaming moment-of-inertia estimation from point
+    /// samples.
+    ///
+    /// Estimating inertia from a sample stream by rebuilding a
+    /// MassMatrix3 and calling PrincipalMoments() per batch repeats
+    /// the whole second-moment sum and a trig-heavy eigen
+    /// decomposition at the sample rate. This accumulator keeps the
+    /// raw moment sums instead, so adding a sample is a rank-1 update
+    /// of nine accumulators, and refreshes the eigenvalues by
+    /// warm-starting Jacobi rotations from the previous principal
+    /// axes: between refreshes the matrix barely rotates, so the
+    /// warm-started matrix is nearly diagonal and one square-root
+    /// based sweep usually suffices — no acos/cos at all.
+    ///
+    /// Unlike MassMatrix3::PrincipalMoments(), the refreshed moments
+    /// keep their association with the tracked axes instead of being
+    /// re-sorted, so a moment cannot jump between axes from one
+    /// refresh to the next.
+    template<typename T>
+    class IncrementalMoments
+    {
+      /// \brief Add a point sample.
+      /// \param[in] _point Sample position.
+      /// \param[in] _mass Mass of the sample.
+      public: void Add(const Vector3<T> &_point, const T _mass = T(1))
+      {
+        this->mass += _mass;
+        this->first += _point * _mass;
+        this->diag += Vector3<T>(
+            _mass * _point.X() * _point.X(),
+            _mass * _point.Y() * _point.Y(),
+            _mass * _point.Z() * _point.Z());
+        this->offDiag += Vector3<T>(
+            _mass * _point.X() * _point.Y(),
+            _mass * _point.X() * _point.Z(),
+            _mass * _point.Y() * _point.Z());
+        ++this->count;
+      }
+
+      /// \brief Add a batch of equally weighted point samples.
+      /// \param[in] _points Array of _count sample positions.
+      /// \param[in] _count Number of samples.
+      /// \param[in] _mass Mass of each sample.
+      public: void Add(const Vector3<T> *_points, const size_t _count,
+                  const T _mass = T(1))
+      {
+        for (size_t i = 0; i < _count; ++i)
+          this->Add(_points[i], _mass);
+      }
+
+      /// \brief Get the number of samples added.
+      /// \return Number of samples.
+      public: size_t Count() const
+      {
+        return this->count;
+      }
+
+      /// \brief Get the total mass.
+      /// \return Sum of the sample masses.
+      public: T Mass() const
+      {
+        return this->mass;
+      }
+
+      /// \brief Get the center of mass of the samples.
+      /// \return The center of mass, or zero without samples.
+      public: Vector3<T> CenterOfMass() const
+      {
+        return this->mass <= T(0) ?
+            Vector3<T>::Zero : this->first / this->mass;
+      }
+
+      /// \brief Get the moment of inertia matrix about the current
+      /// center of mass.
+      /// \return The inertia matrix, zero without samples.
+      public: Matrix3<T> Moi() const
+      {
+        if (this->mass <= T(0))
+          return Matrix3<T>::Zero;
+
+        // Second moments about the center of mass by the parallel
+        // axis theorem, then I = trace(C) * identity - C.
+        const Vector3<T> c = this->CenterOfMass();
+        const T cxx = this->diag.X() - this->mass * c.X() * c.X();
+        const T cyy = this->diag.Y() - this->mass * c.Y() * c.Y();
+        const T czz = this->diag.Z() - this->mass * c.Z() * c.Z();
+        const T cxy = this->offDiag.X() - this->mass * c.X() * c.Y();
+        const T cxz = this->offDiag.Y() - this->mass * c.X() * c.Z();
+        const T cyz = this->offDiag.Z() - this->mass * c.Y() * c.Z();
+        return Matrix3<T>(cyy + czz, -cxy, -cxz,
+                          -cxy, cxx + czz, -cyz,
+                          -cxz, -cyz, cxx + cyy);
+      }
+
+      /// \brief Get the current estimate as a MassMatrix3, with the
+      /// inertia about the center of mass.
+      /// \return The mass matrix, zero without samples.
+      public: MassMatrix3<T> MassMatrix() const
+      {
+        const Matrix3<T> moi = this->Moi();
+        MassMatrix3<T> m;
+        m.SetMass(this->mass);
+        m.SetDiagonalMoments(
+            Vector3<T>(moi(0, 0), moi(1, 1), moi(2, 2)));
+        m.SetOffDiagonalMoments(
+            Vector3<T>(moi(0, 1), moi(0, 2), moi(1, 2)));
+        return m;
+      }
+
+      /// \brief Refresh and get the principal moments of inertia.
+      ///
+      /// Warm-starts from the axes of the previous refresh and applies
+      /// Jacobi rotations until the off-diagonal terms are below the
+      /// tolerance. The moments stay associated with the tracked axes;
+      /// sort a copy if ordered moments are needed.
+      /// \param[in] _tol Relative tolerance on the off-diagonal terms.
+      /// \return The principal moments, zero without samples.
+      public: Vector3<T> PrincipalMoments(const T _tol = 1e-6)
+      {
+        if (this->mass <= T(0))
+          return Vector3<T>::Zero;
+
+        // Rotate the inertia into the cached principal frame, where
+        // it is nearly diagonal after the first refresh.
+        Matrix3<T> a =
+            this->axes.Transposed() * this->Moi() * this->axes;
+
+        const T scale = std::max({std::abs(a(0, 0)), std::abs(a(1, 1)),
+            std::abs(a(2, 2)), T(1e-30)});
+        const T tol = std::abs(_tol) * scale;
+
+        // Cyclic Jacobi sweeps; each rotation zeroes one off-diagonal
+        // term with a square root, no trigonometry. A warm start
+        // converges in one sweep, a cold start within a few.
+        constexpr unsigned int kMaxSweeps = 16;
+        for (unsigned int sweep = 0; sweep < kMaxSweeps; ++sweep)
+        {
+          const T off = std::abs(a(0, 1)) + std::abs(a(0, 2)) +
+              std::abs(a(1, 2));
+          if (off <= tol)
+            break;
+
+          for (unsigned int p = 0; p < 2; ++p)
+          {
+            for (unsigned int q = p + 1; q < 3; ++q)
+            {
+              if (std::abs(a(p, q)) <= tol / 3)
+                continue;
+
+              const T theta = (a(q, q) - a(p, p)) / (2 * a(p, q));
+              const T t = (theta >= 0 ? 1 : -1) /
+                  (std::abs(theta) + std::sqrt(theta * theta + 1));
+              const T co = 1 / std::sqrt(t * t + 1);
+              const T si = t * co;
+
+              Matrix3<T> j = Matrix3<T>::Identity;
+              j(p, p) = co;
+              j(q, q) = co;
+              j(p, q) = si;
+              j(q, p) = -si;
+
+              a = j.Transposed() * a * j;
+              this->axes = this->axes * j;
+            }
+          }
+        }
+
+        return Vector3<T>(a(0, 0), a(1, 1), a(2, 2));
+      }
+
+      /// \brief Get the principal axes of the last PrincipalMoments()
+      /// refresh, as the rotation from the principal frame to the
+      /// sample frame.
+      /// \return The rotation; identity before the first refresh.
+      public: Quaternion<T> PrincipalAxes() const
+      {
+        return Quaternion<T>(this->axes);
+      }
+
+      /// \brief Forget all samples and the tracked axes.
+      public: void Reset()
+      {
+        *this = IncrementalMoments<T>();
+      }
+
+      /// \brief Total mass of the samples.
+      private: T mass = T(0);
+
+      /// \brief Number of samples.
+      private: size_t count = 0;
+
+      /// \brief Mass-weighted sum of the sample positions.
+      private: Vector3<T> first = Vector3<T>::Zero;
+
+      /// \brief Mass-weighted sums of x^2, y^2, z^2.
+      private: Vector3<T> diag = Vector3<T>::Zero;
+
+      /// \brief Mass-weighted sums of x*y, x*z, y*z.
+      private: Vector3<T> offDiag = Vector3<T>::Zero;
+
+      /// \brief Principal axes of the last refresh; columns rotate the
+      /// principal frame into the sample frame.
+      private: Matrix3<T> axes = Matrix3<T>::Identity;
+    };
+
+    typedef IncrementalMoments<double> IncrementalMomentsd;
+    typedef IncrementalMoments<float> IncrementalMomentsf;
     }
   }
 }
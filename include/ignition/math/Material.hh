@@ -17,6 +17,7 @@
 #ifndef IGNITION_MATH_MATERIAL_HH_
 #define IGNITION_MATH_MATERIAL_HH_
 
+#include <cstddef>
 #include <limits>
 #include <map>
 #include <string>
@@ -97,6 +98,25 @@ namespace ignition
       /// material type and the map's value is the material object.
       public: static const std::map<MaterialType, Material> &Predefined();
 
+      /// \brief Get the density of a built-in material as a direct
+      /// table read, with no map lookup or Material construction.
+      /// Intended for inner loops that resolve densities from
+      /// material ids, such as particle simulations.
+      /// \param[in] _type Built-in type to look up.
+      /// \return Density of the material in kg/m^3, or -1 for
+      /// MaterialType::UNKNOWN_MATERIAL and out-of-range values.
+      public: static double Density(const MaterialType _type);
+
+      /// \brief Fill an array of densities from an array of material
+      /// ids. Equivalent to calling Density(MaterialType) per
+      /// element.
+      /// \param[in] _types Array of material ids.
+      /// \param[in] _count Number of elements.
+      /// \param[out] _densities Destination array of _count
+      /// densities in kg/m^3.
+      public: static void FillDensities(const MaterialType *_types,
+                  const std::size_t _count, double *_densities);
+
       /// \brief Set this Material to the built-in Material with
       /// the nearest density value within _epsilon. If a built-in material
       /// could not be found, then this Material is not changed.
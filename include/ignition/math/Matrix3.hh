@@ -485,6 +485,78 @@ namespace ignition
           this->data[0][2], this->data[1][2], this->data[2][2]);
       }
 
+      /// \brief Multiply an array of matrix pairs elementwise,
+      /// _out[i] = _a[i] * _b[i]. Equivalent to operator* per pair,
+      /// but the loop body is straight-line loads, multiplies and one
+      /// store, so the compiler vectorizes across matrices and bulk
+      /// rotation composition streams through cache.
+      /// \param[in] _a Array of left factors.
+      /// \param[in] _b Array of right factors.
+      /// \param[out] _out Destination array; must hold _n elements
+      /// and may alias _a or _b.
+      /// \param[in] _n Number of matrix pairs.
+      public: static void MultiplyBatch(const Matrix3<T> *_a,
+                  const Matrix3<T> *_b, Matrix3<T> *_out, size_t _n)
+      {
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const Matrix3<T> &a = _a[i];
+          const Matrix3<T> &b = _b[i];
+          const T a00 = a(0, 0), a01 = a(0, 1), a02 = a(0, 2);
+          const T a10 = a(1, 0), a11 = a(1, 1), a12 = a(1, 2);
+          const T a20 = a(2, 0), a21 = a(2, 1), a22 = a(2, 2);
+          const T b00 = b(0, 0), b01 = b(0, 1), b02 = b(0, 2);
+          const T b10 = b(1, 0), b11 = b(1, 1), b12 = b(1, 2);
+          const T b20 = b(2, 0), b21 = b(2, 1), b22 = b(2, 2);
+          _out[i].Set(
+              a00*b00 + a01*b10 + a02*b20,
+              a00*b01 + a01*b11 + a02*b21,
+              a00*b02 + a01*b12 + a02*b22,
+              a10*b00 + a11*b10 + a12*b20,
+              a10*b01 + a11*b11 + a12*b21,
+              a10*b02 + a11*b12 + a12*b22,
+              a20*b00 + a21*b10 + a22*b20,
+              a20*b01 + a21*b11 + a22*b21,
+              a20*b02 + a21*b12 + a22*b22);
+        }
+      }
+
+      /// \brief Multiply an array of matrix pairs elementwise with
+      /// the left factor transposed, _out[i] = _a[i].Transposed() *
+      /// _b[i], without materializing the transpose. For rotation
+      /// matrices this composes with the inverse of _a[i], the common
+      /// relative-rotation operation.
+      /// \param[in] _a Array of left factors, used transposed.
+      /// \param[in] _b Array of right factors.
+      /// \param[out] _out Destination array; must hold _n elements
+      /// and may alias _a or _b.
+      /// \param[in] _n Number of matrix pairs.
+      public: static void TransposedMultiplyBatch(const Matrix3<T> *_a,
+                  const Matrix3<T> *_b, Matrix3<T> *_out, size_t _n)
+      {
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const Matrix3<T> &a = _a[i];
+          const Matrix3<T> &b = _b[i];
+          const T a00 = a(0, 0), a01 = a(0, 1), a02 = a(0, 2);
+          const T a10 = a(1, 0), a11 = a(1, 1), a12 = a(1, 2);
+          const T a20 = a(2, 0), a21 = a(2, 1), a22 = a(2, 2);
+          const T b00 = b(0, 0), b01 = b(0, 1), b02 = b(0, 2);
+          const T b10 = b(1, 0), b11 = b(1, 1), b12 = b(1, 2);
+          const T b20 = b(2, 0), b21 = b(2, 1), b22 = b(2, 2);
+          _out[i].Set(
+              a00*b00 + a10*b10 + a20*b20,
+              a00*b01 + a10*b11 + a20*b21,
+              a00*b02 + a10*b12 + a20*b22,
+              a01*b00 + a11*b10 + a21*b20,
+              a01*b01 + a11*b11 + a21*b21,
+              a01*b02 + a11*b12 + a21*b22,
+              a02*b00 + a12*b10 + a22*b20,
+              a02*b01 + a12*b11 + a22*b21,
+              a02*b02 + a12*b12 + a22*b22);
+        }
+      }
+
       /// \brief Stream insertion operator
       /// \param[in] _out Output stream
       /// \param[in] _m Matrix to output
@@ -544,6 +616,18 @@ namespace ignition
     typedef Matrix3<int> Matrix3i;
     typedef Matrix3<double> Matrix3d;
     typedef Matrix3<float> Matrix3f;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Matrix3<int>;
+    extern template class Matrix3<double>;
+    extern template class Matrix3<float>;
+#endif
     }
   }
 }
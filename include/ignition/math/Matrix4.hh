@@ -18,6 +18,7 @@
 #define IGNITION_MATH_MATRIX4_HH_
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Matrix3.hh>
@@ -569,6 +570,83 @@ namespace ignition
         return r;
       }
 
+      /// \brief Return the inverse of this matrix assuming it is a
+      /// rigid transform: an orthonormal rotation in the upper left 3x3
+      /// block, a translation in the last column and (0, 0, 0, 1) in the
+      /// bottom row. The inverse is then the transposed rotation and the
+      /// negated, rotated translation, which is roughly six times
+      /// cheaper than the cofactor expansion in Inverse(). The result is
+      /// undefined for matrices that scale or shear; use InverseAffine()
+      /// or Inverse() for those.
+      /// \return Inverse of this matrix.
+      public: Matrix4<T> InverseRigid() const
+      {
+        const T tx = this->data[0][3];
+        const T ty = this->data[1][3];
+        const T tz = this->data[2][3];
+
+        return Matrix4<T>(
+            this->data[0][0], this->data[1][0], this->data[2][0],
+            -(this->data[0][0]*tx + this->data[1][0]*ty +
+              this->data[2][0]*tz),
+            this->data[0][1], this->data[1][1], this->data[2][1],
+            -(this->data[0][1]*tx + this->data[1][1]*ty +
+              this->data[2][1]*tz),
+            this->data[0][2], this->data[1][2], this->data[2][2],
+            -(this->data[0][2]*tx + this->data[1][2]*ty +
+              this->data[2][2]*tz),
+            0, 0, 0, 1);
+      }
+
+      /// \brief Return the inverse of this matrix assuming it is an
+      /// affine transform: an invertible upper left 3x3 block, a
+      /// translation in the last column and (0, 0, 0, 1) in the bottom
+      /// row. Only the 3x3 block is inverted, which is considerably
+      /// cheaper than the full 4x4 cofactor expansion in Inverse().
+      /// Like Inverse(), this function does not check that the matrix is
+      /// invertible.
+      /// \return Inverse of this matrix.
+      public: Matrix4<T> InverseAffine() const
+      {
+        // Cofactors of the first column of the 3x3 block, reused for
+        // the determinant.
+        const T c00 = this->data[1][1]*this->data[2][2] -
+                      this->data[1][2]*this->data[2][1];
+        const T c10 = this->data[1][2]*this->data[2][0] -
+                      this->data[1][0]*this->data[2][2];
+        const T c20 = this->data[1][0]*this->data[2][1] -
+                      this->data[1][1]*this->data[2][0];
+
+        const T invDet = 1 / (this->data[0][0]*c00 +
+            this->data[0][1]*c10 + this->data[0][2]*c20);
+
+        const T r00 = c00 * invDet;
+        const T r01 = (this->data[0][2]*this->data[2][1] -
+                       this->data[0][1]*this->data[2][2]) * invDet;
+        const T r02 = (this->data[0][1]*this->data[1][2] -
+                       this->data[0][2]*this->data[1][1]) * invDet;
+        const T r10 = c10 * invDet;
+        const T r11 = (this->data[0][0]*this->data[2][2] -
+                       this->data[0][2]*this->data[2][0]) * invDet;
+        const T r12 = (this->data[0][2]*this->data[1][0] -
+                       this->data[0][0]*this->data[1][2]) * invDet;
+        const T r20 = c20 * invDet;
+        const T r21 = (this->data[0][1]*this->data[2][0] -
+                       this->data[0][0]*this->data[2][1]) * invDet;
+        const T r22 = (this->data[0][0]*this->data[1][1] -
+                       this->data[0][1]*this->data[1][0]) * invDet;
+
+        const T tx = this->data[0][3];
+        const T ty = this->data[1][3];
+        const T tz = this->data[2][3];
+
+        return Matrix4<T>(
+            r00, r01, r02, -(r00*tx + r01*ty + r02*tz),
+            r10, r11, r12, -(r10*tx + r11*ty + r12*tz),
+            r20, r21, r22, -(r20*tx + r21*ty + r22*tz),
+            0, 0, 0, 1);
+      }
+
       /// \brief Transpose this matrix.
       public: void Transpose()
       {
@@ -731,6 +809,153 @@ namespace ignition
             this->data[2][2]*_vec.Z() + this->data[2][3]);
       }
 
+      /// \brief Transform an array of points by this matrix.
+      /// Equivalent to _out[i] = (*this) * _in[i], but the matrix entries
+      /// are loaded into locals once and the loop body is branch free, so
+      /// per-vertex overhead and repeated matrix loads are avoided.
+      /// \param[in] _in Array of points to transform.
+      /// \param[out] _out Destination array; must hold _n elements and may
+      /// alias _in.
+      /// \param[in] _n Number of points.
+      public: void TransformPoints(const Vector3<T> *_in, Vector3<T> *_out,
+                  size_t _n) const
+      {
+        const T r00 = this->data[0][0], r01 = this->data[0][1],
+                r02 = this->data[0][2], t0 = this->data[0][3];
+        const T r10 = this->data[1][0], r11 = this->data[1][1],
+                r12 = this->data[1][2], t1 = this->data[1][3];
+        const T r20 = this->data[2][0], r21 = this->data[2][1],
+                r22 = this->data[2][2], t2 = this->data[2][3];
+
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const T x = _in[i].X(), y = _in[i].Y(), z = _in[i].Z();
+          _out[i].Set(r00*x + r01*y + r02*z + t0,
+                      r10*x + r11*y + r12*z + t1,
+                      r20*x + r21*y + r22*z + t2);
+        }
+      }
+
+      /// \brief Transform an array of directions by this matrix.
+      /// Like TransformPoints, but with an implicit w=0 so the translation
+      /// column is ignored; use this for normals and velocity vectors.
+      /// \param[in] _in Array of directions to transform.
+      /// \param[out] _out Destination array; must hold _n elements and may
+      /// alias _in.
+      /// \param[in] _n Number of directions.
+      public: void TransformVectors(const Vector3<T> *_in, Vector3<T> *_out,
+                  size_t _n) const
+      {
+        const T r00 = this->data[0][0], r01 = this->data[0][1],
+                r02 = this->data[0][2];
+        const T r10 = this->data[1][0], r11 = this->data[1][1],
+                r12 = this->data[1][2];
+        const T r20 = this->data[2][0], r21 = this->data[2][1],
+                r22 = this->data[2][2];
+
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const T x = _in[i].X(), y = _in[i].Y(), z = _in[i].Z();
+          _out[i].Set(r00*x + r01*y + r02*z,
+                      r10*x + r11*y + r12*z,
+                      r20*x + r21*y + r22*z);
+        }
+      }
+
+      /// \brief Clip half-space flags reported by ProjectPoints. A
+      /// flag is set when the point lies outside the corresponding
+      /// clip plane; a point with no flags set is inside the view
+      /// volume.
+      public: enum ClipFlags : uint8_t
+      {
+        /// \brief x < -w
+        CLIP_LEFT   = 1,
+
+        /// \brief x > w
+        CLIP_RIGHT  = 2,
+
+        /// \brief y < -w
+        CLIP_BOTTOM = 4,
+
+        /// \brief y > w
+        CLIP_TOP    = 8,
+
+        /// \brief z < -w
+        CLIP_NEAR   = 16,
+
+        /// \brief z > w
+        CLIP_FAR    = 32
+      };
+
+      /// \brief Project an array of points by this matrix, treated as
+      /// a projection matrix, in one fused pass: the homogeneous
+      /// multiply, the perspective divide and the viewport scale that
+      /// a software projection stage would otherwise run as separate
+      /// sweeps. The matrix entries and viewport factors are loaded
+      /// once and the loop body is branch free.
+      /// \param[in] _in Array of points to project.
+      /// \param[out] _out Destination array; must hold _n elements and
+      /// may alias _in. Each element receives the window x and y of
+      /// the point (x right, y down from the viewport's top left
+      /// corner) and the depth in [0, 1] mapped from normalized device
+      /// z. The values are only meaningful where no clip flag is set;
+      /// clipped points would need the clipped primitive re-projected.
+      /// \param[out] _flags Destination array of _n clip flag sets,
+      /// combined from ClipFlags. Zero means inside the view volume.
+      /// \param[in] _n Number of points.
+      /// \param[in] _viewportLeft Window x of the viewport's left edge.
+      /// \param[in] _viewportTop Window y of the viewport's top edge.
+      /// \param[in] _viewportWidth Viewport width in pixels.
+      /// \param[in] _viewportHeight Viewport height in pixels.
+      public: void ProjectPoints(const Vector3<T> *_in, Vector3<T> *_out,
+                  uint8_t *_flags, size_t _n,
+                  const T _viewportLeft, const T _viewportTop,
+                  const T _viewportWidth, const T _viewportHeight) const
+      {
+        const T r00 = this->data[0][0], r01 = this->data[0][1],
+                r02 = this->data[0][2], r03 = this->data[0][3];
+        const T r10 = this->data[1][0], r11 = this->data[1][1],
+                r12 = this->data[1][2], r13 = this->data[1][3];
+        const T r20 = this->data[2][0], r21 = this->data[2][1],
+                r22 = this->data[2][2], r23 = this->data[2][3];
+        const T r30 = this->data[3][0], r31 = this->data[3][1],
+                r32 = this->data[3][2], r33 = this->data[3][3];
+
+        const T halfWidth = _viewportWidth / 2;
+        const T halfHeight = _viewportHeight / 2;
+
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const T x = _in[i].X(), y = _in[i].Y(), z = _in[i].Z();
+
+          // Homogeneous multiply with implicit w = 1.
+          const T cx = r00*x + r01*y + r02*z + r03;
+          const T cy = r10*x + r11*y + r12*z + r13;
+          const T cz = r20*x + r21*y + r22*z + r23;
+          const T cw = r30*x + r31*y + r32*z + r33;
+
+          _flags[i] = static_cast<uint8_t>(
+              (cx < -cw ? CLIP_LEFT : 0) |
+              (cx > cw ? CLIP_RIGHT : 0) |
+              (cy < -cw ? CLIP_BOTTOM : 0) |
+              (cy > cw ? CLIP_TOP : 0) |
+              (cz < -cw ? CLIP_NEAR : 0) |
+              (cz > cw ? CLIP_FAR : 0));
+
+          // Perspective divide and viewport scale. A w of zero cannot
+          // happen for unclipped points; produce zeros instead of a
+          // division fault for clipped ones.
+          const T invW = cw != T(0) ? T(1) / cw : T(0);
+          const T ndcX = cx * invW;
+          const T ndcY = cy * invW;
+          const T ndcZ = cz * invW;
+
+          _out[i].Set(_viewportLeft + (ndcX + 1) * halfWidth,
+                      _viewportTop + (1 - ndcY) * halfHeight,
+                      (ndcZ + 1) / 2);
+        }
+      }
+
       /// \brief Get the value at the specified row, column index
       /// \param[in] _col The column index. Index values are clamped to a
       /// range of [0, 3].
@@ -918,9 +1143,67 @@ namespace ignition
         0, 0, 0, 0,
         0, 0, 0, 0);
 
+#if defined(IGNITION_MATH_VECTOR3_SIMD_SSE) || \
+    defined(IGNITION_MATH_VECTOR3_SIMD_NEON)
+    /// \brief Float-specialized matrix multiply: each result row is
+    /// accumulated as four 4-wide multiply-adds over the rows of the
+    /// right operand, the classic broadcast formulation. The operation
+    /// order matches the generic expression, so the results agree to
+    /// rounding.
+    template<>
+    inline Matrix4<float> Matrix4<float>::operator*(
+        const Matrix4<float> &_m2) const
+    {
+      Matrix4<float> result;
+      const float *a = &this->data[0][0];
+      const float *b = &_m2.data[0][0];
+      float *out = &result.data[0][0];
+#ifdef IGNITION_MATH_VECTOR3_SIMD_SSE
+      const __m128 b0 = _mm_loadu_ps(b);
+      const __m128 b1 = _mm_loadu_ps(b + 4);
+      const __m128 b2 = _mm_loadu_ps(b + 8);
+      const __m128 b3 = _mm_loadu_ps(b + 12);
+      for (int row = 0; row < 4; ++row)
+      {
+        __m128 acc = _mm_mul_ps(_mm_set1_ps(a[4 * row]), b0);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[4 * row + 1]), b1));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[4 * row + 2]), b2));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a[4 * row + 3]), b3));
+        _mm_storeu_ps(out + 4 * row, acc);
+      }
+#else
+      const float32x4_t b0 = vld1q_f32(b);
+      const float32x4_t b1 = vld1q_f32(b + 4);
+      const float32x4_t b2 = vld1q_f32(b + 8);
+      const float32x4_t b3 = vld1q_f32(b + 12);
+      for (int row = 0; row < 4; ++row)
+      {
+        float32x4_t acc = vmulq_n_f32(b0, a[4 * row]);
+        acc = vmlaq_n_f32(acc, b1, a[4 * row + 1]);
+        acc = vmlaq_n_f32(acc, b2, a[4 * row + 2]);
+        acc = vmlaq_n_f32(acc, b3, a[4 * row + 3]);
+        vst1q_f32(out + 4 * row, acc);
+      }
+#endif
+      return result;
+    }
+#endif
+
     typedef Matrix4<int> Matrix4i;
     typedef Matrix4<double> Matrix4d;
     typedef Matrix4<float> Matrix4f;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Matrix4<int>;
+    extern template class Matrix4<double>;
+    extern template class Matrix4<float>;
+#endif
     }
   }
 }
@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_MATRIXN_HH_
+#define IGNITION_MATH_MATRIXN_HH_
+
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class MatrixN MatrixN.hh ignition/math/MatrixN.hh
+    /// \brief A fixed-size Rows x Cols matrix for the dimensions the
+    /// Matrix3/Matrix4 family stops short of, such as 6x6 spatial
+    /// inertia and Jacobian blocks.
+    ///
+    /// All dimensions are template parameters, so every loop bound is a
+    /// compile-time constant and the multiply and solve kernels unroll
+    /// and vectorize without any runtime size checks or heap traffic.
+    /// A column vector is simply MatrixN<T, R, 1>.
+    template<typename T, std::size_t Rows, std::size_t Cols>
+    class MatrixN
+    {
+      static_assert(Rows > 0 && Cols > 0,
+          "MatrixN dimensions must be positive");
+
+      /// \brief Constructor. All entries start at zero.
+      public: MatrixN()
+      {
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            this->data[row][col] = static_cast<T>(0);
+      }
+
+      /// \brief Constructor from Rows * Cols values in row-major order.
+      /// \param[in] _first Row 0, Col 0 value.
+      /// \param[in] _rest The remaining values.
+      public: template<typename... Args>
+              MatrixN(T _first, Args... _rest)
+      {
+        static_assert(1 + sizeof...(Args) == Rows * Cols,
+            "MatrixN requires exactly Rows * Cols values");
+        const T values[Rows * Cols] = {_first, static_cast<T>(_rest)...};
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            this->data[row][col] = values[row * Cols + col];
+      }
+
+      /// \brief Get the identity matrix. Only defined for square
+      /// dimensions.
+      /// \return The identity matrix.
+      public: static MatrixN<T, Rows, Cols> Identity()
+      {
+        static_assert(Rows == Cols,
+            "Identity requires a square MatrixN");
+        MatrixN<T, Rows, Cols> result;
+        for (std::size_t i = 0; i < Rows; ++i)
+          result.data[i][i] = static_cast<T>(1);
+        return result;
+      }
+
+      /// \brief Get the number of rows.
+      /// \return The row count.
+      public: static constexpr std::size_t RowCount()
+      {
+        return Rows;
+      }
+
+      /// \brief Get the number of columns.
+      /// \return The column count.
+      public: static constexpr std::size_t ColCount()
+      {
+        return Cols;
+      }
+
+      /// \brief Get a matrix value.
+      /// \param[in] _row The row index, clamped to the valid range.
+      /// \param[in] _col The column index, clamped to the valid range.
+      /// \return The value at (_row, _col).
+      public: inline const T &operator()(const std::size_t _row,
+                  const std::size_t _col) const
+      {
+        return this->data[clamp(_row, IGN_ZERO_SIZE_T, Rows - 1)]
+                         [clamp(_col, IGN_ZERO_SIZE_T, Cols - 1)];
+      }
+
+      /// \brief Get a mutable matrix value.
+      /// \param[in] _row The row index, clamped to the valid range.
+      /// \param[in] _col The column index, clamped to the valid range.
+      /// \return The value at (_row, _col).
+      public: inline T &operator()(const std::size_t _row,
+                  const std::size_t _col)
+      {
+        return this->data[clamp(_row, IGN_ZERO_SIZE_T, Rows - 1)]
+                         [clamp(_col, IGN_ZERO_SIZE_T, Cols - 1)];
+      }
+
+      /// \brief Addition operator.
+      /// \param[in] _m Matrix to add.
+      /// \return The element-wise sum.
+      public: MatrixN<T, Rows, Cols> operator+(
+                  const MatrixN<T, Rows, Cols> &_m) const
+      {
+        MatrixN<T, Rows, Cols> result;
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            result.data[row][col] = this->data[row][col] + _m.data[row][col];
+        return result;
+      }
+
+      /// \brief Subtraction operator.
+      /// \param[in] _m Matrix to subtract.
+      /// \return The element-wise difference.
+      public: MatrixN<T, Rows, Cols> operator-(
+                  const MatrixN<T, Rows, Cols> &_m) const
+      {
+        MatrixN<T, Rows, Cols> result;
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            result.data[row][col] = this->data[row][col] - _m.data[row][col];
+        return result;
+      }
+
+      /// \brief Scalar multiplication operator.
+      /// \param[in] _s The scalar.
+      /// \return This matrix scaled by _s.
+      public: MatrixN<T, Rows, Cols> operator*(const T &_s) const
+      {
+        MatrixN<T, Rows, Cols> result;
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            result.data[row][col] = this->data[row][col] * _s;
+        return result;
+      }
+
+      /// \brief Matrix multiplication operator. The inner dimension is
+      /// checked at compile time.
+      /// \param[in] _m The right-hand matrix.
+      /// \return The Rows x OtherCols product.
+      public: template<std::size_t OtherCols>
+              MatrixN<T, Rows, OtherCols> operator*(
+                  const MatrixN<T, Cols, OtherCols> &_m) const
+      {
+        MatrixN<T, Rows, OtherCols> result;
+        for (std::size_t row = 0; row < Rows; ++row)
+        {
+          for (std::size_t k = 0; k < Cols; ++k)
+          {
+            const T lhs = this->data[row][k];
+            for (std::size_t col = 0; col < OtherCols; ++col)
+              result(row, col) += lhs * _m(k, col);
+          }
+        }
+        return result;
+      }
+
+      /// \brief Get the transpose.
+      /// \return The Cols x Rows transpose of this matrix.
+      public: MatrixN<T, Cols, Rows> Transposed() const
+      {
+        MatrixN<T, Cols, Rows> result;
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            result(col, row) = this->data[row][col];
+        return result;
+      }
+
+      /// \brief Compute the lower-triangular Cholesky factor L with
+      /// this = L * L^T. Only defined for square dimensions, and only
+      /// succeeds when this matrix is symmetric positive definite.
+      /// \param[out] _lower The Cholesky factor; only valid on success.
+      /// \return True if the factorization succeeded.
+      public: bool Cholesky(MatrixN<T, Rows, Cols> &_lower) const
+      {
+        static_assert(Rows == Cols,
+            "Cholesky requires a square MatrixN");
+        _lower = MatrixN<T, Rows, Cols>();
+        for (std::size_t row = 0; row < Rows; ++row)
+        {
+          for (std::size_t col = 0; col <= row; ++col)
+          {
+            T sum = this->data[row][col];
+            for (std::size_t k = 0; k < col; ++k)
+              sum -= _lower.data[row][k] * _lower.data[col][k];
+
+            if (row == col)
+            {
+              if (sum <= static_cast<T>(0))
+                return false;
+              _lower.data[row][col] = static_cast<T>(std::sqrt(sum));
+            }
+            else
+            {
+              _lower.data[row][col] = sum / _lower.data[col][col];
+            }
+          }
+        }
+        return true;
+      }
+
+      /// \brief Solve this * x = b for a symmetric positive definite
+      /// matrix via Cholesky factorization plus forward and back
+      /// substitution, each column of _b independently.
+      /// \param[in] _b The right-hand side.
+      /// \param[out] _x The solution; only valid on success.
+      /// \return True unless this matrix is not positive definite.
+      public: template<std::size_t BCols>
+              bool SolveSPD(const MatrixN<T, Rows, BCols> &_b,
+                  MatrixN<T, Rows, BCols> &_x) const
+      {
+        MatrixN<T, Rows, Cols> lower;
+        if (!this->Cholesky(lower))
+          return false;
+
+        for (std::size_t col = 0; col < BCols; ++col)
+        {
+          // Forward substitution: L * y = b.
+          T y[Rows];
+          for (std::size_t row = 0; row < Rows; ++row)
+          {
+            T sum = _b(row, col);
+            for (std::size_t k = 0; k < row; ++k)
+              sum -= lower.data[row][k] * y[k];
+            y[row] = sum / lower.data[row][row];
+          }
+
+          // Back substitution: L^T * x = y.
+          for (std::size_t row = Rows; row > 0;)
+          {
+            --row;
+            T sum = y[row];
+            for (std::size_t k = row + 1; k < Rows; ++k)
+              sum -= lower.data[k][row] * _x(k, col);
+            _x(row, col) = sum / lower.data[row][row];
+          }
+        }
+        return true;
+      }
+
+      /// \brief Invert a symmetric positive definite matrix by solving
+      /// against the identity.
+      /// \param[out] _inverse The inverse; only valid on success.
+      /// \return True unless this matrix is not positive definite.
+      public: bool InverseSPD(MatrixN<T, Rows, Cols> &_inverse) const
+      {
+        return this->SolveSPD(Identity(), _inverse);
+      }
+
+      /// \brief Equality test with tolerance.
+      /// \param[in] _m The matrix to compare against.
+      /// \param[in] _tol Equality tolerance.
+      /// \return True if each element difference is within _tol.
+      public: bool Equal(const MatrixN<T, Rows, Cols> &_m,
+                  const T &_tol) const
+      {
+        for (std::size_t row = 0; row < Rows; ++row)
+          for (std::size_t col = 0; col < Cols; ++col)
+            if (!equal<T>(this->data[row][col], _m.data[row][col], _tol))
+              return false;
+        return true;
+      }
+
+      /// \brief Equality operator.
+      /// \param[in] _m The matrix to compare against.
+      /// \return True if equal (using the default tolerance of 1e-6).
+      public: bool operator==(const MatrixN<T, Rows, Cols> &_m) const
+      {
+        return this->Equal(_m, static_cast<T>(1e-6));
+      }
+
+      /// \brief Inequality operator.
+      /// \param[in] _m The matrix to compare against.
+      /// \return True if not equal (using the default tolerance of
+      /// 1e-6).
+      public: bool operator!=(const MatrixN<T, Rows, Cols> &_m) const
+      {
+        return !(*this == _m);
+      }
+
+      /// \brief Stream insertion operator.
+      /// \param[in] _out Output stream.
+      /// \param[in] _m Matrix to output.
+      /// \return The stream.
+      public: friend std::ostream &operator<<(std::ostream &_out,
+                  const MatrixN<T, Rows, Cols> &_m)
+      {
+        for (std::size_t row = 0; row < Rows; ++row)
+        {
+          for (std::size_t col = 0; col < Cols; ++col)
+          {
+            if (row != 0 || col != 0)
+              _out << " ";
+            _out << precision(_m(row, col), 6);
+          }
+        }
+        return _out;
+      }
+
+      /// \brief The matrix entries in row-major order.
+      private: T data[Rows][Cols];
+    };
+
+    template<std::size_t Rows, std::size_t Cols>
+    using MatrixNd = MatrixN<double, Rows, Cols>;
+    template<std::size_t Rows, std::size_t Cols>
+    using MatrixNf = MatrixN<float, Rows, Cols>;
+
+    typedef MatrixN<double, 6, 6> Matrix6d;
+    typedef MatrixN<float, 6, 6> Matrix6f;
+    typedef MatrixN<double, 6, 1> Vector6d;
+    typedef MatrixN<float, 6, 1> Vector6f;
+    }
+  }
+}
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_MEMORYPOOL_HH_
+#define IGNITION_MATH_MEMORYPOOL_HH_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief A fixed-size object pool shared by all instances of one
+    /// type.
+    ///
+    /// Classes that heap-allocate small private data per instance pay
+    /// a global allocator round trip on every construction, and
+    /// instances created in a burst end up scattered across the heap.
+    /// The pool carves storage out of large slabs instead and hands
+    /// out slots from a free list, so allocation is a pointer pop
+    /// under a short lock and consecutive allocations from a fresh
+    /// slab are contiguous in memory. Freed slots are recycled; slabs
+    /// are only released when the pool is destroyed at program exit.
+    ///
+    /// Give a class pooled storage by routing its class-level
+    /// operator new and delete through Instance():
+    ///
+    /// \code
+    /// public: static void *operator new(std::size_t)
+    /// {
+    ///   return MemoryPool<MyPrivate>::Instance().Allocate();
+    /// }
+    ///
+    /// public: static void operator delete(void *_ptr)
+    /// {
+    ///   MemoryPool<MyPrivate>::Instance().Deallocate(_ptr);
+    /// }
+    /// \endcode
+    template<typename T>
+    class MemoryPool
+    {
+      /// \brief Get the shared pool for T, creating it on first use.
+      ///
+      /// The pool is intentionally leaked: adopters override the class
+      /// operator delete, so a static or global object destroyed after
+      /// a function-local pool would return its slot to a dead pool.
+      /// The slabs are reachable until exit, so the leak is benign.
+      /// \return The pool singleton.
+      public: static MemoryPool<T> &Instance()
+      {
+        static auto *pool = new MemoryPool<T>;
+        return *pool;
+      }
+
+      /// \brief Get one uninitialized slot of sizeof(T) bytes with the
+      /// alignment of T. Thread safe.
+      /// \return Pointer to the slot. Never null; a new slab is
+      /// allocated when the free list is empty.
+      public: void *Allocate()
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (nullptr == this->freeList)
+          this->Grow();
+        Slot *slot = this->freeList;
+        this->freeList = slot->next;
+        return slot;
+      }
+
+      /// \brief Return a slot to the pool. Thread safe.
+      /// \param[in] _ptr Pointer previously returned by Allocate().
+      /// A nullptr is ignored.
+      public: void Deallocate(void *_ptr)
+      {
+        if (nullptr == _ptr)
+          return;
+        std::lock_guard<std::mutex> lock(this->mutex);
+        Slot *slot = static_cast<Slot *>(_ptr);
+        slot->next = this->freeList;
+        this->freeList = slot;
+      }
+
+      /// \brief Get the number of slots the pool has carved out so
+      /// far, free or in use.
+      /// \return The slot capacity.
+      public: size_t Capacity() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->slabs.size() * kSlabSlots;
+      }
+
+      /// \brief One pool slot: raw storage for a T, doubling as a
+      /// free-list link while unused.
+      private: union Slot
+      {
+        /// \brief Next free slot, valid only while on the free list.
+        Slot *next;
+
+        /// \brief The object storage.
+        alignas(T) unsigned char storage[sizeof(T)];
+      };
+
+      /// \brief Slots carved out per slab.
+      private: static constexpr size_t kSlabSlots = 256;
+
+      /// \brief Allocate one more slab and push its slots onto the
+      /// free list, keeping them in address order so a burst of
+      /// allocations comes out contiguous. The caller must hold the
+      /// mutex.
+      private: void Grow()
+      {
+        this->slabs.push_back(
+            std::unique_ptr<Slot[]>(new Slot[kSlabSlots]));
+        Slot *slab = this->slabs.back().get();
+        for (size_t i = kSlabSlots; i > 0; --i)
+        {
+          slab[i - 1].next = this->freeList;
+          this->freeList = &slab[i - 1];
+        }
+      }
+
+      /// \brief Constructor.
+      private: MemoryPool() = default;
+
+      /// \brief The slabs backing every slot handed out so far.
+      private: std::vector<std::unique_ptr<Slot[]>> slabs;
+
+      /// \brief Head of the free slot list.
+      private: Slot *freeList = nullptr;
+
+      /// \brief Guards the free list and the slabs.
+      private: mutable std::mutex mutex;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_MOVINGWINDOWFILTER_HH_
 #define IGNITION_MATH_MOVINGWINDOWFILTER_HH_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include "ignition/math/Export.hh"
@@ -82,6 +84,14 @@ namespace ignition
       /// \param[in] _val new raw value
       public: void Update(const T _val);
 
+      /// \brief Update the filter with a batch of raw values,
+      /// equivalent to calling Update on each one in order. The window
+      /// state is kept in locals across the batch, so per-sample cost
+      /// is a couple of arithmetic ops on contiguous storage.
+      /// \param[in] _vals Array of new raw values.
+      /// \param[in] _count Number of values.
+      public: void Update(const T *_vals, std::size_t _count);
+
       /// \brief Set window size
       /// \param[in] _n new desired window size
       public: void SetWindowSize(const unsigned int _n);
@@ -152,6 +162,41 @@ namespace ignition
       }
     }
 
+    //////////////////////////////////////////////////
+    template<typename T>
+    void MovingWindowFilter<T>::Update(const T *_vals, std::size_t _count)
+    {
+      // Hoist the window state out of the private struct so the loop
+      // touches only locals and the contiguous history buffer.
+      T *history = this->dataPtr->valHistory.data();
+      const std::size_t window = this->dataPtr->valWindowSize;
+      std::size_t idx = static_cast<std::size_t>(
+          this->dataPtr->valIter - this->dataPtr->valHistory.begin());
+      std::size_t samples = this->dataPtr->samples;
+      T sum = this->dataPtr->sum;
+
+      for (std::size_t i = 0; i < _count; ++i)
+      {
+        const T val = _vals[i];
+        sum += val;
+
+        ++idx;
+        if (idx == window)
+          idx = 0;
+
+        if (samples == window)
+          sum -= history[idx];
+        else
+          ++samples;
+
+        history[idx] = val;
+      }
+
+      this->dataPtr->valIter = this->dataPtr->valHistory.begin() + idx;
+      this->dataPtr->samples = static_cast<unsigned int>(samples);
+      this->dataPtr->sum = sum;
+    }
+
     //////////////////////////////////////////////////
     template<typename T>
     void MovingWindowFilter<T>::SetWindowSize(const unsigned int _n)
@@ -184,6 +229,94 @@ namespace ignition
     {
       return this->dataPtr->sum / static_cast<double>(this->dataPtr->samples);
     }
+
+    /// \brief Moving window filter with a compile-time window size.
+    /// The history lives in a std::array member, so there is no heap
+    /// allocation or pointer indirection and the compiler can fully
+    /// unroll the update loop for small windows. Use this variant in
+    /// tight per-channel filtering loops; use MovingWindowFilter when
+    /// the window size must be chosen at runtime.
+    template<typename T, std::size_t WindowSize = 4>
+    class FixedMovingWindowFilter
+    {
+      static_assert(WindowSize > 0, "window size must be positive");
+
+      /// \brief Constructor
+      public: FixedMovingWindowFilter()
+      {
+        this->history.fill(T());
+      }
+
+      /// \brief Update value of filter
+      /// \param[in] _val new raw value
+      public: void Update(const T _val)
+      {
+        this->sum += _val;
+
+        ++this->head;
+        if (this->head == WindowSize)
+          this->head = 0;
+
+        if (this->samples == WindowSize)
+          this->sum -= this->history[this->head];
+        else
+          ++this->samples;
+
+        this->history[this->head] = _val;
+      }
+
+      /// \brief Update the filter with a batch of raw values,
+      /// equivalent to calling Update on each one in order.
+      /// \param[in] _vals Array of new raw values.
+      /// \param[in] _count Number of values.
+      public: void Update(const T *_vals, std::size_t _count)
+      {
+        for (std::size_t i = 0; i < _count; ++i)
+          this->Update(_vals[i]);
+      }
+
+      /// \brief Get the window size.
+      /// \return The size of the moving window.
+      public: static constexpr std::size_t Size()
+      {
+        return WindowSize;
+      }
+
+      /// \brief Get whether the window has been filled.
+      /// \return True if the window has been filled.
+      public: bool WindowFilled() const
+      {
+        return this->samples == WindowSize;
+      }
+
+      /// \brief Get filtered result
+      /// \return Latest filtered value
+      public: T Value() const
+      {
+        return this->sum / static_cast<double>(this->samples);
+      }
+
+      /// \brief Forget all previous data.
+      public: void Reset()
+      {
+        this->history.fill(T());
+        this->head = 0;
+        this->samples = 0;
+        this->sum = T();
+      }
+
+      /// \brief buffer history of raw values
+      private: std::array<T, WindowSize> history;
+
+      /// \brief index of the most recently written value
+      private: std::size_t head = 0;
+
+      /// \brief keep track of number of elements
+      private: std::size_t samples = 0;
+
+      /// \brief keep track of running sum
+      private: T sum = T();
+    };
     }
   }
 }
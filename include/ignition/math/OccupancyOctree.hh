@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_OCCUPANCYOCTREE_HH_
+#define IGNITION_MATH_OCCUPANCYOCTREE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class OccupancyOctreePrivate;
+
+    /// \brief A sparse hierarchical occupancy container over a cubic
+    /// region of space.
+    ///
+    /// A flat hash grid stores every occupied cell as an individual
+    /// entry and pays hashing plus per-entry overhead for each one.
+    /// OccupancyOctree instead addresses cells with Morton (Z-order)
+    /// codes and descends an octree whose interior nodes live in one
+    /// pooled, index-linked array; the bottom level packs 4x4x4 cell
+    /// blocks into single 64-bit masks. Dense clusters of occupied
+    /// cells therefore cost about one bit per cell plus shared
+    /// interior nodes, and empty space costs nothing at all.
+    ///
+    /// Cells are never individually freed; Clear() releases the whole
+    /// tree at once, which matches the build-query-discard life cycle
+    /// of mapping workloads.
+    class IGNITION_MATH_VISIBLE OccupancyOctree
+    {
+      /// \brief Constructor.
+      /// The tree covers the axis aligned cube centered on \p _bounds
+      /// whose side is the largest side of \p _bounds, divided into
+      /// cells of size \p _resolution.
+      /// \param[in] _bounds The region to cover.
+      /// \param[in] _resolution The cell size. Values that are not
+      /// positive fall back to one meter.
+      public: OccupancyOctree(const AxisAlignedBox &_bounds,
+                  const double _resolution);
+
+      /// \brief Destructor.
+      public: ~OccupancyOctree();
+
+      /// \brief Get the cell size.
+      /// \return The resolution.
+      public: double Resolution() const;
+
+      /// \brief Get the cubic region covered by the tree. This can be
+      /// larger than the box passed to the constructor.
+      /// \return The covered region.
+      public: AxisAlignedBox Bounds() const;
+
+      /// \brief Mark the cell containing a point as occupied.
+      /// \param[in] _point The point. Points outside Bounds() are
+      /// ignored.
+      /// \return True if the cell changed from free to occupied.
+      public: bool Insert(const Vector3d &_point);
+
+      /// \brief Mark the cells containing a span of points as
+      /// occupied. Equivalent to calling Insert() per point, but the
+      /// loop stays in the implementation.
+      /// \param[in] _points The points. Points outside Bounds() are
+      /// ignored.
+      /// \param[in] _count Number of points.
+      /// \return The number of cells that changed from free to
+      /// occupied.
+      public: uint64_t InsertPoints(const Vector3d *_points,
+                  const size_t _count);
+
+      /// \brief Get whether the cell containing a point is occupied.
+      /// \param[in] _point The point.
+      /// \return True if the cell is occupied; false for free cells
+      /// and points outside Bounds().
+      public: bool Occupied(const Vector3d &_point) const;
+
+      /// \brief Get the number of occupied cells.
+      /// \return The occupied cell count.
+      public: uint64_t OccupiedCount() const;
+
+      /// \brief Get the memory held by the tree's node pools, in
+      /// bytes.
+      /// \return The memory usage.
+      public: size_t MemoryUsage() const;
+
+      /// \brief Remove all occupied cells and release the node pools.
+      public: void Clear();
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<OccupancyOctreePrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
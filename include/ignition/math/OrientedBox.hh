@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_ORIENTEDBOX_HH_
 #define IGNITION_MATH_ORIENTEDBOX_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/MassMatrix3.hh>
@@ -199,6 +201,56 @@ namespace ignition
                p.Z() >= -this->size.Z()*0.5 && p.Z() <= this->size.Z()*0.5;
       }
 
+      /// \brief Check many points against the box in one call.
+      /// Equivalent to calling Contains per point, but the inverse
+      /// pose transform is computed once instead of per point and the
+      /// loop body reduces to a transform and six compares.
+      /// \param[in] _points Array of points to check.
+      /// \param[in] _count Number of points.
+      /// \param[out] _results Destination array of _count flags; an
+      /// element is set to 1 if the corresponding point is inside the
+      /// box and 0 otherwise.
+      public: void ContainsBatch(const Vector3d *_points,
+                  const size_t _count, uint8_t *_results) const
+      {
+        // Move the points to the box frame with one inverse.
+        const auto t = Matrix4<T>(this->pose).Inverse();
+        const T halfX = this->size.X() * 0.5;
+        const T halfY = this->size.Y() * 0.5;
+        const T halfZ = this->size.Z() * 0.5;
+
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const auto p = t * _points[i];
+          _results[i] =
+              p.X() >= -halfX && p.X() <= halfX &&
+              p.Y() >= -halfY && p.Y() <= halfY &&
+              p.Z() >= -halfZ && p.Z() <= halfZ ? 1 : 0;
+        }
+      }
+
+      /// \brief Check every point against every box in one call.
+      /// The inverse pose of each box is computed once and reused for
+      /// the whole point sweep, which is the all-pairs workload of
+      /// region triggers.
+      /// \param[in] _boxes Array of boxes.
+      /// \param[in] _boxCount Number of boxes.
+      /// \param[in] _points Array of points to check.
+      /// \param[in] _pointCount Number of points.
+      /// \param[out] _results Destination array of
+      /// _boxCount * _pointCount flags in box-major order: the flag
+      /// for box b and point p is at index b * _pointCount + p.
+      public: static void ContainsBatch(const OrientedBox<T> *_boxes,
+                  const size_t _boxCount, const Vector3d *_points,
+                  const size_t _pointCount, uint8_t *_results)
+      {
+        for (size_t b = 0; b < _boxCount; ++b)
+        {
+          _boxes[b].ContainsBatch(_points, _pointCount,
+              _results + b * _pointCount);
+        }
+      }
+
       /// \brief Get the material associated with this box.
       /// \return The material assigned to this box.
       public: const ignition::math::Material &Material() const
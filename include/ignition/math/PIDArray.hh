@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_PIDARRAY_HH_
+#define IGNITION_MATH_PIDARRAY_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declaration of private data
+    class PIDArrayPrivate;
+
+    /// \brief A bank of PID controllers updated together.
+    ///
+    /// Actuator farms that tick thousands of PID instances pay a call
+    /// and the controller's scattered state per instance when looping
+    /// over PID::Update. This class stores the gains, limits and error
+    /// state of all controllers in contiguous per-field arrays and
+    /// updates the whole bank in one tight loop, so the clamping turns
+    /// into selects the compiler can vectorize. Each lane follows the
+    /// exact semantics of PID::Update, including the limit-disabling
+    /// convention of max < min and the zero command returned for a
+    /// non-finite error.
+    class IGNITION_MATH_VISIBLE PIDArray
+    {
+      /// \brief Constructor.
+      /// \param[in] _count Number of controllers, all starting with
+      /// the default PID gains and limits.
+      public: explicit PIDArray(const size_t _count = 0);
+
+      /// \brief Destructor.
+      public: ~PIDArray();
+
+      /// \brief Change the number of controllers. New controllers
+      /// start with the default gains and limits; surviving ones keep
+      /// their state.
+      /// \param[in] _count New controller count.
+      public: void Resize(const size_t _count);
+
+      /// \brief Get the number of controllers.
+      /// \return The controller count.
+      public: size_t Size() const;
+
+      /// \brief Set the proportional gain of every controller.
+      /// \param[in] _p Proportional gain.
+      public: void SetPGain(const double _p);
+
+      /// \brief Set per-controller proportional gains.
+      /// \param[in] _p Array of gains.
+      /// \param[in] _count Number of gains; lanes past \p _count keep
+      /// their gain.
+      public: void SetPGains(const double *_p, const size_t _count);
+
+      /// \brief Set the integral gain of every controller.
+      /// \param[in] _i Integral gain.
+      public: void SetIGain(const double _i);
+
+      /// \brief Set per-controller integral gains.
+      /// \param[in] _i Array of gains.
+      /// \param[in] _count Number of gains; lanes past \p _count keep
+      /// their gain.
+      public: void SetIGains(const double *_i, const size_t _count);
+
+      /// \brief Set the derivative gain of every controller.
+      /// \param[in] _d Derivative gain.
+      public: void SetDGain(const double _d);
+
+      /// \brief Set per-controller derivative gains.
+      /// \param[in] _d Array of gains.
+      /// \param[in] _count Number of gains; lanes past \p _count keep
+      /// their gain.
+      public: void SetDGains(const double *_d, const size_t _count);
+
+      /// \brief Set the integral limits of every controller. A max
+      /// smaller than the min disables the limit, as in PID.
+      /// \param[in] _iMax Upper integral limit.
+      /// \param[in] _iMin Lower integral limit.
+      public: void SetILimits(const double _iMax, const double _iMin);
+
+      /// \brief Set per-controller integral limits.
+      /// \param[in] _iMax Array of upper limits.
+      /// \param[in] _iMin Array of lower limits.
+      /// \param[in] _count Number of limits; lanes past \p _count
+      /// keep their limits.
+      public: void SetILimits(const double *_iMax, const double *_iMin,
+                  const size_t _count);
+
+      /// \brief Set the command limits of every controller. A max
+      /// smaller than the min disables the limit, as in PID.
+      /// \param[in] _cmdMax Upper command limit.
+      /// \param[in] _cmdMin Lower command limit.
+      public: void SetCmdLimits(const double _cmdMax, const double _cmdMin);
+
+      /// \brief Set per-controller command limits.
+      /// \param[in] _cmdMax Array of upper limits.
+      /// \param[in] _cmdMin Array of lower limits.
+      /// \param[in] _count Number of limits; lanes past \p _count
+      /// keep their limits.
+      public: void SetCmdLimits(const double *_cmdMax,
+                  const double *_cmdMin, const size_t _count);
+
+      /// \brief Set the command offset of every controller.
+      /// \param[in] _cmdOffset Command offset.
+      public: void SetCmdOffset(const double _cmdOffset);
+
+      /// \brief Update every controller with one time step.
+      /// \param[in] _errors Array of Size() error values, each the
+      /// difference between current state and target.
+      /// \param[in] _dt Change in time since the last update, shared
+      /// by all controllers. A zero duration zeroes all commands
+      /// without touching the controller state, as in PID::Update.
+      /// \param[out] _cmds Destination array; must have room for
+      /// Size() commands.
+      public: void Update(const double *_errors,
+                  const std::chrono::duration<double> &_dt,
+                  double *_cmds);
+
+      /// \brief Get the last command of one controller.
+      /// \param[in] _index Controller index.
+      /// \return The command, or zero for an invalid index.
+      public: double Cmd(const size_t _index) const;
+
+      /// \brief Get the error state of one controller.
+      /// \param[in] _index Controller index.
+      /// \param[out] _pe The proportional error.
+      /// \param[out] _ie The integral of the error.
+      /// \param[out] _de The derivative error.
+      public: void Errors(const size_t _index, double &_pe, double &_ie,
+                  double &_de) const;
+
+      /// \brief Reset the error state and commands of every
+      /// controller, keeping gains and limits.
+      public: void Reset();
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<PIDArrayPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_PARALLEL_HH_
+#define IGNITION_MATH_PARALLEL_HH_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief A small persistent pool of worker threads shared by the
+    /// library's batch loops.
+    ///
+    /// The pool is created once, on first use, with one thread per
+    /// hardware core (the calling thread counts as worker 0), so
+    /// repeated parallel loops reuse the same threads instead of each
+    /// spawning their own. Work is distributed by having every worker
+    /// claim chunks from a shared atomic cursor, which balances uneven
+    /// iterations the same way stealing from per-worker queues would,
+    /// without the queue bookkeeping.
+    ///
+    /// Use ParallelFor() and ParallelReduce() rather than the pool
+    /// directly. Loops issued from inside a pool worker run serially,
+    /// so nested parallelism cannot deadlock the pool.
+    class ThreadPool
+    {
+      /// \brief Get the shared pool, creating it on first use.
+      /// \return The pool singleton.
+      public: static ThreadPool &Instance()
+      {
+        static ThreadPool pool;
+        return pool;
+      }
+
+      /// \brief Get the number of workers, including the calling
+      /// thread.
+      /// \return The worker count, at least 1.
+      public: unsigned int WorkerCount() const
+      {
+        return static_cast<unsigned int>(this->workers.size()) + 1;
+      }
+
+      /// \brief True when called from one of the pool's worker
+      /// threads.
+      /// \return True inside a worker.
+      public: static bool InWorker()
+      {
+        return InWorkerFlag();
+      }
+
+      /// \brief Run a job once on every worker, including the calling
+      /// thread, and wait for all of them to finish.
+      ///
+      /// Concurrent callers are serialized: the pool runs one job at a
+      /// time, and a second submission blocks until the first one has
+      /// fully drained.
+      /// \param[in] _job Callable invoked with the worker index,
+      /// 0 for the calling thread.
+      public: void Run(const std::function<void(unsigned int)> &_job)
+      {
+        // Hold the submission lock for the whole job so a concurrent
+        // caller cannot overwrite the job pointer, pending count and
+        // generation while the previous job's workers are still
+        // running.
+        std::lock_guard<std::mutex> submission(this->submitMutex);
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->job = &_job;
+          this->pending = static_cast<unsigned int>(this->workers.size());
+          ++this->generation;
+        }
+        this->wakeCv.notify_all();
+
+        _job(0);
+
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->doneCv.wait(lock, [this] { return this->pending == 0; });
+        this->job = nullptr;
+      }
+
+      /// \brief Constructor. Starts the worker threads.
+      private: ThreadPool()
+      {
+        const unsigned int cores =
+            std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int i = 1; i < cores; ++i)
+        {
+          this->workers.push_back(
+              std::thread(&ThreadPool::WorkerLoop, this, i));
+        }
+      }
+
+      /// \brief Destructor. Stops and joins the workers.
+      private: ~ThreadPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->stopping = true;
+          ++this->generation;
+        }
+        this->wakeCv.notify_all();
+        for (auto &worker : this->workers)
+          worker.join();
+      }
+
+      /// \brief Body of each worker thread.
+      /// \param[in] _index Worker index, 1 and up.
+      private: void WorkerLoop(const unsigned int _index)
+      {
+        InWorkerFlag() = true;
+        uint64_t seen = 0;
+        while (true)
+        {
+          const std::function<void(unsigned int)> *task = nullptr;
+          {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->wakeCv.wait(lock,
+                [this, seen] { return this->generation != seen; });
+            seen = this->generation;
+            if (this->stopping)
+              return;
+            task = this->job;
+          }
+          if (task)
+            (*task)(_index);
+          {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (--this->pending == 0)
+              this->doneCv.notify_all();
+          }
+        }
+      }
+
+      /// \brief Per-thread flag marking pool workers.
+      /// \return Reference to the flag of the calling thread.
+      private: static bool &InWorkerFlag()
+      {
+        static thread_local bool inWorker = false;
+        return inWorker;
+      }
+
+      /// \brief The worker threads, excluding the calling thread.
+      private: std::vector<std::thread> workers;
+
+      /// \brief Serializes Run() callers; held for a whole job.
+      private: std::mutex submitMutex;
+
+      /// \brief Guards the job state below.
+      private: std::mutex mutex;
+
+      /// \brief Wakes workers when a job is posted or on shutdown.
+      private: std::condition_variable wakeCv;
+
+      /// \brief Signals the issuing thread when all workers finished.
+      private: std::condition_variable doneCv;
+
+      /// \brief The job currently being run, null between jobs.
+      private: const std::function<void(unsigned int)> *job = nullptr;
+
+      /// \brief Number of workers still running the current job.
+      private: unsigned int pending = 0;
+
+      /// \brief Bumped whenever a job is posted or the pool stops.
+      private: uint64_t generation = 0;
+
+      /// \brief True once the pool is shutting down.
+      private: bool stopping = false;
+    };
+
+    /// \brief Apply a functor to every index of a range, spreading the
+    /// work across the shared thread pool.
+    ///
+    /// In the default dynamic mode every worker claims chunks of
+    /// \p _grainSize indices from a shared cursor, so uneven
+    /// iterations balance automatically. With \p _deterministic set,
+    /// the range is split into one contiguous slice per worker
+    /// instead, making the thread-to-index assignment reproducible
+    /// from run to run for a fixed worker count.
+    ///
+    /// Ranges no larger than one grain, and calls made from inside a
+    /// pool worker, run serially on the calling thread.
+    /// \param[in] _begin First index.
+    /// \param[in] _end One past the last index.
+    /// \param[in] _func Callable invoked as _func(index). It must be
+    /// safe to call concurrently for distinct indices.
+    /// \param[in] _grainSize Smallest amount of work handed to a
+    /// worker at a time.
+    /// \param[in] _deterministic Use the reproducible per-worker
+    /// partitioning instead of dynamic chunking.
+    template<typename Functor>
+    void ParallelFor(const size_t _begin, const size_t _end,
+        const Functor &_func, const size_t _grainSize = 1024,
+        const bool _deterministic = false)
+    {
+      if (_begin >= _end)
+        return;
+
+      const size_t count = _end - _begin;
+      auto &pool = ThreadPool::Instance();
+      const unsigned int numWorkers = pool.WorkerCount();
+      if (count <= std::max<size_t>(1, _grainSize) || numWorkers == 1 ||
+          ThreadPool::InWorker())
+      {
+        for (size_t i = _begin; i < _end; ++i)
+          _func(i);
+        return;
+      }
+
+      if (_deterministic)
+      {
+        const size_t slice = (count + numWorkers - 1) / numWorkers;
+        pool.Run(
+            [&](const unsigned int _worker)
+            {
+              const size_t from = _begin + _worker * slice;
+              const size_t to = std::min(from + slice, _end);
+              for (size_t i = from; i < to; ++i)
+                _func(i);
+            });
+      }
+      else
+      {
+        std::atomic<size_t> cursor(_begin);
+        pool.Run(
+            [&](const unsigned int)
+            {
+              while (true)
+              {
+                const size_t from = cursor.fetch_add(_grainSize);
+                if (from >= _end)
+                  break;
+                const size_t to = std::min(from + _grainSize, _end);
+                for (size_t i = from; i < to; ++i)
+                  _func(i);
+              }
+            });
+      }
+    }
+
+    /// \brief Reduce a range to a single value, spreading the chunk
+    /// evaluation across the shared thread pool.
+    ///
+    /// The range is cut at fixed \p _grainSize boundaries and each
+    /// chunk's partial result is stored by chunk index, then folded in
+    /// chunk order on the calling thread. The result therefore does
+    /// not depend on scheduling, only on the chunk boundaries, even
+    /// for non-associative-in-floating-point operations like double
+    /// sums.
+    /// \param[in] _begin First index.
+    /// \param[in] _end One past the last index.
+    /// \param[in] _identity Initial value, also returned for an empty
+    /// range.
+    /// \param[in] _chunkFunc Callable invoked as
+    /// _chunkFunc(from, to) returning the partial result for the
+    /// index range [from, to).
+    /// \param[in] _reduceFunc Callable combining two partial results.
+    /// \param[in] _grainSize Number of indices per chunk.
+    /// \param[in] _deterministic Use the reproducible per-worker
+    /// partitioning for chunk scheduling; the result is identical
+    /// either way.
+    /// \return The folded result.
+    template<typename T, typename ChunkFunctor, typename ReduceFunctor>
+    T ParallelReduce(const size_t _begin, const size_t _end,
+        const T &_identity, const ChunkFunctor &_chunkFunc,
+        const ReduceFunctor &_reduceFunc, const size_t _grainSize = 1024,
+        const bool _deterministic = false)
+    {
+      if (_begin >= _end)
+        return _identity;
+
+      const size_t grain = std::max<size_t>(1, _grainSize);
+      const size_t chunkCount = (_end - _begin + grain - 1) / grain;
+      std::vector<T> partials(chunkCount, _identity);
+
+      ParallelFor(0, chunkCount,
+          [&](const size_t _chunk)
+          {
+            const size_t from = _begin + _chunk * grain;
+            const size_t to = std::min(from + grain, _end);
+            partials[_chunk] = _chunkFunc(from, to);
+          }, 1, _deterministic);
+
+      T result = _identity;
+      for (const T &partial : partials)
+        result = _reduceFunc(result, partial);
+      return result;
+    }
+    }
+  }
+}
+#endif
@@ -17,7 +17,12 @@
 #ifndef IGNITION_MATH_PLANE_HH_
 #define IGNITION_MATH_PLANE_HH_
 
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
 #include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/MassMatrix3.hh>
 #include <ignition/math/Vector2.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/config.hh>
@@ -119,6 +124,97 @@ namespace ignition
         return this->normal.Dot(_point) - this->d;
       }
 
+      /// \brief The distance to the plane from each point in an
+      /// array. Equivalent to calling Distance() per point, but the
+      /// loop stays in this method, letting the compiler vectorize
+      /// the dot products.
+      /// \param[in] _points Array of 3D points.
+      /// \param[in] _count Number of points.
+      /// \param[out] _distances Array of _count distances; negative
+      /// values indicate points on the negative side of the plane.
+      /// \sa Distance
+      public: void DistanceBatch(const Vector3<T> *_points,
+                  const size_t _count, T *_distances) const
+      {
+        for (size_t i = 0; i < _count; ++i)
+          _distances[i] = this->normal.Dot(_points[i]) - this->d;
+      }
+
+      /// \brief Fit a plane to an array of points in the least
+      /// squares sense: the returned plane minimizes the sum of
+      /// squared point-to-plane distances. The normal is the
+      /// eigenvector of the covariance of the centered points with
+      /// the smallest eigenvalue, obtained through the MassMatrix3
+      /// eigendecomposition; its sign is arbitrary.
+      /// \param[in] _points Array of 3D points.
+      /// \param[in] _count Number of points. Fewer than three points,
+      /// or a degenerate set whose covariance has no unique smallest
+      /// eigenvector, yields a default constructed plane with a zero
+      /// normal.
+      /// \return The fitted plane.
+      public: static Plane<T> Fit(const Vector3<T> *_points,
+                  const size_t _count)
+      {
+        static_assert(std::is_floating_point<T>::value,
+            "Plane::Fit requires a floating point plane");
+
+        Plane<T> result;
+        if (_count < 3)
+          return result;
+
+        Vector3<T> centroid;
+        for (size_t i = 0; i < _count; ++i)
+          centroid += _points[i];
+        centroid /= static_cast<T>(_count);
+
+        // Upper triangle of the covariance of the centered points.
+        T xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const Vector3<T> p = _points[i] - centroid;
+          xx += p.X() * p.X();
+          xy += p.X() * p.Y();
+          xz += p.X() * p.Z();
+          yy += p.Y() * p.Y();
+          yz += p.Y() * p.Z();
+          zz += p.Z() * p.Z();
+        }
+
+        // A MassMatrix3 stores a symmetric matrix in exactly this
+        // layout, so its eigenvalue machinery applies to the
+        // covariance; the smallest principal moment is the smallest
+        // eigenvalue.
+        const MassMatrix3<T> covariance(T(1), Vector3<T>(xx, yy, zz),
+            Vector3<T>(xy, xz, yz));
+        const Vector3<T> moments = covariance.PrincipalMoments();
+        const T lambda = std::min({moments[0], moments[1], moments[2]});
+
+        // The normal spans the null space of (covariance - lambda I).
+        // The cross product of any two independent rows lies in it;
+        // take the longest of the three for numerical robustness,
+        // which also handles repeated larger eigenvalues where the
+        // principal axes are ambiguous.
+        const Vector3<T> row0(xx - lambda, xy, xz);
+        const Vector3<T> row1(xy, yy - lambda, yz);
+        const Vector3<T> row2(xz, yz, zz - lambda);
+        Vector3<T> fitNormal = row0.Cross(row1);
+        const Vector3<T> cross02 = row0.Cross(row2);
+        const Vector3<T> cross12 = row1.Cross(row2);
+        if (cross02.SquaredLength() > fitNormal.SquaredLength())
+          fitNormal = cross02;
+        if (cross12.SquaredLength() > fitNormal.SquaredLength())
+          fitNormal = cross12;
+
+        // All cross products vanish when the smallest eigenvalue
+        // repeats, e.g. for collinear points; there is no unique fit.
+        if (fitNormal == Vector3<T>::Zero)
+          return result;
+
+        fitNormal.Normalize();
+        result.Set(fitNormal, fitNormal.Dot(centroid));
+        return result;
+      }
+
       /// \brief The side of the plane a point is on.
       /// \param[in] _point The 3D point to check.
       /// \return Plane::NEGATIVE_SIDE if the distance from the point to the
@@ -17,6 +17,9 @@
 #ifndef IGNITION_MATH_POSE_HH_
 #define IGNITION_MATH_POSE_HH_
 
+#include <cstddef>
+#include <cstdint>
+
 #include <ignition/math/Quaternion.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/config.hh>
@@ -134,6 +137,18 @@ namespace ignition
       /// \return the inverse pose
       public: Pose3<T> Inverse() const
       {
+        // Fast path for the usual case of a unit rotation, where the
+        // inverse quaternion is just the conjugate and the divisions by
+        // the squared norm in Quaternion::Inverse() can be skipped.
+        const T n2 = this->q.W()*this->q.W() + this->q.X()*this->q.X() +
+                     this->q.Y()*this->q.Y() + this->q.Z()*this->q.Z();
+        if (equal<T>(n2, T(1)))
+        {
+          Quaternion<T> inv(this->q.W(), -this->q.X(), -this->q.Y(),
+              -this->q.Z());
+          return Pose3<T>(inv * (this->p*-1), inv);
+        }
+
         Quaternion<T> inv = this->q.Inverse();
         return Pose3<T>(inv * (this->p*-1), inv);
       }
@@ -233,6 +248,94 @@ namespace ignition
         return *this;
       }
 
+      /// \brief Compose a chain of poses in a single pass.
+      /// Produces the same result as _poses[0] * _poses[1] * ... *
+      /// _poses[_n-1], but keeps the accumulated rotation and position in
+      /// scalar locals, so deep kinematic chains avoid the temporary pose
+      /// and the quaternion sandwich product that each operator* creates.
+      /// \param[in] _poses Array of poses, ordered like the equivalent
+      /// operator* chain: each pose is expressed in the frame of the one
+      /// that follows it.
+      /// \param[in] _n Number of poses.
+      /// \return The composed pose, or an identity pose when _n is 0.
+      public: static Pose3<T> ComposeChain(const Pose3<T> *_poses, size_t _n)
+      {
+        if (_n == 0)
+          return Pose3<T>();
+
+        // Accumulated position and rotation.
+        T px = _poses[0].p.X(), py = _poses[0].p.Y(), pz = _poses[0].p.Z();
+        T qw = _poses[0].q.W(), qx = _poses[0].q.X(),
+          qy = _poses[0].q.Y(), qz = _poses[0].q.Z();
+
+        for (size_t i = 1; i < _n; ++i)
+        {
+          const T lpx = _poses[i].p.X(), lpy = _poses[i].p.Y(),
+                  lpz = _poses[i].p.Z();
+
+          // Rotate the link position by the accumulated rotation using
+          // the cross-product form: p' = p + w*t + v x t, t = 2 v x p,
+          // then translate: this matches (acc * link).Pos().
+          const T tx = 2 * (qy * lpz - qz * lpy);
+          const T ty = 2 * (qz * lpx - qx * lpz);
+          const T tz = 2 * (qx * lpy - qy * lpx);
+          px += lpx + qw * tx + qy * tz - qz * ty;
+          py += lpy + qw * ty + qz * tx - qx * tz;
+          pz += lpz + qw * tz + qx * ty - qy * tx;
+
+          // Accumulate the rotation: q = q * link.q.
+          const T lw = _poses[i].q.W(), lx = _poses[i].q.X(),
+                  ly = _poses[i].q.Y(), lz = _poses[i].q.Z();
+          const T nw = qw * lw - qx * lx - qy * ly - qz * lz;
+          const T nx = qw * lx + qx * lw + qy * lz - qz * ly;
+          const T ny = qw * ly - qx * lz + qy * lw + qz * lx;
+          const T nz = qw * lz + qx * ly - qy * lx + qz * lw;
+          qw = nw; qx = nx; qy = ny; qz = nz;
+        }
+
+        return Pose3<T>(px, py, pz, qw, qx, qy, qz);
+      }
+
+      /// \brief Compose an array of child poses against this pose in one
+      /// pass. Equivalent to _out[i] = (*this) * _children[i] for every
+      /// element, expressing each child pose in this pose's frame with
+      /// this pose's rotation and position loaded once instead of per
+      /// link. _out may alias _children.
+      /// \param[in] _children Array of poses expressed in this pose's
+      /// frame.
+      /// \param[out] _out Destination array; must hold _n elements.
+      /// \param[in] _n Number of poses.
+      public: void TransformBatch(const Pose3<T> *_children, Pose3<T> *_out,
+                  size_t _n) const
+      {
+        const T pw = this->q.W(), pvx = this->q.X(),
+                pvy = this->q.Y(), pvz = this->q.Z();
+        const T ox = this->p.X(), oy = this->p.Y(), oz = this->p.Z();
+
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const T cx = _children[i].p.X(), cy = _children[i].p.Y(),
+                  cz = _children[i].p.Z();
+
+          // Rotate the child position into this frame and translate.
+          const T tx = 2 * (pvy * cz - pvz * cy);
+          const T ty = 2 * (pvz * cx - pvx * cz);
+          const T tz = 2 * (pvx * cy - pvy * cx);
+
+          const T cw = _children[i].q.W(), cqx = _children[i].q.X(),
+                  cqy = _children[i].q.Y(), cqz = _children[i].q.Z();
+
+          _out[i].Set(
+              Vector3<T>(cx + pw * tx + pvy * tz - pvz * ty + ox,
+                         cy + pw * ty + pvz * tx - pvx * tz + oy,
+                         cz + pw * tz + pvx * ty - pvy * tx + oz),
+              Quaternion<T>(pw * cw - pvx * cqx - pvy * cqy - pvz * cqz,
+                            pw * cqx + pvx * cw + pvy * cqz - pvz * cqy,
+                            pw * cqy - pvx * cqz + pvy * cw + pvz * cqx,
+                            pw * cqz + pvx * cqy - pvy * cqx + pvz * cw));
+        }
+      }
+
       /// \brief Assignment operator
       /// \param[in] _pose Pose3<T> to copy
       public: Pose3<T> &operator=(const Pose3<T> &_pose)
@@ -491,9 +594,59 @@ namespace ignition
     };
     template<typename T> const Pose3<T> Pose3<T>::Zero(0, 0, 0, 0, 0, 0);
 
+    /// \brief Compare two pose arrays element-wise with tolerance,
+    /// writing one bit per element: bit i of the mask is set when
+    /// every position and rotation component of _a[i] is within _tol
+    /// of _b[i]. The frame-over-frame "did anything move" sweep of a
+    /// change detector becomes one pass over contiguous poses with a
+    /// branch-free comparison the compiler can vectorize; pair the
+    /// mask with ChangedIndices() in Helpers.hh to enumerate the
+    /// poses that moved.
+    /// \param[in] _a First pose array.
+    /// \param[in] _b Second pose array.
+    /// \param[in] _count Number of elements in each array.
+    /// \param[in] _tol Per-component equality tolerance.
+    /// \param[out] _mask Bitmask of (_count + 63) / 64 words; bit i of
+    /// word i / 64 reports element i, unused tail bits are cleared.
+    template<typename T>
+    inline void EqualBatch(const Pose3<T> *_a, const Pose3<T> *_b,
+        const std::size_t _count, const T _tol, uint64_t *_mask)
+    {
+      const std::size_t words = (_count + 63) / 64;
+      for (std::size_t w = 0; w < words; ++w)
+        _mask[w] = 0;
+      for (std::size_t i = 0; i < _count; ++i)
+      {
+        const auto &pa = _a[i].Pos();
+        const auto &pb = _b[i].Pos();
+        const auto &qa = _a[i].Rot();
+        const auto &qb = _b[i].Rot();
+        const uint64_t eq =
+            (equal<T>(pa.X(), pb.X(), _tol) &
+             equal<T>(pa.Y(), pb.Y(), _tol) &
+             equal<T>(pa.Z(), pb.Z(), _tol) &
+             equal<T>(qa.W(), qb.W(), _tol) &
+             equal<T>(qa.X(), qb.X(), _tol) &
+             equal<T>(qa.Y(), qb.Y(), _tol) &
+             equal<T>(qa.Z(), qb.Z(), _tol)) ? 1u : 0u;
+        _mask[i >> 6] |= eq << (i & 63);
+      }
+    }
+
     typedef Pose3<int> Pose3i;
     typedef Pose3<double> Pose3d;
     typedef Pose3<float> Pose3f;
+
+    // The library compiles the double instantiation once; see
+    // src/TemplateInstantiations.cc. The int and float instantiations
+    // cannot be compiled eagerly because Pose3::Reset only supports
+    // double. Consumers without the compiled library (the header-only
+    // core component) and TUs that opt out of SIMD instantiate
+    // implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Pose3<double>;
+#endif
     }
   }
 }
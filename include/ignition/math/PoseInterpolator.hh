@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_POSEINTERPOLATOR_HH_
+#define IGNITION_MATH_POSEINTERPOLATOR_HH_
+
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class PoseInterpolatorPrivate;
+
+    /// \brief Resamples a time-stamped Pose3d stream at arbitrary
+    /// times, interpolating position linearly and orientation by
+    /// shortest-path slerp.
+    ///
+    /// The time index is validated and stored once by SetData; every
+    /// Sample call then only searches it. The batch overload keeps a
+    /// moving cursor between queries, so resampling to a fixed rate —
+    /// ascending query times — costs one linear index advance per
+    /// sample instead of a binary search, and the interpolation runs
+    /// in one tight loop over the keyframe arrays. Query times outside
+    /// the recorded range clamp to the first or last pose.
+    class IGNITION_MATH_VISIBLE PoseInterpolator
+    {
+      /// \brief Constructor. The interpolator is empty until SetData
+      /// succeeds.
+      public: PoseInterpolator();
+
+      /// \brief Destructor.
+      public: virtual ~PoseInterpolator();
+
+      /// \brief Set the keyframes, replacing any previous data.
+      /// \param[in] _times Array of _count timestamps; must be
+      /// non-decreasing.
+      /// \param[in] _poses Array of _count poses.
+      /// \param[in] _count Number of keyframes.
+      /// \return True on success. Unsorted times or a zero _count
+      /// leave the interpolator empty and return false.
+      public: bool SetData(const double *_times, const Pose3d *_poses,
+                  const size_t _count);
+
+      /// \brief Get the number of keyframes.
+      /// \return The keyframe count.
+      public: size_t Count() const;
+
+      /// \brief Get the time of the first keyframe.
+      /// \return The start time, or zero when empty.
+      public: double StartTime() const;
+
+      /// \brief Get the time of the last keyframe.
+      /// \return The end time, or zero when empty.
+      public: double EndTime() const;
+
+      /// \brief Sample the stream at one time.
+      /// \param[in] _time The query time.
+      /// \param[out] _pose The interpolated pose.
+      /// \return False when the interpolator is empty.
+      public: bool Sample(const double _time, Pose3d &_pose) const;
+
+      /// \brief Sample the stream at many times in one call. Ascending
+      /// query times, the fixed-rate resampling case, advance an
+      /// internal cursor instead of searching per query.
+      /// \param[in] _times Array of _count query times.
+      /// \param[out] _poses Destination array of _count poses.
+      /// \param[in] _count Number of queries.
+      /// \return False when the interpolator is empty.
+      public: bool Sample(const double *_times, Pose3d *_poses,
+                  const size_t _count) const;
+
+      /// \brief Sample the stream at a fixed rate.
+      /// \param[in] _begin Time of the first sample.
+      /// \param[in] _step Time between samples; must be positive.
+      /// \param[out] _poses Destination array of _count poses.
+      /// \param[in] _count Number of samples.
+      /// \return False when the interpolator is empty or _step is not
+      /// positive.
+      public: bool SampleUniform(const double _begin, const double _step,
+                  Pose3d *_poses, const size_t _count) const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<PoseInterpolatorPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_POSETREE_HH_
+#define IGNITION_MATH_POSETREE_HH_
+
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class PoseTreePrivate;
+
+    /// \brief A kinematic tree of local poses with cached world poses
+    /// and dirty-bit propagation.
+    ///
+    /// A scene graph that recomputes world poses root to leaf every
+    /// frame pays for the whole tree even when only a few nodes moved.
+    /// PoseTree caches the world pose of every node and marks a node
+    /// dirty when its local pose changes; Update() then recomposes
+    /// only the dirty subtrees, so a quiescent frame costs nothing and
+    /// a frame where one arm joint moved recomposes just that arm.
+    ///
+    /// The tree always has a root node with id 0 whose local pose is
+    /// the world origin of the tree. World poses compose with
+    /// Pose3d::operator+: a node's world pose is its local pose added
+    /// to its parent's world pose.
+    class IGNITION_MATH_VISIBLE PoseTree
+    {
+      /// \brief Constructor. The tree starts with the root node,
+      /// id 0, at an identity pose.
+      public: PoseTree();
+
+      /// \brief Destructor.
+      public: ~PoseTree();
+
+      /// \brief Add a node.
+      /// \param[in] _parent Id of the parent node; must already be in
+      /// the tree.
+      /// \param[in] _localPose Pose of the new node in its parent's
+      /// frame.
+      /// \return Id of the new node, or zero when _parent is unknown.
+      /// Zero always denotes the root, which is never newly added, so
+      /// it doubles as the failure value.
+      public: std::size_t AddNode(const std::size_t _parent,
+                  const Pose3d &_localPose);
+
+      /// \brief Get the number of nodes, including the root.
+      /// \return The node count.
+      public: std::size_t Count() const;
+
+      /// \brief Get the parent of a node.
+      /// \param[in] _node Id of the node.
+      /// \return The parent id, or zero for the root and for unknown
+      /// ids.
+      public: std::size_t Parent(const std::size_t _node) const;
+
+      /// \brief Set the local pose of a node, marking its subtree
+      /// stale until the next Update() or WorldPose() call that needs
+      /// it.
+      /// \param[in] _node Id of the node; the root's local pose may
+      /// also be set, moving the whole tree.
+      /// \param[in] _pose The new pose of the node in its parent's
+      /// frame.
+      /// \return True on success, false for an unknown id.
+      public: bool SetLocalPose(const std::size_t _node,
+                  const Pose3d &_pose);
+
+      /// \brief Get the local pose of a node.
+      /// \param[in] _node Id of the node.
+      /// \param[out] _pose The pose of the node in its parent's frame.
+      /// \return True on success, false for an unknown id.
+      public: bool LocalPose(const std::size_t _node, Pose3d &_pose) const;
+
+      /// \brief Get the cached world pose of a node, applying any
+      /// pending updates first.
+      /// \param[in] _node Id of the node.
+      /// \param[out] _pose The pose of the node in the root's frame.
+      /// \return True on success, false for an unknown id.
+      public: bool WorldPose(const std::size_t _node, Pose3d &_pose);
+
+      /// \brief Recompose the world poses of all dirty subtrees.
+      /// Nodes whose ancestors did not move are not touched.
+      /// \return The number of world poses recomputed.
+      public: std::size_t Update();
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<PoseTreePrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_PREINIT_HH_
+#define IGNITION_MATH_PREINIT_HH_
+
+#include <string>
+#include <vector>
+
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE
+    {
+    /// \brief Run the library's remaining first-use initializers at a
+    /// controlled point instead of inside the first hot call.
+    ///
+    /// The library performs no work at static initialization; the few
+    /// lazily built structures listed by PreinitReport() are
+    /// constructed on first use under the usual function-local-static
+    /// lock. Call Preinit() once after startup to pay those costs up
+    /// front. Warming the random generator consumes a few draws, so
+    /// call Rand::Seed afterwards if a reproducible stream is needed,
+    /// as reproducible runs must do anyway.
+    void IGNITION_MATH_VISIBLE Preinit();
+
+    /// \brief List the library's runtime initializers that Preinit()
+    /// covers, one "name: when it runs" entry per initializer, for
+    /// cold-start audits.
+    /// \return The audit entries.
+    std::vector<std::string> IGNITION_MATH_VISIBLE PreinitReport();
+    }
+  }
+}
+#endif
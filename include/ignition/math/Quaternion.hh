@@ -44,7 +44,7 @@ namespace ignition
       public: static const Quaternion Zero;
 
       /// \brief Default Constructor
-      public: Quaternion()
+      public: constexpr Quaternion()
       : qw(1), qx(0), qy(0), qz(0)
       {
         // quaternion not normalized, because that breaks
@@ -56,7 +56,8 @@ namespace ignition
       /// \param[in] _x X param
       /// \param[in] _y Y param
       /// \param[in] _z Z param
-      public: Quaternion(const T &_w, const T &_x, const T &_y, const T &_z)
+      public: constexpr Quaternion(const T &_w, const T &_x, const T &_y,
+                  const T &_z)
       : qw(_w), qx(_x), qy(_y), qz(_z)
       {}
 
@@ -94,16 +95,13 @@ namespace ignition
 
       /// \brief Copy constructor
       /// \param[in] _qt Quaternion<T> to copy
-      public: Quaternion(const Quaternion<T> &_qt)
+      public: constexpr Quaternion(const Quaternion<T> &_qt)
+      : qw(_qt.qw), qx(_qt.qx), qy(_qt.qy), qz(_qt.qz)
       {
-        this->qw = _qt.qw;
-        this->qx = _qt.qx;
-        this->qy = _qt.qy;
-        this->qz = _qt.qz;
       }
 
       /// \brief Destructor
-      public: ~Quaternion() {}
+      public: ~Quaternion() = default;
 
       /// \brief Assignment operator
       /// \param[in] _qt Quaternion<T> to copy
@@ -129,7 +127,7 @@ namespace ignition
 
       /// \brief Get the inverse of this quaternion
       /// \return Inverse quaternion
-      public: inline Quaternion<T> Inverse() const
+      public: constexpr Quaternion<T> Inverse() const
               {
                 T s = 0;
                 Quaternion<T> q(this->qw, this->qx, this->qy, this->qz);
@@ -137,7 +135,9 @@ namespace ignition
                 // use s to test if quaternion is valid
                 s = q.qw * q.qw + q.qx * q.qx + q.qy * q.qy + q.qz * q.qz;
 
-                if (equal<T>(s, static_cast<T>(0)))
+                // s is a sum of squares, so this matches equal(s, 0)
+                // while remaining usable in constant expressions.
+                if (s <= static_cast<T>(1e-6))
                 {
                   q.qw = 1.0;
                   q.qx = 0.0;
@@ -605,10 +605,31 @@ namespace ignition
         this->Axis(axis.X(), axis.Y(), axis.Z(), angle);
       }
 
+      /// \brief Create a quaternion from an axis and precomputed sine and
+      /// cosine of half the rotation angle. Unlike the axis-angle
+      /// constructor this makes no transcendental calls, so it is
+      /// constexpr and fixed rotations fold at compile time.
+      /// \param[in] _axisX x component of the rotation axis, which must
+      /// be of unit length.
+      /// \param[in] _axisY y component of the rotation axis.
+      /// \param[in] _axisZ z component of the rotation axis.
+      /// \param[in] _sinHalfAngle sine of half the rotation angle.
+      /// \param[in] _cosHalfAngle cosine of half the rotation angle.
+      /// \return A quaternion representing the rotation.
+      public: static constexpr Quaternion<T> FromAxisFast(
+                  const T &_axisX, const T &_axisY, const T &_axisZ,
+                  const T &_sinHalfAngle, const T &_cosHalfAngle)
+      {
+        return Quaternion<T>(_cosHalfAngle,
+                             _axisX * _sinHalfAngle,
+                             _axisY * _sinHalfAngle,
+                             _axisZ * _sinHalfAngle);
+      }
+
       /// \brief Addition operator
       /// \param[in] _qt quaternion for addition
       /// \return this quaternion + _qt
-      public: Quaternion<T> operator+(const Quaternion<T> &_qt) const
+      public: constexpr Quaternion<T> operator+(const Quaternion<T> &_qt) const
       {
         Quaternion<T> result(this->qw + _qt.qw, this->qx + _qt.qx,
                              this->qy + _qt.qy, this->qz + _qt.qz);
@@ -618,7 +639,7 @@ namespace ignition
       /// \brief Addition operator
       /// \param[in] _qt quaternion for addition
       /// \return this quaternion + qt
-      public: Quaternion<T> operator+=(const Quaternion<T> &_qt)
+      public: constexpr Quaternion<T> operator+=(const Quaternion<T> &_qt)
       {
         *this = *this + _qt;
 
@@ -628,7 +649,7 @@ namespace ignition
       /// \brief Subtraction operator
       /// \param[in] _qt quaternion to subtract
       /// \return this quaternion - _qt
-      public: Quaternion<T> operator-(const Quaternion<T> &_qt) const
+      public: constexpr Quaternion<T> operator-(const Quaternion<T> &_qt) const
       {
         Quaternion<T> result(this->qw - _qt.qw, this->qx - _qt.qx,
                        this->qy - _qt.qy, this->qz - _qt.qz);
@@ -638,7 +659,7 @@ namespace ignition
       /// \brief Subtraction operator
       /// \param[in] _qt Quaternion<T> for subtraction
       /// \return This quaternion - qt
-      public: Quaternion<T> operator-=(const Quaternion<T> &_qt)
+      public: constexpr Quaternion<T> operator-=(const Quaternion<T> &_qt)
       {
         *this = *this - _qt;
         return *this;
@@ -647,7 +668,7 @@ namespace ignition
       /// \brief Multiplication operator
       /// \param[in] _q Quaternion<T> for multiplication
       /// \return This quaternion multiplied by the parameter
-      public: inline Quaternion<T> operator*(const Quaternion<T> &_q) const
+      public: constexpr Quaternion<T> operator*(const Quaternion<T> &_q) const
               {
                 return Quaternion<T>(
                   this->qw*_q.qw-this->qx*_q.qx-this->qy*_q.qy-this->qz*_q.qz,
@@ -659,7 +680,7 @@ namespace ignition
       /// \brief Multiplication operator by a scalar.
       /// \param[in] _f factor
       /// \return quaternion multiplied by the scalar
-      public: Quaternion<T> operator*(const T &_f) const
+      public: constexpr Quaternion<T> operator*(const T &_f) const
       {
         return Quaternion<T>(this->qw*_f, this->qx*_f,
                              this->qy*_f, this->qz*_f);
@@ -668,7 +689,7 @@ namespace ignition
       /// \brief Multiplication operator
       /// \param[in] _qt Quaternion<T> for multiplication
       /// \return This quaternion multiplied by the parameter
-      public: Quaternion<T> operator*=(const Quaternion<T> &_qt)
+      public: constexpr Quaternion<T> operator*=(const Quaternion<T> &_qt)
       {
         *this = *this * _qt;
         return *this;
@@ -713,7 +734,7 @@ namespace ignition
 
       /// \brief Unary minus operator
       /// \return negates each component of the quaternion
-      public: Quaternion<T> operator-() const
+      public: constexpr Quaternion<T> operator-() const
       {
         return Quaternion<T>(-this->qw, -this->qx, -this->qy, -this->qz);
       }
@@ -729,6 +750,65 @@ namespace ignition
         return Vector3<T>(tmp.qx, tmp.qy, tmp.qz);
       }
 
+      /// \brief Get the rotation matrix form of this quaternion.
+      /// When one rotation applies to many vectors across several
+      /// calls, convert once with this accessor and multiply by the
+      /// matrix thereafter: the quaternion sandwich costs roughly
+      /// twice the arithmetic of a matrix-vector product. The
+      /// quaternion is normalized during conversion, exactly as the
+      /// Matrix3 constructor from a quaternion does.
+      /// \return The equivalent rotation matrix.
+      public: Matrix3<T> RotationMatrix() const
+      {
+        return Matrix3<T>(*this);
+      }
+
+      /// \brief Rotate an array of vectors by this quaternion.
+      /// Equivalent to calling RotateVector on every element, but the
+      /// quaternion is expanded once into the rows of the corresponding
+      /// rotation matrix, so each point costs one matrix-vector product
+      /// instead of two quaternion products. _out may alias _in.
+      /// \param[in] _in Array of vectors to rotate.
+      /// \param[out] _out Destination array; must hold _n elements.
+      /// \param[in] _n Number of vectors.
+      public: void RotateVectors(const Vector3<T> *_in, Vector3<T> *_out,
+                  size_t _n) const
+      {
+        const T n2 = this->qw * this->qw + this->qx * this->qx +
+                     this->qy * this->qy + this->qz * this->qz;
+
+        // Degenerate quaternion: match RotateVector, which maps every
+        // vector to zero through the identity inverse.
+        if (n2 <= static_cast<T>(1e-6))
+        {
+          for (size_t i = 0; i < _n; ++i)
+            _out[i] = (*this) * (Quaternion<T>(0, _in[i].X(), _in[i].Y(),
+                _in[i].Z()) * this->Inverse()) * Vector3<T>::Zero;
+          return;
+        }
+
+        // Rows of the rotation matrix; the 2/|q|^2 factor makes the
+        // expansion exact for non-normalized quaternions too.
+        const T ss = static_cast<T>(2) / n2;
+        const T r00 = 1 - ss * (this->qy * this->qy + this->qz * this->qz);
+        const T r01 = ss * (this->qx * this->qy - this->qw * this->qz);
+        const T r02 = ss * (this->qx * this->qz + this->qw * this->qy);
+        const T r10 = ss * (this->qx * this->qy + this->qw * this->qz);
+        const T r11 = 1 - ss * (this->qx * this->qx + this->qz * this->qz);
+        const T r12 = ss * (this->qy * this->qz - this->qw * this->qx);
+        const T r20 = ss * (this->qx * this->qz - this->qw * this->qy);
+        const T r21 = ss * (this->qy * this->qz + this->qw * this->qx);
+        const T r22 = 1 - ss * (this->qx * this->qx + this->qy * this->qy);
+
+        for (size_t i = 0; i < _n; ++i)
+        {
+          const T x = _in[i].X(), y = _in[i].Y(), z = _in[i].Z();
+          _out[i].Set(r00 * x + r01 * y + r02 * z,
+                      r10 * x + r11 * y + r12 * z,
+                      r20 * x + r21 * y + r22 * z);
+        }
+      }
+
       /// \brief Do the reverse rotation of a vector by this quaternion
       /// \param[in] _vec the vector
       /// \return the reversed vector
@@ -840,7 +920,7 @@ namespace ignition
       /// \brief Dot product
       /// \param[in] _q the other quaternion
       /// \return the product
-      public: T Dot(const Quaternion<T> &_q) const
+      public: constexpr T Dot(const Quaternion<T> &_q) const
       {
         return this->qw*_q.qw + this->qx * _q.qx +
                this->qy*_q.qy + this->qz*_q.qz;
@@ -921,6 +1001,115 @@ namespace ignition
         }
       }
 
+      /// \brief Spherically interpolate arrays of rotation pairs with
+      /// one interpolation parameter, as used when blending the joints
+      /// of a pose at a fixed weight.
+      ///
+      /// The loop always takes the shortest path and falls back to
+      /// normalized linear interpolation for pairs whose rotations are
+      /// closer than \p _nlerpCosThreshold, which is the common case
+      /// between animation keyframes and skips the trig entirely.
+      /// Outputs are normalized.
+      /// \param[in] _t Interpolation parameter (range 0 to 1).
+      /// \param[in] _from Array of start rotations.
+      /// \param[in] _to Array of end rotations.
+      /// \param[out] _out Destination array; must have room for
+      /// \p _count rotations.
+      /// \param[in] _count Number of rotation pairs.
+      /// \param[in] _nlerpCosThreshold Dot product above which nlerp
+      /// replaces the exact slerp. Pass 1 to force slerp everywhere.
+      public: static void SlerpBatch(const T _t,
+                  const Quaternion<T> *_from, const Quaternion<T> *_to,
+                  Quaternion<T> *_out, const size_t _count,
+                  const T _nlerpCosThreshold = static_cast<T>(0.99))
+      {
+        for (size_t i = 0; i < _count; ++i)
+        {
+          T dot = _from[i].Dot(_to[i]);
+          const T sign = dot < 0 ? T(-1) : T(1);
+          dot *= sign;
+
+          T coeff0, coeff1;
+          SlerpCoeffs(_t, dot, _nlerpCosThreshold, coeff0, coeff1);
+          coeff1 *= sign;
+
+          Quaternion<T> blend = _from[i] * coeff0 + _to[i] * coeff1;
+          blend.Normalize();
+          _out[i] = blend;
+        }
+      }
+
+      /// \brief \copybrief SlerpBatch(const T,const Quaternion<T>*,
+      /// const Quaternion<T>*,Quaternion<T>*,const size_t,const T)
+      ///
+      /// This overload reads and writes planar wwww/xxxx/yyyy/zzzz
+      /// storage, the layout that lets the compiler vectorize the
+      /// blend across joints.
+      /// \param[in] _t Interpolation parameter (range 0 to 1).
+      /// \param[in] _from Start rotations: four planes of \p _count
+      /// values, ordered w, x, y, z.
+      /// \param[in] _to End rotations, same layout.
+      /// \param[out] _out Destination planes, same layout.
+      /// \param[in] _count Number of rotation pairs.
+      /// \param[in] _nlerpCosThreshold Dot product above which nlerp
+      /// replaces the exact slerp. Pass 1 to force slerp everywhere.
+      public: static void SlerpBatch(const T _t,
+                  const T *const _from[4], const T *const _to[4],
+                  T *const _out[4], const size_t _count,
+                  const T _nlerpCosThreshold = static_cast<T>(0.99))
+      {
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const T pw = _from[0][i];
+          const T px = _from[1][i];
+          const T py = _from[2][i];
+          const T pz = _from[3][i];
+          const T qw = _to[0][i];
+          const T qx = _to[1][i];
+          const T qy = _to[2][i];
+          const T qz = _to[3][i];
+
+          T dot = pw*qw + px*qx + py*qy + pz*qz;
+          const T sign = dot < 0 ? T(-1) : T(1);
+          dot *= sign;
+
+          T coeff0, coeff1;
+          SlerpCoeffs(_t, dot, _nlerpCosThreshold, coeff0, coeff1);
+          coeff1 *= sign;
+
+          const T w = pw*coeff0 + qw*coeff1;
+          const T x = px*coeff0 + qx*coeff1;
+          const T y = py*coeff0 + qy*coeff1;
+          const T z = pz*coeff0 + qz*coeff1;
+          const T invLen = T(1) / sqrt(w*w + x*x + y*y + z*z);
+          _out[0][i] = w * invLen;
+          _out[1][i] = x * invLen;
+          _out[2][i] = y * invLen;
+          _out[3][i] = z * invLen;
+        }
+      }
+
+      /// \internal
+      /// \brief Blend coefficients shared by the SlerpBatch overloads:
+      /// exact slerp weights below the nlerp threshold, plain linear
+      /// weights above it. \p _dot must be non-negative.
+      private: static void SlerpCoeffs(const T _t, const T _dot,
+                  const T _nlerpCosThreshold, T &_coeff0, T &_coeff1)
+      {
+        const T sinSq = 1 - _dot*_dot;
+        const T fSin = sinSq > 0 ? sqrt(sinSq) : T(0);
+        if (_dot >= _nlerpCosThreshold || fSin < T(1e-6))
+        {
+          _coeff0 = 1 - _t;
+          _coeff1 = _t;
+          return;
+        }
+        const T fAngle = atan2(fSin, _dot);
+        const T fInvSin = 1 / fSin;
+        _coeff0 = sin((1 - _t) * fAngle) * fInvSin;
+        _coeff1 = sin(_t * fAngle) * fInvSin;
+      }
+
       /// \brief Integrate quaternion for constant angular velocity vector
       /// along specified interval `_deltaT`.
       /// Implementation based on:
@@ -953,6 +1142,59 @@ namespace ignition
         return deltaQ * (*this);
       }
 
+      /// \brief Integrate an array of orientations in place for
+      /// constant angular velocities over `_deltaT`. Equivalent to
+      /// assigning Integrate(_angularVelocities[i], _deltaT) to each
+      /// element, using the same exact exponential map with the same
+      /// small-angle series, but with the delta rotation built and
+      /// multiplied in component form so the physics substep loop over
+      /// thousands of bodies creates no temporaries. The exponential
+      /// map keeps unit quaternions unit, so unlike first-order
+      /// `q += 0.5 * w * q * dt` stepping no renormalization pass is
+      /// needed.
+      /// \param[in, out] _rotations Array of _count orientations,
+      /// advanced in place.
+      /// \param[in] _angularVelocities Array of _count angular
+      /// velocity vectors, each specified in the same reference frame
+      /// as the base of the corresponding quaternion.
+      /// \param[in] _count Number of bodies.
+      /// \param[in] _deltaT Time interval in seconds to integrate
+      /// over.
+      public: static void IntegrateBatch(Quaternion<T> *_rotations,
+                  const Vector3<T> *_angularVelocities,
+                  const size_t _count, const T _deltaT)
+      {
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const Vector3<T> theta =
+              _angularVelocities[i] * _deltaT * 0.5;
+          const T thetaMagSq = theta.SquaredLength();
+          T dw, s;
+          if (thetaMagSq * thetaMagSq / 24.0 < MIN_D)
+          {
+            dw = 1.0 - thetaMagSq / 2.0;
+            s = 1.0 - thetaMagSq / 6.0;
+          }
+          else
+          {
+            const double thetaMag = sqrt(thetaMagSq);
+            dw = cos(thetaMag);
+            s = sin(thetaMag) / thetaMag;
+          }
+          const T dx = theta.X() * s;
+          const T dy = theta.Y() * s;
+          const T dz = theta.Z() * s;
+
+          // _rotations[i] = delta * _rotations[i], expanded in place.
+          Quaternion<T> &q = _rotations[i];
+          const T qw = q.qw, qx = q.qx, qy = q.qy, qz = q.qz;
+          q.qw = dw*qw - dx*qx - dy*qy - dz*qz;
+          q.qx = dw*qx + dx*qw + dy*qz - dz*qy;
+          q.qy = dw*qy - dx*qz + dy*qw + dz*qx;
+          q.qz = dw*qz + dx*qy - dy*qx + dz*qw;
+        }
+      }
+
       /// \brief Get the w component.
       /// \return The w quaternion component.
       public: inline const T &W() const
@@ -1088,9 +1330,46 @@ namespace ignition
     template<typename T> const Quaternion<T>
       Quaternion<T>::Zero(0, 0, 0, 0);
 
+    /// \brief Float-specialized Normalize: a reciprocal square root
+    /// with Newton refinement replaces the square root and four
+    /// divisions. The zero-norm guard matches the generic path.
+    template<>
+    inline void Quaternion<float>::Normalize()
+    {
+      const float s2 = this->qw * this->qw + this->qx * this->qx +
+          this->qy * this->qy + this->qz * this->qz;
+      if (s2 <= 1e-12f)
+      {
+        this->qw = 1.0f;
+        this->qx = 0.0f;
+        this->qy = 0.0f;
+        this->qz = 0.0f;
+      }
+      else
+      {
+        const float inv = detail::InverseSqrt(s2);
+        this->qw *= inv;
+        this->qx *= inv;
+        this->qy *= inv;
+        this->qz *= inv;
+      }
+    }
+
     typedef Quaternion<double> Quaterniond;
     typedef Quaternion<float> Quaternionf;
     typedef Quaternion<int> Quaternioni;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Quaternion<int>;
+    extern template class Quaternion<double>;
+    extern template class Quaternion<float>;
+#endif
     }
   }
 }
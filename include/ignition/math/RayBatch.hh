@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_RAYBATCH_HH_
+#define IGNITION_MATH_RAYBATCH_HH_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/OrientedBox.hh>
+#include <ignition/math/Plane.hh>
+#include <ignition/math/Triangle3.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declaration of private data
+    class RayBatchPrivate;
+
+    /// \brief Casts many rays against many primitives at once.
+    ///
+    /// The single-primitive calls Plane::Distance, Triangle3::Intersects
+    /// and OrientedBox::Contains dominate profiles when a sensor casts
+    /// hundreds of thousands of rays per scan. RayBatch stores the rays
+    /// in structure-of-arrays form and intersects all of them against
+    /// each primitive in tight component loops that vectorize, keeping
+    /// the nearest hit distance per ray across any number of Cast calls.
+    ///
+    /// Typical use: SetRays() once per scan, any sequence of CastPlanes,
+    /// CastTriangles and CastBoxes, then read the hit distances back
+    /// with Range() or Ranges().
+    class IGNITION_MATH_VISIBLE RayBatch
+    {
+      /// \brief Default constructor. The batch starts empty.
+      public: RayBatch();
+
+      /// \brief Destructor
+      public: ~RayBatch();
+
+      /// \brief Load a set of rays and reset all hit distances to
+      /// \p _maxRange.
+      /// \param[in] _origins Array of ray origins.
+      /// \param[in] _directions Array of ray directions. The directions
+      /// are normalized, so hit distances are Euclidean.
+      /// \param[in] _count Number of rays.
+      /// \param[in] _maxRange Maximum hit distance; intersections beyond
+      /// it are ignored.
+      public: void SetRays(const Vector3d *_origins,
+                  const Vector3d *_directions, size_t _count,
+                  double _maxRange = MAX_D);
+
+      /// \brief Get the number of rays in the batch.
+      /// \return Ray count.
+      public: size_t RayCount() const;
+
+      /// \brief Intersect all rays with a set of planes, keeping the
+      /// nearest hit per ray.
+      /// \param[in] _planes Array of planes.
+      /// \param[in] _count Number of planes.
+      public: void CastPlanes(const Planed *_planes, size_t _count);
+
+      /// \brief Intersect all rays with a set of triangles, keeping the
+      /// nearest hit per ray.
+      /// \param[in] _triangles Array of triangles.
+      /// \param[in] _count Number of triangles.
+      public: void CastTriangles(const Triangle3d *_triangles,
+                  size_t _count);
+
+      /// \brief Intersect all rays with a set of oriented boxes, keeping
+      /// the nearest hit per ray. A ray starting inside a box reports a
+      /// hit at distance zero.
+      /// \param[in] _boxes Array of boxes.
+      /// \param[in] _count Number of boxes.
+      public: void CastBoxes(const OrientedBoxd *_boxes, size_t _count);
+
+      /// \brief Get the nearest hit distance of one ray.
+      /// \param[in] _ray Ray index.
+      /// \return Distance along the (normalized) ray to the nearest
+      /// intersection, or the batch's maximum range when nothing was
+      /// hit or the index is invalid.
+      public: double Range(size_t _ray) const;
+
+      /// \brief Get whether a ray has hit anything.
+      /// \param[in] _ray Ray index.
+      /// \return True when a Cast call found an intersection within
+      /// range for this ray.
+      public: bool Hit(size_t _ray) const;
+
+      /// \brief Get the nearest hit distances of all rays.
+      /// \return One distance per ray, in the order given to SetRays().
+      public: const std::vector<double> &Ranges() const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<RayBatchPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,7 @@
 #ifndef IGNITION_MATH_ROLLINGMEAN_HH_
 #define IGNITION_MATH_ROLLINGMEAN_HH_
 
+#include <cstddef>
 #include <memory>
 #include <ignition/math/Export.hh>
 #include <ignition/math/config.hh>
@@ -55,10 +56,28 @@ namespace ignition
       /// \return The number of datapoints.
       public: size_t Count() const;
 
+      /// \brief Get the minimum of the values in the window.
+      /// \return The current windowed minimum, or
+      /// std::numeric_limits<double>::quiet_NaN() if data points are not
+      /// present.
+      public: double Min() const;
+
+      /// \brief Get the maximum of the values in the window.
+      /// \return The current windowed maximum, or
+      /// std::numeric_limits<double>::quiet_NaN() if data points are not
+      /// present.
+      public: double Max() const;
+
       /// \brief Insert a new value.
       /// \param[in] _value New value to insert.
       public: void Push(double _value);
 
+      /// \brief Insert a batch of values, equivalent to pushing them
+      /// one at a time in order.
+      /// \param[in] _values Array of values to insert.
+      /// \param[in] _count Number of values.
+      public: void Push(const double *_values, size_t _count);
+
       /// \brief Remove all the pushed values.
       public: void Clear();
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_ROLLINGMEANBANK_HH_
+#define IGNITION_MATH_ROLLINGMEANBANK_HH_
+
+#include <cstddef>
+#include <memory>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declarations.
+    class RollingMeanBankPrivate;
+
+    /// \brief A bank of rolling means over a fixed number of channels
+    /// that are always pushed together, such as the per-wheel encoder
+    /// speeds of a robot fleet updated once per tick. All channels
+    /// share one window, and their ring buffers are interleaved in a
+    /// single contiguous allocation, so one Push updates every channel
+    /// in one cache-linear pass instead of touching scattered
+    /// RollingMean objects. Each channel's mean matches what a
+    /// RollingMean with the same window would report for the same
+    /// sequence of values. The windowed minimum and maximum of
+    /// RollingMean are not provided; their per-channel deques would
+    /// reintroduce the scattered accesses this class exists to avoid.
+    class IGNITION_MATH_VISIBLE RollingMeanBank
+    {
+      /// \brief Constructor
+      /// \param[in] _channels Number of channels in the bank. A value
+      /// of zero is treated as one.
+      /// \param[in] _windowSize The window size to use. This value will
+      /// be ignored if it is equal to zero.
+      public: explicit RollingMeanBank(size_t _channels,
+                  size_t _windowSize = 10);
+
+      /// \brief Destructor.
+      public: ~RollingMeanBank();
+
+      /// \brief Get the number of channels.
+      /// \return The channel count.
+      public: size_t ChannelCount() const;
+
+      /// \brief Get the mean value of a channel.
+      /// \param[in] _channel Channel index.
+      /// \return The channel's current mean value, or
+      /// std::numeric_limits<double>::quiet_NaN() if data points are
+      /// not present or the channel index is out of range.
+      public: double Mean(size_t _channel) const;
+
+      /// \brief Get the mean values of all channels.
+      /// \param[out] _means Destination array of ChannelCount()
+      /// values. Channels without data points are set to
+      /// std::numeric_limits<double>::quiet_NaN().
+      public: void Means(double *_means) const;
+
+      /// \brief Get the number of data points per channel.
+      /// \return The number of data points in the shared window.
+      public: size_t Count() const;
+
+      /// \brief Insert one new value per channel.
+      /// \param[in] _values Array of ChannelCount() values, one per
+      /// channel in channel order.
+      public: void Push(const double *_values);
+
+      /// \brief Remove all the pushed values.
+      public: void Clear();
+
+      /// \brief Set the new window size. This will also clear the data.
+      /// Nothing happens if the _windowSize is zero.
+      /// \param[in] _windowSize The window size to use.
+      public: void SetWindowSize(size_t _windowSize);
+
+      /// \brief Get the window size.
+      /// \return The window size.
+      public: size_t WindowSize() const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<RollingMeanBankPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+
+#endif
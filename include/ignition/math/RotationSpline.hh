@@ -61,7 +61,11 @@ namespace ignition
       public: void Clear();
 
       /// \brief Updates a single point in the spline.
-      /// \remarks This point must already exist in the spline.
+      /// \remarks This point must already exist in the spline. A
+      /// tangent depends only on the two neighbouring points, so moving
+      /// an interior point of an open spline recomputes just the three
+      /// affected tangents; endpoint updates and closed splines
+      /// recompute every tangent.
       /// \param[in] _index index
       /// \param[in] _value the new control point value
       /// \return True on success, false if _index is larger or equal than
@@ -94,6 +98,18 @@ namespace ignition
       public: Quaterniond Interpolate(const unsigned int _fromIndex,
                   const double _t, const bool _useShortestPath = true);
 
+      /// \brief Interpolates the rotation spline at many parameter
+      /// values in one call, equivalent to calling Interpolate() per
+      /// value with the loop invariant checks hoisted out.
+      /// \param[in] _params parameter values (range 0 to 1).
+      /// \param[in] _count number of parameter values.
+      /// \param[out] _out destination array; must have room for
+      /// \p _count samples.
+      /// \param[in] _useShortestPath when true, interpolate across the
+      /// shortest path between rotations.
+      public: void Sample(const double *_params, const size_t _count,
+                  Quaterniond *_out, const bool _useShortestPath = true);
+
       /// \brief Tells the spline whether it should automatically calculate
       ///        tangents on demand as points are added.
       /// \remarks The spline calculates tangents at each point automatically
@@ -116,6 +132,16 @@ namespace ignition
       /// completing your updates to the spline points.
       public: void RecalcTangents();
 
+      /// \internal
+      /// \brief Recomputes the single tangent at \p _index using the
+      /// same formulas as RecalcTangents().
+      /// \param[in] _index tangent index; must be a valid point index
+      /// and tangents must already be sized to the point count.
+      /// \param[in] _isClosed True when the spline is closed, i.e. the
+      /// first and last control points are equal.
+      private: void RecalcTangent(const unsigned int _index,
+                   const bool _isClosed);
+
       /// \brief Private data pointer
       private: RotationSplinePrivate *dataPtr;
     };
@@ -18,6 +18,7 @@
 #ifndef IGNITION_MATH_SEMANTICVERSION_HH_
 #define IGNITION_MATH_SEMANTICVERSION_HH_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <ignition/math/Helpers.hh>
@@ -72,6 +73,14 @@ namespace ignition
       /// \brief Destructor
       public: ~SemanticVersion();
 
+      /// \brief Sort an array of versions in ascending precedence.
+      /// Comparisons use the canonical form cached at construction, so
+      /// sorting large version sets does no string tokenization.
+      /// \param[in, out] _versions Array of versions to sort in place.
+      /// \param[in] _count Number of versions.
+      public: static void Sort(SemanticVersion *_versions,
+                  const size_t _count);
+
       /// \brief Parse a version string and set the major, minor, patch
       /// numbers, and prerelease and build strings.
       /// \param[in] _versionStr The version string, such as "1.2.3-pr+123"
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_SHAPETRAITS_HH_
+#define IGNITION_MATH_SHAPETRAITS_HH_
+
+#include <cstddef>
+#include <vector>
+
+#include <ignition/math/Box.hh>
+#include <ignition/math/Capsule.hh>
+#include <ignition/math/Cylinder.hh>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Sphere.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief Uniform compile-time interface over the primitive shape
+    /// classes (Box, Capsule, Cylinder, Sphere).
+    ///
+    /// The shape classes expose Volume() and DensityFromMass() but share
+    /// no base class, so generic code would otherwise dispatch through a
+    /// variant or virtual layer in hot loops. A ShapeTraits
+    /// specialization instead describes each shape as a fixed number of
+    /// scalar parameters plus constexpr formulas over them, letting the
+    /// compiler resolve every query statically. ShapeSoA builds on this
+    /// to answer bulk queries over packed parameter arrays.
+    /// \tparam ShapeT One of the primitive shape class templates.
+    template<typename ShapeT>
+    struct ShapeTraits;
+
+    /// \brief ShapeTraits for Box: parameters are the three side
+    /// lengths.
+    template<typename T>
+    struct ShapeTraits<Box<T>>
+    {
+      /// \brief Scalar type of the shape.
+      using Precision = T;
+
+      /// \brief Number of scalar parameters per shape.
+      static constexpr std::size_t kParamCount = 3;
+
+      /// \brief Extract the parameters of a shape.
+      /// \param[in] _shape Source shape.
+      /// \param[out] _params Destination for kParamCount scalars.
+      public: static void Parameters(const Box<T> &_shape, T *_params)
+      {
+        const Vector3<T> size = _shape.Size();
+        _params[0] = size.X();
+        _params[1] = size.Y();
+        _params[2] = size.Z();
+      }
+
+      /// \brief Volume from packed parameters.
+      /// \param[in] _params kParamCount scalars.
+      /// \return The volume.
+      public: static constexpr T Volume(const T *_params)
+      {
+        return _params[0] * _params[1] * _params[2];
+      }
+
+      /// \brief Axis-aligned bounds of the shape centered on its
+      /// origin.
+      /// \param[in] _params kParamCount scalars.
+      /// \param[out] _min Minimum corner.
+      /// \param[out] _max Maximum corner.
+      public: static void Bounds(const T *_params,
+                  Vector3<T> &_min, Vector3<T> &_max)
+      {
+        _max.Set(_params[0] / 2, _params[1] / 2, _params[2] / 2);
+        _min = -_max;
+      }
+    };
+
+    /// \brief ShapeTraits for Sphere: the parameter is the radius.
+    template<typename T>
+    struct ShapeTraits<Sphere<T>>
+    {
+      /// \brief Scalar type of the shape.
+      using Precision = T;
+
+      /// \brief Number of scalar parameters per shape.
+      static constexpr std::size_t kParamCount = 1;
+
+      /// \brief Extract the parameters of a shape.
+      /// \param[in] _shape Source shape.
+      /// \param[out] _params Destination for kParamCount scalars.
+      public: static void Parameters(const Sphere<T> &_shape, T *_params)
+      {
+        _params[0] = _shape.Radius();
+      }
+
+      /// \brief Volume from packed parameters.
+      /// \param[in] _params kParamCount scalars.
+      /// \return The volume.
+      public: static constexpr T Volume(const T *_params)
+      {
+        return (4.0 / 3.0) * IGN_PI *
+            _params[0] * _params[0] * _params[0];
+      }
+
+      /// \brief Axis-aligned bounds of the shape centered on its
+      /// origin.
+      /// \param[in] _params kParamCount scalars.
+      /// \param[out] _min Minimum corner.
+      /// \param[out] _max Maximum corner.
+      public: static void Bounds(const T *_params,
+                  Vector3<T> &_min, Vector3<T> &_max)
+      {
+        _max.Set(_params[0], _params[0], _params[0]);
+        _min = -_max;
+      }
+    };
+
+    /// \brief ShapeTraits for Cylinder: parameters are length and
+    /// radius; the axis is Z as in Cylinder itself.
+    template<typename T>
+    struct ShapeTraits<Cylinder<T>>
+    {
+      /// \brief Scalar type of the shape.
+      using Precision = T;
+
+      /// \brief Number of scalar parameters per shape.
+      static constexpr std::size_t kParamCount = 2;
+
+      /// \brief Extract the parameters of a shape.
+      /// \param[in] _shape Source shape.
+      /// \param[out] _params Destination for kParamCount scalars.
+      public: static void Parameters(const Cylinder<T> &_shape, T *_params)
+      {
+        _params[0] = _shape.Length();
+        _params[1] = _shape.Radius();
+      }
+
+      /// \brief Volume from packed parameters.
+      /// \param[in] _params kParamCount scalars.
+      /// \return The volume.
+      public: static constexpr T Volume(const T *_params)
+      {
+        return IGN_PI * _params[1] * _params[1] * _params[0];
+      }
+
+      /// \brief Axis-aligned bounds of the shape centered on its
+      /// origin, ignoring any rotational offset.
+      /// \param[in] _params kParamCount scalars.
+      /// \param[out] _min Minimum corner.
+      /// \param[out] _max Maximum corner.
+      public: static void Bounds(const T *_params,
+                  Vector3<T> &_min, Vector3<T> &_max)
+      {
+        _max.Set(_params[1], _params[1], _params[0] / 2);
+        _min = -_max;
+      }
+    };
+
+    /// \brief ShapeTraits for Capsule: parameters are length and
+    /// radius; the axis is Z as in Capsule itself.
+    template<typename T>
+    struct ShapeTraits<Capsule<T>>
+    {
+      /// \brief Scalar type of the shape.
+      using Precision = T;
+
+      /// \brief Number of scalar parameters per shape.
+      static constexpr std::size_t kParamCount = 2;
+
+      /// \brief Extract the parameters of a shape.
+      /// \param[in] _shape Source shape.
+      /// \param[out] _params Destination for kParamCount scalars.
+      public: static void Parameters(const Capsule<T> &_shape, T *_params)
+      {
+        _params[0] = _shape.Length();
+        _params[1] = _shape.Radius();
+      }
+
+      /// \brief Volume from packed parameters.
+      /// \param[in] _params kParamCount scalars.
+      /// \return The volume.
+      public: static constexpr T Volume(const T *_params)
+      {
+        return IGN_PI * _params[1] * _params[1] *
+            (_params[0] + 4.0 / 3.0 * _params[1]);
+      }
+
+      /// \brief Axis-aligned bounds of the shape centered on its
+      /// origin, including the hemispherical caps.
+      /// \param[in] _params kParamCount scalars.
+      /// \param[out] _min Minimum corner.
+      /// \param[out] _max Maximum corner.
+      public: static void Bounds(const T *_params,
+                  Vector3<T> &_min, Vector3<T> &_max)
+      {
+        _max.Set(_params[1], _params[1], _params[0] / 2 + _params[1]);
+        _min = -_max;
+      }
+    };
+
+    /// \brief Structure-of-arrays storage for one shape type.
+    ///
+    /// Shapes are decomposed into their scalar parameters through
+    /// ShapeTraits and stored contiguously, so the bulk queries are
+    /// plain loops over packed arrays with no per-element dispatch at
+    /// all — the shape type is fixed at compile time.
+    /// \tparam ShapeT One of the primitive shape class templates.
+    template<typename ShapeT>
+    class ShapeSoA
+    {
+      /// \brief The traits describing ShapeT.
+      public: using Traits = ShapeTraits<ShapeT>;
+
+      /// \brief Scalar type of the stored shapes.
+      public: using Precision = typename Traits::Precision;
+
+      /// \brief Append a shape's parameters.
+      /// \param[in] _shape The shape to store.
+      public: void PushBack(const ShapeT &_shape)
+      {
+        const std::size_t offset = this->params.size();
+        this->params.resize(offset + Traits::kParamCount);
+        Traits::Parameters(_shape, this->params.data() + offset);
+      }
+
+      /// \brief Get the number of stored shapes.
+      /// \return The shape count.
+      public: std::size_t Size() const
+      {
+        return this->params.size() / Traits::kParamCount;
+      }
+
+      /// \brief Remove all stored shapes.
+      public: void Clear()
+      {
+        this->params.clear();
+      }
+
+      /// \brief Get the volume of one stored shape.
+      /// \param[in] _index Shape index; must be less than Size().
+      /// \return The volume.
+      public: Precision Volume(const std::size_t _index) const
+      {
+        return Traits::Volume(
+            this->params.data() + _index * Traits::kParamCount);
+      }
+
+      /// \brief Compute the volume of every stored shape.
+      /// \param[out] _volumes Destination array of Size() volumes.
+      public: void VolumeBatch(Precision *_volumes) const
+      {
+        const Precision *p = this->params.data();
+        const std::size_t n = this->Size();
+        for (std::size_t i = 0; i < n; ++i, p += Traits::kParamCount)
+          _volumes[i] = Traits::Volume(p);
+      }
+
+      /// \brief Compute the uniform density matching a mass for every
+      /// stored shape.
+      /// \param[in] _masses Array of Size() masses in kg.
+      /// \param[out] _densities Destination array of Size() densities
+      /// in kg/m^3; a non-positive mass or volume yields -1.
+      public: void DensityFromMassBatch(const Precision *_masses,
+                  Precision *_densities) const
+      {
+        const Precision *p = this->params.data();
+        const std::size_t n = this->Size();
+        for (std::size_t i = 0; i < n; ++i, p += Traits::kParamCount)
+        {
+          const Precision volume = Traits::Volume(p);
+          _densities[i] = (volume > 0 && _masses[i] > 0) ?
+              _masses[i] / volume : static_cast<Precision>(-1);
+        }
+      }
+
+      /// \brief Compute the origin-centered axis-aligned bounds of
+      /// every stored shape.
+      /// \param[out] _mins Destination array of Size() minimum corners.
+      /// \param[out] _maxs Destination array of Size() maximum corners.
+      public: void BoundsBatch(Vector3<Precision> *_mins,
+                  Vector3<Precision> *_maxs) const
+      {
+        const Precision *p = this->params.data();
+        const std::size_t n = this->Size();
+        for (std::size_t i = 0; i < n; ++i, p += Traits::kParamCount)
+          Traits::Bounds(p, _mins[i], _maxs[i]);
+      }
+
+      /// \brief The packed parameters, kParamCount per shape.
+      private: std::vector<Precision> params;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_SIGNALPIPELINE_HH_
+#define IGNITION_MATH_SIGNALPIPELINE_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <ignition/math/MovingWindowFilter.hh>
+#include <ignition/math/SignalStats.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief A fused filter -> decimator -> statistics pipeline over
+    /// sample buffers.
+    ///
+    /// Running MovingWindowFilter smoothing and SignalStats
+    /// accumulation as two passes writes every filtered sample to an
+    /// intermediate buffer and reads it straight back, doubling the
+    /// memory traffic of a telemetry plane for no benefit. This
+    /// pipeline composes the stages instead: Process() makes one pass
+    /// over the raw samples, pushes each through the filter stage,
+    /// keeps every Nth filtered value (the decimator), and feeds it to
+    /// the statistics sink while it is still in a register. The result
+    /// per channel is identical to the two-pass version.
+    ///
+    /// The stages are template parameters so each channel can be
+    /// configured independently: FilterT needs Update(double), Value()
+    /// and Reset() (FixedMovingWindowFilter, the default, or any type
+    /// with that surface); StatsT needs InsertData(double) and Reset()
+    /// (SignalStats, the default, or a StaticSignalStats
+    /// instantiation). Stage options such as the window size or the
+    /// statistics set are configured through Filter() and Stats().
+    template<typename FilterT = FixedMovingWindowFilter<double>,
+             typename StatsT = SignalStats>
+    class SignalPipeline
+    {
+      /// \brief Constructor.
+      /// \param[in] _decimation Keep one filtered sample out of this
+      /// many; 1 (the default) keeps every sample. A value of zero is
+      /// treated as one.
+      public: explicit SignalPipeline(const std::size_t _decimation = 1)
+        : decimation(std::max<std::size_t>(1, _decimation))
+      {
+      }
+
+      /// \brief Push a buffer of raw samples through the pipeline in
+      /// one pass.
+      /// \param[in] _data Buffer of raw samples.
+      /// \param[in] _count Number of samples.
+      public: void Process(const double *_data, const std::size_t _count)
+      {
+        for (std::size_t i = 0; i < _count; ++i)
+        {
+          this->filter.Update(_data[i]);
+          if (++this->phase >= this->decimation)
+          {
+            this->phase = 0;
+            this->stats.InsertData(this->filter.Value());
+          }
+        }
+      }
+
+      /// \brief Get the filter stage, e.g. to set its window size.
+      /// \return A reference to the filter.
+      public: FilterT &Filter()
+      {
+        return this->filter;
+      }
+
+      /// \brief Get the filter stage.
+      /// \return A const reference to the filter.
+      public: const FilterT &Filter() const
+      {
+        return this->filter;
+      }
+
+      /// \brief Get the statistics sink, e.g. to insert statistics or
+      /// read values.
+      /// \return A reference to the statistics.
+      public: StatsT &Stats()
+      {
+        return this->stats;
+      }
+
+      /// \brief Get the statistics sink.
+      /// \return A const reference to the statistics.
+      public: const StatsT &Stats() const
+      {
+        return this->stats;
+      }
+
+      /// \brief Get the decimation factor.
+      /// \return How many filtered samples produce one statistics
+      /// insertion.
+      public: std::size_t Decimation() const
+      {
+        return this->decimation;
+      }
+
+      /// \brief Set the decimation factor and restart the decimation
+      /// phase. Accumulated statistics are kept.
+      /// \param[in] _decimation Keep one filtered sample out of this
+      /// many. A value of zero is treated as one.
+      public: void SetDecimation(const std::size_t _decimation)
+      {
+        this->decimation = std::max<std::size_t>(1, _decimation);
+        this->phase = 0;
+      }
+
+      /// \brief Forget all previous data in every stage.
+      public: void Reset()
+      {
+        this->filter.Reset();
+        this->stats.Reset();
+        this->phase = 0;
+      }
+
+      /// \brief The filter stage.
+      private: FilterT filter;
+
+      /// \brief The statistics sink.
+      private: StatsT stats;
+
+      /// \brief Decimation factor.
+      private: std::size_t decimation = 1;
+
+      /// \brief Filtered samples seen since the last insertion.
+      private: std::size_t phase = 0;
+    };
+
+    /// \brief A bank of SignalPipeline channels, one pipeline per
+    /// channel, such as the channels of a telemetry plane that are
+    /// smoothed, decimated and summarized with per-channel settings.
+    /// Configure a channel through Channel(i); all channels share the
+    /// stage types.
+    template<typename FilterT = FixedMovingWindowFilter<double>,
+             typename StatsT = SignalStats>
+    class SignalPipelineBank
+    {
+      /// \brief Constructor.
+      /// \param[in] _channels Number of channels in the bank. A value
+      /// of zero is treated as one.
+      /// \param[in] _decimation Initial decimation factor of every
+      /// channel.
+      public: explicit SignalPipelineBank(const std::size_t _channels,
+                  const std::size_t _decimation = 1)
+        : pipelines(std::max<std::size_t>(1, _channels),
+              SignalPipeline<FilterT, StatsT>(_decimation))
+      {
+      }
+
+      /// \brief Get the number of channels.
+      /// \return The channel count.
+      public: std::size_t ChannelCount() const
+      {
+        return this->pipelines.size();
+      }
+
+      /// \brief Get a channel's pipeline.
+      /// \param[in] _channel Channel index; not range checked.
+      /// \return A reference to the channel's pipeline.
+      public: SignalPipeline<FilterT, StatsT> &Channel(
+                  const std::size_t _channel)
+      {
+        return this->pipelines[_channel];
+      }
+
+      /// \brief Get a channel's pipeline.
+      /// \param[in] _channel Channel index; not range checked.
+      /// \return A const reference to the channel's pipeline.
+      public: const SignalPipeline<FilterT, StatsT> &Channel(
+                  const std::size_t _channel) const
+      {
+        return this->pipelines[_channel];
+      }
+
+      /// \brief Push a buffer of raw samples through one channel.
+      /// \param[in] _channel Channel index; not range checked.
+      /// \param[in] _data Buffer of raw samples.
+      /// \param[in] _count Number of samples.
+      public: void Process(const std::size_t _channel,
+                  const double *_data, const std::size_t _count)
+      {
+        this->pipelines[_channel].Process(_data, _count);
+      }
+
+      /// \brief Forget all previous data in every channel.
+      public: void Reset()
+      {
+        for (auto &pipeline : this->pipelines)
+          pipeline.Reset();
+      }
+
+      /// \brief One pipeline per channel.
+      private: std::vector<SignalPipeline<FilterT, StatsT>> pipelines;
+    };
+    }
+  }
+}
+#endif
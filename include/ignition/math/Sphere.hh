@@ -17,8 +17,13 @@
 #ifndef IGNITION_MATH_SPHERE_HH_
 #define IGNITION_MATH_SPHERE_HH_
 
+#include <cstddef>
+#include <cstdint>
+
+#include "ignition/math/AxisAlignedBox.hh"
 #include "ignition/math/MassMatrix3.hh"
 #include "ignition/math/Material.hh"
+#include "ignition/math/Pose3.hh"
 #include "ignition/math/Quaternion.hh"
 
 namespace ignition
@@ -79,6 +84,21 @@ namespace ignition
       /// could be due to an invalid radius (<=0) or density (<=0).
       public: bool MassMatrix(MassMatrix3d &_massMat) const;
 
+      /// \brief Compute the mass matrix of many spheres in one call.
+      /// The per-shape work is identical to MassMatrix; the batch form
+      /// keeps the evaluation in a single tight loop for load-time
+      /// passes over large shape arrays.
+      /// \param[in] _spheres Array of spheres.
+      /// \param[in] _count Number of spheres.
+      /// \param[out] _massMats Destination array of _count mass
+      /// matrices; an entry whose parameters are invalid is left
+      /// untouched.
+      /// \param[out] _valid Destination array of _count flags, set to
+      /// 1 where the mass matrix was computed and 0 otherwise.
+      public: static void MassMatrixBatch(const Sphere<Precision> *_spheres,
+                  const size_t _count, MassMatrix3d *_massMats,
+                  uint8_t *_valid);
+
       /// \brief Check if this sphere is equal to the provided sphere.
       /// Radius and material properties will be checked.
       public: bool operator==(const Sphere &_sphere) const;
@@ -101,6 +121,18 @@ namespace ignition
       /// returned if radius or _mass is <= 0.
       public: Precision DensityFromMass(const Precision _mass) const;
 
+      /// \brief Compute DensityFromMass for many spheres in one call.
+      /// \param[in] _spheres Array of spheres.
+      /// \param[in] _masses Array of _count masses in kg.
+      /// \param[out] _densities Destination array of _count densities
+      /// in kg/m^3; entries follow the scalar DensityFromMass
+      /// conventions, including its negative value on invalid input.
+      /// \param[in] _count Number of spheres.
+      public: static void DensityFromMassBatch(
+                  const Sphere<Precision> *_spheres,
+                  const Precision *_masses, Precision *_densities,
+                  const size_t _count);
+
       /// \brief Set the density of this sphere based on a mass value.
       /// Density is computed using
       /// Precision DensityFromMass(const Precision _mass) const. The
@@ -115,9 +147,48 @@ namespace ignition
       /// \sa Precision DensityFromMass(const Precision _mass) const
       public: bool SetDensityFromMass(const Precision _mass);
 
+      /// \brief Get the axis aligned bounding box of the sphere at a
+      /// given pose.
+      /// \param[in] _pose Pose of the sphere center in the world frame.
+      /// \return The world frame bounding box, in double precision.
+      public: AxisAlignedBox AxisAlignedBoundingBox(
+                  const Pose3d &_pose = Pose3d::Zero) const;
+
+      /// \brief Compute AxisAlignedBoundingBox for many spheres in one
+      /// call.
+      /// \param[in] _spheres Array of spheres.
+      /// \param[in] _poses Array of _count poses, one per sphere.
+      /// \param[in] _count Number of spheres.
+      /// \param[out] _boxes Destination array of _count bounding boxes.
+      public: static void AxisAlignedBoundingBoxBatch(
+                  const Sphere<Precision> *_spheres, const Pose3d *_poses,
+                  const size_t _count, AxisAlignedBox *_boxes);
+
+      /// \brief Get the point of the sphere farthest along a
+      /// direction, in the sphere's local frame. This is the support
+      /// function used by GJK-style collision algorithms.
+      /// \param[in] _dir The direction; it need not be normalized. A
+      /// zero direction returns the center.
+      /// \return The support point.
+      public: Vector3<Precision> SupportPoint(
+                  const Vector3<Precision> &_dir) const;
+
+      /// \brief Compute SupportPoint for many directions in one call.
+      /// \param[in] _dirs Array of directions.
+      /// \param[in] _count Number of directions.
+      /// \param[out] _points Destination array of _count support
+      /// points.
+      public: void SupportPointBatch(const Vector3<Precision> *_dirs,
+                  const size_t _count, Vector3<Precision> *_points) const;
+
       /// \brief Radius of the sphere.
       private: Precision radius = 0.0;
 
+      /// \brief Volume of the sphere, derived from the radius on the
+      /// first Volume() call and reused until the radius changes. A
+      /// negative value marks the cache as stale.
+      private: mutable Precision cachedVolume = -1.0;
+
       /// \brief the sphere's material.
       private: ignition::math::Material material;
     };
@@ -17,10 +17,13 @@
 #ifndef IGNITION_MATH_SPHERICALCOORDINATES_HH_
 #define IGNITION_MATH_SPHERICALCOORDINATES_HH_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
 #include <ignition/math/Angle.hh>
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Vector2.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/config.hh>
@@ -124,6 +127,58 @@ namespace ignition
                                      const ignition::math::Angle &_latB,
                                      const ignition::math::Angle &_lonB);
 
+      /// \brief Get the distance between many point pairs at once,
+      /// over packed coordinate arrays in radians. Each result equals
+      /// Distance() on the pair, but the haversine runs in one
+      /// contiguous loop with the shared terms evaluated once per
+      /// pair instead of once per Angle operation. When only a
+      /// threshold test is needed, SquaredChordBatch() is cheaper
+      /// still.
+      /// \param[in] _latA Latitudes of the first points, in radians.
+      /// \param[in] _lonA Longitudes of the first points, in radians.
+      /// \param[in] _latB Latitudes of the second points, in radians.
+      /// \param[in] _lonB Longitudes of the second points, in radians.
+      /// \param[in] _count Number of pairs.
+      /// \param[out] _distances Distance of each pair in meters.
+      public: static void DistanceBatch(const double *_latA,
+                                        const double *_lonA,
+                                        const double *_latB,
+                                        const double *_lonB,
+                                        const size_t _count,
+                                        double *_distances);
+
+      /// \brief Get the squared straight-line chord length between
+      /// many point pairs at once, over packed coordinate arrays in
+      /// radians. The chord grows monotonically with the great-circle
+      /// distance, so comparing a squared chord against
+      /// SquaredChordForDistance(threshold) gives the same verdict as
+      /// comparing Distance() against the threshold while skipping
+      /// the final asin and sqrt of the haversine entirely; this is
+      /// the comparison mode for geofence-style threshold sweeps.
+      /// \param[in] _latA Latitudes of the first points, in radians.
+      /// \param[in] _lonA Longitudes of the first points, in radians.
+      /// \param[in] _latB Latitudes of the second points, in radians.
+      /// \param[in] _lonB Longitudes of the second points, in radians.
+      /// \param[in] _count Number of pairs.
+      /// \param[out] _chordsSq Squared chord length of each pair in
+      /// square meters.
+      public: static void SquaredChordBatch(const double *_latA,
+                                            const double *_lonA,
+                                            const double *_latB,
+                                            const double *_lonB,
+                                            const size_t _count,
+                                            double *_chordsSq);
+
+      /// \brief Convert a great-circle distance threshold to the
+      /// equivalent squared chord length, for comparison against
+      /// SquaredChordBatch() results.
+      /// \param[in] _distance Great-circle distance in meters; only
+      /// meaningful up to half the Earth's circumference.
+      /// \return The squared chord length in square meters subtended
+      /// by that distance.
+      public: static double SquaredChordForDistance(
+                  const double _distance);
+
       /// \brief Get SurfaceType currently in use.
       /// \return Current SurfaceType value.
       public: SurfaceType Surface() const;
@@ -179,6 +234,57 @@ namespace ignition
       public: ignition::math::Vector3d LocalFromGlobalVelocity(
                   const ignition::math::Vector3d &_xyz) const;
 
+      /// \brief Precompute a grid of local tangent plane frames over
+      /// an operating region, so the fast position conversions below
+      /// answer queries with a cell lookup and a linear correction
+      /// instead of per-call trigonometry. Each cell stores the exact
+      /// geodetic coordinates of its center together with the local
+      /// meridional and normal curvature radii, so the residual error
+      /// is quadratic in the distance to the cell center: with 100 m
+      /// cells on Earth it stays below a millimeter. The grid is
+      /// invalidated whenever a reference parameter changes; call
+      /// this again afterwards.
+      /// \param[in] _min Minimum corner of the region, in local frame
+      /// meters.
+      /// \param[in] _max Maximum corner of the region, in local frame
+      /// meters.
+      /// \param[in] _cellSize Cell edge length in meters.
+      /// \return True on success. False if _cellSize is not positive
+      /// or the region is empty, in which case an error is printed
+      /// and no grid is built.
+      public: bool PrecomputeTangentPlaneGrid(
+                  const ignition::math::Vector2d &_min,
+                  const ignition::math::Vector2d &_max,
+                  const double _cellSize);
+
+      /// \brief Discard the precomputed tangent plane grid.
+      public: void ClearTangentPlaneGrid();
+
+      /// \brief Get the number of cells in the precomputed tangent
+      /// plane grid.
+      /// \return Cell count, zero when no grid is present.
+      public: size_t TangentPlaneGridCellCount() const;
+
+      /// \brief Convert a Cartesian position vector to geodetic
+      /// coordinates using the precomputed tangent plane grid. Falls
+      /// back to SphericalFromLocalPosition when no grid is present
+      /// or the position lies outside the precomputed region.
+      /// \param[in] _xyz Cartesian position vector in the world frame.
+      /// \return Cooordinates: geodetic latitude (deg), longitude
+      /// (deg), altitude above sea level (m).
+      public: ignition::math::Vector3d SphericalFromLocalPositionFast(
+                  const ignition::math::Vector3d &_xyz) const;
+
+      /// \brief Convert a geodetic position vector to Cartesian
+      /// coordinates using the precomputed tangent plane grid. Falls
+      /// back to LocalFromSphericalPosition when no grid is present
+      /// or the position lies outside the precomputed region.
+      /// \param[in] _xyz Geodetic position in the planetary frame of
+      /// reference.
+      /// \return Cartesian position vector in the world frame.
+      public: ignition::math::Vector3d LocalFromSphericalPositionFast(
+                  const ignition::math::Vector3d &_xyz) const;
+
       /// \brief Update coordinate transformation matrix with reference location
       public: void UpdateTransformationMatrix();
 
@@ -191,6 +297,66 @@ namespace ignition
               PositionTransform(const ignition::math::Vector3d &_pos,
                   const CoordinateType &_in, const CoordinateType &_out) const;
 
+      /// \brief Convert an array of positions between
+      /// SPHERICAL/ECEF/LOCAL/GLOBAL frames. Equivalent to calling
+      /// PositionTransform on every element, but the per-datum
+      /// invariants (rotation matrices, cached ECEF origin and heading
+      /// trig) are loaded once outside the loop, so conversions that do
+      /// not involve SPHERICAL coordinates need no per-point
+      /// trigonometry at all. _out may alias _in.
+      /// \param[in] _pos Array of position vectors in frame defined by
+      /// parameter _in.
+      /// \param[out] _out Destination array; must hold _n elements.
+      /// \param[in] _n Number of positions.
+      /// \param[in] _inType CoordinateType for input
+      /// \param[in] _outType CoordinateType for output
+      public: void PositionTransformBatch(
+                  const ignition::math::Vector3d *_pos,
+                  ignition::math::Vector3d *_out, size_t _n,
+                  const CoordinateType &_inType,
+                  const CoordinateType &_outType) const;
+
+      /// \brief Get the affine transform that maps LOCAL positions
+      /// to ECEF positions, built from the cached rotation matrices
+      /// and ECEF origin. Applying the matrix to a position is
+      /// equivalent to PositionTransform(_pos, LOCAL, ECEF), including
+      /// its heading conventions; note that PositionTransform's LOCAL
+      /// input and output conventions are not exact inverses of each
+      /// other for a nonzero heading offset, and neither are these
+      /// matrices.
+      /// \return The LOCAL to ECEF transform.
+      public: ignition::math::Matrix4d ECEFFromLocalMatrix() const;
+
+      /// \brief Get the affine transform that maps ECEF positions to
+      /// LOCAL positions. Applying the matrix to a position is
+      /// equivalent to PositionTransform(_pos, ECEF, LOCAL).
+      /// \return The ECEF to LOCAL transform.
+      /// \sa ECEFFromLocalMatrix
+      public: ignition::math::Matrix4d LocalFromECEFMatrix() const;
+
+      /// \brief Convert an array of ECEF positions to LOCAL.
+      /// Equivalent to PositionTransform(_pos, ECEF, LOCAL) on every
+      /// element, but the rotation and translation are composed once
+      /// outside the loop, leaving one matrix multiply and add per
+      /// point. _local may alias _ecef.
+      /// \param[in] _ecef Array of ECEF positions.
+      /// \param[out] _local Destination array; must hold _n elements.
+      /// \param[in] _n Number of positions.
+      public: void LocalFromECEFBatch(
+                  const ignition::math::Vector3d *_ecef,
+                  ignition::math::Vector3d *_local, size_t _n) const;
+
+      /// \brief Convert an array of LOCAL positions to ECEF.
+      /// Equivalent to PositionTransform(_pos, LOCAL, ECEF) on every
+      /// element, with the transform composed once outside the loop.
+      /// _ecef may alias _local.
+      /// \param[in] _local Array of LOCAL positions.
+      /// \param[out] _ecef Destination array; must hold _n elements.
+      /// \param[in] _n Number of positions.
+      public: void ECEFFromLocalBatch(
+                  const ignition::math::Vector3d *_local,
+                  ignition::math::Vector3d *_ecef, size_t _n) const;
+
       /// \brief Convert between velocity in SPHERICAL/ECEF/LOCAL/GLOBAL frame
       /// \param[in] _vel Velocity vector in frame defined by parameter _in
       /// \param[in] _in  CoordinateType for input
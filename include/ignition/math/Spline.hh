@@ -72,6 +72,47 @@ namespace ignition
       public: double ArcLength(const unsigned int _index,
                                const double _t) const;
 
+      /// \brief Sets the arc length error tolerance. A positive
+      /// value switches the arc length quadrature to adaptive
+      /// subdivision: each segment is bisected until the estimate is
+      /// within the tolerance, so samples concentrate in tight bends
+      /// while nearly straight segments finish after one evaluation.
+      /// Zero (the default) keeps the fixed 5 point rule on every
+      /// segment. Changing the tolerance rebuilds the spline.
+      /// \param[in] _tolerance absolute arc length error tolerance
+      /// per segment.
+      public: void SetArcLengthTolerance(const double _tolerance);
+
+      /// \brief Gets the arc length error tolerance.
+      /// \return the tolerance, or zero when the fixed quadrature
+      /// rule is in use.
+      public: double ArcLengthTolerance() const;
+
+      /// \brief Precomputes arc length lookup tables so that
+      /// FastArcLength and ParameterAtLength become constant-time
+      /// interpolated table lookups. The tables are refreshed
+      /// automatically whenever the spline is rebuilt.
+      /// \param[in] _resolution number of table intervals. Higher values
+      /// reduce the interpolation error; values below 2 are clamped to 2.
+      public: void PrecomputeArcLength(const unsigned int _resolution = 256);
+
+      /// \brief Gets spline arc length up to a given parameter value
+      /// \p _t using the precomputed lookup table with linear
+      /// interpolation. Falls back to ArcLength(_t) when
+      /// PrecomputeArcLength has not been called.
+      /// \param[in] _t parameter value (range 0 to 1).
+      /// \return arc length up to \p _t or INF on error.
+      public: double FastArcLength(const double _t) const;
+
+      /// \brief Gets the parameter value at a given arc length, the
+      /// inverse of ArcLength(_t). Constant time when
+      /// PrecomputeArcLength has been called; otherwise the answer is
+      /// obtained by bisection on ArcLength.
+      /// \param[in] _s arc length, clamped to the range
+      /// [0, ArcLength()].
+      /// \return parameter value in the range 0 to 1, or INF on error.
+      public: double ParameterAtLength(const double _s) const;
+
       /// \brief Adds a single control point to the
       /// end of the spline.
       /// \param[in] _p control point value to add.
@@ -117,6 +158,13 @@ namespace ignition
       /// \return the count
       public: size_t PointCount() const;
 
+      /// \brief Reserve storage for a number of control points, so
+      /// that repeated AddPoint() calls up to that count do not
+      /// reallocate. Useful when a trajectory of known size is
+      /// re-fitted at a high rate.
+      /// \param[in] _capacity expected number of control points.
+      public: void Reserve(const size_t _capacity);
+
       /// \brief Clears all the points in the spline.
       public: void Clear();
 
@@ -195,6 +243,26 @@ namespace ignition
       public: Vector3d InterpolateTangent(const unsigned int _fromIndex,
                                           const double _t) const;
 
+      /// \brief Evaluates the spline or one of its derivatives at many
+      /// parameter values in one call.
+      ///
+      /// Each sample shares the segment lookup and the segment
+      /// polynomial coefficients with its predecessor whenever they
+      /// fall on the same segment, so sampling a trajectory ribbon at
+      /// thousands of sorted parameters costs one binary search per
+      /// segment instead of one per sample. Results match
+      /// InterpolateMthDerivative(_mth, _t) up to floating point
+      /// rounding of the polynomial evaluation.
+      /// \param[in] _params parameter values (range 0 to 1); values
+      /// outside the range yield [INF, INF, INF].
+      /// \param[in] _count number of parameter values.
+      /// \param[out] _out destination array; must have room for
+      /// \p _count samples.
+      /// \param[in] _mth order of curve derivative to evaluate.
+      public: void Sample(const double *_params, const size_t _count,
+                          Vector3d *_out,
+                          const unsigned int _mth = 0) const;
+
       /// \brief Interpolates the mth derivative of the spline at
       /// parameter value \p _t.
       /// \param[in] _mth order of curve derivative to interpolate.
@@ -243,6 +311,18 @@ namespace ignition
       /// \brief Rebuilds spline segments.
       private: void Rebuild();
 
+      /// \internal
+      /// \brief Recomputes only the tangents, segments and cumulative
+      /// arc length suffix affected by an interior point update.
+      /// Assumes an open spline with at least one segment and
+      /// 0 < \p _index < PointCount() - 1.
+      /// \param[in] _index updated point index.
+      private: void UpdateAffectedSegments(const unsigned int _index);
+
+      /// \brief Rebuilds the arc length lookup tables.
+      /// \sa PrecomputeArcLength
+      private: void RebuildArcLengthTable();
+
       /// \internal
       /// \brief Maps \p _t parameter value over the whole spline
       /// to the right segment (starting at point \p _index) with
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_SPLINESET_HH_
+#define IGNITION_MATH_SPLINESET_HH_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Export.hh>
+#include <ignition/math/Spline.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE
+    {
+    // Forward declarations.
+    class SplineSetPrivate;
+
+    /// \brief A named collection of splines with a binary file format,
+    /// intended for large sets such as road network lane centerlines.
+    ///
+    /// The file stores each spline's control points together with its
+    /// precomputed tangents, so loading does not repeat the tangent
+    /// recalculation performed at authoring time. Loading only parses
+    /// the file into raw records; the Spline object for a record is
+    /// built on first access through SplineByName, which moves the
+    /// remaining construction cost off the load path entirely for
+    /// splines that are never queried.
+    ///
+    /// The format stores doubles in host byte order and is intended as
+    /// a cache next to the authoritative source data, not as a
+    /// portable interchange format.
+    class IGNITION_MATH_VISIBLE SplineSet
+    {
+      /// \brief Constructor.
+      public: SplineSet();
+
+      /// \brief Destructor.
+      public: ~SplineSet();
+
+      /// \brief Add a spline to the set, replacing any spline already
+      /// stored under the same name. The spline's control points,
+      /// current tangents, and tension are copied; later changes to
+      /// \p _spline do not affect the set.
+      /// \param[in] _name Name to store the spline under.
+      /// \param[in] _spline Spline to copy into the set.
+      /// \param[in] _arcLengthResolution Arc length table resolution
+      /// passed to Spline::PrecomputeArcLength when the stored spline
+      /// is finalized, or zero to skip arc length precomputation.
+      public: void AddSpline(const std::string &_name,
+                  const Spline &_spline,
+                  const unsigned int _arcLengthResolution = 256);
+
+      /// \brief Get the number of splines in the set.
+      /// \return Spline count.
+      public: size_t SplineCount() const;
+
+      /// \brief Get the number of splines that have been finalized,
+      /// i.e. turned into Spline objects by SplineByName. Useful for
+      /// verifying that loading stayed lazy.
+      /// \return Finalized spline count.
+      public: size_t FinalizedCount() const;
+
+      /// \brief Get the names of all splines in the set, in insertion
+      /// order.
+      /// \return Vector of spline names.
+      public: std::vector<std::string> Names() const;
+
+      /// \brief Get a spline by name, finalizing it on first access.
+      /// Finalization rebuilds the interpolation coefficients from the
+      /// stored points and tangents and, when a nonzero arc length
+      /// resolution was stored, precomputes the arc length table.
+      /// \param[in] _name Name of the spline to get.
+      /// \return Pointer to the spline, valid until the set is
+      /// destroyed or the name is replaced by AddSpline, or nullptr
+      /// if no spline is stored under \p _name.
+      public: Spline *SplineByName(const std::string &_name) const;
+
+      /// \brief Write the set to a file, overwriting any existing
+      /// file. Unfinalized records loaded from a file are written
+      /// back unchanged.
+      /// \param[in] _path Path of the file to write.
+      /// \return True on success. On failure an error is printed and
+      /// false is returned.
+      public: bool Save(const std::string &_path) const;
+
+      /// \brief Replace the contents of the set with the records in a
+      /// file previously written by Save. No splines are finalized by
+      /// this call. On failure the set is left unchanged.
+      /// \param[in] _path Path of the file to read.
+      /// \return True on success. On failure an error is printed and
+      /// false is returned.
+      public: bool Load(const std::string &_path);
+
+      /// \brief Remove all splines from the set.
+      public: void Clear();
+
+      /// \brief Private data pointer.
+      private: SplineSetPrivate *dataPtr = nullptr;
+    };
+    }
+  }
+}
+#endif
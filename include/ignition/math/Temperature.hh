@@ -17,6 +17,7 @@
 #ifndef IGNITION_MATH_TEMPERATURE_HH_
 #define IGNITION_MATH_TEMPERATURE_HH_
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 
@@ -33,6 +34,10 @@ namespace ignition
     // Forward declare private data class.
     class TemperaturePrivate;
 
+    // Forward declaration, to fuse conversion with accumulation
+    // without pulling in SignalStats.hh.
+    class SignalStats;
+
     /// \brief A class that stores temperature information, and allows
     /// conversion between different units.
     ///
@@ -87,11 +92,43 @@ namespace ignition
       /// \return Temperature in Celsius
       public: static double KelvinToCelsius(const double _temp);
 
+      /// \brief Convert a buffer of Kelvin values to Celsius in one
+      /// pass. Thermal frames hold millions of samples, and converting
+      /// them element by element through Temperature objects defeats
+      /// vectorization; this loop is plain arithmetic the compiler can
+      /// vectorize. The buffers may alias for in-place conversion.
+      /// \param[in] _temps Temperatures in Kelvin.
+      /// \param[out] _out Temperatures in Celsius.
+      /// \param[in] _count Number of values.
+      public: static void KelvinToCelsius(const double *_temps,
+                  double *_out, const size_t _count);
+
+      /// \brief Convert a buffer of Kelvin values to Celsius and feed
+      /// the converted samples to a SignalStats in one fused pass.
+      /// Converting a frame into a scratch buffer and then inserting
+      /// it streams the data through memory twice; this overload
+      /// converts in cache-sized chunks and accumulates each chunk
+      /// immediately, so the Celsius values never leave cache.
+      /// \param[in] _temps Temperatures in Kelvin.
+      /// \param[in] _count Number of values.
+      /// \param[out] _stats Statistics to accumulate the Celsius
+      /// values into.
+      public: static void KelvinToCelsiusAccumulate(const double *_temps,
+                  const size_t _count, SignalStats &_stats);
+
       /// \brief Convert Kelvin to Fahrenheit
       /// \param[in] _temp Temperature in Kelvin
       /// \return Temperature in Fahrenheit
       public: static double KelvinToFahrenheit(const double _temp);
 
+      /// \brief Convert a buffer of Kelvin values to Fahrenheit in
+      /// one pass. The buffers may alias for in-place conversion.
+      /// \param[in] _temps Temperatures in Kelvin.
+      /// \param[out] _out Temperatures in Fahrenheit.
+      /// \param[in] _count Number of values.
+      public: static void KelvinToFahrenheit(const double *_temps,
+                  double *_out, const size_t _count);
+
       /// \brief Convert Celsius to Fahrenheit
       /// \param[in] _temp Temperature in Celsius
       /// \return Temperature in Fahrenheit
@@ -102,6 +139,14 @@ namespace ignition
       /// \return Temperature in Kelvin
       public: static double CelsiusToKelvin(const double _temp);
 
+      /// \brief Convert a buffer of Celsius values to Kelvin in one
+      /// pass. The buffers may alias for in-place conversion.
+      /// \param[in] _temps Temperatures in Celsius.
+      /// \param[out] _out Temperatures in Kelvin.
+      /// \param[in] _count Number of values.
+      public: static void CelsiusToKelvin(const double *_temps,
+                  double *_out, const size_t _count);
+
       /// \brief Convert Fahrenheit to Celsius
       /// \param[in] _temp Temperature in Fahrenheit
       /// \return Temperature in Celsius
@@ -112,6 +157,14 @@ namespace ignition
       /// \return Temperature in Kelvin
       public: static double FahrenheitToKelvin(const double _temp);
 
+      /// \brief Convert a buffer of Fahrenheit values to Kelvin in
+      /// one pass. The buffers may alias for in-place conversion.
+      /// \param[in] _temps Temperatures in Fahrenheit.
+      /// \param[out] _out Temperatures in Kelvin.
+      /// \param[in] _count Number of values.
+      public: static void FahrenheitToKelvin(const double *_temps,
+                  double *_out, const size_t _count);
+
       /// \brief Set the temperature from a Kelvin value
       /// \param[in] _temp Temperature in Kelvin
       public: void SetKelvin(const double _temp);
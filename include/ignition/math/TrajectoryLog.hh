@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_TRAJECTORYLOG_HH_
+#define IGNITION_MATH_TRAJECTORYLOG_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class TrajectoryLogPrivate;
+
+    /// \brief A file-backed container of timestamped trajectory
+    /// records.
+    ///
+    /// A TrajectoryLog stores fixed-stride Vector3d or Pose3d records,
+    /// each preceded by its time, in a flat binary file. Appends go
+    /// through a small write-behind buffer; reads map the file into
+    /// memory where the platform supports it (falling back to seeked
+    /// reads elsewhere), so reopening a multi-gigabyte log costs
+    /// milliseconds and time-range queries run in O(log n) over the
+    /// mapped time column without loading the file. Record times must
+    /// be appended in non-decreasing order for the queries to be
+    /// meaningful.
+    ///
+    /// The on-disk format is host endian and intended for logs read on
+    /// the machine class that wrote them.
+    class IGNITION_MATH_VISIBLE TrajectoryLog
+    {
+      /// \brief The payload type of a log.
+      public: enum class RecordType
+      {
+        /// \brief Each record holds a time and a Vector3d.
+        VECTOR3 = 1,
+
+        /// \brief Each record holds a time and a Pose3d, the rotation
+        /// stored as a quaternion.
+        POSE3 = 2
+      };
+
+      /// \brief Constructor. The log is invalid until Open succeeds.
+      public: TrajectoryLog();
+
+      /// \brief Destructor. Flushes and closes the file.
+      public: virtual ~TrajectoryLog();
+
+      /// \brief Open a log file, creating it if it does not exist.
+      /// \param[in] _path File to open.
+      /// \param[in] _type Payload type; an existing file must have
+      /// been created with the same type.
+      /// \return True on success. On failure the log is invalid and a
+      /// message is printed to std::cerr.
+      public: bool Open(const std::string &_path,
+                  const RecordType _type = RecordType::POSE3);
+
+      /// \brief Flush pending appends and close the file.
+      public: void Close();
+
+      /// \brief Check whether a file is open.
+      /// \return True when the log is usable.
+      public: bool Valid() const;
+
+      /// \brief Get the payload type of the open log.
+      /// \return The record type.
+      public: RecordType Type() const;
+
+      /// \brief Get the number of records, including buffered appends.
+      /// \return The record count.
+      public: size_t Count() const;
+
+      /// \brief Append a point record. Only valid on VECTOR3 logs.
+      /// \param[in] _time Record time; must not decrease.
+      /// \param[in] _point The point.
+      /// \return True if the record was accepted.
+      public: bool Append(const double _time, const Vector3d &_point);
+
+      /// \brief Append a pose record. Only valid on POSE3 logs.
+      /// \param[in] _time Record time; must not decrease.
+      /// \param[in] _pose The pose.
+      /// \return True if the record was accepted.
+      public: bool Append(const double _time, const Pose3d &_pose);
+
+      /// \brief Write buffered appends to the file.
+      /// \return True on success.
+      public: bool Flush();
+
+      /// \brief Get the time of one record.
+      /// \param[in] _index Record index; must be less than Count().
+      /// \return The record time, or NaN for an invalid index.
+      public: double Time(const size_t _index) const;
+
+      /// \brief Read a point record. Only valid on VECTOR3 logs.
+      /// \param[in] _index Record index.
+      /// \param[out] _time Record time.
+      /// \param[out] _point The point.
+      /// \return True if the record was read.
+      public: bool Record(const size_t _index, double &_time,
+                  Vector3d &_point) const;
+
+      /// \brief Read a pose record. Only valid on POSE3 logs.
+      /// \param[in] _index Record index.
+      /// \param[out] _time Record time.
+      /// \param[out] _pose The pose.
+      /// \return True if the record was read.
+      public: bool Record(const size_t _index, double &_time,
+                  Pose3d &_pose) const;
+
+      /// \brief Locate the records with time in [_begin, _end] by
+      /// binary search over the time column; only O(log n) records are
+      /// touched, so the query does not load the file.
+      /// \param[in] _begin Start of the time range.
+      /// \param[in] _end End of the time range.
+      /// \param[out] _first Index of the first record in range.
+      /// \param[out] _count Number of records in range; zero when the
+      /// range is empty.
+      /// \return True unless the log is invalid or _end < _begin.
+      public: bool TimeRange(const double _begin, const double _end,
+                  size_t &_first, size_t &_count) const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<TrajectoryLogPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,8 @@
 #ifndef IGNITION_MATH_TRIANGLE_HH_
 #define IGNITION_MATH_TRIANGLE_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Line2.hh>
@@ -137,6 +139,95 @@ namespace ignition
         return (u >= 0) && (v >= 0) && (u + v <= 1);
       }
 
+      /// \brief Check a batch of points for containment.
+      ///
+      /// Contains() rebuilds the barycentric setup for every call;
+      /// this overload hoists it out of the loop as three precomputed
+      /// edge functions, so each point costs three multiply-adds and
+      /// three sign tests. Boundary points count as contained, like
+      /// Contains().
+      /// \param[in] _points Array of _count points to check.
+      /// \param[in] _count Number of points.
+      /// \param[out] _results Array of _count results, 1 when the
+      /// point is inside or on the triangle, 0 otherwise. Every result
+      /// is 0 for a degenerate (zero area) triangle.
+      public: void ContainsBatch(const math::Vector2<T> *_points,
+                  const size_t _count, uint8_t *_results) const
+      {
+        T a[3], b[3], c[3];
+        if (!this->EdgeFunctions(a, b, c))
+        {
+          for (size_t i = 0; i < _count; ++i)
+            _results[i] = 0;
+          return;
+        }
+
+        for (size_t i = 0; i < _count; ++i)
+        {
+          const T x = _points[i].X();
+          const T y = _points[i].Y();
+          const T e0 = a[0] * x + b[0] * y + c[0];
+          const T e1 = a[1] * x + b[1] * y + c[1];
+          const T e2 = a[2] * x + b[2] * y + c[2];
+          _results[i] = e0 >= 0 && e1 >= 0 && e2 >= 0 ? 1 : 0;
+        }
+      }
+
+      /// \brief Check a regular grid of points for containment, the
+      /// standard rasterization setup.
+      ///
+      /// The edge functions are affine, so moving one grid step
+      /// changes each of them by a constant: the whole grid is
+      /// classified with three additions per point and no
+      /// multiplications. For integer triangles the walk is exact; for
+      /// floating point types the increments accumulate rounding of
+      /// the order of one ulp per step.
+      /// \param[in] _origin Position of the grid point at column 0,
+      /// row 0.
+      /// \param[in] _step Grid spacing along x (columns) and y (rows).
+      /// \param[in] _columns Number of grid columns.
+      /// \param[in] _rows Number of grid rows.
+      /// \param[out] _results Row-major array of _columns * _rows
+      /// results, 1 when the grid point is inside or on the triangle,
+      /// 0 otherwise. Every result is 0 for a degenerate triangle.
+      public: void ContainsGrid(const math::Vector2<T> &_origin,
+                  const math::Vector2<T> &_step,
+                  const size_t _columns, const size_t _rows,
+                  uint8_t *_results) const
+      {
+        T a[3], b[3], c[3];
+        if (!this->EdgeFunctions(a, b, c))
+        {
+          for (size_t i = 0; i < _columns * _rows; ++i)
+            _results[i] = 0;
+          return;
+        }
+
+        // Edge values at the start of the current row, stepped by
+        // b * stepY per row; within a row they step by a * stepX.
+        T row0 = a[0] * _origin.X() + b[0] * _origin.Y() + c[0];
+        T row1 = a[1] * _origin.X() + b[1] * _origin.Y() + c[1];
+        T row2 = a[2] * _origin.X() + b[2] * _origin.Y() + c[2];
+
+        size_t out = 0;
+        for (size_t r = 0; r < _rows; ++r)
+        {
+          T e0 = row0;
+          T e1 = row1;
+          T e2 = row2;
+          for (size_t col = 0; col < _columns; ++col)
+          {
+            _results[out++] = e0 >= 0 && e1 >= 0 && e2 >= 0 ? 1 : 0;
+            e0 += a[0] * _step.X();
+            e1 += a[1] * _step.X();
+            e2 += a[2] * _step.X();
+          }
+          row0 += b[0] * _step.Y();
+          row1 += b[1] * _step.Y();
+          row2 += b[2] * _step.Y();
+        }
+      }
+
       /// \brief Get whether the given line intersects this triangle.
       /// \param[in] _line Line to check.
       /// \param[out] _ipt1 Return value of the first intersection point,
@@ -229,6 +320,44 @@ namespace ignition
         return this->pts[clamp(_index, IGN_ZERO_SIZE_T, IGN_TWO_SIZE_T)];
       }
 
+      /// \brief Compute the three edge functions
+      /// e_i(p) = a[i] * x + b[i] * y + c[i], oriented so that a point
+      /// is inside or on the triangle exactly when all three are
+      /// non-negative, regardless of the triangle's winding.
+      /// \param[out] _a Coefficient of x for each edge.
+      /// \param[out] _b Coefficient of y for each edge.
+      /// \param[out] _c Constant term for each edge.
+      /// \return False for a degenerate (zero area) triangle, whose
+      /// edge functions cannot classify points.
+      private: bool EdgeFunctions(T _a[3], T _b[3], T _c[3]) const
+      {
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+          const math::Vector2<T> &p = this->pts[i];
+          const math::Vector2<T> &q = this->pts[(i + 1) % 3];
+          _a[i] = p.Y() - q.Y();
+          _b[i] = q.X() - p.X();
+          _c[i] = p.X() * q.Y() - q.X() * p.Y();
+        }
+
+        // Edge 0 evaluated at the opposite vertex is the doubled
+        // signed area; flip the functions for clockwise triangles.
+        const T area2 = _a[0] * this->pts[2].X() +
+            _b[0] * this->pts[2].Y() + _c[0];
+        if (area2 == 0)
+          return false;
+        if (area2 < 0)
+        {
+          for (unsigned int i = 0; i < 3; ++i)
+          {
+            _a[i] = -_a[i];
+            _b[i] = -_b[i];
+            _c[i] = -_c[i];
+          }
+        }
+        return true;
+      }
+
       /// The points of the triangle
       private: math::Vector2<T> pts[3];
     };
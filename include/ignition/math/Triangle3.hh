@@ -269,6 +269,149 @@ namespace ignition
       private: Vector3<T> pts[3];
     };
 
+    /// \brief A Triangle3 with its intersection invariants computed
+    /// once at construction.
+    ///
+    /// Triangle3::Intersects and Triangle3::Contains recompute the
+    /// normal, the edge vectors and the barycentric projection dot
+    /// products on every call. For static geometry queried many times,
+    /// PreparedTriangle3 caches these at construction and answers the
+    /// same queries with the same results against the cached data.
+    template<typename T>
+    class PreparedTriangle3
+    {
+      /// \brief Constructor. Computes and caches the normal, the edge
+      /// vectors and the barycentric projection terms of \p _triangle.
+      /// \param[in] _triangle The triangle to prepare.
+      public: explicit PreparedTriangle3(const Triangle3<T> &_triangle)
+      : tri(_triangle), norm(_triangle.Normal()),
+        edge0(_triangle[2] - _triangle[0]),
+        edge1(_triangle[1] - _triangle[0])
+      {
+        const double dot00 = this->edge0.Dot(this->edge0);
+        const double dot11 = this->edge1.Dot(this->edge1);
+        this->dot01 = this->edge0.Dot(this->edge1);
+        this->invDenom = 1.0 / (dot00 * dot11 - this->dot01 * this->dot01);
+        this->dot00 = dot00;
+        this->dot11 = dot11;
+      }
+
+      /// \brief Get the wrapped triangle.
+      /// \return The triangle given to the constructor.
+      public: const Triangle3<T> &Triangle() const
+      {
+        return this->tri;
+      }
+
+      /// \brief Get the cached triangle normal.
+      /// \return The normal vector, identical to Triangle3::Normal().
+      public: const Vector3d &Normal() const
+      {
+        return this->norm;
+      }
+
+      /// \brief Get whether the triangle contains the given point,
+      /// using the cached barycentric projection.
+      /// \param[in] _pt Point to check.
+      /// \return True if the point is inside or on the triangle. The
+      /// result matches Triangle3::Contains.
+      public: bool Contains(const Vector3<T> &_pt) const
+      {
+        // Same plane-side test as Triangle3::Contains, with the normal
+        // taken from the cache.
+        if (Planed(this->norm).Side(_pt) != Planed::NO_SIDE)
+          return false;
+
+        Vector3d v2 = _pt - this->tri[0];
+        double dot02 = this->edge0.Dot(v2);
+        double dot12 = this->edge1.Dot(v2);
+
+        double u = (this->dot11 * dot02 - this->dot01 * dot12) *
+            this->invDenom;
+        double v = (this->dot00 * dot12 - this->dot01 * dot02) *
+            this->invDenom;
+
+        return (u >= 0) && (v >= 0) && (u + v <= 1);
+      }
+
+      /// \brief Get whether the given line intersects the triangle,
+      /// against the cached data. Semantics and results match
+      /// Triangle3::Intersects.
+      /// \param[in] _line Line to check.
+      /// \param[out] _ipt1 Return value of the first intersection point,
+      /// only valid if the return value of the function is true.
+      /// \return True if the given line intersects this triangle.
+      public: bool Intersects(const Line3<T> &_line, Vector3<T> &_ipt1) const
+      {
+        Vector3d dir = (_line[1] - _line[0]).Normalize();
+
+        double denom = this->norm.Dot(dir);
+
+        // Handle the case when the line is not co-planar with the
+        // triangle.
+        if (!math::equal(denom, 0.0))
+        {
+          double intersection =
+            -this->norm.Dot(_line[0] - this->tri[0]) / denom;
+
+          if (intersection < 1.0 || intersection > _line.Length())
+            return false;
+
+          _ipt1 = _line[0] + (dir * intersection);
+
+          return true;
+        }
+        // Line co-planar with triangle: defer to the edge tests, which
+        // have no invariants worth caching.
+        else
+        {
+          if (this->Contains(_line[0]) && this->Contains(_line[1]))
+          {
+            _ipt1 = _line[0];
+            return true;
+          }
+
+          for (unsigned int i = 0; i < 3; ++i)
+          {
+            if (_line.Intersect(this->tri.Side(i), _ipt1))
+              return true;
+          }
+        }
+
+        return false;
+      }
+
+      /// \brief The wrapped triangle.
+      private: Triangle3<T> tri;
+
+      /// \brief Cached triangle normal.
+      private: Vector3d norm;
+
+      /// \brief Cached edge vector from vertex 0 to vertex 2.
+      private: Vector3d edge0;
+
+      /// \brief Cached edge vector from vertex 0 to vertex 1.
+      private: Vector3d edge1;
+
+      /// \brief Cached edge0 . edge0.
+      private: double dot00 = 0;
+
+      /// \brief Cached edge0 . edge1.
+      private: double dot01 = 0;
+
+      /// \brief Cached edge1 . edge1.
+      private: double dot11 = 0;
+
+      /// \brief Cached inverse denominator of the barycentric solve.
+      private: double invDenom = 0;
+    };
+
+    /// \brief Double specialization of the PreparedTriangle3 class.
+    typedef PreparedTriangle3<double> PreparedTriangle3d;
+
+    /// \brief Float specialization of the PreparedTriangle3 class.
+    typedef PreparedTriangle3<float> PreparedTriangle3f;
+
     /// \brief Integer specialization of the Triangle class.
     typedef Triangle3<int> Triangle3i;
 
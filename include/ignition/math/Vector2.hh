@@ -578,6 +578,18 @@ namespace ignition
     typedef Vector2<int> Vector2i;
     typedef Vector2<double> Vector2d;
     typedef Vector2<float> Vector2f;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Vector2<int>;
+    extern template class Vector2<double>;
+    extern template class Vector2<float>;
+#endif
     }
   }
 }
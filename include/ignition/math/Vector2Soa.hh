@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_VECTOR2SOA_HH_
+#define IGNITION_MATH_VECTOR2SOA_HH_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class Vector2Soa Vector2Soa.hh ignition/math/Vector2Soa.hh
+    /// \brief A structure-of-arrays container for large sets of 2D
+    /// vectors, the planar counterpart of Vector3Soa.
+    ///
+    /// The x and y components are stored in two separate contiguous
+    /// arrays, so the bulk operations below run over unit-stride
+    /// streams that compilers can vectorize. Use this container instead
+    /// of std::vector<Vector2<T>> when a stage processes many points
+    /// with the same operation, e.g. costmap or footprint queries in a
+    /// 2D planner.
+    template<typename T>
+    class Vector2Soa
+    {
+      /// \brief Default constructor. Creates an empty batch.
+      public: Vector2Soa() = default;
+
+      /// \brief Create a batch holding _count zero vectors.
+      /// \param[in] _count Number of vectors.
+      public: explicit Vector2Soa(std::size_t _count)
+      {
+        this->Resize(_count);
+      }
+
+      /// \brief Create a batch from an array-of-structures range.
+      /// \param[in] _in Pointer to the first vector.
+      /// \param[in] _count Number of vectors to copy.
+      public: Vector2Soa(const Vector2<T> *_in, std::size_t _count)
+      {
+        this->Resize(_count);
+        for (std::size_t i = 0; i < _count; ++i)
+          this->Set(i, _in[i]);
+      }
+
+      /// \brief Get the number of vectors in the batch.
+      /// \return The batch size.
+      public: std::size_t Size() const
+      {
+        return this->xData.size();
+      }
+
+      /// \brief Resize the batch. New elements are zero.
+      /// \param[in] _count New number of vectors.
+      public: void Resize(std::size_t _count)
+      {
+        this->xData.resize(_count, T(0));
+        this->yData.resize(_count, T(0));
+      }
+
+      /// \brief Remove all vectors from the batch.
+      public: void Clear()
+      {
+        this->xData.clear();
+        this->yData.clear();
+      }
+
+      /// \brief Append one vector to the batch.
+      /// \param[in] _v The vector to append.
+      public: void PushBack(const Vector2<T> &_v)
+      {
+        this->xData.push_back(_v.X());
+        this->yData.push_back(_v.Y());
+      }
+
+      /// \brief Get one vector of the batch.
+      /// \param[in] _i Index of the vector; not range checked.
+      /// \return The vector at index _i.
+      public: Vector2<T> At(std::size_t _i) const
+      {
+        return Vector2<T>(this->xData[_i], this->yData[_i]);
+      }
+
+      /// \brief Set one vector of the batch.
+      /// \param[in] _i Index of the vector; not range checked.
+      /// \param[in] _v New value.
+      public: void Set(std::size_t _i, const Vector2<T> &_v)
+      {
+        this->xData[_i] = _v.X();
+        this->yData[_i] = _v.Y();
+      }
+
+      /// \brief Get the contiguous x components.
+      /// \return The x component array.
+      public: const std::vector<T> &X() const
+      {
+        return this->xData;
+      }
+
+      /// \brief Get the contiguous y components.
+      /// \return The y component array.
+      public: const std::vector<T> &Y() const
+      {
+        return this->yData;
+      }
+
+      /// \brief Copy the batch back to an array-of-structures range.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void ToVectors(Vector2<T> *_out) const
+      {
+        for (std::size_t i = 0; i < this->Size(); ++i)
+          _out[i] = this->At(i);
+      }
+
+      /// \brief this[i] += _v[i] * _scale for every element.
+      /// The batches must have the same size.
+      /// \param[in] _v The addend batch.
+      /// \param[in] _scale Scale applied to the addend.
+      public: void AddScaled(const Vector2Soa<T> &_v, T _scale)
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          this->xData[i] += _v.xData[i] * _scale;
+          this->yData[i] += _v.yData[i] * _scale;
+        }
+      }
+
+      /// \brief _out[i] = this[i] . _v[i] for every element.
+      /// The batches must have the same size.
+      /// \param[in] _v The other batch.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void DotBatch(const Vector2Soa<T> &_v, T *_out) const
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          _out[i] = this->xData[i] * _v.xData[i] +
+                    this->yData[i] * _v.yData[i];
+        }
+      }
+
+      /// \brief _out[i] = this[i] x _v[i] (the scalar 2D cross
+      /// product) for every element. The batches must have the same
+      /// size.
+      /// \param[in] _v The other batch.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void CrossBatch(const Vector2Soa<T> &_v, T *_out) const
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          _out[i] = this->xData[i] * _v.yData[i] -
+                    this->yData[i] * _v.xData[i];
+        }
+      }
+
+      /// \brief _out[i] = |this[i] - _v[i]| for every element.
+      /// The batches must have the same size.
+      /// \param[in] _v The other batch.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void DistanceBatch(const Vector2Soa<T> &_v, T *_out) const
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          const T dx = this->xData[i] - _v.xData[i];
+          const T dy = this->yData[i] - _v.yData[i];
+          _out[i] = static_cast<T>(std::sqrt(dx * dx + dy * dy));
+        }
+      }
+
+      /// \brief _out[i] = |this[i] - _pt| for every element.
+      /// \param[in] _pt The query point.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void DistanceToPointBatch(const Vector2<T> &_pt,
+                  T *_out) const
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          const T dx = this->xData[i] - _pt.X();
+          const T dy = this->yData[i] - _pt.Y();
+          _out[i] = static_cast<T>(std::sqrt(dx * dx + dy * dy));
+        }
+      }
+
+      /// \brief Normalize every vector in place. Zero-length vectors
+      /// are left unchanged, matching Vector2<T>::Normalize.
+      public: void NormalizeBatch()
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          T d = static_cast<T>(std::sqrt(this->xData[i] * this->xData[i] +
+                                         this->yData[i] * this->yData[i]));
+          if (equal<T>(d, static_cast<T>(0.0)))
+            continue;
+          this->xData[i] /= d;
+          this->yData[i] /= d;
+        }
+      }
+
+      /// \brief Test every point of the batch against a convex
+      /// polygon. A point is inside when it lies on the same side of
+      /// every edge, the per-edge test being the sign of
+      /// Line2<T>::CrossProduct(point); either winding order works and
+      /// points on an edge count as inside.
+      /// \param[in] _polygon The polygon vertices in order.
+      /// \param[in] _polygonCount Number of vertices; at least 3.
+      /// \param[out] _inside Destination array of Size() flags, set to
+      /// 1 when the point is inside and 0 otherwise.
+      /// \return False when the polygon has fewer than 3 vertices, in
+      /// which case every flag is set to 0.
+      public: bool InsideConvexPolygonBatch(const Vector2<T> *_polygon,
+                  const std::size_t _polygonCount, uint8_t *_inside) const
+      {
+        const std::size_t count = this->Size();
+        if (_polygonCount < 3)
+        {
+          for (std::size_t i = 0; i < count; ++i)
+            _inside[i] = 0;
+          return false;
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+          _inside[i] = 1;
+
+        // One pass per edge over the packed components; a point is
+        // rejected as soon as two edges see it on opposite strict
+        // sides. The sign bookkeeping is two extra flag arrays instead
+        // of a per-point edge loop so each pass stays vectorizable.
+        std::vector<uint8_t> sawLeft(count, 0);
+        std::vector<uint8_t> sawRight(count, 0);
+        for (std::size_t e = 0; e < _polygonCount; ++e)
+        {
+          const Vector2<T> &a = _polygon[e];
+          const Vector2<T> &b = _polygon[(e + 1) % _polygonCount];
+          const T ex = b.X() - a.X();
+          const T ey = b.Y() - a.Y();
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            const T cross = ex * (this->yData[i] - a.Y()) -
+                            ey * (this->xData[i] - a.X());
+            sawLeft[i] |= cross > T(0);
+            sawRight[i] |= cross < T(0);
+          }
+        }
+        for (std::size_t i = 0; i < count; ++i)
+          _inside[i] = !(sawLeft[i] && sawRight[i]);
+        return true;
+      }
+
+      /// \brief The x components.
+      private: std::vector<T> xData;
+
+      /// \brief The y components.
+      private: std::vector<T> yData;
+    };
+
+    typedef Vector2Soa<int> Vector2Soai;
+    typedef Vector2Soa<double> Vector2Soad;
+    typedef Vector2Soa<float> Vector2Soaf;
+    }
+  }
+}
+#endif
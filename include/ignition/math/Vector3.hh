@@ -20,10 +20,14 @@
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <algorithm>
+#include <type_traits>
 
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/config.hh>
+#include <ignition/math/detail/Vector3Simd.hh>
 
 namespace ignition
 {
@@ -123,9 +127,7 @@ namespace ignition
       /// \return the squared length
       public: T SquaredLength() const
       {
-        return std::pow(this->data[0], 2)
-             + std::pow(this->data[1], 2)
-             + std::pow(this->data[2], 2);
+        return detail::Vector3Ops<T>::SquaredLength(this->data);
       }
 
       /// \brief Normalize the vector length
@@ -136,9 +138,21 @@ namespace ignition
 
         if (!equal<T>(d, static_cast<T>(0.0)))
         {
-          this->data[0] /= d;
-          this->data[1] /= d;
-          this->data[2] /= d;
+          if constexpr (std::is_floating_point<T>::value)
+          {
+            // One division and three multiplies through the shared
+            // kernel.
+            detail::Vector3Ops<T>::Scale(this->data,
+                static_cast<T>(1) / d, this->data);
+          }
+          else
+          {
+            // An integral reciprocal truncates to zero; divide
+            // element-wise as the other vector classes do.
+            this->data[0] /= d;
+            this->data[1] /= d;
+            this->data[2] /= d;
+          }
         }
 
         return *this;
@@ -153,6 +167,34 @@ namespace ignition
         return result;
       }
 
+      /// \brief Return a normalized vector without the zero-length
+      /// guard of Normalized(). The caller must guarantee a nonzero
+      /// length. For floats the hardware reciprocal square root
+      /// estimate with Newton refinement replaces the square root and
+      /// division, accurate to about two ulps.
+      /// \return unit length vector
+      public: Vector3 NormalizedFast() const
+      {
+        Vector3<T> result = *this;
+        detail::Vector3Ops<T>::Scale(result.data,
+            static_cast<T>(1) / static_cast<T>(
+                std::sqrt(this->SquaredLength())), result.data);
+        return result;
+      }
+
+      /// \brief Add a scaled vector in place: *this += _v * _s
+      /// without materializing the temporary _v * _s, the inner
+      /// update of integrator loops.
+      /// \param[in] _v The vector to scale and add.
+      /// \param[in] _s The scale factor.
+      /// \return Reference to this vector.
+      public: const Vector3<T> &AddScaled(const Vector3<T> &_v, const T _s)
+      {
+        detail::Vector3Ops<T>::AddScaled(this->data, _v.data, _s,
+            this->data);
+        return *this;
+      }
+
       /// \brief Round to near whole number, return the result.
       /// \return the result
       public: Vector3 Round()
@@ -188,9 +230,9 @@ namespace ignition
       /// \return the cross product
       public: Vector3 Cross(const Vector3<T> &_v) const
       {
-        return Vector3(this->data[1] * _v[2] - this->data[2] * _v[1],
-                       this->data[2] * _v[0] - this->data[0] * _v[2],
-                       this->data[0] * _v[1] - this->data[1] * _v[0]);
+        Vector3<T> result;
+        detail::Vector3Ops<T>::Cross(this->data, _v.data, result.data);
+        return result;
       }
 
       /// \brief Return the dot product of this vector and another vector
@@ -198,9 +240,7 @@ namespace ignition
       /// \return the dot product
       public: T Dot(const Vector3<T> &_v) const
       {
-        return this->data[0] * _v[0] +
-               this->data[1] * _v[1] +
-               this->data[2] * _v[2];
+        return detail::Vector3Ops<T>::Dot(this->data, _v.data);
       }
 
       /// \brief Return the absolute dot product of this vector and
@@ -338,9 +378,9 @@ namespace ignition
       /// \return the sum vector
       public: Vector3 operator+(const Vector3<T> &_v) const
       {
-        return Vector3(this->data[0] + _v[0],
-                       this->data[1] + _v[1],
-                       this->data[2] + _v[2]);
+        Vector3<T> result;
+        detail::Vector3Ops<T>::Add(this->data, _v.data, result.data);
+        return result;
       }
 
       /// \brief Addition assignment operator
@@ -348,9 +388,7 @@ namespace ignition
       /// \return the sum vector
       public: const Vector3 &operator+=(const Vector3<T> &_v)
       {
-        this->data[0] += _v[0];
-        this->data[1] += _v[1];
-        this->data[2] += _v[2];
+        detail::Vector3Ops<T>::Add(this->data, _v.data, this->data);
 
         return *this;
       }
@@ -399,9 +437,9 @@ namespace ignition
       /// \return a vector after the substraction
       public: inline Vector3<T> operator-(const Vector3<T> &_pt) const
       {
-        return Vector3(this->data[0] - _pt[0],
-                       this->data[1] - _pt[1],
-                       this->data[2] - _pt[2]);
+        Vector3<T> result;
+        detail::Vector3Ops<T>::Sub(this->data, _pt.data, result.data);
+        return result;
       }
 
       /// \brief Subtraction assignment operators
@@ -409,9 +447,7 @@ namespace ignition
       /// \return a vector after the substraction
       public: const Vector3<T> &operator-=(const Vector3<T> &_pt)
       {
-        this->data[0] -= _pt[0];
-        this->data[1] -= _pt[1];
-        this->data[2] -= _pt[2];
+        detail::Vector3Ops<T>::Sub(this->data, _pt.data, this->data);
 
         return *this;
       }
@@ -502,9 +538,9 @@ namespace ignition
       /// \return a vector
       public: Vector3<T> operator*(const Vector3<T> &_p) const
       {
-        return Vector3(this->data[0] * _p[0],
-                       this->data[1] * _p[1],
-                       this->data[2] * _p[2]);
+        Vector3<T> result;
+        detail::Vector3Ops<T>::Mul(this->data, _p.data, result.data);
+        return result;
       }
 
       /// \brief Multiplication assignment operators
@@ -525,9 +561,9 @@ namespace ignition
       /// \return a scaled vector
       public: inline Vector3<T> operator*(T _s) const
       {
-        return Vector3<T>(this->data[0] * _s,
-                          this->data[1] * _s,
-                          this->data[2] * _s);
+        Vector3<T> result;
+        detail::Vector3Ops<T>::Scale(this->data, _s, result.data);
+        return result;
       }
 
       /// \brief Multiplication operators
@@ -753,9 +789,78 @@ namespace ignition
     template<typename T> const Vector3<T> Vector3<T>::UnitY(0, 1, 0);
     template<typename T> const Vector3<T> Vector3<T>::UnitZ(0, 0, 1);
 
+    /// \brief Float-specialized Normalize: a reciprocal square root
+    /// with Newton refinement replaces the square root and division,
+    /// which is the dominant cost of this call on fp32-bound targets.
+    /// The zero-length guard matches the generic path.
+    template<>
+    inline Vector3<float> Vector3<float>::Normalize()
+    {
+      const float d2 = this->SquaredLength();
+      if (d2 > 1e-12f)
+      {
+        detail::Vector3Ops<float>::Scale(this->data,
+            detail::InverseSqrt(d2), this->data);
+      }
+      return *this;
+    }
+
+    /// \brief Float-specialized NormalizedFast: the refined hardware
+    /// reciprocal square root estimate used by the float Normalize.
+    template<>
+    inline Vector3<float> Vector3<float>::NormalizedFast() const
+    {
+      Vector3<float> result = *this;
+      detail::Vector3Ops<float>::Scale(result.data,
+          detail::InverseSqrt(this->SquaredLength()), result.data);
+      return result;
+    }
+
+    /// \brief Compare two vector arrays element-wise with tolerance,
+    /// writing one bit per element: bit i of the mask is set when
+    /// every component of _a[i] is within _tol of _b[i], the test of
+    /// Equal(). The comparison loop is branch free over contiguous
+    /// components, so the compiler can vectorize it; pair the mask
+    /// with ChangedIndices() in Helpers.hh to enumerate the elements
+    /// that moved.
+    /// \param[in] _a First vector array.
+    /// \param[in] _b Second vector array.
+    /// \param[in] _count Number of elements in each array.
+    /// \param[in] _tol Per-component equality tolerance.
+    /// \param[out] _mask Bitmask of (_count + 63) / 64 words; bit i of
+    /// word i / 64 reports element i, unused tail bits are cleared.
+    template<typename T>
+    inline void EqualBatch(const Vector3<T> *_a, const Vector3<T> *_b,
+        const std::size_t _count, const T _tol, uint64_t *_mask)
+    {
+      const std::size_t words = (_count + 63) / 64;
+      for (std::size_t w = 0; w < words; ++w)
+        _mask[w] = 0;
+      for (std::size_t i = 0; i < _count; ++i)
+      {
+        const uint64_t eq =
+            (equal<T>(_a[i].X(), _b[i].X(), _tol) &
+             equal<T>(_a[i].Y(), _b[i].Y(), _tol) &
+             equal<T>(_a[i].Z(), _b[i].Z(), _tol)) ? 1u : 0u;
+        _mask[i >> 6] |= eq << (i & 63);
+      }
+    }
+
     typedef Vector3<int> Vector3i;
     typedef Vector3<double> Vector3d;
     typedef Vector3<float> Vector3f;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Vector3<int>;
+    extern template class Vector3<double>;
+    extern template class Vector3<float>;
+#endif
     }
   }
 }
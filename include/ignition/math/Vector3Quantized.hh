@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_VECTOR3QUANTIZED_HH_
+#define IGNITION_MATH_VECTOR3QUANTIZED_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief One quantized point: 16 bits per axis, relative to the
+    /// offset and scale of the chunk it belongs to. Six bytes instead of
+    /// the 24 of a Vector3d.
+    struct Vector3q
+    {
+      /// \brief Quantized X coordinate.
+      uint16_t x;
+
+      /// \brief Quantized Y coordinate.
+      uint16_t y;
+
+      /// \brief Quantized Z coordinate.
+      uint16_t z;
+    };
+
+    // Forward declaration of private data
+    class Vector3qArrayPrivate;
+
+    /// \brief Compressed storage for large Vector3d datasets.
+    ///
+    /// Points are stored in chunks of ChunkSize() entries; each chunk
+    /// keeps its own offset and scale and quantizes every coordinate to
+    /// 16 bits, shrinking bulk data such as waypoint logs to a quarter
+    /// of its Vector3d size. The absolute error per axis is bounded by
+    /// half the chunk extent divided by 65535, so spatially coherent
+    /// data decodes nearly losslessly. Decoding a range is a tight
+    /// multiply-add loop per chunk.
+    class IGNITION_MATH_VISIBLE Vector3qArray
+    {
+      /// \brief Default constructor. The array starts empty.
+      public: Vector3qArray();
+
+      /// \brief Destructor
+      public: ~Vector3qArray();
+
+      /// \brief Number of points per chunk. Each chunk stores one
+      /// offset/scale pair, so smaller chunks mean tighter error bounds
+      /// and slightly more overhead.
+      /// \return The chunk size.
+      public: static size_t ChunkSize();
+
+      /// \brief Replace the contents with a quantized copy of an array
+      /// of points.
+      /// \param[in] _points Array of points.
+      /// \param[in] _count Number of points.
+      public: void Encode(const Vector3d *_points, size_t _count);
+
+      /// \brief Get the number of stored points.
+      /// \return Point count.
+      public: size_t Size() const;
+
+      /// \brief Remove all stored points.
+      public: void Clear();
+
+      /// \brief Decode all stored points.
+      /// \param[out] _points Destination array; must have room for
+      /// Size() points.
+      public: void Decode(Vector3d *_points) const;
+
+      /// \brief Decode a range of stored points.
+      /// \param[in] _start Index of the first point to decode.
+      /// \param[in] _count Number of points to decode. The range is
+      /// truncated at the end of the array.
+      /// \param[out] _points Destination array; must have room for
+      /// \p _count points.
+      public: void Decode(size_t _start, size_t _count,
+                  Vector3d *_points) const;
+
+      /// \brief Decode one stored point.
+      /// \param[in] _index Index of the point.
+      /// \return The decoded point, or Vector3d::Zero for an invalid
+      /// index.
+      public: Vector3d At(size_t _index) const;
+
+      /// \brief Get the approximate memory used by the quantized data,
+      /// including the per-chunk offsets and scales.
+      /// \return Size in bytes.
+      public: size_t ByteSize() const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<Vector3qArrayPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_VECTOR3SOA_HH_
+#define IGNITION_MATH_VECTOR3SOA_HH_
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class Vector3Soa Vector3Soa.hh ignition/math/Vector3Soa.hh
+    /// \brief A structure-of-arrays container for large sets of 3D vectors.
+    ///
+    /// The x, y and z components are stored in three separate contiguous
+    /// arrays, so the bulk operations below run over unit-stride streams
+    /// that compilers can vectorize. Use this container instead of
+    /// std::vector<Vector3<T>> when a stage processes many points with the
+    /// same operation, e.g. particle or contact pipelines.
+    template<typename T>
+    class Vector3Soa
+    {
+      /// \brief Default constructor. Creates an empty batch.
+      public: Vector3Soa() = default;
+
+      /// \brief Create a batch holding _count zero vectors.
+      /// \param[in] _count Number of vectors.
+      public: explicit Vector3Soa(std::size_t _count)
+      {
+        this->Resize(_count);
+      }
+
+      /// \brief Create a batch from an array-of-structures range.
+      /// \param[in] _in Pointer to the first vector.
+      /// \param[in] _count Number of vectors to copy.
+      public: Vector3Soa(const Vector3<T> *_in, std::size_t _count)
+      {
+        this->Resize(_count);
+        for (std::size_t i = 0; i < _count; ++i)
+          this->Set(i, _in[i]);
+      }
+
+      /// \brief Get the number of vectors in the batch.
+      /// \return The batch size.
+      public: std::size_t Size() const
+      {
+        return this->xData.size();
+      }
+
+      /// \brief Resize the batch. New elements are zero.
+      /// \param[in] _count New number of vectors.
+      public: void Resize(std::size_t _count)
+      {
+        this->xData.resize(_count, T(0));
+        this->yData.resize(_count, T(0));
+        this->zData.resize(_count, T(0));
+      }
+
+      /// \brief Remove all vectors from the batch.
+      public: void Clear()
+      {
+        this->xData.clear();
+        this->yData.clear();
+        this->zData.clear();
+      }
+
+      /// \brief Append one vector to the batch.
+      /// \param[in] _v The vector to append.
+      public: void PushBack(const Vector3<T> &_v)
+      {
+        this->xData.push_back(_v.X());
+        this->yData.push_back(_v.Y());
+        this->zData.push_back(_v.Z());
+      }
+
+      /// \brief Get one vector of the batch.
+      /// \param[in] _i Index of the vector; not range checked.
+      /// \return The vector at index _i.
+      public: Vector3<T> At(std::size_t _i) const
+      {
+        return Vector3<T>(this->xData[_i], this->yData[_i], this->zData[_i]);
+      }
+
+      /// \brief Set one vector of the batch.
+      /// \param[in] _i Index of the vector; not range checked.
+      /// \param[in] _v New value.
+      public: void Set(std::size_t _i, const Vector3<T> &_v)
+      {
+        this->xData[_i] = _v.X();
+        this->yData[_i] = _v.Y();
+        this->zData[_i] = _v.Z();
+      }
+
+      /// \brief Get the contiguous x components.
+      /// \return The x component array.
+      public: const std::vector<T> &X() const
+      {
+        return this->xData;
+      }
+
+      /// \brief Get the contiguous y components.
+      /// \return The y component array.
+      public: const std::vector<T> &Y() const
+      {
+        return this->yData;
+      }
+
+      /// \brief Get the contiguous z components.
+      /// \return The z component array.
+      public: const std::vector<T> &Z() const
+      {
+        return this->zData;
+      }
+
+      /// \brief Copy the batch back into an array-of-structures range.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void ToVectors(Vector3<T> *_out) const
+      {
+        for (std::size_t i = 0; i < this->Size(); ++i)
+          _out[i] = this->At(i);
+      }
+
+      /// \brief this[i] += _v[i] * _scale for every element.
+      /// The batches must have the same size.
+      /// \param[in] _v The addend batch.
+      /// \param[in] _scale Scale applied to the addend.
+      public: void AddScaled(const Vector3Soa<T> &_v, T _scale)
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          this->xData[i] += _v.xData[i] * _scale;
+          this->yData[i] += _v.yData[i] * _scale;
+          this->zData[i] += _v.zData[i] * _scale;
+        }
+      }
+
+      /// \brief _out[i] = this[i] . _v[i] for every element.
+      /// The batches must have the same size.
+      /// \param[in] _v The other batch.
+      /// \param[out] _out Destination array; must hold Size() elements.
+      public: void DotBatch(const Vector3Soa<T> &_v, T *_out) const
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          _out[i] = this->xData[i] * _v.xData[i] +
+                    this->yData[i] * _v.yData[i] +
+                    this->zData[i] * _v.zData[i];
+        }
+      }
+
+      /// \brief _out[i] = this[i] x _v[i] for every element.
+      /// The batches must have the same size. _out is resized to match.
+      /// \param[in] _v The other batch.
+      /// \param[out] _out Destination batch.
+      public: void CrossBatch(const Vector3Soa<T> &_v,
+                  Vector3Soa<T> &_out) const
+      {
+        const std::size_t count = this->Size();
+        _out.Resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          _out.xData[i] = this->yData[i] * _v.zData[i] -
+                          this->zData[i] * _v.yData[i];
+          _out.yData[i] = this->zData[i] * _v.xData[i] -
+                          this->xData[i] * _v.zData[i];
+          _out.zData[i] = this->xData[i] * _v.yData[i] -
+                          this->yData[i] * _v.xData[i];
+        }
+      }
+
+      /// \brief Normalize every vector in place. Zero-length vectors are
+      /// left unchanged, matching Vector3<T>::Normalize.
+      public: void NormalizeBatch()
+      {
+        const std::size_t count = this->Size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          T d = std::sqrt(this->xData[i] * this->xData[i] +
+                          this->yData[i] * this->yData[i] +
+                          this->zData[i] * this->zData[i]);
+          if (equal<T>(d, static_cast<T>(0.0)))
+            continue;
+          this->xData[i] /= d;
+          this->yData[i] /= d;
+          this->zData[i] /= d;
+        }
+      }
+
+      /// \brief The x components.
+      private: std::vector<T> xData;
+
+      /// \brief The y components.
+      private: std::vector<T> yData;
+
+      /// \brief The z components.
+      private: std::vector<T> zData;
+    };
+
+    typedef Vector3Soa<int> Vector3Soai;
+    typedef Vector3Soa<double> Vector3Soad;
+    typedef Vector3Soa<float> Vector3Soaf;
+    }
+  }
+}
+#endif
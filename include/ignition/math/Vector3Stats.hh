@@ -17,7 +17,10 @@
 #ifndef IGNITION_MATH_VECTOR3STATS_HH_
 #define IGNITION_MATH_VECTOR3STATS_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/SignalStats.hh>
 #include <ignition/math/Vector3.hh>
@@ -47,6 +50,21 @@ namespace ignition
       /// \param[in] _data New signal data point.
       public: void InsertData(const Vector3d &_data);
 
+      /// \brief Add a batch of samples to the statistical measures.
+      /// The samples are split into per-component buffers and each of
+      /// the four SignalStats consumes its buffer in one bulk insert,
+      /// so the per-statistic dispatch cost is paid once per batch
+      /// instead of once per sample.
+      /// \param[in] _data Array of new signal data points.
+      /// \param[in] _count Number of data points.
+      public: void InsertData(const Vector3d *_data, size_t _count);
+
+      /// \brief Add a buffer of samples to the statistical measures;
+      /// convenience overload for flushing a per-channel sample
+      /// buffer.
+      /// \param[in] _data Buffer of new signal data points.
+      public: void InsertData(const std::vector<Vector3d> &_data);
+
       /// \brief Add a new type of statistic.
       /// \param[in] _name Short name of new statistic.
       /// Valid values include:
@@ -105,6 +123,155 @@ namespace ignition
       /// \brief Pointer to private data.
       protected: Vector3StatsPrivate *dataPtr;
     };
+
+    /// \brief Forward declare private data class.
+    class Vector3StatsBufferedPrivate;
+
+    /// \class Vector3StatsBuffered Vector3Stats.hh
+    /// ignition/math/Vector3Stats.hh
+    /// \brief Double-buffered Vector3Stats for telemetry: one thread
+    /// inserts samples while another reads snapshots, without a mutex
+    /// on the insert path. The writer fills the active buffer;
+    /// Snapshot() swaps the buffers and returns the quiescent one,
+    /// which holds the statistics of the samples inserted since the
+    /// previous snapshot.
+    ///
+    /// The contract is one writer thread and one reader thread. The
+    /// writer calls InsertData; the reader calls Snapshot and may use
+    /// the returned reference until its next Snapshot call. Snapshot
+    /// briefly waits for an insert already in flight to finish, so
+    /// reads never block the writer. InsertStatistic, InsertStatistics
+    /// and Reset are not thread safe and must be called while neither
+    /// thread is active.
+    class IGNITION_MATH_VISIBLE Vector3StatsBuffered
+    {
+      /// \brief Constructor
+      public: Vector3StatsBuffered();
+
+      /// \brief Destructor
+      public: ~Vector3StatsBuffered();
+
+      /// \brief Add a new sample to the active buffer.
+      /// \param[in] _data New signal data point.
+      public: void InsertData(const Vector3d &_data);
+
+      /// \brief Add a batch of samples to the active buffer.
+      /// \param[in] _data Array of new signal data points.
+      /// \param[in] _count Number of data points.
+      public: void InsertData(const Vector3d *_data, size_t _count);
+
+      /// \brief Add a buffer of samples to the active buffer.
+      /// \param[in] _data Buffer of new signal data points.
+      public: void InsertData(const std::vector<Vector3d> &_data);
+
+      /// \brief Add a new type of statistic to both buffers, with the
+      /// names accepted by Vector3Stats::InsertStatistic. Call before
+      /// the writer starts inserting.
+      /// \param[in] _name Short name of new statistic.
+      /// \return True if statistic was successfully added.
+      public: bool InsertStatistic(const std::string &_name);
+
+      /// \brief Add multiple statistics to both buffers.
+      /// \param[in] _names Comma-separated list of new statistics.
+      /// \return True if all statistics were successfully added.
+      public: bool InsertStatistics(const std::string &_names);
+
+      /// \brief Swap the buffers and get the statistics of the
+      /// samples inserted since the previous snapshot. The writer
+      /// continues into a freshly reset buffer; the returned buffer
+      /// stays untouched until the next Snapshot call.
+      /// \return Statistics of the finished interval.
+      public: const Vector3Stats &Snapshot();
+
+      /// \brief Forget all previous data in both buffers.
+      public: void Reset();
+
+      /// \brief Pointer to private data.
+      private: Vector3StatsBufferedPrivate *dataPtr;
+    };
+
+    /// \brief Forward declare private data class.
+    class Vector3StatsGroupPrivate;
+
+    /// \brief Summary of the statistics of one component of one
+    /// channel of a Vector3StatsGroup. The fields correspond to the
+    /// SignalStats short names.
+    struct Vector3StatsSummary
+    {
+      /// \brief Number of data points.
+      public: uint64_t count{0};
+
+      /// \brief Maximum value.
+      public: double max{0.0};
+
+      /// \brief Maximum of the absolute value.
+      public: double maxAbs{0.0};
+
+      /// \brief Mean value.
+      public: double mean{0.0};
+
+      /// \brief Minimum value.
+      public: double min{0.0};
+
+      /// \brief Root mean square.
+      public: double rms{0.0};
+
+      /// \brief Sample variance.
+      public: double variance{0.0};
+    };
+
+    /// \class Vector3StatsGroup Vector3Stats.hh
+    /// ignition/math/Vector3Stats.hh
+    /// \brief Per-axis and magnitude statistics for many Vector3
+    /// channels at once. The accumulators of all channels are stored in
+    /// contiguous per-component arrays, so inserting one sample per
+    /// channel each step is a straight vectorizable sweep instead of a
+    /// fan-out through per-channel objects. Every channel tracks the
+    /// full max/maxAbs/mean/min/rms/var family.
+    class IGNITION_MATH_VISIBLE Vector3StatsGroup
+    {
+      /// \brief Constructor.
+      /// \param[in] _channels Number of channels in the group.
+      public: explicit Vector3StatsGroup(size_t _channels);
+
+      /// \brief Destructor
+      public: ~Vector3StatsGroup();
+
+      /// \brief Get the number of channels.
+      /// \return Channel count.
+      public: size_t ChannelCount() const;
+
+      /// \brief Add one new sample to every channel.
+      /// \param[in] _data Array of new signal data points, one per
+      /// channel; must hold ChannelCount() elements.
+      public: void InsertData(const Vector3d *_data);
+
+      /// \brief Get the statistics of the x component of a channel.
+      /// \param[in] _channel Channel index.
+      /// \return The statistics summary; zeros for an invalid index.
+      public: Vector3StatsSummary X(size_t _channel) const;
+
+      /// \brief Get the statistics of the y component of a channel.
+      /// \param[in] _channel Channel index.
+      /// \return The statistics summary; zeros for an invalid index.
+      public: Vector3StatsSummary Y(size_t _channel) const;
+
+      /// \brief Get the statistics of the z component of a channel.
+      /// \param[in] _channel Channel index.
+      /// \return The statistics summary; zeros for an invalid index.
+      public: Vector3StatsSummary Z(size_t _channel) const;
+
+      /// \brief Get the statistics of the magnitude of a channel.
+      /// \param[in] _channel Channel index.
+      /// \return The statistics summary; zeros for an invalid index.
+      public: Vector3StatsSummary Mag(size_t _channel) const;
+
+      /// \brief Forget all previous data in every channel.
+      public: void Reset();
+
+      /// \brief Pointer to private data.
+      private: Vector3StatsGroupPrivate *dataPtr;
+    };
     }
   }
 }
@@ -168,6 +168,21 @@ namespace ignition
         return result;
       }
 
+      /// \brief Add a scaled vector in place: *this += _v * _s
+      /// without materializing the temporary _v * _s, the inner
+      /// update of integrator loops.
+      /// \param[in] _v The vector to scale and add.
+      /// \param[in] _s The scale factor.
+      /// \return Reference to this vector.
+      public: const Vector4<T> &AddScaled(const Vector4<T> &_v, const T _s)
+      {
+        this->data[0] += _v.data[0] * _s;
+        this->data[1] += _v.data[1] * _s;
+        this->data[2] += _v.data[2] * _s;
+        this->data[3] += _v.data[3] * _s;
+        return *this;
+      }
+
       /// \brief Return the dot product of this vector and another vector
       /// \param[in] _v the vector
       /// \return the dot product
@@ -733,6 +748,18 @@ namespace ignition
     typedef Vector4<int> Vector4i;
     typedef Vector4<double> Vector4d;
     typedef Vector4<float> Vector4f;
+
+    // The library compiles the common instantiations once; see
+    // src/TemplateInstantiations.cc. Consumers without the compiled
+    // library (the header-only core component) and TUs that opt out
+    // of SIMD (the library's instantiations are SIMD-compiled)
+    // instantiate implicitly instead.
+#if !defined(IGNITION_MATH_NO_EXTERN_TEMPLATES) && \
+    !defined(IGNITION_MATH_DISABLE_SIMD)
+    extern template class Vector4<int>;
+    extern template class Vector4<double>;
+    extern template class Vector4<float>;
+#endif
     }
   }
 }
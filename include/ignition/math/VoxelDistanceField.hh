@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_VOXELDISTANCEFIELD_HH_
+#define IGNITION_MATH_VOXELDISTANCEFIELD_HH_
+
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Box.hh>
+#include <ignition/math/Capsule.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Sphere.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Export.hh>
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declare private data class.
+    class VoxelDistanceFieldPrivate;
+
+    /// \brief A dense signed distance field baked ahead of time from
+    /// a set of shape primitives.
+    ///
+    /// A planner that needs the distance to the nearest obstacle pays
+    /// for a brute-force pass over every primitive on every query.
+    /// VoxelDistanceField bakes the exact signed distance of the shape
+    /// set once, onto a regular grid of samples, after which
+    /// Distance() answers any query with one trilinear interpolation:
+    /// eight array reads, independent of the number of shapes.
+    ///
+    /// Distances are signed: negative inside a shape, positive
+    /// outside, zero on a surface. The baked values are exact at the
+    /// sample points; between samples the interpolation error is
+    /// bounded by the grid resolution, so choose the resolution to
+    /// match the clearance tolerance of the planner.
+    class IGNITION_MATH_VISIBLE VoxelDistanceField
+    {
+      /// \brief Constructor.
+      /// \param[in] _bounds Region covered by the grid. Queries
+      /// outside the region are clamped onto it.
+      /// \param[in] _resolution Edge length of a voxel, in meters.
+      /// Values that are not positive fall back to one meter.
+      public: VoxelDistanceField(const AxisAlignedBox &_bounds,
+                  const double _resolution);
+
+      /// \brief Destructor.
+      public: ~VoxelDistanceField();
+
+      /// \brief Add spheres to the shape set.
+      /// \param[in] _spheres Array of spheres.
+      /// \param[in] _poses Array of _count poses, one per sphere.
+      /// \param[in] _count Number of spheres.
+      public: void AddSpheres(const Sphered *_spheres,
+                  const Pose3d *_poses, const std::size_t _count);
+
+      /// \brief Add boxes to the shape set.
+      /// \param[in] _boxes Array of boxes.
+      /// \param[in] _poses Array of _count poses, one per box.
+      /// \param[in] _count Number of boxes.
+      public: void AddBoxes(const Boxd *_boxes,
+                  const Pose3d *_poses, const std::size_t _count);
+
+      /// \brief Add capsules to the shape set.
+      /// \param[in] _capsules Array of capsules.
+      /// \param[in] _poses Array of _count poses, one per capsule.
+      /// \param[in] _count Number of capsules.
+      public: void AddCapsules(const Capsuled *_capsules,
+                  const Pose3d *_poses, const std::size_t _count);
+
+      /// \brief Bake the distance field: evaluate the exact signed
+      /// distance of the shape set at every grid sample. Baking again
+      /// after adding more shapes rebuilds the field.
+      /// \return The number of grid samples evaluated.
+      public: std::size_t Bake();
+
+      /// \brief Check whether the field has been baked.
+      /// \return True after a Bake() call.
+      public: bool Baked() const;
+
+      /// \brief Get the region covered by the grid.
+      /// \return The bounds passed to the constructor.
+      public: const AxisAlignedBox &Bounds() const;
+
+      /// \brief Get the voxel edge length.
+      /// \return The resolution, in meters.
+      public: double Resolution() const;
+
+      /// \brief Get the signed distance from a point to the nearest
+      /// shape, by trilinear interpolation of the baked samples.
+      /// Points outside the grid are clamped onto its boundary, so
+      /// the returned value is a lower bound on their true distance.
+      /// \param[in] _point The query point.
+      /// \return The interpolated signed distance, or MAX_D when the
+      /// field has not been baked or contains no shapes.
+      public: double Distance(const Vector3d &_point) const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Private data pointer.
+      private: std::unique_ptr<VoxelDistanceFieldPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
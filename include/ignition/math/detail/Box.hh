@@ -139,6 +139,51 @@ bool Box<T>::MassMatrix(MassMatrix3<T> &_massMat) const
 {
   return _massMat.SetFromBox(this->material, this->size);
 }
+
+//////////////////////////////////////////////////
+template<typename T>
+AxisAlignedBox Box<T>::AxisAlignedBoundingBox(const Pose3d &_pose) const
+{
+  // The half extent of the rotated box along each world axis is the
+  // sum of the absolute contributions of the three rotated box axes.
+  const Vector3d half(static_cast<double>(this->size.X()) / 2.0,
+                      static_cast<double>(this->size.Y()) / 2.0,
+                      static_cast<double>(this->size.Z()) / 2.0);
+  const Vector3d extent =
+      _pose.Rot().RotateVector(Vector3d::UnitX * half.X()).Abs() +
+      _pose.Rot().RotateVector(Vector3d::UnitY * half.Y()).Abs() +
+      _pose.Rot().RotateVector(Vector3d::UnitZ * half.Z()).Abs();
+  return AxisAlignedBox(_pose.Pos() - extent, _pose.Pos() + extent);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Box<T>::AxisAlignedBoundingBoxBatch(const Box<T> *_boxes,
+    const Pose3d *_poses, const size_t _count, AxisAlignedBox *_aabbs)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _aabbs[i] = _boxes[i].AxisAlignedBoundingBox(_poses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+Vector3<T> Box<T>::SupportPoint(const Vector3<T> &_dir) const
+{
+  const Vector3<T> half = this->size / T(2);
+  return Vector3<T>(
+      _dir.X() < T(0) ? -half.X() : half.X(),
+      _dir.Y() < T(0) ? -half.Y() : half.Y(),
+      _dir.Z() < T(0) ? -half.Z() : half.Z());
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Box<T>::SupportPointBatch(const Vector3<T> *_dirs,
+    const size_t _count, Vector3<T> *_points) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _points[i] = this->SupportPoint(_dirs[i]);
+}
 }
 }
 #endif
@@ -56,6 +56,7 @@ template<typename T>
 void Capsule<T>::SetRadius(const T _radius)
 {
   this->radius = _radius;
+  this->cachedVolume = -1.0;
 }
 
 //////////////////////////////////////////////////
@@ -70,6 +71,7 @@ template<typename T>
 void Capsule<T>::SetLength(const T _length)
 {
   this->length = _length;
+  this->cachedVolume = -1.0;
 }
 
 //////////////////////////////////////////////////
@@ -135,8 +137,12 @@ std::optional< MassMatrix3<T> > Capsule<T>::MassMatrix() const
 template<typename T>
 T Capsule<T>::Volume() const
 {
-  return IGN_PI * std::pow(this->radius, 2) *
-         (this->length + 4. / 3. * this->radius);
+  if (this->cachedVolume < 0)
+  {
+    this->cachedVolume = IGN_PI * std::pow(this->radius, 2) *
+        (this->length + 4. / 3. * this->radius);
+  }
+  return this->cachedVolume;
 }
 
 //////////////////////////////////////////////////
@@ -161,6 +167,74 @@ T Capsule<T>::DensityFromMass(const T _mass) const
   return _mass / this->Volume();
 }
 
+
+//////////////////////////////////////////////////
+template<typename T>
+void Capsule<T>::MassMatrixBatch(const Capsule<T> *_capsules,
+    const size_t _count, MassMatrix3<T> *_massMats, uint8_t *_valid)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const auto mat = _capsules[i].MassMatrix();
+    _valid[i] = mat.has_value() ? 1 : 0;
+    if (mat)
+      _massMats[i] = *mat;
+  }
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Capsule<T>::DensityFromMassBatch(const Capsule<T> *_capsules,
+    const T *_masses, T *_densities, const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _densities[i] = _capsules[i].DensityFromMass(_masses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+AxisAlignedBox Capsule<T>::AxisAlignedBoundingBox(const Pose3d &_pose) const
+{
+  const Vector3d axis = _pose.Rot().RotateVector(Vector3d::UnitZ).Abs();
+  const double r = static_cast<double>(this->radius);
+  const double halfLen = static_cast<double>(this->length) / 2.0;
+
+  // The capsule is the Minkowski sum of its axis segment and a
+  // sphere, so every world half extent is the segment's reach plus
+  // the radius.
+  const Vector3d extent = axis * halfLen + Vector3d(r, r, r);
+  return AxisAlignedBox(_pose.Pos() - extent, _pose.Pos() + extent);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Capsule<T>::AxisAlignedBoundingBoxBatch(const Capsule<T> *_capsules,
+    const Pose3d *_poses, const size_t _count, AxisAlignedBox *_boxes)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _boxes[i] = _capsules[i].AxisAlignedBoundingBox(_poses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+Vector3<T> Capsule<T>::SupportPoint(const Vector3<T> &_dir) const
+{
+  Vector3<T> point(0, 0,
+      _dir.Z() < T(0) ? -this->length / T(2) : this->length / T(2));
+  const T len = _dir.Length();
+  if (len > T(0))
+    point += _dir * (this->radius / len);
+  return point;
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Capsule<T>::SupportPointBatch(const Vector3<T> *_dirs,
+    const size_t _count, Vector3<T> *_points) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _points[i] = this->SupportPoint(_dirs[i]);
+}
 }
 }
 #endif
@@ -16,6 +16,10 @@
 */
 #ifndef IGNITION_MATH_DETAIL_CYLINDER_HH_
 #define IGNITION_MATH_DETAIL_CYLINDER_HH_
+
+#include <algorithm>
+#include <cmath>
+
 namespace ignition
 {
 namespace math
@@ -54,6 +58,7 @@ template<typename T>
 void Cylinder<T>::SetRadius(const T _radius)
 {
   this->radius = _radius;
+  this->cachedVolume = -1.0;
 }
 
 //////////////////////////////////////////////////
@@ -68,6 +73,7 @@ template<typename T>
 void Cylinder<T>::SetLength(const T _length)
 {
   this->length = _length;
+  this->cachedVolume = -1.0;
 }
 
 //////////////////////////////////////////////////
@@ -120,8 +126,12 @@ bool Cylinder<T>::MassMatrix(MassMatrix3d &_massMat) const
 template<typename T>
 T Cylinder<T>::Volume() const
 {
-  return IGN_PI * std::pow(this->radius, 2) *
-         this->length;
+  if (this->cachedVolume < 0)
+  {
+    this->cachedVolume = IGN_PI * std::pow(this->radius, 2) *
+        this->length;
+  }
+  return this->cachedVolume;
 }
 
 //////////////////////////////////////////////////
@@ -144,6 +154,88 @@ T Cylinder<T>::DensityFromMass(const T _mass) const
   return _mass / this->Volume();
 }
 
+
+//////////////////////////////////////////////////
+template<typename T>
+void Cylinder<T>::MassMatrixBatch(const Cylinder<T> *_cylinders,
+    const size_t _count, MassMatrix3d *_massMats, uint8_t *_valid)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _valid[i] = _cylinders[i].MassMatrix(_massMats[i]) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Cylinder<T>::DensityFromMassBatch(const Cylinder<T> *_cylinders,
+    const T *_masses, T *_densities, const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _densities[i] = _cylinders[i].DensityFromMass(_masses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+AxisAlignedBox Cylinder<T>::AxisAlignedBoundingBox(const Pose3d &_pose) const
+{
+  // World direction of the cylinder axis, including the rotational
+  // offset.
+  const Quaterniond rot = _pose.Rot() * Quaterniond(
+      static_cast<double>(this->rotOffset.W()),
+      static_cast<double>(this->rotOffset.X()),
+      static_cast<double>(this->rotOffset.Y()),
+      static_cast<double>(this->rotOffset.Z()));
+  const Vector3d axis = rot.RotateVector(Vector3d::UnitZ).Abs();
+  const double r = static_cast<double>(this->radius);
+  const double halfLen = static_cast<double>(this->length) / 2.0;
+
+  // Along each world axis the cap centers reach |axis| * halfLen and
+  // the rim adds r * sqrt(1 - axis^2).
+  const Vector3d extent(
+      axis.X() * halfLen +
+      r * std::sqrt(std::max(0.0, 1.0 - axis.X() * axis.X())),
+      axis.Y() * halfLen +
+      r * std::sqrt(std::max(0.0, 1.0 - axis.Y() * axis.Y())),
+      axis.Z() * halfLen +
+      r * std::sqrt(std::max(0.0, 1.0 - axis.Z() * axis.Z())));
+  return AxisAlignedBox(_pose.Pos() - extent, _pose.Pos() + extent);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Cylinder<T>::AxisAlignedBoundingBoxBatch(const Cylinder<T> *_cylinders,
+    const Pose3d *_poses, const size_t _count, AxisAlignedBox *_boxes)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _boxes[i] = _cylinders[i].AxisAlignedBoundingBox(_poses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+Vector3<T> Cylinder<T>::SupportPoint(const Vector3<T> &_dir) const
+{
+  // Work in the axis-aligned frame of the cylinder, then rotate the
+  // result back through the rotational offset.
+  const Vector3<T> d = this->rotOffset.RotateVectorReverse(_dir);
+  Vector3<T> point(0, 0,
+      d.Z() < T(0) ? -this->length / T(2) : this->length / T(2));
+  const T xyLen = static_cast<T>(
+      std::sqrt(d.X() * d.X() + d.Y() * d.Y()));
+  if (xyLen > T(0))
+  {
+    point.X(this->radius * d.X() / xyLen);
+    point.Y(this->radius * d.Y() / xyLen);
+  }
+  return this->rotOffset.RotateVector(point);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Cylinder<T>::SupportPointBatch(const Vector3<T> *_dirs,
+    const size_t _count, Vector3<T> *_points) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _points[i] = this->SupportPoint(_dirs[i]);
+}
 }
 }
 #endif
@@ -50,6 +50,7 @@ template<typename T>
 void Sphere<T>::SetRadius(const T _radius)
 {
   this->radius = _radius;
+  this->cachedVolume = -1.0;
 }
 
 //////////////////////////////////////////////////
@@ -92,7 +93,9 @@ bool Sphere<T>::MassMatrix(MassMatrix3d &_massMat) const
 template<typename T>
 T Sphere<T>::Volume() const
 {
-  return (4.0/3.0) * IGN_PI * std::pow(this->radius, 3);
+  if (this->cachedVolume < 0)
+    this->cachedVolume = (4.0/3.0) * IGN_PI * std::pow(this->radius, 3);
+  return this->cachedVolume;
 }
 
 //////////////////////////////////////////////////
@@ -114,6 +117,61 @@ T Sphere<T>::DensityFromMass(const T _mass) const
 
   return _mass / this->Volume();
 }
+
+//////////////////////////////////////////////////
+template<typename T>
+void Sphere<T>::MassMatrixBatch(const Sphere<T> *_spheres,
+    const size_t _count, MassMatrix3d *_massMats, uint8_t *_valid)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _valid[i] = _spheres[i].MassMatrix(_massMats[i]) ? 1 : 0;
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Sphere<T>::DensityFromMassBatch(const Sphere<T> *_spheres,
+    const T *_masses, T *_densities, const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _densities[i] = _spheres[i].DensityFromMass(_masses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+AxisAlignedBox Sphere<T>::AxisAlignedBoundingBox(const Pose3d &_pose) const
+{
+  const double r = static_cast<double>(this->radius);
+  const Vector3d extent(r, r, r);
+  return AxisAlignedBox(_pose.Pos() - extent, _pose.Pos() + extent);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Sphere<T>::AxisAlignedBoundingBoxBatch(const Sphere<T> *_spheres,
+    const Pose3d *_poses, const size_t _count, AxisAlignedBox *_boxes)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _boxes[i] = _spheres[i].AxisAlignedBoundingBox(_poses[i]);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+Vector3<T> Sphere<T>::SupportPoint(const Vector3<T> &_dir) const
+{
+  const T len = _dir.Length();
+  if (len <= T(0))
+    return Vector3<T>::Zero;
+  return _dir * (this->radius / len);
+}
+
+//////////////////////////////////////////////////
+template<typename T>
+void Sphere<T>::SupportPointBatch(const Vector3<T> *_dirs,
+    const size_t _count, Vector3<T> *_points) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _points[i] = this->SupportPoint(_dirs[i]);
+}
 }
 }
 #endif
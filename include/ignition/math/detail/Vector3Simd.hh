@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_DETAIL_VECTOR3SIMD_HH_
+#define IGNITION_MATH_DETAIL_VECTOR3SIMD_HH_
+
+#include <cmath>
+
+#include <ignition/math/config.hh>
+
+/// Feature gate for the vectorized Vector3 kernels. SIMD code paths are
+/// enabled automatically when the compiler advertises SSE2 or NEON support
+/// and can be turned off by defining IGNITION_MATH_DISABLE_SIMD, in which
+/// case the scalar template below is used everywhere.
+#if !defined(IGNITION_MATH_DISABLE_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define IGNITION_MATH_VECTOR3_SIMD_SSE 1
+#    include <emmintrin.h>
+#  elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define IGNITION_MATH_VECTOR3_SIMD_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    namespace detail
+    {
+    /// \brief Fast single-precision reciprocal square root.
+    ///
+    /// Uses the hardware rsqrt estimate where available, refined with
+    /// two Newton iterations so the result is accurate to an fp32 ulp;
+    /// the portable fallback divides. Used by the float-specialized
+    /// Normalize kernels, which on fp32-bound targets replace a
+    /// square root and a division with multiplies.
+    /// \param[in] _x The value; must be positive.
+    /// \return Approximately 1 / sqrt(_x).
+    inline float InverseSqrt(const float _x)
+    {
+#if defined(IGNITION_MATH_VECTOR3_SIMD_SSE)
+      float est = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_x)));
+      est = est * (1.5f - 0.5f * _x * est * est);
+      return est * (1.5f - 0.5f * _x * est * est);
+#elif defined(IGNITION_MATH_VECTOR3_SIMD_NEON)
+      const float32x2_t x = vdup_n_f32(_x);
+      float32x2_t est = vrsqrte_f32(x);
+      est = vmul_f32(est, vrsqrts_f32(vmul_f32(x, est), est));
+      est = vmul_f32(est, vrsqrts_f32(vmul_f32(x, est), est));
+      return vget_lane_f32(est, 0);
+#else
+      return 1.0f / std::sqrt(_x);
+#endif
+    }
+
+    /// \brief Element-wise kernels used by the hot Vector3 operators.
+    /// The primary template is the portable scalar fallback; the
+    /// specializations below use SSE2 or NEON intrinsics for float and
+    /// double. All kernels read exactly three elements from each input,
+    /// so they are safe on the unpadded Vector3 storage.
+    template<typename T>
+    struct Vector3Ops
+    {
+      /// \brief _out = _a + _b, element-wise.
+      public: static inline void Add(const T *_a, const T *_b, T *_out)
+      {
+        _out[0] = _a[0] + _b[0];
+        _out[1] = _a[1] + _b[1];
+        _out[2] = _a[2] + _b[2];
+      }
+
+      /// \brief _out = _a - _b, element-wise.
+      public: static inline void Sub(const T *_a, const T *_b, T *_out)
+      {
+        _out[0] = _a[0] - _b[0];
+        _out[1] = _a[1] - _b[1];
+        _out[2] = _a[2] - _b[2];
+      }
+
+      /// \brief _out = _a * _b, element-wise.
+      public: static inline void Mul(const T *_a, const T *_b, T *_out)
+      {
+        _out[0] = _a[0] * _b[0];
+        _out[1] = _a[1] * _b[1];
+        _out[2] = _a[2] * _b[2];
+      }
+
+      /// \brief _out = _a * _s.
+      public: static inline void Scale(const T *_a, T _s, T *_out)
+      {
+        _out[0] = _a[0] * _s;
+        _out[1] = _a[1] * _s;
+        _out[2] = _a[2] * _s;
+      }
+
+      /// \brief _out = _a + _b * _s, the fused update of integrator
+      /// loops, evaluated without a temporary vector.
+      public: static inline void AddScaled(const T *_a, const T *_b,
+                  T _s, T *_out)
+      {
+        _out[0] = _a[0] + _b[0] * _s;
+        _out[1] = _a[1] + _b[1] * _s;
+        _out[2] = _a[2] + _b[2] * _s;
+      }
+
+      /// \brief Dot product of _a and _b.
+      public: static inline T Dot(const T *_a, const T *_b)
+      {
+        return _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2];
+      }
+
+      /// \brief Sum of the squared elements of _a.
+      public: static inline T SquaredLength(const T *_a)
+      {
+        return _a[0] * _a[0] + _a[1] * _a[1] + _a[2] * _a[2];
+      }
+
+      /// \brief _out = _a x _b.
+      public: static inline void Cross(const T *_a, const T *_b, T *_out)
+      {
+        _out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+        _out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+        _out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+      }
+    };
+
+#ifdef IGNITION_MATH_VECTOR3_SIMD_SSE
+    /// \brief SSE2 kernels for Vector3<double>. The x and y elements travel
+    /// in one 128-bit lane pair; z is handled as a scalar. Cross products
+    /// stay scalar: the shuffles needed for two-lane doubles cost more than
+    /// the six multiplies they would replace.
+    template<>
+    struct Vector3Ops<double>
+    {
+      public: static inline void Add(const double *_a, const double *_b,
+                  double *_out)
+      {
+        _mm_storeu_pd(_out, _mm_add_pd(_mm_loadu_pd(_a), _mm_loadu_pd(_b)));
+        _out[2] = _a[2] + _b[2];
+      }
+
+      public: static inline void Sub(const double *_a, const double *_b,
+                  double *_out)
+      {
+        _mm_storeu_pd(_out, _mm_sub_pd(_mm_loadu_pd(_a), _mm_loadu_pd(_b)));
+        _out[2] = _a[2] - _b[2];
+      }
+
+      public: static inline void Mul(const double *_a, const double *_b,
+                  double *_out)
+      {
+        _mm_storeu_pd(_out, _mm_mul_pd(_mm_loadu_pd(_a), _mm_loadu_pd(_b)));
+        _out[2] = _a[2] * _b[2];
+      }
+
+      public: static inline void Scale(const double *_a, double _s,
+                  double *_out)
+      {
+        _mm_storeu_pd(_out, _mm_mul_pd(_mm_loadu_pd(_a), _mm_set1_pd(_s)));
+        _out[2] = _a[2] * _s;
+      }
+
+      public: static inline void AddScaled(const double *_a,
+                  const double *_b, double _s, double *_out)
+      {
+        _mm_storeu_pd(_out, _mm_add_pd(_mm_loadu_pd(_a),
+            _mm_mul_pd(_mm_loadu_pd(_b), _mm_set1_pd(_s))));
+        _out[2] = _a[2] + _b[2] * _s;
+      }
+
+      public: static inline double Dot(const double *_a, const double *_b)
+      {
+        __m128d prod = _mm_mul_pd(_mm_loadu_pd(_a), _mm_loadu_pd(_b));
+        __m128d sum = _mm_add_sd(prod, _mm_unpackhi_pd(prod, prod));
+        return _mm_cvtsd_f64(sum) + _a[2] * _b[2];
+      }
+
+      public: static inline double SquaredLength(const double *_a)
+      {
+        return Dot(_a, _a);
+      }
+
+      public: static inline void Cross(const double *_a, const double *_b,
+                  double *_out)
+      {
+        _out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+        _out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+        _out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+      }
+    };
+
+    /// \brief SSE kernels for Vector3<float>. Elements are gathered into a
+    /// single 128-bit register with the fourth lane zeroed; loads and stores
+    /// touch only the three valid elements.
+    template<>
+    struct Vector3Ops<float>
+    {
+      private: static inline __m128 Load(const float *_a)
+      {
+        return _mm_set_ps(0.0f, _a[2], _a[1], _a[0]);
+      }
+
+      private: static inline void Store(__m128 _v, float *_out)
+      {
+        _mm_store_ss(_out, _v);
+        _mm_store_ss(_out + 1,
+            _mm_shuffle_ps(_v, _v, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(_out + 2, _mm_movehl_ps(_v, _v));
+      }
+
+      public: static inline void Add(const float *_a, const float *_b,
+                  float *_out)
+      {
+        Store(_mm_add_ps(Load(_a), Load(_b)), _out);
+      }
+
+      public: static inline void Sub(const float *_a, const float *_b,
+                  float *_out)
+      {
+        Store(_mm_sub_ps(Load(_a), Load(_b)), _out);
+      }
+
+      public: static inline void Mul(const float *_a, const float *_b,
+                  float *_out)
+      {
+        Store(_mm_mul_ps(Load(_a), Load(_b)), _out);
+      }
+
+      public: static inline void Scale(const float *_a, float _s, float *_out)
+      {
+        Store(_mm_mul_ps(Load(_a), _mm_set1_ps(_s)), _out);
+      }
+
+      public: static inline void AddScaled(const float *_a, const float *_b,
+                  float _s, float *_out)
+      {
+        Store(_mm_add_ps(Load(_a), _mm_mul_ps(Load(_b), _mm_set1_ps(_s))),
+            _out);
+      }
+
+      public: static inline float Dot(const float *_a, const float *_b)
+      {
+        __m128 prod = _mm_mul_ps(Load(_a), Load(_b));
+        __m128 sum = _mm_add_ss(
+            _mm_add_ss(prod,
+                _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(1, 1, 1, 1))),
+            _mm_movehl_ps(prod, prod));
+        return _mm_cvtss_f32(sum);
+      }
+
+      public: static inline float SquaredLength(const float *_a)
+      {
+        return Dot(_a, _a);
+      }
+
+      public: static inline void Cross(const float *_a, const float *_b,
+                  float *_out)
+      {
+        // yzx / zxy shuffles of the two operands
+        __m128 va = Load(_a);
+        __m128 vb = Load(_b);
+        __m128 aYzx = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 bYzx = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(va, bYzx), _mm_mul_ps(aYzx, vb));
+        Store(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)), _out);
+      }
+    };
+#endif
+
+#ifdef IGNITION_MATH_VECTOR3_SIMD_NEON
+    /// \brief NEON kernels for Vector3<float>. The x and y elements use a
+    /// 64-bit lane pair; z rides in the low lane of a second pair so no
+    /// load or store ever touches a fourth element.
+    template<>
+    struct Vector3Ops<float>
+    {
+      public: static inline void Add(const float *_a, const float *_b,
+                  float *_out)
+      {
+        vst1_f32(_out, vadd_f32(vld1_f32(_a), vld1_f32(_b)));
+        _out[2] = _a[2] + _b[2];
+      }
+
+      public: static inline void Sub(const float *_a, const float *_b,
+                  float *_out)
+      {
+        vst1_f32(_out, vsub_f32(vld1_f32(_a), vld1_f32(_b)));
+        _out[2] = _a[2] - _b[2];
+      }
+
+      public: static inline void Mul(const float *_a, const float *_b,
+                  float *_out)
+      {
+        vst1_f32(_out, vmul_f32(vld1_f32(_a), vld1_f32(_b)));
+        _out[2] = _a[2] * _b[2];
+      }
+
+      public: static inline void Scale(const float *_a, float _s, float *_out)
+      {
+        vst1_f32(_out, vmul_n_f32(vld1_f32(_a), _s));
+        _out[2] = _a[2] * _s;
+      }
+
+      public: static inline void AddScaled(const float *_a, const float *_b,
+                  float _s, float *_out)
+      {
+        vst1_f32(_out, vmla_n_f32(vld1_f32(_a), vld1_f32(_b), _s));
+        _out[2] = _a[2] + _b[2] * _s;
+      }
+
+      public: static inline float Dot(const float *_a, const float *_b)
+      {
+        float32x2_t prod = vmul_f32(vld1_f32(_a), vld1_f32(_b));
+        return vget_lane_f32(vpadd_f32(prod, prod), 0) + _a[2] * _b[2];
+      }
+
+      public: static inline float SquaredLength(const float *_a)
+      {
+        return Dot(_a, _a);
+      }
+
+      public: static inline void Cross(const float *_a, const float *_b,
+                  float *_out)
+      {
+        _out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+        _out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+        _out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+      }
+    };
+
+#ifdef __aarch64__
+    /// \brief NEON kernels for Vector3<double>, mirroring the SSE2 layout:
+    /// x and y in a 128-bit pair, z as a scalar.
+    template<>
+    struct Vector3Ops<double>
+    {
+      public: static inline void Add(const double *_a, const double *_b,
+                  double *_out)
+      {
+        vst1q_f64(_out, vaddq_f64(vld1q_f64(_a), vld1q_f64(_b)));
+        _out[2] = _a[2] + _b[2];
+      }
+
+      public: static inline void Sub(const double *_a, const double *_b,
+                  double *_out)
+      {
+        vst1q_f64(_out, vsubq_f64(vld1q_f64(_a), vld1q_f64(_b)));
+        _out[2] = _a[2] - _b[2];
+      }
+
+      public: static inline void Mul(const double *_a, const double *_b,
+                  double *_out)
+      {
+        vst1q_f64(_out, vmulq_f64(vld1q_f64(_a), vld1q_f64(_b)));
+        _out[2] = _a[2] * _b[2];
+      }
+
+      public: static inline void Scale(const double *_a, double _s,
+                  double *_out)
+      {
+        vst1q_f64(_out, vmulq_n_f64(vld1q_f64(_a), _s));
+        _out[2] = _a[2] * _s;
+      }
+
+      public: static inline void AddScaled(const double *_a,
+                  const double *_b, double _s, double *_out)
+      {
+        vst1q_f64(_out, vaddq_f64(vld1q_f64(_a),
+            vmulq_n_f64(vld1q_f64(_b), _s)));
+        _out[2] = _a[2] + _b[2] * _s;
+      }
+
+      public: static inline double Dot(const double *_a, const double *_b)
+      {
+        float64x2_t prod = vmulq_f64(vld1q_f64(_a), vld1q_f64(_b));
+        return vaddvq_f64(prod) + _a[2] * _b[2];
+      }
+
+      public: static inline double SquaredLength(const double *_a)
+      {
+        return Dot(_a, _a);
+      }
+
+      public: static inline void Cross(const double *_a, const double *_b,
+                  double *_out)
+      {
+        _out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+        _out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+        _out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+      }
+    };
+#endif
+#endif
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,448 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_GRAPH_COMPRESSEDGRAPH_HH_
+#define IGNITION_MATH_GRAPH_COMPRESSEDGRAPH_HH_
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include <ignition/math/config.hh>
+#include "ignition/math/graph/Graph.hh"
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace graph
+{
+  /// \brief Index value returned when a vertex Id is not part of a
+  /// CompressedGraph.
+  static const std::size_t kInvalidIndex =
+      std::numeric_limits<std::size_t>::max();
+
+  /// \brief Storage policy of a CompressedGraph: whether the snapshot
+  /// materializes the user payloads next to the topology. Structure-only
+  /// algorithms should use TOPOLOGY_ONLY so their working set holds
+  /// nothing but the index arrays.
+  enum class GraphStorage
+  {
+    /// \brief Store only the offset, target and weight arrays.
+    TOPOLOGY_ONLY = 0,
+
+    /// \brief Additionally copy vertex and edge payloads into separate
+    /// columns, accessed by index.
+    WITH_PAYLOADS = 1
+  };
+
+  /// \brief An immutable compressed-sparse-row (CSR) snapshot of a Graph.
+  ///
+  /// Graph stores its vertices, edges and adjacency sets in node-based
+  /// std::map containers, which is flexible for mutation but pointer-chasing
+  /// heavy for traversal. A CompressedGraph copies the topology once into
+  /// three contiguous arrays: a per-vertex offset array, a neighbor index
+  /// array and a parallel edge-weight array. Vertices are renumbered to
+  /// contiguous indices [0, VertexCount()), in ascending VertexId order,
+  /// so read-mostly workloads (BFS, shortest paths, page-rank style sweeps)
+  /// iterate adjacency cache-linearly.
+  ///
+  /// The storage policy keeps user payloads out of the topology arrays:
+  /// with GraphStorage::WITH_PAYLOADS the vertex and edge data are
+  /// copied into their own columns, parallel to the index arrays, so a
+  /// sweep that only follows structure never drags payload bytes
+  /// through cache, and a sweep that needs payloads reads them by
+  /// index from a contiguous column.
+  ///
+  /// The snapshot does not observe later changes to the source graph;
+  /// rebuild it after mutating the graph.
+  template<typename V, typename E, typename EdgeType,
+           GraphStorage Storage = GraphStorage::TOPOLOGY_ONLY>
+  class CompressedGraph
+  {
+    /// \brief Build a snapshot of a graph.
+    /// \param[in] _graph The graph to compress.
+    public: explicit CompressedGraph(const Graph<V, E, EdgeType> &_graph)
+    {
+      // Assign contiguous indices in ascending Id order.
+      for (auto const &vPair : _graph.Vertices())
+      {
+        this->indexFromId[vPair.first] = this->ids.size();
+        this->ids.push_back(vPair.first);
+      }
+
+      this->offsets.reserve(this->ids.size() + 1);
+      this->offsets.push_back(0);
+
+      for (auto const &id : this->ids)
+      {
+        for (auto const &edgePair : _graph.IncidentsFrom(id))
+        {
+          const auto &edge = edgePair.second.get();
+          this->targets.push_back(this->indexFromId.at(edge.From(id)));
+          this->weights.push_back(edge.Weight());
+          if constexpr (Storage == GraphStorage::WITH_PAYLOADS)
+            this->edgeData.push_back(edge.Data());
+        }
+        this->offsets.push_back(this->targets.size());
+      }
+
+      if constexpr (Storage == GraphStorage::WITH_PAYLOADS)
+      {
+        this->vertexData.reserve(this->ids.size());
+        for (auto const &id : this->ids)
+          this->vertexData.push_back(_graph.VertexFromId(id).Data());
+      }
+    }
+
+    /// \brief Get the number of vertices in the snapshot.
+    /// \return The vertex count.
+    public: std::size_t VertexCount() const
+    {
+      return this->ids.size();
+    }
+
+    /// \brief Get the number of adjacency entries in the snapshot. For
+    /// undirected graphs each edge appears twice, once per endpoint.
+    /// \return The adjacency entry count.
+    public: std::size_t EntryCount() const
+    {
+      return this->targets.size();
+    }
+
+    /// \brief Get the original vertex Id of a contiguous index.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \return The vertex Id.
+    public: VertexId IdFromIndex(std::size_t _index) const
+    {
+      return this->ids[_index];
+    }
+
+    /// \brief Get the contiguous index of a vertex Id.
+    /// \param[in] _id A vertex Id.
+    /// \return The vertex index, or kInvalidIndex if the Id was not part
+    /// of the snapshot.
+    public: std::size_t IndexFromId(const VertexId &_id) const
+    {
+      auto it = this->indexFromId.find(_id);
+      return it != this->indexFromId.end() ? it->second : kInvalidIndex;
+    }
+
+    /// \brief Get the out-degree of a vertex.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \return The number of adjacency entries of the vertex.
+    public: std::size_t Degree(std::size_t _index) const
+    {
+      return this->offsets[_index + 1] - this->offsets[_index];
+    }
+
+    /// \brief Get the per-vertex offsets into Targets() and Weights().
+    /// The entries of vertex i occupy positions [Offsets()[i],
+    /// Offsets()[i+1]).
+    /// \return The offset array, of size VertexCount() + 1.
+    public: const std::vector<std::size_t> &Offsets() const
+    {
+      return this->offsets;
+    }
+
+    /// \brief Get the neighbor vertex indices, grouped by source vertex.
+    /// \return The neighbor index array.
+    public: const std::vector<std::size_t> &Targets() const
+    {
+      return this->targets;
+    }
+
+    /// \brief Get the edge weights, parallel to Targets().
+    /// \return The weight array.
+    public: const std::vector<double> &Weights() const
+    {
+      return this->weights;
+    }
+
+    /// \brief Get the payload of a vertex. Only available with the
+    /// GraphStorage::WITH_PAYLOADS storage policy.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \return The vertex payload.
+    public: const V &VertexData(std::size_t _index) const
+    {
+      static_assert(Storage == GraphStorage::WITH_PAYLOADS,
+          "VertexData requires GraphStorage::WITH_PAYLOADS");
+      return this->vertexData[_index];
+    }
+
+    /// \brief Get the payload of an adjacency entry. For undirected
+    /// graphs each edge payload appears twice, once per endpoint, like
+    /// Weights(). Only available with the GraphStorage::WITH_PAYLOADS
+    /// storage policy.
+    /// \param[in] _entry An adjacency entry index; not range checked.
+    /// \return The edge payload.
+    public: const E &EdgeData(std::size_t _entry) const
+    {
+      static_assert(Storage == GraphStorage::WITH_PAYLOADS,
+          "EdgeData requires GraphStorage::WITH_PAYLOADS");
+      return this->edgeData[_entry];
+    }
+
+    /// \brief Get the vertex payload column, indexed like Offsets().
+    /// Only available with the GraphStorage::WITH_PAYLOADS storage
+    /// policy.
+    /// \return The vertex payload column, of size VertexCount().
+    public: const std::vector<V> &VertexDataColumn() const
+    {
+      static_assert(Storage == GraphStorage::WITH_PAYLOADS,
+          "VertexDataColumn requires GraphStorage::WITH_PAYLOADS");
+      return this->vertexData;
+    }
+
+    /// \brief Get the edge payload column, parallel to Targets().
+    /// Only available with the GraphStorage::WITH_PAYLOADS storage
+    /// policy.
+    /// \return The edge payload column, of size EntryCount().
+    public: const std::vector<E> &EdgeDataColumn() const
+    {
+      static_assert(Storage == GraphStorage::WITH_PAYLOADS,
+          "EdgeDataColumn requires GraphStorage::WITH_PAYLOADS");
+      return this->edgeData;
+    }
+
+    /// \brief Get the vertex Ids by contiguous index, e.g. to copy the
+    /// snapshot's arrays into a shared-memory segment alongside
+    /// Offsets(), Targets() and Weights().
+    /// \return The Id array, of size VertexCount(), ascending.
+    public: const std::vector<VertexId> &Ids() const
+    {
+      return this->ids;
+    }
+
+    /// \brief Vertex Ids by contiguous index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Map from vertex Id to contiguous index.
+    private: std::map<VertexId, std::size_t> indexFromId;
+
+    /// \brief CSR row offsets; offsets[i+1] - offsets[i] is the degree of
+    /// vertex i.
+    private: std::vector<std::size_t> offsets;
+
+    /// \brief CSR neighbor indices.
+    private: std::vector<std::size_t> targets;
+
+    /// \brief Edge weights, parallel to targets.
+    private: std::vector<double> weights;
+
+    /// \brief Vertex payload column; empty for TOPOLOGY_ONLY.
+    private: std::vector<V> vertexData;
+
+    /// \brief Edge payload column, parallel to targets; empty for
+    /// TOPOLOGY_ONLY.
+    private: std::vector<E> edgeData;
+  };
+
+  /// \brief A non-owning adjacency-array view of a graph.
+  ///
+  /// Passing a graph between processes by re-inserting every vertex and
+  /// edge through Graph::AddVertex / Graph::AddEdge on the receiving
+  /// side rebuilds the node-based containers element by element. A
+  /// CompressedGraphView instead wraps contiguous, externally-owned CSR
+  /// arrays — such as a shared-memory segment the sender filled from a
+  /// CompressedGraph's Offsets(), Targets(), Weights() and Ids() — and
+  /// answers the same topology queries without copying or inserting
+  /// anything. Construction is O(1); the arrays must outlive the view.
+  ///
+  /// The view is topology-only: payloads stay wherever the caller keeps
+  /// them, indexed by the same contiguous vertex and entry indices.
+  class CompressedGraphView
+  {
+    /// \brief Construct an empty view.
+    public: CompressedGraphView() = default;
+
+    /// \brief Wrap externally-owned CSR arrays.
+    /// \param[in] _vertexCount Number of vertices.
+    /// \param[in] _offsets Per-vertex offsets, of size _vertexCount + 1;
+    /// must not be null when _vertexCount > 0.
+    /// \param[in] _targets Neighbor indices, of size
+    /// _offsets[_vertexCount].
+    /// \param[in] _weights Optional edge weights, parallel to _targets.
+    /// When null every entry weighs 1.
+    /// \param[in] _ids Optional original vertex Ids by index, ascending,
+    /// of size _vertexCount. When null index i maps to Id i.
+    public: CompressedGraphView(const std::size_t _vertexCount,
+                const std::size_t *_offsets,
+                const std::size_t *_targets,
+                const double *_weights = nullptr,
+                const VertexId *_ids = nullptr)
+      : vertexCount(_vertexCount), offsets(_offsets), targets(_targets),
+        weights(_weights), ids(_ids)
+    {
+    }
+
+    /// \brief Wrap the arrays of an owning snapshot, e.g. to hand one
+    /// query surface to code that serves both in-process snapshots and
+    /// shared-memory segments.
+    /// \param[in] _graph The snapshot to view; must outlive the view.
+    public: template<typename V, typename E, typename EdgeType,
+                     GraphStorage Storage>
+    explicit CompressedGraphView(
+        const CompressedGraph<V, E, EdgeType, Storage> &_graph)
+      : CompressedGraphView(_graph.VertexCount(), _graph.Offsets().data(),
+            _graph.Targets().data(), _graph.Weights().data(),
+            _graph.Ids().data())
+    {
+    }
+
+    /// \brief Get the number of vertices in the view.
+    /// \return The vertex count.
+    public: std::size_t VertexCount() const
+    {
+      return this->vertexCount;
+    }
+
+    /// \brief Get the number of adjacency entries in the view.
+    /// \return The adjacency entry count.
+    public: std::size_t EntryCount() const
+    {
+      return this->vertexCount > 0 ? this->offsets[this->vertexCount] : 0;
+    }
+
+    /// \brief Get the original vertex Id of a contiguous index.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \return The vertex Id.
+    public: VertexId IdFromIndex(std::size_t _index) const
+    {
+      return this->ids ? this->ids[_index]
+                       : static_cast<VertexId>(_index);
+    }
+
+    /// \brief Get the contiguous index of a vertex Id, by binary search
+    /// over the ascending Id array.
+    /// \param[in] _id A vertex Id.
+    /// \return The vertex index, or kInvalidIndex if the Id is not part
+    /// of the view.
+    public: std::size_t IndexFromId(const VertexId &_id) const
+    {
+      if (!this->ids)
+      {
+        const auto index = static_cast<std::size_t>(_id);
+        return index < this->vertexCount ? index : kInvalidIndex;
+      }
+      std::size_t lo = 0;
+      std::size_t hi = this->vertexCount;
+      while (lo < hi)
+      {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (this->ids[mid] < _id)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      return lo < this->vertexCount && this->ids[lo] == _id ?
+          lo : kInvalidIndex;
+    }
+
+    /// \brief Get the out-degree of a vertex.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \return The number of adjacency entries of the vertex.
+    public: std::size_t Degree(std::size_t _index) const
+    {
+      return this->offsets[_index + 1] - this->offsets[_index];
+    }
+
+    /// \brief Get a neighbor of a vertex.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \param[in] _nth An entry in [0, Degree(_index)); not range
+    /// checked.
+    /// \return The neighbor's vertex index.
+    public: std::size_t Target(std::size_t _index, std::size_t _nth) const
+    {
+      return this->targets[this->offsets[_index] + _nth];
+    }
+
+    /// \brief Get the weight of an adjacency entry of a vertex.
+    /// \param[in] _index A vertex index; not range checked.
+    /// \param[in] _nth An entry in [0, Degree(_index)); not range
+    /// checked.
+    /// \return The entry's edge weight, or 1 when the view has no
+    /// weight array.
+    public: double Weight(std::size_t _index, std::size_t _nth) const
+    {
+      return this->weights ?
+          this->weights[this->offsets[_index] + _nth] : 1.0;
+    }
+
+    /// \brief Get the per-vertex offsets into Targets() and Weights().
+    /// \return The offset array, of size VertexCount() + 1.
+    public: const std::size_t *Offsets() const
+    {
+      return this->offsets;
+    }
+
+    /// \brief Get the neighbor vertex indices, grouped by source vertex.
+    /// \return The neighbor index array, or null for an empty view.
+    public: const std::size_t *Targets() const
+    {
+      return this->targets;
+    }
+
+    /// \brief Get the edge weights, parallel to Targets().
+    /// \return The weight array, or null when the view has no weights.
+    public: const double *Weights() const
+    {
+      return this->weights;
+    }
+
+    /// \brief Number of vertices.
+    private: std::size_t vertexCount = 0;
+
+    /// \brief CSR row offsets; externally owned.
+    private: const std::size_t *offsets = nullptr;
+
+    /// \brief CSR neighbor indices; externally owned.
+    private: const std::size_t *targets = nullptr;
+
+    /// \brief Edge weights, parallel to targets; externally owned,
+    /// optional.
+    private: const double *weights = nullptr;
+
+    /// \brief Vertex Ids by index, ascending; externally owned,
+    /// optional.
+    private: const VertexId *ids = nullptr;
+  };
+
+  /// \brief A CompressedGraph snapshot of a DirectedGraph.
+  template<typename V, typename E>
+  using CompressedDirectedGraph = CompressedGraph<V, E, DirectedEdge<E>>;
+
+  /// \brief A CompressedGraph snapshot of an UndirectedGraph.
+  template<typename V, typename E>
+  using CompressedUndirectedGraph = CompressedGraph<V, E, UndirectedEdge<E>>;
+
+  /// \brief A DirectedGraph snapshot with payload columns.
+  template<typename V, typename E>
+  using ColumnarDirectedGraph =
+      CompressedGraph<V, E, DirectedEdge<E>, GraphStorage::WITH_PAYLOADS>;
+
+  /// \brief An UndirectedGraph snapshot with payload columns.
+  template<typename V, typename E>
+  using ColumnarUndirectedGraph =
+      CompressedGraph<V, E, UndirectedEdge<E>, GraphStorage::WITH_PAYLOADS>;
+}
+}
+}
+}
+#endif
@@ -23,6 +23,7 @@
 #include <iostream>
 #include <map>
 #include <set>
+#include <utility>
 
 #include <ignition/math/config.hh>
 #include "ignition/math/graph/Vertex.hh"
@@ -88,6 +89,22 @@ namespace graph
     {
     }
 
+    /// \brief Constructor that takes ownership of the edge data.
+    /// \param[in] _vertices The vertices of the edge.
+    /// \param[in] _data The data to move into the edge.
+    /// \param[in] _weight The weight (cost) of the edge.
+    /// \param[in] _id Optional unique id.
+    public: explicit Edge(const VertexId_P &_vertices,
+                          E &&_data,
+                          const double _weight,
+                          const EdgeId &_id = kNullId)
+      : id(_id),
+        vertices(_vertices),
+        data(std::move(_data)),
+        weight(_weight)
+    {
+    }
+
     /// \brief Get the edge Id.
     /// \return The edge Id.
     public: EdgeId Id() const
@@ -219,6 +236,19 @@ namespace graph
     {
     }
 
+    /// \brief Constructor that takes ownership of the edge data.
+    /// \param[in] _vertices The vertices of the edge.
+    /// \param[in] _data The data to move into the edge.
+    /// \param[in] _weight The weight (cost) of the edge.
+    /// \param[in] _id Optional unique id.
+    public: explicit UndirectedEdge(const VertexId_P &_vertices,
+                                    E &&_data,
+                                    const double _weight,
+                                    const EdgeId &_id = kNullId)
+      : Edge<E>(_vertices, std::move(_data), _weight, _id)
+    {
+    }
+
     // Documentation inherited.
     public: VertexId From(const VertexId &_from) const override
     {
@@ -282,6 +312,19 @@ namespace graph
     {
     }
 
+    /// \brief Constructor that takes ownership of the edge data.
+    /// \param[in] _vertices The vertices of the edge.
+    /// \param[in] _data The data to move into the edge.
+    /// \param[in] _weight The weight (cost) of the edge.
+    /// \param[in] _id Optional unique id.
+    public: explicit DirectedEdge(const VertexId_P &_vertices,
+                                  E &&_data,
+                                  const double _weight,
+                                  const EdgeId &_id = kNullId)
+      : Edge<E>(_vertices, std::move(_data), _weight, _id)
+    {
+    }
+
     /// \brief Get the Id of the tail vertex in this edge.
     /// \return An id of the tail vertex in this edge.
     /// \sa Head()
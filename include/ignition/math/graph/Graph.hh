@@ -17,11 +17,13 @@
 #ifndef IGNITION_MATH_GRAPH_GRAPH_HH_
 #define IGNITION_MATH_GRAPH_GRAPH_HH_
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <map>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -37,6 +39,37 @@ namespace math
 inline namespace IGNITION_MATH_VERSION_NAMESPACE {
 namespace graph
 {
+  /// \brief One record of a graph's change journal.
+  /// \sa Graph::EnableJournal
+  struct GraphChange
+  {
+    /// \brief The kind of change.
+    public: enum Operation
+    {
+      /// \brief A vertex was added; fetch it with VertexFromId.
+      ADD_VERTEX = 0,
+      /// \brief A vertex was removed.
+      REMOVE_VERTEX = 1,
+      /// \brief A vertex's data or name changed; see TouchVertex.
+      MODIFY_VERTEX = 2,
+      /// \brief An edge was added; fetch it with EdgeFromId.
+      ADD_EDGE = 3,
+      /// \brief An edge was removed.
+      REMOVE_EDGE = 4,
+      /// \brief An edge's data or weight changed; see TouchEdge.
+      MODIFY_EDGE = 5
+    };
+
+    /// \brief The graph version this change produced.
+    public: uint64_t version;
+
+    /// \brief The kind of change.
+    public: Operation operation;
+
+    /// \brief Id of the vertex or edge that changed.
+    public: uint64_t id;
+  };
+
   /// \brief A generic graph class.
   /// Both vertices and edges can store user information. A vertex could be
   /// created passing a custom Id if needed, otherwise it will be choosen
@@ -98,7 +131,8 @@ namespace graph
   ///     {{2, 3}, 6.3, 1.1}, {{3, 4}, 4.2, 2.3}
   ///   });
   /// \endcode
-  template<typename V, typename E, typename EdgeType>
+  template<typename V, typename E, typename EdgeType,
+           typename NameStorageT = std::string>
   class Graph
   {
     /// \brief Default constructor.
@@ -107,7 +141,7 @@ namespace graph
     /// \brief Constructor.
     /// \param[in] _vertices Collection of vertices.
     /// \param[in] _edges Collection of edges.
-    public: Graph(const std::vector<Vertex<V>> &_vertices,
+    public: Graph(const std::vector<Vertex<V, NameStorageT>> &_vertices,
                   const std::vector<EdgeInitializer<E>> &_edges)
     {
       // Add all vertices.
@@ -134,9 +168,24 @@ namespace graph
     /// \param[in] _id Optional Id to be used for this vertex. This Id must
     /// be unique.
     /// \return A reference to the new vertex.
-    public: Vertex<V> &AddVertex(const std::string &_name,
+    public: Vertex<V, NameStorageT> &AddVertex(const std::string &_name,
                                  const V &_data,
                                  const VertexId &_id = kNullId)
+    {
+      return this->AddVertex(_name, V(_data), _id);
+    }
+
+    /// \brief Add a new vertex to the graph, moving the data into place.
+    /// Prefer this overload when V is expensive to copy; the data is
+    /// forward-constructed into the internal storage without an extra copy.
+    /// \param[in] _name Name of the vertex. It doesn't have to be unique.
+    /// \param[in] _data Data to be moved into the vertex.
+    /// \param[in] _id Optional Id to be used for this vertex. This Id must
+    /// be unique.
+    /// \return A reference to the new vertex.
+    public: Vertex<V, NameStorageT> &AddVertex(const std::string &_name,
+                                 V &&_data,
+                                 const VertexId &_id = kNullId)
     {
       auto id = _id;
 
@@ -150,37 +199,42 @@ namespace graph
         {
           std::cerr << "[Graph::AddVertex()] The limit of vertices has been "
                     << "reached. Ignoring vertex." << std::endl;
-          return Vertex<V>::NullVertex;
+          return Vertex<V, NameStorageT>::NullVertex;
         }
       }
 
-      // Create the vertex.
-      auto ret = this->vertices.insert(
-        std::make_pair(id, Vertex<V>(_name, _data, id)));
+      // Create the vertex in place.
+      auto ret = this->vertices.emplace(std::piecewise_construct,
+        std::forward_as_tuple(id),
+        std::forward_as_tuple(_name, std::move(_data), id));
 
       // The Id already exists.
       if (!ret.second)
       {
         std::cerr << "[Graph::AddVertex()] Repeated vertex [" << id << "]"
                   << std::endl;
-        return Vertex<V>::NullVertex;
+        return Vertex<V, NameStorageT>::NullVertex;
       }
 
+      this->IndexVertex(id, &ret.first->second);
+
       // Link the vertex with an empty list of edges.
       this->adjList[id] = EdgeId_S();
 
       // Update the map of names.
       this->names.insert(std::make_pair(_name, id));
 
+      this->Journal(GraphChange::ADD_VERTEX, id);
+
       return ret.first->second;
     }
 
     /// \brief The collection of all vertices in the graph.
     /// \return A map of vertices, where keys are Ids and values are
     /// references to the vertices.
-    public: const VertexRef_M<V> Vertices() const
+    public: const VertexRef_M<V, NameStorageT> Vertices() const
     {
-      VertexRef_M<V> res;
+      VertexRef_M<V, NameStorageT> res;
       for (auto const &v : this->vertices)
         res.emplace(std::make_pair(v.first, std::cref(v.second)));
 
@@ -190,9 +244,9 @@ namespace graph
     /// \brief The collection of all vertices in the graph with name == _name.
     /// \return A map of vertices, where keys are Ids and values are
     /// references to the vertices.
-    public: const VertexRef_M<V> Vertices(const std::string &_name) const
+    public: const VertexRef_M<V, NameStorageT> Vertices(const std::string &_name) const
     {
-      VertexRef_M<V> res;
+      VertexRef_M<V, NameStorageT> res;
       for (auto const &vertex : this->vertices)
       {
         if (vertex.second.Name() == _name)
@@ -211,6 +265,20 @@ namespace graph
     public: EdgeType &AddEdge(const VertexId_P &_vertices,
                               const E &_data,
                               const double _weight = 1.0)
+    {
+      return this->AddEdge(_vertices, E(_data), _weight);
+    }
+
+    /// \brief Add a new edge to the graph, moving the data into place.
+    /// Prefer this overload when E is expensive to copy.
+    /// \param[in] _vertices The set of Ids of the two vertices.
+    /// \param[in] _data User data to be moved into the edge.
+    /// \param[in] _weight Edge weight.
+    /// \return Reference to the new edge created or NullEdge if the
+    /// edge was not created (e.g. incorrect vertices).
+    public: EdgeType &AddEdge(const VertexId_P &_vertices,
+                              E &&_data,
+                              const double _weight = 1.0)
     {
       auto id = this->NextEdgeId();
 
@@ -222,7 +290,7 @@ namespace graph
         return EdgeType::NullEdge;
       }
 
-      EdgeType newEdge(_vertices, _data, _weight, id);
+      EdgeType newEdge(_vertices, std::move(_data), _weight, id);
       return this->LinkEdge(std::move(newEdge));
     }
 
@@ -233,6 +301,15 @@ namespace graph
     /// \param[in] _edge An edge to copy into the graph.
     /// \return A reference to the new edge.
     public: EdgeType &LinkEdge(const EdgeType &_edge)
+    {
+      return this->LinkEdge(EdgeType(_edge));
+    }
+
+    /// \brief Links an edge to the graph, moving it into the internal
+    /// data structure instead of copying it.
+    /// \param[in] _edge An edge to move into the graph.
+    /// \return A reference to the new edge.
+    public: EdgeType &LinkEdge(EdgeType &&_edge)
     {
       auto edgeVertices = _edge.Vertices();
 
@@ -254,7 +331,10 @@ namespace graph
         }
       }
 
-      auto ret = this->edges.insert(std::make_pair(_edge.Id(), _edge));
+      const auto edgeId = _edge.Id();
+      auto ret = this->edges.insert(std::make_pair(edgeId, std::move(_edge)));
+
+      this->Journal(GraphChange::ADD_EDGE, edgeId);
 
       // Return the new edge.
       return ret.first->second;
@@ -289,9 +369,9 @@ namespace graph
     /// references to the vertices. This is the set of adjacent vertices.
     /// An empty map will be returned when the _vertex is not found in the
     /// graph.
-    public: VertexRef_M<V> AdjacentsFrom(const VertexId &_vertex) const
+    public: VertexRef_M<V, NameStorageT> AdjacentsFrom(const VertexId &_vertex) const
     {
-      VertexRef_M<V> res;
+      VertexRef_M<V, NameStorageT> res;
 
       // Make sure the vertex exists
       auto vertexIt = this->adjList.find(_vertex);
@@ -328,7 +408,7 @@ namespace graph
     /// references to the vertices. This is the set of adjacent vertices.
     /// An empty map will be returned when the _vertex is not found in the
     /// graph.
-    public: VertexRef_M<V> AdjacentsFrom(const Vertex<V> &_vertex) const
+    public: VertexRef_M<V, NameStorageT> AdjacentsFrom(const Vertex<V, NameStorageT> &_vertex) const
     {
       return this->AdjacentsFrom(_vertex.Id());
     }
@@ -348,11 +428,11 @@ namespace graph
     /// references to the vertices. An empty map is returned if the
     /// _vertex is not present in this graph, or when there are no
     /// adjacent vertices.
-    public: VertexRef_M<V> AdjacentsTo(const VertexId &_vertex) const
+    public: VertexRef_M<V, NameStorageT> AdjacentsTo(const VertexId &_vertex) const
     {
       auto incidentEdges = this->IncidentsTo(_vertex);
 
-      VertexRef_M<V> res;
+      VertexRef_M<V, NameStorageT> res;
       for (auto const &incidentEdgeRef : incidentEdges)
       {
         const auto &incidentEdgeId = incidentEdgeRef.first;
@@ -381,7 +461,7 @@ namespace graph
     /// references to the vertices. An empty map is returned if the
     /// _vertex is not present in this graph, or when there are no
     /// adjacent vertices.
-    public: VertexRef_M<V> AdjacentsTo(const Vertex<V> &_vertex) const
+    public: VertexRef_M<V, NameStorageT> AdjacentsTo(const Vertex<V, NameStorageT> &_vertex) const
     {
       return this->AdjacentsTo(_vertex.Id());
     }
@@ -397,7 +477,7 @@ namespace graph
     /// \brief Get the number of edges incident to a vertex.
     /// \param[in] _vertex The vertex.
     /// \return The number of edges incidents to a vertex.
-    public: size_t InDegree(const Vertex<V> &_vertex) const
+    public: size_t InDegree(const Vertex<V, NameStorageT> &_vertex) const
     {
       return this->IncidentsTo(this->VertexFromId(_vertex.Id())).size();
     }
@@ -413,7 +493,7 @@ namespace graph
     /// \brief Get the number of edges incident from a vertex.
     /// \param[in] _vertex The vertex.
     /// \return The number of edges incidents from a vertex.
-    public: size_t OutDegree(const Vertex<V> &_vertex) const
+    public: size_t OutDegree(const Vertex<V, NameStorageT> &_vertex) const
     {
       return this->IncidentsFrom(this->VertexFromId(_vertex.Id())).size();
     }
@@ -449,7 +529,7 @@ namespace graph
     /// references to the edges. An empty map is returned when the provided
     /// vertex does not exist, or when there are no outgoing edges.
     public: const EdgeRef_M<EdgeType> IncidentsFrom(
-                const Vertex<V> &_vertex) const
+                const Vertex<V, NameStorageT> &_vertex) const
     {
       return this->IncidentsFrom(_vertex.Id());
     }
@@ -484,12 +564,381 @@ namespace graph
     /// \return A map of edges, where keys are Ids and values are
     /// references to the edges. An empty map is returned when the provided
     /// vertex does not exist, or when there are no incoming edges.
-    public: const EdgeRef_M<EdgeType> IncidentsTo(const Vertex<V> &_vertex)
+    public: const EdgeRef_M<EdgeType> IncidentsTo(const Vertex<V, NameStorageT> &_vertex)
       const
     {
       return this->IncidentsTo(_vertex.Id());
     }
 
+    /// \brief Allocation-free iterator over the vertices of the graph.
+    /// Dereferences to a reference into the graph's own storage, so no
+    /// map of reference wrappers is materialized, unlike Vertices().
+    public: class ConstVertexIterator
+    {
+      /// \brief Constructor.
+      /// \param[in] _it Position in the graph's vertex map.
+      public: explicit ConstVertexIterator(
+          typename std::map<VertexId, Vertex<V, NameStorageT>>::const_iterator _it)
+        : it(_it)
+      {
+      }
+
+      /// \brief Get the vertex at the current position.
+      /// \return Reference to the vertex.
+      public: const Vertex<V, NameStorageT> &operator*() const
+      {
+        return this->it->second;
+      }
+
+      /// \brief Advance to the next vertex.
+      /// \return This iterator.
+      public: ConstVertexIterator &operator++()
+      {
+        ++this->it;
+        return *this;
+      }
+
+      /// \brief Equality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when both iterators are at the same position.
+      public: bool operator==(const ConstVertexIterator &_other) const
+      {
+        return this->it == _other.it;
+      }
+
+      /// \brief Inequality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when the iterators are at different positions.
+      public: bool operator!=(const ConstVertexIterator &_other) const
+      {
+        return this->it != _other.it;
+      }
+
+      /// \brief Position in the graph's vertex map.
+      private: typename std::map<VertexId, Vertex<V, NameStorageT>>::const_iterator it;
+    };
+
+    /// \brief A begin/end pair of ConstVertexIterator, usable in
+    /// range-based for loops.
+    public: class ConstVertexRange
+    {
+      /// \brief Constructor.
+      /// \param[in] _begin Iterator to the first vertex.
+      /// \param[in] _end Iterator past the last vertex.
+      public: ConstVertexRange(const ConstVertexIterator &_begin,
+                  const ConstVertexIterator &_end)
+        : beginIt(_begin), endIt(_end)
+      {
+      }
+
+      /// \brief Get the beginning of the range.
+      /// \return Iterator to the first vertex.
+      public: ConstVertexIterator begin() const
+      {
+        return this->beginIt;
+      }
+
+      /// \brief Get the end of the range.
+      /// \return Iterator past the last vertex.
+      public: ConstVertexIterator end() const
+      {
+        return this->endIt;
+      }
+
+      /// \brief Iterator to the first vertex.
+      private: ConstVertexIterator beginIt;
+
+      /// \brief Iterator past the last vertex.
+      private: ConstVertexIterator endIt;
+    };
+
+    /// \brief Iterate over all vertices in place, without building the
+    /// map of reference wrappers that Vertices() returns. The range is
+    /// invalidated by adding or removing vertices.
+    /// \return An allocation-free range over the vertices.
+    public: ConstVertexRange VertexRange() const
+    {
+      return ConstVertexRange(
+          ConstVertexIterator(this->vertices.begin()),
+          ConstVertexIterator(this->vertices.end()));
+    }
+
+    /// \brief Allocation-free iterator over the edges of the graph.
+    /// Dereferences to a reference into the graph's own storage, so no
+    /// map of reference wrappers is materialized, unlike Edges().
+    public: class ConstEdgeIterator
+    {
+      /// \brief Constructor.
+      /// \param[in] _it Position in the graph's edge map.
+      public: explicit ConstEdgeIterator(
+          typename std::map<EdgeId, EdgeType>::const_iterator _it)
+        : it(_it)
+      {
+      }
+
+      /// \brief Get the edge at the current position.
+      /// \return Reference to the edge.
+      public: const EdgeType &operator*() const
+      {
+        return this->it->second;
+      }
+
+      /// \brief Advance to the next edge.
+      /// \return This iterator.
+      public: ConstEdgeIterator &operator++()
+      {
+        ++this->it;
+        return *this;
+      }
+
+      /// \brief Equality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when both iterators are at the same position.
+      public: bool operator==(const ConstEdgeIterator &_other) const
+      {
+        return this->it == _other.it;
+      }
+
+      /// \brief Inequality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when the iterators are at different positions.
+      public: bool operator!=(const ConstEdgeIterator &_other) const
+      {
+        return this->it != _other.it;
+      }
+
+      /// \brief Position in the graph's edge map.
+      private: typename std::map<EdgeId, EdgeType>::const_iterator it;
+    };
+
+    /// \brief A begin/end pair of ConstEdgeIterator, usable in
+    /// range-based for loops.
+    public: class ConstEdgeRange
+    {
+      /// \brief Constructor.
+      /// \param[in] _begin Iterator to the first edge.
+      /// \param[in] _end Iterator past the last edge.
+      public: ConstEdgeRange(const ConstEdgeIterator &_begin,
+                  const ConstEdgeIterator &_end)
+        : beginIt(_begin), endIt(_end)
+      {
+      }
+
+      /// \brief Get the beginning of the range.
+      /// \return Iterator to the first edge.
+      public: ConstEdgeIterator begin() const
+      {
+        return this->beginIt;
+      }
+
+      /// \brief Get the end of the range.
+      /// \return Iterator past the last edge.
+      public: ConstEdgeIterator end() const
+      {
+        return this->endIt;
+      }
+
+      /// \brief Iterator to the first edge.
+      private: ConstEdgeIterator beginIt;
+
+      /// \brief Iterator past the last edge.
+      private: ConstEdgeIterator endIt;
+    };
+
+    /// \brief Iterate over all edges in place, without building the
+    /// map of reference wrappers that Edges() returns. The range is
+    /// invalidated by adding or removing edges.
+    /// \return An allocation-free range over the edges.
+    public: ConstEdgeRange EdgeRange() const
+    {
+      return ConstEdgeRange(
+          ConstEdgeIterator(this->edges.begin()),
+          ConstEdgeIterator(this->edges.end()));
+    }
+
+    /// \brief Allocation-free iterator over the edges incident at a
+    /// vertex, filtered by direction. Dereferences to a reference into
+    /// the graph's own storage.
+    public: class ConstIncidentEdgeIterator
+    {
+      /// \brief Constructor. Positions the iterator on the first edge
+      /// that satisfies the direction filter.
+      /// \param[in] _graph The graph the edges belong to.
+      /// \param[in] _vertex The vertex whose incident edges are visited.
+      /// \param[in] _it Position in the vertex's edge Id set.
+      /// \param[in] _end End of the vertex's edge Id set.
+      /// \param[in] _incoming True to visit edges into the vertex,
+      /// false to visit edges out of it.
+      public: ConstIncidentEdgeIterator(
+          const Graph<V, E, EdgeType, NameStorageT> &_graph, const VertexId _vertex,
+          const EdgeId_S::const_iterator &_it,
+          const EdgeId_S::const_iterator &_end, const bool _incoming)
+        : graph(&_graph), vertex(_vertex), it(_it), end(_end),
+          incoming(_incoming)
+      {
+        this->SkipFiltered();
+      }
+
+      /// \brief Get the edge at the current position.
+      /// \return Reference to the edge.
+      public: const EdgeType &operator*() const
+      {
+        return this->graph->EdgeFromId(*this->it);
+      }
+
+      /// \brief Advance to the next edge passing the filter.
+      /// \return This iterator.
+      public: ConstIncidentEdgeIterator &operator++()
+      {
+        ++this->it;
+        this->SkipFiltered();
+        return *this;
+      }
+
+      /// \brief Equality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when both iterators are at the same position.
+      public: bool operator==(const ConstIncidentEdgeIterator &_other) const
+      {
+        return this->it == _other.it;
+      }
+
+      /// \brief Inequality operator.
+      /// \param[in] _other Iterator to compare against.
+      /// \return True when the iterators are at different positions.
+      public: bool operator!=(const ConstIncidentEdgeIterator &_other) const
+      {
+        return this->it != _other.it;
+      }
+
+      /// \brief Get the vertex on the far side of the current edge.
+      /// \return Reference to the neighbor vertex.
+      public: const Vertex<V, NameStorageT> &Neighbor() const
+      {
+        const auto &edge = this->graph->EdgeFromId(*this->it);
+        return this->graph->VertexFromId(this->incoming ?
+            edge.To(this->vertex) : edge.From(this->vertex));
+      }
+
+      /// \brief Advance past edges that do not satisfy the direction
+      /// filter. Undirected edges satisfy both directions.
+      private: void SkipFiltered()
+      {
+        while (this->it != this->end)
+        {
+          const auto &edge = this->graph->EdgeFromId(*this->it);
+          if ((this->incoming ? edge.To(this->vertex) :
+               edge.From(this->vertex)) != kNullId)
+          {
+            break;
+          }
+          ++this->it;
+        }
+      }
+
+      /// \brief The graph the edges belong to.
+      private: const Graph<V, E, EdgeType, NameStorageT> *graph;
+
+      /// \brief The vertex whose incident edges are visited.
+      private: VertexId vertex;
+
+      /// \brief Position in the vertex's edge Id set.
+      private: EdgeId_S::const_iterator it;
+
+      /// \brief End of the vertex's edge Id set.
+      private: EdgeId_S::const_iterator end;
+
+      /// \brief True to visit edges into the vertex, false to visit
+      /// edges out of it.
+      private: bool incoming;
+    };
+
+    /// \brief A begin/end pair of ConstIncidentEdgeIterator, usable in
+    /// range-based for loops.
+    public: class ConstIncidentEdgeRange
+    {
+      /// \brief Constructor.
+      /// \param[in] _graph The graph the edges belong to.
+      /// \param[in] _vertex The vertex whose incident edges are visited.
+      /// \param[in] _edgeIds The vertex's edge Id set.
+      /// \param[in] _incoming True to visit edges into the vertex,
+      /// false to visit edges out of it.
+      public: ConstIncidentEdgeRange(const Graph<V, E, EdgeType, NameStorageT> &_graph,
+                  const VertexId _vertex, const EdgeId_S &_edgeIds,
+                  const bool _incoming)
+        : graph(&_graph), vertex(_vertex), edgeIds(&_edgeIds),
+          incoming(_incoming)
+      {
+      }
+
+      /// \brief Get the beginning of the range.
+      /// \return Iterator to the first edge passing the filter.
+      public: ConstIncidentEdgeIterator begin() const
+      {
+        return ConstIncidentEdgeIterator(*this->graph, this->vertex,
+            this->edgeIds->begin(), this->edgeIds->end(), this->incoming);
+      }
+
+      /// \brief Get the end of the range.
+      /// \return Iterator past the last edge.
+      public: ConstIncidentEdgeIterator end() const
+      {
+        return ConstIncidentEdgeIterator(*this->graph, this->vertex,
+            this->edgeIds->end(), this->edgeIds->end(), this->incoming);
+      }
+
+      /// \brief The graph the edges belong to.
+      private: const Graph<V, E, EdgeType, NameStorageT> *graph;
+
+      /// \brief The vertex whose incident edges are visited.
+      private: VertexId vertex;
+
+      /// \brief The vertex's edge Id set.
+      private: const EdgeId_S *edgeIds;
+
+      /// \brief True to visit edges into the vertex, false to visit
+      /// edges out of it.
+      private: bool incoming;
+    };
+
+    /// \brief Iterate in place over the outgoing edges of a vertex,
+    /// without building the map of reference wrappers that
+    /// IncidentsFrom() returns. Neighbor() on the iterator gives the
+    /// head vertex of each edge, so this range also replaces
+    /// AdjacentsFrom() in hot loops. The range is invalidated by adding
+    /// or removing edges.
+    /// \param[in] _vertex Id of the vertex.
+    /// \return An allocation-free range over the outgoing edges. An
+    /// empty range is returned when the vertex does not exist.
+    public: ConstIncidentEdgeRange IncidentsFromRange(
+                const VertexId &_vertex) const
+    {
+      static const EdgeId_S kNoEdges;
+
+      auto adjIt = this->adjList.find(_vertex);
+      return ConstIncidentEdgeRange(*this, _vertex,
+          adjIt == this->adjList.end() ? kNoEdges : adjIt->second, false);
+    }
+
+    /// \brief Iterate in place over the incoming edges of a vertex,
+    /// without building the map of reference wrappers that
+    /// IncidentsTo() returns. Neighbor() on the iterator gives the tail
+    /// vertex of each edge, so this range also replaces AdjacentsTo()
+    /// in hot loops. The range is invalidated by adding or removing
+    /// edges.
+    /// \param[in] _vertex Id of the vertex.
+    /// \return An allocation-free range over the incoming edges. An
+    /// empty range is returned when the vertex does not exist.
+    public: ConstIncidentEdgeRange IncidentsToRange(
+                const VertexId &_vertex) const
+    {
+      static const EdgeId_S kNoEdges;
+
+      auto adjIt = this->adjList.find(_vertex);
+      return ConstIncidentEdgeRange(*this, _vertex,
+          adjIt == this->adjList.end() ? kNoEdges : adjIt->second, true);
+    }
+
     /// \brief Get whether the graph is empty.
     /// \return True when there are no vertices in the graph or
     /// false otherwise.
@@ -522,8 +971,13 @@ namespace graph
       // Remove the vertex (key) from the adjacency list.
       this->adjList.erase(_vertex);
 
-      // Remove the vertex.
+      // Remove the vertex, leaving a tombstone in the dense index.
       this->vertices.erase(_vertex);
+      if (this->denseIndex.active &&
+          _vertex < this->denseIndex.slots.size())
+      {
+        this->denseIndex.slots[_vertex] = nullptr;
+      }
 
       // Get an iterator to all vertices sharing name.
       auto iterPair = this->names.equal_range(name);
@@ -536,13 +990,15 @@ namespace graph
         }
       }
 
+      this->Journal(GraphChange::REMOVE_VERTEX, _vertex);
+
       return true;
     }
 
     /// \brief Remove an existing vertex from the graph.
     /// \param[in] _vertex The vertex to be removed.
     /// \return True when the vertex was removed or false otherwise.
-    public: bool RemoveVertex(Vertex<V> &_vertex)
+    public: bool RemoveVertex(Vertex<V, NameStorageT> &_vertex)
     {
       return this->RemoveVertex(_vertex.Id());
     }
@@ -590,6 +1046,8 @@ namespace graph
 
       this->edges.erase(_edge);
 
+      this->Journal(GraphChange::REMOVE_EDGE, _edge);
+
       return true;
     }
 
@@ -603,15 +1061,160 @@ namespace graph
       return this->RemoveEdge(_edge.Id());
     }
 
+    /// \brief Rebuild the internal storage contiguously, renumbering
+    /// vertices and edges from zero in ascending Id order.
+    ///
+    /// Removals leave the maps fragmented: after hours of editing the
+    /// node allocations are scattered and Ids grow sparse, which
+    /// degrades traversal locality and deactivates the dense vertex
+    /// index. Compacting reallocates every node back to back,
+    /// reactivates the dense index, and makes the lowest Ids
+    /// available again for new vertices and edges.
+    ///
+    /// Every Id held outside the graph becomes stale; use the
+    /// returned table to translate saved vertex Ids, or handles (see
+    /// VertexHandleFor) to detect staleness. When journaling is
+    /// enabled the journal cannot express a renumbering, so it is
+    /// cleared and ChangesSince() reports a full resync to every
+    /// consumer synchronized before the compaction.
+    /// \return A map from old vertex Id to new vertex Id.
+    public: std::map<VertexId, VertexId> Compact()
+    {
+      std::map<VertexId, VertexId> translation;
+
+      VertexId newVId = 0;
+      for (auto const &v : this->vertices)
+        translation[v.first] = newVId++;
+
+      // Rebuild the vertex map; allocating the nodes in one burst
+      // places them contiguously.
+      std::map<VertexId, Vertex<V, NameStorageT>> newVertices;
+      std::multimap<std::string, VertexId> newNames;
+      for (auto &v : this->vertices)
+      {
+        const VertexId id = translation[v.first];
+        auto ret = newVertices.emplace(std::piecewise_construct,
+            std::forward_as_tuple(id),
+            std::forward_as_tuple(v.second.Name(),
+                std::move(v.second.Data()), id));
+        newNames.insert(std::make_pair(ret.first->second.Name(), id));
+      }
+
+      // Rebuild the edges and the adjacency list with remapped
+      // endpoint Ids.
+      std::map<EdgeId, EdgeType> newEdges;
+      std::map<VertexId, EdgeId_S> newAdjList;
+      for (auto const &v : newVertices)
+        newAdjList[v.first] = EdgeId_S();
+
+      EdgeId newEId = 0;
+      for (auto &e : this->edges)
+      {
+        const EdgeId id = newEId++;
+        const auto oldVertices = e.second.Vertices();
+        const VertexId_P endpoints = {translation[oldVertices.first],
+                                      translation[oldVertices.second]};
+        newAdjList[endpoints.first].insert(id);
+        newAdjList[endpoints.second].insert(id);
+        newEdges.emplace(std::piecewise_construct,
+            std::forward_as_tuple(id),
+            std::forward_as_tuple(endpoints, std::move(e.second.Data()),
+                e.second.Weight(), id));
+      }
+
+      this->vertices = std::move(newVertices);
+      this->edges = std::move(newEdges);
+      this->adjList = std::move(newAdjList);
+      this->names = std::move(newNames);
+      this->nextVertexId = newVId;
+      this->nextEdgeId = newEId;
+
+      // The Ids are dense again by construction; rebuild the direct
+      // index from scratch.
+      this->denseIndex.slots.clear();
+      this->denseIndex.slots.shrink_to_fit();
+      this->denseIndex.active = true;
+      for (auto &v : this->vertices)
+        this->IndexVertex(v.first, &v.second);
+
+      // Invalidate outstanding handles and journal consumers.
+      ++this->generation;
+      if (this->journalEnabled)
+      {
+        ++this->version;
+        this->journal.clear();
+        this->trimmedThrough = this->version;
+      }
+
+      return translation;
+    }
+
+    /// \brief A reference to a vertex that stays checkable across
+    /// Compact(): the vertex Id together with the storage generation
+    /// that issued it.
+    public: struct VertexHandle
+    {
+      /// \brief Id of the vertex, or kNullId for an empty handle.
+      VertexId id = kNullId;
+
+      /// \brief Storage generation the handle was taken in.
+      uint64_t generation = 0;
+    };
+
+    /// \brief Get the storage generation. It starts at zero and
+    /// increases by one with every Compact(), which renumbers the
+    /// Ids; handles taken in an older generation are stale.
+    /// \return The current storage generation.
+    public: uint64_t Generation() const
+    {
+      return this->generation;
+    }
+
+    /// \brief Take a handle to a vertex. Unlike a bare Id, the
+    /// handle detects that a Compact() has renumbered the graph.
+    /// \param[in] _id Id of the vertex.
+    /// \return A handle to the vertex, or an empty handle when no
+    /// vertex has this Id.
+    public: VertexHandle VertexHandleFor(const VertexId &_id) const
+    {
+      if (this->vertices.find(_id) == this->vertices.end())
+        return VertexHandle();
+      return {_id, this->generation};
+    }
+
+    /// \brief Resolve a handle to its vertex, rejecting handles from
+    /// an older storage generation whose Id may now name a different
+    /// vertex.
+    /// \param[in] _handle Handle taken with VertexHandleFor().
+    /// \return A reference to the vertex, or NullVertex when the
+    /// handle is stale or the vertex was removed.
+    public: const Vertex<V, NameStorageT> &VertexFromHandle(
+                const VertexHandle &_handle) const
+    {
+      if (_handle.generation != this->generation)
+        return Vertex<V, NameStorageT>::NullVertex;
+      return this->VertexFromId(_handle.id);
+    }
+
     /// \brief Get a reference to a vertex using its Id.
     /// \param[in] _id The Id of the vertex.
     /// \return A reference to the vertex with Id = _id or NullVertex if
     /// not found.
-    public: const Vertex<V> &VertexFromId(const VertexId &_id) const
+    public: const Vertex<V, NameStorageT> &VertexFromId(const VertexId &_id) const
     {
+      if (this->denseIndex.active)
+      {
+        if (_id < this->denseIndex.slots.size() &&
+            nullptr != this->denseIndex.slots[_id])
+        {
+          return *this->denseIndex.slots[_id];
+        }
+        return Vertex<V, NameStorageT>::NullVertex;
+      }
+
       auto iter = this->vertices.find(_id);
       if (iter == this->vertices.end())
-        return Vertex<V>::NullVertex;
+        return Vertex<V, NameStorageT>::NullVertex;
 
       return iter->second;
     }
@@ -620,11 +1223,21 @@ namespace graph
     /// \param[in] _id The Id of the vertex.
     /// \return A mutable reference to the vertex with Id = _id or NullVertex
     /// if not found.
-    public: Vertex<V> &VertexFromId(const VertexId &_id)
+    public: Vertex<V, NameStorageT> &VertexFromId(const VertexId &_id)
     {
+      if (this->denseIndex.active)
+      {
+        if (_id < this->denseIndex.slots.size() &&
+            nullptr != this->denseIndex.slots[_id])
+        {
+          return *this->denseIndex.slots[_id];
+        }
+        return Vertex<V, NameStorageT>::NullVertex;
+      }
+
       auto iter = this->vertices.find(_id);
       if (iter == this->vertices.end())
-        return Vertex<V>::NullVertex;
+        return Vertex<V, NameStorageT>::NullVertex;
 
       return iter->second;
     }
@@ -686,9 +1299,109 @@ namespace graph
     /// \param[out] _out The output stream.
     /// \param[in] _g Graph to write to the stream.
     /// \sa https://en.wikipedia.org/wiki/DOT_(graph_description_language).
-    public: template<typename VV, typename EE, typename EEdgeType>
+    public: template<typename VV, typename EE, typename EEdgeType,
+                     typename NN>
     friend std::ostream &operator<<(std::ostream &_out,
-                                    const Graph<VV, EE, EEdgeType> &_g);
+                                    const Graph<VV, EE, EEdgeType, NN> &_g);
+
+    /// \brief Enable or disable the change journal. While enabled,
+    /// every structural change appends a versioned record, so a
+    /// replica holding version N can catch up with ChangesSince(N)
+    /// instead of diffing the whole graph. Disabling clears the
+    /// journal and resets the version.
+    /// \param[in] _enable True to start journaling.
+    public: void EnableJournal(const bool _enable)
+    {
+      this->journalEnabled = _enable;
+      if (!_enable)
+      {
+        this->journal.clear();
+        this->version = 0;
+        this->trimmedThrough = 0;
+      }
+    }
+
+    /// \brief Get the current version of the graph. The version
+    /// increases by one with every journaled change and is zero when
+    /// the journal is disabled.
+    /// \return The current version.
+    public: uint64_t Version() const
+    {
+      return this->version;
+    }
+
+    /// \brief Record that a vertex was modified in place, e.g. through
+    /// the reference returned by VertexFromId. The graph cannot see
+    /// such changes itself, so replication relies on callers reporting
+    /// them.
+    /// \param[in] _vertex Id of the modified vertex.
+    public: void TouchVertex(const VertexId &_vertex)
+    {
+      if (this->vertices.find(_vertex) != this->vertices.end())
+        this->Journal(GraphChange::MODIFY_VERTEX, _vertex);
+    }
+
+    /// \brief Record that an edge was modified in place, e.g. through
+    /// the reference returned by EdgeFromId.
+    /// \param[in] _edge Id of the modified edge.
+    public: void TouchEdge(const EdgeId &_edge)
+    {
+      if (this->edges.find(_edge) != this->edges.end())
+        this->Journal(GraphChange::MODIFY_EDGE, _edge);
+    }
+
+    /// \brief Get all changes after a given version, oldest first.
+    /// \param[in] _version The version the caller is synchronized to;
+    /// pass zero for all retained changes.
+    /// \param[out] _changes Destination for the change records; always
+    /// cleared first. Empty when the caller is up to date.
+    /// \return True when the journal covers everything after _version.
+    /// False when the journal is disabled or records after _version
+    /// have been trimmed; the caller must fall back to a full sync.
+    public: bool ChangesSince(const uint64_t _version,
+                std::vector<GraphChange> &_changes) const
+    {
+      _changes.clear();
+      if (!this->journalEnabled || _version < this->trimmedThrough)
+        return false;
+
+      for (auto const &change : this->journal)
+      {
+        if (change.version > _version)
+          _changes.push_back(change);
+      }
+      return true;
+    }
+
+    /// \brief Drop journal records up to and including a version,
+    /// once every replica has acknowledged it. ChangesSince with an
+    /// older version will report a full sync afterwards.
+    /// \param[in] _version The oldest version that every consumer has
+    /// applied.
+    public: void TrimJournal(const uint64_t _version)
+    {
+      this->journal.erase(
+          std::remove_if(this->journal.begin(), this->journal.end(),
+              [_version](const GraphChange &_change)
+              {
+                return _change.version <= _version;
+              }),
+          this->journal.end());
+      this->trimmedThrough = std::max(this->trimmedThrough, _version);
+    }
+
+    /// \brief Append a change record when the journal is enabled.
+    /// \param[in] _operation The kind of change.
+    /// \param[in] _id Id of the vertex or edge that changed.
+    private: void Journal(const GraphChange::Operation _operation,
+                 const uint64_t _id)
+    {
+      if (!this->journalEnabled)
+        return;
+
+      ++this->version;
+      this->journal.push_back({this->version, _operation, _id});
+    }
 
     /// \brief Get an available Id to be assigned to a new vertex.
     /// \return The next available Id or kNullId if there aren't ids available.
@@ -722,8 +1435,97 @@ namespace graph
     /// \brief The next edge Id to be assigned to a new edge.
     protected: VertexId nextEdgeId = 0u;
 
+    /// \brief Record a newly added vertex in the dense index. The
+    /// index stays active while Ids remain dense, which they are when
+    /// the class issues them; a caller-supplied Id far beyond the
+    /// vertex count deactivates it, falling back to the map.
+    /// \param[in] _id Id of the vertex.
+    /// \param[in] _vertex Address of the vertex inside the map; map
+    /// nodes are stable, so the pointer survives other insertions.
+    private: void IndexVertex(const VertexId &_id,
+                 Vertex<V, NameStorageT> *_vertex)
+    {
+      if (!this->denseIndex.active)
+        return;
+
+      auto &slots = this->denseIndex.slots;
+      if (_id == slots.size())
+      {
+        // The common case: a library-issued sequential Id.
+        slots.push_back(_vertex);
+      }
+      else if (_id < slots.size() && nullptr == slots[_id])
+      {
+        // A tombstone being reused.
+        slots[_id] = _vertex;
+      }
+      else if (_id < 2 * this->vertices.size() + kDenseIndexSlack)
+      {
+        // A caller-supplied Id with a small gap; keep the index with
+        // tombstones in between.
+        slots.resize(_id + 1, nullptr);
+        slots[_id] = _vertex;
+      }
+      else
+      {
+        // Sparse caller-supplied Ids; an array would mostly hold
+        // tombstones, so stay on the map from here on.
+        this->denseIndex.active = false;
+        slots.clear();
+        slots.shrink_to_fit();
+      }
+    }
+
+    /// \brief Number of leading tombstones tolerated before the dense
+    /// index considers caller-supplied Ids sparse.
+    private: static const VertexId kDenseIndexSlack = 64;
+
+    /// \internal
+    /// \brief Direct Id-to-vertex index: a vector indexed by VertexId
+    /// whose slots point into the vertex map, with nullptr tombstones
+    /// for removed Ids. Copies deactivate the index rather than carry
+    /// pointers into the source graph, so copied graphs look vertices
+    /// up through the map.
+    private: struct DenseVertexIndex
+    {
+      /// \brief Constructor.
+      DenseVertexIndex() = default;
+
+      /// \brief Copy constructor; starts deactivated.
+      DenseVertexIndex(const DenseVertexIndex &)
+        : active(false)
+      {
+      }
+
+      /// \brief Copy assignment; deactivates the index.
+      /// \return This index.
+      DenseVertexIndex &operator=(const DenseVertexIndex &)
+      {
+        this->active = false;
+        this->slots.clear();
+        return *this;
+      }
+
+      /// \brief Move constructor. Map nodes do not move with their
+      /// container, so the pointers stay valid.
+      DenseVertexIndex(DenseVertexIndex &&) = default;
+
+      /// \brief Move assignment.
+      /// \return This index.
+      DenseVertexIndex &operator=(DenseVertexIndex &&) = default;
+
+      /// \brief The slots; one per Id up to the largest indexed Id.
+      std::vector<Vertex<V, NameStorageT> *> slots;
+
+      /// \brief True while the index mirrors the vertex map.
+      bool active = true;
+    };
+
+    /// \brief The dense direct index over the vertices.
+    private: DenseVertexIndex denseIndex;
+
     /// \brief The set of vertices.
-    private: std::map<VertexId, Vertex<V>> vertices;
+    private: std::map<VertexId, Vertex<V, NameStorageT>> vertices;
 
     /// \brief The set of edges.
     private: std::map<EdgeId, EdgeType> edges;
@@ -737,13 +1539,28 @@ namespace graph
 
     /// \brief Association between names and vertices curently used.
     private: std::multimap<std::string, VertexId> names;
+
+    /// \brief The storage generation; incremented by Compact().
+    private: uint64_t generation = 0;
+
+    /// \brief Whether structural changes are journaled.
+    private: bool journalEnabled = false;
+
+    /// \brief Version of the latest journaled change.
+    private: uint64_t version = 0;
+
+    /// \brief Retained change records, oldest first.
+    private: std::vector<GraphChange> journal;
+
+    /// \brief Highest version removed by TrimJournal.
+    private: uint64_t trimmedThrough = 0;
   };
 
   /////////////////////////////////////////////////
   /// Partial template specification for undirected edges.
-  template<typename VV, typename EE>
+  template<typename VV, typename EE, typename NN>
   std::ostream &operator<<(std::ostream &_out,
-                           const Graph<VV, EE, UndirectedEdge<EE>> &_g)
+                           const Graph<VV, EE, UndirectedEdge<EE>, NN> &_g)
   {
     _out << "graph {" << std::endl;
 
@@ -768,9 +1585,9 @@ namespace graph
 
   /////////////////////////////////////////////////
   /// Partial template specification for directed edges.
-  template<typename VV, typename EE>
+  template<typename VV, typename EE, typename NN>
   std::ostream &operator<<(std::ostream &_out,
-                           const Graph<VV, EE, DirectedEdge<EE>> &_g)
+                           const Graph<VV, EE, DirectedEdge<EE>, NN> &_g)
   {
     _out << "digraph {" << std::endl;
 
@@ -795,13 +1612,13 @@ namespace graph
 
   /// \def UndirectedGraph
   /// \brief An undirected graph.
-  template<typename V, typename E>
-  using UndirectedGraph = Graph<V, E, UndirectedEdge<E>>;
+  template<typename V, typename E, typename NameStorageT = std::string>
+  using UndirectedGraph = Graph<V, E, UndirectedEdge<E>, NameStorageT>;
 
   /// \def DirectedGraph
   /// \brief A directed graph.
-  template<typename V, typename E>
-  using DirectedGraph = Graph<V, E, DirectedEdge<E>>;
+  template<typename V, typename E, typename NameStorageT = std::string>
+  using DirectedGraph = Graph<V, E, DirectedEdge<E>, NameStorageT>;
 }
 }
 }
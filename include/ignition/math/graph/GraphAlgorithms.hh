@@ -17,15 +17,20 @@
 #ifndef IGNITION_MATH_GRAPH_GRAPHALGORITHMS_HH_
 #define IGNITION_MATH_GRAPH_GRAPHALGORITHMS_HH_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <list>
 #include <map>
 #include <queue>
-#include <stack>
+#include <set>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <ignition/math/config.hh>
+#include "ignition/math/graph/CompressedGraph.hh"
 #include "ignition/math/graph/Graph.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -42,6 +47,188 @@ namespace graph
   /// the cost (first element) to reach a destination vertex (second element).
   using CostInfo = std::pair<double, VertexId>;
 
+  /// \brief A visited-vertex set backed by a dense bitset.
+  ///
+  /// Traversals over large graphs spend most of their time asking
+  /// "was this vertex seen already?"; answering that from a std::map
+  /// or std::set costs a red-black tree probe per edge. A
+  /// VisitedBitmap answers it from one bit per vertex id, directly
+  /// indexed, when the graph's ids are dense (the common case, and
+  /// the one the graph's own dense vertex index targets). Ids far
+  /// beyond the vertex count spill into a small overflow set, so
+  /// sparse graphs stay correct, just slower.
+  ///
+  /// The traversal overloads taking a VisitedBitmap expose the bitmap
+  /// to the caller, so a reachability query can test membership
+  /// afterwards without searching the returned order.
+  class VisitedBitmap
+  {
+    /// \brief Clear the set and size the bitset for a graph: one bit
+    /// per id when the largest vertex id is within a small multiple
+    /// of the vertex count, otherwise every id goes to the overflow
+    /// set.
+    /// \param[in] _graph The graph about to be traversed.
+    public: template<typename V, typename E, typename EdgeType>
+            void Reset(const Graph<V, E, EdgeType> &_graph)
+    {
+      const auto vertices = _graph.Vertices();
+      VertexId maxId = 0;
+      for (auto const &v : vertices)
+        maxId = std::max(maxId, v.first);
+
+      this->words.clear();
+      this->overflow.clear();
+      this->visitedCount = 0;
+      if (!vertices.empty() && maxId < 2 * vertices.size() + kBitmapSlack)
+        this->words.resize((maxId + 64) / 64, 0);
+    }
+
+    /// \brief Check whether a vertex has been visited.
+    /// \param[in] _id The vertex id.
+    /// \return True when the vertex is in the set.
+    public: bool Contains(const VertexId &_id) const
+    {
+      if (_id < this->words.size() * 64)
+        return (this->words[_id / 64] >> (_id % 64)) & 1u;
+      return this->overflow.find(_id) != this->overflow.end();
+    }
+
+    /// \brief Add a vertex to the set.
+    /// \param[in] _id The vertex id.
+    /// \return True when the vertex was not in the set before.
+    public: bool Insert(const VertexId &_id)
+    {
+      if (_id < this->words.size() * 64)
+      {
+        const std::uint64_t mask = std::uint64_t(1) << (_id % 64);
+        if (this->words[_id / 64] & mask)
+          return false;
+        this->words[_id / 64] |= mask;
+        ++this->visitedCount;
+        return true;
+      }
+      if (!this->overflow.insert(_id).second)
+        return false;
+      ++this->visitedCount;
+      return true;
+    }
+
+    /// \brief Get the number of visited vertices.
+    /// \return The size of the set.
+    public: std::size_t Count() const
+    {
+      return this->visitedCount;
+    }
+
+    /// \brief Largest tolerated gap between the vertex count and the
+    /// largest id before ids spill to the overflow set.
+    private: static const VertexId kBitmapSlack = 64;
+
+    /// \brief The bitset, one bit per vertex id.
+    private: std::vector<std::uint64_t> words;
+
+    /// \brief Visited ids beyond the bitset range.
+    private: std::set<VertexId> overflow;
+
+    /// \brief Number of visited vertices.
+    private: std::size_t visitedCount = 0;
+  };
+
+  /// \brief Reusable scratch state for BreadthFirstSort and
+  /// DepthFirstSort.
+  ///
+  /// The plain overloads build an auxiliary visitor graph and allocate
+  /// frontier containers on every call, which dominates the cost of
+  /// running thousands of small traversals per tick. A TraversalScratch
+  /// binds to a graph once, caching the adjacency in a compact
+  /// index-based form together with a preallocated visited stamp array
+  /// and frontier storage; traversals through it then allocate nothing
+  /// at steady state. Rebind (or let the overloads rebind) after the
+  /// graph's vertices or edges change.
+  class TraversalScratch
+  {
+    /// \brief Cache the structure of a graph. Called automatically by
+    /// the traversal overloads when the bound vertex or edge count does
+    /// not match the graph.
+    /// \param[in] _graph The graph to traverse.
+    public: template<typename V, typename E, typename EdgeType>
+            void Bind(const Graph<V, E, EdgeType> &_graph)
+    {
+      const auto vertices = _graph.Vertices();
+
+      this->ids.clear();
+      this->slotOf.clear();
+      this->ids.reserve(vertices.size());
+      for (auto const &v : vertices)
+      {
+        this->slotOf[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      // Flatten the adjacency into one neighbor array plus offsets,
+      // preserving the id-sorted neighbor order of AdjacentsFrom.
+      this->offsets.clear();
+      this->neighbors.clear();
+      this->offsets.reserve(this->ids.size() + 1);
+      this->offsets.push_back(0);
+      for (auto const id : this->ids)
+      {
+        for (auto const &adj : _graph.AdjacentsFrom(id))
+          this->neighbors.push_back(this->slotOf.at(adj.first));
+        this->offsets.push_back(this->neighbors.size());
+      }
+
+      this->stamps.assign(this->ids.size(), 0);
+      this->generation = 0;
+      this->frontier.clear();
+      this->frontier.reserve(this->neighbors.size() + 1);
+      this->boundVertices = vertices.size();
+      this->boundEdges = _graph.Edges().size();
+    }
+
+    /// \brief Check whether the cached structure still matches a graph.
+    /// \param[in] _graph The graph to traverse.
+    /// \return True when Bind does not need to run.
+    public: template<typename V, typename E, typename EdgeType>
+            bool Bound(const Graph<V, E, EdgeType> &_graph) const
+    {
+      return this->boundVertices == _graph.Vertices().size() &&
+             this->boundEdges == _graph.Edges().size() &&
+             !this->ids.empty();
+    }
+
+    /// \brief Vertex ids, indexed by slot.
+    public: std::vector<VertexId> ids;
+
+    /// \brief Slot of each vertex id.
+    public: std::map<VertexId, std::size_t> slotOf;
+
+    /// \brief Start of each vertex's neighbors in the neighbors array;
+    /// one extra entry terminates the last vertex.
+    public: std::vector<std::size_t> offsets;
+
+    /// \brief Neighbor slots of every vertex, concatenated.
+    public: std::vector<std::size_t> neighbors;
+
+    /// \brief Visited marks: a slot is visited in the current
+    /// traversal when its stamp equals the generation, so no clearing
+    /// is needed between traversals.
+    public: std::vector<std::uint64_t> stamps;
+
+    /// \brief Current traversal number.
+    public: std::uint64_t generation = 0;
+
+    /// \brief Frontier storage, used as a queue by BFS and a stack by
+    /// DFS.
+    public: std::vector<std::size_t> frontier;
+
+    /// \brief Vertex count at Bind time.
+    public: std::size_t boundVertices = 0;
+
+    /// \brief Edge count at Bind time.
+    public: std::size_t boundEdges = 0;
+  };
+
   /// \brief Breadth first sort (BFS).
   /// Starting from the vertex == _from, it traverses the graph exploring the
   /// neighbors first, before moving to the next level neighbors.
@@ -52,46 +239,105 @@ namespace graph
   std::vector<VertexId> BreadthFirstSort(const Graph<V, E, EdgeType> &_graph,
                                          const VertexId &_from)
   {
-    // Create an auxiliary graph, where the data is just a boolean value that
-    // stores whether the vertex has been visited or not.
-    Graph<bool, E, EdgeType> visitorGraph;
+    VisitedBitmap visited;
+    std::vector<VertexId> order;
+    BreadthFirstSort(_graph, _from, visited, order);
+    return order;
+  }
 
-    // Copy the vertices (just the Id).
-    for (auto const &v : _graph.Vertices())
-      visitorGraph.AddVertex("", false, v.first);
+  /// \brief Breadth first sort (BFS) exposing the visited set.
+  /// Produces the same order as the plain overload; the visited
+  /// bookkeeping runs on a dense bitset and is handed back to the
+  /// caller, so a reachability query can test membership in O(1)
+  /// afterwards instead of searching the order vector.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex. An unknown starting vertex
+  /// visits nothing.
+  /// \param[out] _visitedSet Reset and filled with the visited
+  /// vertices.
+  /// \param[out] _order Cleared and filled with the vertex ids in
+  /// breadth first order.
+  template<typename V, typename E, typename EdgeType>
+  void BreadthFirstSort(const Graph<V, E, EdgeType> &_graph,
+                        const VertexId &_from,
+                        VisitedBitmap &_visitedSet,
+                        std::vector<VertexId> &_order)
+  {
+    _visitedSet.Reset(_graph);
+    _order.clear();
 
-    // Copy the edges (without data).
-    for (auto const &e : _graph.Edges())
-      visitorGraph.AddEdge(e.second.get().Vertices(), E());
+    if (!_graph.VertexFromId(_from).Valid())
+      return;
 
-    std::vector<VertexId> visited;
-    std::list<VertexId> pending = {_from};
+    // The pending vector is consumed from the head, so it doubles as
+    // the record of the traversal order.
+    std::vector<VertexId> pending = {_from};
+    std::size_t head = 0;
 
-    while (!pending.empty())
+    while (head < pending.size())
     {
-      auto vId = pending.front();
-      pending.pop_front();
+      const auto vId = pending[head++];
 
       // If the vertex has been visited, skip.
-      auto &vertex = visitorGraph.VertexFromId(vId);
-      if (vertex.Data())
+      if (!_visitedSet.Insert(vId))
         continue;
 
-      visited.push_back(vId);
-      vertex.Data() = true;
+      _order.push_back(vId);
 
       // Add more vertices to visit if they haven't been visited yet.
-      auto adjacents = visitorGraph.AdjacentsFrom(vId);
-      for (auto const &adj : adjacents)
+      for (auto const &adj : _graph.AdjacentsFrom(vId))
       {
-        vId = adj.first;
-        auto &v = adj.second.get();
-        if (!v.Data())
-          pending.push_back(vId);
+        if (!_visitedSet.Contains(adj.first))
+          pending.push_back(adj.first);
       }
     }
+  }
+
+  /// \brief Breadth first sort (BFS) through reusable scratch state.
+  /// Produces the same order as the plain overload but allocates
+  /// nothing once the scratch is bound and _visited has capacity.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in, out] _scratch Scratch state, rebound on demand.
+  /// \param[out] _visited Cleared and filled with the vertex ids in
+  /// breadth first order.
+  template<typename V, typename E, typename EdgeType>
+  void BreadthFirstSort(const Graph<V, E, EdgeType> &_graph,
+                        const VertexId &_from,
+                        TraversalScratch &_scratch,
+                        std::vector<VertexId> &_visited)
+  {
+    if (!_scratch.Bound(_graph))
+      _scratch.Bind(_graph);
+
+    _visited.clear();
+
+    // An unknown starting vertex visits nothing.
+    auto fromIter = _scratch.slotOf.find(_from);
+    if (fromIter == _scratch.slotOf.end())
+      return;
+
+    ++_scratch.generation;
+    _scratch.frontier.clear();
+    _scratch.frontier.push_back(fromIter->second);
+    std::size_t head = 0;
+
+    while (head < _scratch.frontier.size())
+    {
+      const std::size_t slot = _scratch.frontier[head++];
+      if (_scratch.stamps[slot] == _scratch.generation)
+        continue;
+      _scratch.stamps[slot] = _scratch.generation;
+      _visited.push_back(_scratch.ids[slot]);
 
-    return visited;
+      for (std::size_t i = _scratch.offsets[slot];
+           i < _scratch.offsets[slot + 1]; ++i)
+      {
+        const std::size_t adj = _scratch.neighbors[i];
+        if (_scratch.stamps[adj] != _scratch.generation)
+          _scratch.frontier.push_back(adj);
+      }
+    }
   }
 
   /// \brief Depth first sort (DFS).
@@ -104,46 +350,103 @@ namespace graph
   std::vector<VertexId> DepthFirstSort(const Graph<V, E, EdgeType> &_graph,
                                        const VertexId &_from)
   {
-    // Create an auxiliary graph, where the data is just a boolean value that
-    // stores whether the vertex has been visited or not.
-    Graph<bool, E, EdgeType> visitorGraph;
+    VisitedBitmap visited;
+    std::vector<VertexId> order;
+    DepthFirstSort(_graph, _from, visited, order);
+    return order;
+  }
 
-    // Copy the vertices (just the Id).
-    for (auto const &v : _graph.Vertices())
-      visitorGraph.AddVertex("", false, v.first);
+  /// \brief Depth first sort (DFS) exposing the visited set.
+  /// Produces the same order as the plain overload; the visited
+  /// bookkeeping runs on a dense bitset and is handed back to the
+  /// caller, so a reachability query can test membership in O(1)
+  /// afterwards instead of searching the order vector.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex. An unknown starting vertex
+  /// visits nothing.
+  /// \param[out] _visitedSet Reset and filled with the visited
+  /// vertices.
+  /// \param[out] _order Cleared and filled with the vertex ids in
+  /// depth first order.
+  template<typename V, typename E, typename EdgeType>
+  void DepthFirstSort(const Graph<V, E, EdgeType> &_graph,
+                      const VertexId &_from,
+                      VisitedBitmap &_visitedSet,
+                      std::vector<VertexId> &_order)
+  {
+    _visitedSet.Reset(_graph);
+    _order.clear();
 
-    // Copy the edges (without data).
-    for (auto const &e : _graph.Edges())
-      visitorGraph.AddEdge(e.second.get().Vertices(), E());
+    if (!_graph.VertexFromId(_from).Valid())
+      return;
 
-    std::vector<VertexId> visited;
-    std::stack<VertexId> pending({_from});
+    std::vector<VertexId> pending = {_from};
 
     while (!pending.empty())
     {
-      auto vId = pending.top();
-      pending.pop();
+      const auto vId = pending.back();
+      pending.pop_back();
 
       // If the vertex has been visited, skip.
-      auto &vertex = visitorGraph.VertexFromId(vId);
-      if (vertex.Data())
+      if (!_visitedSet.Insert(vId))
         continue;
 
-      visited.push_back(vId);
-      vertex.Data() = true;
+      _order.push_back(vId);
 
       // Add more vertices to visit if they haven't been visited yet.
-      auto adjacents = visitorGraph.AdjacentsFrom(vId);
-      for (auto const &adj : adjacents)
+      for (auto const &adj : _graph.AdjacentsFrom(vId))
       {
-        vId = adj.first;
-        auto &v = adj.second.get();
-        if (!v.Data())
-          pending.push(vId);
+        if (!_visitedSet.Contains(adj.first))
+          pending.push_back(adj.first);
       }
     }
+  }
+
+  /// \brief Depth first sort (DFS) through reusable scratch state.
+  /// Produces the same order as the plain overload but allocates
+  /// nothing once the scratch is bound and _visited has capacity.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in, out] _scratch Scratch state, rebound on demand.
+  /// \param[out] _visited Cleared and filled with the vertex ids in
+  /// depth first order.
+  template<typename V, typename E, typename EdgeType>
+  void DepthFirstSort(const Graph<V, E, EdgeType> &_graph,
+                      const VertexId &_from,
+                      TraversalScratch &_scratch,
+                      std::vector<VertexId> &_visited)
+  {
+    if (!_scratch.Bound(_graph))
+      _scratch.Bind(_graph);
 
-    return visited;
+    _visited.clear();
+
+    // An unknown starting vertex visits nothing.
+    auto fromIter = _scratch.slotOf.find(_from);
+    if (fromIter == _scratch.slotOf.end())
+      return;
+
+    ++_scratch.generation;
+    _scratch.frontier.clear();
+    _scratch.frontier.push_back(fromIter->second);
+
+    while (!_scratch.frontier.empty())
+    {
+      const std::size_t slot = _scratch.frontier.back();
+      _scratch.frontier.pop_back();
+      if (_scratch.stamps[slot] == _scratch.generation)
+        continue;
+      _scratch.stamps[slot] = _scratch.generation;
+      _visited.push_back(_scratch.ids[slot]);
+
+      for (std::size_t i = _scratch.offsets[slot];
+           i < _scratch.offsets[slot + 1]; ++i)
+      {
+        const std::size_t adj = _scratch.neighbors[i];
+        if (_scratch.stamps[adj] != _scratch.generation)
+          _scratch.frontier.push_back(adj);
+      }
+    }
   }
 
   /// \brief Dijkstra algorithm.
@@ -278,52 +581,2631 @@ namespace graph
     return dist;
   }
 
-  /// \brief Calculate the connected components of an undirected graph.
-  /// A connected component of an undirected graph is a subgraph in which any
-  /// two vertices are connected to each other by paths, and which is connected
-  /// to no additional vertices in the supergraph.
-  /// \sa https://en.wikipedia.org/wiki/Connected_component_(graph_theory)
-  /// \param[in] _graph A graph.
-  /// \return A vector of graphs. Each element of the graph is a component
-  /// (subgraph) of the original graph.
-  template<typename V, typename E>
-  std::vector<UndirectedGraph<V, E>> ConnectedComponents(
-    const UndirectedGraph<V, E> &_graph)
+  /// \brief A dense shortest paths tree.
+  ///
+  /// Dijkstra() returns a std::map<VertexId, CostInfo>, which callers
+  /// that feed the result into flat per-vertex arrays then copy out
+  /// again, paying one tree node allocation per vertex on every query.
+  /// A ShortestPathsTree runs the same search but stores its result
+  /// directly in dense distance and parent arrays indexed by a compact
+  /// vertex index, so building it performs no per-vertex map
+  /// construction, and ExtractPath() writes a path into caller-provided
+  /// storage without allocating at all.
+  template<typename V, typename E, typename EdgeType>
+  class ShortestPathsTree
   {
-    std::map<VertexId, unsigned int> visited;
-    unsigned int componentCount = 0;
+    /// \brief Constructor. Runs a shortest path search over \p _graph
+    /// from \p _from and stores the resulting tree.
+    /// \param[in] _graph The graph to search.
+    /// \param[in] _from The source vertex. When it is not in the graph
+    /// the tree is empty and Valid() returns false.
+    public: ShortestPathsTree(const Graph<V, E, EdgeType> &_graph,
+                              const VertexId &_from)
+      : source(_from)
+    {
+      auto allVertices = _graph.Vertices();
 
-    for (auto const &v : _graph.Vertices())
+      // Sanity check: The source vertex should exist.
+      if (allVertices.find(_from) == allVertices.end())
+      {
+        std::cerr << "Vertex [" << _from << "] Not found" << std::endl;
+        return;
+      }
+
+      for (auto const &v : allVertices)
+      {
+        this->index[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      const size_t n = this->ids.size();
+      this->dist.assign(n, MAX_D);
+      this->parent.assign(n, kNone);
+
+      // Lazy-deletion priority queue over dense indices.
+      std::priority_queue<std::pair<double, size_t>,
+        std::vector<std::pair<double, size_t>>,
+        std::greater<std::pair<double, size_t>>> pq;
+
+      const size_t sourceIdx = this->index[_from];
+      this->dist[sourceIdx] = 0.0;
+      this->parent[sourceIdx] = sourceIdx;
+      pq.push(std::make_pair(0.0, sourceIdx));
+
+      while (!pq.empty())
+      {
+        const auto top = pq.top();
+        pq.pop();
+
+        const size_t u = top.second;
+        if (top.first > this->dist[u])
+          continue;
+
+        for (auto const &edgePair : _graph.IncidentsFrom(this->ids[u]))
+        {
+          const auto &edge = edgePair.second.get();
+          const size_t v = this->index[edge.From(this->ids[u])];
+          const double candidate = this->dist[u] + edge.Weight();
+          if (candidate < this->dist[v])
+          {
+            this->dist[v] = candidate;
+            this->parent[v] = u;
+            pq.push(std::make_pair(candidate, v));
+          }
+        }
+      }
+    }
+
+    /// \brief Whether the source vertex was found in the graph.
+    /// \return True when the tree holds a search result.
+    public: bool Valid() const
     {
-      if (visited.find(v.first) == visited.end())
+      return !this->ids.empty();
+    }
+
+    /// \brief Get the source vertex of the tree.
+    /// \return The source vertex Id.
+    public: VertexId Source() const
+    {
+      return this->source;
+    }
+
+    /// \brief Get the cost of the path to a vertex.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The cost, or MAX_D when unreachable or unknown.
+    public: double Cost(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      return it == this->index.end() ? MAX_D : this->dist[it->second];
+    }
+
+    /// \brief Get the previous vertex on the path to a vertex. The
+    /// source vertex is its own parent.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The previous vertex Id, or kNullId when unreachable or
+    /// unknown.
+    public: VertexId Parent(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return kNullId;
+      return this->ids[this->parent[it->second]];
+    }
+
+    /// \brief Write the path from the source to a vertex into caller
+    /// storage. No allocation is performed.
+    /// \param[in] _to The destination vertex.
+    /// \param[out] _path Destination array of at most \p _capacity
+    /// vertex Ids, filled from the source to \p _to inclusive.
+    /// \param[in] _capacity Number of Ids \p _path can hold.
+    /// \return The full length of the path, or 0 when \p _to is
+    /// unreachable or unknown. A return value greater than
+    /// \p _capacity means the first \p _capacity Ids were written and
+    /// the rest were dropped; call again with a larger array.
+    public: size_t ExtractPath(const VertexId &_to, VertexId *_path,
+                               const size_t _capacity) const
+    {
+      auto it = this->index.find(_to);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return 0;
+
+      // Walk up once to measure the path.
+      size_t length = 1;
+      for (size_t v = it->second; this->parent[v] != v;
+           v = this->parent[v])
       {
-        auto component = BreadthFirstSort(_graph, v.first);
-        for (auto const &vId : component)
-          visited[vId] = componentCount;
-        ++componentCount;
+        ++length;
+      }
+
+      // Walk up again, writing each vertex that fits at its final
+      // position so no reversal pass is needed.
+      size_t slot = length;
+      for (size_t v = it->second; ; v = this->parent[v])
+      {
+        --slot;
+        if (slot < _capacity)
+          _path[slot] = this->ids[v];
+        if (this->parent[v] == v)
+          break;
       }
+
+      return length;
     }
 
-    std::vector<UndirectedGraph<V, E>> res(componentCount);
+    /// \brief Sentinel for "not present" in the dense arrays.
+    private: static constexpr size_t kNone = static_cast<size_t>(-1);
 
-    // Create the vertices.
-    for (auto const &vPair : _graph.Vertices())
+    /// \brief The source vertex of the tree.
+    private: VertexId source;
+
+    /// \brief Vertex Id of each dense index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Dense index of each vertex Id.
+    private: std::map<VertexId, size_t> index;
+
+    /// \brief Distance from the source.
+    private: std::vector<double> dist;
+
+    /// \brief Dense index of the previous vertex on the path.
+    private: std::vector<size_t> parent;
+  };
+
+  /// \brief A reusable Dijkstra solver for many queries on one graph.
+  ///
+  /// Dijkstra() allocates a distance map, a parent map and a lazy
+  /// priority queue per call, which dominates the cost of small queries
+  /// issued at high rates. DijkstraContext builds a dense index and a
+  /// compact adjacency for the graph once, keeps preallocated distance,
+  /// parent and heap arrays between queries, and uses a 4-ary heap with
+  /// decrease-key so no vertex is ever queued twice. After construction,
+  /// Run() performs no heap allocation.
+  ///
+  /// Rebuild() must be called after the graph's topology changes.
+  template<typename V, typename E, typename EdgeType>
+  class DijkstraContext
+  {
+    /// \brief Constructor. Indexes \p _graph.
+    /// \param[in] _graph The graph to run queries on.
+    public: explicit DijkstraContext(const Graph<V, E, EdgeType> &_graph)
     {
-      const auto &v = vPair.second.get();
-      const auto &componentId = visited[v.Id()];
-      res[componentId].AddVertex(v.Name(), v.Data(), v.Id());
+      this->Rebuild(_graph);
     }
 
-    // Create the edges.
-    for (auto const &ePair : _graph.Edges())
+    /// \brief Rebuild the dense index and adjacency from the graph.
+    /// Invalidates the results of previous queries.
+    /// \param[in] _graph The graph to run queries on.
+    public: void Rebuild(const Graph<V, E, EdgeType> &_graph)
     {
-      const auto &e = ePair.second.get();
-      const auto &vertices = e.Vertices();
-      const auto &componentId = visited[vertices.first];
-      res[componentId].AddEdge(vertices, e.Data(), e.Weight());
+      this->ids.clear();
+      this->index.clear();
+      for (auto const &v : _graph.Vertices())
+      {
+        this->index[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      const size_t n = this->ids.size();
+      this->offsets.assign(n + 1, 0);
+      this->targets.clear();
+      this->weights.clear();
+      for (size_t i = 0; i < n; ++i)
+      {
+        this->offsets[i] = this->targets.size();
+        for (auto const &edgePair : _graph.IncidentsFrom(this->ids[i]))
+        {
+          const auto &edge = edgePair.second.get();
+          this->targets.push_back(this->index[edge.From(this->ids[i])]);
+          this->weights.push_back(edge.Weight());
+        }
+      }
+      this->offsets[n] = this->targets.size();
+
+      this->dist.assign(n, MAX_D);
+      this->parent.assign(n, kNone);
+      this->heapPos.assign(n, kNone);
+      this->heap.resize(n);
     }
 
-    return res;
+    /// \brief Run a shortest path query. Results stay in the context
+    /// until the next Run() or Rebuild() and are read back with Cost(),
+    /// Previous() and Path().
+    /// \param[in] _from The starting vertex.
+    /// \param[in] _to Optional destination; when given, the search
+    /// stops as soon as it is settled and only the entries on that path
+    /// are guaranteed complete.
+    /// \return False when \p _from (or a given \p _to) is not in the
+    /// indexed graph.
+    public: bool Run(const VertexId &_from, const VertexId &_to = kNullId)
+    {
+      auto fromIt = this->index.find(_from);
+      if (fromIt == this->index.end())
+        return false;
+      size_t toIdx = kNone;
+      if (_to != kNullId)
+      {
+        auto toIt = this->index.find(_to);
+        if (toIt == this->index.end())
+          return false;
+        toIdx = toIt->second;
+      }
+
+      std::fill(this->dist.begin(), this->dist.end(), MAX_D);
+      std::fill(this->parent.begin(), this->parent.end(), kNone);
+      std::fill(this->heapPos.begin(), this->heapPos.end(), kNone);
+      this->heapSize = 0;
+
+      const size_t source = fromIt->second;
+      this->dist[source] = 0.0;
+      this->parent[source] = source;
+      this->Push(source);
+
+      while (this->heapSize > 0)
+      {
+        const size_t u = this->heap[0];
+        if (u == toIdx)
+          break;
+        this->Pop();
+
+        const double du = this->dist[u];
+        for (size_t e = this->offsets[u]; e < this->offsets[u + 1]; ++e)
+        {
+          const size_t v = this->targets[e];
+          const double candidate = du + this->weights[e];
+          if (candidate < this->dist[v])
+          {
+            const bool queued = this->heapPos[v] != kNone;
+            this->dist[v] = candidate;
+            this->parent[v] = u;
+            if (queued)
+              this->SiftUp(this->heapPos[v]);
+            else
+              this->Push(v);
+          }
+        }
+      }
+
+      return true;
+    }
+
+    /// \brief Get the cost of the last query's path to a vertex.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The cost, or MAX_D when unreachable or unknown.
+    public: double Cost(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      return it == this->index.end() ? MAX_D : this->dist[it->second];
+    }
+
+    /// \brief Get the previous vertex on the last query's path to a
+    /// vertex.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The previous vertex Id, or kNullId when unreachable or
+    /// unknown.
+    public: VertexId Previous(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return kNullId;
+      return this->ids[this->parent[it->second]];
+    }
+
+    /// \brief Reconstruct the last query's path to a vertex.
+    /// \param[in] _to The destination vertex.
+    /// \return Vertex Ids from the query source to \p _to inclusive,
+    /// or empty when unreachable or unknown.
+    public: std::vector<VertexId> Path(const VertexId &_to) const
+    {
+      std::vector<VertexId> path;
+      auto it = this->index.find(_to);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return path;
+
+      size_t v = it->second;
+      while (this->parent[v] != v)
+      {
+        path.push_back(this->ids[v]);
+        v = this->parent[v];
+      }
+      path.push_back(this->ids[v]);
+      std::reverse(path.begin(), path.end());
+      return path;
+    }
+
+    /// \brief Sentinel for "not present" in the dense arrays.
+    private: static constexpr size_t kNone = static_cast<size_t>(-1);
+
+    /// \brief Heap arity. Four children per node trades a few extra
+    /// comparisons for a shallower tree and fewer cache misses.
+    private: static constexpr size_t kArity = 4;
+
+    /// \brief Append a vertex to the heap and restore the heap order.
+    /// \param[in] _v Dense vertex index.
+    private: void Push(const size_t _v)
+    {
+      this->heap[this->heapSize] = _v;
+      this->heapPos[_v] = this->heapSize;
+      ++this->heapSize;
+      this->SiftUp(this->heapSize - 1);
+    }
+
+    /// \brief Remove the minimum element of the heap.
+    private: void Pop()
+    {
+      this->heapPos[this->heap[0]] = kNone;
+      --this->heapSize;
+      if (this->heapSize > 0)
+      {
+        this->heap[0] = this->heap[this->heapSize];
+        this->heapPos[this->heap[0]] = 0;
+        this->SiftDown(0);
+      }
+    }
+
+    /// \brief Move a heap slot up until its parent is not larger.
+    /// \param[in] _slot Heap slot to restore.
+    private: void SiftUp(size_t _slot)
+    {
+      const size_t v = this->heap[_slot];
+      const double key = this->dist[v];
+      while (_slot > 0)
+      {
+        const size_t parentSlot = (_slot - 1) / kArity;
+        const size_t p = this->heap[parentSlot];
+        if (this->dist[p] <= key)
+          break;
+        this->heap[_slot] = p;
+        this->heapPos[p] = _slot;
+        _slot = parentSlot;
+      }
+      this->heap[_slot] = v;
+      this->heapPos[v] = _slot;
+    }
+
+    /// \brief Move a heap slot down until no child is smaller.
+    /// \param[in] _slot Heap slot to restore.
+    private: void SiftDown(size_t _slot)
+    {
+      const size_t v = this->heap[_slot];
+      const double key = this->dist[v];
+      while (true)
+      {
+        const size_t first = _slot * kArity + 1;
+        if (first >= this->heapSize)
+          break;
+        const size_t last = std::min(first + kArity, this->heapSize);
+        size_t smallest = first;
+        for (size_t c = first + 1; c < last; ++c)
+        {
+          if (this->dist[this->heap[c]] < this->dist[this->heap[smallest]])
+            smallest = c;
+        }
+        if (this->dist[this->heap[smallest]] >= key)
+          break;
+        this->heap[_slot] = this->heap[smallest];
+        this->heapPos[this->heap[_slot]] = _slot;
+        _slot = smallest;
+      }
+      this->heap[_slot] = v;
+      this->heapPos[v] = _slot;
+    }
+
+    /// \brief Vertex Id of each dense index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Dense index of each vertex Id.
+    private: std::map<VertexId, size_t> index;
+
+    /// \brief Adjacency offsets: edges of vertex i occupy
+    /// [offsets[i], offsets[i + 1]).
+    private: std::vector<size_t> offsets;
+
+    /// \brief Dense target vertex of each adjacency entry.
+    private: std::vector<size_t> targets;
+
+    /// \brief Weight of each adjacency entry.
+    private: std::vector<double> weights;
+
+    /// \brief Distance from the last query's source.
+    private: std::vector<double> dist;
+
+    /// \brief Dense index of the previous vertex on the path.
+    private: std::vector<size_t> parent;
+
+    /// \brief Heap slot of each vertex, kNone when not queued.
+    private: std::vector<size_t> heapPos;
+
+    /// \brief The heap of dense vertex indices, ordered by dist.
+    private: std::vector<size_t> heap;
+
+    /// \brief Number of occupied heap slots.
+    private: size_t heapSize = 0;
+  };
+
+  /// \brief A multi-source / multi-target batch shortest path engine.
+  ///
+  /// Routing many agents to shared goals with one Dijkstra() call per
+  /// agent repeats nearly all of the work: the searches differ only in
+  /// their endpoint. This engine indexes the graph once, in both edge
+  /// directions, and then answers a whole tick's routing with a single
+  /// shared search. RunToTargets() runs one backward Dijkstra over the
+  /// reversed edges from every goal at once, after which each agent
+  /// reads its cost and its full path to the nearest goal in time
+  /// proportional to the path length. RunFromSources() is the mirror
+  /// image: one forward search from every source, answering nearest
+  /// source cost and path for any destination. Either way, N searches
+  /// collapse into one search plus N cheap reads.
+  ///
+  /// Rebuild() must be called after the graph changes.
+  template<typename V, typename E, typename EdgeType>
+  class MultiSourceDijkstra
+  {
+    /// \brief Constructor. Indexes \p _graph.
+    /// \param[in] _graph The graph to run queries on.
+    public: explicit MultiSourceDijkstra(const Graph<V, E, EdgeType> &_graph)
+    {
+      this->Rebuild(_graph);
+    }
+
+    /// \brief Rebuild the dense index and both adjacencies from the
+    /// graph. Invalidates the results of previous runs.
+    /// \param[in] _graph The graph to run queries on.
+    public: void Rebuild(const Graph<V, E, EdgeType> &_graph)
+    {
+      this->ids.clear();
+      this->index.clear();
+      for (auto const &v : _graph.Vertices())
+      {
+        this->index[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      const size_t n = this->ids.size();
+      this->offsets.assign(n + 1, 0);
+      this->targets.clear();
+      this->weights.clear();
+      std::vector<std::vector<std::pair<size_t, double>>> incoming(n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        this->offsets[i] = this->targets.size();
+        for (auto const &edgePair : _graph.IncidentsFrom(this->ids[i]))
+        {
+          const auto &edge = edgePair.second.get();
+          const size_t head = this->index[edge.From(this->ids[i])];
+          this->targets.push_back(head);
+          this->weights.push_back(edge.Weight());
+          incoming[head].push_back(std::make_pair(i, edge.Weight()));
+        }
+      }
+      this->offsets[n] = this->targets.size();
+
+      // Reverse adjacency, so backward searches from the goals follow
+      // the edges agents will actually traverse.
+      this->rOffsets.assign(n + 1, 0);
+      this->rTargets.clear();
+      this->rWeights.clear();
+      for (size_t i = 0; i < n; ++i)
+      {
+        this->rOffsets[i] = this->rTargets.size();
+        for (auto const &in : incoming[i])
+        {
+          this->rTargets.push_back(in.first);
+          this->rWeights.push_back(in.second);
+        }
+      }
+      this->rOffsets[n] = this->rTargets.size();
+
+      this->dist.assign(n, MAX_D);
+      this->parent.assign(n, kNone);
+      this->root.assign(n, kNone);
+    }
+
+    /// \brief Run one shared forward search from a set of sources.
+    /// Afterwards Cost() is the distance from the nearest source,
+    /// NearestEndpoint() identifies it, and Path() runs from it to the
+    /// queried vertex.
+    /// \param[in] _sources The source vertices.
+    /// \return False when \p _sources is empty or contains a vertex
+    /// that is not in the indexed graph.
+    public: bool RunFromSources(const std::vector<VertexId> &_sources)
+    {
+      return this->Run(_sources, false);
+    }
+
+    /// \brief Run one shared backward search from a set of targets.
+    /// Afterwards Cost() is the distance to the nearest target along
+    /// directed edges, NearestEndpoint() identifies it, and Path()
+    /// runs from the queried vertex to it.
+    /// \param[in] _targets The target vertices.
+    /// \return False when \p _targets is empty or contains a vertex
+    /// that is not in the indexed graph.
+    public: bool RunToTargets(const std::vector<VertexId> &_targets)
+    {
+      return this->Run(_targets, true);
+    }
+
+    /// \brief Get the cost between a vertex and its nearest endpoint
+    /// of the last run.
+    /// \param[in] _vertex The queried vertex.
+    /// \return The cost, or MAX_D when unreachable or unknown.
+    public: double Cost(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      return it == this->index.end() ? MAX_D : this->dist[it->second];
+    }
+
+    /// \brief Get the endpoint of the last run that is nearest to a
+    /// vertex: the winning source after RunFromSources(), or the
+    /// winning target after RunToTargets().
+    /// \param[in] _vertex The queried vertex.
+    /// \return The endpoint's vertex Id, or kNullId when unreachable
+    /// or unknown.
+    public: VertexId NearestEndpoint(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      if (it == this->index.end() || this->root[it->second] == kNone)
+        return kNullId;
+      return this->ids[this->root[it->second]];
+    }
+
+    /// \brief Reconstruct the last run's path for a vertex: from the
+    /// nearest source to the vertex after RunFromSources(), or from
+    /// the vertex to the nearest target after RunToTargets(). The
+    /// cost is proportional to the path length.
+    /// \param[in] _vertex The queried vertex.
+    /// \return The path's vertex Ids in traversal order, or empty
+    /// when unreachable or unknown.
+    public: std::vector<VertexId> Path(const VertexId &_vertex) const
+    {
+      std::vector<VertexId> path;
+      auto it = this->index.find(_vertex);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return path;
+
+      size_t v = it->second;
+      while (this->parent[v] != v)
+      {
+        path.push_back(this->ids[v]);
+        v = this->parent[v];
+      }
+      path.push_back(this->ids[v]);
+
+      // The parent chain of a backward run already points along the
+      // edge directions; a forward run's chain is walked in reverse.
+      if (!this->backward)
+        std::reverse(path.begin(), path.end());
+      return path;
+    }
+
+    /// \brief Sentinel for "not present" in the dense arrays.
+    private: static constexpr size_t kNone = static_cast<size_t>(-1);
+
+    /// \brief Run one shared search seeded with every endpoint.
+    /// \param[in] _seeds The seed vertices.
+    /// \param[in] _backward True to search over the reversed edges.
+    /// \return False when \p _seeds is empty or contains a vertex
+    /// that is not in the indexed graph.
+    private: bool Run(const std::vector<VertexId> &_seeds,
+                 const bool _backward)
+    {
+      if (_seeds.empty())
+        return false;
+
+      std::priority_queue<std::pair<double, size_t>,
+          std::vector<std::pair<double, size_t>>,
+          std::greater<std::pair<double, size_t>>> pq;
+
+      std::fill(this->dist.begin(), this->dist.end(), MAX_D);
+      std::fill(this->parent.begin(), this->parent.end(), kNone);
+      std::fill(this->root.begin(), this->root.end(), kNone);
+      this->backward = _backward;
+
+      for (auto const &seed : _seeds)
+      {
+        auto it = this->index.find(seed);
+        if (it == this->index.end())
+          return false;
+        const size_t s = it->second;
+        this->dist[s] = 0.0;
+        this->parent[s] = s;
+        this->root[s] = s;
+        pq.push(std::make_pair(0.0, s));
+      }
+
+      const auto &off = _backward ? this->rOffsets : this->offsets;
+      const auto &tgt = _backward ? this->rTargets : this->targets;
+      const auto &wgt = _backward ? this->rWeights : this->weights;
+
+      while (!pq.empty())
+      {
+        const double du = pq.top().first;
+        const size_t u = pq.top().second;
+        pq.pop();
+
+        // Lazy deletion: skip stale queue entries.
+        if (du > this->dist[u])
+          continue;
+
+        for (size_t e = off[u]; e < off[u + 1]; ++e)
+        {
+          const size_t v = tgt[e];
+          const double candidate = du + wgt[e];
+          if (candidate < this->dist[v])
+          {
+            this->dist[v] = candidate;
+            this->parent[v] = u;
+            this->root[v] = this->root[u];
+            pq.push(std::make_pair(candidate, v));
+          }
+        }
+      }
+
+      return true;
+    }
+
+    /// \brief Vertex Id of each dense index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Dense index of each vertex Id.
+    private: std::map<VertexId, size_t> index;
+
+    /// \brief Forward adjacency offsets: edges of vertex i occupy
+    /// [offsets[i], offsets[i + 1]).
+    private: std::vector<size_t> offsets;
+
+    /// \brief Dense target vertex of each forward adjacency entry.
+    private: std::vector<size_t> targets;
+
+    /// \brief Weight of each forward adjacency entry.
+    private: std::vector<double> weights;
+
+    /// \brief Reverse adjacency offsets.
+    private: std::vector<size_t> rOffsets;
+
+    /// \brief Dense target vertex of each reverse adjacency entry.
+    private: std::vector<size_t> rTargets;
+
+    /// \brief Weight of each reverse adjacency entry.
+    private: std::vector<double> rWeights;
+
+    /// \brief Distance between each vertex and its nearest endpoint.
+    private: std::vector<double> dist;
+
+    /// \brief Dense index of the adjacent vertex on the path.
+    private: std::vector<size_t> parent;
+
+    /// \brief Dense index of the winning endpoint for each vertex.
+    private: std::vector<size_t> root;
+
+    /// \brief Whether the last run searched over the reversed edges.
+    private: bool backward = false;
+  };
+
+  /// \brief A shortest path tree that is repaired incrementally when
+  /// edge weights change.
+  ///
+  /// Rerunning Dijkstra from scratch after every weight update is
+  /// wasteful when only a few edges change on an otherwise stable
+  /// graph. This structure keeps the shortest path tree from a fixed
+  /// source and, on UpdateEdgeWeight(), repairs only the affected
+  /// region: a weight decrease relaxes forward from the edge head,
+  /// and an increase invalidates just the tree descendants of the head
+  /// and re-settles them from their intact incoming edges, in the
+  /// style of Ramalingam and Reps. Updates touching a few hundred
+  /// vertices cost microseconds instead of a full recompute.
+  ///
+  /// The tree must be rebuilt with Rebuild() when vertices or edges
+  /// are added or removed; only weight changes are incremental.
+  template<typename V, typename E, typename EdgeType>
+  class DynamicShortestPathTree
+  {
+    /// \brief Constructor. Indexes \p _graph and computes the initial
+    /// tree.
+    /// \param[in] _graph The graph.
+    /// \param[in] _source The source vertex of the tree.
+    public: DynamicShortestPathTree(const Graph<V, E, EdgeType> &_graph,
+                const VertexId &_source)
+    {
+      this->Rebuild(_graph, _source);
+    }
+
+    /// \brief Rebuild the index and the whole tree from the graph.
+    /// \param[in] _graph The graph.
+    /// \param[in] _source The source vertex of the tree.
+    public: void Rebuild(const Graph<V, E, EdgeType> &_graph,
+                const VertexId &_source)
+    {
+      this->ids.clear();
+      this->index.clear();
+      for (auto const &v : _graph.Vertices())
+      {
+        this->index[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      const size_t n = this->ids.size();
+      this->offsets.assign(n + 1, 0);
+      this->targets.clear();
+      this->weights.clear();
+      for (size_t i = 0; i < n; ++i)
+      {
+        this->offsets[i] = this->targets.size();
+        for (auto const &edgePair : _graph.IncidentsFrom(this->ids[i]))
+        {
+          const auto &edge = edgePair.second.get();
+          this->targets.push_back(this->index[edge.From(this->ids[i])]);
+          this->weights.push_back(edge.Weight());
+        }
+      }
+      this->offsets[n] = this->targets.size();
+
+      // Reverse adjacency, sharing the forward weight array so one
+      // update fixes both directions.
+      this->revOffsets.assign(n + 1, 0);
+      for (size_t e = 0; e < this->targets.size(); ++e)
+        ++this->revOffsets[this->targets[e] + 1];
+      for (size_t i = 0; i < n; ++i)
+        this->revOffsets[i + 1] += this->revOffsets[i];
+      this->revSources.resize(this->targets.size());
+      this->revEdges.resize(this->targets.size());
+      {
+        std::vector<size_t> cursor(this->revOffsets.begin(),
+            this->revOffsets.end() - 1);
+        for (size_t i = 0; i < n; ++i)
+        {
+          for (size_t e = this->offsets[i]; e < this->offsets[i + 1]; ++e)
+          {
+            const size_t slot = cursor[this->targets[e]]++;
+            this->revSources[slot] = i;
+            this->revEdges[slot] = e;
+          }
+        }
+      }
+
+      this->dist.assign(n, MAX_D);
+      this->parent.assign(n, kNone);
+
+      auto sourceIt = this->index.find(_source);
+      this->source = sourceIt == this->index.end() ? kNone
+          : sourceIt->second;
+      if (this->source == kNone)
+      {
+        std::cerr << "Vertex [" << _source << "] not found" << std::endl;
+        return;
+      }
+
+      std::priority_queue<CostInfo, std::vector<CostInfo>,
+          std::greater<CostInfo>> pq;
+      this->dist[this->source] = 0.0;
+      this->parent[this->source] = this->source;
+      pq.push(std::make_pair(0.0, this->source));
+      this->Settle(pq);
+    }
+
+    /// \brief Change the weight of the edges from one vertex to
+    /// another and repair the tree. All parallel edges between the two
+    /// vertices take the new weight.
+    /// \param[in] _from Tail vertex of the edge.
+    /// \param[in] _to Head vertex of the edge.
+    /// \param[in] _weight The new weight; must be non-negative.
+    /// \return False when no such edge is indexed.
+    public: bool UpdateEdgeWeight(const VertexId &_from,
+                const VertexId &_to, const double _weight)
+    {
+      auto fromIt = this->index.find(_from);
+      auto toIt = this->index.find(_to);
+      if (fromIt == this->index.end() || toIt == this->index.end())
+        return false;
+      const size_t tail = fromIt->second;
+      const size_t head = toIt->second;
+
+      bool found = false;
+      for (size_t e = this->offsets[tail]; e < this->offsets[tail + 1];
+           ++e)
+      {
+        if (this->targets[e] == head)
+        {
+          this->weights[e] = _weight;
+          found = true;
+        }
+      }
+      if (!found)
+        return false;
+
+      std::priority_queue<CostInfo, std::vector<CostInfo>,
+          std::greater<CostInfo>> pq;
+
+      if (this->dist[tail] < MAX_D &&
+          this->dist[tail] + _weight < this->dist[head])
+      {
+        // The new weight improves the path to the head: relax forward
+        // from there.
+        this->dist[head] = this->dist[tail] + _weight;
+        this->parent[head] = tail;
+        pq.push(std::make_pair(this->dist[head], head));
+        this->Settle(pq);
+      }
+      else if (this->parent[head] == tail)
+      {
+        // The tree reached the head through this edge and the edge got
+        // worse: invalidate the descendants of the head and re-settle
+        // them from intact incoming edges.
+        std::vector<size_t> affected;
+        std::vector<bool> inAffected(this->dist.size(), false);
+        affected.push_back(head);
+        inAffected[head] = true;
+        for (size_t i = 0; i < affected.size(); ++i)
+        {
+          const size_t u = affected[i];
+          for (size_t e = this->offsets[u]; e < this->offsets[u + 1];
+               ++e)
+          {
+            const size_t v = this->targets[e];
+            if (!inAffected[v] && this->parent[v] == u)
+            {
+              affected.push_back(v);
+              inAffected[v] = true;
+            }
+          }
+        }
+
+        for (const size_t u : affected)
+        {
+          this->dist[u] = MAX_D;
+          this->parent[u] = kNone;
+        }
+
+        for (const size_t u : affected)
+        {
+          for (size_t r = this->revOffsets[u]; r < this->revOffsets[u + 1];
+               ++r)
+          {
+            const size_t src = this->revSources[r];
+            if (this->dist[src] >= MAX_D)
+              continue;
+            const double candidate =
+                this->dist[src] + this->weights[this->revEdges[r]];
+            if (candidate < this->dist[u])
+            {
+              this->dist[u] = candidate;
+              this->parent[u] = src;
+            }
+          }
+          if (this->dist[u] < MAX_D)
+            pq.push(std::make_pair(this->dist[u], u));
+        }
+        this->Settle(pq);
+      }
+
+      return true;
+    }
+
+    /// \brief Get the source vertex of the tree.
+    /// \return The source vertex Id.
+    public: VertexId Source() const
+    {
+      return this->source == kNone ? kNullId : this->ids[this->source];
+    }
+
+    /// \brief Get the cost from the source to a vertex.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The cost, or MAX_D when unreachable or unknown.
+    public: double Cost(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      return it == this->index.end() ? MAX_D : this->dist[it->second];
+    }
+
+    /// \brief Get the previous vertex on the path to a vertex.
+    /// \param[in] _vertex The destination vertex.
+    /// \return The previous vertex Id, or kNullId when unreachable or
+    /// unknown.
+    public: VertexId Previous(const VertexId &_vertex) const
+    {
+      auto it = this->index.find(_vertex);
+      if (it == this->index.end() || this->parent[it->second] == kNone)
+        return kNullId;
+      return this->ids[this->parent[it->second]];
+    }
+
+    /// \brief Run a Dijkstra loop with lazy deletion until the queue
+    /// drains, settling every queued vertex.
+    /// \param[in, out] _pq Queue seeded with the vertices to settle.
+    private: void Settle(std::priority_queue<CostInfo,
+                std::vector<CostInfo>, std::greater<CostInfo>> &_pq)
+    {
+      while (!_pq.empty())
+      {
+        const double d = _pq.top().first;
+        const size_t u = static_cast<size_t>(_pq.top().second);
+        _pq.pop();
+        if (d > this->dist[u])
+          continue;
+
+        for (size_t e = this->offsets[u]; e < this->offsets[u + 1]; ++e)
+        {
+          const size_t v = this->targets[e];
+          const double candidate = d + this->weights[e];
+          if (candidate < this->dist[v])
+          {
+            this->dist[v] = candidate;
+            this->parent[v] = u;
+            _pq.push(std::make_pair(candidate, v));
+          }
+        }
+      }
+    }
+
+    /// \brief Sentinel for "not present" in the dense arrays.
+    private: static constexpr size_t kNone = static_cast<size_t>(-1);
+
+    /// \brief Vertex Id of each dense index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Dense index of each vertex Id.
+    private: std::map<VertexId, size_t> index;
+
+    /// \brief Forward adjacency offsets.
+    private: std::vector<size_t> offsets;
+
+    /// \brief Forward adjacency targets.
+    private: std::vector<size_t> targets;
+
+    /// \brief Weight of each forward adjacency entry.
+    private: std::vector<double> weights;
+
+    /// \brief Reverse adjacency offsets.
+    private: std::vector<size_t> revOffsets;
+
+    /// \brief Source vertex of each reverse adjacency entry.
+    private: std::vector<size_t> revSources;
+
+    /// \brief Forward entry mirrored by each reverse entry.
+    private: std::vector<size_t> revEdges;
+
+    /// \brief Distance from the source.
+    private: std::vector<double> dist;
+
+    /// \brief Dense index of the previous vertex on the path.
+    private: std::vector<size_t> parent;
+
+    /// \brief Dense index of the source vertex, kNone when invalid.
+    private: size_t source = kNone;
+  };
+
+  /// \brief A* search.
+  /// Goal-directed variant of Dijkstra: the expansion order is driven by
+  /// the cost so far plus a heuristic estimate of the remaining cost, so
+  /// on spatial graphs the search expands a small corridor towards the
+  /// goal instead of a uniform disc. The search stops as soon as the
+  /// goal is settled.
+  ///
+  /// The heuristic must never overestimate the true remaining cost
+  /// (admissible) for the result to be optimal; a heuristic of zero
+  /// degenerates to Dijkstra.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _to The goal vertex.
+  /// \param[in] _heuristic Callable mapping a VertexId to an estimate
+  /// of the remaining cost to \p _to.
+  /// \return A map in the same format as Dijkstra: for each key, the
+  /// cost from the origin and the previous vertex on the path. Only the
+  /// entries on the path to \p _to are guaranteed complete. An empty map
+  /// is returned when either vertex does not exist.
+  template<typename V, typename E, typename EdgeType, typename Heuristic>
+  std::map<VertexId, CostInfo> AStar(const Graph<V, E, EdgeType> &_graph,
+                                     const VertexId &_from,
+                                     const VertexId &_to,
+                                     const Heuristic &_heuristic)
+  {
+    auto allVertices = _graph.Vertices();
+
+    // Sanity check: Both vertices should exist.
+    if (allVertices.find(_from) == allVertices.end() ||
+        allVertices.find(_to) == allVertices.end())
+    {
+      std::cerr << "Vertex [" << _from << "] or [" << _to
+                << "] not found" << std::endl;
+      return {};
+    }
+
+    // Priority on f = g + h; the cost map stores g.
+    std::priority_queue<CostInfo,
+      std::vector<CostInfo>, std::greater<CostInfo>> pq;
+
+    std::map<VertexId, CostInfo> dist;
+    for (auto const &v : allVertices)
+      dist[v.first] = std::make_pair(MAX_D, kNullId);
+
+    dist[_from] = std::make_pair(0.0, _from);
+    pq.push(std::make_pair(_heuristic(_from), _from));
+
+    while (!pq.empty())
+    {
+      const VertexId u = pq.top().second;
+      pq.pop();
+
+      if (u == _to)
+        break;
+
+      for (auto const &edgePair : _graph.IncidentsFrom(u))
+      {
+        const auto &edge = edgePair.second.get();
+        const auto &v = edge.From(u);
+        const double weight = edge.Weight();
+
+        if (dist[v].first > dist[u].first + weight)
+        {
+          dist[v] = std::make_pair(dist[u].first + weight, u);
+          pq.push(std::make_pair(dist[v].first + _heuristic(v), v));
+        }
+      }
+    }
+
+    return dist;
+  }
+
+  /// \brief Bidirectional A* search.
+  /// Runs a goal-directed search from both endpoints at once, expanding
+  /// whichever frontier is currently cheaper; the frontiers meet in the
+  /// middle, roughly halving the search radius of each side. The two
+  /// heuristics are combined into the balanced form of Ikeda et al., so
+  /// the standard bidirectional termination test remains exact.
+  ///
+  /// Both heuristics should be consistent for the result to be optimal;
+  /// passing zero heuristics yields bidirectional Dijkstra.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _to The goal vertex.
+  /// \param[in] _forwardHeuristic Callable estimating the cost from a
+  /// VertexId to \p _to.
+  /// \param[in] _backwardHeuristic Callable estimating the cost from
+  /// \p _from to a VertexId.
+  /// \return The cost of the shortest path and the sequence of vertex
+  /// Ids from \p _from to \p _to inclusive. When no path exists or a
+  /// vertex is missing, the cost is MAX_D and the path is empty.
+  template<typename V, typename E, typename EdgeType,
+           typename HeuristicF, typename HeuristicB>
+  std::pair<double, std::vector<VertexId>> BidirectionalAStar(
+      const Graph<V, E, EdgeType> &_graph,
+      const VertexId &_from,
+      const VertexId &_to,
+      const HeuristicF &_forwardHeuristic,
+      const HeuristicB &_backwardHeuristic)
+  {
+    auto allVertices = _graph.Vertices();
+    if (allVertices.find(_from) == allVertices.end() ||
+        allVertices.find(_to) == allVertices.end())
+    {
+      std::cerr << "Vertex [" << _from << "] or [" << _to
+                << "] not found" << std::endl;
+      return {MAX_D, {}};
+    }
+
+    if (_from == _to)
+      return {0.0, {_from}};
+
+    // Balanced potential: reduced edge weights stay non-negative for
+    // consistent heuristics and the forward and backward searches agree
+    // on the length of every path up to a constant.
+    auto potential = [&](const VertexId _v)
+    {
+      return 0.5 * (_forwardHeuristic(_v) - _backwardHeuristic(_v));
+    };
+
+    using Queue = std::priority_queue<CostInfo,
+        std::vector<CostInfo>, std::greater<CostInfo>>;
+
+    // Index 0: forward search, index 1: backward search.
+    std::map<VertexId, double> dist[2];
+    std::map<VertexId, VertexId> parent[2];
+    Queue queues[2];
+
+    dist[0][_from] = 0.0;
+    dist[1][_to] = 0.0;
+    queues[0].push(std::make_pair(potential(_from), _from));
+    queues[1].push(std::make_pair(-potential(_to), _to));
+
+    double best = MAX_D;
+    VertexId meet = kNullId;
+
+    while (!queues[0].empty() && !queues[1].empty())
+    {
+      // With the balanced keys the potential terms cancel, so the
+      // plain bidirectional Dijkstra stopping rule stays exact.
+      if (queues[0].top().first + queues[1].top().first >= best)
+        break;
+
+      // Expand the cheaper frontier.
+      const int side = queues[0].top().first <= queues[1].top().first
+          ? 0 : 1;
+      const int other = 1 - side;
+
+      const VertexId u = queues[side].top().second;
+      queues[side].pop();
+
+      const auto edges = side == 0 ? _graph.IncidentsFrom(u)
+                                   : _graph.IncidentsTo(u);
+      for (auto const &edgePair : edges)
+      {
+        const auto &edge = edgePair.second.get();
+        const VertexId v = side == 0 ? edge.From(u) : edge.To(u);
+        if (v == kNullId)
+          continue;
+        const double candidate = dist[side][u] + edge.Weight();
+
+        auto it = dist[side].find(v);
+        if (it == dist[side].end() || it->second > candidate)
+        {
+          dist[side][v] = candidate;
+          parent[side][v] = u;
+          const double p = potential(v);
+          queues[side].push(std::make_pair(
+              candidate + (side == 0 ? p : -p), v));
+        }
+
+        // A vertex reached from both sides is a meeting candidate.
+        auto otherIt = dist[other].find(v);
+        if (otherIt != dist[other].end() &&
+            dist[side][v] + otherIt->second < best)
+        {
+          best = dist[side][v] + otherIt->second;
+          meet = v;
+        }
+      }
+    }
+
+    if (meet == kNullId)
+      return {MAX_D, {}};
+
+    // Stitch the two half paths together at the meeting vertex.
+    std::vector<VertexId> path;
+    for (VertexId v = meet; v != _from; v = parent[0][v])
+      path.push_back(v);
+    path.push_back(_from);
+    std::reverse(path.begin(), path.end());
+    for (VertexId v = meet; v != _to;)
+    {
+      v = parent[1][v];
+      path.push_back(v);
+    }
+
+    return {best, path};
+  }
+
+  /// \brief An anytime weighted A* (ARA*-style) search engine.
+  ///
+  /// A full A* run on a large map can blow a real-time frame budget;
+  /// what a planner needs within its deadline is the best answer found
+  /// so far, with a bound on how far from optimal it may be. This
+  /// engine runs weighted A*, ordering expansions by g + epsilon * h,
+  /// which finds a path quickly (cost at most epsilon times optimal
+  /// for an admissible heuristic), and then keeps improving it with
+  /// decreasing epsilon, reusing the search state between rounds as
+  /// ARA* does (Likhachev et al., 2003). Improve() takes an explicit
+  /// expansion budget and may be interrupted at any point: Cost() and
+  /// Path() always return the best path found so far.
+  ///
+  /// The dense index, adjacency and heap arrays follow DijkstraContext;
+  /// after construction a query performs no heap allocation beyond the
+  /// returned path.
+  template<typename V, typename E, typename EdgeType>
+  class AnytimeAStar
+  {
+    /// \brief Constructor. Indexes \p _graph.
+    /// \param[in] _graph The graph to run queries on.
+    public: explicit AnytimeAStar(const Graph<V, E, EdgeType> &_graph)
+    {
+      this->Rebuild(_graph);
+    }
+
+    /// \brief Rebuild the dense index and adjacency from the graph.
+    /// Invalidates any search in progress.
+    /// \param[in] _graph The graph to run queries on.
+    public: void Rebuild(const Graph<V, E, EdgeType> &_graph)
+    {
+      this->ids.clear();
+      this->index.clear();
+      for (auto const &v : _graph.Vertices())
+      {
+        this->index[v.first] = this->ids.size();
+        this->ids.push_back(v.first);
+      }
+
+      const size_t n = this->ids.size();
+      this->offsets.assign(n + 1, 0);
+      this->targets.clear();
+      this->weights.clear();
+      for (size_t i = 0; i < n; ++i)
+      {
+        this->offsets[i] = this->targets.size();
+        for (auto const &edgePair : _graph.IncidentsFrom(this->ids[i]))
+        {
+          const auto &edge = edgePair.second.get();
+          this->targets.push_back(this->index[edge.From(this->ids[i])]);
+          this->weights.push_back(edge.Weight());
+        }
+      }
+      this->offsets[n] = this->targets.size();
+
+      this->g.assign(n, MAX_D);
+      this->h.assign(n, 0.0);
+      this->f.assign(n, MAX_D);
+      this->parent.assign(n, kNone);
+      this->closed.assign(n, 0);
+      this->inIncons.assign(n, 0);
+      this->heapPos.assign(n, kNone);
+      this->heap.resize(n);
+      this->goal = kNone;
+    }
+
+    /// \brief Begin a new search. The heuristic is evaluated once per
+    /// vertex here; expansions only read the cached values.
+    /// \param[in] _from The starting vertex.
+    /// \param[in] _to The goal vertex.
+    /// \param[in] _heuristic Callable mapping a VertexId to an
+    /// estimate of the remaining cost to \p _to; must not
+    /// overestimate for the epsilon bound to hold.
+    /// \param[in] _initialEpsilon Weight of the first round; higher
+    /// values commit more greedily towards the goal. Clamped to at
+    /// least 1.
+    /// \param[in] _epsilonStep How much each improvement round lowers
+    /// epsilon towards 1; must be positive.
+    /// \return False when either vertex is not in the indexed graph.
+    public: template<typename Heuristic>
+    bool Start(const VertexId &_from, const VertexId &_to,
+               const Heuristic &_heuristic,
+               const double _initialEpsilon = 3.0,
+               const double _epsilonStep = 0.5)
+    {
+      auto fromIt = this->index.find(_from);
+      auto toIt = this->index.find(_to);
+      if (fromIt == this->index.end() || toIt == this->index.end())
+      {
+        std::cerr << "Vertex [" << _from << "] or [" << _to
+                  << "] not found" << std::endl;
+        return false;
+      }
+
+      this->goal = toIt->second;
+      this->epsilon = std::max(1.0, _initialEpsilon);
+      this->epsilonStep = std::max(1e-9, _epsilonStep);
+      this->proven = false;
+
+      const size_t n = this->ids.size();
+      for (size_t i = 0; i < n; ++i)
+        this->h[i] = _heuristic(this->ids[i]);
+
+      std::fill(this->g.begin(), this->g.end(), MAX_D);
+      std::fill(this->f.begin(), this->f.end(), MAX_D);
+      std::fill(this->parent.begin(), this->parent.end(), kNone);
+      std::fill(this->closed.begin(), this->closed.end(), 0);
+      std::fill(this->inIncons.begin(), this->inIncons.end(), 0);
+      std::fill(this->heapPos.begin(), this->heapPos.end(), kNone);
+      this->heapSize = 0;
+      this->incons.clear();
+
+      const size_t source = fromIt->second;
+      this->g[source] = 0.0;
+      this->parent[source] = source;
+      this->f[source] = this->epsilon * this->h[source];
+      this->Push(source);
+      return true;
+    }
+
+    /// \brief Run up to \p _maxExpansions vertex expansions, improving
+    /// the path found so far. Call repeatedly with whatever budget the
+    /// frame leaves; the search continues where it stopped.
+    /// \param[in] _maxExpansions Expansion budget for this call.
+    /// \return True while further improvement is possible; false once
+    /// the current path is proven optimal, or no path exists.
+    public: bool Improve(const size_t _maxExpansions)
+    {
+      if (this->goal == kNone || this->proven)
+        return false;
+
+      size_t expansions = 0;
+      while (expansions < _maxExpansions)
+      {
+        // The round is over when the goal is at least as good as
+        // everything still open: the path cost is then within the
+        // current epsilon of optimal. Lower epsilon and resume with
+        // the open and inconsistent vertices, as ARA* does.
+        if (this->heapSize == 0 ||
+            this->g[this->goal] <= this->f[this->heap[0]])
+        {
+          if (this->heapSize == 0 && this->incons.empty())
+          {
+            // Nothing left to expand: the result is exact, whether a
+            // path was found or not.
+            this->proven = true;
+            return false;
+          }
+          if (this->epsilon <= 1.0)
+          {
+            this->proven = true;
+            return false;
+          }
+          this->epsilon = std::max(1.0, this->epsilon -
+              this->epsilonStep);
+          this->BeginRound();
+          continue;
+        }
+
+        const size_t u = this->heap[0];
+        this->Pop();
+        this->closed[u] = 1;
+        ++expansions;
+
+        const double du = this->g[u];
+        for (size_t e = this->offsets[u]; e < this->offsets[u + 1]; ++e)
+        {
+          const size_t v = this->targets[e];
+          const double candidate = du + this->weights[e];
+          if (candidate < this->g[v])
+          {
+            this->g[v] = candidate;
+            this->parent[v] = u;
+            if (!this->closed[v])
+            {
+              this->f[v] = candidate + this->epsilon * this->h[v];
+              if (this->heapPos[v] != kNone)
+                this->SiftUp(this->heapPos[v]);
+              else
+                this->Push(v);
+            }
+            else if (!this->inIncons[v])
+            {
+              // Improved after being expanded this round: defer the
+              // re-expansion to the next round.
+              this->inIncons[v] = 1;
+              this->incons.push_back(v);
+            }
+          }
+        }
+      }
+      return true;
+    }
+
+    /// \brief Get the weight of the round in progress. Once a round
+    /// has completed, the best path cost is at most this factor times
+    /// the optimal cost.
+    /// \return The current epsilon, at least 1.
+    public: double Epsilon() const
+    {
+      return this->epsilon;
+    }
+
+    /// \brief Get the cost of the best path found so far.
+    /// \return The cost, or MAX_D when no path has been found yet.
+    public: double Cost() const
+    {
+      return this->goal == kNone ? MAX_D : this->g[this->goal];
+    }
+
+    /// \brief Get the best path found so far. Valid at any point,
+    /// including between Improve() calls of an interrupted search.
+    /// \return Vertex Ids from the start to the goal inclusive, or
+    /// empty when no path has been found yet.
+    public: std::vector<VertexId> Path() const
+    {
+      std::vector<VertexId> path;
+      if (this->goal == kNone || this->parent[this->goal] == kNone)
+        return path;
+
+      size_t v = this->goal;
+      while (this->parent[v] != v)
+      {
+        path.push_back(this->ids[v]);
+        v = this->parent[v];
+      }
+      path.push_back(this->ids[v]);
+      std::reverse(path.begin(), path.end());
+      return path;
+    }
+
+    /// \brief Sentinel for "not present" in the dense arrays.
+    private: static constexpr size_t kNone = static_cast<size_t>(-1);
+
+    /// \brief Heap arity, as in DijkstraContext.
+    private: static constexpr size_t kArity = 4;
+
+    /// \brief Start an improvement round at the current epsilon: fold
+    /// the inconsistent vertices into the open set, rescore every open
+    /// vertex and restore the heap order.
+    private: void BeginRound()
+    {
+      for (auto const &v : this->incons)
+      {
+        this->inIncons[v] = 0;
+        if (this->heapPos[v] == kNone)
+        {
+          this->heap[this->heapSize] = v;
+          this->heapPos[v] = this->heapSize;
+          ++this->heapSize;
+        }
+      }
+      this->incons.clear();
+      std::fill(this->closed.begin(), this->closed.end(), 0);
+
+      for (size_t slot = 0; slot < this->heapSize; ++slot)
+      {
+        const size_t v = this->heap[slot];
+        this->f[v] = this->g[v] + this->epsilon * this->h[v];
+      }
+      if (this->heapSize > 1)
+      {
+        for (size_t slot = (this->heapSize - 2) / kArity + 1; slot > 0;)
+          this->SiftDown(--slot);
+      }
+    }
+
+    /// \brief Append a vertex to the heap and restore the heap order.
+    /// \param[in] _v Dense vertex index.
+    private: void Push(const size_t _v)
+    {
+      this->heap[this->heapSize] = _v;
+      this->heapPos[_v] = this->heapSize;
+      ++this->heapSize;
+      this->SiftUp(this->heapSize - 1);
+    }
+
+    /// \brief Remove the minimum element of the heap.
+    private: void Pop()
+    {
+      this->heapPos[this->heap[0]] = kNone;
+      --this->heapSize;
+      if (this->heapSize > 0)
+      {
+        this->heap[0] = this->heap[this->heapSize];
+        this->heapPos[this->heap[0]] = 0;
+        this->SiftDown(0);
+      }
+    }
+
+    /// \brief Move a heap slot up until its parent is not larger.
+    /// \param[in] _slot Heap slot to restore.
+    private: void SiftUp(size_t _slot)
+    {
+      const size_t v = this->heap[_slot];
+      const double key = this->f[v];
+      while (_slot > 0)
+      {
+        const size_t parentSlot = (_slot - 1) / kArity;
+        const size_t p = this->heap[parentSlot];
+        if (this->f[p] <= key)
+          break;
+        this->heap[_slot] = p;
+        this->heapPos[p] = _slot;
+        _slot = parentSlot;
+      }
+      this->heap[_slot] = v;
+      this->heapPos[v] = _slot;
+    }
+
+    /// \brief Move a heap slot down until no child is smaller.
+    /// \param[in] _slot Heap slot to restore.
+    private: void SiftDown(size_t _slot)
+    {
+      const size_t v = this->heap[_slot];
+      const double key = this->f[v];
+      while (true)
+      {
+        const size_t first = _slot * kArity + 1;
+        if (first >= this->heapSize)
+          break;
+        const size_t last = std::min(first + kArity, this->heapSize);
+        size_t smallest = first;
+        for (size_t c = first + 1; c < last; ++c)
+        {
+          if (this->f[this->heap[c]] < this->f[this->heap[smallest]])
+            smallest = c;
+        }
+        if (this->f[this->heap[smallest]] >= key)
+          break;
+        this->heap[_slot] = this->heap[smallest];
+        this->heapPos[this->heap[_slot]] = _slot;
+        _slot = smallest;
+      }
+      this->heap[_slot] = v;
+      this->heapPos[v] = _slot;
+    }
+
+    /// \brief Vertex Id of each dense index.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Dense index of each vertex Id.
+    private: std::map<VertexId, size_t> index;
+
+    /// \brief Adjacency offsets: edges of vertex i occupy
+    /// [offsets[i], offsets[i + 1]).
+    private: std::vector<size_t> offsets;
+
+    /// \brief Dense target vertex of each adjacency entry.
+    private: std::vector<size_t> targets;
+
+    /// \brief Weight of each adjacency entry.
+    private: std::vector<double> weights;
+
+    /// \brief Cost from the start of the current search.
+    private: std::vector<double> g;
+
+    /// \brief Cached heuristic value of each vertex.
+    private: std::vector<double> h;
+
+    /// \brief Heap key: g + epsilon * h at insertion or rescore time.
+    private: std::vector<double> f;
+
+    /// \brief Dense index of the previous vertex on the path.
+    private: std::vector<size_t> parent;
+
+    /// \brief Whether a vertex was expanded this round.
+    private: std::vector<uint8_t> closed;
+
+    /// \brief Whether a vertex is already queued for the next round.
+    private: std::vector<uint8_t> inIncons;
+
+    /// \brief Vertices improved after expansion, re-opened next round.
+    private: std::vector<size_t> incons;
+
+    /// \brief Heap slot of each vertex, kNone when not queued.
+    private: std::vector<size_t> heapPos;
+
+    /// \brief The heap of dense vertex indices, ordered by f.
+    private: std::vector<size_t> heap;
+
+    /// \brief Number of occupied heap slots.
+    private: size_t heapSize = 0;
+
+    /// \brief Dense index of the goal, kNone when no search started.
+    private: size_t goal = kNone;
+
+    /// \brief Weight of the round in progress.
+    private: double epsilon = 1.0;
+
+    /// \brief How much each round lowers epsilon.
+    private: double epsilonStep = 0.5;
+
+    /// \brief Whether the best path has been proven optimal.
+    private: bool proven = false;
+  };
+
+  /// \brief Parallel breadth first sort.
+  /// Level-synchronous variant of BreadthFirstSort: each frontier is split
+  /// across worker threads that scan their share of the adjacency lists
+  /// concurrently, and the discovered vertices are merged serially in
+  /// frontier order. The result is identical to BreadthFirstSort.
+  /// Worthwhile on graphs whose frontiers hold thousands of vertices; on
+  /// small graphs the sequential algorithm is faster.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _threads Number of worker threads. A value of 0 (the
+  /// default) uses the hardware concurrency.
+  /// \return The vector of vertices Ids traversed in a breadth first manner.
+  template<typename V, typename E, typename EdgeType>
+  std::vector<VertexId> ParallelBreadthFirstSort(
+      const Graph<V, E, EdgeType> &_graph,
+      const VertexId &_from,
+      unsigned int _threads = 0)
+  {
+    if (_threads == 0)
+      _threads = std::max(1u, std::thread::hardware_concurrency());
+
+    if (!_graph.VertexFromId(_from).Valid())
+      return {};
+
+    VisitedBitmap visited;
+    visited.Reset(_graph);
+
+    std::vector<VertexId> order;
+    std::vector<VertexId> frontier = {_from};
+    visited.Insert(_from);
+
+    while (!frontier.empty())
+    {
+      order.insert(order.end(), frontier.begin(), frontier.end());
+
+      // Scan the adjacency lists of this frontier. Threads only read the
+      // graph and the visited bitmap; discoveries are collected per chunk
+      // and merged serially below so the visit order stays deterministic.
+      unsigned int nThreads = static_cast<unsigned int>(std::min<size_t>(
+          _threads, frontier.size()));
+      std::vector<std::vector<VertexId>> found(nThreads);
+
+      auto scan = [&_graph, &visited, &frontier, &found, nThreads](
+          unsigned int _chunk)
+      {
+        for (size_t i = _chunk; i < frontier.size(); i += nThreads)
+        {
+          for (auto const &adj : _graph.AdjacentsFrom(frontier[i]))
+          {
+            if (!visited.Contains(adj.first))
+              found[_chunk].push_back(adj.first);
+          }
+        }
+      };
+
+      if (nThreads <= 1)
+      {
+        scan(0);
+      }
+      else
+      {
+        std::vector<std::thread> workers;
+        for (unsigned int t = 0; t < nThreads; ++t)
+          workers.push_back(std::thread(scan, t));
+        for (auto &w : workers)
+          w.join();
+      }
+
+      // Merge: a vertex may be discovered by several chunks; keep the first.
+      std::vector<VertexId> next;
+      for (auto const &chunk : found)
+      {
+        for (auto const &vId : chunk)
+        {
+          if (visited.Insert(vId))
+            next.push_back(vId);
+        }
+      }
+      frontier = std::move(next);
+    }
+
+    return order;
+  }
+
+  /// \brief Reusable frontier-based breadth-first engine over a
+  /// CompressedGraph snapshot.
+  ///
+  /// Even on CSR storage a queue-based BFS is latency bound: every
+  /// frontier vertex dereferences a neighbor list somewhere else in
+  /// the target array. This engine walks the frontier as a flat
+  /// vector, prefetching the neighbor list a few frontier entries
+  /// ahead so the loads are in flight by the time the scan reaches
+  /// them, and on undirected graphs it switches to a bottom-up sweep
+  /// while the frontier is dense: instead of expanding every frontier
+  /// vertex, the unvisited vertices look for any parent in the
+  /// frontier and stop at the first hit, which touches a fraction of
+  /// the edges on the one or two saturated levels of social-style
+  /// graphs. Directed snapshots only store out-edges, so bottom-up
+  /// parent checks are unavailable and those graphs always run top
+  /// down.
+  ///
+  /// The frontier, visited and membership buffers persist in the
+  /// engine between calls, so repeated traversals do not reallocate.
+  /// The set of vertices per BFS level matches BreadthFirstSort; the
+  /// order inside a level depends on the sweep direction, since a
+  /// bottom-up level discovers vertices in index order.
+  template<typename V, typename E, typename EdgeType,
+           GraphStorage Storage = GraphStorage::TOPOLOGY_ONLY>
+  class FrontierBreadthFirst
+  {
+    /// \brief Traverse breadth first from a source vertex.
+    /// \param[in] _graph The snapshot to traverse.
+    /// \param[in] _source Contiguous index of the starting vertex
+    /// (see CompressedGraph::IndexFromId). An out-of-range index
+    /// yields an empty order.
+    /// \param[out] _order Visited vertices as contiguous indices, in
+    /// breadth-first level order.
+    public: void Traverse(
+                const CompressedGraph<V, E, EdgeType, Storage> &_graph,
+                const std::size_t _source,
+                std::vector<std::size_t> &_order)
+    {
+      const std::size_t count = _graph.VertexCount();
+      _order.clear();
+      if (_source >= count)
+        return;
+
+      const auto &offsets = _graph.Offsets();
+      const auto &targets = _graph.Targets();
+
+      const std::size_t words = (count + 63) / 64;
+      this->visited.assign(words, 0u);
+      this->frontier.clear();
+      this->next.clear();
+      _order.reserve(count);
+
+      this->visited[_source / 64] |= std::uint64_t(1) << (_source % 64);
+      this->frontier.push_back(_source);
+      _order.push_back(_source);
+      std::size_t visitedCount = 1;
+
+      while (!this->frontier.empty())
+      {
+        this->next.clear();
+
+        // A frontier holding more than a twentieth of the remaining
+        // vertices is dense enough that checking parents from the
+        // unvisited side wins; only valid when the adjacency is
+        // symmetric.
+        const bool bottomUp = kSymmetric &&
+            this->frontier.size() * 20 > (count - visitedCount);
+
+        if (bottomUp)
+        {
+          // Mark frontier membership for O(1) parent checks.
+          this->inFrontier.assign(words, 0u);
+          for (const std::size_t u : this->frontier)
+            this->inFrontier[u / 64] |= std::uint64_t(1) << (u % 64);
+
+          for (std::size_t v = 0; v < count; ++v)
+          {
+            if (this->visited[v / 64] & (std::uint64_t(1) << (v % 64)))
+              continue;
+            for (std::size_t e = offsets[v]; e < offsets[v + 1]; ++e)
+            {
+              const std::size_t u = targets[e];
+              if (this->inFrontier[u / 64] & (std::uint64_t(1) << (u % 64)))
+              {
+                this->visited[v / 64] |= std::uint64_t(1) << (v % 64);
+                this->next.push_back(v);
+                _order.push_back(v);
+                break;
+              }
+            }
+          }
+        }
+        else
+        {
+          // Top-down sweep with the neighbor lists of upcoming
+          // frontier entries prefetched a few iterations ahead.
+          const std::size_t lookahead = 8;
+          for (std::size_t i = 0; i < this->frontier.size(); ++i)
+          {
+            if (i + lookahead < this->frontier.size())
+            {
+              PrefetchRead(
+                  &targets[offsets[this->frontier[i + lookahead]]]);
+            }
+            const std::size_t u = this->frontier[i];
+            for (std::size_t e = offsets[u]; e < offsets[u + 1]; ++e)
+            {
+              const std::size_t v = targets[e];
+              if (!(this->visited[v / 64] & (std::uint64_t(1) << (v % 64))))
+              {
+                this->visited[v / 64] |= std::uint64_t(1) << (v % 64);
+                this->next.push_back(v);
+                _order.push_back(v);
+              }
+            }
+          }
+        }
+
+        visitedCount += this->next.size();
+        std::swap(this->frontier, this->next);
+      }
+    }
+
+    /// \brief Hint the hardware prefetcher at an address about to be
+    /// read. A no-op on compilers without the intrinsic.
+    /// \param[in] _addr Address of the upcoming read.
+    private: static void PrefetchRead(const void *_addr)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(_addr, 0, 1);
+#else
+      (void)_addr;
+#endif
+    }
+
+    /// \brief Whether the adjacency of this edge type is symmetric,
+    /// which the bottom-up sweep requires.
+    private: static constexpr bool kSymmetric =
+        std::is_same<EdgeType, UndirectedEdge<E>>::value;
+
+    /// \brief Visited bit per vertex index.
+    private: std::vector<std::uint64_t> visited;
+
+    /// \brief Frontier membership bit per vertex index, used by the
+    /// bottom-up sweep.
+    private: std::vector<std::uint64_t> inFrontier;
+
+    /// \brief Current frontier.
+    private: std::vector<std::size_t> frontier;
+
+    /// \brief Frontier under construction.
+    private: std::vector<std::size_t> next;
+  };
+
+  /// \brief Parallel single-source shortest paths via delta-stepping.
+  /// Tentative distances are kept in buckets of width _delta. All requests
+  /// of the current bucket are relaxed concurrently by worker threads into
+  /// per-thread request lists, which are then applied serially. With
+  /// non-negative edge weights the resulting distances are identical to
+  /// Dijkstra; only the recorded predecessor may differ when several
+  /// shortest paths are tied.
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _delta Bucket width. A value <= 0 (the default) picks the
+  /// average edge weight of the graph.
+  /// \param[in] _threads Number of worker threads. A value of 0 (the
+  /// default) uses the hardware concurrency.
+  /// \return A map where the keys are the destination vertices. For each
+  /// destination, the value is a pair of the shortest cost from the origin
+  /// vertex and the previous neighbor Id in the shortest path, matching the
+  /// format returned by Dijkstra.
+  template<typename V, typename E, typename EdgeType>
+  std::map<VertexId, CostInfo> ParallelDijkstra(
+      const Graph<V, E, EdgeType> &_graph,
+      const VertexId &_from,
+      double _delta = 0.0,
+      unsigned int _threads = 0)
+  {
+    auto allVertices = _graph.Vertices();
+
+    // Sanity check: The source vertex should exist.
+    if (allVertices.find(_from) == allVertices.end())
+    {
+      std::cerr << "Vertex [" << _from << "] Not found" << std::endl;
+      return {};
+    }
+
+    if (_threads == 0)
+      _threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Pick a bucket width if the caller didn't: the average edge weight
+    // keeps the number of buckets and the re-relaxation count balanced.
+    if (_delta <= 0.0)
+    {
+      double sum = 0.0;
+      size_t count = 0;
+      for (auto const &ePair : _graph.Edges())
+      {
+        sum += ePair.second.get().Weight();
+        ++count;
+      }
+      _delta = count > 0 ? std::max(sum / count, 1e-6) : 1.0;
+    }
+
+    std::map<VertexId, CostInfo> dist;
+    for (auto const &v : allVertices)
+      dist[v.first] = std::make_pair(MAX_D, kNullId);
+    dist[_from] = std::make_pair(0.0, _from);
+
+    // Buckets of vertices indexed by floor(distance / delta).
+    std::map<uint64_t, std::vector<VertexId>> buckets;
+    buckets[0].push_back(_from);
+
+    // A relaxation request: new cost of a vertex through a predecessor.
+    using Request = std::pair<VertexId, CostInfo>;
+
+    while (!buckets.empty())
+    {
+      auto bucketIt = buckets.begin();
+      const uint64_t bucketId = bucketIt->first;
+
+      // Re-insertions with zero or tiny weights can land back in the
+      // current bucket, so drain it until it stays empty.
+      while (!bucketIt->second.empty())
+      {
+        std::vector<VertexId> active = std::move(bucketIt->second);
+        bucketIt->second.clear();
+
+        unsigned int nThreads = static_cast<unsigned int>(std::min<size_t>(
+            _threads, active.size()));
+        std::vector<std::vector<Request>> requests(std::max(1u, nThreads));
+
+        auto relax = [&_graph, &dist, &active, &requests, nThreads,
+            bucketId, this_delta = _delta](unsigned int _chunk)
+        {
+          for (size_t i = _chunk; i < active.size(); i += nThreads)
+          {
+            const auto u = active[i];
+            const double du = dist.at(u).first;
+
+            // Skip stale entries that were improved after insertion.
+            if (static_cast<uint64_t>(du / this_delta) != bucketId)
+              continue;
+
+            for (auto const &edgePair : _graph.IncidentsFrom(u))
+            {
+              const auto &edge = edgePair.second.get();
+              const auto &v = edge.From(u);
+              const double cost = du + edge.Weight();
+              if (cost < dist.at(v).first)
+                requests[_chunk].push_back({v, {cost, u}});
+            }
+          }
+        };
+
+        if (nThreads <= 1)
+        {
+          relax(0);
+        }
+        else
+        {
+          std::vector<std::thread> workers;
+          for (unsigned int t = 0; t < nThreads; ++t)
+            workers.push_back(std::thread(relax, t));
+          for (auto &w : workers)
+            w.join();
+        }
+
+        // Apply the requests serially.
+        for (auto const &chunk : requests)
+        {
+          for (auto const &req : chunk)
+          {
+            auto &entry = dist[req.first];
+            if (req.second.first < entry.first)
+            {
+              entry = req.second;
+              buckets[static_cast<uint64_t>(req.second.first / _delta)]
+                  .push_back(req.first);
+            }
+          }
+        }
+
+        bucketIt = buckets.find(bucketId);
+      }
+
+      buckets.erase(bucketIt);
+    }
+
+    return dist;
+  }
+
+  /// \brief Export a graph as a dense adjacency matrix.
+  ///
+  /// The matrix is written as one contiguous row-major n-by-n buffer,
+  /// so it can be handed directly to dense linear algebra (e.g. mapped
+  /// into an Eigen matrix through the eigen3 component) without
+  /// element-wise copies or repeated map lookups. Row and column i
+  /// correspond to the i-th id of the returned vector, which lists the
+  /// vertex ids in ascending order. The entry at row i, column j holds
+  /// the accumulated weight of the edges from vertex i to vertex j; in
+  /// an undirected graph each edge contributes to both orientations.
+  /// \param[in] _graph A graph.
+  /// \param[out] _matrix Resized to n * n and filled row major.
+  /// \return The vertex ids in row order.
+  template<typename V, typename E, typename EdgeType>
+  std::vector<VertexId> ToAdjacencyMatrix(
+      const Graph<V, E, EdgeType> &_graph, std::vector<double> &_matrix)
+  {
+    const auto vertices = _graph.Vertices();
+    const std::size_t n = vertices.size();
+
+    std::vector<VertexId> ids;
+    std::map<VertexId, std::size_t> slotOf;
+    ids.reserve(n);
+    for (auto const &v : vertices)
+    {
+      slotOf[v.first] = ids.size();
+      ids.push_back(v.first);
+    }
+
+    _matrix.assign(n * n, 0.0);
+
+    // One pass over the edges; no per-element adjacency queries.
+    for (auto const &e : _graph.Edges())
+    {
+      const auto ends = e.second.get().Vertices();
+      const std::size_t u = slotOf.at(ends.first);
+      const std::size_t v = slotOf.at(ends.second);
+      const double weight = e.second.get().Weight();
+      _matrix[u * n + v] += weight;
+
+      // An undirected edge can be traversed from both ends.
+      if (e.second.get().From(ends.second) != kNullId && u != v)
+        _matrix[v * n + u] += weight;
+    }
+
+    return ids;
+  }
+
+  /// \brief Export the graph Laplacian L = D - A as a dense row-major
+  /// buffer, with the same layout and vertex ordering as
+  /// ToAdjacencyMatrix. D is the diagonal matrix of out-degree weights
+  /// (row sums of A), so in an undirected graph this is the standard
+  /// combinatorial Laplacian used for spectral methods.
+  /// \param[in] _graph A graph.
+  /// \param[out] _matrix Resized to n * n and filled row major.
+  /// \return The vertex ids in row order.
+  template<typename V, typename E, typename EdgeType>
+  std::vector<VertexId> ToLaplacian(
+      const Graph<V, E, EdgeType> &_graph, std::vector<double> &_matrix)
+  {
+    auto ids = ToAdjacencyMatrix(_graph, _matrix);
+    const std::size_t n = ids.size();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double degree = 0.0;
+      for (std::size_t j = 0; j < n; ++j)
+        degree += _matrix[i * n + j];
+      for (std::size_t j = 0; j < n; ++j)
+        _matrix[i * n + j] = -_matrix[i * n + j];
+      _matrix[i * n + i] += degree;
+    }
+
+    return ids;
+  }
+
+  /// \brief Sort the vertices of a directed acyclic graph so every
+  /// vertex appears before the vertices it points to (Kahn's
+  /// algorithm). Vertices that tie are emitted in ascending id order,
+  /// so the result is deterministic.
+  /// \param[in] _graph A directed graph.
+  /// \return The vertex ids in topological order, or an empty vector
+  /// if the graph contains a cycle.
+  template<typename V, typename E>
+  std::vector<VertexId> TopologicalSort(const DirectedGraph<V, E> &_graph)
+  {
+    const auto vertices = _graph.Vertices();
+
+    // Count the incoming edges of every vertex.
+    std::map<VertexId, std::size_t> inDegree;
+    for (auto const &v : vertices)
+      inDegree[v.first] = 0;
+    for (auto const &e : _graph.Edges())
+      ++inDegree[e.second.get().Head()];
+
+    // Ready vertices, kept sorted by id.
+    std::set<VertexId> ready;
+    for (auto const &degree : inDegree)
+    {
+      if (degree.second == 0)
+        ready.insert(degree.first);
+    }
+
+    std::vector<VertexId> sorted;
+    sorted.reserve(vertices.size());
+    while (!ready.empty())
+    {
+      const VertexId id = *ready.begin();
+      ready.erase(ready.begin());
+      sorted.push_back(id);
+
+      for (auto const &e : _graph.IncidentsFrom(id))
+      {
+        const VertexId head = e.second.get().Head();
+        if (--inDegree[head] == 0)
+          ready.insert(head);
+      }
+    }
+
+    if (sorted.size() != vertices.size())
+    {
+      std::cerr << "TopologicalSort error: the graph contains a cycle"
+                << std::endl;
+      return {};
+    }
+
+    return sorted;
+  }
+
+  /// \brief Group the vertices of a directed acyclic graph into
+  /// dependency levels: every vertex in level L only depends on
+  /// vertices in levels below L, so all vertices of one level can
+  /// execute concurrently once the previous levels finished. Each
+  /// level lists its vertices in ascending id order.
+  /// \param[in] _graph A directed graph.
+  /// \return The levels in execution order, or an empty vector if the
+  /// graph contains a cycle.
+  template<typename V, typename E>
+  std::vector<std::vector<VertexId>> LevelSchedule(
+      const DirectedGraph<V, E> &_graph)
+  {
+    const auto sorted = TopologicalSort(_graph);
+    if (sorted.empty() && !_graph.Vertices().empty())
+      return {};
+
+    // The level of a vertex is one past the deepest of its
+    // prerequisites; processing in topological order makes one pass
+    // sufficient.
+    std::map<VertexId, std::size_t> level;
+    std::size_t levelCount = 0;
+    for (auto const id : sorted)
+    {
+      std::size_t &l = level[id];
+      for (auto const &e : _graph.IncidentsFrom(id))
+      {
+        const VertexId head = e.second.get().Head();
+        std::size_t &headLevel = level[head];
+        headLevel = std::max(headLevel, l + 1);
+      }
+      levelCount = std::max(levelCount, l + 1);
+    }
+
+    std::vector<std::vector<VertexId>> schedule(levelCount);
+    for (auto const id : sorted)
+      schedule[level[id]].push_back(id);
+    return schedule;
+  }
+
+  /// \brief Partition the vertices of a graph into _k balanced parts
+  /// while keeping the total weight of edges that cross parts low.
+  ///
+  /// The partitioner is a heuristic: parts are grown greedily from
+  /// seed vertices, always absorbing the unassigned neighbor with the
+  /// strongest connection to the part, and the result is then improved
+  /// with Kernighan-Lin style refinement passes that move boundary
+  /// vertices to the neighboring part with the best cut-weight gain,
+  /// subject to the balance constraint. Edge direction is ignored and
+  /// parallel edge weights accumulate.
+  /// \param[in] _graph A graph.
+  /// \param[in] _k Number of parts; values above the vertex count are
+  /// clamped to it.
+  /// \return A map from every vertex id to its part in [0, _k). An
+  /// empty map is returned if _k is not positive. No part holds more
+  /// than ceil(V / _k) vertices.
+  template<typename V, typename E, typename EdgeType>
+  std::map<VertexId, std::size_t> Partition(
+      const Graph<V, E, EdgeType> &_graph, const int _k)
+  {
+    std::map<VertexId, std::size_t> result;
+
+    if (_k <= 0)
+    {
+      std::cerr << "Partition error: The number of parts has to be positive"
+                << " but its value is [" << _k << "]" << std::endl;
+      return result;
+    }
+
+    const auto vertices = _graph.Vertices();
+    const std::size_t n = vertices.size();
+    if (n == 0)
+      return result;
+
+    const std::size_t k = std::min<std::size_t>(_k, n);
+    const std::size_t maxPartSize = (n + k - 1) / k;
+
+    // Index the vertices and build a symmetric weighted adjacency.
+    std::vector<VertexId> ids;
+    std::map<VertexId, std::size_t> slotOf;
+    ids.reserve(n);
+    for (auto const &v : vertices)
+    {
+      slotOf[v.first] = ids.size();
+      ids.push_back(v.first);
+    }
+
+    std::vector<std::map<std::size_t, double>> adj(n);
+    for (auto const &e : _graph.Edges())
+    {
+      const auto ends = e.second.get().Vertices();
+      const std::size_t u = slotOf.at(ends.first);
+      const std::size_t v = slotOf.at(ends.second);
+      if (u == v)
+        continue;
+      const double weight = e.second.get().Weight();
+      adj[u][v] += weight;
+      adj[v][u] += weight;
+    }
+
+    constexpr std::size_t kUnassigned = MAX_UI64;
+    std::vector<std::size_t> part(n, kUnassigned);
+    std::vector<std::size_t> partSize(k, 0);
+
+    // Greedy growth: each part absorbs the unassigned vertex with the
+    // strongest connection to it until the part is full.
+    std::size_t nextSeed = 0;
+    for (std::size_t p = 0; p < k; ++p)
+    {
+      while (nextSeed < n && part[nextSeed] != kUnassigned)
+        ++nextSeed;
+      if (nextSeed >= n)
+        break;
+
+      std::map<std::size_t, double> gain;
+      gain[nextSeed] = 0.0;
+      while (partSize[p] < maxPartSize && !gain.empty())
+      {
+        auto best = gain.begin();
+        for (auto it = std::next(gain.begin()); it != gain.end(); ++it)
+        {
+          if (it->second > best->second)
+            best = it;
+        }
+        const std::size_t chosen = best->first;
+        gain.erase(best);
+        part[chosen] = p;
+        ++partSize[p];
+        for (auto const &nb : adj[chosen])
+        {
+          if (part[nb.first] == kUnassigned)
+            gain[nb.first] += nb.second;
+        }
+      }
+    }
+
+    // Disconnected leftovers go to the smallest part.
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (part[i] != kUnassigned)
+        continue;
+      std::size_t smallest = 0;
+      for (std::size_t p = 1; p < k; ++p)
+      {
+        if (partSize[p] < partSize[smallest])
+          smallest = p;
+      }
+      part[i] = smallest;
+      ++partSize[smallest];
+    }
+
+    // Refinement: move boundary vertices to the neighboring part with
+    // the best cut-weight gain while the balance holds. Stop when a
+    // full pass makes no move.
+    const unsigned int maxPasses = 8;
+    std::vector<double> weightTo(k);
+    for (auto pass = 0u; pass < maxPasses; ++pass)
+    {
+      bool moved = false;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (adj[i].empty())
+          continue;
+        std::fill(weightTo.begin(), weightTo.end(), 0.0);
+        for (auto const &nb : adj[i])
+          weightTo[part[nb.first]] += nb.second;
+
+        std::size_t target = part[i];
+        for (std::size_t p = 0; p < k; ++p)
+        {
+          if (p == part[i] || partSize[p] + 1 > maxPartSize)
+            continue;
+          if (weightTo[p] > weightTo[target])
+            target = p;
+        }
+        if (target != part[i] && partSize[part[i]] > 1)
+        {
+          --partSize[part[i]];
+          part[i] = target;
+          ++partSize[target];
+          moved = true;
+        }
+      }
+      if (!moved)
+        break;
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+      result[ids[i]] = part[i];
+    return result;
+  }
+
+  /// \brief Calculate the connected components of an undirected graph.
+  /// A connected component of an undirected graph is a subgraph in which any
+  /// two vertices are connected to each other by paths, and which is connected
+  /// to no additional vertices in the supergraph.
+  /// \sa https://en.wikipedia.org/wiki/Connected_component_(graph_theory)
+  /// \param[in] _graph A graph.
+  /// \return A vector of graphs. Each element of the graph is a component
+  /// (subgraph) of the original graph.
+  template<typename V, typename E>
+  std::vector<UndirectedGraph<V, E>> ConnectedComponents(
+    const UndirectedGraph<V, E> &_graph)
+  {
+    std::map<VertexId, unsigned int> visited;
+    unsigned int componentCount = 0;
+
+    for (auto const &v : _graph.Vertices())
+    {
+      if (visited.find(v.first) == visited.end())
+      {
+        auto component = BreadthFirstSort(_graph, v.first);
+        for (auto const &vId : component)
+          visited[vId] = componentCount;
+        ++componentCount;
+      }
+    }
+
+    std::vector<UndirectedGraph<V, E>> res(componentCount);
+
+    // Create the vertices.
+    for (auto const &vPair : _graph.Vertices())
+    {
+      const auto &v = vPair.second.get();
+      const auto &componentId = visited[v.Id()];
+      res[componentId].AddVertex(v.Name(), v.Data(), v.Id());
+    }
+
+    // Create the edges.
+    for (auto const &ePair : _graph.Edges())
+    {
+      const auto &e = ePair.second.get();
+      const auto &vertices = e.Vertices();
+      const auto &componentId = visited[vertices.first];
+      res[componentId].AddEdge(vertices, e.Data(), e.Weight());
+    }
+
+    return res;
+  }
+
+  /// \brief Label every vertex of an undirected graph with the id of
+  /// its connected component, without materializing the component
+  /// subgraphs that ConnectedComponents() builds. The labels come from
+  /// a union-find with path compression and union by size, so the cost
+  /// is near-linear in the number of edges and scales to very large
+  /// graphs.
+  /// \param[in] _graph A graph.
+  /// \return A map from vertex Id to component id. Component ids are
+  /// consecutive, starting at zero, numbered by the lowest vertex Id
+  /// they contain.
+  template<typename V, typename E>
+  std::map<VertexId, uint64_t> ConnectedComponentIds(
+    const UndirectedGraph<V, E> &_graph)
+  {
+    // Dense indices for the union-find arrays.
+    std::vector<VertexId> ids;
+    std::map<VertexId, size_t> index;
+    for (auto const &v : _graph.Vertices())
+    {
+      index[v.first] = ids.size();
+      ids.push_back(v.first);
+    }
+
+    std::vector<size_t> parent(ids.size());
+    std::vector<size_t> size(ids.size(), 1);
+    for (size_t i = 0; i < parent.size(); ++i)
+      parent[i] = i;
+
+    // Find with path halving.
+    auto findRoot = [&parent](size_t _v)
+    {
+      while (parent[_v] != _v)
+      {
+        parent[_v] = parent[parent[_v]];
+        _v = parent[_v];
+      }
+      return _v;
+    };
+
+    for (auto const &ePair : _graph.Edges())
+    {
+      const auto &vertices = ePair.second.get().Vertices();
+      size_t rootA = findRoot(index[vertices.first]);
+      size_t rootB = findRoot(index[vertices.second]);
+      if (rootA == rootB)
+        continue;
+      if (size[rootA] < size[rootB])
+        std::swap(rootA, rootB);
+      parent[rootB] = rootA;
+      size[rootA] += size[rootB];
+    }
+
+    // Number the components by first appearance, walking the vertices
+    // in Id order.
+    std::map<VertexId, uint64_t> res;
+    std::map<size_t, uint64_t> componentOfRoot;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+      const size_t root = findRoot(i);
+      auto it = componentOfRoot.find(root);
+      if (it == componentOfRoot.end())
+      {
+        it = componentOfRoot.insert(
+            {root, static_cast<uint64_t>(componentOfRoot.size())}).first;
+      }
+      res[ids[i]] = it->second;
+    }
+
+    return res;
+  }
+
+  /// \brief Label every vertex of a directed graph with the id of its
+  /// strongly connected component, using an iterative Tarjan traversal
+  /// with an explicit stack so deep graphs cannot overflow the call
+  /// stack. Runs in linear time in vertices plus edges.
+  /// \param[in] _graph A graph.
+  /// \return A map from vertex Id to component id. Component ids are
+  /// consecutive, starting at zero, in the order Tarjan emits the
+  /// components (reverse topological order of the condensation).
+  template<typename V, typename E>
+  std::map<VertexId, uint64_t> StronglyConnectedComponents(
+    const DirectedGraph<V, E> &_graph)
+  {
+    // Dense indices and a CSR-style adjacency so the traversal does no
+    // map lookups.
+    std::vector<VertexId> ids;
+    std::map<VertexId, size_t> index;
+    for (auto const &v : _graph.Vertices())
+    {
+      index[v.first] = ids.size();
+      ids.push_back(v.first);
+    }
+
+    const size_t n = ids.size();
+    std::vector<std::vector<size_t>> adj(n);
+    for (auto const &ePair : _graph.Edges())
+    {
+      const auto &vertices = ePair.second.get().Vertices();
+      adj[index[vertices.first]].push_back(index[vertices.second]);
+    }
+
+    const size_t kUnvisited = n + 1;
+    std::vector<size_t> order(n, kUnvisited);
+    std::vector<size_t> lowlink(n, 0);
+    std::vector<bool> onStack(n, false);
+    std::vector<size_t> stack;
+    std::vector<uint64_t> component(n, 0);
+    size_t counter = 0;
+    uint64_t componentCount = 0;
+
+    // Explicit DFS frames: vertex and position in its adjacency.
+    std::vector<std::pair<size_t, size_t>> frames;
+    for (size_t start = 0; start < n; ++start)
+    {
+      if (order[start] != kUnvisited)
+        continue;
+
+      frames.push_back({start, 0});
+      while (!frames.empty())
+      {
+        const size_t v = frames.back().first;
+        size_t &child = frames.back().second;
+
+        if (child == 0)
+        {
+          order[v] = lowlink[v] = counter++;
+          stack.push_back(v);
+          onStack[v] = true;
+        }
+
+        if (child < adj[v].size())
+        {
+          const size_t w = adj[v][child++];
+          if (order[w] == kUnvisited)
+            frames.push_back({w, 0});
+          else if (onStack[w])
+            lowlink[v] = std::min(lowlink[v], order[w]);
+        }
+        else
+        {
+          if (lowlink[v] == order[v])
+          {
+            // v is the root of a component; pop it off the stack.
+            size_t w;
+            do
+            {
+              w = stack.back();
+              stack.pop_back();
+              onStack[w] = false;
+              component[w] = componentCount;
+            } while (w != v);
+            ++componentCount;
+          }
+
+          frames.pop_back();
+          if (!frames.empty())
+          {
+            lowlink[frames.back().first] =
+                std::min(lowlink[frames.back().first], lowlink[v]);
+          }
+        }
+      }
+    }
+
+    std::map<VertexId, uint64_t> res;
+    for (size_t i = 0; i < n; ++i)
+      res[ids[i]] = component[i];
+
+    return res;
+  }
+
+  /// \brief One level of the coarsening hierarchy built by Coarsen().
+  template<typename V, typename E>
+  struct CoarsenLevel
+  {
+    /// \brief The contracted graph.
+    UndirectedGraph<V, E> graph;
+
+    /// \brief Map from every vertex id of the previous (finer) level
+    /// to the id of the coarse vertex that absorbed it. Coarse
+    /// vertices keep the id of their representative fine vertex, so
+    /// the maps compose across levels.
+    std::map<VertexId, VertexId> parent;
+  };
+
+  /// \brief Build a multi-resolution hierarchy of an undirected graph
+  /// by repeated edge contraction. Each level matches every vertex
+  /// with the unmatched neighbor across its heaviest incident edge
+  /// (heavy-edge matching) and contracts the matched pairs, roughly
+  /// halving the vertex count, until at most _factor times the
+  /// original vertex count remains or no edge can be contracted.
+  /// Parallel edges between two clusters merge into one edge whose
+  /// weight is the sum of the fine weights, so coarse shortest-path
+  /// costs track capacity; intra-cluster edges are dropped. Global
+  /// queries can then run on the last level and refine on finer
+  /// levels through the parent maps.
+  /// \param[in] _graph A graph.
+  /// \param[in] _factor Target fraction of vertices to keep, in
+  /// (0, 1); e.g. 0.01 coarsens to roughly 1% of the vertices.
+  /// \return The hierarchy, finest contraction first. Empty when
+  /// _factor is outside (0, 1) or the graph already meets the target.
+  template<typename V, typename E>
+  std::vector<CoarsenLevel<V, E>> Coarsen(
+      const UndirectedGraph<V, E> &_graph, const double _factor)
+  {
+    std::vector<CoarsenLevel<V, E>> hierarchy;
+    if (_factor <= 0.0 || _factor >= 1.0)
+      return hierarchy;
+
+    const auto target = static_cast<std::size_t>(std::max(1.0,
+        _factor * static_cast<double>(_graph.Vertices().size())));
+    const UndirectedGraph<V, E> *current = &_graph;
+
+    while (current->Vertices().size() > target)
+    {
+      // Heavy-edge matching: every unmatched vertex grabs the
+      // unmatched neighbor across its heaviest incident edge.
+      std::map<VertexId, VertexId> parent;
+      std::size_t clusterCount = 0;
+      for (auto const &vPair : current->Vertices())
+      {
+        const VertexId vId = vPair.first;
+        if (parent.find(vId) != parent.end())
+          continue;
+
+        double bestWeight = -1.0;
+        VertexId bestNeighbor = kNullId;
+        for (auto const &ePair : current->IncidentsFrom(vId))
+        {
+          const auto &e = ePair.second.get();
+          const VertexId uId = e.From(vId);
+          if (uId == vId || parent.find(uId) != parent.end())
+            continue;
+          if (e.Weight() > bestWeight)
+          {
+            bestWeight = e.Weight();
+            bestNeighbor = uId;
+          }
+        }
+
+        parent[vId] = vId;
+        if (bestNeighbor != kNullId)
+          parent[bestNeighbor] = vId;
+        ++clusterCount;
+      }
+
+      // No edge could be contracted; the hierarchy cannot shrink
+      // further.
+      if (clusterCount == current->Vertices().size())
+        break;
+
+      // Contract: one vertex per cluster, keeping the
+      // representative's id, name and data.
+      UndirectedGraph<V, E> coarse;
+      for (auto const &vPair : current->Vertices())
+      {
+        const auto &v = vPair.second.get();
+        if (parent[v.Id()] == v.Id())
+          coarse.AddVertex(v.Name(), v.Data(), v.Id());
+      }
+
+      // Merge parallel inter-cluster edges, summing their weights and
+      // keeping the data of the first fine edge seen.
+      std::map<std::pair<VertexId, VertexId>, std::pair<E, double>> merged;
+      for (auto const &ePair : current->Edges())
+      {
+        const auto &e = ePair.second.get();
+        const auto &vertices = e.Vertices();
+        VertexId a = parent[vertices.first];
+        VertexId b = parent[vertices.second];
+        if (a == b)
+          continue;
+        if (b < a)
+          std::swap(a, b);
+
+        auto iter = merged.find({a, b});
+        if (iter == merged.end())
+          merged[{a, b}] = {e.Data(), e.Weight()};
+        else
+          iter->second.second += e.Weight();
+      }
+      for (auto const &mPair : merged)
+      {
+        coarse.AddEdge(mPair.first, mPair.second.first,
+            mPair.second.second);
+      }
+
+      hierarchy.push_back({std::move(coarse), std::move(parent)});
+      current = &hierarchy.back().graph;
+    }
+
+    return hierarchy;
   }
 
   /// \brief Copy a DirectedGraph to an UndirectedGraph with the same vertices
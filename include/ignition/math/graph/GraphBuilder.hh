@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_GRAPH_GRAPHBUILDER_HH_
+#define IGNITION_MATH_GRAPH_GRAPHBUILDER_HH_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ignition/math/config.hh>
+#include "ignition/math/graph/Graph.hh"
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace graph
+{
+  /// \brief Lock-free multi-producer staging buffer for concurrent
+  /// graph construction.
+  ///
+  /// Graph::AddVertex and Graph::AddEdge mutate std::maps and cannot
+  /// be called from several threads, so parallel loaders end up
+  /// serializing the whole build on a mutex. A ConcurrentGraphBuilder
+  /// instead lets any number of producer threads stage vertices and
+  /// edges wait-free: each call claims a slot in a preallocated array
+  /// with a single fetch_add and writes into it without touching any
+  /// other thread's slot. A single thread then calls Commit() after
+  /// the producers are done (joined or otherwise synchronized with the
+  /// committer) to bulk-insert everything into a Graph.
+  ///
+  /// Because vertex ids assigned by the graph are unknown while
+  /// staging, staged edges must reference explicit vertex ids; stage
+  /// the vertices with explicit ids too.
+  /// \tparam V Vertex data type of the target graph.
+  /// \tparam E Edge data type of the target graph.
+  template<typename V, typename E>
+  class ConcurrentGraphBuilder
+  {
+    /// \brief A staged vertex.
+    public: struct StagedVertex
+    {
+      /// \brief Vertex name.
+      std::string name;
+
+      /// \brief Vertex data.
+      V data;
+
+      /// \brief Vertex id; kNullId lets the graph assign one.
+      VertexId id;
+    };
+
+    /// \brief A staged edge.
+    public: struct StagedEdge
+    {
+      /// \brief Tail and head vertex ids.
+      VertexId_P vertices;
+
+      /// \brief Edge data.
+      E data;
+
+      /// \brief Edge weight.
+      double weight;
+    };
+
+    /// \brief Constructor.
+    /// \param[in] _vertexCapacity Maximum number of staged vertices.
+    /// \param[in] _edgeCapacity Maximum number of staged edges.
+    public: ConcurrentGraphBuilder(const std::size_t _vertexCapacity,
+                const std::size_t _edgeCapacity)
+      : stagedVertices(_vertexCapacity), stagedEdges(_edgeCapacity)
+    {
+    }
+
+    /// \brief Stage a vertex. Safe to call from any number of threads
+    /// concurrently; never blocks.
+    /// \param[in] _name Name of the vertex.
+    /// \param[in] _data Data to be stored in the vertex.
+    /// \param[in] _id Id to be used for this vertex. Pass an explicit
+    /// id if staged edges need to reference the vertex.
+    /// \return True if the vertex was staged, or false if the buffer
+    /// is full and the vertex was dropped.
+    public: bool AddVertex(const std::string &_name, const V &_data,
+                const VertexId &_id = kNullId)
+    {
+      const std::size_t slot =
+          this->vertexCount.fetch_add(1, std::memory_order_relaxed);
+      if (slot >= this->stagedVertices.size())
+      {
+        this->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      this->stagedVertices[slot] = StagedVertex{_name, _data, _id};
+      return true;
+    }
+
+    /// \brief Stage an edge. Safe to call from any number of threads
+    /// concurrently; never blocks.
+    /// \param[in] _vertices The Ids of the two vertices; these must be
+    /// ids the vertices were staged (or already inserted) with.
+    /// \param[in] _data User data.
+    /// \param[in] _weight Edge weight.
+    /// \return True if the edge was staged, or false if the buffer is
+    /// full and the edge was dropped.
+    public: bool AddEdge(const VertexId_P &_vertices, const E &_data,
+                const double _weight = 1.0)
+    {
+      const std::size_t slot =
+          this->edgeCount.fetch_add(1, std::memory_order_relaxed);
+      if (slot >= this->stagedEdges.size())
+      {
+        this->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      this->stagedEdges[slot] = StagedEdge{_vertices, _data, _weight};
+      return true;
+    }
+
+    /// \brief Bulk-insert everything staged so far into a graph and
+    /// clear the buffer. Must be called by a single thread after the
+    /// producers finished; joining them establishes the necessary
+    /// ordering.
+    /// \param[in, out] _graph Destination graph.
+    /// \return The number of vertices and edges inserted. Staged items
+    /// the graph rejects (duplicate vertex ids, edges on unknown
+    /// vertices) are skipped and not counted.
+    public: template<typename EdgeType>
+            std::size_t Commit(Graph<V, E, EdgeType> &_graph)
+    {
+      std::size_t inserted = 0;
+
+      const std::size_t vertices = std::min(
+          this->vertexCount.load(std::memory_order_relaxed),
+          this->stagedVertices.size());
+      for (std::size_t i = 0; i < vertices; ++i)
+      {
+        StagedVertex &staged = this->stagedVertices[i];
+        if (_graph.AddVertex(staged.name, std::move(staged.data),
+            staged.id).Valid())
+        {
+          ++inserted;
+        }
+      }
+
+      const std::size_t edges = std::min(
+          this->edgeCount.load(std::memory_order_relaxed),
+          this->stagedEdges.size());
+      for (std::size_t i = 0; i < edges; ++i)
+      {
+        StagedEdge &staged = this->stagedEdges[i];
+        if (_graph.AddEdge(staged.vertices, std::move(staged.data),
+            staged.weight).Valid())
+        {
+          ++inserted;
+        }
+      }
+
+      this->Clear();
+      return inserted;
+    }
+
+    /// \brief Get the number of successfully staged vertices.
+    /// \return The staged vertex count.
+    public: std::size_t VertexCount() const
+    {
+      return std::min(this->vertexCount.load(std::memory_order_relaxed),
+          this->stagedVertices.size());
+    }
+
+    /// \brief Get the number of successfully staged edges.
+    /// \return The staged edge count.
+    public: std::size_t EdgeCount() const
+    {
+      return std::min(this->edgeCount.load(std::memory_order_relaxed),
+          this->stagedEdges.size());
+    }
+
+    /// \brief Get the number of vertices and edges dropped because the
+    /// buffer was full.
+    /// \return The dropped item count.
+    public: std::size_t Dropped() const
+    {
+      return this->dropped.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Discard everything staged so far. Not safe to call
+    /// concurrently with the staging calls.
+    public: void Clear()
+    {
+      this->vertexCount.store(0, std::memory_order_relaxed);
+      this->edgeCount.store(0, std::memory_order_relaxed);
+      this->dropped.store(0, std::memory_order_relaxed);
+    }
+
+    /// \brief Preallocated vertex slots.
+    private: std::vector<StagedVertex> stagedVertices;
+
+    /// \brief Preallocated edge slots.
+    private: std::vector<StagedEdge> stagedEdges;
+
+    /// \brief Next free vertex slot; may exceed the capacity when
+    /// producers overflow the buffer.
+    private: std::atomic<std::size_t> vertexCount{0};
+
+    /// \brief Next free edge slot; may exceed the capacity when
+    /// producers overflow the buffer.
+    private: std::atomic<std::size_t> edgeCount{0};
+
+    /// \brief Items rejected because the buffer was full.
+    private: std::atomic<std::size_t> dropped{0};
+  };
+}
+}
+}
+}
+#endif
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_GRAPH_NAMEPOOL_HH_
+#define IGNITION_MATH_GRAPH_NAMEPOOL_HH_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ignition/math/config.hh>
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace graph
+{
+  /// \brief A deduplicating registry of strings. Each distinct string
+  /// is stored once and identified by a dense 4-byte id, so containers
+  /// that would otherwise hold millions of mostly-duplicate
+  /// std::string values can hold ids instead. The empty string is
+  /// always interned with id 0. Ids are stable for the lifetime of the
+  /// pool; interned strings are never removed.
+  class NamePool
+  {
+    /// \brief Constructor. The empty string is pre-interned as id 0.
+    public: NamePool()
+    {
+      this->Intern("");
+    }
+
+    /// \brief Get the id of a string, interning it if needed.
+    /// \param[in] _name The string to intern.
+    /// \return The id of the string.
+    public: uint32_t Intern(const std::string &_name)
+    {
+      auto it = this->index.find(_name);
+      if (it != this->index.end())
+        return it->second;
+
+      const uint32_t id = static_cast<uint32_t>(this->names.size());
+      this->names.push_back(_name);
+      this->index[_name] = id;
+      return id;
+    }
+
+    /// \brief Get the string with a given id.
+    /// \param[in] _id The id to look up.
+    /// \return The interned string, or the empty string when _id was
+    /// never returned by Intern().
+    public: const std::string &Name(const uint32_t _id) const
+    {
+      if (_id >= this->names.size())
+        return this->names[0];
+      return this->names[_id];
+    }
+
+    /// \brief Get the number of distinct interned strings, including
+    /// the pre-interned empty string.
+    /// \return The pool size.
+    public: std::size_t Size() const
+    {
+      return this->names.size();
+    }
+
+    /// \brief The interned strings, indexed by id.
+    private: std::vector<std::string> names;
+
+    /// \brief Lookup from string to id.
+    private: std::unordered_map<std::string, uint32_t> index;
+  };
+
+  /// \brief A string stored as a 4-byte id into a process-wide
+  /// NamePool, usable as the NameStorageT policy of Vertex. All
+  /// InternedName values built from equal strings share one pool
+  /// entry, so a vertex name costs 4 bytes regardless of length and
+  /// comparing two names is an integer compare. The shared pool only
+  /// grows; intended for workloads with few distinct names, like the
+  /// mostly-empty names of large generated graphs.
+  class InternedName
+  {
+    /// \brief Default constructor. The name is the empty string.
+    public: InternedName() = default;
+
+    /// \brief Constructor from a string, interning it in the shared
+    /// pool. Intentionally implicit so std::string drops in.
+    /// \param[in] _name The name.
+    // cppcheck-suppress noExplicitConstructor
+    public: InternedName(const std::string &_name)
+      : poolId(Pool().Intern(_name))
+    {
+    }
+
+    /// \brief Get the name.
+    /// \return Reference to the interned string, valid for the
+    /// lifetime of the process.
+    public: operator const std::string &() const
+    {
+      return Pool().Name(this->poolId);
+    }
+
+    /// \brief Get the id of this name in the shared pool.
+    /// \return The pool id.
+    public: uint32_t PoolId() const
+    {
+      return this->poolId;
+    }
+
+    /// \brief Equality operator; an integer compare, since equal
+    /// strings intern to the same id.
+    /// \param[in] _other Name to compare against.
+    /// \return True when both names are the same string.
+    public: bool operator==(const InternedName &_other) const
+    {
+      return this->poolId == _other.poolId;
+    }
+
+    /// \brief Inequality operator.
+    /// \param[in] _other Name to compare against.
+    /// \return True when the names differ.
+    public: bool operator!=(const InternedName &_other) const
+    {
+      return this->poolId != _other.poolId;
+    }
+
+    /// \brief Get the process-wide pool shared by all InternedName
+    /// values.
+    /// \return The shared pool.
+    public: static NamePool &Pool()
+    {
+      static NamePool pool;
+      return pool;
+    }
+
+    /// \brief Id of this name in the shared pool.
+    private: uint32_t poolId = 0;
+  };
+}
+}
+}
+}
+#endif
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_MATH_GRAPH_STATICGRAPH_HH_
+#define IGNITION_MATH_GRAPH_STATICGRAPH_HH_
+
+#include <array>
+#include <cstddef>
+
+#include <ignition/math/config.hh>
+#include "ignition/math/graph/Vertex.hh"
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace graph
+{
+  /// \brief An edge of a StaticGraph: tail and head vertex, user data
+  /// and weight. Aggregate so edge tables can be written as braced
+  /// initializers.
+  template<typename E>
+  struct StaticEdgeInitializer
+  {
+    /// \brief Tail vertex Id (the edge leaves this vertex).
+    public: VertexId from;
+
+    /// \brief Head vertex Id (the edge enters this vertex).
+    public: VertexId to;
+
+    /// \brief User data stored in the edge.
+    public: E data;
+
+    /// \brief The weight (cost) of the edge.
+    public: double weight = 1.0;
+  };
+
+  /// \brief A directed graph with vertex and edge counts fixed at
+  /// compile time, for topologies such as kinematic structures that
+  /// never change at runtime. Vertices are identified by their index
+  /// in [0, NVerts). All storage is std::array and the adjacency is
+  /// laid out in compressed (CSR) form by the constructor, which is
+  /// constexpr for literal vertex and edge types: a StaticGraph built
+  /// from constant tables lives in read-only data and its traversals
+  /// perform no heap allocation or map lookups, unlike
+  /// Graph::AdjacentsFrom and friends which build a std::map of
+  /// reference wrappers per call.
+  ///
+  /// For an undirected topology list each edge in both directions.
+  template<typename V, typename E, std::size_t NVerts, std::size_t NEdges>
+  class StaticGraph
+  {
+    /// \brief A contiguous range of vertex Ids, usable in range-based
+    /// for loops.
+    public: class AdjacencyRange
+    {
+      /// \brief Constructor.
+      /// \param[in] _begin First Id in the range.
+      /// \param[in] _end One past the last Id in the range.
+      public: constexpr AdjacencyRange(const VertexId *_begin,
+                  const VertexId *_end)
+        : beginPtr(_begin), endPtr(_end)
+      {
+      }
+
+      /// \brief Get the beginning of the range.
+      /// \return Pointer to the first Id.
+      public: constexpr const VertexId *begin() const
+      {
+        return this->beginPtr;
+      }
+
+      /// \brief Get the end of the range.
+      /// \return Pointer past the last Id.
+      public: constexpr const VertexId *end() const
+      {
+        return this->endPtr;
+      }
+
+      /// \brief Get the number of Ids in the range.
+      /// \return Range size.
+      public: constexpr std::size_t size() const
+      {
+        return static_cast<std::size_t>(this->endPtr - this->beginPtr);
+      }
+
+      /// \brief First Id in the range.
+      private: const VertexId *beginPtr;
+
+      /// \brief One past the last Id in the range.
+      private: const VertexId *endPtr;
+    };
+
+    /// \brief Constructor.
+    /// \param[in] _vertices User data of the NVerts vertices; the
+    /// vertex Id is the array index.
+    /// \param[in] _edges The NEdges edges. Edges with out-of-range
+    /// endpoints are dropped from the adjacency.
+    public: constexpr StaticGraph(
+                const std::array<V, NVerts> &_vertices,
+                const std::array<StaticEdgeInitializer<E>, NEdges> &_edges)
+      : vertices(_vertices), edges(_edges), offsets(), targets(),
+        adjEdges()
+    {
+      // Counting sort of the edges by tail vertex builds the CSR
+      // arrays without any intermediate allocation.
+      std::size_t degrees[NVerts > 0 ? NVerts : 1] = {};
+      for (std::size_t e = 0; e < NEdges; ++e)
+      {
+        if (_edges[e].from < NVerts && _edges[e].to < NVerts)
+          ++degrees[_edges[e].from];
+      }
+
+      std::size_t offset = 0;
+      for (std::size_t v = 0; v < NVerts; ++v)
+      {
+        this->offsets[v] = offset;
+        offset += degrees[v];
+      }
+      this->offsets[NVerts] = offset;
+
+      std::size_t cursor[NVerts > 0 ? NVerts : 1] = {};
+      for (std::size_t e = 0; e < NEdges; ++e)
+      {
+        if (_edges[e].from < NVerts && _edges[e].to < NVerts)
+        {
+          const std::size_t slot =
+              this->offsets[_edges[e].from] + cursor[_edges[e].from]++;
+          this->targets[slot] = _edges[e].to;
+          this->adjEdges[slot] = e;
+        }
+      }
+      for (std::size_t slot = offset; slot < NEdges; ++slot)
+      {
+        this->targets[slot] = kNullId;
+        this->adjEdges[slot] = NEdges;
+      }
+    }
+
+    /// \brief Get the number of vertices.
+    /// \return NVerts.
+    public: static constexpr std::size_t VertexCount()
+    {
+      return NVerts;
+    }
+
+    /// \brief Get the number of edges.
+    /// \return NEdges.
+    public: static constexpr std::size_t EdgeCount()
+    {
+      return NEdges;
+    }
+
+    /// \brief Get the user data of a vertex.
+    /// \param[in] _vertex Vertex Id; must be in [0, NVerts).
+    /// \return The user data.
+    public: constexpr const V &VertexData(const VertexId _vertex) const
+    {
+      return this->vertices[_vertex];
+    }
+
+    /// \brief Get the user data of an edge.
+    /// \param[in] _edge Edge index; must be in [0, NEdges).
+    /// \return The user data.
+    public: constexpr const E &EdgeData(const std::size_t _edge) const
+    {
+      return this->edges[_edge].data;
+    }
+
+    /// \brief Get the weight of an edge.
+    /// \param[in] _edge Edge index; must be in [0, NEdges).
+    /// \return The edge weight.
+    public: constexpr double EdgeWeight(const std::size_t _edge) const
+    {
+      return this->edges[_edge].weight;
+    }
+
+    /// \brief Get the out-degree of a vertex.
+    /// \param[in] _vertex Vertex Id; must be in [0, NVerts).
+    /// \return Number of edges leaving the vertex.
+    public: constexpr std::size_t Degree(const VertexId _vertex) const
+    {
+      return this->offsets[_vertex + 1] - this->offsets[_vertex];
+    }
+
+    /// \brief Get the vertices reachable from a vertex through one
+    /// edge, as an allocation-free range over the CSR adjacency.
+    /// \param[in] _vertex Vertex Id; must be in [0, NVerts).
+    /// \return Range of adjacent vertex Ids.
+    public: constexpr AdjacencyRange AdjacentsFrom(
+                const VertexId _vertex) const
+    {
+      return AdjacencyRange(
+          this->targets.data() + this->offsets[_vertex],
+          this->targets.data() + this->offsets[_vertex + 1]);
+    }
+
+    /// \brief Get the edge indices of the edges leaving a vertex, in
+    /// the same order as AdjacentsFrom.
+    /// \param[in] _vertex Vertex Id; must be in [0, NVerts).
+    /// \param[in] _slot Position within the vertex's adjacency, in
+    /// [0, Degree(_vertex)).
+    /// \return The edge index.
+    public: constexpr std::size_t EdgeFrom(const VertexId _vertex,
+                const std::size_t _slot) const
+    {
+      return this->adjEdges[this->offsets[_vertex] + _slot];
+    }
+
+    /// \brief Vertex user data; the Id is the index.
+    private: std::array<V, NVerts> vertices;
+
+    /// \brief The edges, as given to the constructor.
+    private: std::array<StaticEdgeInitializer<E>, NEdges> edges;
+
+    /// \brief CSR offsets: adjacency of vertex v occupies slots
+    /// [offsets[v], offsets[v + 1]).
+    private: std::array<std::size_t, NVerts + 1> offsets;
+
+    /// \brief CSR head vertices, grouped by tail vertex.
+    private: std::array<VertexId, NEdges> targets;
+
+    /// \brief Edge index of each adjacency slot.
+    private: std::array<std::size_t, NEdges> adjEdges;
+  };
+}
+}
+}
+}
+#endif
@@ -50,11 +50,17 @@ namespace graph
   /// \brief A vertex of a graph. It stores user information, an optional name,
   /// and keeps an internal unique Id. This class does not enforce to choose a
   /// unique name.
-  template<typename V>
+  ///
+  /// The name storage is a template policy. The default, std::string,
+  /// heap-allocates for names beyond the small-string optimization and
+  /// stores duplicates separately. Graphs with millions of vertices can
+  /// use InternedName from graph/NamePool.hh instead, which stores a
+  /// 4-byte id into a shared string pool.
+  template<typename V, typename NameStorageT = std::string>
   class Vertex
   {
     /// \brief An invalid vertex.
-    public: static Vertex<V> NullVertex;
+    public: static Vertex<V, NameStorageT> NullVertex;
 
     /// \brief Constructor.
     /// \param[in] _name Non-unique vertex name.
@@ -69,6 +75,19 @@ namespace graph
     {
     }
 
+    /// \brief Constructor that takes ownership of the user information.
+    /// \param[in] _name Non-unique vertex name.
+    /// \param[in] _data User information to move into the vertex.
+    /// \param[in] _id Optional unique id.
+    public: Vertex(const std::string &_name,
+                   V &&_data,
+                   const VertexId _id = kNullId)
+      : name(_name),
+        data(std::move(_data)),
+        id(_id)
+    {
+    }
+
     /// \brief Retrieve the user information.
     /// \return Reference to the user information.
     public: const V &Data() const
@@ -117,7 +136,7 @@ namespace graph
     /// \param[in] _v Vertex to write to the stream.
     /// \sa https://en.wikipedia.org/wiki/DOT_(graph_description_language).
     public: friend std::ostream &operator<<(std::ostream &_out,
-                                            const Vertex<V> &_v)
+                                            const Vertex<V, NameStorageT> &_v)
     {
       _out << "  " << _v.Id() << " [label=\"" << _v.Name()
            << " (" << _v.Id() << ")\"];" << std::endl;
@@ -125,7 +144,7 @@ namespace graph
     }
 
     /// \brief Non-unique vertex name.
-    private: std::string name = "";
+    private: NameStorageT name{};
 
     /// \brief User information.
     private: V data;
@@ -135,15 +154,16 @@ namespace graph
   };
 
   /// \brief An invalid vertex.
-  template<typename V>
-  Vertex<V> Vertex<V>::NullVertex("__null__", V(), kNullId);
+  template<typename V, typename NameStorageT>
+  Vertex<V, NameStorageT> Vertex<V, NameStorageT>::NullVertex(
+      "__null__", V(), kNullId);
 
   /// \def VertexRef_M
   /// \brief Map of vertices. The key is the vertex Id. The value is a
   /// reference to the vertex.
-  template<typename V>
+  template<typename V, typename NameStorageT = std::string>
   using VertexRef_M =
-    std::map<VertexId, std::reference_wrapper<const Vertex<V>>>;
+    std::map<VertexId, std::reference_wrapper<const Vertex<V, NameStorageT>>>;
 }
 }
 }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/AlignedAllocator.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(AlignedAllocatorTest, AlignedType)
+{
+  static_assert(alignof(math::Vector3dAligned) == math::kSimdAlignment,
+      "Aligned wrapper must raise the alignment");
+  static_assert(sizeof(math::Vector3dAligned) % math::kSimdAlignment == 0,
+      "Aligned wrapper must pad to the alignment");
+
+  // The wrapper behaves like the wrapped type.
+  math::Vector3dAligned vec(1.0, 2.0, 3.0);
+  EXPECT_DOUBLE_EQ(vec.X(), 1.0);
+  EXPECT_DOUBLE_EQ(vec.Length(), std::sqrt(14.0));
+
+  math::Vector3dAligned copy = math::Vector3d(4.0, 5.0, 6.0);
+  EXPECT_EQ(copy, math::Vector3d(4.0, 5.0, 6.0));
+  EXPECT_EQ(vec + copy, math::Vector3d(5.0, 7.0, 9.0));
+
+  // Stack instances honor the alignment.
+  math::Vector3dAligned stacked[4];
+  for (const auto &v : stacked)
+    EXPECT_TRUE(math::IsAligned(&v, math::kSimdAlignment));
+
+  math::Pose3dAligned pose(math::Pose3d(1, 2, 3, 0, 0, 0));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(1, 2, 3));
+  EXPECT_TRUE(math::IsAligned(&pose, math::kSimdAlignment));
+}
+
+/////////////////////////////////////////////////
+TEST(AlignedAllocatorTest, Allocator)
+{
+  math::AlignedAllocator<double, 64> alloc;
+  for (int i = 0; i < 32; ++i)
+  {
+    double *block = alloc.Allocate(3);
+    EXPECT_TRUE(math::IsAligned(block, 64));
+    alloc.Deallocate(block);
+  }
+
+  EXPECT_TRUE(alloc == (math::AlignedAllocator<float, 64>()));
+  EXPECT_FALSE(alloc != (math::AlignedAllocator<float, 64>()));
+}
+
+/////////////////////////////////////////////////
+TEST(AlignedAllocatorTest, AlignedVector)
+{
+  math::AlignedVector<math::Vector3d> vecs;
+  for (int i = 0; i < 1000; ++i)
+    vecs.push_back(math::Vector3d(i, i + 1, i + 2));
+
+  // The buffer and every element are aligned through all the
+  // reallocations push_back performed.
+  EXPECT_TRUE(math::IsAligned(vecs.data(), math::kSimdAlignment));
+  for (const auto &v : vecs)
+    EXPECT_TRUE(math::IsAligned(&v, math::kSimdAlignment));
+
+  for (int i = 0; i < 1000; ++i)
+    EXPECT_EQ(vecs[i], math::Vector3d(i, i + 1, i + 2));
+}
+
+/////////////////////////////////////////////////
+namespace
+{
+  // Counting hooks for the NumaAllocator test.
+  int g_hookAllocs = 0;
+  int g_hookFrees = 0;
+  int g_hookLastNode = math::kAnyNumaNode;
+
+  void *CountingAllocate(std::size_t _size, std::size_t _alignment,
+      int _node)
+  {
+    ++g_hookAllocs;
+    g_hookLastNode = _node;
+    return math::DefaultNumaAllocate(_size, _alignment, _node);
+  }
+
+  void CountingDeallocate(void *_ptr, std::size_t _size,
+      std::size_t _alignment)
+  {
+    ++g_hookFrees;
+    math::DefaultNumaDeallocate(_ptr, _size, _alignment);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AlignedAllocatorTest, NumaAllocator)
+{
+  // The default hooks serve SIMD-aligned storage and a working vector.
+  {
+    math::NumaVector<double> values;
+    for (int i = 0; i < 1000; ++i)
+      values.push_back(i * 0.5);
+    EXPECT_TRUE(math::IsAligned(values.data(), math::kSimdAlignment));
+    for (int i = 0; i < 1000; ++i)
+      EXPECT_DOUBLE_EQ(i * 0.5, values[i]);
+  }
+
+  // The huge-page preference raises the alignment of large blocks to
+  // the huge page boundary.
+  {
+    math::NumaAllocator<double> alloc(math::kAnyNumaNode, true);
+    const std::size_t count = math::kHugePageSize / sizeof(double);
+    double *block = alloc.allocate(count);
+    EXPECT_TRUE(math::IsAligned(block, math::kHugePageSize));
+    alloc.deallocate(block, count);
+
+    // Small blocks keep the cheap alignment.
+    double *small = alloc.allocate(8);
+    EXPECT_TRUE(math::IsAligned(small, math::kSimdAlignment));
+    alloc.deallocate(small, 8);
+  }
+
+  // Equality compares the options.
+  EXPECT_TRUE(math::NumaAllocator<double>(0) ==
+      math::NumaAllocator<float>(0));
+  EXPECT_TRUE(math::NumaAllocator<double>(0) !=
+      math::NumaAllocator<double>(1));
+
+  // Installed hooks see every allocation and the requested node.
+  math::SetNumaAllocationHooks({&CountingAllocate, &CountingDeallocate});
+  {
+    math::NumaVector<int> bound(math::NumaAllocator<int>(1));
+    bound.resize(100, 7);
+    EXPECT_EQ(7, bound[99]);
+    EXPECT_GE(g_hookAllocs, 1);
+    EXPECT_EQ(1, g_hookLastNode);
+  }
+  EXPECT_EQ(g_hookAllocs, g_hookFrees);
+
+  // Null members restore the defaults.
+  math::SetNumaAllocationHooks({nullptr, nullptr});
+  const int allocsBefore = g_hookAllocs;
+  math::NumaAllocator<double>().deallocate(
+      math::NumaAllocator<double>().allocate(4), 4);
+  EXPECT_EQ(allocsBefore, g_hookAllocs);
+}
+
+/////////////////////////////////////////////////
+TEST(AlignedAllocatorTest, FirstTouch)
+{
+  // FirstTouch initializes every element, spreading the pages over
+  // the pool's workers.
+  std::vector<double> values(100000);
+  math::FirstTouch(values.data(), values.size(), 3.25);
+  for (const auto &v : values)
+    ASSERT_DOUBLE_EQ(3.25, v);
+
+  // Default value and empty ranges.
+  int ints[4] = {9, 9, 9, 9};
+  math::FirstTouch(ints, 4);
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(0, ints[i]);
+  math::FirstTouch(ints, 0, 5);
+}
@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <cmath>
+#include <cstddef>
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Angle.hh"
 
@@ -25,166 +27,38 @@ const Angle Angle::HalfPi = Angle(IGN_PI_2);
 const Angle Angle::TwoPi = Angle(IGN_PI * 2.0);
 
 //////////////////////////////////////////////////
-Angle::Angle()
+void Angle::NormalizeBatch(const double *_radians, double *_out,
+    const size_t _count)
 {
-  this->value = 0;
+  // Same atan2(sin, cos) mapping as Normalize, for exact agreement.
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = atan2(sin(_radians[i]), cos(_radians[i]));
 }
 
-//////////////////////////////////////////////////
-Angle::Angle(const double _radian)
-{
-  this->value = _radian;
-}
-
-//////////////////////////////////////////////////
-Angle::Angle(const Angle &_angle)
-{
-  this->value = _angle.value;
-}
-
-//////////////////////////////////////////////////
-Angle::~Angle()
-{
-}
-
-//////////////////////////////////////////////////
-void Angle::Radian(double _radian)
-{
-  this->value = _radian;
-}
-
-//////////////////////////////////////////////////
-void Angle::SetRadian(double _radian)
-{
-  this->value = _radian;
-}
-
-//////////////////////////////////////////////////
-void Angle::Degree(double _degree)
-{
-  this->value = _degree * IGN_PI / 180.0;
-}
-
-//////////////////////////////////////////////////
-void Angle::SetDegree(double _degree)
-{
-  this->value = _degree * IGN_PI / 180.0;
-}
-
-//////////////////////////////////////////////////
-double Angle::Radian() const
+namespace
 {
-  return this->value;
-}
-
-//////////////////////////////////////////////////
-double Angle::Degree() const
+/// \brief Wrap an angle into [-Pi, Pi) without fmod or branches;
+/// floor compiles to a single rounding instruction on current
+/// targets, so the loop vectorizes.
+inline double WrapFast(const double _angle)
 {
-  return this->value * 180.0 / IGN_PI;
+  const double twoPi = 2.0 * IGN_PI;
+  return _angle - twoPi * std::floor((_angle + IGN_PI) / twoPi);
 }
-
-//////////////////////////////////////////////////
-void Angle::Normalize()
-{
-  this->value = atan2(sin(this->value), cos(this->value));
-}
-
-//////////////////////////////////////////////////
-Angle Angle::Normalized() const
-{
-  return atan2(sin(this->value), cos(this->value));
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator-(const Angle &angle) const
-{
-  return Angle(this->value - angle.value);
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator+(const Angle &angle) const
-{
-  return Angle(this->value + angle.value);
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator*(const Angle &angle) const
-{
-  return Angle(this->value * angle.value);
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator/(const Angle &angle) const
-{
-  return Angle(this->value / angle.value);
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator-=(const Angle &angle)
-{
-  this->value -= angle.value;
-  return *this;
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator+=(const Angle &angle)
-{
-  this->value += angle.value;
-  return *this;
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator*=(const Angle &angle)
-{
-  this->value *= angle.value;
-  return *this;
-}
-
-//////////////////////////////////////////////////
-Angle Angle::operator/=(const Angle &angle)
-{
-  this->value /= angle.value;
-  return *this;
-}
-
-//////////////////////////////////////////////////
-bool Angle::operator==(const Angle &angle) const
-{
-  return equal(this->value, angle.value, 0.001);
-}
-
-//////////////////////////////////////////////////
-bool Angle::operator!=(const Angle &angle) const
-{
-  return !(*this == angle);
-}
-
-//////////////////////////////////////////////////
-bool Angle::operator<(const Angle &angle) const
-{
-  return this->value < angle.value;
-}
-
-//////////////////////////////////////////////////
-bool Angle::operator<=(const Angle &angle) const
-{
-  return this->value < angle.value || equal(this->value, angle.value);
-}
-
-//////////////////////////////////////////////////
-bool Angle::operator>(const Angle &angle) const
-{
-  return this->value > angle.value;
 }
 
 //////////////////////////////////////////////////
-bool Angle::operator>=(const Angle &angle) const
+void Angle::NormalizeBatchFast(const double *_radians, double *_out,
+    const size_t _count)
 {
-  return this->value > angle.value || equal(this->value, angle.value);
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = WrapFast(_radians[i]);
 }
 
 //////////////////////////////////////////////////
-double Angle::operator()() const
+void Angle::ShortestDistanceBatch(const double *_a, const double *_b,
+    double *_out, const size_t _count)
 {
-  return this->value;
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = WrapFast(_b[i] - _a[i]);
 }
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Angle.hh"
@@ -130,3 +131,142 @@ TEST(AngleTest, OperatorStreamOut)
   stream << a;
   EXPECT_EQ(stream.str(), "0.1");
 }
+
+/////////////////////////////////////////////////
+TEST(AngleTest, NormalizeBatch)
+{
+  std::vector<double> radians;
+  for (int i = -50; i <= 50; ++i)
+    radians.push_back(0.37 * i);
+
+  // The batch matches Angle::Normalize element by element.
+  std::vector<double> out(radians.size());
+  math::Angle::NormalizeBatch(radians.data(), out.data(), radians.size());
+  for (size_t i = 0; i < radians.size(); ++i)
+  {
+    math::Angle angle(radians[i]);
+    angle.Normalize();
+    EXPECT_DOUBLE_EQ(*angle, out[i]);
+    EXPECT_LE(out[i], IGN_PI);
+    EXPECT_GE(out[i], -IGN_PI);
+  }
+
+  // In-place normalization gives the same result.
+  std::vector<double> buffer(radians);
+  math::Angle::NormalizeBatch(buffer.data(), buffer.data(), buffer.size());
+  EXPECT_EQ(out, buffer);
+
+  // Zero count is a no-op.
+  math::Angle::NormalizeBatch(nullptr, nullptr, 0);
+}
+
+/////////////////////////////////////////////////
+TEST(AngleTest, NormalizeBatchFast)
+{
+  std::vector<double> radians;
+  for (int i = -50; i <= 50; ++i)
+    radians.push_back(0.37 * i);
+
+  // The fast wrap agrees with Normalize up to rounding, with +Pi
+  // mapping to -Pi.
+  std::vector<double> out(radians.size());
+  math::Angle::NormalizeBatchFast(radians.data(), out.data(),
+      radians.size());
+  for (size_t i = 0; i < radians.size(); ++i)
+  {
+    math::Angle angle(radians[i]);
+    angle.Normalize();
+    double diff = std::fabs(*angle - out[i]);
+    if (diff > IGN_PI)
+      diff = std::fabs(diff - 2.0 * IGN_PI);
+    EXPECT_NEAR(0.0, diff, 1e-9) << radians[i];
+    EXPECT_LT(out[i], IGN_PI);
+    EXPECT_GE(out[i], -IGN_PI);
+  }
+
+  // Already normalized angles pass through exactly; +Pi wraps.
+  double boundary[] = {0.0, 1.0, -1.0, IGN_PI, -IGN_PI};
+  math::Angle::NormalizeBatchFast(boundary, boundary, 5);
+  EXPECT_DOUBLE_EQ(0.0, boundary[0]);
+  EXPECT_DOUBLE_EQ(1.0, boundary[1]);
+  EXPECT_DOUBLE_EQ(-1.0, boundary[2]);
+  EXPECT_DOUBLE_EQ(-IGN_PI, boundary[3]);
+  EXPECT_DOUBLE_EQ(-IGN_PI, boundary[4]);
+
+  // Zero count is a no-op.
+  math::Angle::NormalizeBatchFast(nullptr, nullptr, 0);
+}
+
+/////////////////////////////////////////////////
+TEST(AngleTest, ShortestDistanceBatch)
+{
+  std::vector<double> from, to;
+  for (int i = 0; i < 200; ++i)
+  {
+    from.push_back(2.1 * i - 50.0);
+    to.push_back(-1.3 * i + 20.0);
+  }
+
+  std::vector<double> out(from.size());
+  math::Angle::ShortestDistanceBatch(from.data(), to.data(), out.data(),
+      from.size());
+  for (size_t i = 0; i < from.size(); ++i)
+  {
+    // Moving by the reported distance lands on the target angle.
+    const double reached = IGN_NORMALIZE(from[i] + out[i]);
+    EXPECT_NEAR(IGN_NORMALIZE(to[i]), reached, 1e-9) << i;
+    EXPECT_LT(out[i], IGN_PI);
+    EXPECT_GE(out[i], -IGN_PI);
+  }
+
+  // Known values, including the wrap-around direction.
+  double a[] = {0.0, 0.1, -3.0};
+  double b[] = {IGN_PI_2, -0.1, 3.0};
+  double d[3];
+  math::Angle::ShortestDistanceBatch(a, b, d, 3);
+  EXPECT_DOUBLE_EQ(IGN_PI_2, d[0]);
+  EXPECT_NEAR(-0.2, d[1], 1e-12);
+  // From -3 to 3 the short way crosses +-Pi.
+  EXPECT_NEAR(6.0 - 2.0 * IGN_PI, d[2], 1e-12);
+
+  // The output may alias an input.
+  math::Angle::ShortestDistanceBatch(a, b, b, 3);
+  EXPECT_DOUBLE_EQ(IGN_PI_2, b[0]);
+}
+
+/////////////////////////////////////////////////
+TEST(AngleTest, ConstexprValueSemantics)
+{
+  // Construction, conversion and arithmetic fold at compile time.
+  constexpr math::Angle quarter(IGN_PI_2);
+  static_assert(quarter.Radian() == IGN_PI_2, "wrong radians");
+  static_assert(quarter.Degree() == 90.0, "wrong degrees");
+  static_assert(*quarter == IGN_PI_2, "wrong dereference");
+  static_assert((quarter + quarter).Radian() == IGN_PI, "wrong sum");
+  static_assert(quarter == math::Angle(IGN_PI_2), "wrong equality");
+  static_assert(quarter < math::Angle(IGN_PI), "wrong ordering");
+  static_assert(quarter <= quarter, "wrong ordering");
+
+  // The comparison tolerances match the historical behavior.
+  EXPECT_EQ(math::Angle(1.0), math::Angle(1.0005));
+  EXPECT_NE(math::Angle(1.0), math::Angle(1.002));
+
+  // The free normalized() returns by value and leaves its argument
+  // alone.
+  const math::Angle big(3.0 * IGN_PI);
+  EXPECT_NEAR(math::normalized(big).Radian(), IGN_PI, 1e-12);
+  EXPECT_DOUBLE_EQ(big.Radian(), 3.0 * IGN_PI);
+}
+
+/////////////////////////////////////////////////
+TEST(AngleTest, Literals)
+{
+  using namespace ignition::math::literals;
+
+  constexpr math::Angle right = 90.0_ign_deg;
+  static_assert(right.Radian() == IGN_PI_2 * (90.0 / 90.0), "not folded");
+  EXPECT_DOUBLE_EQ(right.Radian(), IGN_PI_2);
+  EXPECT_DOUBLE_EQ((45_ign_deg).Degree(), 45.0);
+  EXPECT_DOUBLE_EQ((1.5_ign_rad).Radian(), 1.5);
+  EXPECT_DOUBLE_EQ((2_ign_rad).Radian(), 2.0);
+}
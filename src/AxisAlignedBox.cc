@@ -14,8 +14,11 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/detail/Vector3Simd.hh>
 
 using namespace ignition;
 using namespace math;
@@ -107,6 +110,55 @@ math::Vector3d AxisAlignedBox::Center() const
 }
 
 
+//////////////////////////////////////////////////
+AxisAlignedBox AxisAlignedBox::FromPoints(const Vector3d *_points,
+    const size_t _count)
+{
+  double minX = MAX_D, minY = MAX_D, minZ = MAX_D;
+  double maxX = LOW_D, maxY = LOW_D, maxZ = LOW_D;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d &p = _points[i];
+    minX = std::min(minX, p.X());
+    minY = std::min(minY, p.Y());
+    minZ = std::min(minZ, p.Z());
+    maxX = std::max(maxX, p.X());
+    maxY = std::max(maxY, p.Y());
+    maxZ = std::max(maxZ, p.Z());
+  }
+
+  AxisAlignedBox result;
+  result.dataPtr->min.Set(minX, minY, minZ);
+  result.dataPtr->max.Set(maxX, maxY, maxZ);
+  return result;
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBox AxisAlignedBox::MergeAll(const AxisAlignedBox *_boxes,
+    const size_t _count)
+{
+  double minX = MAX_D, minY = MAX_D, minZ = MAX_D;
+  double maxX = LOW_D, maxY = LOW_D, maxZ = LOW_D;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d &bMin = _boxes[i].dataPtr->min;
+    const Vector3d &bMax = _boxes[i].dataPtr->max;
+    minX = std::min(minX, bMin.X());
+    minY = std::min(minY, bMin.Y());
+    minZ = std::min(minZ, bMin.Z());
+    maxX = std::max(maxX, bMax.X());
+    maxY = std::max(maxY, bMax.Y());
+    maxZ = std::max(maxZ, bMax.Z());
+  }
+
+  AxisAlignedBox result;
+  result.dataPtr->min.Set(minX, minY, minZ);
+  result.dataPtr->max.Set(maxX, maxY, maxZ);
+  return result;
+}
+
 //////////////////////////////////////////////////
 void AxisAlignedBox::Merge(const AxisAlignedBox &_box)
 {
@@ -186,6 +238,53 @@ bool AxisAlignedBox::Intersects(const AxisAlignedBox &_box) const
   return true;
 }
 
+//////////////////////////////////////////////////
+bool AxisAlignedBox::IntersectsBranchless(const AxisAlignedBox &_box) const
+{
+  const Vector3d &aMin = this->dataPtr->min;
+  const Vector3d &aMax = this->dataPtr->max;
+  const Vector3d &bMin = _box.dataPtr->min;
+  const Vector3d &bMax = _box.dataPtr->max;
+
+#if defined(IGNITION_MATH_VECTOR3_SIMD_SSE)
+  // The x and y comparisons run as one packed compare each; a set
+  // movemask bit marks a separating plane. The z comparisons are
+  // folded in bitwise, so no comparison produces a branch.
+  const __m128d sep = _mm_or_pd(
+      _mm_cmplt_pd(_mm_set_pd(aMax.Y(), aMax.X()),
+                   _mm_set_pd(bMin.Y(), bMin.X())),
+      _mm_cmpgt_pd(_mm_set_pd(aMin.Y(), aMin.X()),
+                   _mm_set_pd(bMax.Y(), bMax.X())));
+  const int separated = _mm_movemask_pd(sep) |
+      static_cast<int>(aMax.Z() < bMin.Z()) |
+      static_cast<int>(aMin.Z() > bMax.Z());
+  return separated == 0;
+#else
+  // Evaluate all six comparisons and combine bitwise; the single
+  // conversion to bool is the only candidate branch left.
+  const int separated =
+      static_cast<int>(aMax.X() < bMin.X()) |
+      static_cast<int>(aMax.Y() < bMin.Y()) |
+      static_cast<int>(aMax.Z() < bMin.Z()) |
+      static_cast<int>(aMin.X() > bMax.X()) |
+      static_cast<int>(aMin.Y() > bMax.Y()) |
+      static_cast<int>(aMin.Z() > bMax.Z());
+  return separated == 0;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool AxisAlignedBox::IntersectsAny(const AxisAlignedBox &_box,
+    const AxisAlignedBox *_boxes, const std::size_t _count)
+{
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    if (_box.IntersectsBranchless(_boxes[i]))
+      return true;
+  }
+  return false;
+}
+
 //////////////////////////////////////////////////
 const Vector3d &AxisAlignedBox::Min() const
 {
@@ -284,6 +383,50 @@ std::tuple<bool, double, Vector3d>  AxisAlignedBox::Intersect(
   dir.Normalize();
   return this->Intersect(Line3d(_origin + dir * _min, _origin + dir * _max));
 }
+/////////////////////////////////////////////////
+size_t AxisAlignedBox::IntersectBatch(const PreparedRay &_ray,
+    const AxisAlignedBox *_boxes, const size_t _count,
+    uint8_t *_hits, double *_dists)
+{
+  const Vector3d &origin = _ray.Origin();
+  const Vector3d &invDir = _ray.InverseDirection();
+
+  size_t hits = 0;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d &min = _boxes[i].Min();
+    const Vector3d &max = _boxes[i].Max();
+
+    // Slab method: clip the allowed distance range against the two
+    // planes of each axis, keeping the running entry and exit
+    // distances with min/max instead of branches.
+    double tNear = _ray.MinDist();
+    double tFar = _ray.MaxDist();
+
+    const double tx1 = (min.X() - origin.X()) * invDir.X();
+    const double tx2 = (max.X() - origin.X()) * invDir.X();
+    tNear = std::max(tNear, std::min(tx1, tx2));
+    tFar = std::min(tFar, std::max(tx1, tx2));
+
+    const double ty1 = (min.Y() - origin.Y()) * invDir.Y();
+    const double ty2 = (max.Y() - origin.Y()) * invDir.Y();
+    tNear = std::max(tNear, std::min(ty1, ty2));
+    tFar = std::min(tFar, std::max(ty1, ty2));
+
+    const double tz1 = (min.Z() - origin.Z()) * invDir.Z();
+    const double tz2 = (max.Z() - origin.Z()) * invDir.Z();
+    tNear = std::max(tNear, std::min(tz1, tz2));
+    tFar = std::min(tFar, std::max(tz1, tz2));
+
+    const bool hit = tFar >= tNear;
+    _hits[i] = hit ? 1 : 0;
+    hits += _hits[i];
+    if (_dists)
+      _dists[i] = hit ? tNear - _ray.MinDist() : 0.0;
+  }
+  return hits;
+}
+
 /////////////////////////////////////////////////
 double AxisAlignedBox::Volume() const
 {
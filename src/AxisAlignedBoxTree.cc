@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cstdint>
+
+#include "ignition/math/AxisAlignedBoxTree.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief Number of boxes per leaf node.
+  const size_t kLeafSize = 4;
+
+  /// \brief 30-bit Morton code of a point normalized to [0, 1]^3.
+  uint32_t MortonCode(const Vector3d &_p)
+  {
+    auto quantize = [](double _c)
+    {
+      return static_cast<uint32_t>(
+          std::min(std::max(_c * 1024.0, 0.0), 1023.0));
+    };
+    return mortonEncode3d(
+        quantize(_p.X()), quantize(_p.Y()), quantize(_p.Z()));
+  }
+
+  /// \brief One node of the hierarchy. Interior nodes reference their
+  /// children by index in the node array; leaves reference a range of
+  /// the sorted primitive index array.
+  struct TreeNode
+  {
+    /// \brief Bounds of everything below this node.
+    public: AxisAlignedBox bounds;
+
+    /// \brief Index of the left child, or the first primitive for
+    /// leaves.
+    public: size_t left{0};
+
+    /// \brief Index of the right child, unused for leaves.
+    public: size_t right{0};
+
+    /// \brief Number of primitives for leaves, zero for interior nodes.
+    public: size_t count{0};
+  };
+}
+
+/// \brief Private data for the AxisAlignedBoxTree class.
+class ignition::math::AxisAlignedBoxTreePrivate
+{
+  /// \brief The stored boxes, indexed as passed to Build().
+  public: std::vector<AxisAlignedBox> boxes;
+
+  /// \brief Box indices in Morton order; leaves reference ranges of
+  /// this array.
+  public: std::vector<size_t> order;
+
+  /// \brief Contiguous node array; index 0 is the root.
+  public: std::vector<TreeNode> nodes;
+
+  /// \brief Build a node over order[_begin, _end) and append it to the
+  /// node array.
+  /// \return Index of the new node.
+  public: size_t BuildNode(size_t _begin, size_t _end)
+  {
+    const size_t nodeIndex = this->nodes.size();
+    this->nodes.push_back(TreeNode());
+
+    AxisAlignedBox bounds;
+    for (size_t i = _begin; i < _end; ++i)
+      bounds.Merge(this->boxes[this->order[i]]);
+    this->nodes[nodeIndex].bounds = bounds;
+
+    if (_end - _begin <= kLeafSize)
+    {
+      this->nodes[nodeIndex].left = _begin;
+      this->nodes[nodeIndex].count = _end - _begin;
+    }
+    else
+    {
+      // Median split of the Morton order keeps the tree balanced and
+      // spatially coherent without a surface-area sweep.
+      const size_t mid = _begin + (_end - _begin) / 2;
+      const size_t left = this->BuildNode(_begin, mid);
+      const size_t right = this->BuildNode(mid, _end);
+      this->nodes[nodeIndex].left = left;
+      this->nodes[nodeIndex].right = right;
+    }
+    return nodeIndex;
+  }
+
+  /// \brief Visit every leaf box whose node bounds pass \p _test and
+  /// whose own bounds pass \p _test.
+  public: template<typename Test, typename Visit>
+  void Traverse(const Test &_test, const Visit &_visit) const
+  {
+    if (this->nodes.empty())
+      return;
+
+    std::vector<size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+      const TreeNode &node = this->nodes[stack.back()];
+      stack.pop_back();
+
+      if (!_test(node.bounds))
+        continue;
+
+      if (node.count > 0)
+      {
+        for (size_t i = 0; i < node.count; ++i)
+        {
+          const size_t boxIndex = this->order[node.left + i];
+          if (_test(this->boxes[boxIndex]))
+            _visit(boxIndex);
+        }
+      }
+      else
+      {
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+      }
+    }
+  }
+};
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::AxisAlignedBoxTree()
+  : dataPtr(new AxisAlignedBoxTreePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::~AxisAlignedBoxTree()
+{
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Build(const AxisAlignedBox *_boxes, size_t _n)
+{
+  this->dataPtr->boxes.assign(_boxes, _boxes + _n);
+  this->dataPtr->order.resize(_n);
+  this->dataPtr->nodes.clear();
+
+  if (_n == 0)
+    return;
+
+  // Normalize the box centers into the scene bounds and sort the
+  // indices along the Z-order curve.
+  AxisAlignedBox scene;
+  for (size_t i = 0; i < _n; ++i)
+    scene.Merge(_boxes[i]);
+
+  const Vector3d sceneMin = scene.Min();
+  const Vector3d sceneSize = scene.Size();
+  const Vector3d invSize(
+      sceneSize.X() > 0 ? 1.0 / sceneSize.X() : 0.0,
+      sceneSize.Y() > 0 ? 1.0 / sceneSize.Y() : 0.0,
+      sceneSize.Z() > 0 ? 1.0 / sceneSize.Z() : 0.0);
+
+  std::vector<uint32_t> codes(_n);
+  for (size_t i = 0; i < _n; ++i)
+  {
+    this->dataPtr->order[i] = i;
+    codes[i] = MortonCode((_boxes[i].Center() - sceneMin) * invSize);
+  }
+
+  std::sort(this->dataPtr->order.begin(), this->dataPtr->order.end(),
+      [&codes](size_t _a, size_t _b)
+      {
+        return codes[_a] < codes[_b];
+      });
+
+  this->dataPtr->nodes.reserve(2 * (_n / kLeafSize + 1));
+  this->dataPtr->BuildNode(0, _n);
+}
+
+//////////////////////////////////////////////////
+size_t AxisAlignedBoxTree::Count() const
+{
+  return this->dataPtr->boxes.size();
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBox AxisAlignedBoxTree::Box(size_t _index) const
+{
+  if (_index >= this->dataPtr->boxes.size())
+    return AxisAlignedBox();
+  return this->dataPtr->boxes[_index];
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Intersecting(const AxisAlignedBox &_box,
+    std::vector<size_t> &_result) const
+{
+  _result.clear();
+  this->dataPtr->Traverse(
+      [&_box](const AxisAlignedBox &_bounds)
+      {
+        return _bounds.Intersects(_box);
+      },
+      [&_result](size_t _index)
+      {
+        _result.push_back(_index);
+      });
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::IntersectAll(
+    std::vector<std::pair<size_t, size_t>> &_pairs) const
+{
+  _pairs.clear();
+  std::vector<size_t> hits;
+  for (size_t i = 0; i < this->dataPtr->boxes.size(); ++i)
+  {
+    this->Intersecting(this->dataPtr->boxes[i], hits);
+    for (size_t hit : hits)
+    {
+      if (i < hit)
+        _pairs.push_back(std::make_pair(i, hit));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::RayQuery(const Vector3d &_origin,
+    const Vector3d &_dir, double _min, double _max,
+    std::vector<size_t> &_result) const
+{
+  _result.clear();
+  this->dataPtr->Traverse(
+      [&_origin, &_dir, _min, _max](const AxisAlignedBox &_bounds)
+      {
+        return _bounds.IntersectCheck(_origin, _dir, _min, _max);
+      },
+      [&_result](size_t _index)
+      {
+        _result.push_back(_index);
+      });
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::FrustumQuery(const Frustum &_frustum,
+    std::vector<size_t> &_result) const
+{
+  _result.clear();
+  this->dataPtr->Traverse(
+      [&_frustum](const AxisAlignedBox &_bounds)
+      {
+        return _frustum.Contains(_bounds);
+      },
+      [&_result](size_t _index)
+      {
+        _result.push_back(_index);
+      });
+}
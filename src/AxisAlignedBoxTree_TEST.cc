@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "ignition/math/AxisAlignedBoxTree.hh"
+#include "ignition/math/Rand.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+static std::vector<AxisAlignedBox> RandomBoxes(int _count)
+{
+  Rand::Seed(1234);
+  std::vector<AxisAlignedBox> boxes;
+  for (int i = 0; i < _count; ++i)
+  {
+    Vector3d center(Rand::DblUniform(-50, 50),
+                    Rand::DblUniform(-50, 50),
+                    Rand::DblUniform(-50, 50));
+    Vector3d halfSize(Rand::DblUniform(0.1, 2),
+                      Rand::DblUniform(0.1, 2),
+                      Rand::DblUniform(0.1, 2));
+    boxes.push_back(AxisAlignedBox(center - halfSize, center + halfSize));
+  }
+  return boxes;
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Empty)
+{
+  AxisAlignedBoxTree tree;
+  EXPECT_EQ(0u, tree.Count());
+
+  std::vector<size_t> result{99};
+  tree.Intersecting(AxisAlignedBox(Vector3d(-1, -1, -1),
+      Vector3d(1, 1, 1)), result);
+  EXPECT_TRUE(result.empty());
+
+  std::vector<std::pair<size_t, size_t>> pairs;
+  tree.IntersectAll(pairs);
+  EXPECT_TRUE(pairs.empty());
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Intersecting)
+{
+  auto boxes = RandomBoxes(500);
+  AxisAlignedBoxTree tree;
+  tree.Build(boxes.data(), boxes.size());
+  EXPECT_EQ(boxes.size(), tree.Count());
+  EXPECT_EQ(boxes[7], tree.Box(7));
+  EXPECT_EQ(AxisAlignedBox(), tree.Box(boxes.size()));
+
+  AxisAlignedBox query(Vector3d(-20, -20, -20), Vector3d(10, 15, 20));
+  std::vector<size_t> result;
+  tree.Intersecting(query, result);
+
+  std::set<size_t> fromTree(result.begin(), result.end());
+  EXPECT_EQ(result.size(), fromTree.size());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    EXPECT_EQ(boxes[i].Intersects(query), fromTree.count(i) == 1u)
+        << "box " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, IntersectAll)
+{
+  auto boxes = RandomBoxes(200);
+  AxisAlignedBoxTree tree;
+  tree.Build(boxes.data(), boxes.size());
+
+  std::vector<std::pair<size_t, size_t>> pairs;
+  tree.IntersectAll(pairs);
+  std::set<std::pair<size_t, size_t>> fromTree(pairs.begin(), pairs.end());
+  EXPECT_EQ(pairs.size(), fromTree.size());
+
+  size_t bruteForceCount = 0;
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    for (size_t j = i + 1; j < boxes.size(); ++j)
+    {
+      if (boxes[i].Intersects(boxes[j]))
+      {
+        ++bruteForceCount;
+        EXPECT_EQ(1u, fromTree.count(std::make_pair(i, j)));
+      }
+    }
+  }
+  EXPECT_EQ(bruteForceCount, fromTree.size());
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, RayQuery)
+{
+  auto boxes = RandomBoxes(300);
+  AxisAlignedBoxTree tree;
+  tree.Build(boxes.data(), boxes.size());
+
+  Vector3d origin(-60, -60, -60);
+  Vector3d dir = Vector3d(1, 1, 1).Normalize();
+  std::vector<size_t> result;
+  tree.RayQuery(origin, dir, 0, 1000, result);
+
+  std::set<size_t> fromTree(result.begin(), result.end());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    EXPECT_EQ(boxes[i].IntersectCheck(origin, dir, 0, 1000),
+        fromTree.count(i) == 1u) << "box " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, FrustumQuery)
+{
+  auto boxes = RandomBoxes(300);
+  AxisAlignedBoxTree tree;
+  tree.Build(boxes.data(), boxes.size());
+
+  Frustum frustum(1.0, 80.0, Angle(IGN_PI_4), 1.3,
+      Pose3d(-55, 0, 0, 0, 0, 0));
+  std::vector<size_t> result;
+  tree.FrustumQuery(frustum, result);
+
+  std::set<size_t> fromTree(result.begin(), result.end());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    EXPECT_EQ(frustum.Contains(boxes[i]), fromTree.count(i) == 1u)
+        << "box " << i;
+  }
+}
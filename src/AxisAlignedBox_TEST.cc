@@ -16,6 +16,7 @@
 */
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/AxisAlignedBox.hh"
 
@@ -593,3 +594,204 @@ TEST(AxisAlignedBoxTest, Volume)
   AxisAlignedBox box2(math::Vector3d(-1, -2, -3), math::Vector3d(1, 2, 3));
   EXPECT_DOUBLE_EQ(48.0, box2.Volume());
 }
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTest, FromPoints)
+{
+  // The one-pass bound matches merging point boxes one at a time.
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 57; ++i)
+  {
+    points.push_back(math::Vector3d(
+        std::cos(0.3 * i) * (i + 1),
+        std::sin(0.5 * i) * (i - 20),
+        0.1 * i * i - 5.0));
+  }
+
+  math::AxisAlignedBox merged;
+  for (const auto &point : points)
+    merged.Merge(math::AxisAlignedBox(point, point));
+
+  const auto bound =
+      math::AxisAlignedBox::FromPoints(points.data(), points.size());
+  EXPECT_EQ(merged, bound);
+
+  // A single point yields a degenerate box.
+  const auto single = math::AxisAlignedBox::FromPoints(points.data(), 1);
+  EXPECT_EQ(points[0], single.Min());
+  EXPECT_EQ(points[0], single.Max());
+
+  // An empty set yields the default inverted box.
+  const auto empty = math::AxisAlignedBox::FromPoints(nullptr, 0);
+  EXPECT_EQ(math::AxisAlignedBox(), empty);
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTest, MergeAll)
+{
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int i = 0; i < 23; ++i)
+  {
+    boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(-i, 0.5 * i - 4, std::sin(0.2 * i)),
+        math::Vector3d(2 * i + 1, 0.5 * i + 1, std::sin(0.2 * i) + 2)));
+  }
+  // A default box in the middle is absorbed, as with Merge.
+  boxes.insert(boxes.begin() + 10, math::AxisAlignedBox());
+
+  math::AxisAlignedBox merged;
+  for (const auto &box : boxes)
+    merged.Merge(box);
+
+  const auto bound =
+      math::AxisAlignedBox::MergeAll(boxes.data(), boxes.size());
+  EXPECT_EQ(merged, bound);
+
+  // An empty set yields the default inverted box.
+  EXPECT_EQ(math::AxisAlignedBox(),
+      math::AxisAlignedBox::MergeAll(nullptr, 0));
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTest, IntersectBatch)
+{
+  // A field of boxes along the x axis, hit or missed by one ray.
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int i = 0; i < 20; ++i)
+  {
+    const double x = 2.0 * i;
+    const double y = (i % 3 == 0) ? 0.0 : 5.0;
+    boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(x, y, -0.5), math::Vector3d(x + 1.0, y + 1.0, 0.5)));
+  }
+
+  const math::Vector3d origin(-2, 0.5, 0);
+  const math::Vector3d dir(1, 0, 0);
+  const math::PreparedRay ray(origin, dir, 0, 1000);
+  EXPECT_EQ(ray.Origin(), origin);
+  EXPECT_EQ(ray.Direction(), dir);
+  EXPECT_DOUBLE_EQ(ray.InverseDirection().X(), 1.0);
+  EXPECT_DOUBLE_EQ(ray.MinDist(), 0.0);
+  EXPECT_DOUBLE_EQ(ray.MaxDist(), 1000.0);
+
+  std::vector<uint8_t> hits(boxes.size());
+  std::vector<double> dists(boxes.size());
+  const size_t count = math::AxisAlignedBox::IntersectBatch(ray,
+      boxes.data(), boxes.size(), hits.data(), dists.data());
+
+  size_t expectedCount = 0;
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    bool expectedHit;
+    double expectedDist;
+    std::tie(expectedHit, expectedDist) =
+        boxes[i].IntersectDist(origin, dir, 0, 1000);
+    EXPECT_EQ(hits[i] != 0, expectedHit) << i;
+    if (expectedHit)
+    {
+      EXPECT_NEAR(dists[i], expectedDist, 1e-9) << i;
+    }
+    else
+      EXPECT_DOUBLE_EQ(dists[i], 0.0) << i;
+    expectedCount += expectedHit;
+  }
+  EXPECT_EQ(count, expectedCount);
+
+  // An oblique ray, an unnormalized direction, and a ray starting
+  // inside a box.
+  const math::PreparedRay oblique(
+      math::Vector3d(0.5, 0.25, 0), math::Vector3d(2, 1, 0.4), 0, 50);
+  const size_t obliqueCount = math::AxisAlignedBox::IntersectBatch(
+      oblique, boxes.data(), boxes.size(), hits.data(), dists.data());
+  size_t obliqueExpected = 0;
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    bool expectedHit;
+    double expectedDist;
+    std::tie(expectedHit, expectedDist) = boxes[i].IntersectDist(
+        math::Vector3d(0.5, 0.25, 0), math::Vector3d(2, 1, 0.4), 0, 50);
+    EXPECT_EQ(hits[i] != 0, expectedHit) << i;
+    if (expectedHit)
+    {
+      EXPECT_NEAR(dists[i], expectedDist, 1e-9) << i;
+    }
+    obliqueExpected += expectedHit;
+  }
+  EXPECT_EQ(obliqueCount, obliqueExpected);
+
+  // The minimum distance offsets the reported distances.
+  const math::PreparedRay offsetRay(origin, dir, 1.5, 1000);
+  math::AxisAlignedBox::IntersectBatch(offsetRay, boxes.data(), 1,
+      hits.data(), dists.data());
+  ASSERT_EQ(hits[0], 1u);
+  EXPECT_NEAR(dists[0], 0.5, 1e-9);
+
+  // Distances are optional.
+  EXPECT_EQ(math::AxisAlignedBox::IntersectBatch(ray, boxes.data(),
+      boxes.size(), hits.data()), expectedCount);
+}
+
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTest, IntersectsBranchless)
+{
+  // The branchless variant matches Intersects over a grid of offset
+  // boxes, including the touching-face boundary cases.
+  math::AxisAlignedBox query(math::Vector3d(-1, -1, -1),
+      math::Vector3d(1, 1, 1));
+  for (double x = -3.0; x <= 3.0; x += 0.5)
+  {
+    for (double y = -3.0; y <= 3.0; y += 0.5)
+    {
+      for (double z = -3.0; z <= 3.0; z += 0.5)
+      {
+        math::AxisAlignedBox other(math::Vector3d(x, y, z),
+            math::Vector3d(x + 1, y + 1, z + 1));
+        EXPECT_EQ(query.Intersects(other),
+            query.IntersectsBranchless(other))
+            << "offset (" << x << " " << y << " " << z << ")";
+      }
+    }
+  }
+
+  // Separation on a single axis is enough to reject.
+  EXPECT_FALSE(query.IntersectsBranchless(math::AxisAlignedBox(
+      math::Vector3d(2, -1, -1), math::Vector3d(3, 1, 1))));
+  EXPECT_FALSE(query.IntersectsBranchless(math::AxisAlignedBox(
+      math::Vector3d(-1, -1, -3), math::Vector3d(1, 1, -2))));
+
+  // Shared faces and shared corners count as intersecting, exactly
+  // as they do for Intersects.
+  EXPECT_TRUE(query.IntersectsBranchless(math::AxisAlignedBox(
+      math::Vector3d(1, -1, -1), math::Vector3d(2, 1, 1))));
+  EXPECT_TRUE(query.IntersectsBranchless(math::AxisAlignedBox(
+      math::Vector3d(1, 1, 1), math::Vector3d(2, 2, 2))));
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTest, IntersectsAny)
+{
+  math::AxisAlignedBox query(math::Vector3d(0, 0, 0),
+      math::Vector3d(1, 1, 1));
+
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int i = 0; i < 10; ++i)
+  {
+    boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(10 + i, 0, 0), math::Vector3d(10.5 + i, 1, 1)));
+  }
+  EXPECT_FALSE(math::AxisAlignedBox::IntersectsAny(
+      query, boxes.data(), boxes.size()));
+  EXPECT_FALSE(math::AxisAlignedBox::IntersectsAny(
+      query, boxes.data(), 0));
+
+  // One overlapping box anywhere in the array flips the answer.
+  boxes[7] = math::AxisAlignedBox(
+      math::Vector3d(0.5, 0.5, 0.5), math::Vector3d(2, 2, 2));
+  EXPECT_TRUE(math::AxisAlignedBox::IntersectsAny(
+      query, boxes.data(), boxes.size()));
+  EXPECT_TRUE(math::AxisAlignedBox::IntersectsAny(
+      query, boxes.data() + 7, 1));
+  EXPECT_FALSE(math::AxisAlignedBox::IntersectsAny(
+      query, boxes.data(), 7));
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+
+#include "ignition/math/BatchExecutor.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+/// \brief Alignment of buffers returned by the default backend. One
+/// cache line, which also satisfies every SIMD load width in use.
+const size_t kBufferAlignment = 64;
+
+/// \brief The installed backend, or nullptr when the CPU default is
+/// active.
+std::atomic<BatchExecutor *> gActiveExecutor{nullptr};
+}
+
+//////////////////////////////////////////////////
+BatchExecutor::~BatchExecutor()
+{
+}
+
+//////////////////////////////////////////////////
+std::string BatchExecutor::Name() const
+{
+  return "cpu";
+}
+
+//////////////////////////////////////////////////
+void BatchExecutor::TransformPoints(const Matrix4d &_tf,
+    const Vector3d *_in, Vector3d *_out, size_t _n) const
+{
+  _tf.TransformPoints(_in, _out, _n);
+}
+
+//////////////////////////////////////////////////
+void BatchExecutor::RotateVectors(const Quaterniond &_q,
+    const Vector3d *_in, Vector3d *_out, size_t _n) const
+{
+  _q.RotateVectors(_in, _out, _n);
+}
+
+//////////////////////////////////////////////////
+void *BatchExecutor::AllocateBuffer(size_t _bytes) const
+{
+  if (_bytes == 0)
+    return nullptr;
+
+  // Over-allocate and stash the malloc pointer just below the aligned
+  // address, so FreeBuffer can recover it without any platform
+  // specific aligned allocation call.
+  void *raw = std::malloc(_bytes + kBufferAlignment + sizeof(void *));
+  if (!raw)
+    return nullptr;
+
+  uintptr_t aligned = reinterpret_cast<uintptr_t>(raw) + sizeof(void *);
+  aligned = (aligned + kBufferAlignment - 1) & ~(kBufferAlignment - 1);
+  reinterpret_cast<void **>(aligned)[-1] = raw;
+  return reinterpret_cast<void *>(aligned);
+}
+
+//////////////////////////////////////////////////
+void BatchExecutor::FreeBuffer(void *_ptr) const
+{
+  if (_ptr)
+    std::free(reinterpret_cast<void **>(_ptr)[-1]);
+}
+
+//////////////////////////////////////////////////
+BatchExecutor &BatchExecutor::Active()
+{
+  static BatchExecutor cpuDefault;
+  BatchExecutor *installed = gActiveExecutor.load(std::memory_order_acquire);
+  return installed ? *installed : cpuDefault;
+}
+
+//////////////////////////////////////////////////
+BatchExecutor *BatchExecutor::SetActive(BatchExecutor *_executor)
+{
+  return gActiveExecutor.exchange(_executor, std::memory_order_acq_rel);
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ignition/math/BatchExecutor.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+/// \brief Backend that counts dispatches and delegates to the CPU
+/// kernels, standing in for a device backend.
+class CountingExecutor : public math::BatchExecutor
+{
+  public: std::string Name() const override
+  {
+    return "counting";
+  }
+
+  public: void TransformPoints(const math::Matrix4d &_tf,
+      const math::Vector3d *_in, math::Vector3d *_out,
+      size_t _n) const override
+  {
+    ++this->transformCalls;
+    math::BatchExecutor::TransformPoints(_tf, _in, _out, _n);
+  }
+
+  public: void RotateVectors(const math::Quaterniond &_q,
+      const math::Vector3d *_in, math::Vector3d *_out,
+      size_t _n) const override
+  {
+    ++this->rotateCalls;
+    math::BatchExecutor::RotateVectors(_q, _in, _out, _n);
+  }
+
+  public: mutable int transformCalls{0};
+  public: mutable int rotateCalls{0};
+};
+
+/////////////////////////////////////////////////
+TEST(BatchExecutorTest, CpuDefault)
+{
+  math::BatchExecutor &exec = math::BatchExecutor::Active();
+  EXPECT_EQ("cpu", exec.Name());
+
+  const math::Matrix4d tf(math::Pose3d(1, -2, 3, 0.1, 0.2, 0.3));
+  const math::Quaterniond q(0.4, -0.2, 1.1);
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 100; ++i)
+    points.push_back(math::Vector3d(i * 0.5, -i * 0.25, i));
+
+  // The default backend produces exactly what the CPU kernels do.
+  std::vector<math::Vector3d> viaExec(points.size());
+  std::vector<math::Vector3d> viaCpu(points.size());
+  exec.TransformPoints(tf, points.data(), viaExec.data(), points.size());
+  tf.TransformPoints(points.data(), viaCpu.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(viaCpu[i], viaExec[i]) << i;
+
+  exec.RotateVectors(q, points.data(), viaExec.data(), points.size());
+  q.RotateVectors(points.data(), viaCpu.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(viaCpu[i], viaExec[i]) << i;
+}
+
+/////////////////////////////////////////////////
+TEST(BatchExecutorTest, InstallBackend)
+{
+  CountingExecutor counting;
+  EXPECT_EQ(nullptr, math::BatchExecutor::SetActive(&counting));
+  EXPECT_EQ("counting", math::BatchExecutor::Active().Name());
+
+  const math::Matrix4d tf = math::Matrix4d::Identity;
+  const math::Quaterniond q;
+  math::Vector3d point(1, 2, 3);
+  math::Vector3d out;
+
+  math::BatchExecutor::Active().TransformPoints(tf, &point, &out, 1);
+  EXPECT_EQ(point, out);
+  math::BatchExecutor::Active().RotateVectors(q, &point, &out, 1);
+  EXPECT_EQ(point, out);
+  EXPECT_EQ(1, counting.transformCalls);
+  EXPECT_EQ(1, counting.rotateCalls);
+
+  // Uninstalling restores the CPU default and returns the backend.
+  EXPECT_EQ(&counting, math::BatchExecutor::SetActive(nullptr));
+  EXPECT_EQ("cpu", math::BatchExecutor::Active().Name());
+}
+
+/////////////////////////////////////////////////
+TEST(BatchExecutorTest, Buffers)
+{
+  math::BatchExecutor &exec = math::BatchExecutor::Active();
+
+  EXPECT_EQ(nullptr, exec.AllocateBuffer(0));
+  exec.FreeBuffer(nullptr);
+
+  // Buffers are cache line aligned and fully usable.
+  for (size_t bytes : {1u, 63u, 64u, 1000u, 4096u})
+  {
+    void *buffer = exec.AllocateBuffer(bytes);
+    ASSERT_NE(nullptr, buffer) << bytes;
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffer) % 64) << bytes;
+    std::memset(buffer, 0xab, bytes);
+    exec.FreeBuffer(buffer);
+  }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/BoundsTracker.hh"
+
+#include <vector>
+
+using namespace ignition;
+using namespace math;
+
+/// \internal
+/// \brief Private data for the BoundsTracker class.
+class ignition::math::BoundsTrackerPrivate
+{
+  /// \brief Number of leaf slots; always a power of two (or zero
+  /// before the first Add).
+  public: size_t capacity = 0;
+
+  /// \brief Binary merge tree stored as a 1-indexed heap of
+  /// 2 * capacity nodes. Leaf _id lives at capacity + _id; node i
+  /// merges nodes 2i and 2i + 1. A default-constructed box is the
+  /// neutral element of Merge, so empty slots do not affect any
+  /// partial merge.
+  public: std::vector<AxisAlignedBox> tree;
+
+  /// \brief Whether each leaf slot holds a tracked member.
+  public: std::vector<bool> active;
+
+  /// \brief Leaf slots freed by Remove, reused by Add.
+  public: std::vector<size_t> freeSlots;
+
+  /// \brief Number of leaf slots handed out so far, including freed
+  /// ones.
+  public: size_t slotsUsed = 0;
+
+  /// \brief Recompute the partial merges from leaf _id up to the
+  /// root.
+  /// \param[in] _id The changed leaf slot.
+  public: void Propagate(const size_t _id)
+  {
+    for (size_t node = (this->capacity + _id) >> 1; node >= 1; node >>= 1)
+    {
+      this->tree[node] =
+          this->tree[2 * node] + this->tree[2 * node + 1];
+    }
+  }
+
+  /// \brief Grow the tree to _newCapacity leaves, keeping the existing
+  /// members and rebuilding every partial merge bottom-up.
+  /// \param[in] _newCapacity The new leaf count; a power of two larger
+  /// than the current capacity.
+  public: void Grow(const size_t _newCapacity)
+  {
+    std::vector<AxisAlignedBox> newTree(2 * _newCapacity);
+    for (size_t i = 0; i < this->capacity; ++i)
+      newTree[_newCapacity + i] = this->tree[this->capacity + i];
+    for (size_t i = _newCapacity - 1; i >= 1; --i)
+      newTree[i] = newTree[2 * i] + newTree[2 * i + 1];
+
+    this->tree.swap(newTree);
+    this->capacity = _newCapacity;
+    this->active.resize(_newCapacity, false);
+  }
+};
+
+//////////////////////////////////////////////////
+BoundsTracker::BoundsTracker()
+: dataPtr(new BoundsTrackerPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+BoundsTracker::~BoundsTracker()
+{
+}
+
+//////////////////////////////////////////////////
+size_t BoundsTracker::Add(const AxisAlignedBox &_box)
+{
+  size_t id;
+  if (!this->dataPtr->freeSlots.empty())
+  {
+    id = this->dataPtr->freeSlots.back();
+    this->dataPtr->freeSlots.pop_back();
+  }
+  else
+  {
+    if (this->dataPtr->slotsUsed == this->dataPtr->capacity)
+    {
+      this->dataPtr->Grow(
+          this->dataPtr->capacity == 0 ? 16 : 2 * this->dataPtr->capacity);
+    }
+    id = this->dataPtr->slotsUsed++;
+  }
+
+  this->dataPtr->active[id] = true;
+  this->dataPtr->tree[this->dataPtr->capacity + id] = _box;
+  this->dataPtr->Propagate(id);
+  return id;
+}
+
+//////////////////////////////////////////////////
+bool BoundsTracker::Update(const size_t _id, const AxisAlignedBox &_box)
+{
+  if (_id >= this->dataPtr->slotsUsed || !this->dataPtr->active[_id])
+    return false;
+
+  this->dataPtr->tree[this->dataPtr->capacity + _id] = _box;
+  this->dataPtr->Propagate(_id);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool BoundsTracker::Remove(const size_t _id)
+{
+  if (_id >= this->dataPtr->slotsUsed || !this->dataPtr->active[_id])
+    return false;
+
+  this->dataPtr->active[_id] = false;
+  this->dataPtr->freeSlots.push_back(_id);
+  this->dataPtr->tree[this->dataPtr->capacity + _id] = AxisAlignedBox();
+  this->dataPtr->Propagate(_id);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool BoundsTracker::Box(const size_t _id, AxisAlignedBox &_box) const
+{
+  if (_id >= this->dataPtr->slotsUsed || !this->dataPtr->active[_id])
+    return false;
+
+  _box = this->dataPtr->tree[this->dataPtr->capacity + _id];
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t BoundsTracker::Count() const
+{
+  return this->dataPtr->slotsUsed - this->dataPtr->freeSlots.size();
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBox BoundsTracker::Bounds() const
+{
+  if (this->dataPtr->capacity == 0)
+    return AxisAlignedBox();
+  return this->dataPtr->tree[1];
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/BoundsTracker.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+/// \brief Merge a set of boxes the brute-force way, for comparison.
+static math::AxisAlignedBox BruteForce(
+    const std::vector<math::AxisAlignedBox> &_boxes)
+{
+  math::AxisAlignedBox result;
+  for (const auto &box : _boxes)
+    result += box;
+  return result;
+}
+
+/////////////////////////////////////////////////
+TEST(BoundsTrackerTest, AddUpdateRemove)
+{
+  math::BoundsTracker tracker;
+  EXPECT_EQ(tracker.Count(), 0u);
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox());
+
+  size_t a = tracker.Add(math::AxisAlignedBox(0, 0, 0, 1, 1, 1));
+  size_t b = tracker.Add(math::AxisAlignedBox(2, 2, 2, 3, 3, 3));
+  EXPECT_EQ(tracker.Count(), 2u);
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox(0, 0, 0, 3, 3, 3));
+
+  // Moving one member both grows and shrinks the total bounds.
+  EXPECT_TRUE(tracker.Update(b, math::AxisAlignedBox(-5, 0, 0, -4, 1, 1)));
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox(-5, 0, 0, 1, 1, 1));
+
+  math::AxisAlignedBox box;
+  EXPECT_TRUE(tracker.Box(b, box));
+  EXPECT_EQ(box, math::AxisAlignedBox(-5, 0, 0, -4, 1, 1));
+
+  EXPECT_TRUE(tracker.Remove(b));
+  EXPECT_EQ(tracker.Count(), 1u);
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox(0, 0, 0, 1, 1, 1));
+
+  // Operations on removed or unknown ids are rejected.
+  EXPECT_FALSE(tracker.Remove(b));
+  EXPECT_FALSE(tracker.Update(b, math::AxisAlignedBox()));
+  EXPECT_FALSE(tracker.Box(b, box));
+  EXPECT_FALSE(tracker.Update(1000, math::AxisAlignedBox()));
+
+  // The freed id is reused.
+  size_t c = tracker.Add(math::AxisAlignedBox(0, 0, 4, 1, 1, 5));
+  EXPECT_EQ(c, b);
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox(0, 0, 0, 1, 1, 5));
+  EXPECT_TRUE(tracker.Remove(a));
+  EXPECT_EQ(tracker.Bounds(), math::AxisAlignedBox(0, 0, 4, 1, 1, 5));
+}
+
+/////////////////////////////////////////////////
+TEST(BoundsTrackerTest, MatchesBruteForce)
+{
+  // Enough members to force several rounds of tree growth, then
+  // scattered updates and removals; the tracked bounds must equal a
+  // full merge at every step.
+  math::BoundsTracker tracker;
+  std::vector<math::AxisAlignedBox> boxes;
+  std::vector<size_t> ids;
+
+  for (int i = 0; i < 300; ++i)
+  {
+    double x = 0.37 * i - 50.0;
+    double y = 0.11 * i * i - 300.0;
+    boxes.push_back(math::AxisAlignedBox(x, y, -i, x + 1, y + 2, -i + 1));
+    ids.push_back(tracker.Add(boxes.back()));
+    ASSERT_EQ(tracker.Bounds(), BruteForce(boxes));
+  }
+  EXPECT_EQ(tracker.Count(), 300u);
+
+  for (int i = 0; i < 300; i += 7)
+  {
+    boxes[i] = math::AxisAlignedBox(-i, i, 0, -i + 3, i + 3, 2);
+    ASSERT_TRUE(tracker.Update(ids[i], boxes[i]));
+    ASSERT_EQ(tracker.Bounds(), BruteForce(boxes));
+  }
+
+  for (int i = 299; i >= 0; i -= 3)
+  {
+    ASSERT_TRUE(tracker.Remove(ids[i]));
+    boxes.erase(boxes.begin() + i);
+    ASSERT_EQ(tracker.Bounds(), BruteForce(boxes));
+  }
+  EXPECT_EQ(tracker.Count(), boxes.size());
+}
@@ -136,3 +136,71 @@ TEST(BoxTest, Mass)
   EXPECT_EQ(expectedMassMat, massMat);
   EXPECT_DOUBLE_EQ(expectedMassMat.Mass(), massMat.Mass());
 }
+
+/////////////////////////////////////////////////
+TEST(BoxTest, AxisAlignedBoundingBox)
+{
+  math::Boxd box(2.0, 4.0, 6.0);
+
+  math::AxisAlignedBox aabb = box.AxisAlignedBoundingBox();
+  EXPECT_EQ(aabb.Min(), math::Vector3d(-1, -2, -3));
+  EXPECT_EQ(aabb.Max(), math::Vector3d(1, 2, 3));
+
+  // A yaw of ninety degrees swaps the x and y extents.
+  aabb = box.AxisAlignedBoundingBox(math::Pose3d(0, 0, 0, 0, 0, IGN_PI_2));
+  EXPECT_EQ(aabb.Min(), math::Vector3d(-2, -1, -3));
+  EXPECT_EQ(aabb.Max(), math::Vector3d(2, 1, 3));
+
+  // The box of an arbitrary pose is the tight bound of the eight
+  // rotated corners.
+  const math::Pose3d pose(1, -2, 3, 0.4, -0.5, 0.6);
+  aabb = box.AxisAlignedBoundingBox(pose);
+  math::Vector3d min(math::MAX_D, math::MAX_D, math::MAX_D);
+  math::Vector3d max = -min;
+  for (const double x : {-1.0, 1.0})
+  {
+    for (const double y : {-2.0, 2.0})
+    {
+      for (const double z : {-3.0, 3.0})
+      {
+        const math::Vector3d corner =
+            pose.Rot().RotateVector(math::Vector3d(x, y, z)) + pose.Pos();
+        min.Min(corner);
+        max.Max(corner);
+      }
+    }
+  }
+  EXPECT_EQ(aabb.Min(), min);
+  EXPECT_EQ(aabb.Max(), max);
+
+  const math::Boxd boxes[2] =
+      {math::Boxd(1.0, 1.0, 1.0), math::Boxd(2.0, 3.0, 4.0)};
+  const math::Pose3d poses[2] =
+      {math::Pose3d(5, 0, 0, 0, 0, 0), pose};
+  math::AxisAlignedBox aabbs[2];
+  math::Boxd::AxisAlignedBoundingBoxBatch(boxes, poses, 2, aabbs);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_EQ(aabbs[i], boxes[i].AxisAlignedBoundingBox(poses[i]));
+}
+
+/////////////////////////////////////////////////
+TEST(BoxTest, SupportPoint)
+{
+  math::Boxd box(2.0, 4.0, 6.0);
+
+  EXPECT_EQ(box.SupportPoint(math::Vector3d(1, -2, 0.5)),
+      math::Vector3d(1, -2, 3));
+  EXPECT_EQ(box.SupportPoint(math::Vector3d(-1, -1, -1)),
+      math::Vector3d(-1, -2, -3));
+
+  // Zero direction components pick the positive face.
+  EXPECT_EQ(box.SupportPoint(math::Vector3d::Zero),
+      math::Vector3d(1, 2, 3));
+
+  const math::Vector3d dirs[3] = {math::Vector3d(1, 0, 0),
+      math::Vector3d(-2, 5, 1), math::Vector3d(0, 0, -1)};
+  math::Vector3d points[3];
+  box.SupportPointBatch(dirs, 3, points);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(points[i], box.SupportPoint(dirs[i]));
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/CachedTransform.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(CachedTransformTest, CachedQueries)
+{
+  math::CachedTransformd cached;
+  EXPECT_EQ(math::Matrix4d::Identity, cached.Matrix());
+  EXPECT_EQ(math::Matrix4d::Identity, cached.Inverse());
+  EXPECT_DOUBLE_EQ(1.0, cached.Determinant());
+  EXPECT_EQ(0u, cached.Version());
+
+  math::Matrix4d mat(math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+  cached.SetMatrix(mat);
+  EXPECT_EQ(1u, cached.Version());
+  EXPECT_EQ(mat.Inverse(), cached.Inverse());
+  EXPECT_DOUBLE_EQ(mat.Determinant(), cached.Determinant());
+
+  // Repeated queries answer from the cache and agree with the eager
+  // computation.
+  EXPECT_EQ(cached.Inverse(), cached.Inverse());
+  EXPECT_DOUBLE_EQ(cached.Determinant(), cached.Determinant());
+  EXPECT_EQ(1u, cached.Version());
+}
+
+/////////////////////////////////////////////////
+TEST(CachedTransformTest, Invalidation)
+{
+  math::Matrix4d scale;
+  scale = math::Matrix4d::Identity;
+  scale.Scale(2, 2, 2);
+
+  math::CachedTransformd cached(scale);
+  EXPECT_DOUBLE_EQ(8.0, cached.Determinant());
+
+  // Every mutator drops the cache and bumps the version.
+  cached.SetPose(math::Pose3d(4, 5, 6, 0, 0, IGN_PI_2));
+  EXPECT_EQ(1u, cached.Version());
+  math::Matrix4d expected(math::Pose3d(4, 5, 6, 0, 0, IGN_PI_2));
+  EXPECT_EQ(expected, cached.Matrix());
+  EXPECT_EQ(expected.Inverse(), cached.Inverse());
+  EXPECT_NEAR(1.0, cached.Determinant(), 1e-12);
+
+  cached.SetMatrix(math::Matrix4d::Identity);
+  EXPECT_EQ(2u, cached.Version());
+  EXPECT_EQ(math::Matrix4d::Identity, cached.Inverse());
+  EXPECT_DOUBLE_EQ(1.0, cached.Determinant());
+}
+
+/////////////////////////////////////////////////
+TEST(CachedTransformTest, PoseConstructor)
+{
+  math::Pose3d pose(1, -2, 0.5, 0.3, -0.2, 0.1);
+  math::CachedTransformd cached(pose);
+  EXPECT_EQ(math::Matrix4d(pose), cached.Matrix());
+
+  // Inverting the cached transform undoes the pose.
+  math::Vector3d p(3, 4, 5);
+  math::Vector3d there = cached.Matrix() * p;
+  math::Vector3d back = cached.Inverse() * there;
+  EXPECT_NEAR(p.X(), back.X(), 1e-12);
+  EXPECT_NEAR(p.Y(), back.Y(), 1e-12);
+  EXPECT_NEAR(p.Z(), back.Z(), 1e-12);
+}
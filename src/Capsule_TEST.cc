@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "ignition/math/Capsule.hh"
 #include "ignition/math/Helpers.hh"
@@ -128,3 +129,102 @@ TEST(CapsuleTest, Mass)
   EXPECT_EQ(expectedMassMat.DiagonalMoments(), massMat->DiagonalMoments());
   EXPECT_DOUBLE_EQ(expectedMassMat.Mass(), massMat->Mass());
 }
+
+//////////////////////////////////////////////////
+TEST(CapsuleTest, BatchEvaluation)
+{
+  std::vector<math::Capsuled> capsules;
+  capsules.push_back(math::Capsuled(2.0, 0.5,
+        math::Material(math::MaterialType::WOOD)));
+  capsules.push_back(math::Capsuled(1.0, 0.0));
+  capsules.push_back(math::Capsuled(3.0, 0.25,
+        math::Material(math::MaterialType::IRON)));
+
+  std::vector<math::MassMatrix3d> massMats(capsules.size());
+  std::vector<uint8_t> valid(capsules.size(), 2);
+  math::Capsuled::MassMatrixBatch(capsules.data(), capsules.size(),
+      massMats.data(), valid.data());
+
+  std::vector<double> masses = {2.0, 2.0, -5.0};
+  std::vector<double> densities(capsules.size());
+  math::Capsuled::DensityFromMassBatch(capsules.data(), masses.data(),
+      densities.data(), capsules.size());
+
+  for (size_t i = 0; i < capsules.size(); ++i)
+  {
+    const auto expected = capsules[i].MassMatrix();
+    EXPECT_EQ(expected.has_value() ? 1 : 0, valid[i]) << i;
+    if (expected)
+    {
+      EXPECT_EQ(*expected, massMats[i]) << i;
+    }
+    const double expectedDensity = capsules[i].DensityFromMass(masses[i]);
+    if (std::isnan(expectedDensity))
+    {
+      EXPECT_TRUE(std::isnan(densities[i])) << i;
+    }
+    else
+    {
+      EXPECT_DOUBLE_EQ(expectedDensity, densities[i]) << i;
+    }
+  }
+
+  // The cached volume follows radius and length changes.
+  math::Capsuled capsule(2.0, 0.5);
+  const double volume = capsule.Volume();
+  EXPECT_DOUBLE_EQ(volume, capsule.Volume());
+  capsule.SetLength(3.0);
+  EXPECT_DOUBLE_EQ(capsule.Volume(),
+      IGN_PI * 0.25 * (3.0 + 4.0 / 3.0 * 0.5));
+  capsule.SetRadius(1.0);
+  EXPECT_DOUBLE_EQ(capsule.Volume(), IGN_PI * (3.0 + 4.0 / 3.0));
+}
+
+/////////////////////////////////////////////////
+TEST(CapsuleTest, AxisAlignedBoundingBox)
+{
+  math::Capsuled capsule(4.0, 1.0);
+
+  // The caps extend the box one radius past the cylindrical section.
+  math::AxisAlignedBox box = capsule.AxisAlignedBoundingBox();
+  EXPECT_EQ(box.Min(), math::Vector3d(-1, -1, -3));
+  EXPECT_EQ(box.Max(), math::Vector3d(1, 1, 3));
+
+  // A pitch of ninety degrees lays the capsule along the x axis.
+  box = capsule.AxisAlignedBoundingBox(
+      math::Pose3d(1, 2, 3, 0, IGN_PI_2, 0));
+  EXPECT_EQ(box.Min(), math::Vector3d(-2, 1, 2));
+  EXPECT_EQ(box.Max(), math::Vector3d(4, 3, 4));
+
+  const math::Capsuled capsules[2] =
+      {capsule, math::Capsuled(2.0, 0.5)};
+  const math::Pose3d poses[2] =
+      {math::Pose3d(1, 2, 3, 0, 0, 0), math::Pose3d(0, 0, 0, 0.3, 0.2, 0.1)};
+  math::AxisAlignedBox boxes[2];
+  math::Capsuled::AxisAlignedBoundingBoxBatch(capsules, poses, 2, boxes);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_EQ(boxes[i], capsules[i].AxisAlignedBoundingBox(poses[i]));
+}
+
+/////////////////////////////////////////////////
+TEST(CapsuleTest, SupportPoint)
+{
+  math::Capsuled capsule(4.0, 1.0);
+
+  // The support point is on the cap sphere nearest the direction.
+  EXPECT_EQ(capsule.SupportPoint(math::Vector3d(0, 0, 1)),
+      math::Vector3d(0, 0, 3));
+  EXPECT_EQ(capsule.SupportPoint(math::Vector3d(1, 0, 0)),
+      math::Vector3d(1, 0, 2));
+  EXPECT_EQ(capsule.SupportPoint(math::Vector3d(0, 3, 4)),
+      math::Vector3d(0, 0.6, 2.8));
+  EXPECT_EQ(capsule.SupportPoint(math::Vector3d::Zero),
+      math::Vector3d(0, 0, 2));
+
+  const math::Vector3d dirs[3] = {math::Vector3d(1, 0, 0),
+      math::Vector3d(-2, 5, 1), math::Vector3d(0, 0, -1)};
+  math::Vector3d points[3];
+  capsule.SupportPointBatch(dirs, 3, points);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(points[i], capsule.SupportPoint(dirs[i]));
+}
@@ -22,6 +22,33 @@
 using namespace ignition;
 using namespace math;
 
+namespace
+{
+  /// \brief Branch-free HSV to RGB conversion of one channel.
+  /// \param[in] _n Channel phase: 5 for red, 3 for green, 1 for blue.
+  /// \param[in] _h Hue divided by 60, in [0, 6).
+  /// \param[in] _s Saturation.
+  /// \param[in] _v Value.
+  /// \return The channel intensity in [0, 1].
+  inline float HsvChannel(const float _n, const float _h, const float _s,
+      const float _v)
+  {
+    const float k = std::fmod(_n + _h, 6.0f);
+    const float m = std::min(std::min(k, 4.0f - k), 1.0f);
+    return _v - _v * _s * std::max(0.0f, m);
+  }
+
+  /// \brief Reduce a hue to [0, 6) the same way SetFromHSV does:
+  /// negative hues collapse to zero and whole degrees wrap at 360.
+  /// \param[in] _h Hue in degrees.
+  /// \return Hue divided by 60.
+  inline float WrapHue(const float _h)
+  {
+    return static_cast<float>(
+        static_cast<int>(_h < 0 ? 0 : _h) % 360) / 60.0f;
+  }
+}
+
 const Color Color::White = Color(1, 1, 1, 1);
 const Color Color::Black = Color(0, 0, 0, 1);
 const Color Color::Red = Color(1, 0, 0, 1);
@@ -164,6 +191,71 @@ Vector3f Color::HSV() const
   return hsv;
 }
 
+//////////////////////////////////////////////////
+void Color::BatchFromHSV(const Vector3f *_hsv, Color *_colors,
+    size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const float h = WrapHue(_hsv[i].X());
+    const float s = _hsv[i].Y();
+    const float v = _hsv[i].Z();
+    _colors[i].Set(
+        HsvChannel(5.0f, h, s, v),
+        HsvChannel(3.0f, h, s, v),
+        HsvChannel(1.0f, h, s, v));
+  }
+}
+
+//////////////////////////////////////////////////
+void Color::BatchFromHSV(const Vector3f *_hsv, RGBA *_rgba, size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const float h = WrapHue(_hsv[i].X());
+    const float s = _hsv[i].Y();
+    const float v = _hsv[i].Z();
+    const float r =
+        std::min(std::max(HsvChannel(5.0f, h, s, v), 0.0f), 1.0f);
+    const float g =
+        std::min(std::max(HsvChannel(3.0f, h, s, v), 0.0f), 1.0f);
+    const float b =
+        std::min(std::max(HsvChannel(1.0f, h, s, v), 0.0f), 1.0f);
+
+    _rgba[i] = (static_cast<RGBA>(static_cast<uint8_t>(r * 255)) << 24) +
+               (static_cast<RGBA>(static_cast<uint8_t>(g * 255)) << 16) +
+               (static_cast<RGBA>(static_cast<uint8_t>(b * 255)) << 8) +
+               255u;
+  }
+}
+
+//////////////////////////////////////////////////
+void Color::BatchToHSV(const Color *_colors, Vector3f *_hsv, size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const float r = _colors[i].r;
+    const float g = _colors[i].g;
+    const float b = _colors[i].b;
+
+    const float min = std::min(r, std::min(g, b));
+    const float max = std::max(r, std::max(g, b));
+    const float delta = max - min;
+
+    // Same select structure as HSV(), written without early returns so
+    // the loop stays straight-line.
+    const bool grey = equal(delta, 0.0f);
+    const float hue = grey ? -1.0f :
+        equal(r, min) ? 3.0f - ((g - b) / delta) :
+        equal(g, min) ? 5.0f - ((b - r) / delta) :
+                        1.0f - ((r - g) / delta);
+
+    _hsv[i].X() = hue;
+    _hsv[i].Y() = grey ? 0.0f : delta / max;
+    _hsv[i].Z() = max;
+  }
+}
+
 //////////////////////////////////////////////////
 Vector3f Color::YUV() const
 {
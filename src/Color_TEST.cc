@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include <ignition/math/Color.hh>
 
 using namespace ignition;
@@ -201,7 +202,6 @@ TEST(Color, Color)
   clr += math::Color(0.2f, 0.2f, 0.2f, 0.2f);
   EXPECT_TRUE(clr == math::Color(0.3f, 0.4f, 0.5f, 0.6f));
 
-
   clr.Set(0.1f, 0.2f, 0.3f, 0.4f);
   clr = clr - 0.1f;
   EXPECT_TRUE(clr == math::Color(0.0f, 0.1f, 0.2f, 0.3f));
@@ -210,7 +210,6 @@ TEST(Color, Color)
   clr -= math::Color(0.1f, 0.1f, 0.1f, 0.1f);
   EXPECT_TRUE(clr == math::Color(0.0f, 0.1f, 0.2f, 0.3f));
 
-
   clr.Set(1.f, 1.f, 1.f, 1.f);
   clr = clr / 1.6f;
   EXPECT_TRUE(clr == math::Color(0.625f, 0.625f, 0.625f, 0.625f));
@@ -219,7 +218,6 @@ TEST(Color, Color)
   clr /= math::Color(1.f, 1.f, 1.f, 1.f);
   EXPECT_TRUE(clr == math::Color(1.f, 1.f, 1.f, 1.f));
 
-
   clr.Set(.1f, .2f, .3f, .4f);
   clr = clr * .1f;
   EXPECT_TRUE(clr == math::Color(0.01f, 0.02f, 0.03f, 0.04f));
@@ -228,7 +226,6 @@ TEST(Color, Color)
   clr *= math::Color(0.1f, 0.1f, 0.1f, 0.1f);
   EXPECT_TRUE(clr == math::Color(0.01f, 0.02f, 0.03f, 0.04f));
 
-
   clr.SetFromYUV(0.5f, 0.2f, 0.8f);
   EXPECT_TRUE(math::equal(0.00553f, clr.R(), 1e-3f));
   EXPECT_TRUE(math::equal(0.0f, clr.G()));
@@ -258,7 +255,6 @@ TEST(Color, Color)
   EXPECT_TRUE(math::equal(0.3f, clr.A()));
 }
 
-
 /////////////////////////////////////////////////
 TEST(Color, MulOp)
 {
@@ -408,6 +404,50 @@ TEST(Color, HSV)
   EXPECT_NEAR(clr.A(), 1.0, 1e-3);
 }
 
+/////////////////////////////////////////////////
+TEST(Color, BatchHSV)
+{
+  // A hue/saturation/value sweep covering all six sectors, the grey
+  // special case and a negative hue.
+  std::vector<math::Vector3f> hsv;
+  for (float h = -30; h < 360; h += 30)
+  {
+    hsv.push_back(math::Vector3f(h, 1.0f, 1.0f));
+    hsv.push_back(math::Vector3f(h, 0.5f, 0.75f));
+    hsv.push_back(math::Vector3f(h, 0.0f, 0.4f));
+  }
+
+  std::vector<math::Color> batch(hsv.size());
+  math::Color::BatchFromHSV(hsv.data(), batch.data(), hsv.size());
+
+  for (size_t i = 0; i < hsv.size(); ++i)
+  {
+    math::Color expected;
+    expected.SetFromHSV(hsv[i].X(), hsv[i].Y(), hsv[i].Z());
+    EXPECT_NEAR(expected.R(), batch[i].R(), 1e-6) << "entry " << i;
+    EXPECT_NEAR(expected.G(), batch[i].G(), 1e-6) << "entry " << i;
+    EXPECT_NEAR(expected.B(), batch[i].B(), 1e-6) << "entry " << i;
+    EXPECT_FLOAT_EQ(1.0f, batch[i].A());
+  }
+
+  // Packed RGBA8 output matches AsRGBA() with full alpha.
+  std::vector<math::Color::RGBA> packed(hsv.size());
+  math::Color::BatchFromHSV(hsv.data(), packed.data(), hsv.size());
+  for (size_t i = 0; i < hsv.size(); ++i)
+    EXPECT_EQ(batch[i].AsRGBA(), packed[i]) << "entry " << i;
+
+  // BatchToHSV matches the scalar HSV() conversion.
+  std::vector<math::Vector3f> back(batch.size());
+  math::Color::BatchToHSV(batch.data(), back.data(), batch.size());
+  for (size_t i = 0; i < batch.size(); ++i)
+  {
+    math::Vector3f expected = batch[i].HSV();
+    EXPECT_NEAR(expected.X(), back[i].X(), 1e-5) << "entry " << i;
+    EXPECT_NEAR(expected.Y(), back[i].Y(), 1e-5) << "entry " << i;
+    EXPECT_NEAR(expected.Z(), back[i].Z(), 1e-5) << "entry " << i;
+  }
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/CullingSession.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Vector3.hh>
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief Number of boxes per group. Large enough that the group
+  /// tests amortize, small enough that boundary groups stay cheap.
+  const size_t kGroupSize = 64;
+
+  /// \brief Morton code of a point normalized to [0, 1]^3.
+  uint32_t MortonCode(const Vector3d &_p)
+  {
+    auto quantize = [](double _c)
+    {
+      return static_cast<uint32_t>(
+          std::min(std::max(_c * 1024.0, 0.0), 1023.0));
+    };
+    return mortonEncode3d(
+        quantize(_p.X()), quantize(_p.Y()), quantize(_p.Z()));
+  }
+
+  /// \brief One spatially coherent block of boxes.
+  struct CullingGroup
+  {
+    /// \brief Merged bounds of the member boxes; conservative after
+    /// UpdateBox calls.
+    public: AxisAlignedBox bounds;
+
+    /// \brief First member in the session's order array.
+    public: size_t first{0};
+
+    /// \brief Number of members.
+    public: size_t count{0};
+
+    /// \brief Plane that rejected this group's bounds last frame.
+    public: uint8_t lastPlane{0};
+  };
+}
+
+/// \internal
+/// \brief Private data for the CullingSession class.
+class ignition::math::CullingSessionPrivate
+{
+  /// \brief The stored boxes, indexed as passed to SetBoxes().
+  public: std::vector<AxisAlignedBox> boxes;
+
+  /// \brief Box indices in Morton order; groups reference ranges of
+  /// this array.
+  public: std::vector<size_t> order;
+
+  /// \brief Group index of each box.
+  public: std::vector<size_t> groupOf;
+
+  /// \brief The groups, covering order front to back.
+  public: std::vector<CullingGroup> groups;
+
+  /// \brief Plane that rejected each box last frame.
+  public: std::vector<uint8_t> lastPlane;
+};
+
+//////////////////////////////////////////////////
+CullingSession::CullingSession()
+: dataPtr(new CullingSessionPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+CullingSession::~CullingSession()
+{
+}
+
+//////////////////////////////////////////////////
+void CullingSession::SetBoxes(const AxisAlignedBox *_boxes,
+    const size_t _count)
+{
+  this->dataPtr->boxes.assign(_boxes, _boxes + _count);
+  this->dataPtr->order.resize(_count);
+  this->dataPtr->groupOf.resize(_count);
+  this->dataPtr->groups.clear();
+  this->dataPtr->lastPlane.assign(_count, 0);
+
+  if (_count == 0)
+    return;
+
+  // Normalize the box centers into the scene bounds and sort the
+  // indices along the Z-order curve, so consecutive groups are
+  // spatially compact and tend to share a culling fate.
+  AxisAlignedBox scene;
+  for (size_t i = 0; i < _count; ++i)
+    scene.Merge(_boxes[i]);
+
+  const Vector3d sceneMin = scene.Min();
+  const Vector3d sceneSize = scene.Size();
+  const Vector3d invSize(
+      sceneSize.X() > 0 ? 1.0 / sceneSize.X() : 0.0,
+      sceneSize.Y() > 0 ? 1.0 / sceneSize.Y() : 0.0,
+      sceneSize.Z() > 0 ? 1.0 / sceneSize.Z() : 0.0);
+
+  std::vector<uint32_t> codes(_count);
+  for (size_t i = 0; i < _count; ++i)
+  {
+    this->dataPtr->order[i] = i;
+    codes[i] = MortonCode((_boxes[i].Center() - sceneMin) * invSize);
+  }
+
+  std::sort(this->dataPtr->order.begin(), this->dataPtr->order.end(),
+      [&codes](size_t _a, size_t _b)
+      {
+        return codes[_a] < codes[_b];
+      });
+
+  for (size_t first = 0; first < _count; first += kGroupSize)
+  {
+    CullingGroup group;
+    group.first = first;
+    group.count = std::min(kGroupSize, _count - first);
+    for (size_t i = 0; i < group.count; ++i)
+    {
+      const size_t boxIndex = this->dataPtr->order[first + i];
+      group.bounds.Merge(_boxes[boxIndex]);
+      this->dataPtr->groupOf[boxIndex] = this->dataPtr->groups.size();
+    }
+    this->dataPtr->groups.push_back(group);
+  }
+}
+
+//////////////////////////////////////////////////
+size_t CullingSession::Count() const
+{
+  return this->dataPtr->boxes.size();
+}
+
+//////////////////////////////////////////////////
+bool CullingSession::UpdateBox(const size_t _index,
+    const AxisAlignedBox &_box)
+{
+  if (_index >= this->dataPtr->boxes.size())
+    return false;
+
+  this->dataPtr->boxes[_index] = _box;
+  this->dataPtr->groups[this->dataPtr->groupOf[_index]].bounds.Merge(_box);
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t CullingSession::Cull(const Frustum &_frustum, uint8_t *_results)
+{
+  // Load the plane parameters once, as in Frustum::ContainsBatch.
+  Vector3d normals[6];
+  double offsets[6];
+  for (int p = 0; p < 6; ++p)
+  {
+    const Planed plane = _frustum.Plane(
+        static_cast<Frustum::FrustumPlane>(p));
+    normals[p] = plane.Normal();
+    offsets[p] = plane.Offset();
+  }
+
+  // Signed distance of a box center to a plane, and the projection
+  // radius of the box onto the plane normal.
+  auto planeTest = [&](const AxisAlignedBox &_box, const int _plane,
+      double &_dist, double &_radius)
+  {
+    _dist = normals[_plane].Dot(_box.Center()) - offsets[_plane];
+    _radius = normals[_plane].AbsDot(_box.Size() / 2.0);
+  };
+
+  size_t visible = 0;
+  for (auto &group : this->dataPtr->groups)
+  {
+    // Test the group bounds first, starting with the plane that
+    // rejected them last frame. Record the planes the bounds straddle:
+    // members can only change state on those.
+    uint8_t straddleMask = 0;
+    bool groupRejected = false;
+    for (int p = 0; p < 6 && !groupRejected; ++p)
+    {
+      const int plane = (group.lastPlane + p) % 6;
+      double dist, radius;
+      planeTest(group.bounds, plane, dist, radius);
+      if (dist < -radius)
+      {
+        groupRejected = true;
+        group.lastPlane = static_cast<uint8_t>(plane);
+      }
+      else if (dist <= radius)
+      {
+        straddleMask |= static_cast<uint8_t>(1 << plane);
+      }
+    }
+
+    if (groupRejected)
+    {
+      for (size_t i = 0; i < group.count; ++i)
+        _results[this->dataPtr->order[group.first + i]] = 0;
+      continue;
+    }
+
+    if (straddleMask == 0)
+    {
+      // The group bounds are entirely inside; so is every member.
+      for (size_t i = 0; i < group.count; ++i)
+        _results[this->dataPtr->order[group.first + i]] = 1;
+      visible += group.count;
+      continue;
+    }
+
+    // Boundary group: test each member, but only against the planes
+    // the group straddles, cached rejector first.
+    for (size_t i = 0; i < group.count; ++i)
+    {
+      const size_t boxIndex = this->dataPtr->order[group.first + i];
+      const AxisAlignedBox &box = this->dataPtr->boxes[boxIndex];
+      const int cached = this->dataPtr->lastPlane[boxIndex];
+
+      int overlapping = 0;
+      bool rejected = false;
+      for (int p = 0; p < 6 && !rejected; ++p)
+      {
+        const int plane = (cached + p) % 6;
+        if (!(straddleMask & (1 << plane)))
+          continue;
+
+        double dist, radius;
+        planeTest(box, plane, dist, radius);
+        if (dist < -radius)
+        {
+          rejected = true;
+          this->dataPtr->lastPlane[boxIndex] =
+              static_cast<uint8_t>(plane);
+        }
+        else if (dist <= radius)
+        {
+          ++overlapping;
+        }
+      }
+
+      if (rejected)
+      {
+        _results[boxIndex] = 0;
+      }
+      else if (overlapping < 2)
+      {
+        _results[boxIndex] = 1;
+        ++visible;
+      }
+      else
+      {
+        // Boxes straddling several planes need the exact corner and
+        // edge checks; defer to the scalar test.
+        _results[boxIndex] = _frustum.Contains(box) ? 1 : 0;
+        visible += _results[boxIndex];
+      }
+    }
+  }
+  return visible;
+}
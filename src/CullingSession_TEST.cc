@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/CullingSession.hh"
+#include "ignition/math/Rand.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(CullingSessionTest, Empty)
+{
+  math::CullingSession session;
+  EXPECT_EQ(session.Count(), 0u);
+
+  math::Frustum frustum;
+  EXPECT_EQ(session.Cull(frustum, nullptr), 0u);
+  EXPECT_FALSE(session.UpdateBox(0, math::AxisAlignedBox()));
+}
+
+/////////////////////////////////////////////////
+TEST(CullingSessionTest, MatchesContains)
+{
+  // A cloud of boxes around the frustum; the session must agree with
+  // the scalar test for every box, frame after frame.
+  math::Rand::Seed(42);
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int i = 0; i < 500; ++i)
+  {
+    const math::Vector3d center(
+        math::Rand::DblUniform(-15, 25),
+        math::Rand::DblUniform(-20, 20),
+        math::Rand::DblUniform(-20, 20));
+    const math::Vector3d half(
+        math::Rand::DblUniform(0.1, 2),
+        math::Rand::DblUniform(0.1, 2),
+        math::Rand::DblUniform(0.1, 2));
+    boxes.push_back(math::AxisAlignedBox(center - half, center + half));
+  }
+
+  math::CullingSession session;
+  session.SetBoxes(boxes.data(), boxes.size());
+  EXPECT_EQ(session.Count(), boxes.size());
+
+  math::Frustum frustum(math::Frustum(1.0, 20.0,
+      math::Angle(IGN_PI * 0.4), 1.5));
+
+  std::vector<uint8_t> results(boxes.size());
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    // The camera pans a little each frame, as an editor camera would.
+    frustum.SetPose(math::Pose3d(0, 0.1 * frame, 0, 0, 0, 0.02 * frame));
+
+    const size_t visible = session.Cull(frustum, results.data());
+    size_t expectedVisible = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+      const bool expected = frustum.Contains(boxes[i]);
+      EXPECT_EQ(results[i] != 0, expected) << "frame " << frame
+          << " box " << i;
+      expectedVisible += expected;
+    }
+    EXPECT_EQ(visible, expectedVisible) << "frame " << frame;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(CullingSessionTest, UpdateBox)
+{
+  // A grid of small boxes; move a few of them across the frustum
+  // boundary between culls.
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int x = -10; x < 10; ++x)
+  {
+    for (int y = -10; y < 10; ++y)
+    {
+      boxes.push_back(math::AxisAlignedBox(
+          math::Vector3d(x, y, -0.5), math::Vector3d(x + 0.5, y + 0.5, 0.5)));
+    }
+  }
+
+  math::CullingSession session;
+  session.SetBoxes(boxes.data(), boxes.size());
+
+  const math::Frustum frustum(math::Frustum(1.0, 8.0,
+      math::Angle(IGN_PI * 0.4), 1.0));
+
+  std::vector<uint8_t> results(boxes.size());
+  session.Cull(frustum, results.data());
+
+  // Teleport every 17th box somewhere new and verify the next cull
+  // still matches the scalar test for all boxes.
+  for (size_t i = 0; i < boxes.size(); i += 17)
+  {
+    const double shift = (i % 2 == 0) ? 30.0 : -3.0;
+    boxes[i] = math::AxisAlignedBox(
+        boxes[i].Min() + math::Vector3d(shift, 0, 0),
+        boxes[i].Max() + math::Vector3d(shift, 0, 0));
+    EXPECT_TRUE(session.UpdateBox(i, boxes[i]));
+  }
+  EXPECT_FALSE(session.UpdateBox(boxes.size(), boxes[0]));
+
+  const size_t visible = session.Cull(frustum, results.data());
+  size_t expectedVisible = 0;
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    const bool expected = frustum.Contains(boxes[i]);
+    EXPECT_EQ(results[i] != 0, expected) << "box " << i;
+    expectedVisible += expected;
+  }
+  EXPECT_EQ(visible, expectedVisible);
+}
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "ignition/math/Cylinder.hh"
 
@@ -138,3 +139,108 @@ TEST(CylinderTest, Mass)
   EXPECT_EQ(expectedMassMat, massMat);
   EXPECT_DOUBLE_EQ(expectedMassMat.Mass(), massMat.Mass());
 }
+
+//////////////////////////////////////////////////
+TEST(CylinderTest, BatchEvaluation)
+{
+  std::vector<math::Cylinderd> cylinders;
+  cylinders.push_back(math::Cylinderd(2.0, 0.5,
+        math::Material(math::MaterialType::WOOD)));
+  cylinders.push_back(math::Cylinderd(0.0, 1.0));
+  cylinders.push_back(math::Cylinderd(1.5, 0.25,
+        math::Material(math::MaterialType::STEEL_ALLOY)));
+
+  std::vector<math::MassMatrix3d> massMats(cylinders.size());
+  std::vector<uint8_t> valid(cylinders.size(), 2);
+  math::Cylinderd::MassMatrixBatch(cylinders.data(), cylinders.size(),
+      massMats.data(), valid.data());
+
+  std::vector<double> masses = {3.0, 3.0, 0.0};
+  std::vector<double> densities(cylinders.size());
+  math::Cylinderd::DensityFromMassBatch(cylinders.data(), masses.data(),
+      densities.data(), cylinders.size());
+
+  for (size_t i = 0; i < cylinders.size(); ++i)
+  {
+    math::MassMatrix3d expected;
+    const bool ok = cylinders[i].MassMatrix(expected);
+    EXPECT_EQ(ok ? 1 : 0, valid[i]) << i;
+    if (ok)
+    {
+      EXPECT_EQ(expected, massMats[i]) << i;
+    }
+    EXPECT_DOUBLE_EQ(cylinders[i].DensityFromMass(masses[i]),
+        densities[i]) << i;
+  }
+
+  // The cached volume follows radius and length changes.
+  math::Cylinderd cylinder(2.0, 0.5);
+  const double volume = cylinder.Volume();
+  EXPECT_DOUBLE_EQ(volume, cylinder.Volume());
+  cylinder.SetLength(4.0);
+  EXPECT_DOUBLE_EQ(2.0 * volume, cylinder.Volume());
+  cylinder.SetRadius(1.0);
+  EXPECT_DOUBLE_EQ(8.0 * volume, cylinder.Volume());
+}
+
+/////////////////////////////////////////////////
+TEST(CylinderTest, AxisAlignedBoundingBox)
+{
+  math::Cylinderd cylinder(4.0, 1.0);
+
+  math::AxisAlignedBox box = cylinder.AxisAlignedBoundingBox();
+  EXPECT_EQ(box.Min(), math::Vector3d(-1, -1, -2));
+  EXPECT_EQ(box.Max(), math::Vector3d(1, 1, 2));
+
+  // A pitch of ninety degrees lays the cylinder along the x axis.
+  box = cylinder.AxisAlignedBoundingBox(
+      math::Pose3d(0, 0, 0, 0, IGN_PI_2, 0));
+  EXPECT_EQ(box.Min(), math::Vector3d(-2, -1, -1));
+  EXPECT_EQ(box.Max(), math::Vector3d(2, 1, 1));
+
+  // The rotational offset tilts the axis even at an identity pose.
+  math::Cylinderd offset(4.0, 1.0,
+      math::Quaterniond(0, IGN_PI_2, 0));
+  box = offset.AxisAlignedBoundingBox();
+  EXPECT_EQ(box.Min(), math::Vector3d(-2, -1, -1));
+  EXPECT_EQ(box.Max(), math::Vector3d(2, 1, 1));
+
+  const math::Cylinderd cylinders[2] = {cylinder, offset};
+  const math::Pose3d poses[2] =
+      {math::Pose3d(1, 2, 3, 0, 0, 0), math::Pose3d(0, 0, 0, 0.3, 0.2, 0.1)};
+  math::AxisAlignedBox boxes[2];
+  math::Cylinderd::AxisAlignedBoundingBoxBatch(cylinders, poses, 2, boxes);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_EQ(boxes[i], cylinders[i].AxisAlignedBoundingBox(poses[i]));
+}
+
+/////////////////////////////////////////////////
+TEST(CylinderTest, SupportPoint)
+{
+  math::Cylinderd cylinder(4.0, 1.0);
+
+  // Along the axis the support is the cap center; sideways it is the
+  // rim of the top cap.
+  EXPECT_EQ(cylinder.SupportPoint(math::Vector3d(0, 0, -3)),
+      math::Vector3d(0, 0, -2));
+  EXPECT_EQ(cylinder.SupportPoint(math::Vector3d(1, 0, 0)),
+      math::Vector3d(1, 0, 2));
+  EXPECT_EQ(cylinder.SupportPoint(math::Vector3d(3, 4, -1)),
+      math::Vector3d(0.6, 0.8, -2));
+  EXPECT_EQ(cylinder.SupportPoint(math::Vector3d::Zero),
+      math::Vector3d(0, 0, 2));
+
+  // The rotational offset rotates both the query direction and the
+  // resulting point.
+  math::Cylinderd offset(4.0, 1.0,
+      math::Quaterniond(0, IGN_PI_2, 0));
+  EXPECT_EQ(offset.SupportPoint(math::Vector3d(1, 0, 1)),
+      math::Vector3d(2, 0, 1));
+
+  const math::Vector3d dirs[3] = {math::Vector3d(1, 0, 0),
+      math::Vector3d(-2, 5, 1), math::Vector3d(0, 0, -1)};
+  math::Vector3d points[3];
+  cylinder.SupportPointBatch(dirs, 3, points);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(points[i], cylinder.SupportPoint(dirs[i]));
+}
@@ -15,7 +15,9 @@
  *
 */
 #include <cmath>
+#include <cstddef>
 #include "ignition/math/DiffDriveOdometry.hh"
+#include "ignition/math/MemoryPool.hh"
 #include "ignition/math/RollingMean.hh"
 
 using namespace ignition;
@@ -78,6 +80,20 @@ class ignition::math::DiffDriveOdometryPrivate
 
   /// \brief Initialized flag.
   public: bool initialized{false};
+
+  /// \brief Odometry instances come and go with their vehicles, so
+  /// the private data draws its storage from the shared pool.
+  public: static void *operator new(std::size_t)
+  {
+    return MemoryPool<DiffDriveOdometryPrivate>::Instance().Allocate();
+  }
+
+  /// \brief Return the slot obtained from operator new.
+  /// \param[in] _ptr Pointer to the slot.
+  public: static void operator delete(void *_ptr)
+  {
+    MemoryPool<DiffDriveOdometryPrivate>::Instance().Deallocate(_ptr);
+  }
 };
 
 //////////////////////////////////////////////////
@@ -164,6 +180,71 @@ bool DiffDriveOdometry::Update(const Angle &_leftPos, const Angle &_rightPos,
   return true;
 }
 
+//////////////////////////////////////////////////
+size_t DiffDriveOdometry::UpdateBatch(const double *_leftPos,
+    const double *_rightPos, const double *_times, const size_t _count)
+{
+  DiffDriveOdometryPrivate *d = this->dataPtr.get();
+
+  // Wheel parameters and previous state in locals for the whole
+  // stream.
+  const double leftRadius = d->leftWheelRadius;
+  const double rightRadius = d->rightWheelRadius;
+  const double invSeparation = 1.0 / d->wheelSeparation;
+  double leftOldPos = d->leftWheelOldPos;
+  double rightOldPos = d->rightWheelOldPos;
+
+  size_t updated = 0;
+  double lastTime = 0.0;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double leftCurPos = _leftPos[i] * leftRadius;
+    const double rightCurPos = _rightPos[i] * rightRadius;
+    const double leftEstVel = leftCurPos - leftOldPos;
+    const double rightEstVel = rightCurPos - rightOldPos;
+    leftOldPos = leftCurPos;
+    rightOldPos = rightCurPos;
+
+    const double linear = (rightEstVel + leftEstVel) * 0.5;
+    const double angular = (rightEstVel - leftEstVel) * invSeparation;
+
+    d->IntegrateExact(linear, angular);
+
+    const double dt = _times[i] - lastTime;
+    if (equal(0.0, dt))
+      continue;
+    lastTime = _times[i];
+
+    d->linearMean.Push(linear / dt);
+    d->angularMean.Push(angular / dt);
+    ++updated;
+  }
+
+  d->leftWheelOldPos = leftOldPos;
+  d->rightWheelOldPos = rightOldPos;
+  if (updated > 0)
+  {
+    d->linearVel = d->linearMean.Mean();
+    d->angularVel = d->angularMean.Mean();
+  }
+  d->lastUpdateTime += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(lastTime));
+
+  return updated;
+}
+
+//////////////////////////////////////////////////
+DiffDriveOdometry::State DiffDriveOdometry::CurrentState() const
+{
+  State state;
+  state.x = this->dataPtr->x;
+  state.y = this->dataPtr->y;
+  state.heading = *this->dataPtr->heading;
+  state.linearVelocity = this->dataPtr->linearVel;
+  state.angularVelocity = *this->dataPtr->angularVel;
+  return state;
+}
+
 //////////////////////////////////////////////////
 void DiffDriveOdometry::SetWheelParams(double _wheelSeparation,
     double _leftWheelRadius, double _rightWheelRadius)
@@ -123,3 +123,67 @@ TEST(DiffDriveOdometryTest, DiffDriveOdometry)
       ((xDistTraveled - yDistTraveled) / wheelSeparation) / 0.1,
       *odom.AngularVelocity(), 1e-3);
 }
+
+/////////////////////////////////////////////////
+TEST(DiffDriveOdometryTest, BatchUpdate)
+{
+  // The batch path matches per-sample Update on the same stream.
+  math::DiffDriveOdometry scalarOdom;
+  math::DiffDriveOdometry batchOdom;
+  scalarOdom.SetWheelParams(2.0, 0.5, 0.5);
+  batchOdom.SetWheelParams(2.0, 0.5, 0.5);
+
+  const auto startTime = std::chrono::steady_clock::now();
+  scalarOdom.Init(startTime);
+  batchOdom.Init(startTime);
+
+  const size_t count = 200;
+  std::vector<double> left(count), right(count), times(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    left[i] = 0.02 * (i + 1);
+    right[i] = 0.025 * (i + 1);
+    times[i] = 0.01 * (i + 1);
+  }
+
+  auto scalarTime = startTime;
+  for (size_t i = 0; i < count; ++i)
+  {
+    scalarTime = startTime + std::chrono::duration_cast<
+        std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(times[i]));
+    EXPECT_TRUE(scalarOdom.Update(left[i], right[i], scalarTime));
+  }
+
+  EXPECT_EQ(count,
+      batchOdom.UpdateBatch(left.data(), right.data(), times.data(),
+          count));
+
+  const auto state = batchOdom.CurrentState();
+  EXPECT_NEAR(scalarOdom.X(), state.x, 1e-9);
+  EXPECT_NEAR(scalarOdom.Y(), state.y, 1e-9);
+  EXPECT_NEAR(*scalarOdom.Heading(), state.heading, 1e-9);
+  EXPECT_NEAR(scalarOdom.LinearVelocity(), state.linearVelocity, 1e-6);
+  EXPECT_NEAR(*scalarOdom.AngularVelocity(), state.angularVelocity, 1e-6);
+
+  // The snapshot matches the accessors.
+  EXPECT_DOUBLE_EQ(batchOdom.X(), state.x);
+  EXPECT_DOUBLE_EQ(batchOdom.Y(), state.y);
+  EXPECT_DOUBLE_EQ(*batchOdom.Heading(), state.heading);
+
+  // The internal time advanced with the stream: another scalar update
+  // right after the batch sees the expected small dt.
+  const auto nextTime = startTime + std::chrono::duration_cast<
+      std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(0.01 * (count + 1)));
+  EXPECT_TRUE(batchOdom.Update(
+      math::Angle(0.02 * (count + 1)), math::Angle(0.025 * (count + 1)), nextTime));
+
+  // Zero time steps do not update the velocity estimate.
+  math::DiffDriveOdometry stalled;
+  stalled.SetWheelParams(2.0, 0.5, 0.5);
+  stalled.Init(startTime);
+  const double samePos[2] = {0.1, 0.2};
+  const double sameTimes[2] = {0.1, 0.1};
+  EXPECT_EQ(1u, stalled.UpdateBatch(samePos, samePos, sameTimes, 2));
+}
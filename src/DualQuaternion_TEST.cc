@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/DualQuaternion.hh"
+#include "ignition/math/Helpers.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(DualQuaternionTest, Construction)
+{
+  // The default is the identity transform.
+  math::DualQuaterniond identity;
+  EXPECT_EQ(math::Quaterniond::Identity, identity.Real());
+  EXPECT_EQ(math::Pose3d::Zero, identity.Pose());
+
+  // Poses round trip.
+  const math::Pose3d pose(1, -2, 3, 0.2, 0.3, -0.4);
+  const math::DualQuaterniond dq(pose);
+  EXPECT_EQ(pose.Rot(), dq.Real());
+  const math::Pose3d back = dq.Pose();
+  EXPECT_EQ(pose.Pos(), back.Pos());
+  EXPECT_EQ(pose.Rot(), back.Rot());
+
+  // A unit dual quaternion's dual part is orthogonal to its real part.
+  EXPECT_NEAR(0.0, dq.Real().Dot(dq.Dual()), 1e-12);
+
+  // Copies compare equal.
+  const math::DualQuaterniond copy(dq);
+  EXPECT_EQ(dq, copy);
+  EXPECT_NE(dq, identity);
+}
+
+/////////////////////////////////////////////////
+TEST(DualQuaternionTest, Composition)
+{
+  const math::Pose3d a(1, 2, 3, 0.2, 0.3, 0.4);
+  const math::Pose3d b(-2, 1, 0.5, 0.5, -0.1, 0.9);
+
+  // Composition matches Pose3 composition.
+  const math::DualQuaterniond composed =
+      math::DualQuaterniond(a) * math::DualQuaterniond(b);
+  const math::Pose3d expected = a * b;
+  EXPECT_EQ(expected.Pos(), composed.Pose().Pos());
+  EXPECT_EQ(expected.Rot(), composed.Pose().Rot());
+
+  // Composing with the identity changes nothing.
+  const math::DualQuaterniond dq(a);
+  EXPECT_EQ(a.Pos(), (dq * math::DualQuaterniond()).Pose().Pos());
+  EXPECT_EQ(a.Pos(), (math::DualQuaterniond() * dq).Pose().Pos());
+}
+
+/////////////////////////////////////////////////
+TEST(DualQuaternionTest, Normalize)
+{
+  const math::Pose3d pose(2, 0, -1, 0, 0, IGN_PI_4);
+  math::DualQuaterniond dq = math::DualQuaterniond(pose) * 3.0;
+  dq.Normalize();
+  EXPECT_EQ(pose.Pos(), dq.Pose().Pos());
+  EXPECT_EQ(pose.Rot(), dq.Pose().Rot());
+
+  // A degenerate dual quaternion normalizes to the identity.
+  math::DualQuaterniond zero = math::DualQuaterniond(pose) * 0.0;
+  EXPECT_EQ(math::Pose3d::Zero, zero.Normalized().Pose());
+}
+
+/////////////////////////////////////////////////
+TEST(DualQuaternionTest, Blend)
+{
+  // Blending a pure translation is linear in the translation.
+  {
+    const math::Pose3d poses[2] =
+    {
+      math::Pose3d(0, 0, 0, 0, 0, 0),
+      math::Pose3d(4, 0, 0, 0, 0, 0)
+    };
+    const double weights[2] = {0.75, 0.25};
+    const math::Pose3d blended =
+        math::DualQuaterniond::BlendPoses(poses, weights, 2);
+    EXPECT_EQ(math::Vector3d(1, 0, 0), blended.Pos());
+    EXPECT_EQ(math::Quaterniond::Identity, blended.Rot());
+  }
+
+  // An equal-weight blend of two rotations about a shared axis halves
+  // the angle, like slerp.
+  {
+    const math::Pose3d poses[2] =
+    {
+      math::Pose3d(0, 0, 0, 0, 0, 0),
+      math::Pose3d(0, 0, 0, 0, 0, IGN_PI_2)
+    };
+    const double weights[2] = {0.5, 0.5};
+    const math::Pose3d blended =
+        math::DualQuaterniond::BlendPoses(poses, weights, 2);
+    EXPECT_EQ(math::Quaterniond(0, 0, IGN_PI_4), blended.Rot());
+  }
+
+  // The blend is insensitive to the double cover: negating one input
+  // quaternion does not change the result.
+  {
+    const math::DualQuaterniond a(math::Pose3d(1, 0, 0, 0, 0, 0.3));
+    const math::DualQuaterniond b(math::Pose3d(0, 1, 0, 0, 0, 0.7));
+    const math::DualQuaterniond bNegated = b * -1.0;
+    const double weights[2] = {0.4, 0.6};
+
+    const math::DualQuaterniond dqs[2] = {a, b};
+    const math::DualQuaterniond flipped[2] = {a, bNegated};
+    const math::Pose3d blended =
+        math::DualQuaterniond::Blend(dqs, weights, 2).Pose();
+    const math::Pose3d blendedFlipped =
+        math::DualQuaterniond::Blend(flipped, weights, 2).Pose();
+    EXPECT_EQ(blended.Pos(), blendedFlipped.Pos());
+    EXPECT_EQ(blended.Rot(), blendedFlipped.Rot());
+  }
+
+  // A weight concentrated on one transform returns that transform,
+  // and an empty blend is the identity.
+  {
+    const math::Pose3d poses[3] =
+    {
+      math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3),
+      math::Pose3d(-1, 0, 2, 0.4, 0, -0.2),
+      math::Pose3d(0, 5, -1, 0, 0.6, 0)
+    };
+    const double weights[3] = {0.0, 1.0, 0.0};
+    const math::Pose3d blended =
+        math::DualQuaterniond::BlendPoses(poses, weights, 3);
+    EXPECT_EQ(poses[1].Pos(), blended.Pos());
+    EXPECT_EQ(poses[1].Rot(), blended.Rot());
+
+    EXPECT_EQ(math::Pose3d::Zero,
+        math::DualQuaterniond::BlendPoses(poses, weights, 0));
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(DualQuaternionTest, BlendBatch)
+{
+  // Two joints, three vertices with different weight rows.
+  const math::DualQuaterniond joints[2] =
+  {
+    math::DualQuaterniond(math::Pose3d(0, 0, 0, 0, 0, 0)),
+    math::DualQuaterniond(math::Pose3d(2, 0, 0, 0, 0, IGN_PI_2))
+  };
+  const double weights[6] =
+  {
+    1.0, 0.0,
+    0.5, 0.5,
+    0.0, 1.0
+  };
+
+  math::DualQuaterniond out[3];
+  math::DualQuaterniond::BlendBatch(joints, weights, 3, 2, out);
+
+  EXPECT_EQ(math::Pose3d::Zero, out[0].Pose());
+  EXPECT_EQ(joints[1].Pose().Pos(), out[2].Pose().Pos());
+  EXPECT_EQ(joints[1].Pose().Rot(), out[2].Pose().Rot());
+
+  // The middle row matches a direct blend of its weights.
+  const double midWeights[2] = {0.5, 0.5};
+  const math::Pose3d mid =
+      math::DualQuaterniond::Blend(joints, midWeights, 2).Pose();
+  EXPECT_EQ(mid.Pos(), out[1].Pose().Pos());
+  EXPECT_EQ(mid.Rot(), out[1].Pose().Rot());
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Angle.hh"
+#include "ignition/math/FastTrig.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(FastTrigTest, SinCos)
+{
+  // The documented bound holds over several periods.
+  for (int i = -20000; i <= 20000; ++i)
+  {
+    const double x = 0.001 * i;
+    double s, c;
+    math::FastSinCos(x, s, c);
+    ASSERT_NEAR(std::sin(x), s, 1e-9) << x;
+    ASSERT_NEAR(std::cos(x), c, 1e-9) << x;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FastTrigTest, Atan2AndAsin)
+{
+  for (int i = -100; i <= 100; ++i)
+  {
+    for (int j = -100; j <= 100; ++j)
+    {
+      const double y = 0.13 * i;
+      const double x = 0.17 * j;
+      ASSERT_NEAR(std::atan2(y, x), math::FastAtan2(y, x), 1e-8)
+          << y << " " << x;
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.0, math::FastAtan2(0.0, 0.0));
+
+  for (int i = -1000; i <= 1000; ++i)
+  {
+    const double x = 0.001 * i;
+    ASSERT_NEAR(std::asin(x), math::FastAsin(x), 1e-8) << x;
+  }
+  EXPECT_NEAR(0.5 * IGN_PI, math::FastAsin(2.0), 1e-12);
+}
+
+/////////////////////////////////////////////////
+TEST(FastTrigTest, NormalizeAngle)
+{
+  std::vector<double> angles;
+  for (int i = -5000; i <= 5000; ++i)
+    angles.push_back(0.01 * i);
+
+  std::vector<double> normalized(angles.size());
+  math::FastNormalizeAngleBatch(angles.data(), normalized.data(),
+      angles.size());
+
+  for (size_t i = 0; i < angles.size(); ++i)
+  {
+    // Same result as Angle::Normalized up to rounding at the seam.
+    const double expected = math::Angle(angles[i]).Normalized().Radian();
+    const double diff = std::abs(expected - normalized[i]);
+    ASSERT_LT(std::min(diff, 2.0 * IGN_PI - diff), 1e-9) << angles[i];
+    ASSERT_LE(-IGN_PI, normalized[i]);
+    ASSERT_LT(normalized[i], IGN_PI);
+  }
+
+  // In-place normalization is allowed.
+  math::FastNormalizeAngleBatch(angles.data(), angles.data(),
+      angles.size());
+  EXPECT_EQ(normalized, angles);
+}
+
+/////////////////////////////////////////////////
+TEST(FastTrigTest, EulerRoundTrip)
+{
+  // Scalar fast conversions stay close to the exact ones.
+  for (int r = -15; r <= 15; ++r)
+  {
+    for (int p = -7; p <= 7; ++p)
+    {
+      for (int y = -15; y <= 15; ++y)
+      {
+        const double roll = 0.2 * r;
+        const double pitch = 0.2 * p;
+        const double yaw = 0.2 * y;
+
+        const math::Quaterniond exact(roll, pitch, yaw);
+        const math::Quaterniond fast =
+            math::FastQuaternionFromEuler(roll, pitch, yaw);
+        ASSERT_NEAR(exact.W(), fast.W(), 1e-9);
+        ASSERT_NEAR(exact.X(), fast.X(), 1e-9);
+        ASSERT_NEAR(exact.Y(), fast.Y(), 1e-9);
+        ASSERT_NEAR(exact.Z(), fast.Z(), 1e-9);
+
+        const math::Vector3d euler = math::FastEuler(exact);
+        const math::Vector3d expected = exact.Euler();
+        ASSERT_NEAR(expected.X(), euler.X(), 1e-8);
+        ASSERT_NEAR(expected.Y(), euler.Y(), 1e-8);
+        ASSERT_NEAR(expected.Z(), euler.Z(), 1e-8);
+      }
+    }
+  }
+
+  // Gimbal lock keeps the exact path's convention.
+  const math::Quaterniond lock(0.3, 0.5 * IGN_PI, 0.0);
+  const math::Vector3d locked = math::FastEuler(lock);
+  EXPECT_NEAR(0.5 * IGN_PI, locked.Y(), 1e-8);
+  EXPECT_DOUBLE_EQ(0.0, locked.Z());
+}
+
+/////////////////////////////////////////////////
+TEST(FastTrigTest, Batch)
+{
+  std::vector<math::Vector3d> euler;
+  for (int i = 0; i < 500; ++i)
+    euler.push_back(math::Vector3d(0.01 * i, 0.005 * i - 1.2, -0.02 * i));
+
+  std::vector<math::Quaterniond> rotations(euler.size());
+  math::FastQuaternionFromEulerBatch(euler.data(), rotations.data(),
+      euler.size());
+
+  std::vector<math::Vector3d> roundTrip(euler.size());
+  math::FastEulerBatch(rotations.data(), roundTrip.data(),
+      rotations.size());
+
+  for (size_t i = 0; i < euler.size(); ++i)
+  {
+    // Batch elements equal the scalar fast calls.
+    EXPECT_EQ(math::FastQuaternionFromEuler(
+        euler[i].X(), euler[i].Y(), euler[i].Z()), rotations[i]) << i;
+
+    // And the round trip recovers the normalized input angles.
+    EXPECT_NEAR(math::FastNormalizeAngle(euler[i].X()),
+        roundTrip[i].X(), 1e-7) << i;
+    EXPECT_NEAR(math::FastNormalizeAngle(euler[i].Z()),
+        roundTrip[i].Z(), 1e-7) << i;
+  }
+}
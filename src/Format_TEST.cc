@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ignition/math/Format.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(FormatTest, Double)
+{
+  // The formatted value round-trips exactly.
+  const double values[] = {0.0, 1.0, -1.5, 1.0 / 3.0, 1e-300, -2.5e300,
+      3.14159265358979312};
+  char buffer[64];
+  for (const double value : values)
+  {
+    const size_t written = math::AppendTo(buffer, sizeof(buffer), value);
+    ASSERT_LT(0u, written);
+    const std::string text(buffer, written);
+    EXPECT_DOUBLE_EQ(value, std::strtod(text.c_str(), nullptr)) << text;
+  }
+
+  // A too-small buffer is reported rather than overrun.
+  EXPECT_EQ(0u, math::AppendTo(buffer, 2, 3.14159265358979312));
+}
+
+/////////////////////////////////////////////////
+TEST(FormatTest, VectorPoseMatrix)
+{
+  const math::Vector3d vec(1.25, -2.5, 1.0 / 3.0);
+  const math::Pose3d pose(vec, math::Quaterniond(0.1, -0.2, 0.3));
+  math::Matrix4d mat(pose);
+
+  // Same layout as the stream operators: values in the same order,
+  // space separated, so existing parsers keep working.
+  {
+    const std::string text = math::ToString(vec);
+    std::istringstream stream(text);
+    math::Vector3d parsed;
+    stream >> parsed;
+    EXPECT_EQ(vec, parsed);
+  }
+
+  {
+    const std::string text = math::ToString(pose);
+    std::istringstream stream(text);
+    math::Pose3d parsed;
+    stream >> parsed;
+    EXPECT_NEAR(pose.Pos().X(), parsed.Pos().X(), 1e-15);
+    EXPECT_NEAR(pose.Rot().Roll(), parsed.Rot().Roll(), 1e-6);
+    EXPECT_NEAR(pose.Rot().Pitch(), parsed.Rot().Pitch(), 1e-6);
+    EXPECT_NEAR(pose.Rot().Yaw(), parsed.Rot().Yaw(), 1e-6);
+  }
+
+  {
+    const std::string text = math::ToString(mat);
+    std::istringstream stream(text);
+    double entry;
+    for (int row = 0; row < 4; ++row)
+    {
+      for (int col = 0; col < 4; ++col)
+      {
+        stream >> entry;
+        EXPECT_DOUBLE_EQ(mat(row, col), entry);
+      }
+    }
+  }
+
+  // The quaternion formats as its Euler angles, like operator<<.
+  {
+    const std::string text = math::ToString(pose.Rot());
+    std::istringstream stream(text);
+    math::Vector3d euler;
+    stream >> euler;
+    EXPECT_NEAR(pose.Rot().Euler().X(), euler.X(), 1e-15);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FormatTest, BulkPoses)
+{
+  std::vector<math::Pose3d> poses;
+  for (int i = 0; i < 20; ++i)
+  {
+    poses.push_back(math::Pose3d(
+        0.5 * i, -0.25 * i, 1.0 / (i + 1),
+        0.01 * i, -0.02 * i, 0.03 * i));
+  }
+
+  const std::string text = math::ToString(poses.data(), poses.size());
+
+  // One line per pose, each matching its individual formatting.
+  std::istringstream stream(text);
+  std::string line;
+  size_t index = 0;
+  while (std::getline(stream, line))
+  {
+    ASSERT_LT(index, poses.size());
+    EXPECT_EQ(math::ToString(poses[index]), line);
+    ++index;
+  }
+  EXPECT_EQ(poses.size(), index);
+
+  // Empty input yields an empty string.
+  EXPECT_TRUE(math::ToString(poses.data(), 0).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(FormatTest, FromString)
+{
+  // A scalar parses and the view advances past it.
+  {
+    std::string_view text("  1.5 -2.5");
+    double value = 0.0;
+    EXPECT_TRUE(math::FromString(text, value));
+    EXPECT_DOUBLE_EQ(1.5, value);
+    EXPECT_TRUE(math::FromString(text, value));
+    EXPECT_DOUBLE_EQ(-2.5, value);
+    EXPECT_FALSE(math::FromString(text, value));
+    EXPECT_DOUBLE_EQ(-2.5, value);
+  }
+
+  // The formatting fast path round-trips through the parsing one.
+  {
+    const math::Vector3d vec(1.25, -2.5, 1.0 / 3.0);
+    std::string_view text_view;
+    const std::string text = math::ToString(vec);
+    text_view = text;
+    math::Vector3d parsed;
+    EXPECT_TRUE(math::FromString(text_view, parsed));
+    EXPECT_EQ(vec, parsed);
+    EXPECT_TRUE(text_view.empty());
+  }
+
+  {
+    const math::Pose3d pose(1.0, -2.0, 3.0, 0.1, -0.2, 0.3);
+    const std::string text = math::ToString(pose);
+    std::string_view view(text);
+    math::Pose3d parsed;
+    EXPECT_TRUE(math::FromString(view, parsed));
+    EXPECT_NEAR(pose.Pos().X(), parsed.Pos().X(), 1e-15);
+    EXPECT_NEAR(pose.Rot().Roll(), parsed.Rot().Roll(), 1e-12);
+    EXPECT_NEAR(pose.Rot().Yaw(), parsed.Rot().Yaw(), 1e-12);
+  }
+
+  // A truncated pose fails without consuming the view.
+  {
+    std::string_view view("1 2 3 0.1");
+    math::Pose3d pose;
+    EXPECT_FALSE(math::FromString(view, pose));
+    EXPECT_EQ(9u, view.size());
+  }
+
+  // A bulk dump parses back line by line.
+  {
+    std::vector<math::Pose3d> poses;
+    for (int i = 0; i < 10; ++i)
+      poses.push_back(math::Pose3d(i, -i, 0.5 * i, 0, 0, 0.01 * i));
+    const std::string text = math::ToString(poses.data(), poses.size());
+    std::string_view view(text);
+    for (size_t i = 0; i < poses.size(); ++i)
+    {
+      math::Pose3d parsed;
+      ASSERT_TRUE(math::FromString(view, parsed));
+      EXPECT_NEAR(poses[i].Pos().X(), parsed.Pos().X(), 1e-15);
+    }
+    EXPECT_TRUE(view.empty());
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FormatTest, BinaryArrays)
+{
+  // Vectors round-trip bit exactly through the raw dump.
+  {
+    std::vector<math::Vector3d> vectors;
+    for (int i = 0; i < 300; ++i)
+      vectors.push_back(math::Vector3d(0.1 * i, -1.0 / (i + 1), 1e10 * i));
+
+    std::stringstream stream(std::ios::in | std::ios::out |
+        std::ios::binary);
+    EXPECT_TRUE(math::WriteArray(stream, vectors.data(), vectors.size()));
+    EXPECT_EQ(3 * sizeof(double) * vectors.size(), stream.str().size());
+
+    std::vector<math::Vector3d> loaded(vectors.size());
+    EXPECT_TRUE(math::ReadArray(stream, loaded.data(), loaded.size()));
+    for (size_t i = 0; i < vectors.size(); ++i)
+      EXPECT_EQ(vectors[i], loaded[i]);
+  }
+
+  // Poses store the quaternion directly, so the rotation is exact.
+  {
+    std::vector<math::Pose3d> poses;
+    for (int i = 0; i < 150; ++i)
+      poses.push_back(math::Pose3d(i, 2.0 * i, -i, 0.1 * i, 0.02 * i, -i));
+
+    std::stringstream stream(std::ios::in | std::ios::out |
+        std::ios::binary);
+    EXPECT_TRUE(math::WriteArray(stream, poses.data(), poses.size()));
+    EXPECT_EQ(7 * sizeof(double) * poses.size(), stream.str().size());
+
+    std::vector<math::Pose3d> loaded(poses.size());
+    EXPECT_TRUE(math::ReadArray(stream, loaded.data(), loaded.size()));
+    for (size_t i = 0; i < poses.size(); ++i)
+      EXPECT_EQ(poses[i], loaded[i]);
+  }
+
+  // Reading more than was written fails.
+  {
+    std::stringstream stream(std::ios::in | std::ios::out |
+        std::ios::binary);
+    math::Vector3d vec(1, 2, 3);
+    EXPECT_TRUE(math::WriteArray(stream, &vec, 1));
+    math::Vector3d loaded[2];
+    EXPECT_FALSE(math::ReadArray(stream, loaded, 2));
+  }
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/FrameClock.hh"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief Convert a clock duration to seconds.
+  /// \param[in] _d The duration.
+  /// \return The duration in seconds.
+  double Seconds(const clock::duration &_d)
+  {
+    return std::chrono::duration<double>(_d).count();
+  }
+
+  /// \brief Insert the statistics a FrameClock signal tracks.
+  /// \param[in, out] _stats The signal to configure.
+  void ConfigureStats(SignalStats &_stats)
+  {
+    _stats.InsertStatistic("max");
+    _stats.InsertStatistic("mean");
+    _stats.InsertStatistic("min");
+    _stats.InsertStatistic("var");
+  }
+
+  /// \brief Timing state of one named phase.
+  struct Phase
+  {
+    /// \brief The stopwatch timing the current run.
+    public: Stopwatch watch;
+
+    /// \brief The budget; zero when none is set.
+    public: clock::duration budget{0};
+
+    /// \brief Elapsed time of the most recent completed run.
+    public: clock::duration lastElapsed{0};
+
+    /// \brief Statistics over the elapsed times, in seconds.
+    public: SignalStats elapsedStats;
+
+    /// \brief Statistics over the budget overruns, in seconds.
+    public: SignalStats overrunStats;
+  };
+}
+
+/// \internal
+/// \brief Private data for the FrameClock class.
+class ignition::math::FrameClockPrivate
+{
+  /// \brief The fixed step of one tick.
+  public: clock::duration step{std::chrono::milliseconds(1)};
+
+  /// \brief Whether the clock has been started.
+  public: bool running = false;
+
+  /// \brief The scheduling epoch.
+  public: clock::time_point epoch;
+
+  /// \brief The time of the last tick advancing update.
+  public: clock::time_point lastAdvance;
+
+  /// \brief Ticks consumed so far.
+  public: uint64_t ticks = 0;
+
+  /// \brief Statistics over tick advancing update intervals.
+  public: SignalStats frameStats;
+
+  /// \brief Statistics over frame overruns.
+  public: SignalStats overrunStats;
+
+  /// \brief The phases, by name.
+  public: std::map<std::string, Phase> phases;
+
+  /// \brief Name of the running phase; empty when none is.
+  public: std::string activePhase;
+};
+
+//////////////////////////////////////////////////
+FrameClock::FrameClock(const clock::duration &_step)
+: dataPtr(new FrameClockPrivate)
+{
+  if (_step > clock::duration::zero())
+    this->dataPtr->step = _step;
+  ConfigureStats(this->dataPtr->frameStats);
+  ConfigureStats(this->dataPtr->overrunStats);
+}
+
+//////////////////////////////////////////////////
+FrameClock::~FrameClock()
+{
+}
+
+//////////////////////////////////////////////////
+clock::duration FrameClock::Step() const
+{
+  return this->dataPtr->step;
+}
+
+//////////////////////////////////////////////////
+bool FrameClock::Start()
+{
+  return this->Start(clock::now());
+}
+
+//////////////////////////////////////////////////
+bool FrameClock::Start(const clock::time_point &_now)
+{
+  if (this->dataPtr->running)
+    return false;
+
+  this->dataPtr->running = true;
+  this->dataPtr->epoch = _now;
+  this->dataPtr->lastAdvance = _now;
+  this->dataPtr->ticks = 0;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool FrameClock::Running() const
+{
+  return this->dataPtr->running;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameClock::Update()
+{
+  return this->Update(clock::now());
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameClock::Update(const clock::time_point &_now)
+{
+  if (!this->dataPtr->running || _now < this->dataPtr->epoch)
+    return 0;
+
+  // Whole steps since the epoch; deriving the count from the epoch
+  // rather than the previous deadline is what keeps the schedule
+  // drift-free.
+  const uint64_t total = static_cast<uint64_t>(
+      (_now - this->dataPtr->epoch) / this->dataPtr->step);
+  if (total <= this->dataPtr->ticks)
+    return 0;
+
+  const uint64_t pending = total - this->dataPtr->ticks;
+  this->dataPtr->ticks = total;
+
+  this->dataPtr->frameStats.InsertData(
+      Seconds(_now - this->dataPtr->lastAdvance));
+  this->dataPtr->overrunStats.InsertData(
+      static_cast<double>(pending - 1) * Seconds(this->dataPtr->step));
+  this->dataPtr->lastAdvance = _now;
+  return pending;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameClock::TickCount() const
+{
+  return this->dataPtr->ticks;
+}
+
+//////////////////////////////////////////////////
+clock::time_point FrameClock::NextTickTime() const
+{
+  if (!this->dataPtr->running)
+    return this->dataPtr->epoch;
+
+  return this->dataPtr->epoch + this->dataPtr->step *
+      static_cast<clock::duration::rep>(this->dataPtr->ticks + 1);
+}
+
+//////////////////////////////////////////////////
+SignalStats FrameClock::FrameStats() const
+{
+  return this->dataPtr->frameStats;
+}
+
+//////////////////////////////////////////////////
+SignalStats FrameClock::OverrunStats() const
+{
+  return this->dataPtr->overrunStats;
+}
+
+//////////////////////////////////////////////////
+void FrameClock::SetPhaseBudget(const std::string &_phase,
+    const clock::duration &_budget)
+{
+  auto &phase = this->dataPtr->phases[_phase];
+  if (phase.elapsedStats.Map().empty())
+  {
+    ConfigureStats(phase.elapsedStats);
+    ConfigureStats(phase.overrunStats);
+  }
+  phase.budget = _budget;
+}
+
+//////////////////////////////////////////////////
+clock::duration FrameClock::PhaseBudget(const std::string &_phase) const
+{
+  auto it = this->dataPtr->phases.find(_phase);
+  return it != this->dataPtr->phases.end() ? it->second.budget
+      : clock::duration::zero();
+}
+
+//////////////////////////////////////////////////
+bool FrameClock::BeginPhase(const std::string &_phase)
+{
+  if (!this->dataPtr->activePhase.empty())
+  {
+    std::cerr << "Phase [" << this->dataPtr->activePhase
+              << "] is still running; phases do not nest\n";
+    return false;
+  }
+
+  auto inserted = this->dataPtr->phases.emplace(_phase, Phase());
+  if (inserted.second)
+  {
+    ConfigureStats(inserted.first->second.elapsedStats);
+    ConfigureStats(inserted.first->second.overrunStats);
+  }
+
+  this->dataPtr->activePhase = _phase;
+  inserted.first->second.watch.Start(true);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool FrameClock::EndPhase()
+{
+  if (this->dataPtr->activePhase.empty())
+    return false;
+
+  auto &phase = this->dataPtr->phases[this->dataPtr->activePhase];
+  phase.watch.Stop();
+  phase.lastElapsed = phase.watch.ElapsedRunTime();
+  phase.elapsedStats.InsertData(Seconds(phase.lastElapsed));
+  if (phase.budget > clock::duration::zero())
+  {
+    phase.overrunStats.InsertData(
+        std::max(0.0, Seconds(phase.lastElapsed - phase.budget)));
+  }
+
+  this->dataPtr->activePhase.clear();
+  return true;
+}
+
+//////////////////////////////////////////////////
+clock::duration FrameClock::PhaseElapsed(const std::string &_phase) const
+{
+  auto it = this->dataPtr->phases.find(_phase);
+  return it != this->dataPtr->phases.end() ? it->second.lastElapsed
+      : clock::duration::zero();
+}
+
+//////////////////////////////////////////////////
+SignalStats FrameClock::PhaseStats(const std::string &_phase) const
+{
+  auto it = this->dataPtr->phases.find(_phase);
+  return it != this->dataPtr->phases.end() ? it->second.elapsedStats
+      : SignalStats();
+}
+
+//////////////////////////////////////////////////
+SignalStats FrameClock::PhaseOverrunStats(const std::string &_phase) const
+{
+  auto it = this->dataPtr->phases.find(_phase);
+  return it != this->dataPtr->phases.end() ? it->second.overrunStats
+      : SignalStats();
+}
+
+//////////////////////////////////////////////////
+void FrameClock::Reset()
+{
+  this->dataPtr->running = false;
+  this->dataPtr->ticks = 0;
+  this->dataPtr->frameStats.Reset();
+  this->dataPtr->overrunStats.Reset();
+  this->dataPtr->activePhase.clear();
+  for (auto &phasePair : this->dataPtr->phases)
+  {
+    phasePair.second.watch.Reset();
+    phasePair.second.lastElapsed = clock::duration::zero();
+    phasePair.second.elapsedStats.Reset();
+    phasePair.second.overrunStats.Reset();
+  }
+}
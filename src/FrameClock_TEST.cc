@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "ignition/math/FrameClock.hh"
+
+using namespace ignition;
+using namespace std::chrono_literals;
+
+/////////////////////////////////////////////////
+TEST(FrameClockTest, TickScheduling)
+{
+  math::FrameClock frameClock(10ms);
+  EXPECT_EQ(frameClock.Step(), 10ms);
+  EXPECT_FALSE(frameClock.Running());
+  EXPECT_EQ(frameClock.Update(), 0u);
+
+  const math::clock::time_point epoch(1000s);
+  EXPECT_TRUE(frameClock.Start(epoch));
+  EXPECT_FALSE(frameClock.Start(epoch));
+  EXPECT_TRUE(frameClock.Running());
+
+  // Nothing to do before the first deadline.
+  EXPECT_EQ(frameClock.Update(epoch), 0u);
+  EXPECT_EQ(frameClock.Update(epoch + 9ms), 0u);
+  EXPECT_EQ(frameClock.NextTickTime(), epoch + 10ms);
+
+  // One tick per step, several when the caller is late.
+  EXPECT_EQ(frameClock.Update(epoch + 10ms), 1u);
+  EXPECT_EQ(frameClock.TickCount(), 1u);
+  EXPECT_EQ(frameClock.NextTickTime(), epoch + 20ms);
+  EXPECT_EQ(frameClock.Update(epoch + 45ms), 3u);
+  EXPECT_EQ(frameClock.TickCount(), 4u);
+  EXPECT_EQ(frameClock.NextTickTime(), epoch + 50ms);
+
+  // Time that precedes the epoch is ignored.
+  EXPECT_EQ(frameClock.Update(epoch - 1s), 0u);
+
+  // A non-positive step falls back to one millisecond.
+  math::FrameClock bad(math::clock::duration::zero());
+  EXPECT_EQ(bad.Step(), 1ms);
+}
+
+/////////////////////////////////////////////////
+TEST(FrameClockTest, DriftFreeSchedule)
+{
+  math::FrameClock frameClock(10ms);
+  const math::clock::time_point epoch(2000s);
+  frameClock.Start(epoch);
+
+  // A loop that always runs a little late never loses ticks: the
+  // schedule is derived from the epoch, not the previous deadline.
+  uint64_t ticks = 0;
+  for (int frame = 1; frame <= 1000; ++frame)
+    ticks += frameClock.Update(epoch + frame * 10ms + 9ms);
+  EXPECT_EQ(ticks, 1000u);
+  EXPECT_EQ(frameClock.NextTickTime(), epoch + 1000 * 10ms + 10ms);
+}
+
+/////////////////////////////////////////////////
+TEST(FrameClockTest, OverrunStats)
+{
+  math::FrameClock frameClock(10ms);
+  const math::clock::time_point epoch(3000s);
+  frameClock.Start(epoch);
+
+  // Three frames on pace, one that missed two deadlines.
+  frameClock.Update(epoch + 10ms);
+  frameClock.Update(epoch + 20ms);
+  frameClock.Update(epoch + 30ms);
+  EXPECT_EQ(frameClock.Update(epoch + 60ms), 3u);
+
+  auto overrun = frameClock.OverrunStats().Map();
+  EXPECT_DOUBLE_EQ(overrun.at("max"), 0.02);
+  EXPECT_DOUBLE_EQ(overrun.at("min"), 0.0);
+  EXPECT_NEAR(overrun.at("mean"), 0.005, 1e-9);
+
+  auto frames = frameClock.FrameStats().Map();
+  EXPECT_NEAR(frames.at("max"), 0.03, 1e-9);
+  EXPECT_NEAR(frames.at("min"), 0.01, 1e-9);
+
+  // Reset stops the clock and clears the statistics.
+  frameClock.Reset();
+  EXPECT_FALSE(frameClock.Running());
+  EXPECT_EQ(frameClock.TickCount(), 0u);
+  EXPECT_EQ(frameClock.OverrunStats().Count(), 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(FrameClockTest, Phases)
+{
+  math::FrameClock frameClock(10ms);
+  frameClock.SetPhaseBudget("physics", 1h);
+  EXPECT_EQ(frameClock.PhaseBudget("physics"), 1h);
+  EXPECT_EQ(frameClock.PhaseBudget("unknown"),
+      math::clock::duration::zero());
+
+  // Phases do not nest.
+  EXPECT_TRUE(frameClock.BeginPhase("physics"));
+  EXPECT_FALSE(frameClock.BeginPhase("render"));
+  EXPECT_TRUE(frameClock.EndPhase());
+  EXPECT_FALSE(frameClock.EndPhase());
+
+  // The generous budget is never overrun.
+  EXPECT_GT(frameClock.PhaseElapsed("physics"),
+      math::clock::duration::zero());
+  EXPECT_EQ(frameClock.PhaseStats("physics").Count(), 1u);
+  EXPECT_DOUBLE_EQ(
+      frameClock.PhaseOverrunStats("physics").Map().at("max"), 0.0);
+
+  // A phase with a tiny budget records its overrun.
+  frameClock.SetPhaseBudget("render", 1ns);
+  EXPECT_TRUE(frameClock.BeginPhase("render"));
+  volatile double sink = 0.0;
+  for (int i = 0; i < 100000; ++i)
+    sink = sink + 1.0;
+  EXPECT_TRUE(frameClock.EndPhase());
+  EXPECT_GT(frameClock.PhaseOverrunStats("render").Map().at("max"), 0.0);
+
+  // Unknown phases yield empty statistics.
+  EXPECT_EQ(frameClock.PhaseStats("unknown").Count(), 0u);
+  EXPECT_TRUE(frameClock.PhaseStats("unknown").Map().empty());
+}
@@ -15,6 +15,8 @@
  *
 */
 #include <cmath>
+#include <iostream>
+#include <vector>
 
 #include "ignition/math/AxisAlignedBox.hh"
 #include "ignition/math/Frustum.hh"
@@ -55,8 +57,9 @@ Frustum::Frustum(const Frustum &_p)
   : dataPtr(new FrustumPrivate(_p.Near(), _p.Far(), _p.FOV(),
         _p.AspectRatio(), _p.Pose()))
 {
-  for (int i = 0; i < 6; ++i)
-    this->dataPtr->planes[i] = _p.dataPtr->planes[i];
+  // Rebuild the cached local geometry as well as the planes, so a
+  // later SetPose on the copy transforms valid data.
+  this->ComputePlanes();
 }
 
 /////////////////////////////////////////////////
@@ -65,6 +68,14 @@ Planed Frustum::Plane(const FrustumPlane _plane) const
   return this->dataPtr->planes[_plane];
 }
 
+/////////////////////////////////////////////////
+const Vector3d &Frustum::Vertex(const unsigned int _index) const
+{
+  if (_index >= this->dataPtr->points.size())
+    return this->dataPtr->points[0];
+  return this->dataPtr->points[_index];
+}
+
 /////////////////////////////////////////////////
 bool Frustum::Contains(const AxisAlignedBox &_b) const
 {
@@ -149,6 +160,115 @@ bool Frustum::Contains(const AxisAlignedBox &_b) const
   return true;
 }
 
+/////////////////////////////////////////////////
+void Frustum::ContainsBatch(const AxisAlignedBox *_boxes, size_t _n,
+    uint8_t *_results) const
+{
+  // Load the plane parameters once; the box test below only needs the
+  // normal and offset of each plane.
+  Vector3d normals[6];
+  double offsets[6];
+  for (int p = 0; p < 6; ++p)
+  {
+    normals[p] = this->dataPtr->planes[p].Normal();
+    offsets[p] = this->dataPtr->planes[p].Offset();
+  }
+
+  // Most boxes of a culling batch are rejected by the same plane as their
+  // neighbor, so start each box's plane loop at the previous rejector.
+  int lastReject = 0;
+
+  for (size_t i = 0; i < _n; ++i)
+  {
+    const Vector3d center = _boxes[i].Center();
+    const Vector3d half = _boxes[i].Size() / 2.0;
+
+    int overlapping = 0;
+    bool rejected = false;
+
+    for (int p = 0; p < 6 && !rejected; ++p)
+    {
+      const int plane = (lastReject + p) % 6;
+      const double dist = normals[plane].Dot(center) - offsets[plane];
+      const double maxAbsDist = normals[plane].AbsDot(half);
+
+      if (dist < -maxAbsDist)
+      {
+        rejected = true;
+        lastReject = plane;
+      }
+      else if (dist <= maxAbsDist)
+      {
+        ++overlapping;
+      }
+    }
+
+    if (rejected)
+      _results[i] = 0;
+    else if (overlapping < 2)
+      _results[i] = 1;
+    else
+    {
+      // Boxes straddling several planes need the exact corner and edge
+      // checks; defer to the scalar test.
+      _results[i] = this->Contains(_boxes[i]) ? 1 : 0;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+bool Frustum::Contains(const Vector3d &_center, const double _radius) const
+{
+  // A sphere is outside as soon as its center is more than a radius
+  // behind any plane; no corner selection is needed.
+  for (auto const &plane : this->dataPtr->planes)
+  {
+    if (plane.Distance(_center) < -_radius)
+      return false;
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void Frustum::ContainsBatch(const Vector3d *_centers, const double *_radii,
+    size_t _n, uint8_t *_results) const
+{
+  // Load the plane parameters once, as in the box batch.
+  Vector3d normals[6];
+  double offsets[6];
+  for (int p = 0; p < 6; ++p)
+  {
+    normals[p] = this->dataPtr->planes[p].Normal();
+    offsets[p] = this->dataPtr->planes[p].Offset();
+  }
+
+  // Start each sphere's plane loop at the previous rejector; culling
+  // batches are spatially coherent, so neighbors usually fail the
+  // same plane.
+  int lastReject = 0;
+
+  for (size_t i = 0; i < _n; ++i)
+  {
+    const Vector3d &center = _centers[i];
+    const double radius = _radii[i];
+    bool inside = true;
+
+    for (int p = 0; p < 6; ++p)
+    {
+      const int plane = (lastReject + p) % 6;
+      if (normals[plane].Dot(center) - offsets[plane] < -radius)
+      {
+        inside = false;
+        lastReject = plane;
+        break;
+      }
+    }
+
+    _results[i] = inside ? 1 : 0;
+  }
+}
+
 /////////////////////////////////////////////////
 bool Frustum::Contains(const Vector3d &_p) const
 {
@@ -211,8 +331,11 @@ Pose3d Frustum::Pose() const
 /////////////////////////////////////////////////
 void Frustum::SetPose(const Pose3d &_pose)
 {
+  // The local-frame geometry only depends on near, far, fov and
+  // aspect ratio, so a pose change is a rigid transform of the cached
+  // points and planes.
   this->dataPtr->pose = _pose;
-  this->ComputePlanes();
+  this->ApplyPose();
 }
 
 /////////////////////////////////////////////////
@@ -246,24 +369,16 @@ void Frustum::ComputePlanes()
   // Height of far plane
   double farHeight = farWidth / this->dataPtr->aspectRatio;
 
-  // Up, right, and forward unit vectors.
-  Vector3d forward = this->dataPtr->pose.Rot().RotateVector(Vector3d::UnitX);
-  Vector3d up = this->dataPtr->pose.Rot().RotateVector(Vector3d::UnitZ);
-  Vector3d right = this->dataPtr->pose.Rot().RotateVector(-Vector3d::UnitY);
-
-  // Near plane center
-  Vector3d nearCenter = this->dataPtr->pose.Pos() + forward *
-    this->dataPtr->near;
-
-  // Far plane center
-  Vector3d farCenter = this->dataPtr->pose.Pos() + forward *
-    this->dataPtr->far;
+  // In the local frame the frustum looks along +X with +Z up and
+  // -Y to the right; the pose is applied afterwards in ApplyPose.
+  Vector3d nearCenter = Vector3d::UnitX * this->dataPtr->near;
+  Vector3d farCenter = Vector3d::UnitX * this->dataPtr->far;
 
   // These four variables are here for convenience.
-  Vector3d upNearHeight2 = up * (nearHeight * 0.5);
-  Vector3d rightNearWidth2 = right * (nearWidth * 0.5);
-  Vector3d upFarHeight2 = up * (farHeight * 0.5);
-  Vector3d rightFarWidth2 = right * (farWidth * 0.5);
+  Vector3d upNearHeight2 = Vector3d::UnitZ * (nearHeight * 0.5);
+  Vector3d rightNearWidth2 = -Vector3d::UnitY * (nearWidth * 0.5);
+  Vector3d upFarHeight2 = Vector3d::UnitZ * (farHeight * 0.5);
+  Vector3d rightFarWidth2 = -Vector3d::UnitY * (farWidth * 0.5);
 
   // Compute the vertices of the near plane
   Vector3d nearTopLeft = nearCenter + upNearHeight2 - rightNearWidth2;
@@ -278,28 +393,14 @@ void Frustum::ComputePlanes()
   Vector3d farBottomRight = farCenter - upFarHeight2 + rightFarWidth2;
 
   // Save these vertices
-  this->dataPtr->points[0] = nearTopLeft;
-  this->dataPtr->points[1] = nearTopRight;
-  this->dataPtr->points[2] = nearBottomLeft;
-  this->dataPtr->points[3] = nearBottomRight;
-  this->dataPtr->points[4] = farTopLeft;
-  this->dataPtr->points[5] = farTopRight;
-  this->dataPtr->points[6] = farBottomLeft;
-  this->dataPtr->points[7] = farBottomRight;
-
-  // Save the edges
-  this->dataPtr->edges[0] = {nearTopLeft, nearTopRight};
-  this->dataPtr->edges[1] = {nearTopLeft, nearBottomLeft};
-  this->dataPtr->edges[2] = {nearTopLeft, farTopLeft};
-  this->dataPtr->edges[3] = {nearTopRight, nearBottomRight};
-  this->dataPtr->edges[4] = {nearTopRight, farTopRight};
-  this->dataPtr->edges[5] = {nearBottomLeft, nearBottomRight};
-  this->dataPtr->edges[6] = {nearBottomLeft, farBottomLeft};
-  this->dataPtr->edges[7] = {farTopLeft, farTopRight};
-  this->dataPtr->edges[8] = {farTopLeft, farBottomLeft};
-  this->dataPtr->edges[9] = {farTopRight, farBottomRight};
-  this->dataPtr->edges[10] = {farBottomLeft, farBottomRight};
-  this->dataPtr->edges[11] = {farBottomRight, nearBottomRight};
+  this->dataPtr->localPoints[0] = nearTopLeft;
+  this->dataPtr->localPoints[1] = nearTopRight;
+  this->dataPtr->localPoints[2] = nearBottomLeft;
+  this->dataPtr->localPoints[3] = nearBottomRight;
+  this->dataPtr->localPoints[4] = farTopLeft;
+  this->dataPtr->localPoints[5] = farTopRight;
+  this->dataPtr->localPoints[6] = farBottomLeft;
+  this->dataPtr->localPoints[7] = farBottomRight;
 
   Vector3d leftCenter =
     (farTopLeft + nearTopLeft + farBottomLeft + nearBottomLeft) / 4.0;
@@ -317,22 +418,69 @@ void Frustum::ComputePlanes()
   // Set the planes, where the first value is the plane normal and the
   // second the plane offset
   Vector3d norm = Vector3d::Normal(nearTopLeft, nearTopRight, nearBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_NEAR].Set(norm, nearCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_NEAR].Set(
+      norm, nearCenter.Dot(norm));
 
   norm = Vector3d::Normal(farTopRight, farTopLeft, farBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_FAR].Set(norm, farCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_FAR].Set(
+      norm, farCenter.Dot(norm));
 
   norm = Vector3d::Normal(farTopLeft, nearTopLeft, nearBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_LEFT].Set(norm, leftCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_LEFT].Set(
+      norm, leftCenter.Dot(norm));
 
   norm = Vector3d::Normal(nearTopRight, farTopRight, farBottomRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_RIGHT].Set(norm, rightCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_RIGHT].Set(
+      norm, rightCenter.Dot(norm));
 
   norm = Vector3d::Normal(nearTopLeft, farTopLeft, nearTopRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_TOP].Set(norm, topCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_TOP].Set(
+      norm, topCenter.Dot(norm));
 
   norm = Vector3d::Normal(nearBottomLeft, nearBottomRight, farBottomRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_BOTTOM].Set(norm, bottomCenter.Dot(norm));
+  this->dataPtr->localPlanes[FRUSTUM_PLANE_BOTTOM].Set(
+      norm, bottomCenter.Dot(norm));
+
+  this->ApplyPose();
+}
+
+/////////////////////////////////////////////////
+void Frustum::ApplyPose()
+{
+  const Quaterniond &rot = this->dataPtr->pose.Rot();
+  const Vector3d &pos = this->dataPtr->pose.Pos();
+
+  // Transform the corner points.
+  for (size_t i = 0; i < this->dataPtr->points.size(); ++i)
+  {
+    this->dataPtr->points[i] =
+        pos + rot.RotateVector(this->dataPtr->localPoints[i]);
+  }
+
+  // Rebuild the edges from the transformed points.
+  const auto &pts = this->dataPtr->points;
+  this->dataPtr->edges[0] = {pts[0], pts[1]};
+  this->dataPtr->edges[1] = {pts[0], pts[2]};
+  this->dataPtr->edges[2] = {pts[0], pts[4]};
+  this->dataPtr->edges[3] = {pts[1], pts[3]};
+  this->dataPtr->edges[4] = {pts[1], pts[5]};
+  this->dataPtr->edges[5] = {pts[2], pts[3]};
+  this->dataPtr->edges[6] = {pts[2], pts[6]};
+  this->dataPtr->edges[7] = {pts[4], pts[5]};
+  this->dataPtr->edges[8] = {pts[4], pts[6]};
+  this->dataPtr->edges[9] = {pts[5], pts[7]};
+  this->dataPtr->edges[10] = {pts[6], pts[7]};
+  this->dataPtr->edges[11] = {pts[7], pts[3]};
+
+  // A rigid transform maps a plane n.x = d to n'.x = d + n'.t with
+  // the rotated normal n'.
+  for (size_t i = 0; i < this->dataPtr->planes.size(); ++i)
+  {
+    const Vector3d normal =
+        rot.RotateVector(this->dataPtr->localPlanes[i].Normal());
+    this->dataPtr->planes[i].Set(normal,
+        this->dataPtr->localPlanes[i].Offset() + normal.Dot(pos));
+  }
 }
 
 //////////////////////////////////////////////////
@@ -347,3 +495,247 @@ Frustum &Frustum::operator =(const Frustum &_f)
 
   return *this;
 }
+
+/////////////////////////////////////////////////
+/// \brief Private data for the MultiViewFrustum class.
+class ignition::math::MultiViewFrustumPrivate
+{
+  /// \brief Constructor.
+  public: MultiViewFrustumPrivate(const double _near, const double _far,
+              const Angle &_fov, const double _aspectRatio)
+    : canonical(_near, _far, _fov, _aspectRatio, Pose3d::Zero),
+      exact(canonical)
+  {
+  }
+
+  /// \brief Frustum holding the shared intrinsics at the zero pose;
+  /// its planes are the canonical set the views are derived from.
+  public: Frustum canonical;
+
+  /// \brief Scratch frustum used for the exact corner and edge tests
+  /// of boxes that straddle several planes of a view.
+  public: mutable Frustum exact;
+
+  /// \brief Pose of each view.
+  public: std::vector<Pose3d> poses;
+
+  /// \brief Plane normals of every view, six per view, derived from
+  /// the canonical planes. Stored flat so the culling sweep streams
+  /// through them.
+  public: std::vector<Vector3d> normals;
+
+  /// \brief Plane offsets of every view, six per view.
+  public: std::vector<double> offsets;
+};
+
+/////////////////////////////////////////////////
+MultiViewFrustum::MultiViewFrustum(const double _near, const double _far,
+    const Angle &_fov, const double _aspectRatio)
+  : dataPtr(new MultiViewFrustumPrivate(_near, _far, _fov, _aspectRatio))
+{
+}
+
+/////////////////////////////////////////////////
+MultiViewFrustum::~MultiViewFrustum()
+{
+  delete this->dataPtr;
+  this->dataPtr = nullptr;
+}
+
+/////////////////////////////////////////////////
+bool MultiViewFrustum::AddView(const Pose3d &_pose)
+{
+  if (this->dataPtr->poses.size() >= MaxViews)
+  {
+    std::cerr << "MultiViewFrustum::AddView() error: the visibility mask"
+              << " holds at most [" << MaxViews << "] views" << std::endl;
+    return false;
+  }
+
+  this->dataPtr->poses.push_back(_pose);
+  this->dataPtr->normals.resize(this->dataPtr->poses.size() * 6);
+  this->dataPtr->offsets.resize(this->dataPtr->poses.size() * 6);
+  this->ComputeViewPlanes(this->dataPtr->poses.size() - 1);
+  return true;
+}
+
+/////////////////////////////////////////////////
+size_t MultiViewFrustum::ViewCount() const
+{
+  return this->dataPtr->poses.size();
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::SetViewPose(const size_t _view, const Pose3d &_pose)
+{
+  if (_view >= this->dataPtr->poses.size())
+    return;
+
+  this->dataPtr->poses[_view] = _pose;
+  this->ComputeViewPlanes(_view);
+}
+
+/////////////////////////////////////////////////
+Pose3d MultiViewFrustum::ViewPose(const size_t _view) const
+{
+  if (_view >= this->dataPtr->poses.size())
+    return Pose3d::Zero;
+  return this->dataPtr->poses[_view];
+}
+
+/////////////////////////////////////////////////
+uint32_t MultiViewFrustum::Contains(const AxisAlignedBox &_b) const
+{
+  const size_t views = this->dataPtr->poses.size();
+  uint32_t mask = 0;
+
+  const Vector3d center = _b.Center();
+  const Vector3d half = _b.Size() / 2.0;
+
+  for (size_t v = 0; v < views; ++v)
+  {
+    int overlapping = 0;
+    bool rejected = false;
+
+    for (int p = 0; p < 6 && !rejected; ++p)
+    {
+      const Vector3d &normal = this->dataPtr->normals[v * 6 + p];
+      const double dist =
+          normal.Dot(center) - this->dataPtr->offsets[v * 6 + p];
+      const double maxAbsDist = normal.AbsDot(half);
+
+      if (dist < -maxAbsDist)
+        rejected = true;
+      else if (dist <= maxAbsDist)
+        ++overlapping;
+    }
+
+    if (rejected)
+      continue;
+
+    if (overlapping < 2)
+    {
+      mask |= uint32_t(1) << v;
+      continue;
+    }
+
+    // Boxes straddling several planes need the exact corner and edge
+    // checks; re-pose the scratch frustum, which does not recompute
+    // the canonical geometry.
+    this->dataPtr->exact.SetPose(this->dataPtr->poses[v]);
+    if (this->dataPtr->exact.Contains(_b))
+      mask |= uint32_t(1) << v;
+  }
+
+  return mask;
+}
+
+/////////////////////////////////////////////////
+uint32_t MultiViewFrustum::Contains(const Vector3d &_p) const
+{
+  const size_t views = this->dataPtr->poses.size();
+  uint32_t mask = 0;
+
+  for (size_t v = 0; v < views; ++v)
+  {
+    bool inside = true;
+    for (int p = 0; p < 6 && inside; ++p)
+    {
+      inside = this->dataPtr->normals[v * 6 + p].Dot(_p) >=
+          this->dataPtr->offsets[v * 6 + p];
+    }
+    if (inside)
+      mask |= uint32_t(1) << v;
+  }
+
+  return mask;
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::ContainsBatch(const AxisAlignedBox *_boxes, size_t _n,
+    uint32_t *_masks) const
+{
+  // One pass over the boxes: the center and half extents of each box
+  // are computed once and tested against every view.
+  for (size_t i = 0; i < _n; ++i)
+    _masks[i] = this->Contains(_boxes[i]);
+}
+
+/////////////////////////////////////////////////
+double MultiViewFrustum::Near() const
+{
+  return this->dataPtr->canonical.Near();
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::SetNear(const double _near)
+{
+  this->dataPtr->canonical.SetNear(_near);
+  this->dataPtr->exact.SetNear(_near);
+  for (size_t v = 0; v < this->dataPtr->poses.size(); ++v)
+    this->ComputeViewPlanes(v);
+}
+
+/////////////////////////////////////////////////
+double MultiViewFrustum::Far() const
+{
+  return this->dataPtr->canonical.Far();
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::SetFar(const double _far)
+{
+  this->dataPtr->canonical.SetFar(_far);
+  this->dataPtr->exact.SetFar(_far);
+  for (size_t v = 0; v < this->dataPtr->poses.size(); ++v)
+    this->ComputeViewPlanes(v);
+}
+
+/////////////////////////////////////////////////
+Angle MultiViewFrustum::FOV() const
+{
+  return this->dataPtr->canonical.FOV();
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::SetFOV(const Angle &_fov)
+{
+  this->dataPtr->canonical.SetFOV(_fov);
+  this->dataPtr->exact.SetFOV(_fov);
+  for (size_t v = 0; v < this->dataPtr->poses.size(); ++v)
+    this->ComputeViewPlanes(v);
+}
+
+/////////////////////////////////////////////////
+double MultiViewFrustum::AspectRatio() const
+{
+  return this->dataPtr->canonical.AspectRatio();
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::SetAspectRatio(const double _aspectRatio)
+{
+  this->dataPtr->canonical.SetAspectRatio(_aspectRatio);
+  this->dataPtr->exact.SetAspectRatio(_aspectRatio);
+  for (size_t v = 0; v < this->dataPtr->poses.size(); ++v)
+    this->ComputeViewPlanes(v);
+}
+
+/////////////////////////////////////////////////
+void MultiViewFrustum::ComputeViewPlanes(const size_t _view)
+{
+  // A rigid transform maps a canonical plane n.x = d to n'.x =
+  // d + n'.t with the rotated normal n', as in Frustum::ApplyPose.
+  const Quaterniond &rot = this->dataPtr->poses[_view].Rot();
+  const Vector3d &pos = this->dataPtr->poses[_view].Pos();
+
+  for (int p = 0; p < 6; ++p)
+  {
+    const Planed canonical = this->dataPtr->canonical.Plane(
+        static_cast<Frustum::FrustumPlane>(p));
+    const Vector3d normal = rot.RotateVector(canonical.Normal());
+    this->dataPtr->normals[_view * 6 + p] = normal;
+    this->dataPtr->offsets[_view * 6 + p] =
+        canonical.Offset() + normal.Dot(pos);
+  }
+}
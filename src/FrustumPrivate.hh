@@ -18,10 +18,12 @@
 #define IGNITION_MATH_FRUSTUMPRIVATE_HH_
 
 #include <array>
+#include <cstddef>
 #include <utility>
 #include <ignition/math/Pose3.hh>
 #include <ignition/math/Angle.hh>
 #include <ignition/math/Plane.hh>
+#include <ignition/math/MemoryPool.hh>
 #include <ignition/math/config.hh>
 
 namespace ignition
@@ -81,6 +83,30 @@ namespace ignition
 
       /// \brief each edge of the frustum.
       public: std::array<std::pair<Vector3d, Vector3d>, 12> edges;
+
+      /// \brief Corner points in the frustum's local frame, derived
+      /// only from near, far, fov and aspect ratio. Cached so a pose
+      /// change is a rigid transform instead of a full rebuild.
+      public: std::array<Vector3d, 8> localPoints;
+
+      /// \brief Planes in the frustum's local frame, cached alongside
+      /// \sa localPoints.
+      public: std::array<Planed, 6> localPlanes;
+
+      /// \brief Frustums are created and destroyed in bursts, so the
+      /// private data lives in the shared pool instead of going
+      /// through the global allocator each time.
+      public: static void *operator new(std::size_t)
+      {
+        return MemoryPool<FrustumPrivate>::Instance().Allocate();
+      }
+
+      /// \brief Return the slot obtained from operator new.
+      /// \param[in] _ptr Pointer to the slot.
+      public: static void operator delete(void *_ptr)
+      {
+        MemoryPool<FrustumPrivate>::Instance().Deallocate(_ptr);
+      }
     };
     }
   }
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Frustum.hh"
 
@@ -659,3 +661,257 @@ TEST(FrustumTest, AABBBFWall)
   EXPECT_TRUE(frustum.Contains(
         AxisAlignedBox(Vector3d(-10, -10, 1.95), Vector3d(10, 10, 2.05))));
 }
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, ContainsBatch)
+{
+  math::Frustum frustum(
+      // Near distance
+      1,
+      // Far distance
+      10,
+      // Field of view
+      math::Angle(IGN_DTOR(45)),
+      // Aspect ratio
+      320.0/240.0,
+      // Pose
+      math::Pose3d(0, 0, 0, 0, 0, 0));
+
+  // A mix of boxes inside, outside and straddling the frustum.
+  std::vector<math::AxisAlignedBox> boxes;
+  boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(1, -1, -1), math::Vector3d(2, 1, 1)));
+  boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(-2, -1, -1), math::Vector3d(-1, 1, 1)));
+  boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(0, -1, -1), math::Vector3d(2, 1, 1)));
+  boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(11, -1, -1), math::Vector3d(12, 1, 1)));
+  boxes.push_back(math::AxisAlignedBox(
+        math::Vector3d(2, -6, -1), math::Vector3d(3, -5.5, 1)));
+  for (int i = 0; i < 20; ++i)
+  {
+    boxes.push_back(math::AxisAlignedBox(
+          math::Vector3d(i * 0.7, i - 10.0, -0.5),
+          math::Vector3d(i * 0.7 + 1, i - 9.0, 0.5)));
+  }
+
+  std::vector<uint8_t> results(boxes.size(), 2);
+  frustum.ContainsBatch(boxes.data(), boxes.size(), results.data());
+
+  // The batch must agree with the scalar test on every box.
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    EXPECT_EQ(results[i], frustum.Contains(boxes[i]) ? 1 : 0)
+        << "box " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, ContainsSphere)
+{
+  math::Frustum frustum(
+      // Near distance
+      1,
+      // Far distance
+      10,
+      // Field of view
+      math::Angle(IGN_DTOR(45)),
+      // Aspect ratio
+      320.0/240.0,
+      // Pose
+      math::Pose3d(0, 0, 0, 0, 0, 0));
+
+  // Inside, straddling the near plane, and outside on each side.
+  EXPECT_TRUE(frustum.Contains(math::Vector3d(5, 0, 0), 0.5));
+  EXPECT_TRUE(frustum.Contains(math::Vector3d(0.9, 0, 0), 0.2));
+  EXPECT_FALSE(frustum.Contains(math::Vector3d(0.5, 0, 0), 0.2));
+  EXPECT_FALSE(frustum.Contains(math::Vector3d(-2, 0, 0), 1.0));
+  EXPECT_FALSE(frustum.Contains(math::Vector3d(12, 0, 0), 1.0));
+  EXPECT_FALSE(frustum.Contains(math::Vector3d(5, -10, 0), 1.0));
+
+  // A sphere containing the whole frustum is reported as contained.
+  EXPECT_TRUE(frustum.Contains(math::Vector3d(5, 0, 0), 50.0));
+
+  // The radius-zero test agrees with the point test.
+  for (int i = 0; i < 50; ++i)
+  {
+    const math::Vector3d point(0.4 * i, 0.3 * i - 7.0, 0.1 * i - 2.0);
+    EXPECT_EQ(frustum.Contains(point),
+        frustum.Contains(point, 0.0)) << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, ContainsSphereBatch)
+{
+  math::Frustum frustum(
+      // Near distance
+      1,
+      // Far distance
+      10,
+      // Field of view
+      math::Angle(IGN_DTOR(45)),
+      // Aspect ratio
+      320.0/240.0,
+      // Pose
+      math::Pose3d(0, 0, 0, 0, 0, 0));
+
+  // A mix of spheres inside, outside and straddling the frustum.
+  std::vector<math::Vector3d> centers;
+  std::vector<double> radii;
+  for (int i = 0; i < 40; ++i)
+  {
+    centers.push_back(math::Vector3d(
+        0.5 * i - 3.0, 0.4 * i - 8.0, 0.2 * i - 4.0));
+    radii.push_back(0.1 + 0.05 * (i % 7));
+  }
+
+  std::vector<uint8_t> results(centers.size(), 2);
+  frustum.ContainsBatch(centers.data(), radii.data(), centers.size(),
+      results.data());
+
+  // The batch must agree with the scalar test on every sphere.
+  for (size_t i = 0; i < centers.size(); ++i)
+  {
+    EXPECT_EQ(results[i], frustum.Contains(centers[i], radii[i]) ? 1 : 0)
+        << "sphere " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, Vertices)
+{
+  Frustum frustum(1.0, 10.0, math::Angle(IGN_DTOR(45)), 1.3,
+      Pose3d(0, 0, 0, 0, 0, 0));
+
+  // Near corners sit on the near plane, far corners on the far plane.
+  for (unsigned int i = 0; i < 4; ++i)
+    EXPECT_NEAR(1.0, frustum.Vertex(i).X(), 1e-10);
+  for (unsigned int i = 4; i < 8; ++i)
+    EXPECT_NEAR(10.0, frustum.Vertex(i).X(), 1e-10);
+
+  // Top corners above bottom corners, left of right corners.
+  EXPECT_GT(frustum.Vertex(0).Z(), frustum.Vertex(2).Z());
+  EXPECT_GT(frustum.Vertex(4).Z(), frustum.Vertex(6).Z());
+  EXPECT_GT(frustum.Vertex(0).Y(), frustum.Vertex(1).Y());
+
+  // An out-of-range index returns the first corner.
+  EXPECT_EQ(frustum.Vertex(0), frustum.Vertex(100));
+
+  // Updating the pose transforms the corners rigidly: the moved
+  // frustum matches one constructed directly at the new pose.
+  const Pose3d newPose(4, -2, 1, 0.3, -0.2, 1.1);
+  frustum.SetPose(newPose);
+  Frustum rebuilt(1.0, 10.0, math::Angle(IGN_DTOR(45)), 1.3, newPose);
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    EXPECT_NEAR(rebuilt.Vertex(i).X(), frustum.Vertex(i).X(), 1e-10);
+    EXPECT_NEAR(rebuilt.Vertex(i).Y(), frustum.Vertex(i).Y(), 1e-10);
+    EXPECT_NEAR(rebuilt.Vertex(i).Z(), frustum.Vertex(i).Z(), 1e-10);
+  }
+  for (int i = 0; i < 6; ++i)
+  {
+    const auto plane = static_cast<Frustum::FrustumPlane>(i);
+    EXPECT_NEAR(rebuilt.Plane(plane).Offset(),
+        frustum.Plane(plane).Offset(), 1e-10);
+    EXPECT_NEAR(0.0, (rebuilt.Plane(plane).Normal() -
+        frustum.Plane(plane).Normal()).Length(), 1e-10);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, MultiViewFrustum)
+{
+  const double near = 1;
+  const double far = 10;
+  const math::Angle fov(IGN_DTOR(45));
+  const double aspect = 320.0/240.0;
+
+  // Four views: the poses of a small multi-camera rig.
+  std::vector<math::Pose3d> poses;
+  poses.push_back(math::Pose3d(0, -0.1, 0, 0, 0, 0));
+  poses.push_back(math::Pose3d(0, 0.1, 0, 0, 0, 0));
+  poses.push_back(math::Pose3d(0, 0, 0, 0, 0, IGN_PI_2));
+  poses.push_back(math::Pose3d(1, 2, 0.5, 0, 0.3, -IGN_PI_4));
+
+  math::MultiViewFrustum multi(near, far, fov, aspect);
+  std::vector<math::Frustum> reference;
+  for (const auto &pose : poses)
+  {
+    EXPECT_TRUE(multi.AddView(pose));
+    reference.push_back(math::Frustum(near, far, fov, aspect, pose));
+  }
+  EXPECT_EQ(poses.size(), multi.ViewCount());
+  EXPECT_EQ(poses[2], multi.ViewPose(2));
+  EXPECT_EQ(math::Pose3d::Zero, multi.ViewPose(99));
+
+  // A mix of boxes inside, outside and straddling the views.
+  std::vector<math::AxisAlignedBox> boxes;
+  for (int i = 0; i < 30; ++i)
+  {
+    boxes.push_back(math::AxisAlignedBox(
+          math::Vector3d(i * 0.5 - 4.0, (i % 7) - 3.0, -0.5),
+          math::Vector3d(i * 0.5 - 3.0, (i % 7) - 2.0, 0.5)));
+  }
+
+  // The mask of each box must agree with the per-view Frustum tests,
+  // for boxes and for points.
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    const uint32_t mask = multi.Contains(boxes[i]);
+    const uint32_t pointMask = multi.Contains(boxes[i].Center());
+    for (size_t v = 0; v < reference.size(); ++v)
+    {
+      EXPECT_EQ(reference[v].Contains(boxes[i]),
+          static_cast<bool>((mask >> v) & 1)) << "box " << i << " view " << v;
+      EXPECT_EQ(reference[v].Contains(boxes[i].Center()),
+          static_cast<bool>((pointMask >> v) & 1))
+          << "box " << i << " view " << v;
+    }
+  }
+
+  // The batch query agrees with the scalar one.
+  std::vector<uint32_t> masks(boxes.size(), 0xdeadu);
+  multi.ContainsBatch(boxes.data(), boxes.size(), masks.data());
+  for (size_t i = 0; i < boxes.size(); ++i)
+    EXPECT_EQ(multi.Contains(boxes[i]), masks[i]) << "box " << i;
+
+  // Re-posing a view tracks the reference frustum.
+  const math::Pose3d newPose(5, 0, 0, 0, 0, IGN_PI);
+  multi.SetViewPose(0, newPose);
+  reference[0].SetPose(newPose);
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    EXPECT_EQ(reference[0].Contains(boxes[i]),
+        static_cast<bool>(multi.Contains(boxes[i]) & 1)) << "box " << i;
+  }
+
+  // Changing a shared intrinsic updates every view.
+  multi.SetFar(3);
+  for (auto &frustum : reference)
+    frustum.SetFar(3);
+  EXPECT_DOUBLE_EQ(3.0, multi.Far());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    const uint32_t mask = multi.Contains(boxes[i]);
+    for (size_t v = 0; v < reference.size(); ++v)
+    {
+      EXPECT_EQ(reference[v].Contains(boxes[i]),
+          static_cast<bool>((mask >> v) & 1)) << "box " << i << " view " << v;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumTest, MultiViewFrustumMaxViews)
+{
+  math::MultiViewFrustum multi(1, 10, math::Angle(IGN_DTOR(45)), 1.0);
+  for (unsigned int i = 0; i < math::MultiViewFrustum::MaxViews; ++i)
+    EXPECT_TRUE(multi.AddView(math::Pose3d(i, 0, 0, 0, 0, 0)));
+
+  // The mask runs out of bits after MaxViews views.
+  EXPECT_FALSE(multi.AddView(math::Pose3d::Zero));
+  EXPECT_EQ(static_cast<size_t>(math::MultiViewFrustum::MaxViews),
+      multi.ViewCount());
+}
@@ -15,7 +15,12 @@
  *
 */
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include <ignition/math/GaussMarkovProcess.hh>
+#include <ignition/math/MemoryPool.hh>
 #include <ignition/math/Rand.hh>
 
 using namespace ignition::math;
@@ -37,6 +42,20 @@ class ignition::math::GaussMarkovProcessPrivate
 
   /// \brief Process sigma value.
   public: double sigma{0};
+
+  /// \brief Sensor farms churn through these objects, so the private
+  /// data is pooled rather than individually heap allocated.
+  public: static void *operator new(std::size_t)
+  {
+    return MemoryPool<GaussMarkovProcessPrivate>::Instance().Allocate();
+  }
+
+  /// \brief Return the slot obtained from operator new.
+  /// \param[in] _ptr Pointer to the slot.
+  public: static void operator delete(void *_ptr)
+  {
+    MemoryPool<GaussMarkovProcessPrivate>::Instance().Deallocate(_ptr);
+  }
 };
 
 //////////////////////////////////////////////////
@@ -122,3 +141,114 @@ double GaussMarkovProcess::Update(double _dt)
   // Output the new value.
   return this->dataPtr->value;
 }
+
+//////////////////////////////////////////////////
+class ignition::math::GaussMarkovProcessSetPrivate
+{
+  /// \brief Process start values.
+  public: std::vector<double> starts;
+
+  /// \brief Process theta values.
+  public: std::vector<double> thetas;
+
+  /// \brief Process mu values.
+  public: std::vector<double> mus;
+
+  /// \brief Process sigma values.
+  public: std::vector<double> sigmas;
+
+  /// \brief Current process values.
+  public: std::vector<double> values;
+
+  /// \brief Scratch buffer of normal draws, reused across updates.
+  public: std::vector<double> noise;
+
+  /// \brief Private generator for the normal draws, so updating the
+  /// set does not contend with users of the shared Rand generator.
+  public: RandomEngine engine{0};
+};
+
+//////////////////////////////////////////////////
+GaussMarkovProcessSet::GaussMarkovProcessSet(unsigned int _seed)
+  : dataPtr(new GaussMarkovProcessSetPrivate)
+{
+  this->dataPtr->engine.Seed(_seed);
+}
+
+//////////////////////////////////////////////////
+GaussMarkovProcessSet::~GaussMarkovProcessSet()
+{
+}
+
+//////////////////////////////////////////////////
+size_t GaussMarkovProcessSet::AddProcess(double _start, double _theta,
+    double _mu, double _sigma)
+{
+  this->dataPtr->starts.push_back(_start);
+  this->dataPtr->thetas.push_back(std::max(0.0, _theta));
+  this->dataPtr->mus.push_back(_mu);
+  this->dataPtr->sigmas.push_back(std::max(0.0, _sigma));
+  this->dataPtr->values.push_back(_start);
+  return this->dataPtr->values.size() - 1;
+}
+
+//////////////////////////////////////////////////
+size_t GaussMarkovProcessSet::Size() const
+{
+  return this->dataPtr->values.size();
+}
+
+//////////////////////////////////////////////////
+double GaussMarkovProcessSet::Value(size_t _index) const
+{
+  if (_index >= this->dataPtr->values.size())
+    return 0.0;
+  return this->dataPtr->values[_index];
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessSet::Values() const
+{
+  return this->dataPtr->values;
+}
+
+//////////////////////////////////////////////////
+void GaussMarkovProcessSet::Reset()
+{
+  this->dataPtr->values = this->dataPtr->starts;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessSet::Update(
+    const clock::duration &_dt)
+{
+  // Time difference in seconds
+  return this->Update(std::chrono::duration<double>(_dt).count());
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessSet::Update(double _dt)
+{
+  const size_t n = this->dataPtr->values.size();
+
+  // Draw all the noise first; the distribution's internal state makes
+  // the draw loop hard to vectorize, while the arithmetic sweep below
+  // is a straight contiguous pass.
+  this->dataPtr->noise.resize(n);
+  for (size_t i = 0; i < n; ++i)
+    this->dataPtr->noise[i] = this->dataPtr->engine.DblNormal(0, 1);
+
+  double *values = this->dataPtr->values.data();
+  const double *thetas = this->dataPtr->thetas.data();
+  const double *mus = this->dataPtr->mus.data();
+  const double *sigmas = this->dataPtr->sigmas.data();
+  const double *noise = this->dataPtr->noise.data();
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    values[i] += thetas[i] * (mus[i] - values[i]) * _dt +
+        sigmas[i] * noise[i];
+  }
+
+  return this->dataPtr->values;
+}
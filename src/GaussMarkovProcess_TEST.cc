@@ -103,3 +103,61 @@ TEST(GaussMarkovProcessTest, Noise)
   EXPECT_NEAR(-4.118732, gmp.Value(), 1e-4);
 #endif
 }
+
+//////////////////////////////////////////////////
+TEST(GaussMarkovProcessTest, SetMatchesScalarProcess)
+{
+  // With sigma == 0 the update is deterministic, so the set must track
+  // scalar processes exactly.
+  math::GaussMarkovProcessSet processSet;
+  math::GaussMarkovProcess p1(-1.2, 0.1, 2.5, 0);
+  math::GaussMarkovProcess p2(10.0, 0.5, -3.0, 0);
+  EXPECT_EQ(0u, processSet.AddProcess(-1.2, 0.1, 2.5, 0));
+  EXPECT_EQ(1u, processSet.AddProcess(10.0, 0.5, -3.0, 0));
+  EXPECT_EQ(2u, processSet.Size());
+
+  EXPECT_DOUBLE_EQ(-1.2, processSet.Value(0));
+  EXPECT_DOUBLE_EQ(10.0, processSet.Value(1));
+  // Out of range.
+  EXPECT_DOUBLE_EQ(0.0, processSet.Value(5));
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto &values = processSet.Update(0.1);
+    EXPECT_DOUBLE_EQ(p1.Update(0.1), values[0]);
+    EXPECT_DOUBLE_EQ(p2.Update(0.1), values[1]);
+  }
+
+  processSet.Reset();
+  EXPECT_DOUBLE_EQ(-1.2, processSet.Value(0));
+  EXPECT_DOUBLE_EQ(10.0, processSet.Value(1));
+}
+
+//////////////////////////////////////////////////
+TEST(GaussMarkovProcessTest, SetNoise)
+{
+  // Same seed gives the same trajectories; the noise actually moves
+  // the processes and they revert towards mu.
+  math::GaussMarkovProcessSet setA(42);
+  math::GaussMarkovProcessSet setB(42);
+  for (int i = 0; i < 100; ++i)
+  {
+    setA.AddProcess(0, 0.2, 5.0, 0.1);
+    setB.AddProcess(0, 0.2, 5.0, 0.1);
+  }
+
+  std::chrono::milliseconds dt(100);
+  for (int step = 0; step < 2000; ++step)
+  {
+    setA.Update(dt);
+    setB.Update(dt);
+  }
+
+  double sum = 0;
+  for (size_t i = 0; i < setA.Size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(setA.Value(i), setB.Value(i));
+    sum += setA.Value(i);
+  }
+  EXPECT_NEAR(5.0, sum / setA.Size(), 0.5);
+}
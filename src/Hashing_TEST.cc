@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <set>
+
+#include "ignition/math/Hashing.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(HashingTest, BitwiseEqual)
+{
+  math::BitwiseEqual<math::Vector3d> equal;
+
+  // Bit-exact: identical components compare equal.
+  EXPECT_TRUE(equal(math::Vector3d(1, 2, 3), math::Vector3d(1, 2, 3)));
+
+  // Unlike operator==, no tolerance: a difference well inside the
+  // default 1e-3 tolerance is a different key.
+  math::Vector3d a(1, 2, 3);
+  math::Vector3d b(1 + 1e-6, 2, 3);
+  EXPECT_EQ(a, b);
+  EXPECT_FALSE(equal(a, b));
+
+  // +0.0 and -0.0 are distinct keys; a NaN key equals itself.
+  EXPECT_FALSE(equal(math::Vector3d(0.0, 0, 0),
+                     math::Vector3d(-0.0, 0, 0)));
+  const double nan = std::nan("");
+  EXPECT_TRUE(equal(math::Vector3d(nan, 0, 0), math::Vector3d(nan, 0, 0)));
+
+  math::BitwiseEqual<math::Pose3d> poseEqual;
+  math::Pose3d pose(1, 2, 3, 0.1, 0.2, 0.3);
+  EXPECT_TRUE(poseEqual(pose, pose));
+  EXPECT_FALSE(poseEqual(pose, math::Pose3d(1, 2, 3, 0.1, 0.2, 0.30001)));
+}
+
+/////////////////////////////////////////////////
+TEST(HashingTest, HashConsistency)
+{
+  // Equal keys hash equally.
+  math::BitwiseHash<math::Vector3i> hash;
+  EXPECT_EQ(hash(math::Vector3i(1, 2, 3)), hash(math::Vector3i(1, 2, 3)));
+
+  // Components are not interchangeable: permutations of the same
+  // values hash differently, unlike a plain xor of component hashes.
+  EXPECT_NE(hash(math::Vector3i(1, 2, 3)), hash(math::Vector3i(3, 2, 1)));
+  EXPECT_NE(hash(math::Vector3i(1, 2, 3)), hash(math::Vector3i(2, 1, 3)));
+  EXPECT_NE(hash(math::Vector3i(1, 0, 0)), hash(math::Vector3i(0, 1, 0)));
+
+  // A dense block of grid cells produces no duplicate hashes, so a
+  // hash-grid broadphase gets one cell per bucket in the common case.
+  std::set<std::size_t> seen;
+  for (int x = -8; x < 8; ++x)
+    for (int y = -8; y < 8; ++y)
+      for (int z = -8; z < 8; ++z)
+        seen.insert(hash(math::Vector3i(x, y, z)));
+  EXPECT_EQ(seen.size(), 16u * 16u * 16u);
+
+  // The other instantiations are exercised through their hashers.
+  math::BitwiseHash<math::Vector2d> hash2;
+  EXPECT_NE(hash2(math::Vector2d(1, 2)), hash2(math::Vector2d(2, 1)));
+  math::BitwiseHash<math::Vector4f> hash4;
+  EXPECT_NE(hash4(math::Vector4f(1, 2, 3, 4)),
+            hash4(math::Vector4f(4, 3, 2, 1)));
+  math::BitwiseHash<math::Pose3d> poseHash;
+  EXPECT_EQ(poseHash(math::Pose3d(1, 2, 3, 0, 0, 0)),
+            poseHash(math::Pose3d(1, 2, 3, 0, 0, 0)));
+  EXPECT_NE(poseHash(math::Pose3d(1, 2, 3, 0, 0, 0)),
+            poseHash(math::Pose3d(3, 2, 1, 0, 0, 0)));
+}
+
+/////////////////////////////////////////////////
+TEST(HashingTest, UnorderedContainers)
+{
+  // A map keyed by cell coordinates, as a hash-grid broadphase keys
+  // its buckets.
+  math::UnorderedMap<math::Vector3i, int> grid;
+  grid[math::Vector3i(0, 0, 0)] = 1;
+  grid[math::Vector3i(1, 0, 0)] = 2;
+  grid[math::Vector3i(0, 0, 0)] += 10;
+  EXPECT_EQ(grid.size(), 2u);
+  EXPECT_EQ(grid[math::Vector3i(0, 0, 0)], 11);
+  EXPECT_EQ(grid.count(math::Vector3i(2, 0, 0)), 0u);
+
+  // A set of pose snapshots deduplicates bit-exactly.
+  math::UnorderedSet<math::Pose3d> poses;
+  poses.insert(math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+  poses.insert(math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+  poses.insert(math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3001));
+  EXPECT_EQ(poses.size(), 2u);
+}
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <array>
+#include <vector>
+
 #include "ignition/math/Rand.hh"
 #include "ignition/math/Vector3.hh"
 #include "ignition/math/Helpers.hh"
@@ -933,3 +939,351 @@ TEST(HelpersTest, roundUpMultiple)
   EXPECT_EQ(0, math::roundUpMultiple(0, -2));
   EXPECT_EQ(-2, math::roundUpMultiple(-2, -2));
 }
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, Morton3d)
+{
+  // Round trip for a spread of coordinates, including the extremes.
+  for (uint32_t x : {0u, 1u, 2u, 511u, 767u, 1023u})
+  {
+    for (uint32_t y : {0u, 3u, 512u, 1023u})
+    {
+      for (uint32_t z : {0u, 5u, 1000u, 1023u})
+      {
+        uint32_t code = math::mortonEncode3d(x, y, z);
+        uint32_t dx, dy, dz;
+        math::mortonDecode3d(code, dx, dy, dz);
+        EXPECT_EQ(x, dx);
+        EXPECT_EQ(y, dy);
+        EXPECT_EQ(z, dz);
+      }
+    }
+  }
+
+  // Known interleavings: bit b of x lands at bit 3b of the code.
+  EXPECT_EQ(0u, math::mortonEncode3d(0, 0, 0));
+  EXPECT_EQ(1u, math::mortonEncode3d(1, 0, 0));
+  EXPECT_EQ(2u, math::mortonEncode3d(0, 1, 0));
+  EXPECT_EQ(4u, math::mortonEncode3d(0, 0, 1));
+  EXPECT_EQ(7u, math::mortonEncode3d(1, 1, 1));
+  EXPECT_EQ(8u, math::mortonEncode3d(2, 0, 0));
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, SortSpatially)
+{
+  // Points on a grid visited in a cache-hostile order.
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 4; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      for (int k = 0; k < 4; ++k)
+        points.push_back(math::Vector3d(k * 7 % 4, j, i));
+    }
+  }
+
+  std::vector<uint32_t> indices(points.size());
+  math::sortSpatially(points.data(), points.size(), indices.data());
+
+  // The result is a permutation of all indices.
+  std::vector<uint32_t> sorted = indices;
+  std::sort(sorted.begin(), sorted.end());
+  for (uint32_t i = 0; i < sorted.size(); ++i)
+    EXPECT_EQ(i, sorted[i]);
+
+  // Z-order on the unit cell: consecutive points stay close. The
+  // maximum step between Morton neighbors on a 4x4x4 grid is bounded
+  // well below the grid diameter.
+  double totalStep = 0.0;
+  for (size_t i = 1; i < indices.size(); ++i)
+    totalStep += points[indices[i]].Distance(points[indices[i - 1]]);
+  double randomOrderStep = 0.0;
+  for (size_t i = 1; i < points.size(); ++i)
+    randomOrderStep += points[i].Distance(points[i - 1]);
+  EXPECT_LT(totalStep, randomOrderStep);
+
+  // Degenerate cases: empty input and identical points.
+  math::sortSpatially(points.data(), 0, indices.data());
+  std::vector<math::Vector3d> same(5, math::Vector3d(1, 2, 3));
+  std::vector<uint32_t> sameIdx(5);
+  math::sortSpatially(same.data(), same.size(), sameIdx.data());
+  std::sort(sameIdx.begin(), sameIdx.end());
+  for (uint32_t i = 0; i < 5; ++i)
+    EXPECT_EQ(i, sameIdx[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, BatchHelpers)
+{
+  std::vector<double> values;
+  for (int i = 0; i < 300; ++i)
+    values.push_back(std::sin(0.1 * i) * 10.0);
+
+  // clampBatch agrees with clamp, in place included.
+  std::vector<double> clamped(values.size());
+  math::clampBatch(values.data(), values.size(), -4.0, 4.0,
+      clamped.data());
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_DOUBLE_EQ(math::clamp(values[i], -4.0, 4.0), clamped[i]);
+
+  std::vector<double> inPlace(values);
+  math::clampBatch(inPlace.data(), inPlace.size(), -4.0, 4.0,
+      inPlace.data());
+  EXPECT_EQ(clamped, inPlace);
+
+  // precisionBatch agrees with precision.
+  std::vector<double> rounded(values.size());
+  math::precisionBatch(values.data(), values.size(), 3, rounded.data());
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_DOUBLE_EQ(math::precision(values[i], 3), rounded[i]);
+
+  // minmaxBatch returns both extrema in one pass.
+  const auto extrema = math::minmaxBatch(values.data(), values.size());
+  EXPECT_DOUBLE_EQ(math::min(values), extrema.first);
+  EXPECT_DOUBLE_EQ(math::max(values), extrema.second);
+
+  // An empty array mirrors min() and max() on empty vectors.
+  const auto empty = math::minmaxBatch(values.data(), 0);
+  EXPECT_DOUBLE_EQ(std::numeric_limits<double>::max(), empty.first);
+  EXPECT_DOUBLE_EQ(std::numeric_limits<double>::lowest(), empty.second);
+
+  // Integer arrays work too.
+  const int ints[] = {5, -3, 9, 0};
+  const auto intExtrema = math::minmaxBatch(ints, 4);
+  EXPECT_EQ(-3, intExtrema.first);
+  EXPECT_EQ(9, intExtrema.second);
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, ConstexprTables)
+{
+  // The tables are usable in constant expressions; these asserts fail
+  // to compile if evaluation falls back to runtime.
+  constexpr auto sins = math::makeSinTable<64>();
+  constexpr auto coss = math::makeCosTable<64>();
+  constexpr auto kernel = math::makeGaussianKernel<9>(1.5);
+  static_assert(sins[0] == 0.0, "sin(0) must be exactly zero");
+  static_assert(coss[0] > 1.0 - 1e-12 && coss[0] < 1.0 + 1e-12,
+      "cos(0) must be one to within rounding");
+  static_assert(kernel[4] > kernel[3], "kernel must peak at the center");
+
+  for (std::size_t i = 0; i < sins.size(); ++i)
+  {
+    const double angle = 2.0 * IGN_PI * i / sins.size();
+    EXPECT_NEAR(sins[i], std::sin(angle), 1e-15) << i;
+    EXPECT_NEAR(coss[i], std::cos(angle), 1e-15) << i;
+  }
+
+  // The kernel is normalized, symmetric, and matches std::exp.
+  double sum = 0.0;
+  double expSum = 0.0;
+  std::array<double, 9> expected{};
+  for (std::size_t i = 0; i < kernel.size(); ++i)
+  {
+    const double d = static_cast<double>(i) - 4.0;
+    expected[i] = std::exp(-d * d / (2.0 * 1.5 * 1.5));
+    expSum += expected[i];
+    sum += kernel[i];
+  }
+  EXPECT_NEAR(sum, 1.0, 1e-15);
+  for (std::size_t i = 0; i < kernel.size(); ++i)
+  {
+    EXPECT_NEAR(kernel[i], expected[i] / expSum, 1e-15) << i;
+    EXPECT_DOUBLE_EQ(kernel[i], kernel[kernel.size() - 1 - i]) << i;
+  }
+
+  // A single-tap kernel is just 1.
+  constexpr auto single = math::makeGaussianKernel<1>(2.0);
+  EXPECT_DOUBLE_EQ(single[0], 1.0);
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, SortN)
+{
+  math::Rand::Seed(7);
+
+  std::array<double, 8> values;
+  for (int trial = 0; trial < 200; ++trial)
+  {
+    for (auto &v : values)
+      v = math::Rand::DblUniform(-10, 10);
+    auto expected = values;
+
+    // Exercise a few window sizes of the network family.
+    math::sortN<8>(values.data());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(values, expected);
+
+    for (auto &v : values)
+      v = static_cast<double>(math::Rand::IntUniform(0, 3));
+    expected = values;
+    math::sortN<5>(values.data());
+    std::sort(expected.begin(), expected.begin() + 5);
+    EXPECT_EQ(values, expected);
+  }
+
+  double a = 2.0, b = 1.0;
+  math::sort2Branchless(a, b);
+  EXPECT_DOUBLE_EQ(a, 1.0);
+  EXPECT_DOUBLE_EQ(b, 2.0);
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, Median)
+{
+  // Exhaustive: every combination of three values from {0, 1, 2} and
+  // five values from {0, 1, 2}, compared against a sorted copy.
+  for (int a = 0; a < 3; ++a)
+    for (int b = 0; b < 3; ++b)
+      for (int c = 0; c < 3; ++c)
+      {
+        std::array<int, 3> w = {a, b, c};
+        std::sort(w.begin(), w.end());
+        EXPECT_EQ(math::median3(a, b, c), w[1])
+            << a << " " << b << " " << c;
+      }
+
+  for (int combo = 0; combo < 243; ++combo)
+  {
+    std::array<int, 5> w;
+    int rest = combo;
+    for (auto &v : w)
+    {
+      v = rest % 3;
+      rest /= 3;
+    }
+    auto sorted = w;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(math::median5(w[0], w[1], w[2], w[3], w[4]), sorted[2])
+        << combo;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, MedianFilters)
+{
+  math::Rand::Seed(11);
+
+  // 1-D width-five filter against a brute-force clamped window.
+  std::vector<double> signal(137), filtered(137);
+  for (auto &v : signal)
+    v = math::Rand::DblUniform(-5, 5);
+  math::medianFilter5(signal.data(), filtered.data(), signal.size());
+  for (size_t i = 0; i < signal.size(); ++i)
+  {
+    std::vector<double> window;
+    for (int k = -2; k <= 2; ++k)
+    {
+      const int j = math::clamp(static_cast<int>(i) + k, 0,
+          static_cast<int>(signal.size()) - 1);
+      window.push_back(signal[j]);
+    }
+    std::sort(window.begin(), window.end());
+    EXPECT_DOUBLE_EQ(filtered[i], window[2]) << i;
+  }
+
+  // 3x3 filter over a small image with an impulse and random noise.
+  const size_t width = 23, height = 17;
+  std::vector<double> image(width * height), out(width * height);
+  for (auto &v : image)
+    v = math::Rand::DblUniform(0, 10);
+  image[8 * width + 11] = 1e6;
+  math::medianFilter3x3(image.data(), width, height, out.data());
+  for (size_t y = 0; y < height; ++y)
+  {
+    for (size_t x = 0; x < width; ++x)
+    {
+      std::vector<double> window;
+      for (int dy = -1; dy <= 1; ++dy)
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+          const int yy = math::clamp(static_cast<int>(y) + dy, 0,
+              static_cast<int>(height) - 1);
+          const int xx = math::clamp(static_cast<int>(x) + dx, 0,
+              static_cast<int>(width) - 1);
+          window.push_back(image[yy * width + xx]);
+        }
+      std::sort(window.begin(), window.end());
+      EXPECT_DOUBLE_EQ(out[y * width + x], window[4])
+          << x << ", " << y;
+    }
+  }
+  // The impulse itself is despeckled away.
+  EXPECT_LT(out[8 * width + 11], 100.0);
+}
+
+
+/////////////////////////////////////////////////
+TEST(HelpersTest, GaussLegendre)
+{
+  // An N-point rule is exact for polynomials of degree 2N - 1.
+  auto cubic = [](const double _x)
+  {
+    return 4.0 * _x * _x * _x - 3.0 * _x * _x + 2.0 * _x - 1.0;
+  };
+  // Antiderivative: x^4 - x^3 + x^2 - x.
+  const double exact = (16.0 - 8.0 + 4.0 - 2.0) - 0.0;
+  EXPECT_DOUBLE_EQ(exact, (math::GaussLegendre<2>::Integrate(cubic, 0, 2)));
+  EXPECT_DOUBLE_EQ(exact, (math::GaussLegendre<5>::Integrate(cubic, 0, 2)));
+
+  // The 1-point rule is the midpoint rule: exact for lines only.
+  auto line = [](const double _x) { return 3.0 * _x + 1.0; };
+  EXPECT_DOUBLE_EQ(16.5, (math::GaussLegendre<1>::Integrate(line, 0, 3)));
+
+  // Degree 7 needs at least 4 points.
+  auto septic = [](const double _x) { return std::pow(_x, 7.0); };
+  EXPECT_NEAR(1.0 / 8.0, (math::GaussLegendre<4>::Integrate(septic, 0, 1)),
+      1e-15);
+
+  // A transcendental integrand converges quickly with order.
+  const double sinExact = 1.0 - std::cos(1.0);
+  EXPECT_NEAR(sinExact,
+      (math::GaussLegendre<3>::Integrate(
+          [](const double _x) { return std::sin(_x); }, 0, 1)), 1e-6);
+  EXPECT_NEAR(sinExact,
+      (math::GaussLegendre<5>::Integrate(
+          [](const double _x) { return std::sin(_x); }, 0, 1)), 1e-12);
+
+  // Reversed bounds negate, an empty interval is zero.
+  EXPECT_DOUBLE_EQ(-exact, (math::GaussLegendre<5>::Integrate(cubic, 2, 0)));
+  EXPECT_DOUBLE_EQ(0.0, (math::GaussLegendre<5>::Integrate(cubic, 1, 1)));
+
+  // The nodes and weights are constexpr and normalized.
+  constexpr auto nodes = math::GaussLegendre<5>::Nodes();
+  constexpr auto weights = math::GaussLegendre<5>::Weights();
+  static_assert(nodes.size() == 5 && weights.size() == 5,
+      "five nodes expected");
+  double weightSum = 0.0;
+  for (const auto &w : weights)
+    weightSum += w;
+  EXPECT_DOUBLE_EQ(1.0, weightSum);
+  for (size_t i = 1; i < nodes.size(); ++i)
+    EXPECT_LT(nodes[i - 1], nodes[i]);
+
+  // The batch form matches per-span calls and sums to the whole.
+  const double from[4] = {0.0, 0.5, 1.0, 1.5};
+  const double to[4] = {0.5, 1.0, 1.5, 2.0};
+  double parts[4];
+  math::GaussLegendre<5>::Integrate(cubic, from, to, parts, 4);
+  double total = 0.0;
+  for (int s = 0; s < 4; ++s)
+  {
+    EXPECT_DOUBLE_EQ(
+        (math::GaussLegendre<5>::Integrate(cubic, from[s], to[s])),
+        parts[s]);
+    total += parts[s];
+  }
+  EXPECT_NEAR(exact, total, 1e-12);
+
+  // Vector-valued integrands work through the single-span overload.
+  auto curve = [](const double _t)
+  {
+    return math::Vector3d(1.0, 2.0 * _t, 3.0 * _t * _t);
+  };
+  const math::Vector3d integral =
+      math::GaussLegendre<3>::Integrate(curve, 0, 1);
+  EXPECT_NEAR(1.0, integral.X(), 1e-14);
+  EXPECT_NEAR(1.0, integral.Y(), 1e-14);
+  EXPECT_NEAR(1.0, integral.Z(), 1e-14);
+}
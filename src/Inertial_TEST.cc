@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/Inertial.hh"
 
@@ -603,3 +604,126 @@ TEST(Inertiald_Test, AdditionInvalid)
     EXPECT_TRUE((i0 + i).MassMatrix().IsValid());
   }
 }
+
+/////////////////////////////////////////////////
+TEST(Inertiald_Test, CachedMoi)
+{
+  const math::MassMatrix3d m(12.0,
+      math::Vector3d(2, 3, 4), math::Vector3d(0.1, 0.2, 0.3));
+  math::Inertiald inertial(m,
+      math::Pose3d(1, 2, 3, IGN_PI_4, 0, IGN_PI_2));
+
+  // The cache agrees with the uncached accessor and survives repeated
+  // queries.
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+
+  // Every mutator invalidates the cache.
+  EXPECT_TRUE(inertial.SetPose(math::Pose3d(0, 0, 0, 0, IGN_PI_4, 0)));
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+
+  EXPECT_TRUE(inertial.SetMassMatrix(math::MassMatrix3d(2.0,
+      math::Vector3d(2, 2, 2), math::Vector3d::Zero)));
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+
+  EXPECT_TRUE(inertial.SetInertialRotation(
+      math::Quaterniond(IGN_PI_4, 0, 0)));
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+
+  math::Inertiald other;
+  other = inertial;
+  EXPECT_EQ(other.Moi(), other.CachedMoi());
+
+  inertial += other;
+  EXPECT_EQ(inertial.Moi(), inertial.CachedMoi());
+}
+
+/////////////////////////////////////////////////
+TEST(Inertiald_Test, SumInertials)
+{
+  std::vector<math::Inertiald> links;
+  links.push_back(math::Inertiald(
+      math::MassMatrix3d(4.0, math::Vector3d(2, 3, 4),
+          math::Vector3d(0.1, -0.2, 0.3)),
+      math::Pose3d(1, 0, 0, 0, 0, IGN_PI_2)));
+  links.push_back(math::Inertiald(
+      math::MassMatrix3d(7.0, math::Vector3d(1, 1, 2),
+          math::Vector3d::Zero),
+      math::Pose3d(0, -2, 3, IGN_PI_4, 0, 0)));
+  links.push_back(math::Inertiald(
+      math::MassMatrix3d(1.5, math::Vector3d(5, 4, 3),
+          math::Vector3d(0, 0.4, 0)),
+      math::Pose3d(-1, 1, -1, 0, IGN_PI_4, IGN_PI_4)));
+
+  // The one-pass reducer matches the chained operator+= fold.
+  math::Inertiald expected = links[0];
+  expected += links[1];
+  expected += links[2];
+
+  const math::Inertiald sum =
+      math::Inertiald::SumInertials(links.data(), links.size());
+  EXPECT_DOUBLE_EQ(expected.MassMatrix().Mass(), sum.MassMatrix().Mass());
+  EXPECT_EQ(expected.Pose().Rot(), sum.Pose().Rot());
+  EXPECT_TRUE(expected.Pose().Pos().Equal(sum.Pose().Pos(), 1e-9));
+  const math::Matrix3d expectedMoi = expected.Moi();
+  const math::Matrix3d sumMoi = sum.Moi();
+  for (int row = 0; row < 3; ++row)
+    for (int col = 0; col < 3; ++col)
+      EXPECT_NEAR(expectedMoi(row, col), sumMoi(row, col), 1e-9);
+
+  // Empty and massless inputs produce a default inertial.
+  EXPECT_EQ(math::Inertiald(),
+      math::Inertiald::SumInertials(links.data(), 0));
+  const math::Inertiald massless;
+  EXPECT_EQ(math::Inertiald(),
+      math::Inertiald::SumInertials(&massless, 1));
+}
+
+/////////////////////////////////////////////////
+TEST(Inertiald_Test, SumInertialsTree)
+{
+  // A chain of 500 identical links along x. The pairwise reduction
+  // must agree with the chained operator+= fold on a workload large
+  // enough to cross several levels of the tree.
+  std::vector<math::Inertiald> links;
+  for (int i = 0; i < 500; ++i)
+  {
+    links.push_back(math::Inertiald(
+        math::MassMatrix3d(0.25, math::Vector3d(0.1, 0.2, 0.15),
+            math::Vector3d(0.01, -0.02, 0.005)),
+        math::Pose3d(0.1 * i, 0, 0, 0, 0, 0.01 * i)));
+  }
+
+  math::Inertiald expected = links[0];
+  for (std::size_t i = 1; i < links.size(); ++i)
+    expected += links[i];
+
+  const math::Inertiald sum =
+      math::Inertiald::SumInertials(links.data(), links.size());
+
+  // Equal masses sum exactly in any order.
+  EXPECT_DOUBLE_EQ(500 * 0.25, sum.MassMatrix().Mass());
+  EXPECT_TRUE(expected.Pose().Pos().Equal(sum.Pose().Pos(), 1e-9));
+  const math::Matrix3d expectedMoi = expected.Moi();
+  const math::Matrix3d sumMoi = sum.Moi();
+  for (int row = 0; row < 3; ++row)
+  {
+    for (int col = 0; col < 3; ++col)
+    {
+      EXPECT_NEAR(expectedMoi(row, col), sumMoi(row, col),
+          1e-6 * std::abs(expectedMoi(row, col)) + 1e-9);
+    }
+  }
+
+  // Counts straddling the leaf size of the reduction tree.
+  for (std::size_t count : {7u, 8u, 9u, 17u})
+  {
+    math::Inertiald fold = links[0];
+    for (std::size_t i = 1; i < count; ++i)
+      fold += links[i];
+    const math::Inertiald tree =
+        math::Inertiald::SumInertials(links.data(), count);
+    EXPECT_DOUBLE_EQ(fold.MassMatrix().Mass(), tree.MassMatrix().Mass());
+    EXPECT_TRUE(fold.Pose().Pos().Equal(tree.Pose().Pos(), 1e-9));
+  }
+}
@@ -17,7 +17,10 @@
 
 #include <ignition/math/Kmeans.hh>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 #include <ignition/math/Rand.hh>
 #include "KmeansPrivate.hh"
@@ -42,7 +45,8 @@ Kmeans::~Kmeans()
 //////////////////////////////////////////////////
 std::vector<Vector3d> Kmeans::Observations() const
 {
-  return this->dataPtr->obs;
+  return std::vector<Vector3d>(this->dataPtr->ObsData(),
+      this->dataPtr->ObsData() + this->dataPtr->ObsCount());
 }
 
 //////////////////////////////////////////////////
@@ -55,6 +59,26 @@ bool Kmeans::Observations(const std::vector<Vector3d> &_obs)
     return false;
   }
   this->dataPtr->obs = _obs;
+  this->dataPtr->viewObs = nullptr;
+  this->dataPtr->viewCount = 0;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Kmeans::ObservationsView(const Vector3d *_obs, const size_t _count)
+{
+  if (nullptr == _obs || _count == 0)
+  {
+    std::cerr << "Kmeans::ObservationsView() error: Observations buffer is"
+              << " empty" << std::endl;
+    return false;
+  }
+  // Release any owned copy; clustering reads straight from the
+  // caller's buffer from here on.
+  this->dataPtr->obs.clear();
+  this->dataPtr->obs.shrink_to_fit();
+  this->dataPtr->viewObs = _obs;
+  this->dataPtr->viewCount = _count;
   return true;
 }
 
@@ -67,6 +91,16 @@ bool Kmeans::AppendObservations(const std::vector<Vector3d> &_obs)
               << std::endl;
     return false;
   }
+  // Appending to a view would have to write next to memory this class
+  // does not own, so the view is materialized once and growth is owned
+  // from then on.
+  if (this->dataPtr->viewObs)
+  {
+    this->dataPtr->obs.assign(this->dataPtr->viewObs,
+        this->dataPtr->viewObs + this->dataPtr->viewCount);
+    this->dataPtr->viewObs = nullptr;
+    this->dataPtr->viewCount = 0;
+  }
   this->dataPtr->obs.insert(this->dataPtr->obs.end(), _obs.begin(), _obs.end());
   return true;
 }
@@ -77,7 +111,7 @@ bool Kmeans::Cluster(int _k,
                      std::vector<unsigned int> &_labels)
 {
   // Sanity check.
-  if (this->dataPtr->obs.empty())
+  if (this->dataPtr->ObsCount() == 0)
   {
     std::cerr << "Kmeans error: The set of observations is empty" << std::endl;
     return false;
@@ -91,11 +125,11 @@ bool Kmeans::Cluster(int _k,
     return false;
   }
 
-  if (_k > static_cast<int>(this->dataPtr->obs.size()))
+  if (_k > static_cast<int>(this->dataPtr->ObsCount()))
   {
     std::cerr << "Kmeans error: The number of clusters [" << _k << "] has to be"
               << " lower or equal to the number of observations ["
-              << this->dataPtr->obs.size() << "]" << std::endl;
+              << this->dataPtr->ObsCount() << "]" << std::endl;
     return false;
   }
 
@@ -103,7 +137,7 @@ bool Kmeans::Cluster(int _k,
 
   // Initialize the size of the vectors;
   this->dataPtr->centroids.clear();
-  this->dataPtr->labels.resize(this->dataPtr->obs.size());
+  this->dataPtr->labels.resize(this->dataPtr->ObsCount());
   this->dataPtr->sums.resize(_k);
   this->dataPtr->counters.resize(_k);
 
@@ -112,63 +146,646 @@ bool Kmeans::Cluster(int _k,
     // Choose a random observation and make sure it has not been chosen before.
     // Note: This is not really random but it's faster than choosing a random
     // one and verifying that it was not taken before.
-    this->dataPtr->centroids.push_back(this->dataPtr->obs[i]);
+    this->dataPtr->centroids.push_back(this->dataPtr->ObsData()[i]);
   }
 
   // Initialize labels.
-  for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
+  for (auto i = 0u; i < this->dataPtr->ObsCount(); ++i)
     this->dataPtr->labels[i] = 0;
 
+  double maxMovement = 0.0;
   do
   {
-    // Reset sums and counters.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+    changed = this->IterateOnce(_k, maxMovement);
+  }
+  while (changed > (this->dataPtr->ObsCount() >> 10)); // NOLINT
+
+  _centroids = this->dataPtr->centroids;
+  _labels = this->dataPtr->labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Kmeans::ClusterBudgeted(int _k,
+                             std::vector<Vector3d> &_centroids,
+                             std::vector<unsigned int> &_labels,
+                             const unsigned int _maxIterations,
+                             const double _maxSeconds,
+                             const IterationCallback &_callback)
+{
+  // Sanity check, as in Cluster().
+  if (this->dataPtr->ObsCount() == 0)
+  {
+    std::cerr << "Kmeans error: The set of observations is empty" << std::endl;
+    return false;
+  }
+
+  if (_k <= 0 || _k > static_cast<int>(this->dataPtr->ObsCount()))
+  {
+    std::cerr << "Kmeans error: The number of clusters [" << _k << "] has to"
+              << " be positive and lower or equal to the number of"
+              << " observations [" << this->dataPtr->ObsCount() << "]"
+              << std::endl;
+    return false;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  // Seed the centroids and labels as Cluster() does.
+  this->dataPtr->centroids.clear();
+  this->dataPtr->labels.assign(this->dataPtr->ObsCount(), 0u);
+  this->dataPtr->sums.resize(_k);
+  this->dataPtr->counters.resize(_k);
+  for (auto i = 0; i < _k; ++i)
+    this->dataPtr->centroids.push_back(this->dataPtr->ObsData()[i]);
+
+  // Iterate to convergence unless a budget runs out or the callback
+  // asks to stop. Budgets are checked after an iteration completes,
+  // so the labels always match the centroids of the last pass.
+  unsigned int iteration = 0;
+  size_t changed = 0;
+  double maxMovement = 0.0;
+  bool keepGoing = true;
+  do
+  {
+    changed = this->IterateOnce(_k, maxMovement);
+    ++iteration;
+
+    if (_callback)
+      keepGoing = _callback({iteration, changed, maxMovement});
+
+    if (_maxIterations > 0u && iteration >= _maxIterations)
+      keepGoing = false;
+
+    if (_maxSeconds > 0.0)
     {
-      this->dataPtr->sums[i] = Vector3d::Zero;
-      this->dataPtr->counters[i] = 0;
+      const double elapsed = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+      if (elapsed >= _maxSeconds)
+        keepGoing = false;
     }
-    changed = 0;
+  }
+  while (keepGoing &&
+         changed > (this->dataPtr->ObsCount() >> 10)); // NOLINT
 
-    for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
+  _centroids = this->dataPtr->centroids;
+  _labels = this->dataPtr->labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t Kmeans::IterateOnce(int _k, double &_maxMovement)
+{
+  // Reset sums and counters.
+  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  {
+    this->dataPtr->sums[i] = Vector3d::Zero;
+    this->dataPtr->counters[i] = 0;
+  }
+  size_t changed = 0;
+
+  // Precompute, for each centroid, half the distance to its nearest other
+  // centroid. By the triangle inequality, a point whose distance to its
+  // current centroid is within this bound cannot be closer to any other
+  // centroid, so the full O(k) scan below is skipped for points that
+  // didn't change cluster. The result is identical to the brute-force
+  // scan; only redundant distance computations are avoided. Both the
+  // bound and the assignment pass work on squared distances, which
+  // preserves the comparison and saves the square roots.
+  this->dataPtr->halfMinCentroidDistSq.assign(
+      this->dataPtr->centroids.size(), HUGE_VAL);
+  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  {
+    for (auto j = i + 1; j < this->dataPtr->centroids.size(); ++j)
+    {
+      double halfDistSq = 0.25 * SquaredEuclideanDistance::Evaluate(
+          this->dataPtr->centroids[i], this->dataPtr->centroids[j]);
+      if (halfDistSq < this->dataPtr->halfMinCentroidDistSq[i])
+        this->dataPtr->halfMinCentroidDistSq[i] = halfDistSq;
+      if (halfDistSq < this->dataPtr->halfMinCentroidDistSq[j])
+        this->dataPtr->halfMinCentroidDistSq[j] = halfDistSq;
+    }
+  }
+
+  // Assignment and accumulation. The observations are independent, so
+  // the range is split across worker threads; each thread accumulates
+  // into private sums and counters that are merged afterwards. Threads
+  // write disjoint ranges of labels and only read the centroids.
+  const size_t obsCount = this->dataPtr->ObsCount();
+
+  // Keep a sensible amount of work per thread; small observation sets
+  // run single threaded.
+  const size_t minChunk = 4096;
+  size_t nThreads = std::max<size_t>(1u,
+      std::min<size_t>(std::thread::hardware_concurrency(),
+                       obsCount / minChunk));
+
+  std::vector<std::vector<Vector3d>> threadSums(nThreads,
+      std::vector<Vector3d>(_k, Vector3d::Zero));
+  std::vector<std::vector<unsigned int>> threadCounters(nThreads,
+      std::vector<unsigned int>(_k, 0u));
+  std::vector<size_t> threadChanged(nThreads, 0);
+
+  auto assign = [this, obsCount, nThreads, &threadSums, &threadCounters,
+      &threadChanged](size_t _t)
+  {
+    const size_t begin = _t * obsCount / nThreads;
+    const size_t end = (_t + 1) * obsCount / nThreads;
+    for (size_t i = begin; i < end; ++i)
     {
       // Update the labels containing the closest centroid for each point.
-      auto label = this->ClosestCentroid(this->dataPtr->obs[i]);
+      auto label = this->dataPtr->labels[i];
+      if (SquaredEuclideanDistance::Evaluate(this->dataPtr->ObsData()[i],
+          this->dataPtr->centroids[label]) >
+          this->dataPtr->halfMinCentroidDistSq[label])
+      {
+        label = this->ClosestCentroid(this->dataPtr->ObsData()[i]);
+      }
       if (this->dataPtr->labels[i] != label)
       {
         this->dataPtr->labels[i] = label;
-        changed++;
+        threadChanged[_t]++;
       }
-      this->dataPtr->sums[label] += this->dataPtr->obs[i];
-      this->dataPtr->counters[label]++;
+      threadSums[_t][label] += this->dataPtr->ObsData()[i];
+      threadCounters[_t][label]++;
     }
+  };
 
-    // Update the centroids.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  if (nThreads <= 1)
+  {
+    assign(0);
+  }
+  else
+  {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < nThreads; ++t)
+      workers.push_back(std::thread(assign, t));
+    for (auto &w : workers)
+      w.join();
+  }
+
+  // Merge the per-thread partial results.
+  for (size_t t = 0; t < nThreads; ++t)
+  {
+    changed += threadChanged[t];
+    for (auto i = 0; i < _k; ++i)
+    {
+      this->dataPtr->sums[i] += threadSums[t][i];
+      this->dataPtr->counters[i] += threadCounters[t][i];
+    }
+  }
+
+  // Update the centroids, tracking how far each one moved. A cluster
+  // that lost all its observations keeps its previous centroid.
+  _maxMovement = 0.0;
+  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  {
+    if (this->dataPtr->counters[i] == 0)
+      continue;
+    Vector3d updated = this->dataPtr->sums[i] / this->dataPtr->counters[i];
+    double movement = updated.Distance(this->dataPtr->centroids[i]);
+    if (movement > _maxMovement)
+      _maxMovement = movement;
+    this->dataPtr->centroids[i] = updated;
+  }
+
+  return changed;
+}
+
+//////////////////////////////////////////////////
+bool Kmeans::ClusterIncremental(int _k,
+                                std::vector<Vector3d> &_centroids,
+                                std::vector<unsigned int> &_labels,
+                                const double _movementThreshold)
+{
+  // Without a matching previous result there is nothing to warm start
+  // from; run the full algorithm.
+  if (this->dataPtr->centroids.size() != static_cast<size_t>(_k) ||
+      this->dataPtr->labels.size() != this->dataPtr->ObsCount())
+  {
+    return this->Cluster(_k, _centroids, _labels);
+  }
+
+  if (_k <= 0 || _k > static_cast<int>(this->dataPtr->ObsCount()))
+  {
+    std::cerr << "Kmeans error: The number of clusters [" << _k << "] has to"
+              << " be positive and lower or equal to the number of"
+              << " observations [" << this->dataPtr->ObsCount() << "]"
+              << std::endl;
+    return false;
+  }
+
+  this->dataPtr->sums.resize(_k);
+  this->dataPtr->counters.resize(_k);
+
+  // Iterate from the previous labels and centroids until the centroids
+  // settle. Steady-state frames exit after a single pass.
+  size_t changed = 0;
+  double maxMovement = 0.0;
+  do
+  {
+    changed = this->IterateOnce(_k, maxMovement);
+  }
+  while (maxMovement > _movementThreshold &&
+         changed > (this->dataPtr->ObsCount() >> 10)); // NOLINT
+
+  _centroids = this->dataPtr->centroids;
+  _labels = this->dataPtr->labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Kmeans::ClusterMiniBatch(int _k,
+                              std::vector<Vector3d> &_centroids,
+                              std::vector<unsigned int> &_labels,
+                              const size_t _batchSize,
+                              const unsigned int _maxIterations,
+                              const double _movementThreshold)
+{
+  // Sanity check.
+  if (this->dataPtr->ObsCount() == 0)
+  {
+    std::cerr << "Kmeans error: The set of observations is empty" << std::endl;
+    return false;
+  }
+
+  if (_k <= 0 || _k > static_cast<int>(this->dataPtr->ObsCount()))
+  {
+    std::cerr << "Kmeans error: The number of clusters [" << _k << "] has to"
+              << " be positive and lower or equal to the number of"
+              << " observations [" << this->dataPtr->ObsCount() << "]"
+              << std::endl;
+    return false;
+  }
+
+  if (_batchSize == 0)
+  {
+    std::cerr << "Kmeans error: The batch size has to be positive"
+              << std::endl;
+    return false;
+  }
+
+  const size_t obsCount = this->dataPtr->ObsCount();
+  const size_t batchSize = std::min(_batchSize, obsCount);
+
+  // Seed the centroids as Cluster() does.
+  this->dataPtr->centroids.clear();
+  for (auto i = 0; i < _k; ++i)
+    this->dataPtr->centroids.push_back(this->dataPtr->ObsData()[i]);
+
+  // Per-centroid sample counts; the learning rate of a centroid is the
+  // inverse of the samples it has absorbed, so early batches move the
+  // centroids quickly and later ones only refine them (Sculley,
+  // "Web-scale k-means clustering", 2010).
+  std::vector<size_t> absorbed(_k, 0);
+  std::vector<size_t> batch(batchSize);
+  std::vector<unsigned int> batchLabels(batchSize);
+
+  for (auto iteration = 0u; iteration < _maxIterations; ++iteration)
+  {
+    // Sample the batch and assign each sample to its closest centroid
+    // before moving anything, so the assignment is consistent.
+    for (auto i = 0u; i < batchSize; ++i)
     {
-      this->dataPtr->centroids[i] =
-        this->dataPtr->sums[i] / this->dataPtr->counters[i];
+      batch[i] = static_cast<size_t>(Rand::IntUniform(0,
+          static_cast<int>(obsCount) - 1));
+      batchLabels[i] = this->ClosestCentroid(this->dataPtr->ObsData()[batch[i]]);
     }
+
+    double maxMovement = 0.0;
+    for (auto i = 0u; i < batchSize; ++i)
+    {
+      const unsigned int label = batchLabels[i];
+      const Vector3d &point = this->dataPtr->ObsData()[batch[i]];
+      const double eta = 1.0 / static_cast<double>(++absorbed[label]);
+      Vector3d updated =
+          this->dataPtr->centroids[label] * (1.0 - eta) + point * eta;
+      const double movement =
+          updated.Distance(this->dataPtr->centroids[label]);
+      if (movement > maxMovement)
+        maxMovement = movement;
+      this->dataPtr->centroids[label] = updated;
+    }
+
+    if (maxMovement <= _movementThreshold)
+      break;
   }
-  while (changed > (this->dataPtr->obs.size() >> 10)); // NOLINT
+
+  // One full pass to produce the labels for the final centroids.
+  this->dataPtr->labels.resize(obsCount);
+  for (auto i = 0u; i < obsCount; ++i)
+    this->dataPtr->labels[i] = this->ClosestCentroid(this->dataPtr->ObsData()[i]);
 
   _centroids = this->dataPtr->centroids;
   _labels = this->dataPtr->labels;
   return true;
 }
 
+//////////////////////////////////////////////////
+bool Kmeans::UpdateObservations(const std::vector<size_t> &_indices,
+                                const std::vector<Vector3d> &_obs)
+{
+  // Viewed observations belong to the caller; they should edit their
+  // own buffer, which this class reads directly on the next run.
+  if (this->dataPtr->viewObs)
+  {
+    std::cerr << "Kmeans::UpdateObservations() error: the observations are"
+              << " a non-owning view; modify the caller-owned buffer instead"
+              << std::endl;
+    return false;
+  }
+
+  if (_indices.empty() || _indices.size() != _obs.size())
+  {
+    std::cerr << "Kmeans::UpdateObservations() error: expects two vectors"
+              << " of equal, positive size but got [" << _indices.size()
+              << "] indices and [" << _obs.size() << "] observations"
+              << std::endl;
+    return false;
+  }
+
+  for (auto i = 0u; i < _indices.size(); ++i)
+  {
+    if (_indices[i] >= this->dataPtr->ObsCount())
+    {
+      std::cerr << "Kmeans::UpdateObservations() error: index ["
+                << _indices[i] << "] is out of range [" <<
+                this->dataPtr->ObsCount() << "]" << std::endl;
+      return false;
+    }
+  }
+
+  for (auto i = 0u; i < _indices.size(); ++i)
+    this->dataPtr->obs[_indices[i]] = _obs[i];
+  return true;
+}
+
 //////////////////////////////////////////////////
 unsigned int Kmeans::ClosestCentroid(const Vector3d &_p) const
 {
-  double min = HUGE_VAL;
-  unsigned int minIdx = 0;
-  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  // Squared Euclidean has the same argmin as Euclidean, without a
+  // square root per centroid.
+  return ClosestCentroid<SquaredEuclideanDistance>(_p,
+      this->dataPtr->centroids.data(), this->dataPtr->centroids.size());
+}
+
+//////////////////////////////////////////////////
+// Squared Euclidean distance between two rows of _dim doubles; a
+// contiguous loop the compiler vectorizes at any dimension.
+static double SquaredDistanceNd(const double *_a, const double *_b,
+    const unsigned int _dim)
+{
+  double sum = 0.0;
+  for (unsigned int j = 0; j < _dim; ++j)
   {
-    double d = _p.Distance(this->dataPtr->centroids[i]);
-    if (d < min)
+    const double d = _a[j] - _b[j];
+    sum += d * d;
+  }
+  return sum;
+}
+
+//////////////////////////////////////////////////
+KmeansNd::KmeansNd(const unsigned int _dimension)
+: dataPtr(new KmeansNdPrivate)
+{
+  if (_dimension == 0u)
+  {
+    std::cerr << "KmeansNd error: The dimension has to be positive"
+              << std::endl;
+  }
+  this->dataPtr->dim = _dimension;
+}
+
+//////////////////////////////////////////////////
+KmeansNd::~KmeansNd()
+{
+  delete this->dataPtr;
+  this->dataPtr = nullptr;
+}
+
+//////////////////////////////////////////////////
+unsigned int KmeansNd::Dimension() const
+{
+  return this->dataPtr->dim;
+}
+
+//////////////////////////////////////////////////
+bool KmeansNd::Observations(const double *_obs, const size_t _count,
+    const size_t _stride)
+{
+  this->dataPtr->obs.clear();
+  return this->AppendObservations(_obs, _count, _stride);
+}
+
+//////////////////////////////////////////////////
+bool KmeansNd::AppendObservations(const double *_obs, const size_t _count,
+    const size_t _stride)
+{
+  const unsigned int dim = this->dataPtr->dim;
+  if (dim == 0u || nullptr == _obs || _count == 0)
+  {
+    std::cerr << "KmeansNd::Observations() error: Observations buffer is"
+              << " empty" << std::endl;
+    return false;
+  }
+
+  const size_t stride = _stride == 0 ? dim : _stride;
+  if (stride < dim)
+  {
+    std::cerr << "KmeansNd::Observations() error: stride [" << stride
+              << "] is smaller than the dimension [" << dim << "]"
+              << std::endl;
+    return false;
+  }
+
+  this->dataPtr->obs.reserve(this->dataPtr->obs.size() + _count * dim);
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double *row = _obs + i * stride;
+    this->dataPtr->obs.insert(this->dataPtr->obs.end(), row, row + dim);
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t KmeansNd::ObservationCount() const
+{
+  if (this->dataPtr->dim == 0u)
+    return 0;
+  return this->dataPtr->obs.size() / this->dataPtr->dim;
+}
+
+//////////////////////////////////////////////////
+bool KmeansNd::Cluster(int _k,
+                       std::vector<double> &_centroids,
+                       std::vector<unsigned int> &_labels)
+{
+  const unsigned int dim = this->dataPtr->dim;
+  const size_t obsCount = this->ObservationCount();
+
+  // Sanity check.
+  if (obsCount == 0)
+  {
+    std::cerr << "KmeansNd error: The set of observations is empty"
+              << std::endl;
+    return false;
+  }
+
+  if (_k <= 0)
+  {
+    std::cerr << "KmeansNd error: The number of clusters has to"
+              << " be positive but its value is [" << _k << "]"
+              << std::endl;
+    return false;
+  }
+
+  if (_k > static_cast<int>(obsCount))
+  {
+    std::cerr << "KmeansNd error: The number of clusters [" << _k << "] has"
+              << " to be lower or equal to the number of observations ["
+              << obsCount << "]" << std::endl;
+    return false;
+  }
+
+  // Seed the centroids from the first k observations, as Kmeans does.
+  this->dataPtr->centroids.assign(this->dataPtr->obs.begin(),
+      this->dataPtr->obs.begin() + _k * dim);
+  this->dataPtr->labels.assign(obsCount, 0u);
+  this->dataPtr->sums.resize(_k * dim);
+  this->dataPtr->counters.resize(_k);
+
+  size_t changed = 0;
+  double maxMovement = 0.0;
+  do
+  {
+    changed = this->IterateOnce(_k, maxMovement);
+  }
+  while (changed > (obsCount >> 10)); // NOLINT
+
+  _centroids = this->dataPtr->centroids;
+  _labels = this->dataPtr->labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t KmeansNd::IterateOnce(int _k, double &_maxMovement)
+{
+  const unsigned int dim = this->dataPtr->dim;
+  const size_t obsCount = this->ObservationCount();
+  const size_t k = static_cast<size_t>(_k);
+  double *centroids = this->dataPtr->centroids.data();
+  const double *obs = this->dataPtr->obs.data();
+
+  // Reset sums and counters.
+  std::fill(this->dataPtr->sums.begin(), this->dataPtr->sums.end(), 0.0);
+  std::fill(this->dataPtr->counters.begin(),
+      this->dataPtr->counters.end(), 0u);
+
+  // Triangle inequality bound per centroid, as in Kmeans: a point
+  // within half the distance to the nearest other centroid cannot be
+  // closer to any other centroid. Squared on both sides.
+  this->dataPtr->halfMinCentroidDistSq.assign(k, HUGE_VAL);
+  for (size_t i = 0; i < k; ++i)
+  {
+    for (size_t j = i + 1; j < k; ++j)
     {
-      min = d;
-      minIdx = i;
+      const double halfDistSq = 0.25 * SquaredDistanceNd(
+          centroids + i * dim, centroids + j * dim, dim);
+      if (halfDistSq < this->dataPtr->halfMinCentroidDistSq[i])
+        this->dataPtr->halfMinCentroidDistSq[i] = halfDistSq;
+      if (halfDistSq < this->dataPtr->halfMinCentroidDistSq[j])
+        this->dataPtr->halfMinCentroidDistSq[j] = halfDistSq;
     }
   }
-  return minIdx;
+
+  // Pruning pass: points whose distance to their current centroid is
+  // within the bound keep their label; the rest are collected for the
+  // blocked scan below, seeded with that distance.
+  this->dataPtr->scanList.clear();
+  this->dataPtr->bestDistSq.clear();
+  this->dataPtr->bestIdx.clear();
+  for (size_t i = 0; i < obsCount; ++i)
+  {
+    const unsigned int label = this->dataPtr->labels[i];
+    const double d = SquaredDistanceNd(obs + i * dim,
+        centroids + label * dim, dim);
+    if (d > this->dataPtr->halfMinCentroidDistSq[label])
+    {
+      this->dataPtr->scanList.push_back(i);
+      this->dataPtr->bestDistSq.push_back(d);
+      this->dataPtr->bestIdx.push_back(label);
+    }
+  }
+
+  // Blocked full scan: walk the centroids in blocks sized to stay in
+  // L1, sweeping every undecided point per block, so each centroid
+  // row is loaded once per block of points instead of once per point.
+  const size_t blockRows = std::max<size_t>(1, 4096 / dim);
+  for (size_t cb = 0; cb < k; cb += blockRows)
+  {
+    const size_t cbEnd = std::min(k, cb + blockRows);
+    for (size_t s = 0; s < this->dataPtr->scanList.size(); ++s)
+    {
+      const double *point = obs + this->dataPtr->scanList[s] * dim;
+      double best = this->dataPtr->bestDistSq[s];
+      unsigned int bestIdx = this->dataPtr->bestIdx[s];
+      for (size_t c = cb; c < cbEnd; ++c)
+      {
+        const double d = SquaredDistanceNd(point, centroids + c * dim, dim);
+        if (d < best)
+        {
+          best = d;
+          bestIdx = static_cast<unsigned int>(c);
+        }
+      }
+      this->dataPtr->bestDistSq[s] = best;
+      this->dataPtr->bestIdx[s] = bestIdx;
+    }
+  }
+
+  // Commit the scan results, counting the labels that changed.
+  size_t changed = 0;
+  for (size_t s = 0; s < this->dataPtr->scanList.size(); ++s)
+  {
+    const size_t i = this->dataPtr->scanList[s];
+    if (this->dataPtr->labels[i] != this->dataPtr->bestIdx[s])
+    {
+      this->dataPtr->labels[i] = this->dataPtr->bestIdx[s];
+      ++changed;
+    }
+  }
+
+  for (size_t i = 0; i < obsCount; ++i)
+  {
+    const unsigned int label = this->dataPtr->labels[i];
+    double *sum = this->dataPtr->sums.data() + label * dim;
+    const double *point = obs + i * dim;
+    for (unsigned int j = 0; j < dim; ++j)
+      sum[j] += point[j];
+    this->dataPtr->counters[label]++;
+  }
+
+  // Update the centroids, tracking how far each one moved. A cluster
+  // that lost all its observations keeps its previous centroid.
+  _maxMovement = 0.0;
+  for (size_t i = 0; i < k; ++i)
+  {
+    if (this->dataPtr->counters[i] == 0)
+      continue;
+    const double inv = 1.0 / this->dataPtr->counters[i];
+    double movementSq = 0.0;
+    double *centroid = centroids + i * dim;
+    const double *sum = this->dataPtr->sums.data() + i * dim;
+    for (unsigned int j = 0; j < dim; ++j)
+    {
+      const double updated = sum[j] * inv;
+      const double delta = updated - centroid[j];
+      movementSq += delta * delta;
+      centroid[j] = updated;
+    }
+    if (movementSq > _maxMovement * _maxMovement)
+      _maxMovement = std::sqrt(movementSq);
+  }
+
+  return changed;
 }
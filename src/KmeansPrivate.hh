@@ -17,7 +17,9 @@
 #ifndef IGNITION_MATH_KMEANSPRIVATE_HH_
 #define IGNITION_MATH_KMEANSPRIVATE_HH_
 
+#include <cstddef>
 #include <vector>
+#include <ignition/math/MemoryPool.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/config.hh>
@@ -32,9 +34,31 @@ namespace ignition
     /// \brief Private data for Kmeans class
     class KmeansPrivate
     {
-      /// \brief Observations.
+      /// \brief Observations, when owned.
       public: std::vector<Vector3d> obs;
 
+      /// \brief Externally-owned observations when in view mode, or
+      /// null when the observations are owned. The clustering passes
+      /// only read observations, so a view is never written through.
+      public: const Vector3d *viewObs = nullptr;
+
+      /// \brief Number of observations behind viewObs.
+      public: std::size_t viewCount = 0;
+
+      /// \brief Get the active observation buffer, owned or viewed.
+      /// \return Pointer to the first observation.
+      public: const Vector3d *ObsData() const
+      {
+        return this->viewObs ? this->viewObs : this->obs.data();
+      }
+
+      /// \brief Get the active observation count, owned or viewed.
+      /// \return The number of observations.
+      public: std::size_t ObsCount() const
+      {
+        return this->viewObs ? this->viewCount : this->obs.size();
+      }
+
       /// \brief Centroids.
       public: std::vector<Vector3d> centroids;
 
@@ -46,6 +70,67 @@ namespace ignition
 
       /// \brief Counts the number of observations contained in each partition.
       public: std::vector<unsigned int> counters;
+
+      /// \brief For each centroid, the square of half the distance to its
+      /// nearest other centroid. Used to prune nearest-centroid scans via
+      /// the triangle inequality; squared so the assignment pass can
+      /// compare squared Euclidean distances directly.
+      public: std::vector<double> halfMinCentroidDistSq;
+
+      /// \brief Allocate instances from the shared pool; clustering
+      /// contexts are short lived and this keeps them off the global
+      /// allocator.
+      public: static void *operator new(std::size_t)
+      {
+        return MemoryPool<KmeansPrivate>::Instance().Allocate();
+      }
+
+      /// \brief Return the slot obtained from operator new.
+      /// \param[in] _ptr Pointer to the slot.
+      public: static void operator delete(void *_ptr)
+      {
+        MemoryPool<KmeansPrivate>::Instance().Deallocate(_ptr);
+      }
+    };
+
+    /// \internal
+    /// \brief Private data for KmeansNd class. All point buffers are
+    /// flat and row major: coordinate j of point i lives at
+    /// [i * dim + j].
+    class KmeansNdPrivate
+    {
+      /// \brief Number of coordinates per point.
+      public: unsigned int dim{0u};
+
+      /// \brief Observations, obs.size() / dim points.
+      public: std::vector<double> obs;
+
+      /// \brief Centroids, one row per cluster.
+      public: std::vector<double> centroids;
+
+      /// \brief Each element stores the cluster to which observation i belongs.
+      public: std::vector<unsigned int> labels;
+
+      /// \brief Used to calculate the centroid of each partition.
+      public: std::vector<double> sums;
+
+      /// \brief Counts the number of observations contained in each partition.
+      public: std::vector<unsigned int> counters;
+
+      /// \brief For each centroid, the square of half the distance to its
+      /// nearest other centroid, as in KmeansPrivate.
+      public: std::vector<double> halfMinCentroidDistSq;
+
+      /// \brief Indices of the observations the pruning test could
+      /// not keep on their current centroid; only these go through
+      /// the blocked full scan.
+      public: std::vector<std::size_t> scanList;
+
+      /// \brief Best squared distance so far per scan list entry.
+      public: std::vector<double> bestDistSq;
+
+      /// \brief Best centroid index so far per scan list entry.
+      public: std::vector<unsigned int> bestIdx;
     };
     }
   }
@@ -16,8 +16,11 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include "ignition/math/Kmeans.hh"
+#include "ignition/math/Rand.hh"
 
 using namespace ignition;
 
@@ -140,3 +143,477 @@ TEST(KmeansTest, Append)
   std::vector<math::Vector3d> emptyVector;
   EXPECT_FALSE(kmeans.AppendObservations(emptyVector));
 }
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, NearestAssignment)
+{
+  // Build a grid of observations and cluster it. Whatever pruning the
+  // implementation applies, every point must end up labeled with its
+  // truly nearest centroid.
+  std::vector<math::Vector3d> obs;
+  for (int x = 0; x < 10; ++x)
+    for (int y = 0; y < 10; ++y)
+      obs.push_back(math::Vector3d(x + 0.01 * y, y - 0.02 * x, x * y * 0.1));
+
+  math::Kmeans kmeans(obs);
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  ASSERT_TRUE(kmeans.Cluster(8, centroids, labels));
+  ASSERT_EQ(labels.size(), obs.size());
+  ASSERT_EQ(centroids.size(), 8u);
+
+  for (size_t i = 0; i < obs.size(); ++i)
+  {
+    double assigned = obs[i].Distance(centroids[labels[i]]);
+    for (size_t c = 0; c < centroids.size(); ++c)
+      EXPECT_LE(assigned, obs[i].Distance(centroids[c]) + 1e-12);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, LargeObservationSet)
+{
+  // Large enough to engage the multithreaded assignment path.
+  std::vector<math::Vector3d> obs;
+  for (int i = 0; i < 20000; ++i)
+  {
+    double base = (i % 2) ? 10.0 : -10.0;
+    obs.push_back(math::Vector3d(base + 0.0001 * i,
+                                 base - 0.0001 * i,
+                                 base));
+  }
+
+  math::Kmeans kmeans(obs);
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  ASSERT_TRUE(kmeans.Cluster(2, centroids, labels));
+  ASSERT_EQ(centroids.size(), 2u);
+  ASSERT_EQ(labels.size(), obs.size());
+
+  // The two obvious groups must be separated.
+  for (size_t i = 0; i < obs.size(); ++i)
+    EXPECT_EQ(labels[i], labels[i % 2]);
+  EXPECT_NE(labels[0], labels[1]);
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, Metrics)
+{
+  const math::Vector3d centroids[2] =
+  {
+    // A diagonal point: short Euclidean distance, long Manhattan one.
+    math::Vector3d(2, 2, 2),
+    // An axis-aligned point: the other way around.
+    math::Vector3d(0, 0, 5)
+  };
+  const math::Vector3d origin(0, 0, 0);
+
+  // The default squared Euclidean metric matches the Euclidean argmin.
+  EXPECT_EQ(0u, math::Kmeans::ClosestCentroid(origin, centroids, 2));
+  EXPECT_EQ(1u, math::Kmeans::ClosestCentroid(
+      math::Vector3d(0, 0, 4), centroids, 2));
+
+  // Manhattan prefers the axis-aligned centroid for the same query.
+  EXPECT_EQ(1u, math::Kmeans::ClosestCentroid<math::ManhattanDistance>(
+      origin, centroids, 2));
+
+  // A user-supplied metric: Chebyshev (L-infinity) distance.
+  struct ChebyshevDistance
+  {
+    public: static double Evaluate(const math::Vector3d &_a,
+                const math::Vector3d &_b)
+    {
+      return std::max({std::abs(_a.X() - _b.X()),
+                       std::abs(_a.Y() - _b.Y()),
+                       std::abs(_a.Z() - _b.Z())});
+    }
+  };
+  EXPECT_EQ(0u, math::Kmeans::ClosestCentroid<ChebyshevDistance>(
+      origin, centroids, 2));
+  EXPECT_EQ(1u, math::Kmeans::ClosestCentroid<ChebyshevDistance>(
+      math::Vector3d(0, 0, 4.5), centroids, 2));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, Incremental)
+{
+  // Two well separated blobs.
+  std::vector<math::Vector3d> obs;
+  for (int i = 0; i < 12; ++i)
+    obs.push_back(math::Vector3d(0.01 * i, 0.02 * i, 0.0));
+  for (int i = 0; i < 12; ++i)
+    obs.push_back(math::Vector3d(10.0 + 0.01 * i, 10.0, 0.0));
+
+  math::Kmeans kmeans(obs);
+
+  // With no previous result the incremental entry point behaves like a
+  // cold run.
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.ClusterIncremental(2, centroids, labels));
+  ASSERT_EQ(2u, centroids.size());
+  ASSERT_EQ(obs.size(), labels.size());
+  for (size_t i = 1; i < 12; ++i)
+  {
+    EXPECT_EQ(labels[0], labels[i]);
+    EXPECT_EQ(labels[12], labels[12 + i]);
+  }
+  EXPECT_NE(labels[0], labels[12]);
+
+  // Nudge a few points and re-cluster from the previous assignment.
+  std::vector<size_t> indices = {0, 5, 13};
+  std::vector<math::Vector3d> updated = {
+    obs[0] + math::Vector3d(0.001, 0, 0),
+    obs[5] + math::Vector3d(0, 0.001, 0),
+    obs[13] + math::Vector3d(0.001, 0.001, 0)};
+  EXPECT_TRUE(kmeans.UpdateObservations(indices, updated));
+
+  std::vector<math::Vector3d> warmCentroids;
+  std::vector<unsigned int> warmLabels;
+  EXPECT_TRUE(kmeans.ClusterIncremental(2, warmCentroids, warmLabels));
+  EXPECT_EQ(labels, warmLabels);
+  for (size_t i = 0; i < 2; ++i)
+    EXPECT_LT(centroids[i].Distance(warmCentroids[i]), 0.01);
+
+  // The warm result matches a cold run over the same observations.
+  math::Kmeans cold(kmeans.Observations());
+  std::vector<math::Vector3d> coldCentroids;
+  std::vector<unsigned int> coldLabels;
+  EXPECT_TRUE(cold.Cluster(2, coldCentroids, coldLabels));
+  for (size_t i = 0; i < 2; ++i)
+  {
+    EXPECT_LT(0.5, static_cast<double>(
+        std::count(warmLabels.begin(), warmLabels.end(),
+        warmLabels[0])));
+  }
+  for (const auto &warm : warmCentroids)
+  {
+    const double nearest = std::min(warm.Distance(coldCentroids[0]),
+        warm.Distance(coldCentroids[1]));
+    EXPECT_LT(nearest, 1e-6) << warm;
+  }
+
+  // Invalid delta updates are rejected.
+  EXPECT_FALSE(kmeans.UpdateObservations({}, {}));
+  EXPECT_FALSE(kmeans.UpdateObservations({0, 1}, {obs[0]}));
+  EXPECT_FALSE(kmeans.UpdateObservations({obs.size()}, {obs[0]}));
+
+  // An invalid cluster count is rejected even on the warm path.
+  EXPECT_FALSE(kmeans.ClusterIncremental(0, centroids, labels));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, MiniBatch)
+{
+  math::Rand::Seed(42);
+
+  // Three well separated blobs.
+  std::vector<math::Vector3d> centers = {
+    math::Vector3d(0, 0, 0),
+    math::Vector3d(20, 0, 0),
+    math::Vector3d(0, 20, 0)};
+  std::vector<math::Vector3d> obs;
+  for (int i = 0; i < 600; ++i)
+  {
+    obs.push_back(centers[i % 3] + math::Vector3d(
+        math::Rand::DblUniform(-0.5, 0.5),
+        math::Rand::DblUniform(-0.5, 0.5),
+        math::Rand::DblUniform(-0.5, 0.5)));
+  }
+
+  math::Kmeans kmeans(obs);
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.ClusterMiniBatch(3, centroids, labels, 128));
+  ASSERT_EQ(3u, centroids.size());
+  ASSERT_EQ(obs.size(), labels.size());
+
+  // Every centroid ends near one distinct blob center.
+  std::vector<bool> used(3, false);
+  for (const auto &centroid : centroids)
+  {
+    size_t best = 0;
+    for (size_t i = 1; i < centers.size(); ++i)
+    {
+      if (centroid.Distance(centers[i]) < centroid.Distance(centers[best]))
+        best = i;
+    }
+    EXPECT_LT(centroid.Distance(centers[best]), 2.0) << centroid;
+    EXPECT_FALSE(used[best]);
+    used[best] = true;
+  }
+
+  // Labels agree with the closest final centroid.
+  for (size_t i = 0; i < obs.size(); ++i)
+  {
+    size_t best = 0;
+    for (size_t c = 1; c < centroids.size(); ++c)
+    {
+      if (obs[i].Distance(centroids[c]) < obs[i].Distance(centroids[best]))
+        best = c;
+    }
+    ASSERT_EQ(best, labels[i]) << i;
+  }
+
+  // Invalid arguments are rejected.
+  EXPECT_FALSE(kmeans.ClusterMiniBatch(0, centroids, labels));
+  EXPECT_FALSE(kmeans.ClusterMiniBatch(3, centroids, labels, 0));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, NdCluster)
+{
+  // Three well-separated clusters in 16 dimensions, interleaved so
+  // the first-k seeding starts with one point of each cluster.
+  const unsigned int dim = 16;
+  const size_t perCluster = 30;
+  std::vector<double> data;
+  for (size_t i = 0; i < 3 * perCluster; ++i)
+  {
+    const size_t c = i % 3;
+    for (unsigned int j = 0; j < dim; ++j)
+    {
+      const double center = 10.0 * c * (j % 2 ? 1.0 : -1.0);
+      data.push_back(center + 0.01 * static_cast<double>(i % 7) +
+          0.001 * j);
+    }
+  }
+
+  math::KmeansNd kmeans(dim);
+  EXPECT_EQ(dim, kmeans.Dimension());
+  EXPECT_TRUE(kmeans.Observations(data.data(), 3 * perCluster));
+  EXPECT_EQ(3 * perCluster, kmeans.ObservationCount());
+
+  std::vector<double> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.Cluster(3, centroids, labels));
+  ASSERT_EQ(3 * dim, centroids.size());
+  ASSERT_EQ(3 * perCluster, labels.size());
+
+  // Points of one cluster share a label, and the labels differ
+  // between clusters.
+  for (size_t i = 0; i < 3 * perCluster; ++i)
+    EXPECT_EQ(labels[i % 3], labels[i]);
+  EXPECT_NE(labels[0], labels[1]);
+  EXPECT_NE(labels[1], labels[2]);
+  EXPECT_NE(labels[0], labels[2]);
+
+  // Each centroid sits on its cluster's mean.
+  for (size_t c = 0; c < 3; ++c)
+  {
+    const unsigned int label = labels[c];
+    for (unsigned int j = 0; j < dim; ++j)
+    {
+      double mean = 0.0;
+      for (size_t i = c; i < 3 * perCluster; i += 3)
+        mean += data[i * dim + j];
+      mean /= perCluster;
+      EXPECT_NEAR(mean, centroids[label * dim + j], 1e-9);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, NdMatchesVector3)
+{
+  // At dimension three the generalized engine reproduces the
+  // Vector3d clustering.
+  std::vector<math::Vector3d> obs;
+  for (int i = 0; i < 40; ++i)
+  {
+    obs.push_back(math::Vector3d(0.05 * i, 1.0 - 0.02 * i, i % 5));
+    obs.push_back(math::Vector3d(8.0 + 0.05 * i, -3.0, 2.0 + i % 3));
+  }
+
+  math::Kmeans reference(obs);
+  std::vector<math::Vector3d> refCentroids;
+  std::vector<unsigned int> refLabels;
+  EXPECT_TRUE(reference.Cluster(2, refCentroids, refLabels));
+
+  std::vector<double> flat;
+  for (const auto &o : obs)
+  {
+    flat.push_back(o.X());
+    flat.push_back(o.Y());
+    flat.push_back(o.Z());
+  }
+  math::KmeansNd kmeans(3);
+  EXPECT_TRUE(kmeans.Observations(flat.data(), obs.size()));
+
+  std::vector<double> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.Cluster(2, centroids, labels));
+
+  EXPECT_EQ(refLabels, labels);
+  ASSERT_EQ(refCentroids.size() * 3, centroids.size());
+  for (size_t i = 0; i < refCentroids.size(); ++i)
+  {
+    EXPECT_NEAR(refCentroids[i].X(), centroids[3 * i + 0], 1e-12);
+    EXPECT_NEAR(refCentroids[i].Y(), centroids[3 * i + 1], 1e-12);
+    EXPECT_NEAR(refCentroids[i].Z(), centroids[3 * i + 2], 1e-12);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, NdStridedAndErrors)
+{
+  // A stride wider than the dimension skips the padding columns.
+  const double padded[] = {
+    0.0, 0.0, -1.0, -1.0,
+    0.1, 0.1, -1.0, -1.0,
+    9.0, 9.0, -1.0, -1.0,
+    9.1, 9.1, -1.0, -1.0,
+  };
+  math::KmeansNd kmeans(2);
+  EXPECT_TRUE(kmeans.Observations(padded, 4, 4));
+  EXPECT_EQ(4u, kmeans.ObservationCount());
+
+  std::vector<double> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.Cluster(2, centroids, labels));
+  EXPECT_EQ(labels[0], labels[1]);
+  EXPECT_EQ(labels[2], labels[3]);
+  EXPECT_NE(labels[0], labels[2]);
+
+  // Error cases: empty buffer, undersized stride, bad cluster
+  // counts, and a zero dimension.
+  EXPECT_FALSE(kmeans.Observations(nullptr, 4));
+  EXPECT_FALSE(kmeans.AppendObservations(padded, 0));
+  EXPECT_FALSE(kmeans.Observations(padded, 4, 1));
+  EXPECT_FALSE(kmeans.Cluster(0, centroids, labels));
+  EXPECT_FALSE(kmeans.Cluster(5, centroids, labels));
+
+  math::KmeansNd degenerate(0);
+  EXPECT_FALSE(degenerate.Observations(padded, 4));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, Budgeted)
+{
+  // Two well-separated groups plus noise, enough points that the run
+  // takes a few iterations from the default seeding.
+  std::vector<math::Vector3d> obs;
+  math::Rand::Seed(2468);
+  for (int i = 0; i < 500; ++i)
+  {
+    const double cx = (i % 2 == 0) ? 0.0 : 8.0;
+    obs.push_back(math::Vector3d(cx + math::Rand::DblUniform(-1, 1),
+                                 math::Rand::DblUniform(-1, 1),
+                                 math::Rand::DblUniform(-1, 1)));
+  }
+
+  math::Kmeans kmeans(obs);
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+
+  // The callback sees every iteration, numbered from one, and an
+  // unbudgeted run matches plain Cluster().
+  std::vector<math::Kmeans::IterationInfo> telemetry;
+  EXPECT_TRUE(kmeans.ClusterBudgeted(2, centroids, labels, 0, 0.0,
+      [&telemetry](const math::Kmeans::IterationInfo &_info)
+      {
+        telemetry.push_back(_info);
+        return true;
+      }));
+  ASSERT_FALSE(telemetry.empty());
+  for (size_t i = 0; i < telemetry.size(); ++i)
+  {
+    EXPECT_EQ(i + 1, telemetry[i].iteration);
+    EXPECT_GE(telemetry[i].maxMovement, 0.0);
+  }
+  // The final iteration is the converged one.
+  EXPECT_LE(telemetry.back().changed, obs.size() >> 10);
+
+  std::vector<math::Vector3d> plainCentroids;
+  std::vector<unsigned int> plainLabels;
+  EXPECT_TRUE(kmeans.Cluster(2, plainCentroids, plainLabels));
+  ASSERT_EQ(plainCentroids.size(), centroids.size());
+  for (size_t i = 0; i < centroids.size(); ++i)
+    EXPECT_EQ(plainCentroids[i], centroids[i]);
+
+  // An iteration budget of one stops after a single, valid pass.
+  size_t callbackCount = 0;
+  EXPECT_TRUE(kmeans.ClusterBudgeted(2, centroids, labels, 1, 0.0,
+      [&callbackCount](const math::Kmeans::IterationInfo &)
+      {
+        ++callbackCount;
+        return true;
+      }));
+  EXPECT_EQ(1u, callbackCount);
+  EXPECT_EQ(obs.size(), labels.size());
+  EXPECT_EQ(2u, centroids.size());
+
+  // The callback can stop the run.
+  callbackCount = 0;
+  EXPECT_TRUE(kmeans.ClusterBudgeted(2, centroids, labels, 0, 0.0,
+      [&callbackCount](const math::Kmeans::IterationInfo &)
+      {
+        ++callbackCount;
+        return false;
+      }));
+  EXPECT_EQ(1u, callbackCount);
+
+  // A vanishing time budget stops after the first iteration; the
+  // telemetry is optional.
+  EXPECT_TRUE(kmeans.ClusterBudgeted(2, centroids, labels, 0, 1e-12));
+  EXPECT_EQ(obs.size(), labels.size());
+
+  // The usual failure modes still apply.
+  EXPECT_FALSE(kmeans.ClusterBudgeted(0, centroids, labels, 1));
+  EXPECT_FALSE(kmeans.ClusterBudgeted(
+      static_cast<int>(obs.size()) + 1, centroids, labels, 1));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, ObservationsView)
+{
+  // Two well-separated blobs in a caller-owned buffer.
+  std::vector<math::Vector3d> obs;
+  for (auto i = 0; i < 50; ++i)
+  {
+    obs.push_back(math::Vector3d(1.0 + 0.01 * i, 1.0, 0.0));
+    obs.push_back(math::Vector3d(9.0 + 0.01 * i, 9.0, 0.0));
+  }
+
+  // Clustering over the view matches clustering over an owned copy.
+  math::Kmeans owned(obs);
+  std::vector<math::Vector3d> ownedCentroids;
+  std::vector<unsigned int> ownedLabels;
+  EXPECT_TRUE(owned.Cluster(2, ownedCentroids, ownedLabels));
+
+  math::Kmeans viewed(std::vector<math::Vector3d>{math::Vector3d::Zero});
+  EXPECT_TRUE(viewed.ObservationsView(obs.data(), obs.size()));
+  EXPECT_EQ(viewed.Observations().size(), obs.size());
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(viewed.Cluster(2, centroids, labels));
+  ASSERT_EQ(centroids.size(), ownedCentroids.size());
+  ASSERT_EQ(labels.size(), ownedLabels.size());
+  for (auto i = 0u; i < centroids.size(); ++i)
+    EXPECT_EQ(centroids[i], ownedCentroids[i]);
+  for (auto i = 0u; i < labels.size(); ++i)
+    EXPECT_EQ(labels[i], ownedLabels[i]);
+
+  // Edits to the caller-owned buffer are visible without a new set
+  // call; a view holds no copy to go stale.
+  obs[0] = math::Vector3d(1.5, 1.0, 0.0);
+  EXPECT_EQ(viewed.Observations()[0], obs[0]);
+
+  // In-place replacement through the class is rejected while viewing.
+  EXPECT_FALSE(viewed.UpdateObservations({0},
+      {math::Vector3d(2.0, 1.0, 0.0)}));
+
+  // Appending materializes the view once; the result owns all points.
+  const size_t before = viewed.Observations().size();
+  EXPECT_TRUE(viewed.AppendObservations({math::Vector3d(9.5, 9.0, 0.0)}));
+  EXPECT_EQ(viewed.Observations().size(), before + 1);
+  EXPECT_TRUE(viewed.UpdateObservations({0},
+      {math::Vector3d(2.0, 1.0, 0.0)}));
+  EXPECT_TRUE(viewed.Cluster(2, centroids, labels));
+  EXPECT_EQ(labels.size(), before + 1);
+
+  // Empty views are rejected.
+  EXPECT_FALSE(viewed.ObservationsView(nullptr, 10));
+  EXPECT_FALSE(viewed.ObservationsView(obs.data(), 0));
+}
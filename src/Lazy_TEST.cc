@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include "ignition/math/Lazy.hh"
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/Vector4.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(LazyTest, Vector3Chain)
+{
+  Vector3d a(1, 2, 3);
+  Vector3d b(-4, 0.5, 2);
+  Vector3d c(0.25, -1, 7);
+  Vector3d d(3, 3, -2);
+
+  Vector3d eager = a + b * 2.0 - c.Cross(d);
+  Vector3d fused = lazy::Eval(lazy::Ref(a) + b * 2.0 - lazy::Cross(c, d));
+  EXPECT_EQ(eager, fused);
+
+  // Scalar on either side, nested scaling.
+  EXPECT_EQ(a * 3.0 + b, lazy::Eval(3.0 * lazy::Ref(a) + b));
+  EXPECT_EQ((a - b) * 0.5, lazy::Eval((lazy::Ref(a) - b) * 0.5));
+
+  // Cross of expressions, not just leaves.
+  Vector3d expected = (a + b).Cross(c - d);
+  Vector3d got = lazy::Eval(
+      lazy::Cross(lazy::Ref(a) + b, lazy::Ref(c) - d));
+  EXPECT_EQ(expected, got);
+}
+
+/////////////////////////////////////////////////
+TEST(LazyTest, Vector4Chain)
+{
+  Vector4d a(1, 2, 3, 4);
+  Vector4d b(-1, 0.5, 2, -3);
+  Vector4d c(2, 2, -2, 0.25);
+
+  Vector4d eager = a + b - c * 4.0;
+  Vector4d fused = lazy::Eval(lazy::Ref(a) + b - lazy::Ref(c) * 4.0);
+  EXPECT_EQ(eager, fused);
+}
+
+/////////////////////////////////////////////////
+TEST(LazyTest, Dot)
+{
+  Vector3d a(1, 2, 3);
+  Vector3d b(-4, 0.5, 2);
+  Vector3d c(0.25, -1, 7);
+
+  EXPECT_DOUBLE_EQ(a.Dot(b), lazy::Dot(a, b));
+  EXPECT_DOUBLE_EQ((a + b).Dot(c), lazy::Dot(lazy::Ref(a) + b, c));
+}
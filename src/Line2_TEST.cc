@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Line2.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -266,3 +268,63 @@ TEST(Line2Test, OperatorStreamOut)
   stream << line;
   EXPECT_EQ(stream.str(), "0 1 2 3");
 }
+
+/////////////////////////////////////////////////
+TEST(Line2Test, IntersectBatch)
+{
+  // Crossing, touching, disjoint, parallel and collinear pairs; the
+  // batch kernel must agree with scalar Intersect except for the
+  // documented collinear-overlap case, which it reports as miss.
+  std::vector<math::Line2d> linesA, linesB;
+  // Plain crossing at (1, 1).
+  linesA.push_back(math::Line2d(0, 0, 2, 2));
+  linesB.push_back(math::Line2d(0, 2, 2, 0));
+  // Endpoint touch at (1, 0).
+  linesA.push_back(math::Line2d(0, 0, 1, 0));
+  linesB.push_back(math::Line2d(1, 0, 1, 5));
+  // Lines cross but segments do not reach.
+  linesA.push_back(math::Line2d(0, 0, 1, 0));
+  linesB.push_back(math::Line2d(3, -1, 3, 1));
+  // Parallel, offset.
+  linesA.push_back(math::Line2d(0, 0, 2, 0));
+  linesB.push_back(math::Line2d(0, 1, 2, 1));
+  // Crossing at a less convenient spot.
+  linesA.push_back(math::Line2d(-3, -2, 5, 4));
+  linesB.push_back(math::Line2d(-1, 4, 2, -5));
+
+  std::vector<math::Vector2d> points(linesA.size());
+  std::vector<uint8_t> flags(linesA.size(), 2);
+  EXPECT_EQ(math::Line2d::IntersectBatch(linesA.data(), linesB.data(),
+      points.data(), flags.data(), linesA.size()), 3u);
+
+  EXPECT_EQ(flags[0], 1);
+  EXPECT_EQ(points[0], math::Vector2d(1, 1));
+  EXPECT_EQ(flags[1], 1);
+  EXPECT_EQ(points[1], math::Vector2d(1, 0));
+  EXPECT_EQ(flags[2], 0);
+  EXPECT_EQ(flags[3], 0);
+  EXPECT_EQ(flags[4], 1);
+
+  // The computed points match the scalar path where both report a
+  // hit.
+  for (size_t i = 0; i < linesA.size(); ++i)
+  {
+    math::Vector2d pt;
+    if (flags[i] && linesA[i].Intersect(linesB[i], pt))
+    {
+      EXPECT_NEAR(points[i].X(), pt.X(), 1e-9) << i;
+      EXPECT_NEAR(points[i].Y(), pt.Y(), 1e-9) << i;
+    }
+  }
+
+  // Documented difference: collinear overlap is a scalar hit but a
+  // batch miss.
+  math::Line2d colA(0, 0, 2, 0);
+  math::Line2d colB(1, 0, 3, 0);
+  EXPECT_TRUE(colA.Intersect(colB));
+  math::Vector2d pt;
+  uint8_t flag = 2;
+  EXPECT_EQ(math::Line2d::IntersectBatch(&colA, &colB, &pt, &flag, 1), 0u);
+  EXPECT_EQ(flag, 0);
+}
+
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Line3.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -291,3 +293,99 @@ TEST(Line3Test, Coplanar)
   EXPECT_FALSE(line.Coplanar(math::Line3d(1, 0, 0, 1, 1, 1)));
   EXPECT_FALSE(line.Coplanar(math::Line3d(1, 0, 1, 2, 0, 0)));
 }
+
+/////////////////////////////////////////////////
+TEST(Line3Test, DistanceBatch)
+{
+  // A mix of skew, crossing, parallel and degenerate pairs.
+  std::vector<math::Line3d> linesA;
+  std::vector<math::Line3d> linesB;
+
+  linesA.push_back(math::Line3d(0, 0, 0, 1, 0, 0));
+  linesB.push_back(math::Line3d(0, 1, 1, 1, 1, 1));
+
+  linesA.push_back(math::Line3d(-1, -1, 0, 1, 1, 0));
+  linesB.push_back(math::Line3d(-1, 1, 0, 1, -1, 0));
+
+  // Parallel, offset segments.
+  linesA.push_back(math::Line3d(0, 0, 0, 2, 0, 0));
+  linesB.push_back(math::Line3d(3, 1, 0, 5, 1, 0));
+
+  // A degenerate (zero length) second segment.
+  linesA.push_back(math::Line3d(0, 0, 0, 1, 0, 0));
+  linesB.push_back(math::Line3d(2, 2, 2, 2, 2, 2));
+
+  // Closest points on interior and endpoint respectively.
+  linesA.push_back(math::Line3d(0, 0, 0, 4, 0, 0));
+  linesB.push_back(math::Line3d(1, 1, -1, 2, 3, 4));
+
+  const size_t count = linesA.size();
+  std::vector<math::Line3d> results(count);
+  std::vector<uint8_t> valid(count, 2);
+
+  const size_t found = math::Line3d::DistanceBatch(linesA.data(),
+      linesB.data(), results.data(), valid.data(), count);
+  EXPECT_EQ(count - 1, found);
+
+  std::vector<double> distSq(count, -1.0);
+  EXPECT_EQ(count - 1, math::Line3d::DistanceSquaredBatch(linesA.data(),
+      linesB.data(), distSq.data(), count));
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    math::Line3d expected;
+    const bool ok = linesA[i].Distance(linesB[i], expected);
+    EXPECT_EQ(ok ? 1 : 0, valid[i]) << i;
+    if (!ok)
+    {
+      EXPECT_DOUBLE_EQ(ignition::math::MAX_D, distSq[i]) << i;
+      continue;
+    }
+    EXPECT_EQ(expected, results[i]) << i;
+    EXPECT_NEAR(expected.Length() * expected.Length(), distSq[i], 1e-12)
+        << i;
+  }
+
+  // Zero count is a no-op.
+  EXPECT_EQ(0u, math::Line3d::DistanceBatch(linesA.data(), linesB.data(),
+      results.data(), valid.data(), 0));
+  EXPECT_EQ(0u, math::Line3d::DistanceSquaredBatch(linesA.data(),
+      linesB.data(), distSq.data(), 0));
+}
+
+/////////////////////////////////////////////////
+TEST(Line3Test, IntersectBatch)
+{
+  std::vector<math::Line3d> linesA, linesB;
+  // Crossing at (1, 1, 0).
+  linesA.push_back(math::Line3d(0, 0, 0, 2, 2, 0));
+  linesB.push_back(math::Line3d(0, 2, 0, 2, 0, 0));
+  // Skew, never touching.
+  linesA.push_back(math::Line3d(0, 0, 0, 1, 0, 0));
+  linesB.push_back(math::Line3d(0, 0, 1, 0, 1, 1));
+  // Collinear overlap; the scalar path reports the endpoint.
+  linesA.push_back(math::Line3d(0, 0, 0, 2, 0, 0));
+  linesB.push_back(math::Line3d(1, 0, 0, 3, 0, 0));
+
+  std::vector<math::Vector3d> points(linesA.size());
+  std::vector<uint8_t> flags(linesA.size(), 2);
+  EXPECT_EQ(math::Line3d::IntersectBatch(linesA.data(), linesB.data(),
+      points.data(), flags.data(), linesA.size()), 2u);
+
+  EXPECT_EQ(flags[0], 1);
+  EXPECT_EQ(points[0], math::Vector3d(1, 1, 0));
+  EXPECT_EQ(flags[1], 0);
+  EXPECT_EQ(flags[2], 1);
+
+  // Each entry agrees with the scalar Intersect.
+  for (size_t i = 0; i < linesA.size(); ++i)
+  {
+    math::Vector3d pt;
+    EXPECT_EQ(flags[i] == 1, linesA[i].Intersect(linesB[i], pt)) << i;
+    if (flags[i])
+    {
+      EXPECT_EQ(points[i], pt) << i;
+    }
+  }
+}
+
@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/MassMatrix3.hh"
@@ -934,3 +935,178 @@ TEST(MassMatrix3dTest, ValidMomentsTolerance)
   EXPECT_FALSE(massMatrix.IsNearPositive(-1));
   EXPECT_FALSE(massMatrix.IsPositive(-1));
 }
+
+/////////////////////////////////////////////////
+TEST(MassMatrix3dTest, BatchPrincipalMoments)
+{
+  // A mix of diagonal, degenerate and fully populated matrices.
+  std::vector<math::MassMatrix3d> bodies;
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(2.0, 3.0, 4.0), math::Vector3d::Zero));
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(2.0, 2.0, 2.0),
+      math::Vector3d(-1.0, 0, -1.0)));
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(4.0, 4.0, 4.0),
+      math::Vector3d(-1.0, -1.0, -1.0)));
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(3.0, 3.0, 3.0), math::Vector3d::Zero));
+  // Enough copies to cross a block boundary.
+  for (int i = 0; i < 40; ++i)
+  {
+    bodies.push_back(math::MassMatrix3d(1.0,
+        math::Vector3d(2.0 + 0.1*i, 3.0, 4.0),
+        math::Vector3d(0.1, 0.2, 0.3)));
+  }
+
+  std::vector<math::Vector3d> moments(bodies.size());
+  math::MassMatrix3d::BatchPrincipalMoments(bodies.data(),
+      moments.data(), bodies.size());
+
+  for (size_t i = 0; i < bodies.size(); ++i)
+  {
+    const math::Vector3d expected = bodies[i].PrincipalMoments();
+    EXPECT_EQ(expected, moments[i]) << "body " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(MassMatrix3dTest, BatchIsPositive)
+{
+  std::vector<math::MassMatrix3d> bodies;
+  // Positive definite.
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(2.0, 3.0, 4.0), math::Vector3d(0.1, 0.2, 0.3)));
+  // Zero mass.
+  bodies.push_back(math::MassMatrix3d(0.0,
+      math::Vector3d(1.0, 1.0, 1.0), math::Vector3d::Zero));
+  // Negative diagonal moment.
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(-1.0, 1.0, 1.0), math::Vector3d::Zero));
+  // Indefinite moment of inertia matrix.
+  bodies.push_back(math::MassMatrix3d(1.0,
+      math::Vector3d(1.0, 1.0, 1.0), math::Vector3d(2.0, 0, 0)));
+  // Default constructed.
+  bodies.push_back(math::MassMatrix3d());
+
+  std::vector<bool> expected;
+  for (auto const &body : bodies)
+    expected.push_back(body.IsPositive());
+
+  std::vector<char> positive(bodies.size(), 2);
+  const size_t count = math::MassMatrix3d::BatchIsPositive(bodies.data(),
+      reinterpret_cast<bool *>(positive.data()), bodies.size());
+
+  size_t expectedCount = 0;
+  for (size_t i = 0; i < bodies.size(); ++i)
+  {
+    EXPECT_EQ(expected[i], static_cast<bool>(positive[i])) << "body " << i;
+    if (expected[i])
+      ++expectedCount;
+  }
+  EXPECT_EQ(expectedCount, count);
+}
+
+/////////////////////////////////////////////////
+TEST(MassMatrix3dTest, IncrementalMoments)
+{
+  math::IncrementalMomentsd moments;
+
+  // Empty accumulator.
+  EXPECT_EQ(0u, moments.Count());
+  EXPECT_DOUBLE_EQ(0.0, moments.Mass());
+  EXPECT_EQ(math::Vector3d::Zero, moments.CenterOfMass());
+  EXPECT_EQ(math::Matrix3d::Zero, moments.Moi());
+  EXPECT_EQ(math::Vector3d::Zero, moments.PrincipalMoments());
+
+  // A cloud of unit-mass points on a tilted box lattice.
+  const math::Quaterniond tilt(0.3, -0.2, 0.4);
+  std::vector<math::Vector3d> points;
+  for (int x = -2; x <= 2; ++x)
+    for (int y = -1; y <= 1; ++y)
+      for (int z = 0; z <= 3; ++z)
+        points.push_back(tilt.RotateVector(
+            math::Vector3d(0.5 * x, 0.8 * y, 0.3 * z) +
+            math::Vector3d(1.0, -2.0, 0.5)));
+
+  moments.Add(points.data(), points.size());
+  EXPECT_EQ(points.size(), moments.Count());
+  EXPECT_DOUBLE_EQ(static_cast<double>(points.size()), moments.Mass());
+
+  // Center of mass matches the direct average.
+  math::Vector3d com;
+  for (const auto &p : points)
+    com += p;
+  com /= points.size();
+  EXPECT_EQ(com, moments.CenterOfMass());
+
+  // The inertia matrix matches the direct two-pass computation about
+  // the center of mass.
+  math::Matrix3d direct;
+  for (const auto &p : points)
+  {
+    const math::Vector3d r = p - com;
+    direct(0, 0) += r.Y() * r.Y() + r.Z() * r.Z();
+    direct(1, 1) += r.X() * r.X() + r.Z() * r.Z();
+    direct(2, 2) += r.X() * r.X() + r.Y() * r.Y();
+    direct(0, 1) -= r.X() * r.Y();
+    direct(0, 2) -= r.X() * r.Z();
+    direct(1, 2) -= r.Y() * r.Z();
+  }
+  direct(1, 0) = direct(0, 1);
+  direct(2, 0) = direct(0, 2);
+  direct(2, 1) = direct(1, 2);
+  const math::Matrix3d moi = moments.Moi();
+  for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 3; ++c)
+      EXPECT_NEAR(direct(r, c), moi(r, c), 1e-9);
+
+  // The refreshed principal moments match the full decomposition of
+  // the equivalent MassMatrix3, up to ordering.
+  const math::MassMatrix3d m = moments.MassMatrix();
+  EXPECT_DOUBLE_EQ(moments.Mass(), m.Mass());
+  math::Vector3d sorted = m.PrincipalMoments(-1e-6);
+  math::Vector3d refreshed = moments.PrincipalMoments();
+  double r0 = refreshed.X(), r1 = refreshed.Y(), r2 = refreshed.Z();
+  math::sort3(r0, r1, r2);
+  EXPECT_NEAR(sorted.X(), r0, 1e-7 * sorted.Z());
+  EXPECT_NEAR(sorted.Y(), r1, 1e-7 * sorted.Z());
+  EXPECT_NEAR(sorted.Z(), r2, 1e-7 * sorted.Z());
+
+  // The tracked axes diagonalize the inertia: R diag(l) R^T == I.
+  const math::Matrix3d axes(moments.PrincipalAxes());
+  math::Matrix3d diag;
+  diag(0, 0) = refreshed.X();
+  diag(1, 1) = refreshed.Y();
+  diag(2, 2) = refreshed.Z();
+  const math::Matrix3d rebuilt = axes * diag * axes.Transposed();
+  for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 3; ++c)
+      EXPECT_NEAR(moi(r, c), rebuilt(r, c), 1e-7 * sorted.Z());
+
+  // Streaming: small updates between refreshes stay consistent with
+  // the full decomposition, and the warm start keeps the moments on
+  // their axes (no re-sorting jumps).
+  for (int step = 0; step < 5; ++step)
+  {
+    moments.Add(tilt.RotateVector(
+        math::Vector3d(0.1 * step, 0.2, -0.1)) + com, 0.5);
+    const math::Vector3d previous = refreshed;
+    refreshed = moments.PrincipalMoments();
+    EXPECT_NEAR(previous.X(), refreshed.X(), 0.5 * sorted.Z());
+    EXPECT_NEAR(previous.Y(), refreshed.Y(), 0.5 * sorted.Z());
+
+    math::Vector3d check = moments.MassMatrix().PrincipalMoments(-1e-6);
+    double s0 = refreshed.X(), s1 = refreshed.Y(), s2 = refreshed.Z();
+    math::sort3(s0, s1, s2);
+    EXPECT_NEAR(check.X(), s0, 1e-7 * check.Z());
+    EXPECT_NEAR(check.Y(), s1, 1e-7 * check.Z());
+    EXPECT_NEAR(check.Z(), s2, 1e-7 * check.Z());
+  }
+
+  // Reset forgets everything.
+  moments.Reset();
+  EXPECT_EQ(0u, moments.Count());
+  EXPECT_DOUBLE_EQ(0.0, moments.Mass());
+  EXPECT_EQ(math::Quaterniond::Identity, moments.PrincipalAxes());
+}
@@ -15,6 +15,11 @@
  *
 */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
 #include "ignition/math/Material.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -24,20 +29,71 @@
 using namespace ignition;
 using namespace math;
 
-// Initialize the static map of Material objects based on the kMaterialData.
-static const std::map<MaterialType, Material> kMaterials = []()
+// The map of predefined Material objects based on kMaterialData,
+// built on first use rather than at static initialization so the
+// library contributes nothing to process cold start.
+static const std::map<MaterialType, Material> &Materials()
 {
-  std::map<MaterialType, Material> matMap;
+  static const std::map<MaterialType, Material> kMaterials = []()
+  {
+    std::map<MaterialType, Material> matMap;
+
+    for (const std::pair<MaterialType, MaterialData> &mat :
+        MaterialDataMap())
+    {
+      matMap[mat.first].SetType(mat.first);
+      matMap[mat.first].SetName(mat.second.name);
+      matMap[mat.first].SetDensity(mat.second.density);
+    }
+
+    return matMap;
+  }();
+  return kMaterials;
+}
 
-  for (const std::pair<MaterialType, MaterialData> &mat : kMaterialData)
+// Lowercase name -> type index, sorted once on first use so resolving
+// a material name is a binary search instead of a scan over the
+// predefined map with a string compare per entry.
+static const std::vector<std::pair<std::string, MaterialType>>
+    &MaterialsByName()
+{
+  static const std::vector<std::pair<std::string, MaterialType>>
+      kMaterialsByName = []()
   {
-    matMap[mat.first].SetType(mat.first);
-    matMap[mat.first].SetName(mat.second.name);
-    matMap[mat.first].SetDensity(mat.second.density);
-  }
+    std::vector<std::pair<std::string, MaterialType>> index;
+    index.reserve(MaterialDataMap().size());
+    for (const std::pair<MaterialType, MaterialData> &mat :
+        MaterialDataMap())
+      index.push_back({mat.second.name, mat.first});
+    std::sort(index.begin(), index.end());
+    return index;
+  }();
+  return kMaterialsByName;
+}
 
-  return matMap;
-}();
+// Column of densities indexed by the numeric value of MaterialType,
+// so density lookups in inner loops compile to a single array read.
+// Keep in sync with kMaterialData in MaterialType.hh and the
+// MaterialType enum; the parity is checked by Material_TEST.
+static constexpr std::array<double,
+    static_cast<std::size_t>(MaterialType::UNKNOWN_MATERIAL) + 1>
+    kDensityByType =
+{{
+  75.0,      // STYROFOAM
+  373.0,     // PINE
+  700.0,     // WOOD
+  710.0,     // OAK
+  1175.0,    // PLASTIC
+  2000.0,    // CONCRETE
+  2700.0,    // ALUMINUM
+  7600.0,    // STEEL_ALLOY
+  7800.0,    // STEEL_STAINLESS
+  7870.0,    // IRON
+  8600.0,    // BRASS
+  8940.0,    // COPPER
+  19300.0,   // TUNGSTEN
+  -1.0       // UNKNOWN_MATERIAL
+}};
 
 // Private data for the Material class
 class ignition::math::MaterialPrivate
@@ -63,11 +119,11 @@ Material::Material()
 Material::Material(const MaterialType _type)
 : dataPtr(new MaterialPrivate)
 {
-  if (kMaterials.find(_type) != kMaterials.end())
+  if (Materials().find(_type) != Materials().end())
   {
     this->dataPtr->type = _type;
-    this->dataPtr->name = kMaterials.at(_type).Name();
-    this->dataPtr->density = kMaterials.at(_type).Density();
+    this->dataPtr->name = Materials().at(_type).Name();
+    this->dataPtr->density = Materials().at(_type).Density();
   }
 }
 
@@ -79,13 +135,15 @@ Material::Material(const std::string &_typename)
   std::string material = _typename;
   std::transform(material.begin(), material.end(), material.begin(), ::tolower);
 
-  for (const std::pair<MaterialType, Material> &mat : kMaterials)
-  {
-    if (mat.second.Name() == material)
-    {
-      *this = mat.second;
-    }
-  }
+  const auto iter = std::lower_bound(
+      MaterialsByName().begin(), MaterialsByName().end(), material,
+      [](const std::pair<std::string, MaterialType> &_entry,
+         const std::string &_name)
+      {
+        return _entry.first < _name;
+      });
+  if (iter != MaterialsByName().end() && iter->first == material)
+    *this = Materials().at(iter->second);
 }
 
 ///////////////////////////////
@@ -121,7 +179,24 @@ Material::~Material()
 ///////////////////////////////
 const std::map<MaterialType, Material> &Material::Predefined()
 {
-  return kMaterials;
+  return Materials();
+}
+
+///////////////////////////////
+double Material::Density(const MaterialType _type)
+{
+  const auto index = static_cast<std::size_t>(_type);
+  if (index >= kDensityByType.size())
+    return -1.0;
+  return kDensityByType[index];
+}
+
+///////////////////////////////
+void Material::FillDensities(const MaterialType *_types,
+    const std::size_t _count, double *_densities)
+{
+  for (std::size_t i = 0; i < _count; ++i)
+    _densities[i] = Material::Density(_types[i]);
 }
 
 ///////////////////////////////
@@ -198,7 +273,7 @@ void Material::SetToNearestDensity(const double _value, const double _epsilon)
   double min = MAX_D;
   Material result;
 
-  for (const std::pair<MaterialType, Material> &mat : kMaterials)
+  for (const std::pair<MaterialType, Material> &mat : Materials())
   {
     double diff = std::fabs(mat.second.Density() - _value);
     if (diff < min && diff < _epsilon)
@@ -34,10 +34,14 @@ struct MaterialData
   double density;
 };
 
-// The mapping of material type to name and density values.
+// The mapping of material type to name and density values, built on
+// first use so processes that never touch Material pay nothing at
+// startup.
 // If you modify this map, make sure to also modify the MaterialType enum in
 // include/ignition/math/MaterialTypes.hh
-static std::map<MaterialType, MaterialData> kMaterialData =
+static const std::map<MaterialType, MaterialData> &MaterialDataMap()
+{
+  static const std::map<MaterialType, MaterialData> kMaterialData =
 {{
   {MaterialType::STYROFOAM, {"styrofoam", 75.0}},
   {MaterialType::PINE, {"pine", 373.0}},
@@ -53,4 +57,6 @@ static std::map<MaterialType, MaterialData> kMaterialData =
   {MaterialType::COPPER, {"copper", 8940.0}},
   {MaterialType::TUNGSTEN, {"tungsten", 19300.0}}
 }};
+  return kMaterialData;
+}
 #endif
@@ -137,3 +137,49 @@ TEST(MaterialTest, Accessors)
     EXPECT_DOUBLE_EQ(19300, material.Density());
   }
 }
+
+/////////////////////////////////////////////////
+TEST(MaterialTest, LookupByName)
+{
+  // Every predefined material resolves back through its name.
+  for (const auto &mat : Material::Predefined())
+  {
+    Material byName(mat.second.Name());
+    EXPECT_EQ(mat.second.Type(), byName.Type()) << mat.second.Name();
+    EXPECT_DOUBLE_EQ(mat.second.Density(), byName.Density());
+  }
+
+  // The lookup is case insensitive.
+  Material upper("STYROFOAM");
+  EXPECT_EQ(MaterialType::STYROFOAM, upper.Type());
+
+  // Unknown names yield the unknown material.
+  Material unknown("not_a_material");
+  EXPECT_EQ(MaterialType::UNKNOWN_MATERIAL, unknown.Type());
+  EXPECT_TRUE(unknown.Name().empty());
+}
+
+/////////////////////////////////////////////////
+TEST(MaterialTest, DensityTable)
+{
+  // The columnar density table agrees with the predefined materials,
+  // which guards against the two falling out of sync.
+  for (const auto &mat : Material::Predefined())
+  {
+    EXPECT_DOUBLE_EQ(mat.second.Density(),
+        Material::Density(mat.first)) << mat.second.Name();
+  }
+  EXPECT_DOUBLE_EQ(-1.0,
+      Material::Density(MaterialType::UNKNOWN_MATERIAL));
+
+  // Batch fill matches the scalar lookup.
+  const MaterialType types[] = {MaterialType::WOOD,
+      MaterialType::TUNGSTEN, MaterialType::UNKNOWN_MATERIAL,
+      MaterialType::STYROFOAM};
+  double densities[4] = {0, 0, 0, 0};
+  Material::FillDensities(types, 4, densities);
+  EXPECT_DOUBLE_EQ(700.0, densities[0]);
+  EXPECT_DOUBLE_EQ(19300.0, densities[1]);
+  EXPECT_DOUBLE_EQ(-1.0, densities[2]);
+  EXPECT_DOUBLE_EQ(75.0, densities[3]);
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Matrix3.hh"
 
@@ -398,3 +400,41 @@ TEST(Matrix3dTest, From2Axes)
   m1.From2Axes(v1, v2);
   EXPECT_EQ(math::Matrix3d::Zero - math::Matrix3d::Identity, m1);
 }
+
+/////////////////////////////////////////////////
+TEST(Matrix3dTest, MultiplyBatch)
+{
+  // Build an array of rotation pairs covering many axes.
+  std::vector<math::Matrix3d> a, b;
+  for (int i = 0; i < 100; ++i)
+  {
+    a.push_back(math::Matrix3d(
+        math::Quaterniond(0.03 * i, -0.07 * i, 0.11 * i)));
+    b.push_back(math::Matrix3d(
+        math::Quaterniond(-0.05 * i, 0.02 * i, 0.13 * i)));
+  }
+
+  // The batch matches operator* pair by pair.
+  std::vector<math::Matrix3d> out(a.size());
+  math::Matrix3d::MultiplyBatch(a.data(), b.data(), out.data(), a.size());
+  for (size_t i = 0; i < a.size(); ++i)
+    EXPECT_EQ(a[i] * b[i], out[i]) << i;
+
+  // The transposed variant matches Transposed() * b.
+  math::Matrix3d::TransposedMultiplyBatch(a.data(), b.data(), out.data(),
+      a.size());
+  for (size_t i = 0; i < a.size(); ++i)
+    EXPECT_EQ(a[i].Transposed() * b[i], out[i]) << i;
+
+  // In-place composition overwrites an input safely.
+  std::vector<math::Matrix3d> expected(a.size());
+  math::Matrix3d::MultiplyBatch(a.data(), b.data(), expected.data(),
+      a.size());
+  math::Matrix3d::MultiplyBatch(a.data(), b.data(), a.data(), a.size());
+  for (size_t i = 0; i < a.size(); ++i)
+    EXPECT_EQ(expected[i], a[i]) << i;
+
+  // Zero count is a no-op.
+  math::Matrix3d::MultiplyBatch(nullptr, nullptr, nullptr, 0);
+  math::Matrix3d::TransposedMultiplyBatch(nullptr, nullptr, nullptr, 0);
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Pose3.hh"
 #include "ignition/math/Quaternion.hh"
 #include "ignition/math/Matrix4.hh"
@@ -720,3 +722,182 @@ TEST(Matrix4dTest, LookAt)
             math::Pose3d(1, 1, 1, IGN_PI_4, 0, IGN_PI));
 }
 
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, TransformPoints)
+{
+  math::Matrix4d tm(math::Pose3d(3, -1, 2, 0.3, -0.2, 1.1));
+
+  std::vector<math::Vector3d> points =
+      {{0, 0, 0}, {1, 2, 3}, {-4, 0.5, 2}};
+  std::vector<math::Vector3d> out(points.size());
+
+  tm.TransformPoints(points.data(), out.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(out[i], tm * points[i]);
+
+  // In-place transform is allowed.
+  std::vector<math::Vector3d> inPlace = points;
+  tm.TransformPoints(inPlace.data(), inPlace.data(), inPlace.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(inPlace[i], tm * points[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, TransformVectors)
+{
+  math::Matrix4d tm(math::Pose3d(3, -1, 2, 0.3, -0.2, 1.1));
+  math::Matrix4d rotOnly = tm;
+  rotOnly.SetTranslation(math::Vector3d::Zero);
+
+  std::vector<math::Vector3d> dirs = {{1, 0, 0}, {0, 0, 1}, {1, -2, 0.5}};
+  std::vector<math::Vector3d> out(dirs.size());
+
+  tm.TransformVectors(dirs.data(), out.data(), dirs.size());
+  for (size_t i = 0; i < dirs.size(); ++i)
+  {
+    // w=0: translation must not contribute.
+    EXPECT_EQ(out[i], rotOnly * dirs[i]);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, InverseRigid)
+{
+  math::Matrix4d mat(math::Pose3d(1, 2, 3, 0.4, -0.5, 0.6));
+  math::Matrix4d expected = mat.Inverse();
+  math::Matrix4d rigid = mat.InverseRigid();
+
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 4; ++col)
+      EXPECT_NEAR(expected(row, col), rigid(row, col), 1e-12);
+  }
+
+  EXPECT_EQ(math::Matrix4d::Identity, math::Matrix4d::Identity.InverseRigid());
+}
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, InverseAffine)
+{
+  // A transform with rotation, non-uniform scale and translation is
+  // affine but not rigid.
+  math::Matrix4d mat(math::Pose3d(1, 2, 3, 0.4, -0.5, 0.6));
+  math::Matrix4d scale;
+  scale = math::Matrix4d::Identity;
+  scale.Scale(2.0, 0.5, 3.0);
+  mat = mat * scale;
+
+  math::Matrix4d expected = mat.Inverse();
+  math::Matrix4d affine = mat.InverseAffine();
+
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 4; ++col)
+      EXPECT_NEAR(expected(row, col), affine(row, col), 1e-12);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, FloatMultiply)
+{
+  // The float-specialized multiply must match the generic formula.
+  math::Matrix4f a, b;
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 4; ++col)
+    {
+      a(row, col) = 0.25f * (row * 4 + col) - 1.5f;
+      b(row, col) = -0.5f * (row * 4 + col) + 3.0f;
+    }
+  }
+
+  const math::Matrix4f product = a * b;
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 4; ++col)
+    {
+      float expected = 0.0f;
+      for (int k = 0; k < 4; ++k)
+        expected += a(row, k) * b(k, col);
+      EXPECT_NEAR(product(row, col), expected, 1e-5) << row << " " << col;
+    }
+  }
+
+  // Identity behaves as expected.
+  EXPECT_EQ(a * math::Matrix4f::Identity, a);
+}
+
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, ProjectPoints)
+{
+  // A perspective projection looking down -Z: near 1, far 10, unit
+  // focal lengths.
+  const double n = 1.0, f = 10.0;
+  math::Matrix4d proj(
+      1, 0, 0, 0,
+      0, 1, 0, 0,
+      0, 0, -(f + n) / (f - n), -2 * f * n / (f - n),
+      0, 0, -1, 0);
+
+  const double left = 20, top = 10, width = 640, height = 480;
+
+  std::vector<math::Vector3d> points;
+  // On the view axis, in front of the camera.
+  points.push_back(math::Vector3d(0, 0, -2));
+  // Above center.
+  points.push_back(math::Vector3d(0, 1, -5));
+  // Outside the left clip plane.
+  points.push_back(math::Vector3d(-10, 0, -5));
+  // Beyond the far plane.
+  points.push_back(math::Vector3d(0, 0, -20));
+  // Behind the camera.
+  points.push_back(math::Vector3d(0, 0, 5));
+
+  std::vector<math::Vector3d> out(points.size());
+  std::vector<uint8_t> flags(points.size(), 0xff);
+  proj.ProjectPoints(points.data(), out.data(), flags.data(), points.size(),
+      left, top, width, height);
+
+  // The axis point lands on the viewport center with a depth inside
+  // (0, 1).
+  EXPECT_EQ(0u, flags[0]);
+  EXPECT_DOUBLE_EQ(left + width / 2, out[0].X());
+  EXPECT_DOUBLE_EQ(top + height / 2, out[0].Y());
+  EXPECT_LT(0.0, out[0].Z());
+  EXPECT_GT(1.0, out[0].Z());
+
+  // A point above the view axis has a smaller window y (y grows
+  // downward).
+  EXPECT_EQ(0u, flags[1]);
+  EXPECT_DOUBLE_EQ(left + width / 2, out[1].X());
+  EXPECT_LT(out[1].Y(), top + height / 2);
+
+  // Clipped points carry the expected flags.
+  EXPECT_EQ(math::Matrix4d::CLIP_LEFT, flags[2]);
+  EXPECT_EQ(math::Matrix4d::CLIP_FAR, flags[3]);
+  EXPECT_NE(0u, flags[4] & math::Matrix4d::CLIP_NEAR);
+
+  // The fused kernel agrees with the unfused scalar pipeline on a
+  // spread of visible points.
+  for (int i = 0; i < 20; ++i)
+  {
+    const math::Vector3d p(0.2 * i - 2.0, 0.1 * i - 1.0, -1.5 - 0.4 * i);
+    math::Vector3d projected;
+    uint8_t flag = 0xff;
+    proj.ProjectPoints(&p, &projected, &flag, 1, left, top, width, height);
+
+    const double cx = p.X();
+    const double cy = p.Y();
+    const double cz = -(f + n) / (f - n) * p.Z() - 2 * f * n / (f - n);
+    const double cw = -p.Z();
+    if (flag != 0)
+      continue;
+    // The kernel multiplies by a reciprocal instead of dividing, so
+    // allow a rounding-level difference.
+    EXPECT_NEAR(left + (cx / cw + 1) * width / 2, projected.X(), 1e-9) << i;
+    EXPECT_NEAR(top + (1 - cy / cw) * height / 2, projected.Y(), 1e-9) << i;
+    EXPECT_NEAR((cz / cw + 1) / 2, projected.Z(), 1e-12) << i;
+  }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "ignition/math/MatrixN.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(MatrixNTest, Construction)
+{
+  math::MatrixN<double, 2, 3> mat;
+  for (std::size_t row = 0; row < 2; ++row)
+    for (std::size_t col = 0; col < 3; ++col)
+      EXPECT_DOUBLE_EQ(mat(row, col), 0.0);
+
+  math::MatrixN<double, 2, 3> mat2(1.0, 2.0, 3.0,
+                                   4.0, 5.0, 6.0);
+  EXPECT_DOUBLE_EQ(mat2(0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(mat2(0, 2), 3.0);
+  EXPECT_DOUBLE_EQ(mat2(1, 0), 4.0);
+  EXPECT_DOUBLE_EQ(mat2(1, 2), 6.0);
+
+  // Out of range indices are clamped.
+  EXPECT_DOUBLE_EQ(mat2(10, 10), 6.0);
+
+  auto ident = math::Matrix6d::Identity();
+  for (std::size_t row = 0; row < 6; ++row)
+    for (std::size_t col = 0; col < 6; ++col)
+      EXPECT_DOUBLE_EQ(ident(row, col), row == col ? 1.0 : 0.0);
+
+  EXPECT_EQ(math::Matrix6d::RowCount(), 6u);
+  EXPECT_EQ(math::Matrix6d::ColCount(), 6u);
+}
+
+/////////////////////////////////////////////////
+TEST(MatrixNTest, Arithmetic)
+{
+  math::MatrixN<double, 2, 2> a(1.0, 2.0,
+                                3.0, 4.0);
+  math::MatrixN<double, 2, 2> b(5.0, 6.0,
+                                7.0, 8.0);
+
+  EXPECT_EQ(a + b, (math::MatrixN<double, 2, 2>(6.0, 8.0,
+                                                10.0, 12.0)));
+  EXPECT_EQ(b - a, (math::MatrixN<double, 2, 2>(4.0, 4.0,
+                                                4.0, 4.0)));
+  EXPECT_EQ(a * 2.0, (math::MatrixN<double, 2, 2>(2.0, 4.0,
+                                                  6.0, 8.0)));
+  EXPECT_EQ(a * b, (math::MatrixN<double, 2, 2>(19.0, 22.0,
+                                                43.0, 50.0)));
+  EXPECT_NE(a, b);
+
+  // Mixed dimensions: (2x3) * (3x1) = (2x1).
+  math::MatrixN<double, 2, 3> c(1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0);
+  math::MatrixN<double, 3, 1> v(1.0,
+                                0.0,
+                                -1.0);
+  auto cv = c * v;
+  EXPECT_DOUBLE_EQ(cv(0, 0), -2.0);
+  EXPECT_DOUBLE_EQ(cv(1, 0), -2.0);
+
+  auto ct = c.Transposed();
+  EXPECT_EQ(ct.RowCount(), 3u);
+  EXPECT_EQ(ct.ColCount(), 2u);
+  for (std::size_t row = 0; row < 2; ++row)
+    for (std::size_t col = 0; col < 3; ++col)
+      EXPECT_DOUBLE_EQ(ct(col, row), c(row, col));
+}
+
+/////////////////////////////////////////////////
+TEST(MatrixNTest, CholeskySolve)
+{
+  // Build a symmetric positive definite 6x6 as J^T * J + I.
+  math::Matrix6d jacobian;
+  for (std::size_t row = 0; row < 6; ++row)
+    for (std::size_t col = 0; col < 6; ++col)
+      jacobian(row, col) = 0.1 * static_cast<double>(row * 6 + col) - 1.3;
+
+  auto spd = jacobian.Transposed() * jacobian + math::Matrix6d::Identity();
+
+  math::Matrix6d lower;
+  ASSERT_TRUE(spd.Cholesky(lower));
+
+  // L is lower triangular and L * L^T reproduces the matrix.
+  for (std::size_t row = 0; row < 6; ++row)
+    for (std::size_t col = row + 1; col < 6; ++col)
+      EXPECT_DOUBLE_EQ(lower(row, col), 0.0);
+  EXPECT_TRUE((lower * lower.Transposed()).Equal(spd, 1e-9));
+
+  // Solve against a known solution.
+  math::Vector6d expected(1.0, -2.0, 3.0, -4.0, 5.0, -6.0);
+  auto rhs = spd * expected;
+  math::Vector6d solution;
+  ASSERT_TRUE(spd.SolveSPD(rhs, solution));
+  EXPECT_TRUE(solution.Equal(expected, 1e-9));
+
+  // Inverse times the matrix is the identity.
+  math::Matrix6d inverse;
+  ASSERT_TRUE(spd.InverseSPD(inverse));
+  EXPECT_TRUE((spd * inverse).Equal(math::Matrix6d::Identity(), 1e-9));
+
+  // An indefinite matrix is rejected.
+  math::MatrixN<double, 2, 2> indefinite(1.0, 2.0,
+                                         2.0, 1.0);
+  math::MatrixN<double, 2, 2> bad;
+  EXPECT_FALSE(indefinite.Cholesky(bad));
+}
+
+/////////////////////////////////////////////////
+TEST(MatrixNTest, Stream)
+{
+  math::MatrixN<double, 2, 2> mat(1.5, 2.0,
+                                  3.25, 4.0);
+  std::ostringstream stream;
+  stream << mat;
+  EXPECT_EQ(stream.str(), "1.5 2 3.25 4");
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "ignition/math/MemoryPool.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief A payload the size of a typical private data struct.
+  struct Payload
+  {
+    double values[5];
+  };
+}
+
+/////////////////////////////////////////////////
+TEST(MemoryPoolTest, AllocateAndRecycle)
+{
+  auto &pool = MemoryPool<Payload>::Instance();
+
+  // Slots are distinct, aligned, and a burst from a fresh slab is
+  // contiguous.
+  std::vector<void *> slots;
+  std::set<void *> unique;
+  for (int i = 0; i < 64; ++i)
+  {
+    void *ptr = pool.Allocate();
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % alignof(Payload));
+    slots.push_back(ptr);
+    unique.insert(ptr);
+  }
+  EXPECT_EQ(slots.size(), unique.size());
+  for (size_t i = 1; i < slots.size(); ++i)
+  {
+    EXPECT_EQ(sizeof(Payload),
+        static_cast<size_t>(reinterpret_cast<uintptr_t>(slots[i]) -
+            reinterpret_cast<uintptr_t>(slots[i - 1])));
+  }
+
+  // A freed slot is handed out again before any new storage.
+  void *freed = slots.back();
+  pool.Deallocate(freed);
+  EXPECT_EQ(freed, pool.Allocate());
+
+  // Deallocating null is harmless.
+  pool.Deallocate(nullptr);
+
+  for (void *ptr : slots)
+    pool.Deallocate(ptr);
+
+  // Draining and refilling the pool does not grow its capacity.
+  const size_t capacity = pool.Capacity();
+  EXPECT_GE(capacity, slots.size());
+  slots.clear();
+  for (size_t i = 0; i < capacity; ++i)
+    slots.push_back(pool.Allocate());
+  EXPECT_EQ(capacity, pool.Capacity());
+  for (void *ptr : slots)
+    pool.Deallocate(ptr);
+}
+
+/////////////////////////////////////////////////
+TEST(MemoryPoolTest, ConcurrentAllocation)
+{
+  struct ThreadPayload
+  {
+    int value;
+  };
+  auto &pool = MemoryPool<ThreadPayload>::Instance();
+
+  // Several threads allocating and freeing concurrently never receive
+  // the same live slot.
+  const unsigned int numThreads = 4;
+  const int rounds = 2000;
+  std::vector<std::vector<void *>> seen(numThreads);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < numThreads; ++t)
+  {
+    threads.push_back(std::thread(
+        [&pool, &seen, t]()
+        {
+          for (int i = 0; i < rounds; ++i)
+          {
+            void *ptr = pool.Allocate();
+            static_cast<ThreadPayload *>(ptr)->value = static_cast<int>(t);
+            seen[t].push_back(ptr);
+            if (i % 3 == 0)
+            {
+              pool.Deallocate(ptr);
+              seen[t].pop_back();
+            }
+          }
+        }));
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  std::set<void *> live;
+  for (unsigned int t = 0; t < numThreads; ++t)
+  {
+    for (void *ptr : seen[t])
+    {
+      EXPECT_TRUE(live.insert(ptr).second);
+      pool.Deallocate(ptr);
+    }
+  }
+}
@@ -16,6 +16,8 @@
 */
 
 #include <gtest/gtest.h>
+
+#include <vector>
 #include "ignition/math/Vector3.hh"
 #include "ignition/math/MovingWindowFilter.hh"
 
@@ -69,6 +71,72 @@ TEST(MovingWindowFilterTest, FilterSomething)
   EXPECT_EQ(vectorMWF.Value(), vsum / 20.0);
 }
 
+/////////////////////////////////////////////////
+TEST(MovingWindowFilterTest, BatchedUpdate)
+{
+  math::MovingWindowFilter<double> batched;
+  math::MovingWindowFilter<double> oneAtATime;
+  batched.SetWindowSize(10);
+  oneAtATime.SetWindowSize(10);
+
+  std::vector<double> values;
+  for (int i = 0; i < 57; ++i)
+    values.push_back(0.5 * i - 3.0);
+
+  batched.Update(values.data(), values.size());
+  for (double value : values)
+    oneAtATime.Update(value);
+
+  EXPECT_EQ(oneAtATime.WindowFilled(), batched.WindowFilled());
+  EXPECT_DOUBLE_EQ(oneAtATime.Value(), batched.Value());
+
+  // Interleaving batches and single updates keeps the state coherent.
+  batched.Update(values.data(), 3);
+  oneAtATime.Update(values[0]);
+  oneAtATime.Update(values[1]);
+  oneAtATime.Update(values[2]);
+  EXPECT_DOUBLE_EQ(oneAtATime.Value(), batched.Value());
+}
+
+/////////////////////////////////////////////////
+TEST(MovingWindowFilterTest, FixedWindowSize)
+{
+  math::FixedMovingWindowFilter<double, 4> fixedFilter;
+  math::MovingWindowFilter<double> runtimeFilter;
+
+  static_assert(fixedFilter.Size() == 4, "window size is compile time");
+  EXPECT_FALSE(fixedFilter.WindowFilled());
+
+  for (int i = 0; i < 20; ++i)
+  {
+    fixedFilter.Update(0.25 * i * i - 2.0);
+    runtimeFilter.Update(0.25 * i * i - 2.0);
+    EXPECT_DOUBLE_EQ(runtimeFilter.Value(), fixedFilter.Value());
+  }
+  EXPECT_TRUE(fixedFilter.WindowFilled());
+
+  std::vector<double> more{1.0, 2.0, 3.0};
+  fixedFilter.Update(more.data(), more.size());
+  for (double value : more)
+    runtimeFilter.Update(value);
+  EXPECT_DOUBLE_EQ(runtimeFilter.Value(), fixedFilter.Value());
+
+  fixedFilter.Reset();
+  EXPECT_FALSE(fixedFilter.WindowFilled());
+  fixedFilter.Update(7.0);
+  EXPECT_DOUBLE_EQ(7.0, fixedFilter.Value());
+}
+
+/////////////////////////////////////////////////
+TEST(MovingWindowFilterTest, FixedWindowVector3)
+{
+  math::FixedMovingWindowFilter<math::Vector3d, 2> filter;
+  filter.Update(math::Vector3d(1, 4, 0));
+  filter.Update(math::Vector3d(2, 2, 6));
+  filter.Update(math::Vector3d(4, 0, 0));
+  EXPECT_EQ(math::Vector3d(3, 1, 3), filter.Value());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
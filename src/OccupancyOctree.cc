@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/OccupancyOctree.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief Cells per leaf block along one axis.
+  const uint32_t kBlockSide = 4;
+
+  /// \brief Index marking an absent child.
+  const uint32_t kNullChild = ~0u;
+
+  /// \brief An interior node: indices of its eight children in the
+  /// node pool, ordered by the Morton code of the child octant.
+  struct Node
+  {
+    /// \brief Child indices; kNullChild where no child exists. At the
+    /// deepest interior level these index the leaf pool instead.
+    uint32_t children[8] =
+    {
+      kNullChild, kNullChild, kNullChild, kNullChild,
+      kNullChild, kNullChild, kNullChild, kNullChild
+    };
+  };
+}
+
+/// \internal
+/// \brief Private data for the OccupancyOctree class.
+class ignition::math::OccupancyOctreePrivate
+{
+  /// \brief The cell size.
+  public: double resolution = 1.0;
+
+  /// \brief Minimum corner of the covered cube.
+  public: Vector3d origin;
+
+  /// \brief Side length of the covered cube.
+  public: double side = 1.0;
+
+  /// \brief Depth of the interior levels above the leaf blocks; the
+  /// tree spans (1 << (depth + 2)) cells per axis.
+  public: uint32_t depth = 0;
+
+  /// \brief Pool of interior nodes; node 0 is the root.
+  public: std::vector<Node> nodes;
+
+  /// \brief Pool of leaf blocks, one 64-bit occupancy mask per 4x4x4
+  /// cell block, bits ordered by the Morton code of the cell within
+  /// the block.
+  public: std::vector<uint64_t> leaves;
+
+  /// \brief Number of occupied cells.
+  public: uint64_t occupied = 0;
+
+  /// \brief Mark the cell containing a point, growing the tree as
+  /// needed.
+  /// \param[in] _point The point.
+  /// \return True if the cell changed from free to occupied.
+  public: bool InsertImpl(const Vector3d &_point);
+
+  /// \brief Compute the cell indices of a point.
+  /// \param[in] _point The point.
+  /// \param[out] _ix X cell index.
+  /// \param[out] _iy Y cell index.
+  /// \param[out] _iz Z cell index.
+  /// \return False when the point lies outside the covered cube.
+  public: bool CellIndices(const Vector3d &_point, uint32_t &_ix,
+              uint32_t &_iy, uint32_t &_iz) const;
+};
+
+//////////////////////////////////////////////////
+bool OccupancyOctreePrivate::CellIndices(const Vector3d &_point,
+    uint32_t &_ix, uint32_t &_iy, uint32_t &_iz) const
+{
+  const Vector3d local = _point - this->origin;
+  if (local.X() < 0 || local.Y() < 0 || local.Z() < 0 ||
+      local.X() >= this->side || local.Y() >= this->side ||
+      local.Z() >= this->side)
+  {
+    return false;
+  }
+
+  _ix = static_cast<uint32_t>(local.X() / this->resolution);
+  _iy = static_cast<uint32_t>(local.Y() / this->resolution);
+  _iz = static_cast<uint32_t>(local.Z() / this->resolution);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool OccupancyOctreePrivate::InsertImpl(const Vector3d &_point)
+{
+  uint32_t ix, iy, iz;
+  if (!this->CellIndices(_point, ix, iy, iz))
+    return false;
+
+  // Descend the interior levels, taking one coordinate bit per level
+  // from the top; the child slot is the Morton code of the three bits.
+  uint32_t node = 0;
+  for (uint32_t level = this->depth; level > 0; --level)
+  {
+    const uint32_t shift = level + 1;
+    const uint32_t child = mortonEncode3d(
+        (ix >> shift) & 1u, (iy >> shift) & 1u, (iz >> shift) & 1u);
+    uint32_t next = this->nodes[node].children[child];
+    if (kNullChild == next)
+    {
+      // The last interior level links into the leaf pool.
+      if (1 == level)
+      {
+        next = static_cast<uint32_t>(this->leaves.size());
+        this->leaves.push_back(0u);
+      }
+      else
+      {
+        next = static_cast<uint32_t>(this->nodes.size());
+        this->nodes.push_back(Node());
+      }
+      this->nodes[node].children[child] = next;
+    }
+    node = next;
+  }
+
+  const uint64_t bit = uint64_t(1) << mortonEncode3d(
+      ix & (kBlockSide - 1), iy & (kBlockSide - 1), iz & (kBlockSide - 1));
+  if (this->leaves[node] & bit)
+    return false;
+
+  this->leaves[node] |= bit;
+  ++this->occupied;
+  return true;
+}
+
+//////////////////////////////////////////////////
+OccupancyOctree::OccupancyOctree(const AxisAlignedBox &_bounds,
+    const double _resolution)
+: dataPtr(new OccupancyOctreePrivate)
+{
+  if (_resolution > 0)
+    this->dataPtr->resolution = _resolution;
+
+  // Round the cell count per axis up to a power of two that is at
+  // least one leaf block, so every level halves cleanly.
+  const Vector3d size = _bounds.Size();
+  const double maxSide = std::max(
+      {size.X(), size.Y(), size.Z(), this->dataPtr->resolution});
+  uint32_t cells = kBlockSide;
+  uint32_t depth = 0;
+  while (cells * this->dataPtr->resolution < maxSide)
+  {
+    cells *= 2;
+    ++depth;
+  }
+
+  // Keep at least one interior level so the root is always a Node.
+  if (0 == depth)
+  {
+    cells *= 2;
+    depth = 1;
+  }
+
+  this->dataPtr->depth = depth;
+  this->dataPtr->side = cells * this->dataPtr->resolution;
+  this->dataPtr->origin = _bounds.Center() -
+      Vector3d(this->dataPtr->side, this->dataPtr->side,
+          this->dataPtr->side) / 2.0;
+  this->dataPtr->nodes.push_back(Node());
+}
+
+//////////////////////////////////////////////////
+OccupancyOctree::~OccupancyOctree()
+{
+}
+
+//////////////////////////////////////////////////
+double OccupancyOctree::Resolution() const
+{
+  return this->dataPtr->resolution;
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBox OccupancyOctree::Bounds() const
+{
+  return AxisAlignedBox(this->dataPtr->origin,
+      this->dataPtr->origin + Vector3d(this->dataPtr->side,
+          this->dataPtr->side, this->dataPtr->side));
+}
+
+//////////////////////////////////////////////////
+bool OccupancyOctree::Insert(const Vector3d &_point)
+{
+  return this->dataPtr->InsertImpl(_point);
+}
+
+//////////////////////////////////////////////////
+uint64_t OccupancyOctree::InsertPoints(const Vector3d *_points,
+    const size_t _count)
+{
+  uint64_t changed = 0;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (this->dataPtr->InsertImpl(_points[i]))
+      ++changed;
+  }
+  return changed;
+}
+
+//////////////////////////////////////////////////
+bool OccupancyOctree::Occupied(const Vector3d &_point) const
+{
+  uint32_t ix, iy, iz;
+  if (!this->dataPtr->CellIndices(_point, ix, iy, iz))
+    return false;
+
+  uint32_t node = 0;
+  for (uint32_t level = this->dataPtr->depth; level > 0; --level)
+  {
+    const uint32_t shift = level + 1;
+    const uint32_t child = mortonEncode3d(
+        (ix >> shift) & 1u, (iy >> shift) & 1u, (iz >> shift) & 1u);
+    node = this->dataPtr->nodes[node].children[child];
+    if (kNullChild == node)
+      return false;
+  }
+
+  const uint64_t bit = uint64_t(1) << mortonEncode3d(
+      ix & (kBlockSide - 1), iy & (kBlockSide - 1), iz & (kBlockSide - 1));
+  return (this->dataPtr->leaves[node] & bit) != 0;
+}
+
+//////////////////////////////////////////////////
+uint64_t OccupancyOctree::OccupiedCount() const
+{
+  return this->dataPtr->occupied;
+}
+
+//////////////////////////////////////////////////
+size_t OccupancyOctree::MemoryUsage() const
+{
+  return this->dataPtr->nodes.capacity() * sizeof(Node) +
+      this->dataPtr->leaves.capacity() * sizeof(uint64_t);
+}
+
+//////////////////////////////////////////////////
+void OccupancyOctree::Clear()
+{
+  this->dataPtr->nodes.clear();
+  this->dataPtr->nodes.shrink_to_fit();
+  this->dataPtr->leaves.clear();
+  this->dataPtr->leaves.shrink_to_fit();
+  this->dataPtr->occupied = 0;
+  this->dataPtr->nodes.push_back(Node());
+}
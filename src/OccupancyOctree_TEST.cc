@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/OccupancyOctree.hh"
+#include "ignition/math/Rand.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(OccupancyOctreeTest, InsertAndQuery)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-10, -10, -10), math::Vector3d(10, 10, 10));
+  math::OccupancyOctree tree(bounds, 0.1);
+  EXPECT_DOUBLE_EQ(tree.Resolution(), 0.1);
+  EXPECT_EQ(tree.OccupiedCount(), 0u);
+
+  // The covered cube is a power-of-two cell count per axis, so it can
+  // exceed the requested bounds but never undershoots them.
+  EXPECT_TRUE(tree.Bounds().Contains(bounds.Min()));
+  EXPECT_TRUE(tree.Bounds().Contains(bounds.Max() -
+      math::Vector3d(1e-9, 1e-9, 1e-9)));
+
+  // A fresh tree is fully free.
+  EXPECT_FALSE(tree.Occupied(math::Vector3d::Zero));
+
+  EXPECT_TRUE(tree.Insert(math::Vector3d(1.0, 2.0, 3.0)));
+  EXPECT_TRUE(tree.Occupied(math::Vector3d(1.0, 2.0, 3.0)));
+  EXPECT_EQ(tree.OccupiedCount(), 1u);
+
+  // A second point in the same cell is not a new cell.
+  EXPECT_FALSE(tree.Insert(math::Vector3d(1.01, 2.01, 3.01)));
+  EXPECT_EQ(tree.OccupiedCount(), 1u);
+
+  // Neighboring cells stay free.
+  EXPECT_FALSE(tree.Occupied(math::Vector3d(1.0, 2.0, 3.2)));
+  EXPECT_FALSE(tree.Occupied(math::Vector3d(-1.0, 2.0, 3.0)));
+
+  // Points outside the covered cube are ignored.
+  EXPECT_FALSE(tree.Insert(math::Vector3d(100, 0, 0)));
+  EXPECT_FALSE(tree.Occupied(math::Vector3d(100, 0, 0)));
+  EXPECT_EQ(tree.OccupiedCount(), 1u);
+
+  tree.Clear();
+  EXPECT_EQ(tree.OccupiedCount(), 0u);
+  EXPECT_FALSE(tree.Occupied(math::Vector3d(1.0, 2.0, 3.0)));
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyOctreeTest, BatchInsert)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-50, -50, -50), math::Vector3d(50, 50, 50));
+  math::OccupancyOctree batched(bounds, 0.5);
+  math::OccupancyOctree scalar(bounds, 0.5);
+
+  math::Rand::Seed(42);
+  std::vector<math::Vector3d> points(5000);
+  for (auto &point : points)
+  {
+    point.Set(math::Rand::DblUniform(-49, 49),
+        math::Rand::DblUniform(-49, 49),
+        math::Rand::DblUniform(-49, 49));
+  }
+
+  const uint64_t changed = batched.InsertPoints(points.data(),
+      points.size());
+  uint64_t expected = 0;
+  for (const auto &point : points)
+  {
+    if (scalar.Insert(point))
+      ++expected;
+  }
+
+  EXPECT_EQ(changed, expected);
+  EXPECT_EQ(batched.OccupiedCount(), scalar.OccupiedCount());
+  for (const auto &point : points)
+    EXPECT_TRUE(batched.Occupied(point));
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyOctreeTest, DenseClusterMemory)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-100, -100, -100), math::Vector3d(100, 100, 100));
+  math::OccupancyOctree tree(bounds, 0.1);
+
+  // Fill a solid 40x40x40 cell block: 64000 occupied cells.
+  for (int x = 0; x < 40; ++x)
+    for (int y = 0; y < 40; ++y)
+      for (int z = 0; z < 40; ++z)
+        tree.Insert(math::Vector3d(x * 0.1, y * 0.1, z * 0.1));
+  EXPECT_EQ(tree.OccupiedCount(), 64000u);
+
+  // Dense occupancy costs well under 8 bytes per cell; the leaf masks
+  // alone would be one bit each.
+  EXPECT_LT(tree.MemoryUsage(),
+      8u * static_cast<size_t>(tree.OccupiedCount()));
+}
@@ -16,6 +16,7 @@
 */
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/Angle.hh"
 #include "ignition/math/OrientedBox.hh"
@@ -374,3 +375,54 @@ TEST(OrientedBoxTest, Mass)
   EXPECT_EQ(expectedMassMat, massMat);
   EXPECT_DOUBLE_EQ(expectedMassMat.Mass(), massMat.Mass());
 }
+
+/////////////////////////////////////////////////
+TEST(OrientedBoxTest, ContainsBatch)
+{
+  OrientedBoxd box(Vector3d(2, 4, 6),
+      Pose3d(1, -2, 3, 0.4, -0.3, 0.2));
+
+  // A grid of points straddling the box matches Contains per point.
+  std::vector<Vector3d> points;
+  for (int x = -4; x <= 4; ++x)
+  {
+    for (int y = -6; y <= 6; ++y)
+    {
+      for (int z = -2; z <= 8; ++z)
+        points.push_back(Vector3d(0.7 * x, 0.8 * y, 0.9 * z));
+    }
+  }
+
+  std::vector<uint8_t> results(points.size());
+  box.ContainsBatch(points.data(), points.size(), results.data());
+
+  size_t contained = 0;
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(box.Contains(points[i]) ? 1 : 0, results[i]) << i;
+    contained += results[i];
+  }
+  EXPECT_LT(0u, contained);
+  EXPECT_LT(contained, points.size());
+
+  // The all-pairs kernel lays out results box-major.
+  OrientedBoxd boxes[2] =
+  {
+    box,
+    OrientedBoxd(Vector3d(1, 1, 1), Pose3d(-2, 0, 1, 0, 0, 1.0))
+  };
+  std::vector<uint8_t> pairResults(2 * points.size());
+  OrientedBoxd::ContainsBatch(boxes, 2, points.data(), points.size(),
+      pairResults.data());
+  for (size_t b = 0; b < 2; ++b)
+  {
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+      EXPECT_EQ(boxes[b].Contains(points[i]) ? 1 : 0,
+          pairResults[b * points.size() + i]);
+    }
+  }
+
+  // Zero count is a no-op.
+  box.ContainsBatch(nullptr, 0, nullptr);
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/PIDArray.hh"
+
+using namespace ignition;
+using namespace math;
+
+/// \brief Private data for the PIDArray class. One entry per
+/// controller in every vector, mirroring the scalar members of PID.
+class ignition::math::PIDArrayPrivate
+{
+  /// \brief The proportional gains.
+  public: std::vector<double> pGain;
+
+  /// \brief The integral gains.
+  public: std::vector<double> iGain;
+
+  /// \brief The derivative gains.
+  public: std::vector<double> dGain;
+
+  /// \brief The current error values.
+  public: std::vector<double> pErr;
+
+  /// \brief The previous error values.
+  public: std::vector<double> pErrLast;
+
+  /// \brief The integrals of the error.
+  public: std::vector<double> iErr;
+
+  /// \brief The derivative error values.
+  public: std::vector<double> dErr;
+
+  /// \brief The upper integral limits.
+  public: std::vector<double> iMax;
+
+  /// \brief The lower integral limits.
+  public: std::vector<double> iMin;
+
+  /// \brief The upper command limits.
+  public: std::vector<double> cmdMax;
+
+  /// \brief The lower command limits.
+  public: std::vector<double> cmdMin;
+
+  /// \brief The command offsets.
+  public: std::vector<double> cmdOffset;
+
+  /// \brief The last commands.
+  public: std::vector<double> cmd;
+};
+
+//////////////////////////////////////////////////
+PIDArray::PIDArray(const size_t _count)
+  : dataPtr(new PIDArrayPrivate)
+{
+  this->Resize(_count);
+}
+
+//////////////////////////////////////////////////
+PIDArray::~PIDArray()
+{
+}
+
+//////////////////////////////////////////////////
+void PIDArray::Resize(const size_t _count)
+{
+  this->dataPtr->pGain.resize(_count, 0.0);
+  this->dataPtr->iGain.resize(_count, 0.0);
+  this->dataPtr->dGain.resize(_count, 0.0);
+  this->dataPtr->pErr.resize(_count, 0.0);
+  this->dataPtr->pErrLast.resize(_count, 0.0);
+  this->dataPtr->iErr.resize(_count, 0.0);
+  this->dataPtr->dErr.resize(_count, 0.0);
+  // Same defaults as the PID constructor: limits disabled.
+  this->dataPtr->iMax.resize(_count, -1.0);
+  this->dataPtr->iMin.resize(_count, 0.0);
+  this->dataPtr->cmdMax.resize(_count, -1.0);
+  this->dataPtr->cmdMin.resize(_count, 0.0);
+  this->dataPtr->cmdOffset.resize(_count, 0.0);
+  this->dataPtr->cmd.resize(_count, 0.0);
+}
+
+//////////////////////////////////////////////////
+size_t PIDArray::Size() const
+{
+  return this->dataPtr->pGain.size();
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetPGain(const double _p)
+{
+  std::fill(this->dataPtr->pGain.begin(), this->dataPtr->pGain.end(), _p);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetPGains(const double *_p, const size_t _count)
+{
+  const size_t n = std::min(_count, this->Size());
+  std::copy(_p, _p + n, this->dataPtr->pGain.begin());
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetIGain(const double _i)
+{
+  std::fill(this->dataPtr->iGain.begin(), this->dataPtr->iGain.end(), _i);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetIGains(const double *_i, const size_t _count)
+{
+  const size_t n = std::min(_count, this->Size());
+  std::copy(_i, _i + n, this->dataPtr->iGain.begin());
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetDGain(const double _d)
+{
+  std::fill(this->dataPtr->dGain.begin(), this->dataPtr->dGain.end(), _d);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetDGains(const double *_d, const size_t _count)
+{
+  const size_t n = std::min(_count, this->Size());
+  std::copy(_d, _d + n, this->dataPtr->dGain.begin());
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetILimits(const double _iMax, const double _iMin)
+{
+  std::fill(this->dataPtr->iMax.begin(), this->dataPtr->iMax.end(), _iMax);
+  std::fill(this->dataPtr->iMin.begin(), this->dataPtr->iMin.end(), _iMin);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetILimits(const double *_iMax, const double *_iMin,
+    const size_t _count)
+{
+  const size_t n = std::min(_count, this->Size());
+  std::copy(_iMax, _iMax + n, this->dataPtr->iMax.begin());
+  std::copy(_iMin, _iMin + n, this->dataPtr->iMin.begin());
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetCmdLimits(const double _cmdMax, const double _cmdMin)
+{
+  std::fill(this->dataPtr->cmdMax.begin(), this->dataPtr->cmdMax.end(),
+      _cmdMax);
+  std::fill(this->dataPtr->cmdMin.begin(), this->dataPtr->cmdMin.end(),
+      _cmdMin);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetCmdLimits(const double *_cmdMax, const double *_cmdMin,
+    const size_t _count)
+{
+  const size_t n = std::min(_count, this->Size());
+  std::copy(_cmdMax, _cmdMax + n, this->dataPtr->cmdMax.begin());
+  std::copy(_cmdMin, _cmdMin + n, this->dataPtr->cmdMin.begin());
+}
+
+//////////////////////////////////////////////////
+void PIDArray::SetCmdOffset(const double _cmdOffset)
+{
+  std::fill(this->dataPtr->cmdOffset.begin(),
+      this->dataPtr->cmdOffset.end(), _cmdOffset);
+}
+
+//////////////////////////////////////////////////
+void PIDArray::Update(const double *_errors,
+    const std::chrono::duration<double> &_dt, double *_cmds)
+{
+  const size_t n = this->Size();
+  if (_dt == std::chrono::duration<double>(0))
+  {
+    // Same behavior as PID::Update with a zero time step: zero
+    // command, untouched state.
+    std::fill(_cmds, _cmds + n, 0.0);
+    return;
+  }
+
+  const double dt = _dt.count();
+  PIDArrayPrivate *d = this->dataPtr.get();
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    const double error = _errors[i];
+    if (isnan(error) || std::isinf(error))
+    {
+      _cmds[i] = 0.0;
+      continue;
+    }
+
+    d->pErr[i] = error;
+
+    // Integrate the error, clamping when the limit is enabled.
+    double iErr = d->iErr[i] + d->iGain[i] * dt * error;
+    if (d->iMax[i] >= d->iMin[i])
+      iErr = clamp(iErr, d->iMin[i], d->iMax[i]);
+    d->iErr[i] = iErr;
+
+    const double dErr = (error - d->pErrLast[i]) / dt;
+    d->dErr[i] = dErr;
+    d->pErrLast[i] = error;
+
+    double cmd = d->cmdOffset[i] - d->pGain[i] * error - iErr -
+        d->dGain[i] * dErr;
+    if (d->cmdMax[i] >= d->cmdMin[i])
+      cmd = clamp(cmd, d->cmdMin[i], d->cmdMax[i]);
+    d->cmd[i] = cmd;
+    _cmds[i] = cmd;
+  }
+}
+
+//////////////////////////////////////////////////
+double PIDArray::Cmd(const size_t _index) const
+{
+  if (_index >= this->Size())
+    return 0.0;
+  return this->dataPtr->cmd[_index];
+}
+
+//////////////////////////////////////////////////
+void PIDArray::Errors(const size_t _index, double &_pe, double &_ie,
+    double &_de) const
+{
+  if (_index >= this->Size())
+  {
+    _pe = _ie = _de = 0.0;
+    return;
+  }
+  _pe = this->dataPtr->pErr[_index];
+  _ie = this->dataPtr->iErr[_index];
+  _de = this->dataPtr->dErr[_index];
+}
+
+//////////////////////////////////////////////////
+void PIDArray::Reset()
+{
+  std::fill(this->dataPtr->pErr.begin(), this->dataPtr->pErr.end(), 0.0);
+  std::fill(this->dataPtr->pErrLast.begin(),
+      this->dataPtr->pErrLast.end(), 0.0);
+  std::fill(this->dataPtr->iErr.begin(), this->dataPtr->iErr.end(), 0.0);
+  std::fill(this->dataPtr->dErr.begin(), this->dataPtr->dErr.end(), 0.0);
+  std::fill(this->dataPtr->cmd.begin(), this->dataPtr->cmd.end(), 0.0);
+}
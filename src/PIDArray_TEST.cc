@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ignition/math/PID.hh"
+#include "ignition/math/PIDArray.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(PIDArrayTest, MatchesScalarPID)
+{
+  const size_t count = 64;
+  PIDArray bank(count);
+  EXPECT_EQ(count, bank.Size());
+
+  // Per-controller gains and limits, mirrored into scalar controllers.
+  std::vector<double> pGains(count), iGains(count), dGains(count);
+  std::vector<double> iMax(count), iMin(count);
+  std::vector<double> cmdMax(count), cmdMin(count);
+  std::vector<PID> scalars(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    pGains[i] = 0.1 + 0.01 * i;
+    iGains[i] = 0.02 * (i % 5);
+    dGains[i] = 0.005 * (i % 3);
+    // Half the lanes have limits enabled, half disabled.
+    iMax[i] = i % 2 ? 0.2 : -1.0;
+    iMin[i] = i % 2 ? -0.2 : 0.0;
+    cmdMax[i] = i % 2 ? 1.0 : -1.0;
+    cmdMin[i] = i % 2 ? -1.0 : 0.0;
+    scalars[i].Init(pGains[i], iGains[i], dGains[i], iMax[i], iMin[i],
+        cmdMax[i], cmdMin[i]);
+  }
+  bank.SetPGains(pGains.data(), count);
+  bank.SetIGains(iGains.data(), count);
+  bank.SetDGains(dGains.data(), count);
+  bank.SetILimits(iMax.data(), iMin.data(), count);
+  bank.SetCmdLimits(cmdMax.data(), cmdMin.data(), count);
+
+  const std::chrono::duration<double> dt(0.001);
+  std::vector<double> errors(count);
+  std::vector<double> cmds(count);
+  for (int tick = 0; tick < 100; ++tick)
+  {
+    for (size_t i = 0; i < count; ++i)
+      errors[i] = std::sin(0.05 * tick + 0.1 * i);
+
+    bank.Update(errors.data(), dt, cmds.data());
+    for (size_t i = 0; i < count; ++i)
+    {
+      const double expected = scalars[i].Update(errors[i], dt);
+      ASSERT_DOUBLE_EQ(expected, cmds[i])
+          << "lane " << i << " tick " << tick;
+      ASSERT_DOUBLE_EQ(expected, bank.Cmd(i)) << "lane " << i;
+    }
+  }
+
+  // Error state matches lane by lane.
+  double pe, ie, de, spe, sie, sde;
+  bank.Errors(10, pe, ie, de);
+  scalars[10].Errors(spe, sie, sde);
+  EXPECT_DOUBLE_EQ(spe, pe);
+  EXPECT_DOUBLE_EQ(sie, ie);
+  EXPECT_DOUBLE_EQ(sde, de);
+}
+
+/////////////////////////////////////////////////
+TEST(PIDArrayTest, DegenerateInputs)
+{
+  PIDArray bank(3);
+  bank.SetPGain(1.0);
+  bank.SetCmdOffset(0.5);
+
+  // A zero time step zeroes the commands without touching state.
+  double errors[3] = {1.0, 2.0, 3.0};
+  double cmds[3] = {9.0, 9.0, 9.0};
+  bank.Update(errors, std::chrono::duration<double>(0), cmds);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_DOUBLE_EQ(0.0, cmds[i]);
+
+  // A non-finite error zeroes only its own lane.
+  errors[1] = std::numeric_limits<double>::quiet_NaN();
+  bank.Update(errors, std::chrono::duration<double>(0.01), cmds);
+  EXPECT_DOUBLE_EQ(-0.5, cmds[0]);
+  EXPECT_DOUBLE_EQ(0.0, cmds[1]);
+  EXPECT_DOUBLE_EQ(-2.5, cmds[2]);
+
+  // Reset clears the error state but keeps the gains.
+  bank.Reset();
+  double pe, ie, de;
+  bank.Errors(0, pe, ie, de);
+  EXPECT_DOUBLE_EQ(0.0, pe);
+  EXPECT_DOUBLE_EQ(0.0, ie);
+  EXPECT_DOUBLE_EQ(0.0, de);
+  EXPECT_DOUBLE_EQ(0.0, bank.Cmd(0));
+
+  // Out of range accessors are harmless.
+  EXPECT_DOUBLE_EQ(0.0, bank.Cmd(99));
+  bank.Errors(99, pe, ie, de);
+  EXPECT_DOUBLE_EQ(0.0, pe);
+
+  // Resizing keeps surviving lanes.
+  errors[0] = 1.0;
+  errors[1] = 1.0;
+  errors[2] = 1.0;
+  bank.Update(errors, std::chrono::duration<double>(0.01), cmds);
+  bank.Resize(5);
+  EXPECT_EQ(5u, bank.Size());
+  EXPECT_DOUBLE_EQ(cmds[0], bank.Cmd(0));
+  EXPECT_DOUBLE_EQ(0.0, bank.Cmd(4));
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ignition/math/Parallel.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(ParallelTest, ParallelFor)
+{
+  EXPECT_GE(ThreadPool::Instance().WorkerCount(), 1u);
+
+  // Every index is visited exactly once, in both scheduling modes.
+  const size_t count = 100000;
+  std::vector<int> visits(count, 0);
+  ParallelFor(0, count, [&](const size_t _i) { ++visits[_i]; }, 64);
+  for (size_t i = 0; i < count; ++i)
+    ASSERT_EQ(1, visits[i]) << "index " << i;
+
+  ParallelFor(0, count, [&](const size_t _i) { ++visits[_i]; }, 64, true);
+  for (size_t i = 0; i < count; ++i)
+    ASSERT_EQ(2, visits[i]) << "index " << i;
+
+  // Small ranges run inline on the calling thread.
+  std::atomic<int> small(0);
+  ParallelFor(10, 20, [&](const size_t) { ++small; });
+  EXPECT_EQ(10, small);
+
+  // Empty ranges are a no-op.
+  ParallelFor(5, 5, [&](const size_t) { ADD_FAILURE(); });
+}
+
+/////////////////////////////////////////////////
+TEST(ParallelTest, NestedCallsRunSerially)
+{
+  std::atomic<size_t> total(0);
+  ParallelFor(0, 64,
+      [&](const size_t)
+      {
+        // A loop issued from a pool worker must not deadlock; it runs
+        // inline instead.
+        ParallelFor(0, 8, [&](const size_t) { ++total; }, 1);
+      }, 1);
+  EXPECT_EQ(64u * 8u, total);
+}
+
+/////////////////////////////////////////////////
+TEST(ParallelTest, ParallelReduce)
+{
+  const size_t count = 200000;
+  std::vector<double> values(count);
+  for (size_t i = 0; i < count; ++i)
+    values[i] = 1e-3 * i;
+
+  auto chunkSum = [&](const size_t _from, const size_t _to)
+  {
+    double sum = 0;
+    for (size_t i = _from; i < _to; ++i)
+      sum += values[i];
+    return sum;
+  };
+  auto add = [](const double _a, const double _b) { return _a + _b; };
+
+  // The fold order is fixed by the chunk boundaries, so repeated runs
+  // and both scheduling modes agree bit for bit.
+  const double first = ParallelReduce(0, count, 0.0, chunkSum, add, 512);
+  const double second = ParallelReduce(0, count, 0.0, chunkSum, add, 512);
+  const double deterministic =
+      ParallelReduce(0, count, 0.0, chunkSum, add, 512, true);
+  EXPECT_DOUBLE_EQ(first, second);
+  EXPECT_DOUBLE_EQ(first, deterministic);
+  EXPECT_NEAR(1e-3 * count * (count - 1) / 2, first, 1e-4);
+
+  // Empty range returns the identity.
+  EXPECT_DOUBLE_EQ(-1.0, ParallelReduce(3, 3, -1.0, chunkSum, add));
+}
+
+/////////////////////////////////////////////////
+TEST(ParallelTest, ConcurrentSubmissions)
+{
+  // Parallel loops issued from several plain threads at once must not
+  // corrupt each other; Run() serializes the submissions.
+  const size_t count = 50000;
+  const unsigned int submitters = 4;
+  std::vector<std::atomic<int>> touched(count);
+  for (auto &value : touched)
+    value = 0;
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < submitters; ++t)
+  {
+    threads.push_back(std::thread(
+        [&]
+        {
+          ParallelFor(0, count,
+              [&](const size_t _i) { ++touched[_i]; }, 128);
+        }));
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (size_t i = 0; i < count; ++i)
+    ASSERT_EQ(static_cast<int>(submitters), touched[i].load());
+}
@@ -16,6 +16,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Plane.hh"
@@ -150,3 +151,85 @@ TEST(PlaneTest, SideAxisAlignedBox)
     EXPECT_EQ(plane.Side(box), Planed::BOTH_SIDE);
   }
 }
+
+/////////////////////////////////////////////////
+TEST(PlaneTest, DistanceBatch)
+{
+  Planed plane(Vector3d(0, 0, 1), 2.0);
+
+  const Vector3d points[4] =
+  {
+    Vector3d(0, 0, 0),
+    Vector3d(5, -3, 2),
+    Vector3d(1, 1, 7.5),
+    Vector3d(-2, 4, -1)
+  };
+  double distances[4];
+  plane.DistanceBatch(points, 4, distances);
+
+  for (int i = 0; i < 4; ++i)
+    EXPECT_DOUBLE_EQ(plane.Distance(points[i]), distances[i]);
+  EXPECT_DOUBLE_EQ(-2.0, distances[0]);
+  EXPECT_DOUBLE_EQ(0.0, distances[1]);
+  EXPECT_DOUBLE_EQ(5.5, distances[2]);
+}
+
+/////////////////////////////////////////////////
+TEST(PlaneTest, Fit)
+{
+  // Points on an exact plane are recovered exactly, up to the sign of
+  // the normal.
+  {
+    const Planed expected(Vector3d(1, 2, -1).Normalized(), 0.5);
+    std::vector<Vector3d> points;
+    for (int u = -5; u <= 5; ++u)
+    {
+      for (int v = -5; v <= 5; ++v)
+      {
+        // Span the plane with two directions orthogonal to the normal.
+        const Vector3d span1 = Vector3d(2, -1, 0).Normalized();
+        const Vector3d span2 = expected.Normal().Cross(span1);
+        points.push_back(expected.Normal() * expected.Offset() +
+            span1 * u + span2 * v);
+      }
+    }
+
+    const Planed fitted = Planed::Fit(points.data(), points.size());
+    const double sign = fitted.Normal().Dot(expected.Normal()) < 0 ?
+        -1.0 : 1.0;
+    EXPECT_EQ(expected.Normal(), fitted.Normal() * sign);
+    EXPECT_NEAR(expected.Offset(), fitted.Offset() * sign, 1e-6);
+
+    // Residuals of a least squares fit through exact samples vanish.
+    std::vector<double> distances(points.size());
+    fitted.DistanceBatch(points.data(), points.size(), distances.data());
+    for (const double distance : distances)
+      EXPECT_NEAR(0.0, distance, 1e-6);
+  }
+
+  // Noise perpendicular to the plane averages out.
+  {
+    std::vector<Vector3d> points;
+    for (int u = -10; u <= 10; ++u)
+    {
+      for (int v = -10; v <= 10; ++v)
+      {
+        const double noise = (((u * 13 + v * 7) % 5 + 5) % 5 - 2) * 1e-3;
+        points.push_back(Vector3d(u, v, 3.0 + noise));
+      }
+    }
+
+    const Planed fitted = Planed::Fit(points.data(), points.size());
+    const double sign = fitted.Normal().Z() < 0 ? -1.0 : 1.0;
+    EXPECT_NEAR(1.0, fitted.Normal().Z() * sign, 1e-4);
+    EXPECT_NEAR(3.0, fitted.Offset() * sign, 1e-3);
+  }
+
+  // Too few points yield a default constructed plane.
+  {
+    const Vector3d points[2] = {Vector3d(0, 0, 0), Vector3d(1, 0, 0)};
+    const Planed fitted = Planed::Fit(points, 2);
+    EXPECT_EQ(Vector3d::Zero, fitted.Normal());
+    EXPECT_DOUBLE_EQ(0.0, fitted.Offset());
+  }
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/PolylineDistance.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+/// \brief Number of consecutive segments per bounding block.
+const size_t kBlockSize = 32;
+
+/// \brief Number of consecutive blocks per bounding group.
+const size_t kGroupSize = 32;
+
+/// \brief Axis aligned box in structure-of-arrays friendly form.
+struct Bound
+{
+  public: double minX, minY, minZ;
+  public: double maxX, maxY, maxZ;
+};
+
+/// \brief Squared distance between a point and a bound; zero inside.
+double BoundDistanceSquared(const Bound &_b,
+    const double _x, const double _y, const double _z)
+{
+  const double dx = std::max(std::max(_b.minX - _x, _x - _b.maxX), 0.0);
+  const double dy = std::max(std::max(_b.minY - _y, _y - _b.maxY), 0.0);
+  const double dz = std::max(std::max(_b.minZ - _z, _z - _b.maxZ), 0.0);
+  return dx * dx + dy * dy + dz * dz;
+}
+}
+
+namespace ignition
+{
+namespace math
+{
+inline namespace IGNITION_MATH_VERSION_NAMESPACE
+{
+/// \brief Private data for the PolylineDistance class.
+class PolylineDistancePrivate
+{
+  /// \brief Number of segments.
+  public: size_t count = 0;
+
+  /// \brief Segment start points, one array per coordinate.
+  public: std::vector<double> ax, ay, az;
+
+  /// \brief Unit segment directions; zero for zero-length segments.
+  public: std::vector<double> dx, dy, dz;
+
+  /// \brief Segment lengths.
+  public: std::vector<double> len;
+
+  /// \brief One bound per kBlockSize consecutive segments.
+  public: std::vector<Bound> blocks;
+
+  /// \brief One bound per kGroupSize consecutive blocks.
+  public: std::vector<Bound> groups;
+};
+}
+}
+}
+
+//////////////////////////////////////////////////
+PolylineDistance::PolylineDistance()
+  : dataPtr(new PolylineDistancePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+PolylineDistance::~PolylineDistance()
+{
+  delete this->dataPtr;
+  this->dataPtr = nullptr;
+}
+
+//////////////////////////////////////////////////
+bool PolylineDistance::Build(const Vector3d *_points, const size_t _count)
+{
+  *this->dataPtr = PolylineDistancePrivate();
+
+  if (!_points || _count < 2)
+  {
+    std::cerr << "PolylineDistance::Build needs at least two points\n";
+    return false;
+  }
+
+  PolylineDistancePrivate &d = *this->dataPtr;
+  d.count = _count - 1;
+  d.ax.resize(d.count);
+  d.ay.resize(d.count);
+  d.az.resize(d.count);
+  d.dx.resize(d.count);
+  d.dy.resize(d.count);
+  d.dz.resize(d.count);
+  d.len.resize(d.count);
+
+  for (size_t i = 0; i < d.count; ++i)
+  {
+    const Vector3d &a = _points[i];
+    const Vector3d diff = _points[i + 1] - a;
+    const double length = diff.Length();
+    d.ax[i] = a.X();
+    d.ay[i] = a.Y();
+    d.az[i] = a.Z();
+    d.len[i] = length;
+    if (length > 0.0)
+    {
+      d.dx[i] = diff.X() / length;
+      d.dy[i] = diff.Y() / length;
+      d.dz[i] = diff.Z() / length;
+    }
+    else
+    {
+      d.dx[i] = d.dy[i] = d.dz[i] = 0.0;
+    }
+  }
+
+  // Bound each run of kBlockSize consecutive segments, then each run
+  // of kGroupSize consecutive blocks.
+  const size_t blockCount = (d.count + kBlockSize - 1) / kBlockSize;
+  d.blocks.resize(blockCount);
+  for (size_t b = 0; b < blockCount; ++b)
+  {
+    const size_t begin = b * kBlockSize;
+    const size_t end = std::min(begin + kBlockSize, d.count);
+    Vector3d minP = _points[begin];
+    Vector3d maxP = minP;
+    for (size_t i = begin; i < end + 1; ++i)
+    {
+      minP.Min(_points[i]);
+      maxP.Max(_points[i]);
+    }
+    d.blocks[b] = {minP.X(), minP.Y(), minP.Z(),
+                   maxP.X(), maxP.Y(), maxP.Z()};
+  }
+
+  const size_t groupCount = (blockCount + kGroupSize - 1) / kGroupSize;
+  d.groups.resize(groupCount);
+  for (size_t g = 0; g < groupCount; ++g)
+  {
+    const size_t begin = g * kGroupSize;
+    const size_t end = std::min(begin + kGroupSize, blockCount);
+    Bound bound = d.blocks[begin];
+    for (size_t b = begin + 1; b < end; ++b)
+    {
+      bound.minX = std::min(bound.minX, d.blocks[b].minX);
+      bound.minY = std::min(bound.minY, d.blocks[b].minY);
+      bound.minZ = std::min(bound.minZ, d.blocks[b].minZ);
+      bound.maxX = std::max(bound.maxX, d.blocks[b].maxX);
+      bound.maxY = std::max(bound.maxY, d.blocks[b].maxY);
+      bound.maxZ = std::max(bound.maxZ, d.blocks[b].maxZ);
+    }
+    d.groups[g] = bound;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t PolylineDistance::SegmentCount() const
+{
+  return this->dataPtr->count;
+}
+
+//////////////////////////////////////////////////
+double PolylineDistance::Distance(const Vector3d &_point) const
+{
+  size_t segment;
+  Vector3d closest;
+  return this->Distance(_point, segment, closest);
+}
+
+//////////////////////////////////////////////////
+double PolylineDistance::Distance(const Vector3d &_point, size_t &_segment,
+    Vector3d &_closest) const
+{
+  const PolylineDistancePrivate &d = *this->dataPtr;
+  if (d.count == 0)
+    return MAX_D;
+
+  const double px = _point.X();
+  const double py = _point.Y();
+  const double pz = _point.Z();
+
+  double best = MAX_D;
+  size_t bestSeg = 0;
+  double bestT = 0.0;
+
+  for (size_t g = 0; g < d.groups.size(); ++g)
+  {
+    if (BoundDistanceSquared(d.groups[g], px, py, pz) >= best)
+      continue;
+
+    const size_t blockEnd =
+        std::min((g + 1) * kGroupSize, d.blocks.size());
+    for (size_t b = g * kGroupSize; b < blockEnd; ++b)
+    {
+      if (BoundDistanceSquared(d.blocks[b], px, py, pz) >= best)
+        continue;
+
+      const size_t segEnd = std::min((b + 1) * kBlockSize, d.count);
+      for (size_t i = b * kBlockSize; i < segEnd; ++i)
+      {
+        const double rx = px - d.ax[i];
+        const double ry = py - d.ay[i];
+        const double rz = pz - d.az[i];
+        const double t = clamp(
+            rx * d.dx[i] + ry * d.dy[i] + rz * d.dz[i], 0.0, d.len[i]);
+        const double ex = rx - t * d.dx[i];
+        const double ey = ry - t * d.dy[i];
+        const double ez = rz - t * d.dz[i];
+        const double distSquared = ex * ex + ey * ey + ez * ez;
+        if (distSquared < best)
+        {
+          best = distSquared;
+          bestSeg = i;
+          bestT = t;
+        }
+      }
+    }
+  }
+
+  _segment = bestSeg;
+  _closest.Set(d.ax[bestSeg] + bestT * d.dx[bestSeg],
+               d.ay[bestSeg] + bestT * d.dy[bestSeg],
+               d.az[bestSeg] + bestT * d.dz[bestSeg]);
+  return std::sqrt(best);
+}
+
+//////////////////////////////////////////////////
+void PolylineDistance::DistanceBatch(const Vector3d *_points,
+    double *_distances, const size_t _n) const
+{
+  if (!_points || !_distances)
+    return;
+
+  for (size_t i = 0; i < _n; ++i)
+    _distances[i] = this->Distance(_points[i]);
+}
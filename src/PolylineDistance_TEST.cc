@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/PolylineDistance.hh"
+#include "ignition/math/Vector3.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+/// \brief Reference point-to-segment distance.
+double SegmentDistance(const math::Vector3d &_p,
+    const math::Vector3d &_a, const math::Vector3d &_b)
+{
+  const math::Vector3d diff = _b - _a;
+  const double lenSquared = diff.SquaredLength();
+  double t = 0.0;
+  if (lenSquared > 0.0)
+    t = math::clamp((_p - _a).Dot(diff) / lenSquared, 0.0, 1.0);
+  return _p.Distance(_a + diff * t);
+}
+
+/////////////////////////////////////////////////
+TEST(PolylineDistanceTest, Empty)
+{
+  math::PolylineDistance engine;
+  EXPECT_EQ(0u, engine.SegmentCount());
+  EXPECT_DOUBLE_EQ(math::MAX_D, engine.Distance(math::Vector3d::Zero));
+
+  EXPECT_FALSE(engine.Build(nullptr, 5));
+  math::Vector3d point(1, 2, 3);
+  EXPECT_FALSE(engine.Build(&point, 1));
+  EXPECT_EQ(0u, engine.SegmentCount());
+}
+
+/////////////////////////////////////////////////
+TEST(PolylineDistanceTest, SingleSegment)
+{
+  std::vector<math::Vector3d> points;
+  points.push_back(math::Vector3d(0, 0, 0));
+  points.push_back(math::Vector3d(2, 0, 0));
+
+  math::PolylineDistance engine;
+  ASSERT_TRUE(engine.Build(points.data(), points.size()));
+  EXPECT_EQ(1u, engine.SegmentCount());
+
+  size_t segment;
+  math::Vector3d closest;
+
+  // Interior projection, then clamps at both endpoints.
+  EXPECT_DOUBLE_EQ(3.0,
+      engine.Distance(math::Vector3d(1, 3, 0), segment, closest));
+  EXPECT_EQ(0u, segment);
+  EXPECT_EQ(math::Vector3d(1, 0, 0), closest);
+
+  EXPECT_DOUBLE_EQ(1.0,
+      engine.Distance(math::Vector3d(-1, 0, 0), segment, closest));
+  EXPECT_EQ(math::Vector3d::Zero, closest);
+
+  EXPECT_DOUBLE_EQ(5.0,
+      engine.Distance(math::Vector3d(5, 4, 0), segment, closest));
+  EXPECT_EQ(math::Vector3d(2, 0, 0), closest);
+
+  // A point on the segment has zero distance.
+  EXPECT_DOUBLE_EQ(0.0, engine.Distance(math::Vector3d(0.5, 0, 0)));
+}
+
+/////////////////////////////////////////////////
+TEST(PolylineDistanceTest, ZeroLengthSegment)
+{
+  // A repeated vertex behaves as a point.
+  std::vector<math::Vector3d> points;
+  points.push_back(math::Vector3d(1, 1, 1));
+  points.push_back(math::Vector3d(1, 1, 1));
+
+  math::PolylineDistance engine;
+  ASSERT_TRUE(engine.Build(points.data(), points.size()));
+  EXPECT_DOUBLE_EQ(std::sqrt(3.0),
+      engine.Distance(math::Vector3d(2, 2, 2)));
+}
+
+/////////////////////////////////////////////////
+TEST(PolylineDistanceTest, MatchesBruteForce)
+{
+  // A helix long enough to span many pruning blocks.
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 1500; ++i)
+  {
+    const double s = 0.05 * i;
+    points.push_back(math::Vector3d(
+        3.0 * std::cos(s), 3.0 * std::sin(s), 0.2 * s));
+  }
+
+  math::PolylineDistance engine;
+  ASSERT_TRUE(engine.Build(points.data(), points.size()));
+  EXPECT_EQ(points.size() - 1, engine.SegmentCount());
+
+  for (int i = 0; i < 200; ++i)
+  {
+    const math::Vector3d query(
+        8.0 * std::sin(0.71 * i), 8.0 * std::cos(0.37 * i),
+        20.0 * std::sin(0.13 * i));
+
+    double brute = math::MAX_D;
+    for (size_t s = 0; s + 1 < points.size(); ++s)
+      brute = std::min(brute,
+          SegmentDistance(query, points[s], points[s + 1]));
+
+    size_t segment;
+    math::Vector3d closest;
+    const double dist = engine.Distance(query, segment, closest);
+    EXPECT_DOUBLE_EQ(brute, dist) << i;
+    EXPECT_LT(segment, engine.SegmentCount()) << i;
+    EXPECT_NEAR(dist, query.Distance(closest), 1e-12) << i;
+    EXPECT_NEAR(dist,
+        SegmentDistance(query, points[segment], points[segment + 1]),
+        1e-12) << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(PolylineDistanceTest, DistanceBatch)
+{
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 100; ++i)
+    points.push_back(math::Vector3d(i * 0.1, std::sin(0.3 * i), 0));
+
+  math::PolylineDistance engine;
+  ASSERT_TRUE(engine.Build(points.data(), points.size()));
+
+  std::vector<math::Vector3d> queries;
+  for (int i = 0; i < 50; ++i)
+    queries.push_back(math::Vector3d(i * 0.2, -1.0 + 0.1 * i, 0.5));
+
+  std::vector<double> distances(queries.size());
+  engine.DistanceBatch(queries.data(), distances.data(), queries.size());
+  for (size_t i = 0; i < queries.size(); ++i)
+    EXPECT_DOUBLE_EQ(engine.Distance(queries[i]), distances[i]) << i;
+
+  // Degenerate arguments are ignored.
+  engine.DistanceBatch(nullptr, distances.data(), queries.size());
+  engine.DistanceBatch(queries.data(), nullptr, queries.size());
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/PoseInterpolator.hh"
+
+#include <vector>
+
+#include <ignition/math/Quaternion.hh>
+#include <ignition/math/Vector3.hh>
+
+using namespace ignition;
+using namespace math;
+
+/// \internal
+/// \brief Private data for the PoseInterpolator class.
+class ignition::math::PoseInterpolatorPrivate
+{
+  /// \brief Keyframe times, non-decreasing.
+  public: std::vector<double> times;
+
+  /// \brief Keyframe positions, parallel to times.
+  public: std::vector<Vector3d> positions;
+
+  /// \brief Keyframe orientations, parallel to times.
+  public: std::vector<Quaterniond> rotations;
+
+  /// \brief Interpolate within the segment starting at _index.
+  /// \param[in] _index Segment index; _index + 1 must be a valid
+  /// keyframe.
+  /// \param[in] _time The query time, inside the segment.
+  /// \return The interpolated pose.
+  public: Pose3d Interpolate(const size_t _index,
+              const double _time) const
+  {
+    const double t0 = this->times[_index];
+    const double t1 = this->times[_index + 1];
+    // Repeated timestamps hold the earlier pose for the instant
+    // before the jump.
+    if (!(t1 > t0))
+    {
+      return Pose3d(this->positions[_index], this->rotations[_index]);
+    }
+
+    const double s = (_time - t0) / (t1 - t0);
+    const Vector3d pos = this->positions[_index] +
+        (this->positions[_index + 1] - this->positions[_index]) * s;
+    const Quaterniond rot = Quaterniond::Slerp(s,
+        this->rotations[_index], this->rotations[_index + 1], true);
+    return Pose3d(pos, rot);
+  }
+
+  /// \brief Advance a segment cursor to the segment containing _time,
+  /// searching linearly forward (the ascending-query fast path) and
+  /// falling back to binary search for queries behind the cursor.
+  /// \param[in] _time The query time; inside the keyframe time range.
+  /// \param[in, out] _cursor The segment cursor.
+  public: void Advance(const double _time, size_t &_cursor) const
+  {
+    const size_t lastSegment = this->times.size() - 2;
+    if (_time < this->times[_cursor])
+    {
+      // Query moved backwards; restart with a binary search.
+      size_t lo = 0, hi = _cursor;
+      while (lo < hi)
+      {
+        const size_t mid = (lo + hi + 1) / 2;
+        if (this->times[mid] <= _time)
+          lo = mid;
+        else
+          hi = mid - 1;
+      }
+      _cursor = lo;
+      return;
+    }
+    while (_cursor < lastSegment && this->times[_cursor + 1] <= _time)
+      ++_cursor;
+  }
+};
+
+//////////////////////////////////////////////////
+PoseInterpolator::PoseInterpolator()
+: dataPtr(new PoseInterpolatorPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+PoseInterpolator::~PoseInterpolator()
+{
+}
+
+//////////////////////////////////////////////////
+bool PoseInterpolator::SetData(const double *_times, const Pose3d *_poses,
+    const size_t _count)
+{
+  this->dataPtr->times.clear();
+  this->dataPtr->positions.clear();
+  this->dataPtr->rotations.clear();
+
+  if (_count == 0)
+    return false;
+
+  for (size_t i = 1; i < _count; ++i)
+  {
+    if (_times[i] < _times[i - 1])
+      return false;
+  }
+
+  this->dataPtr->times.assign(_times, _times + _count);
+  this->dataPtr->positions.resize(_count);
+  this->dataPtr->rotations.resize(_count);
+  for (size_t i = 0; i < _count; ++i)
+  {
+    this->dataPtr->positions[i] = _poses[i].Pos();
+    this->dataPtr->rotations[i] = _poses[i].Rot();
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t PoseInterpolator::Count() const
+{
+  return this->dataPtr->times.size();
+}
+
+//////////////////////////////////////////////////
+double PoseInterpolator::StartTime() const
+{
+  return this->dataPtr->times.empty() ? 0.0 : this->dataPtr->times.front();
+}
+
+//////////////////////////////////////////////////
+double PoseInterpolator::EndTime() const
+{
+  return this->dataPtr->times.empty() ? 0.0 : this->dataPtr->times.back();
+}
+
+//////////////////////////////////////////////////
+bool PoseInterpolator::Sample(const double _time, Pose3d &_pose) const
+{
+  return this->Sample(&_time, &_pose, 1);
+}
+
+//////////////////////////////////////////////////
+bool PoseInterpolator::Sample(const double *_times, Pose3d *_poses,
+    const size_t _count) const
+{
+  const std::vector<double> &times = this->dataPtr->times;
+  if (times.empty())
+    return false;
+
+  const Pose3d first(this->dataPtr->positions.front(),
+      this->dataPtr->rotations.front());
+  const Pose3d last(this->dataPtr->positions.back(),
+      this->dataPtr->rotations.back());
+
+  size_t cursor = 0;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (_times[i] <= times.front())
+    {
+      _poses[i] = first;
+    }
+    else if (_times[i] >= times.back())
+    {
+      _poses[i] = last;
+    }
+    else
+    {
+      this->dataPtr->Advance(_times[i], cursor);
+      _poses[i] = this->dataPtr->Interpolate(cursor, _times[i]);
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool PoseInterpolator::SampleUniform(const double _begin, const double _step,
+    Pose3d *_poses, const size_t _count) const
+{
+  if (this->dataPtr->times.empty() || _step <= 0.0)
+    return false;
+
+  std::vector<double> times(_count);
+  for (size_t i = 0; i < _count; ++i)
+    times[i] = _begin + _step * static_cast<double>(i);
+  return this->Sample(times.data(), _poses, _count);
+}
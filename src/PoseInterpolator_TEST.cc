@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/PoseInterpolator.hh"
+#include "ignition/math/Quaternion.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(PoseInterpolatorTest, SetData)
+{
+  math::PoseInterpolator interp;
+  EXPECT_EQ(interp.Count(), 0u);
+  math::Pose3d pose;
+  EXPECT_FALSE(interp.Sample(0.0, pose));
+
+  std::vector<double> times = {0.0, 1.0, 3.0};
+  std::vector<math::Pose3d> poses = {
+    math::Pose3d(0, 0, 0, 0, 0, 0),
+    math::Pose3d(1, 0, 0, 0, 0, 0),
+    math::Pose3d(1, 2, 0, 0, 0, 0)};
+  EXPECT_TRUE(interp.SetData(times.data(), poses.data(), times.size()));
+  EXPECT_EQ(interp.Count(), 3u);
+  EXPECT_DOUBLE_EQ(interp.StartTime(), 0.0);
+  EXPECT_DOUBLE_EQ(interp.EndTime(), 3.0);
+
+  // Unsorted times are rejected and leave the interpolator empty.
+  std::vector<double> bad = {0.0, 2.0, 1.0};
+  EXPECT_FALSE(interp.SetData(bad.data(), poses.data(), bad.size()));
+  EXPECT_EQ(interp.Count(), 0u);
+  EXPECT_FALSE(interp.SetData(times.data(), poses.data(), 0));
+}
+
+/////////////////////////////////////////////////
+TEST(PoseInterpolatorTest, Sample)
+{
+  std::vector<double> times = {0.0, 1.0, 3.0};
+  std::vector<math::Pose3d> poses = {
+    math::Pose3d(0, 0, 0, 0, 0, 0),
+    math::Pose3d(2, 0, 0, 0, 0, IGN_PI_2),
+    math::Pose3d(2, 4, 0, 0, 0, IGN_PI)};
+
+  math::PoseInterpolator interp;
+  ASSERT_TRUE(interp.SetData(times.data(), poses.data(), times.size()));
+
+  math::Pose3d pose;
+
+  // Exactly on keyframes.
+  ASSERT_TRUE(interp.Sample(0.0, pose));
+  EXPECT_EQ(pose, poses[0]);
+  ASSERT_TRUE(interp.Sample(1.0, pose));
+  EXPECT_EQ(pose, poses[1]);
+  ASSERT_TRUE(interp.Sample(3.0, pose));
+  EXPECT_EQ(pose, poses[2]);
+
+  // Midpoints: lerped position, slerped orientation.
+  ASSERT_TRUE(interp.Sample(0.5, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(1, 0, 0));
+  EXPECT_NEAR(pose.Rot().Yaw(), IGN_PI_2 / 2, 1e-9);
+  ASSERT_TRUE(interp.Sample(2.0, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(2, 2, 0));
+  EXPECT_NEAR(pose.Rot().Yaw(), 3 * IGN_PI_2 / 2, 1e-9);
+
+  // Out-of-range times clamp to the end poses.
+  ASSERT_TRUE(interp.Sample(-5.0, pose));
+  EXPECT_EQ(pose, poses.front());
+  ASSERT_TRUE(interp.Sample(100.0, pose));
+  EXPECT_EQ(pose, poses.back());
+}
+
+/////////////////////////////////////////////////
+TEST(PoseInterpolatorTest, BatchAndUniform)
+{
+  // A longer stream; compare the batch path (which uses the moving
+  // cursor) against scalar samples, with ascending, descending and
+  // shuffled query orders.
+  std::vector<double> times;
+  std::vector<math::Pose3d> poses;
+  for (int i = 0; i < 50; ++i)
+  {
+    times.push_back(0.1 * i * i);
+    poses.push_back(math::Pose3d(i, -2.0 * i, 0.5 * i,
+        0.01 * i, -0.02 * i, 0.03 * i));
+  }
+
+  math::PoseInterpolator interp;
+  ASSERT_TRUE(interp.SetData(times.data(), poses.data(), times.size()));
+
+  std::vector<double> queries;
+  for (int i = 0; i < 200; ++i)
+    queries.push_back(-10.0 + 1.5 * i);
+  std::vector<double> shuffled = queries;
+  for (size_t i = 0; i < shuffled.size(); i += 2)
+    std::swap(shuffled[i], shuffled[shuffled.size() - 1 - i]);
+
+  for (const auto &order : {queries, shuffled})
+  {
+    std::vector<math::Pose3d> batch(order.size());
+    ASSERT_TRUE(interp.Sample(order.data(), batch.data(), order.size()));
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      math::Pose3d expected;
+      ASSERT_TRUE(interp.Sample(order[i], expected));
+      EXPECT_EQ(batch[i], expected) << "query time " << order[i];
+    }
+  }
+
+  // Fixed-rate resampling matches explicit query times.
+  std::vector<math::Pose3d> uniform(100);
+  ASSERT_TRUE(interp.SampleUniform(0.0, 0.25, uniform.data(),
+      uniform.size()));
+  for (size_t i = 0; i < uniform.size(); ++i)
+  {
+    math::Pose3d expected;
+    ASSERT_TRUE(interp.Sample(0.25 * i, expected));
+    EXPECT_EQ(uniform[i], expected);
+  }
+  EXPECT_FALSE(interp.SampleUniform(0.0, 0.0, uniform.data(),
+      uniform.size()));
+
+  // Repeated timestamps: the instant before the jump holds the
+  // earlier pose.
+  std::vector<double> jumpTimes = {0.0, 1.0, 1.0, 2.0};
+  std::vector<math::Pose3d> jumpPoses = {
+    math::Pose3d(0, 0, 0, 0, 0, 0),
+    math::Pose3d(1, 0, 0, 0, 0, 0),
+    math::Pose3d(5, 0, 0, 0, 0, 0),
+    math::Pose3d(6, 0, 0, 0, 0, 0)};
+  ASSERT_TRUE(interp.SetData(jumpTimes.data(), jumpPoses.data(),
+      jumpTimes.size()));
+  math::Pose3d pose;
+  ASSERT_TRUE(interp.Sample(1.5, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(5.5, 0, 0));
+  ASSERT_TRUE(interp.Sample(0.999, pose));
+  EXPECT_NEAR(pose.Pos().X(), 0.999, 1e-12);
+}
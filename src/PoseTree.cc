@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/PoseTree.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace ignition;
+using namespace math;
+
+/// \internal
+/// \brief Private data for the PoseTree class.
+class ignition::math::PoseTreePrivate
+{
+  /// \brief Parent id of each node; the root is its own parent.
+  public: std::vector<std::size_t> parents;
+
+  /// \brief Child ids of each node.
+  public: std::vector<std::vector<std::size_t>> children;
+
+  /// \brief Local pose of each node, in its parent's frame.
+  public: std::vector<Pose3d> localPoses;
+
+  /// \brief Cached world pose of each node; valid when not dirty.
+  public: std::vector<Pose3d> worldPoses;
+
+  /// \brief Dirty bit of each node.
+  public: std::vector<uint8_t> dirty;
+
+  /// \brief Ids marked dirty since the last update.
+  public: std::vector<std::size_t> dirtyNodes;
+};
+
+//////////////////////////////////////////////////
+PoseTree::PoseTree()
+: dataPtr(new PoseTreePrivate)
+{
+  // The root node.
+  this->dataPtr->parents.push_back(0);
+  this->dataPtr->children.push_back({});
+  this->dataPtr->localPoses.push_back(Pose3d());
+  this->dataPtr->worldPoses.push_back(Pose3d());
+  this->dataPtr->dirty.push_back(0);
+}
+
+//////////////////////////////////////////////////
+PoseTree::~PoseTree()
+{
+}
+
+//////////////////////////////////////////////////
+std::size_t PoseTree::AddNode(const std::size_t _parent,
+    const Pose3d &_localPose)
+{
+  if (_parent >= this->dataPtr->parents.size())
+    return 0;
+
+  const std::size_t id = this->dataPtr->parents.size();
+  this->dataPtr->parents.push_back(_parent);
+  this->dataPtr->children.push_back({});
+  this->dataPtr->children[_parent].push_back(id);
+  this->dataPtr->localPoses.push_back(_localPose);
+  this->dataPtr->worldPoses.push_back(Pose3d());
+  this->dataPtr->dirty.push_back(1);
+  this->dataPtr->dirtyNodes.push_back(id);
+  return id;
+}
+
+//////////////////////////////////////////////////
+std::size_t PoseTree::Count() const
+{
+  return this->dataPtr->parents.size();
+}
+
+//////////////////////////////////////////////////
+std::size_t PoseTree::Parent(const std::size_t _node) const
+{
+  if (_node >= this->dataPtr->parents.size())
+    return 0;
+  return this->dataPtr->parents[_node];
+}
+
+//////////////////////////////////////////////////
+bool PoseTree::SetLocalPose(const std::size_t _node, const Pose3d &_pose)
+{
+  if (_node >= this->dataPtr->parents.size())
+    return false;
+
+  this->dataPtr->localPoses[_node] = _pose;
+  if (!this->dataPtr->dirty[_node])
+  {
+    this->dataPtr->dirty[_node] = 1;
+    this->dataPtr->dirtyNodes.push_back(_node);
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool PoseTree::LocalPose(const std::size_t _node, Pose3d &_pose) const
+{
+  if (_node >= this->dataPtr->parents.size())
+    return false;
+
+  _pose = this->dataPtr->localPoses[_node];
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool PoseTree::WorldPose(const std::size_t _node, Pose3d &_pose)
+{
+  if (_node >= this->dataPtr->parents.size())
+    return false;
+
+  this->Update();
+  _pose = this->dataPtr->worldPoses[_node];
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::size_t PoseTree::Update()
+{
+  if (this->dataPtr->dirtyNodes.empty())
+    return 0;
+
+  // Ancestors always have smaller ids than their descendants, so
+  // processing the dirty list in ascending order recomputes a moved
+  // subtree exactly once: a dirty descendant is cleaned while walking
+  // its moved ancestor and skipped when its own turn comes.
+  std::sort(this->dataPtr->dirtyNodes.begin(),
+      this->dataPtr->dirtyNodes.end());
+
+  std::size_t count = 0;
+  std::vector<std::size_t> stack;
+  for (const std::size_t dirtyRoot : this->dataPtr->dirtyNodes)
+  {
+    if (!this->dataPtr->dirty[dirtyRoot])
+      continue;
+
+    stack.push_back(dirtyRoot);
+    while (!stack.empty())
+    {
+      const std::size_t node = stack.back();
+      stack.pop_back();
+
+      // A node's world pose is its local pose added to the parent's
+      // world pose; the parent is always recomposed before its
+      // children are popped.
+      if (node == 0)
+      {
+        this->dataPtr->worldPoses[0] = this->dataPtr->localPoses[0];
+      }
+      else
+      {
+        this->dataPtr->worldPoses[node] =
+            this->dataPtr->localPoses[node] +
+            this->dataPtr->worldPoses[this->dataPtr->parents[node]];
+      }
+      this->dataPtr->dirty[node] = 0;
+      ++count;
+
+      for (const std::size_t child : this->dataPtr->children[node])
+        stack.push_back(child);
+    }
+  }
+
+  this->dataPtr->dirtyNodes.clear();
+  return count;
+}
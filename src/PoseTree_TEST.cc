@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/PoseTree.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(PoseTreeTest, AddAndQuery)
+{
+  math::PoseTree tree;
+  EXPECT_EQ(tree.Count(), 1u);
+
+  // A two-link arm hanging off a base.
+  const size_t base = tree.AddNode(0, math::Pose3d(1, 0, 0, 0, 0, 0));
+  const size_t upper = tree.AddNode(base,
+      math::Pose3d(0, 0, 1, 0, 0, IGN_PI_2));
+  const size_t lower = tree.AddNode(upper, math::Pose3d(2, 0, 0, 0, 0, 0));
+  EXPECT_EQ(tree.Count(), 4u);
+  EXPECT_EQ(tree.Parent(base), 0u);
+  EXPECT_EQ(tree.Parent(upper), base);
+  EXPECT_EQ(tree.Parent(lower), upper);
+
+  // Unknown parents are rejected.
+  EXPECT_EQ(tree.AddNode(99, math::Pose3d()), 0u);
+  EXPECT_EQ(tree.Count(), 4u);
+
+  math::Pose3d pose;
+  ASSERT_TRUE(tree.LocalPose(upper, pose));
+  EXPECT_EQ(pose, math::Pose3d(0, 0, 1, 0, 0, IGN_PI_2));
+  EXPECT_FALSE(tree.LocalPose(99, pose));
+
+  // World poses compose local poses root to leaf.
+  ASSERT_TRUE(tree.WorldPose(base, pose));
+  EXPECT_EQ(pose, math::Pose3d(1, 0, 0, 0, 0, 0));
+  ASSERT_TRUE(tree.WorldPose(upper, pose));
+  EXPECT_EQ(pose, math::Pose3d(1, 0, 1, 0, 0, IGN_PI_2));
+  ASSERT_TRUE(tree.WorldPose(lower, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(1, 2, 1));
+  EXPECT_FALSE(tree.WorldPose(99, pose));
+}
+
+/////////////////////////////////////////////////
+TEST(PoseTreeTest, DirtyPropagation)
+{
+  // A root with two independent chains.
+  math::PoseTree tree;
+  const size_t a1 = tree.AddNode(0, math::Pose3d(1, 0, 0, 0, 0, 0));
+  const size_t a2 = tree.AddNode(a1, math::Pose3d(1, 0, 0, 0, 0, 0));
+  const size_t a3 = tree.AddNode(a2, math::Pose3d(1, 0, 0, 0, 0, 0));
+  const size_t b1 = tree.AddNode(0, math::Pose3d(0, 1, 0, 0, 0, 0));
+  const size_t b2 = tree.AddNode(b1, math::Pose3d(0, 1, 0, 0, 0, 0));
+
+  // The initial update touches every new node; a second touches none.
+  EXPECT_EQ(tree.Update(), 5u);
+  EXPECT_EQ(tree.Update(), 0u);
+
+  // Moving a2 recomposes only a2 and a3, not the b chain.
+  EXPECT_TRUE(tree.SetLocalPose(a2, math::Pose3d(5, 0, 0, 0, 0, 0)));
+  EXPECT_EQ(tree.Update(), 2u);
+
+  math::Pose3d pose;
+  ASSERT_TRUE(tree.WorldPose(a3, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(7, 0, 0));
+  ASSERT_TRUE(tree.WorldPose(b2, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(0, 2, 0));
+
+  // Marking an ancestor and its descendant recomputes the subtree
+  // once.
+  EXPECT_TRUE(tree.SetLocalPose(a3, math::Pose3d(0, 0, 3, 0, 0, 0)));
+  EXPECT_TRUE(tree.SetLocalPose(a1, math::Pose3d(2, 0, 0, 0, 0, 0)));
+  EXPECT_EQ(tree.Update(), 3u);
+  ASSERT_TRUE(tree.WorldPose(a3, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(7, 0, 3));
+
+  // Moving the root moves everything.
+  EXPECT_TRUE(tree.SetLocalPose(0, math::Pose3d(0, 0, 10, 0, 0, 0)));
+  EXPECT_EQ(tree.Update(), 6u);
+  ASSERT_TRUE(tree.WorldPose(b2, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(0, 2, 10));
+
+  // WorldPose applies pending updates lazily.
+  EXPECT_TRUE(tree.SetLocalPose(b1, math::Pose3d(0, 5, 0, 0, 0, 0)));
+  ASSERT_TRUE(tree.WorldPose(b2, pose));
+  EXPECT_EQ(pose.Pos(), math::Vector3d(0, 6, 10));
+  EXPECT_EQ(tree.Update(), 0u);
+
+  // Setting an unknown node fails.
+  EXPECT_FALSE(tree.SetLocalPose(99, math::Pose3d()));
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Pose3.hh"
 
@@ -230,3 +232,113 @@ TEST(PoseTest, SetPoseElements)
   EXPECT_DOUBLE_EQ(pose.Y(), 12);
   EXPECT_DOUBLE_EQ(pose.Z(), 13);
 }
+
+/////////////////////////////////////////////////
+TEST(PoseTest, ComposeChain)
+{
+  std::vector<math::Pose3d> chain;
+  chain.push_back(math::Pose3d(1, 0, 0, 0, 0, IGN_PI_2));
+  chain.push_back(math::Pose3d(0, 2, 0, 0.1, -0.2, 0.3));
+  chain.push_back(math::Pose3d(-1, 0.5, 2, -0.4, 0.1, 0));
+  chain.push_back(math::Pose3d(3, -2, 1, 0, 0.5, -0.6));
+
+  // Empty chain yields identity.
+  EXPECT_EQ(math::Pose3d::ComposeChain(chain.data(), 0), math::Pose3d());
+
+  // Single pose passes through.
+  EXPECT_EQ(math::Pose3d::ComposeChain(chain.data(), 1), chain[0]);
+
+  // The one-pass fold must match the operator* chain.
+  math::Pose3d expected = chain[0];
+  for (size_t i = 1; i < chain.size(); ++i)
+    expected = expected * chain[i];
+  EXPECT_EQ(math::Pose3d::ComposeChain(chain.data(), chain.size()), expected);
+}
+
+/////////////////////////////////////////////////
+TEST(PoseTest, TransformBatch)
+{
+  math::Pose3d parent(0.5, -1, 2, 0.3, 0.2, -0.7);
+
+  std::vector<math::Pose3d> children;
+  children.push_back(math::Pose3d(1, 0, 0, 0, 0, 0));
+  children.push_back(math::Pose3d(0, 2, -1, 0.1, 0.4, 0.2));
+  children.push_back(math::Pose3d(-3, 1, 0.5, -0.2, 0, 1.1));
+
+  std::vector<math::Pose3d> out(children.size());
+  parent.TransformBatch(children.data(), out.data(), children.size());
+  for (size_t i = 0; i < children.size(); ++i)
+    EXPECT_EQ(out[i], parent * children[i]);
+
+  // In-place operation is allowed.
+  std::vector<math::Pose3d> inPlace = children;
+  parent.TransformBatch(inPlace.data(), inPlace.data(), inPlace.size());
+  for (size_t i = 0; i < children.size(); ++i)
+    EXPECT_EQ(inPlace[i], parent * children[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(PoseTest, InverseFastPath)
+{
+  // The unit-rotation fast path must agree with the general inverse.
+  math::Pose3d pose(1, -2, 0.5, 0.3, -0.2, 0.1);
+  math::Pose3d inv = pose.Inverse();
+  math::Pose3d identity = pose * inv;
+  EXPECT_NEAR(0, identity.Pos().X(), 1e-12);
+  EXPECT_NEAR(0, identity.Pos().Y(), 1e-12);
+  EXPECT_NEAR(0, identity.Pos().Z(), 1e-12);
+  EXPECT_NEAR(1, identity.Rot().W(), 1e-12);
+
+  // A non-unit rotation still takes the general path.
+  math::Pose3d scaled(math::Vector3d(1, 2, 3),
+      math::Quaterniond(2.0, 0, 0, 0));
+  math::Pose3d scaledInv = scaled.Inverse();
+  EXPECT_NEAR(0.5, scaledInv.Rot().W(), 1e-12);
+  math::Pose3d scaledIdentity = scaled * scaledInv;
+  EXPECT_NEAR(1, scaledIdentity.Rot().W(), 1e-12);
+}
+
+/////////////////////////////////////////////////
+TEST(PoseTest, EqualBatch)
+{
+  // Last frame and this frame, with two poses moved: one translated,
+  // one rotated.
+  const size_t count = 100;
+  std::vector<math::Pose3d> last(count);
+  std::vector<math::Pose3d> now(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    last[i] = math::Pose3d(0.1 * i, 0.2 * i, 0.3 * i, 0, 0, 0.01 * i);
+    now[i] = last[i];
+  }
+  now[7].Pos() += math::Vector3d(0.5, 0, 0);
+  now[42].Rot() = math::Quaterniond(0, 0, 1.0);
+  // Jitter inside the tolerance is not a change.
+  now[3].Pos() += math::Vector3d(1e-9, 0, 0);
+
+  uint64_t mask[2] = {0, 0};
+  math::EqualBatch(last.data(), now.data(), count, 1e-6, mask);
+
+  size_t indices[4] = {0};
+  const size_t changed = math::ChangedIndices(mask, count, indices, 4);
+  ASSERT_EQ(changed, 2u);
+  EXPECT_EQ(indices[0], 7u);
+  EXPECT_EQ(indices[1], 42u);
+
+  // The mask agrees with a per-component scalar comparison.
+  for (size_t i = 0; i < count; ++i)
+  {
+    const bool bit = (mask[i >> 6] >> (i & 63)) & 1;
+    const bool same =
+        last[i].Pos().Equal(now[i].Pos(), 1e-6) &&
+        math::equal(last[i].Rot().W(), now[i].Rot().W(), 1e-6) &&
+        math::equal(last[i].Rot().X(), now[i].Rot().X(), 1e-6) &&
+        math::equal(last[i].Rot().Y(), now[i].Rot().Y(), 1e-6) &&
+        math::equal(last[i].Rot().Z(), now[i].Rot().Z(), 1e-6);
+    EXPECT_EQ(bit, same) << "pose " << i;
+  }
+
+  // A still frame reports no changes.
+  math::EqualBatch(last.data(), last.data(), count, 1e-6, mask);
+  EXPECT_EQ(math::ChangedIndices(mask, count, indices, 4), 0u);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "ignition/math/Material.hh"
+#include "ignition/math/Preinit.hh"
+#include "ignition/math/Rand.hh"
+
+using namespace ignition;
+using namespace math;
+
+//////////////////////////////////////////////////
+void ignition::math::Preinit()
+{
+  // Material tables: the predefined map and the name index.
+  Material::Predefined();
+  Material warmByName("iron");
+
+  // Rand: the random_device seed, the shared generator, and the
+  // ziggurat tables behind the normal fills. This consumes draws.
+  Rand::Seed();
+  double warmDraws[2];
+  Rand::FillDblNormal(warmDraws, 2, 0.0, 1.0);
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> ignition::math::PreinitReport()
+{
+  // Keep in sync with Preinit() and with the function-local statics
+  // in Material.cc, MaterialType.hh and Rand.cc. Nothing in the
+  // library initializes at static-init time.
+  return {
+    "material-data: predefined material map, first Material use",
+    "material-name-index: sorted name lookup, first by-name lookup",
+    "rand-seed: std::random_device draw, first Rand seed access",
+    "rand-generator: shared generator construction, first Rand draw",
+    "ziggurat-tables: normal tables, first batch normal fill",
+  };
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/Material.hh"
+#include "ignition/math/Preinit.hh"
+#include "ignition/math/Rand.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(PreinitTest, Preinit)
+{
+  // Warming is idempotent and leaves the library fully usable.
+  math::Preinit();
+  math::Preinit();
+
+  EXPECT_FALSE(math::Material::Predefined().empty());
+  EXPECT_EQ(math::MaterialType::IRON, math::Material("iron").Type());
+
+  // Seeding after Preinit still gives a reproducible stream.
+  math::Rand::Seed(42);
+  const double first = math::Rand::DblUniform(0, 1);
+  math::Rand::Seed(42);
+  EXPECT_DOUBLE_EQ(first, math::Rand::DblUniform(0, 1));
+}
+
+/////////////////////////////////////////////////
+TEST(PreinitTest, Report)
+{
+  const std::vector<std::string> report = math::PreinitReport();
+  EXPECT_EQ(5u, report.size());
+  for (const std::string &entry : report)
+    EXPECT_NE(std::string::npos, entry.find(": ")) << entry;
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Quaternion.hh"
@@ -665,3 +666,259 @@ TEST(QuaternionTest, From2Axes)
   EXPECT_TRUE(math::equal(q2.Z(), 0.0));
 }
 
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, ConstexprCore)
+{
+  // The non-transcendental core is usable in constant expressions.
+  constexpr math::Quaterniond q1(0.5, 0.5, -0.5, 0.5);
+  constexpr math::Quaterniond q2(1.0, 0.0, 0.0, 0.0);
+
+  constexpr math::Quaterniond sum = q1 + q2;
+  constexpr math::Quaterniond diff = q1 - q2;
+  constexpr math::Quaterniond prod = q1 * q2;
+  constexpr math::Quaterniond scaled = q1 * 2.0;
+  constexpr math::Quaterniond inv = q1.Inverse();
+  constexpr double dot = q1.Dot(q1);
+
+  static_assert(dot == 1.0, "unit quaternion dot");
+
+  EXPECT_EQ(sum, math::Quaterniond(1.5, 0.5, -0.5, 0.5));
+  EXPECT_EQ(diff, math::Quaterniond(-0.5, 0.5, -0.5, 0.5));
+  EXPECT_EQ(prod, q1);
+  EXPECT_EQ(scaled, math::Quaterniond(1.0, 1.0, -1.0, 1.0));
+  EXPECT_EQ(inv, math::Quaterniond(0.5, -0.5, 0.5, -0.5));
+
+  // FromAxisFast with precomputed sin/cos of the half angle: a 90 degree
+  // rotation about +Z.
+  constexpr double sinHalf = 0.7071067811865476;
+  constexpr double cosHalf = 0.7071067811865476;
+  constexpr math::Quaterniond zRot =
+      math::Quaterniond::FromAxisFast(0.0, 0.0, 1.0, sinHalf, cosHalf);
+  EXPECT_EQ(zRot, math::Quaterniond(math::Vector3d(0, 0, 1), IGN_PI_2));
+  EXPECT_EQ(zRot.RotateVector(math::Vector3d::UnitX),
+            math::Vector3d(0, 1, 0));
+}
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, RotateVectors)
+{
+  std::vector<math::Quaterniond> rotations =
+  {
+    math::Quaterniond::Identity,
+    math::Quaterniond(IGN_PI_4, 0, 0),
+    math::Quaterniond(0.1, -0.7, 1.3),
+    math::Quaterniond(math::Vector3d(1, 2, 3).Normalize(), 0.9),
+    // Non-normalized quaternion; RotateVector handles these too.
+    math::Quaterniond(2.0, 0.4, -0.6, 0.8)
+  };
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 12; ++i)
+  {
+    points.push_back(math::Vector3d(0.5 * i - 3.0, 0.25 * i * i - 2.0,
+        1.0 - 0.3 * i));
+  }
+
+  for (const auto &rot : rotations)
+  {
+    std::vector<math::Vector3d> out(points.size());
+    rot.RotateVectors(points.data(), out.data(), points.size());
+
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+      math::Vector3d expected = rot.RotateVector(points[i]);
+      EXPECT_NEAR(expected.X(), out[i].X(), 1e-10);
+      EXPECT_NEAR(expected.Y(), out[i].Y(), 1e-10);
+      EXPECT_NEAR(expected.Z(), out[i].Z(), 1e-10);
+    }
+
+    // In-place rotation is allowed.
+    std::vector<math::Vector3d> inPlace = points;
+    rot.RotateVectors(inPlace.data(), inPlace.data(), inPlace.size());
+    for (size_t i = 0; i < points.size(); ++i)
+      EXPECT_EQ(out[i], inPlace[i]);
+  }
+
+  // A zero quaternion maps every vector to zero, like RotateVector.
+  math::Quaterniond zero(0, 0, 0, 0);
+  std::vector<math::Vector3d> out(points.size());
+  zero.RotateVectors(points.data(), out.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(zero.RotateVector(points[i]), out[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, SlerpBatch)
+{
+  // Joint rotations with small and large angular differences, plus a
+  // pair on the far hemisphere that needs the shortest-path flip.
+  std::vector<math::Quaterniond> from;
+  std::vector<math::Quaterniond> to;
+  from.push_back(math::Quaterniond(0.1, 0.2, 0.3));
+  to.push_back(math::Quaterniond(0.11, 0.21, 0.29));
+  from.push_back(math::Quaterniond(0, 0, 0));
+  to.push_back(math::Quaterniond(0, 0, IGN_PI_2));
+  from.push_back(math::Quaterniond(IGN_PI_4, 0, 0));
+  to.push_back(-math::Quaterniond(IGN_PI_4, 0.1, 0));
+  from.push_back(math::Quaterniond(0.5, -0.5, 1.0));
+  to.push_back(math::Quaterniond(-1.0, 0.2, 0.1));
+
+  const double t = 0.3;
+  std::vector<math::Quaterniond> out(from.size());
+  // Force exact slerp everywhere to compare against the scalar call.
+  math::Quaterniond::SlerpBatch(t, from.data(), to.data(), out.data(),
+      from.size(), 1.0);
+  for (size_t i = 0; i < from.size(); ++i)
+  {
+    math::Quaterniond expected =
+        math::Quaterniond::Slerp(t, from[i], to[i], true);
+    expected.Normalize();
+    EXPECT_NEAR(std::abs(expected.Dot(out[i])), 1.0, 1e-9) << "pair " << i;
+  }
+
+  // The nlerp fast path stays within a tight angular error of slerp
+  // for nearby rotations.
+  math::Quaterniond::SlerpBatch(t, from.data(), to.data(), out.data(),
+      from.size(), 0.99);
+  for (size_t i = 0; i < from.size(); ++i)
+  {
+    math::Quaterniond expected =
+        math::Quaterniond::Slerp(t, from[i], to[i], true);
+    expected.Normalize();
+    EXPECT_NEAR(std::abs(expected.Dot(out[i])), 1.0, 1e-5) << "pair " << i;
+  }
+
+  // The planar overload matches the array-of-struct one exactly.
+  const size_t n = from.size();
+  std::vector<double> planes(12 * n);
+  double *fromPlanes[4], *toPlanes[4], *outPlanes[4];
+  for (int p = 0; p < 4; ++p)
+  {
+    fromPlanes[p] = planes.data() + p * n;
+    toPlanes[p] = planes.data() + (4 + p) * n;
+    outPlanes[p] = planes.data() + (8 + p) * n;
+  }
+  for (size_t i = 0; i < n; ++i)
+  {
+    fromPlanes[0][i] = from[i].W();
+    fromPlanes[1][i] = from[i].X();
+    fromPlanes[2][i] = from[i].Y();
+    fromPlanes[3][i] = from[i].Z();
+    toPlanes[0][i] = to[i].W();
+    toPlanes[1][i] = to[i].X();
+    toPlanes[2][i] = to[i].Y();
+    toPlanes[3][i] = to[i].Z();
+  }
+  const double *constFrom[4] =
+      {fromPlanes[0], fromPlanes[1], fromPlanes[2], fromPlanes[3]};
+  const double *constTo[4] =
+      {toPlanes[0], toPlanes[1], toPlanes[2], toPlanes[3]};
+  math::Quaterniond::SlerpBatch(t, constFrom, constTo, outPlanes, n, 0.99);
+  for (size_t i = 0; i < n; ++i)
+  {
+    EXPECT_NEAR(out[i].W(), outPlanes[0][i], 1e-12) << "pair " << i;
+    EXPECT_NEAR(out[i].X(), outPlanes[1][i], 1e-12) << "pair " << i;
+    EXPECT_NEAR(out[i].Y(), outPlanes[2][i], 1e-12) << "pair " << i;
+    EXPECT_NEAR(out[i].Z(), outPlanes[3][i], 1e-12) << "pair " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, FloatNormalize)
+{
+  for (int i = 1; i < 200; ++i)
+  {
+    math::Quaternionf q(0.5f * i, -0.3f * i, 0.2f * i, 1.0f - 0.01f * i);
+    const math::Quaterniond ref(q.W(), q.X(), q.Y(), q.Z());
+    math::Quaterniond refNorm = ref;
+    refNorm.Normalize();
+    q.Normalize();
+    EXPECT_NEAR(q.W(), refNorm.W(), 5e-7) << i;
+    EXPECT_NEAR(q.X(), refNorm.X(), 5e-7) << i;
+    EXPECT_NEAR(q.Y(), refNorm.Y(), 5e-7) << i;
+    EXPECT_NEAR(q.Z(), refNorm.Z(), 5e-7) << i;
+  }
+
+  // A zero quaternion normalizes to identity, as in the generic path.
+  math::Quaternionf zero(0.0f, 0.0f, 0.0f, 0.0f);
+  zero.Normalize();
+  EXPECT_FLOAT_EQ(zero.W(), 1.0f);
+  EXPECT_FLOAT_EQ(zero.X(), 0.0f);
+}
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, IntegrateBatch)
+{
+  // The batch kernel must reproduce the scalar Integrate exactly,
+  // including the small-angle series branch.
+  std::vector<math::Quaterniond> rotations;
+  std::vector<math::Vector3d> velocities;
+  for (int i = 0; i < 30; ++i)
+  {
+    math::Quaterniond q(0.1 * i, -0.2 * i, 0.05 * i);
+    q.Normalize();
+    rotations.push_back(q);
+    if (i % 5 == 0)
+      velocities.push_back(math::Vector3d(1e-9, -2e-9, 1e-9));
+    else
+      velocities.push_back(math::Vector3d(0.3 * i, 1.0 - 0.1 * i, 2.0));
+  }
+
+  const double dt = 1e-3;
+  std::vector<math::Quaterniond> expected;
+  for (size_t i = 0; i < rotations.size(); ++i)
+    expected.push_back(rotations[i].Integrate(velocities[i], dt));
+
+  math::Quaterniond::IntegrateBatch(rotations.data(), velocities.data(),
+      rotations.size(), dt);
+
+  for (size_t i = 0; i < rotations.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(rotations[i].W(), expected[i].W()) << i;
+    EXPECT_DOUBLE_EQ(rotations[i].X(), expected[i].X()) << i;
+    EXPECT_DOUBLE_EQ(rotations[i].Y(), expected[i].Y()) << i;
+    EXPECT_DOUBLE_EQ(rotations[i].Z(), expected[i].Z()) << i;
+    // The exponential map preserves unit length.
+    EXPECT_NEAR(rotations[i].W() * rotations[i].W() +
+        rotations[i].X() * rotations[i].X() +
+        rotations[i].Y() * rotations[i].Y() +
+        rotations[i].Z() * rotations[i].Z(), 1.0, 1e-12) << i;
+  }
+
+  // Many small steps about z accumulate to the expected yaw.
+  math::Quaterniond spin;
+  math::Vector3d omega(0, 0, IGN_PI);
+  for (int step = 0; step < 1000; ++step)
+    math::Quaterniond::IntegrateBatch(&spin, &omega, 1, 1e-3);
+  EXPECT_NEAR(spin.Yaw(), IGN_PI, 1e-9);
+}
+
+
+/////////////////////////////////////////////////
+TEST(QuaternionTest, RotationMatrix)
+{
+  const math::Quaterniond q(1.2, -0.4, 0.7);
+
+  // The accessor matches the Matrix3 constructor exactly, including
+  // the normalization it performs.
+  const math::Matrix3d mat = q.RotationMatrix();
+  EXPECT_EQ(mat, math::Matrix3d(q));
+
+  // An unnormalized quaternion is normalized during conversion.
+  math::Quaterniond scaled(q.W() * 3.0, q.X() * 3.0, q.Y() * 3.0,
+      q.Z() * 3.0);
+  EXPECT_EQ(scaled.RotationMatrix(), mat);
+
+  // Matrix-vector products agree with the quaternion sandwich.
+  const math::Vector3d v(0.3, -2.1, 0.5);
+  const math::Vector3d viaMat = mat * v;
+  const math::Vector3d viaQuat = q.RotateVector(v);
+  EXPECT_NEAR(viaMat.X(), viaQuat.X(), 1e-12);
+  EXPECT_NEAR(viaMat.Y(), viaQuat.Y(), 1e-12);
+  EXPECT_NEAR(viaMat.Z(), viaQuat.Z(), 1e-12);
+
+  // Identity converts to identity.
+  EXPECT_EQ(math::Quaterniond::Identity.RotationMatrix(),
+      math::Matrix3d::Identity);
+}
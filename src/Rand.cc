@@ -30,6 +30,131 @@
 using namespace ignition;
 using namespace math;
 
+namespace
+{
+  /// \brief Number of layers of the ziggurat.
+  constexpr int kZigguratLayers = 128;
+
+  /// \brief Tables of the Marsaglia-Tsang ziggurat for the standard
+  /// normal distribution, built once on first use. k holds the
+  /// per-layer acceptance thresholds against a signed 31-bit draw,
+  /// w the per-layer scale from that draw to a sample, and f the
+  /// density at each layer boundary.
+  struct ZigguratTables
+  {
+    public: uint32_t k[kZigguratLayers];
+    public: double w[kZigguratLayers];
+    public: double f[kZigguratLayers];
+
+    public: ZigguratTables()
+    {
+      // Rightmost layer boundary and the common layer area.
+      const double m = 2147483648.0;
+      double dn = 3.442619855899;
+      double tn = dn;
+      const double vn = 9.91256303526217e-3;
+
+      const double q = vn / std::exp(-0.5 * dn * dn);
+      this->k[0] = static_cast<uint32_t>((dn / q) * m);
+      this->k[1] = 0;
+      this->w[0] = q / m;
+      this->w[kZigguratLayers - 1] = dn / m;
+      this->f[0] = 1.0;
+      this->f[kZigguratLayers - 1] = std::exp(-0.5 * dn * dn);
+
+      for (int i = kZigguratLayers - 2; i >= 1; --i)
+      {
+        dn = std::sqrt(-2.0 *
+            std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+        this->k[i + 1] = static_cast<uint32_t>((dn / tn) * m);
+        tn = dn;
+        this->f[i] = std::exp(-0.5 * dn * dn);
+        this->w[i] = dn / m;
+      }
+    }
+  };
+
+  /// \brief Get a double in (0, 1) from a raw generator draw.
+  /// \param[in] _gen The generator to draw from.
+  /// \return The uniform value.
+  double ZigguratUni(ignition::math::GeneratorType &_gen)
+  {
+    return 0.5 + static_cast<int32_t>(_gen()) * 0.2328306e-9;
+  }
+
+  /// \brief Draw one standard normal sample with the ziggurat
+  /// method. Most draws cost a single table compare; rejected draws
+  /// fall through to the layer edges, and layer zero samples the tail
+  /// exactly.
+  /// \param[in] _gen The generator to draw from.
+  /// \return The sample.
+  double ZigguratNormal(ignition::math::GeneratorType &_gen)
+  {
+    static const ZigguratTables zig;
+
+    // Abscissa of the rightmost layer boundary.
+    const double r = 3.442619855899;
+
+    int32_t hz = static_cast<int32_t>(_gen());
+    for (;;)
+    {
+      const uint32_t iz = static_cast<uint32_t>(hz) & 127u;
+      if (static_cast<uint32_t>(std::abs(hz)) < zig.k[iz])
+        return hz * zig.w[iz];
+
+      const double x = hz * zig.w[iz];
+      if (iz == 0)
+      {
+        // The tail beyond r, sampled with Marsaglia's exact method.
+        double xt, yt;
+        do
+        {
+          xt = -std::log(ZigguratUni(_gen)) / r;
+          yt = -std::log(ZigguratUni(_gen));
+        } while (yt + yt < xt * xt);
+        return hz > 0 ? r + xt : -r - xt;
+      }
+
+      if (zig.f[iz] + ZigguratUni(_gen) * (zig.f[iz - 1] - zig.f[iz]) <
+          std::exp(-0.5 * x * x))
+      {
+        return x;
+      }
+
+      hz = static_cast<int32_t>(_gen());
+    }
+  }
+
+  /// \brief Shared implementation of the uniform fill functions.
+  /// \param[in] _gen The generator to draw from.
+  /// \param[out] _values Destination array of _count doubles.
+  /// \param[in] _count Number of values to generate.
+  /// \param[in] _min Minimum bound for the random numbers.
+  /// \param[in] _max Maximum bound for the random numbers.
+  void FillUniformImpl(ignition::math::GeneratorType &_gen,
+      double *_values, const size_t _count,
+      const double _min, const double _max)
+  {
+    ignition::math::UniformRealDist d(_min, _max);
+    for (size_t i = 0; i < _count; ++i)
+      _values[i] = d(_gen);
+  }
+
+  /// \brief Shared implementation of the normal fill functions.
+  /// \param[in] _gen The generator to draw from.
+  /// \param[out] _values Destination array of _count doubles.
+  /// \param[in] _count Number of values to generate.
+  /// \param[in] _mean Mean value for the distribution.
+  /// \param[in] _sigma Sigma value for the distribution.
+  void FillNormalImpl(ignition::math::GeneratorType &_gen,
+      double *_values, const size_t _count,
+      const double _mean, const double _sigma)
+  {
+    for (size_t i = 0; i < _count; ++i)
+      _values[i] = _mean + _sigma * ZigguratNormal(_gen);
+  }
+}
+
 //////////////////////////////////////////////////
 void Rand::Seed(unsigned int _seed)
 {
@@ -58,6 +183,20 @@ double Rand::DblNormal(double _mean, double _sigma)
   return d(RandGenerator());
 }
 
+//////////////////////////////////////////////////
+void Rand::FillDblUniform(double *_values, const size_t _count,
+    double _min, double _max)
+{
+  FillUniformImpl(RandGenerator(), _values, _count, _min, _max);
+}
+
+//////////////////////////////////////////////////
+void Rand::FillDblNormal(double *_values, const size_t _count,
+    double _mean, double _sigma)
+{
+  FillNormalImpl(RandGenerator(), _values, _count, _mean, _sigma);
+}
+
 //////////////////////////////////////////////////
 int32_t Rand::IntUniform(int _min, int _max)
 {
@@ -90,3 +229,252 @@ GeneratorType &Rand::RandGenerator()
   static GeneratorType randGenerator(Seed());
   return randGenerator;
 }
+
+//////////////////////////////////////////////////
+RandomEngine::RandomEngine()
+  : RandomEngine(std::random_device{}())
+{
+}
+
+//////////////////////////////////////////////////
+RandomEngine::RandomEngine(unsigned int _seed)
+  : seed(_seed)
+{
+  // Match Rand::Seed, which expands the seed through a seed_seq.
+  std::seed_seq seq{_seed};
+  this->generator.seed(seq);
+}
+
+//////////////////////////////////////////////////
+RandomEngine::RandomEngine(unsigned int _seed, uint64_t _stream)
+  : seed(_seed)
+{
+  // Mixing the stream number into the seed sequence gives every
+  // stream of a family an independent state.
+  std::seed_seq seq{static_cast<uint64_t>(_seed),
+      static_cast<uint64_t>(0x9e3779b97f4a7c15ULL), _stream};
+  this->generator.seed(seq);
+}
+
+//////////////////////////////////////////////////
+void RandomEngine::Seed(unsigned int _seed)
+{
+  std::seed_seq seq{_seed};
+  this->seed = _seed;
+  this->generator.seed(seq);
+}
+
+//////////////////////////////////////////////////
+unsigned int RandomEngine::Seed() const
+{
+  return this->seed;
+}
+
+//////////////////////////////////////////////////
+void RandomEngine::Discard(unsigned long long _count)
+{
+  this->generator.discard(_count);
+}
+
+//////////////////////////////////////////////////
+double RandomEngine::DblUniform(double _min, double _max)
+{
+  UniformRealDist d(_min, _max);
+  return d(this->generator);
+}
+
+//////////////////////////////////////////////////
+double RandomEngine::DblNormal(double _mean, double _sigma)
+{
+  NormalRealDist d(_mean, _sigma);
+  return d(this->generator);
+}
+
+//////////////////////////////////////////////////
+void RandomEngine::FillDblUniform(double *_values, const size_t _count,
+    double _min, double _max)
+{
+  FillUniformImpl(this->generator, _values, _count, _min, _max);
+}
+
+//////////////////////////////////////////////////
+void RandomEngine::FillDblNormal(double *_values, const size_t _count,
+    double _mean, double _sigma)
+{
+  FillNormalImpl(this->generator, _values, _count, _mean, _sigma);
+}
+
+//////////////////////////////////////////////////
+int32_t RandomEngine::IntUniform(int _min, int _max)
+{
+  UniformIntDist d(_min, _max);
+  return d(this->generator);
+}
+
+//////////////////////////////////////////////////
+int32_t RandomEngine::IntNormal(int _mean, int _sigma)
+{
+  NormalRealDist d(_mean, _sigma);
+  return static_cast<int32_t>(d(this->generator));
+}
+
+//////////////////////////////////////////////////
+GeneratorType &RandomEngine::Generator()
+{
+  return this->generator;
+}
+
+namespace
+{
+  /// \brief One 128-bit Philox output block.
+  struct PhiloxBlock
+  {
+    public: uint32_t v[4];
+  };
+
+  /// \brief Evaluate Philox4x32-10 for one key/counter position. The
+  /// constants are the published ones from Salmon et al., "Parallel
+  /// random numbers: as easy as 1, 2, 3", so the output matches other
+  /// Philox implementations bit for bit on every machine.
+  /// \param[in] _key0 First key word.
+  /// \param[in] _key1 Second key word.
+  /// \param[in] _ctr The 128-bit counter, as four words.
+  /// \return The output block.
+  PhiloxBlock Philox(uint32_t _key0, uint32_t _key1,
+      const PhiloxBlock &_ctr)
+  {
+    constexpr uint32_t kMul0 = 0xD2511F53u;
+    constexpr uint32_t kMul1 = 0xCD9E8D57u;
+    constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+    constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+
+    uint32_t c0 = _ctr.v[0], c1 = _ctr.v[1];
+    uint32_t c2 = _ctr.v[2], c3 = _ctr.v[3];
+    uint32_t k0 = _key0, k1 = _key1;
+
+    for (int round = 0; round < 10; ++round)
+    {
+      const uint64_t p0 = static_cast<uint64_t>(kMul0) * c0;
+      const uint64_t p1 = static_cast<uint64_t>(kMul1) * c2;
+      const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32);
+      const uint32_t lo0 = static_cast<uint32_t>(p0);
+      const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32);
+      const uint32_t lo1 = static_cast<uint32_t>(p1);
+
+      c0 = hi1 ^ c1 ^ k0;
+      c1 = lo1;
+      c2 = hi0 ^ c3 ^ k1;
+      c3 = lo0;
+      k0 += kWeyl0;
+      k1 += kWeyl1;
+    }
+
+    return {{c0, c1, c2, c3}};
+  }
+
+  /// \brief Second key word; the first is the user seed.
+  constexpr uint32_t kPhiloxKey1 = 0xCAFEF00Du;
+
+  /// \brief Scale from a 53-bit integer to [0, 1).
+  constexpr double kTo53 = 1.0 / 9007199254740992.0;  // 2^-53
+
+  /// \brief Build the counter block for a (stream, counter) position.
+  /// \param[in] _stream Stream number.
+  /// \param[in] _counter Position within the stream.
+  /// \return The counter block.
+  PhiloxBlock PhiloxCounter(uint64_t _stream, uint64_t _counter)
+  {
+    return {{static_cast<uint32_t>(_counter),
+             static_cast<uint32_t>(_counter >> 32),
+             static_cast<uint32_t>(_stream),
+             static_cast<uint32_t>(_stream >> 32)}};
+  }
+}
+
+//////////////////////////////////////////////////
+CounterRandomEngine::CounterRandomEngine(unsigned int _seed)
+  : seed(_seed)
+{
+}
+
+//////////////////////////////////////////////////
+void CounterRandomEngine::Seed(unsigned int _seed)
+{
+  this->seed = _seed;
+}
+
+//////////////////////////////////////////////////
+unsigned int CounterRandomEngine::Seed() const
+{
+  return this->seed;
+}
+
+//////////////////////////////////////////////////
+uint64_t CounterRandomEngine::UInt64(uint64_t _stream,
+    uint64_t _counter) const
+{
+  const PhiloxBlock out = Philox(this->seed, kPhiloxKey1,
+      PhiloxCounter(_stream, _counter));
+  return static_cast<uint64_t>(out.v[0]) |
+      (static_cast<uint64_t>(out.v[1]) << 32);
+}
+
+//////////////////////////////////////////////////
+double CounterRandomEngine::DblUniform(uint64_t _stream, uint64_t _counter,
+    double _min, double _max) const
+{
+  const double u = static_cast<double>(
+      this->UInt64(_stream, _counter) >> 11) * kTo53;
+  return _min + u * (_max - _min);
+}
+
+//////////////////////////////////////////////////
+double CounterRandomEngine::DblNormal(uint64_t _stream, uint64_t _counter,
+    double _mean, double _sigma) const
+{
+  // Box-Muller over one block: both uniforms come from the same
+  // (stream, counter) position, so one position yields one sample.
+  const PhiloxBlock out = Philox(this->seed, kPhiloxKey1,
+      PhiloxCounter(_stream, _counter));
+  const uint64_t bits0 = static_cast<uint64_t>(out.v[0]) |
+      (static_cast<uint64_t>(out.v[1]) << 32);
+  const uint64_t bits1 = static_cast<uint64_t>(out.v[2]) |
+      (static_cast<uint64_t>(out.v[3]) << 32);
+
+  // Offset by half an ulp so u1 is never zero for the logarithm.
+  const double u1 = (static_cast<double>(bits0 >> 11) + 0.5) * kTo53;
+  const double u2 = static_cast<double>(bits1 >> 11) * kTo53;
+  return _mean + _sigma *
+      std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * IGN_PI * u2);
+}
+
+//////////////////////////////////////////////////
+int32_t CounterRandomEngine::IntUniform(uint64_t _stream, uint64_t _counter,
+    int _min, int _max) const
+{
+  if (_max < _min)
+    return _min;
+
+  const uint64_t span = static_cast<uint64_t>(
+      static_cast<int64_t>(_max) - static_cast<int64_t>(_min)) + 1u;
+  return static_cast<int32_t>(static_cast<int64_t>(_min) +
+      static_cast<int64_t>(this->UInt64(_stream, _counter) % span));
+}
+
+//////////////////////////////////////////////////
+void CounterRandomEngine::FillDblUniform(uint64_t _stream,
+    uint64_t _counter, double *_values, const size_t _count,
+    double _min, double _max) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _values[i] = this->DblUniform(_stream, _counter + i, _min, _max);
+}
+
+//////////////////////////////////////////////////
+void CounterRandomEngine::FillDblNormal(uint64_t _stream,
+    uint64_t _counter, double *_values, const size_t _count,
+    double _mean, double _sigma) const
+{
+  for (size_t i = 0; i < _count; ++i)
+    _values[i] = this->DblNormal(_stream, _counter + i, _mean, _sigma);
+}
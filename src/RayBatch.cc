@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+
+#include "ignition/math/Matrix3.hh"
+#include "ignition/math/RayBatch.hh"
+
+using namespace ignition;
+using namespace math;
+
+/// \brief Private data for the RayBatch class.
+class ignition::math::RayBatchPrivate
+{
+  /// \brief Ray origins, one component array per axis.
+  public: std::vector<double> ox, oy, oz;
+
+  /// \brief Normalized ray directions, one component array per axis.
+  public: std::vector<double> dx, dy, dz;
+
+  /// \brief Nearest hit distance per ray, maxRange when nothing hit.
+  public: std::vector<double> ranges;
+
+  /// \brief Maximum hit distance of the current batch.
+  public: double maxRange = MAX_D;
+};
+
+//////////////////////////////////////////////////
+RayBatch::RayBatch()
+  : dataPtr(new RayBatchPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+RayBatch::~RayBatch()
+{
+}
+
+//////////////////////////////////////////////////
+void RayBatch::SetRays(const Vector3d *_origins,
+    const Vector3d *_directions, size_t _count, double _maxRange)
+{
+  this->dataPtr->ox.resize(_count);
+  this->dataPtr->oy.resize(_count);
+  this->dataPtr->oz.resize(_count);
+  this->dataPtr->dx.resize(_count);
+  this->dataPtr->dy.resize(_count);
+  this->dataPtr->dz.resize(_count);
+  this->dataPtr->ranges.assign(_count, _maxRange);
+  this->dataPtr->maxRange = _maxRange;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d dir = _directions[i].Normalized();
+    this->dataPtr->ox[i] = _origins[i].X();
+    this->dataPtr->oy[i] = _origins[i].Y();
+    this->dataPtr->oz[i] = _origins[i].Z();
+    this->dataPtr->dx[i] = dir.X();
+    this->dataPtr->dy[i] = dir.Y();
+    this->dataPtr->dz[i] = dir.Z();
+  }
+}
+
+//////////////////////////////////////////////////
+size_t RayBatch::RayCount() const
+{
+  return this->dataPtr->ranges.size();
+}
+
+//////////////////////////////////////////////////
+void RayBatch::CastPlanes(const Planed *_planes, size_t _count)
+{
+  const size_t n = this->RayCount();
+  const double *ox = this->dataPtr->ox.data();
+  const double *oy = this->dataPtr->oy.data();
+  const double *oz = this->dataPtr->oz.data();
+  const double *dx = this->dataPtr->dx.data();
+  const double *dy = this->dataPtr->dy.data();
+  const double *dz = this->dataPtr->dz.data();
+  double *ranges = this->dataPtr->ranges.data();
+
+  for (size_t p = 0; p < _count; ++p)
+  {
+    const double nx = _planes[p].Normal().X();
+    const double ny = _planes[p].Normal().Y();
+    const double nz = _planes[p].Normal().Z();
+    const double d = _planes[p].Offset();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      const double denom = nx*dx[i] + ny*dy[i] + nz*dz[i];
+      if (std::abs(denom) < 1e-16)
+        continue;
+
+      const double t = (d - (nx*ox[i] + ny*oy[i] + nz*oz[i])) / denom;
+      if (t >= 0 && t < ranges[i])
+        ranges[i] = t;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void RayBatch::CastTriangles(const Triangle3d *_triangles, size_t _count)
+{
+  const size_t n = this->RayCount();
+  const double *ox = this->dataPtr->ox.data();
+  const double *oy = this->dataPtr->oy.data();
+  const double *oz = this->dataPtr->oz.data();
+  const double *dx = this->dataPtr->dx.data();
+  const double *dy = this->dataPtr->dy.data();
+  const double *dz = this->dataPtr->dz.data();
+  double *ranges = this->dataPtr->ranges.data();
+
+  for (size_t tri = 0; tri < _count; ++tri)
+  {
+    // Moeller-Trumbore with the edge vectors hoisted out of the ray
+    // loop.
+    const Vector3d v0 = _triangles[tri][0];
+    const Vector3d e1 = _triangles[tri][1] - v0;
+    const Vector3d e2 = _triangles[tri][2] - v0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      // p = dir x e2
+      const double px = dy[i]*e2.Z() - dz[i]*e2.Y();
+      const double py = dz[i]*e2.X() - dx[i]*e2.Z();
+      const double pz = dx[i]*e2.Y() - dy[i]*e2.X();
+
+      const double det = e1.X()*px + e1.Y()*py + e1.Z()*pz;
+      if (std::abs(det) < 1e-16)
+        continue;
+      const double invDet = 1.0 / det;
+
+      const double tx = ox[i] - v0.X();
+      const double ty = oy[i] - v0.Y();
+      const double tz = oz[i] - v0.Z();
+
+      const double u = (tx*px + ty*py + tz*pz) * invDet;
+      if (u < 0 || u > 1)
+        continue;
+
+      // q = tvec x e1
+      const double qx = ty*e1.Z() - tz*e1.Y();
+      const double qy = tz*e1.X() - tx*e1.Z();
+      const double qz = tx*e1.Y() - ty*e1.X();
+
+      const double v = (dx[i]*qx + dy[i]*qy + dz[i]*qz) * invDet;
+      if (v < 0 || u + v > 1)
+        continue;
+
+      const double t = (e2.X()*qx + e2.Y()*qy + e2.Z()*qz) * invDet;
+      if (t >= 0 && t < ranges[i])
+        ranges[i] = t;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void RayBatch::CastBoxes(const OrientedBoxd *_boxes, size_t _count)
+{
+  const size_t n = this->RayCount();
+  const double *ox = this->dataPtr->ox.data();
+  const double *oy = this->dataPtr->oy.data();
+  const double *oz = this->dataPtr->oz.data();
+  const double *dx = this->dataPtr->dx.data();
+  const double *dy = this->dataPtr->dy.data();
+  const double *dz = this->dataPtr->dz.data();
+  double *ranges = this->dataPtr->ranges.data();
+
+  for (size_t b = 0; b < _count; ++b)
+  {
+    // Bring the rays into the box frame once per box; the slab test
+    // against the half sizes is then branch-light per ray.
+    const Matrix3d rot(_boxes[b].Pose().Rot());
+    const Vector3d center = _boxes[b].Pose().Pos();
+    const Vector3d half = _boxes[b].Size() / 2.0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      const double cx = ox[i] - center.X();
+      const double cy = oy[i] - center.Y();
+      const double cz = oz[i] - center.Z();
+
+      // Rows of rot^T are the columns of rot.
+      const double lox = rot(0, 0)*cx + rot(1, 0)*cy + rot(2, 0)*cz;
+      const double loy = rot(0, 1)*cx + rot(1, 1)*cy + rot(2, 1)*cz;
+      const double loz = rot(0, 2)*cx + rot(1, 2)*cy + rot(2, 2)*cz;
+      const double ldx = rot(0, 0)*dx[i] + rot(1, 0)*dy[i] + rot(2, 0)*dz[i];
+      const double ldy = rot(0, 1)*dx[i] + rot(1, 1)*dy[i] + rot(2, 1)*dz[i];
+      const double ldz = rot(0, 2)*dx[i] + rot(1, 2)*dy[i] + rot(2, 2)*dz[i];
+
+      double tmin = -MAX_D;
+      double tmax = MAX_D;
+      const double lo[3] = {lox, loy, loz};
+      const double ld[3] = {ldx, ldy, ldz};
+      const double hs[3] = {half.X(), half.Y(), half.Z()};
+
+      bool miss = false;
+      for (int axis = 0; axis < 3 && !miss; ++axis)
+      {
+        if (std::abs(ld[axis]) < 1e-16)
+        {
+          if (std::abs(lo[axis]) > hs[axis])
+            miss = true;
+          continue;
+        }
+        const double inv = 1.0 / ld[axis];
+        double t1 = (-hs[axis] - lo[axis]) * inv;
+        double t2 = (hs[axis] - lo[axis]) * inv;
+        if (t1 > t2)
+          std::swap(t1, t2);
+        tmin = std::max(tmin, t1);
+        tmax = std::min(tmax, t2);
+        if (tmin > tmax)
+          miss = true;
+      }
+      if (miss || tmax < 0)
+        continue;
+
+      const double t = tmin >= 0 ? tmin : 0.0;
+      if (t < ranges[i])
+        ranges[i] = t;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+double RayBatch::Range(size_t _ray) const
+{
+  if (_ray >= this->dataPtr->ranges.size())
+    return this->dataPtr->maxRange;
+  return this->dataPtr->ranges[_ray];
+}
+
+//////////////////////////////////////////////////
+bool RayBatch::Hit(size_t _ray) const
+{
+  return _ray < this->dataPtr->ranges.size() &&
+      this->dataPtr->ranges[_ray] < this->dataPtr->maxRange;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &RayBatch::Ranges() const
+{
+  return this->dataPtr->ranges;
+}
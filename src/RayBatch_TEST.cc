@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/RayBatch.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(RayBatchTest, Planes)
+{
+  // Two rays straight down from z = 10, one pointing up.
+  std::vector<Vector3d> origins =
+      {{0, 0, 10}, {5, 5, 10}, {0, 0, 10}};
+  std::vector<Vector3d> dirs =
+      {{0, 0, -1}, {0, 0, -2}, {0, 0, 1}};
+
+  RayBatch batch;
+  batch.SetRays(origins.data(), dirs.data(), origins.size());
+  EXPECT_EQ(3u, batch.RayCount());
+
+  // Ground plane z = 0.
+  Planed ground(Vector3d(0, 0, 1), 0);
+  batch.CastPlanes(&ground, 1);
+
+  EXPECT_TRUE(batch.Hit(0));
+  EXPECT_DOUBLE_EQ(10.0, batch.Range(0));
+
+  // Directions are normalized, so the distance is Euclidean.
+  EXPECT_DOUBLE_EQ(10.0, batch.Range(1));
+
+  // The up-facing ray never reaches the plane.
+  EXPECT_FALSE(batch.Hit(2));
+  EXPECT_DOUBLE_EQ(MAX_D, batch.Range(2));
+}
+
+/////////////////////////////////////////////////
+TEST(RayBatchTest, Triangles)
+{
+  std::vector<Vector3d> origins = {{0.2, 0.2, 5}, {2, 2, 5}};
+  std::vector<Vector3d> dirs = {{0, 0, -1}, {0, 0, -1}};
+
+  RayBatch batch;
+  batch.SetRays(origins.data(), dirs.data(), origins.size(), 100.0);
+
+  // Unit right triangle in the z = 1 plane.
+  Triangle3d tri(
+      Vector3d(0, 0, 1), Vector3d(1, 0, 1), Vector3d(0, 1, 1));
+  batch.CastTriangles(&tri, 1);
+
+  EXPECT_TRUE(batch.Hit(0));
+  EXPECT_DOUBLE_EQ(4.0, batch.Range(0));
+
+  // The second ray misses the triangle.
+  EXPECT_FALSE(batch.Hit(1));
+  EXPECT_DOUBLE_EQ(100.0, batch.Range(1));
+
+  // Agreement with the single-primitive call.
+  Vector3d pt;
+  Line3d line(origins[0], origins[0] + dirs[0] * 100.0);
+  EXPECT_TRUE(tri.Intersects(line, pt));
+  EXPECT_NEAR(pt.Z(), origins[0].Z() - batch.Range(0), 1e-12);
+}
+
+/////////////////////////////////////////////////
+TEST(RayBatchTest, Boxes)
+{
+  std::vector<Vector3d> origins = {{-10, 0, 0}, {0, 0, 0}, {-10, 5, 0}};
+  std::vector<Vector3d> dirs = {{1, 0, 0}, {1, 0, 0}, {1, 0, 0}};
+
+  RayBatch batch;
+  batch.SetRays(origins.data(), dirs.data(), origins.size(), 50.0);
+
+  // A 2x2x2 box at the origin, rotated 45 degrees about z so the ray
+  // along x hits a corner edge at sqrt(2).
+  OrientedBoxd box(Vector3d(2, 2, 2),
+      Pose3d(0, 0, 0, 0, 0, IGN_PI_4));
+  batch.CastBoxes(&box, 1);
+
+  EXPECT_TRUE(batch.Hit(0));
+  EXPECT_NEAR(10.0 - std::sqrt(2.0), batch.Range(0), 1e-9);
+
+  // A ray starting inside the box hits at distance zero.
+  EXPECT_TRUE(batch.Hit(1));
+  EXPECT_DOUBLE_EQ(0.0, batch.Range(1));
+
+  // The offset ray passes by the box.
+  EXPECT_FALSE(batch.Hit(2));
+}
+
+/////////////////////////////////////////////////
+TEST(RayBatchTest, NearestAcrossCasts)
+{
+  Vector3d origin(0, 0, 10);
+  Vector3d dir(0, 0, -1);
+
+  RayBatch batch;
+  batch.SetRays(&origin, &dir, 1);
+
+  // Plane below the triangle: the triangle hit must win.
+  Planed ground(Vector3d(0, 0, 1), 0);
+  Triangle3d tri(
+      Vector3d(-1, -1, 4), Vector3d(1, -1, 4), Vector3d(0, 1, 4));
+  batch.CastPlanes(&ground, 1);
+  batch.CastTriangles(&tri, 1);
+  EXPECT_DOUBLE_EQ(6.0, batch.Range(0));
+
+  // Loading new rays resets the ranges.
+  batch.SetRays(&origin, &dir, 1);
+  EXPECT_FALSE(batch.Hit(0));
+}
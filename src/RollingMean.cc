@@ -1,4 +1,4 @@
- /*
+/*
  * Copyright (C) 2019 Open Source Robotics Foundation
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,9 +15,11 @@
  *
 */
 
-#include <numeric>
+#include <cstdint>
 #include <limits>
 #include <deque>
+#include <utility>
+#include <vector>
 #include "ignition/math/RollingMean.hh"
 
 using namespace ignition::math;
@@ -28,8 +30,51 @@ class ignition::math::RollingMeanPrivate
   /// \brief The window size
   public: size_t windowSize{10};
 
-  /// \brief The values.
-  public: std::deque<double> values;
+  /// \brief Ring buffer holding the values in the window. Sized to the
+  /// window on first use and never reallocated afterwards.
+  public: std::vector<double> values;
+
+  /// \brief Ring index of the next slot to write.
+  public: size_t head{0};
+
+  /// \brief Number of values currently in the window.
+  public: size_t count{0};
+
+  /// \brief Incrementally maintained sum of the window, so Mean() is a
+  /// division instead of a scan.
+  public: double sum{0.0};
+
+  /// \brief Total number of pushed values; used to expire entries from
+  /// the extrema deques and to schedule re-summation.
+  public: uint64_t pushed{0};
+
+  /// \brief Monotonically increasing deque of (push index, value) used
+  /// for the windowed minimum. The front is always the current minimum.
+  public: std::deque<std::pair<uint64_t, double>> minDeque;
+
+  /// \brief Monotonically decreasing deque of (push index, value) used
+  /// for the windowed maximum. The front is always the current maximum.
+  public: std::deque<std::pair<uint64_t, double>> maxDeque;
+
+  /// \brief Recompute the sum from the stored values with Kahan
+  /// compensation. Called periodically so that the incremental
+  /// add/subtract updates cannot accumulate unbounded rounding drift.
+  public: void Resum()
+  {
+    double sumK = 0.0;
+    double comp = 0.0;
+    for (size_t i = 0; i < this->count; ++i)
+    {
+      const size_t idx =
+          (this->head + this->windowSize - this->count + i) %
+          this->windowSize;
+      const double y = this->values[idx] - comp;
+      const double t = sumK + y;
+      comp = (t - sumK) - y;
+      sumK = t;
+    }
+    this->sum = sumK;
+  }
 };
 
 //////////////////////////////////////////////////
@@ -48,12 +93,26 @@ RollingMean::~RollingMean()
 //////////////////////////////////////////////////
 double RollingMean::Mean() const
 {
-  if (!this->dataPtr->values.empty())
-  {
-    return std::accumulate(
-        this->dataPtr->values.begin(), this->dataPtr->values.end(), 0.0) /
-      this->dataPtr->values.size();
-  }
+  if (this->dataPtr->count > 0)
+    return this->dataPtr->sum / this->dataPtr->count;
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+//////////////////////////////////////////////////
+double RollingMean::Min() const
+{
+  if (!this->dataPtr->minDeque.empty())
+    return this->dataPtr->minDeque.front().second;
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+//////////////////////////////////////////////////
+double RollingMean::Max() const
+{
+  if (!this->dataPtr->maxDeque.empty())
+    return this->dataPtr->maxDeque.front().second;
 
   return std::numeric_limits<double>::quiet_NaN();
 }
@@ -61,24 +120,68 @@ double RollingMean::Mean() const
 //////////////////////////////////////////////////
 size_t RollingMean::Count() const
 {
-  return this->dataPtr->values.size();
+  return this->dataPtr->count;
 }
 
 //////////////////////////////////////////////////
 void RollingMean::Push(double _value)
 {
-  this->dataPtr->values.push_back(_value);
-  while (this->dataPtr->values.size() > this->dataPtr->windowSize &&
-         !this->dataPtr->values.empty())
-  {
-    this->dataPtr->values.pop_front();
-  }
+  auto &d = *this->dataPtr;
+
+  if (d.values.empty())
+    d.values.resize(d.windowSize, 0.0);
+
+  // Update the incremental sum: subtract the evicted value, add the
+  // new one.
+  if (d.count == d.windowSize)
+    d.sum -= d.values[d.head];
+  else
+    ++d.count;
+
+  d.sum += _value;
+  d.values[d.head] = _value;
+  d.head = (d.head + 1) % d.windowSize;
+
+  // Expire extrema that fell out of the window, then keep the deques
+  // monotonic. Each value enters and leaves each deque at most once,
+  // so the amortized cost per push is O(1).
+  const uint64_t idx = d.pushed++;
+  if (!d.minDeque.empty() && d.minDeque.front().first + d.windowSize <= idx)
+    d.minDeque.pop_front();
+  if (!d.maxDeque.empty() && d.maxDeque.front().first + d.windowSize <= idx)
+    d.maxDeque.pop_front();
+
+  while (!d.minDeque.empty() && d.minDeque.back().second >= _value)
+    d.minDeque.pop_back();
+  d.minDeque.emplace_back(idx, _value);
+
+  while (!d.maxDeque.empty() && d.maxDeque.back().second <= _value)
+    d.maxDeque.pop_back();
+  d.maxDeque.emplace_back(idx, _value);
+
+  // Periodically rebuild the sum to shed incremental rounding drift.
+  if (d.pushed % (64 * static_cast<uint64_t>(d.windowSize)) == 0)
+    d.Resum();
+}
+
+//////////////////////////////////////////////////
+void RollingMean::Push(const double *_values, size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    this->Push(_values[i]);
 }
 
 //////////////////////////////////////////////////
 void RollingMean::Clear()
 {
-  this->dataPtr->values.clear();
+  auto &d = *this->dataPtr;
+  d.values.clear();
+  d.head = 0;
+  d.count = 0;
+  d.sum = 0.0;
+  d.pushed = 0;
+  d.minDeque.clear();
+  d.maxDeque.clear();
 }
 
 //////////////////////////////////////////////////
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "ignition/math/RollingMeanBank.hh"
+
+using namespace ignition::math;
+
+/// \brief Private data
+class ignition::math::RollingMeanBankPrivate
+{
+  /// \brief Number of channels.
+  public: size_t channels{1};
+
+  /// \brief The window size shared by all channels.
+  public: size_t windowSize{10};
+
+  /// \brief Interleaved ring buffers: window slot r of channel c lives
+  /// at [r * channels + c], so one push touches one contiguous row.
+  /// Sized on first use and never reallocated afterwards.
+  public: std::vector<double> values;
+
+  /// \brief Ring index of the next row to write.
+  public: size_t head{0};
+
+  /// \brief Number of rows currently in the window.
+  public: size_t count{0};
+
+  /// \brief Incrementally maintained per-channel sums, so Mean() is a
+  /// division instead of a scan.
+  public: std::vector<double> sums;
+
+  /// \brief Total number of pushed rows; used to schedule
+  /// re-summation.
+  public: uint64_t pushed{0};
+
+  /// \brief Recompute every channel's sum from the stored values with
+  /// Kahan compensation, as RollingMean does, so the incremental
+  /// add/subtract updates cannot accumulate unbounded rounding drift.
+  public: void Resum()
+  {
+    std::vector<double> comp(this->channels, 0.0);
+    std::vector<double> sumK(this->channels, 0.0);
+    for (size_t i = 0; i < this->count; ++i)
+    {
+      const size_t row =
+          (this->head + this->windowSize - this->count + i) %
+          this->windowSize;
+      const double *rowData = this->values.data() + row * this->channels;
+      for (size_t c = 0; c < this->channels; ++c)
+      {
+        const double y = rowData[c] - comp[c];
+        const double t = sumK[c] + y;
+        comp[c] = (t - sumK[c]) - y;
+        sumK[c] = t;
+      }
+    }
+    this->sums = sumK;
+  }
+};
+
+//////////////////////////////////////////////////
+RollingMeanBank::RollingMeanBank(size_t _channels, size_t _windowSize)
+  : dataPtr(new RollingMeanBankPrivate)
+{
+  if (_channels > 0)
+    this->dataPtr->channels = _channels;
+  if (_windowSize > 0)
+    this->dataPtr->windowSize = _windowSize;
+  this->dataPtr->sums.resize(this->dataPtr->channels, 0.0);
+}
+
+//////////////////////////////////////////////////
+RollingMeanBank::~RollingMeanBank()
+{
+}
+
+//////////////////////////////////////////////////
+size_t RollingMeanBank::ChannelCount() const
+{
+  return this->dataPtr->channels;
+}
+
+//////////////////////////////////////////////////
+double RollingMeanBank::Mean(size_t _channel) const
+{
+  if (this->dataPtr->count > 0 && _channel < this->dataPtr->channels)
+    return this->dataPtr->sums[_channel] / this->dataPtr->count;
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+//////////////////////////////////////////////////
+void RollingMeanBank::Means(double *_means) const
+{
+  auto &d = *this->dataPtr;
+  if (d.count == 0)
+  {
+    for (size_t c = 0; c < d.channels; ++c)
+      _means[c] = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+
+  const double scale = 1.0 / static_cast<double>(d.count);
+  for (size_t c = 0; c < d.channels; ++c)
+    _means[c] = d.sums[c] * scale;
+}
+
+//////////////////////////////////////////////////
+size_t RollingMeanBank::Count() const
+{
+  return this->dataPtr->count;
+}
+
+//////////////////////////////////////////////////
+void RollingMeanBank::Push(const double *_values)
+{
+  auto &d = *this->dataPtr;
+
+  if (d.values.empty())
+    d.values.resize(d.windowSize * d.channels, 0.0);
+
+  double *row = d.values.data() + d.head * d.channels;
+
+  // Update the incremental sums: subtract the evicted row, add the
+  // new one. Subtraction and addition stay separate operations so
+  // each channel's sum evolves exactly as RollingMean's does. Both
+  // loops walk three contiguous arrays, which vectorizes cleanly.
+  if (d.count == d.windowSize)
+  {
+    for (size_t c = 0; c < d.channels; ++c)
+    {
+      d.sums[c] -= row[c];
+      d.sums[c] += _values[c];
+    }
+  }
+  else
+  {
+    ++d.count;
+    for (size_t c = 0; c < d.channels; ++c)
+      d.sums[c] += _values[c];
+  }
+
+  std::memcpy(row, _values, d.channels * sizeof(double));
+  d.head = (d.head + 1) % d.windowSize;
+
+  // Periodically rebuild the sums to shed incremental rounding drift,
+  // on the same cadence RollingMean uses.
+  ++d.pushed;
+  if (d.pushed % (64 * static_cast<uint64_t>(d.windowSize)) == 0)
+    d.Resum();
+}
+
+//////////////////////////////////////////////////
+void RollingMeanBank::Clear()
+{
+  auto &d = *this->dataPtr;
+  d.values.clear();
+  d.head = 0;
+  d.count = 0;
+  d.pushed = 0;
+  d.sums.assign(d.channels, 0.0);
+}
+
+//////////////////////////////////////////////////
+void RollingMeanBank::SetWindowSize(size_t _windowSize)
+{
+  if (_windowSize > 0)
+  {
+    this->dataPtr->windowSize = _windowSize;
+    this->Clear();
+  }
+}
+
+//////////////////////////////////////////////////
+size_t RollingMeanBank::WindowSize() const
+{
+  return this->dataPtr->windowSize;
+}
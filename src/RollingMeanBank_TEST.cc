@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/RollingMean.hh"
+#include "ignition/math/RollingMeanBank.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(RollingMeanBankTest, RollingMeanBank)
+{
+  math::RollingMeanBank bank(4, 3);
+  EXPECT_EQ(4u, bank.ChannelCount());
+  EXPECT_EQ(3u, bank.WindowSize());
+  EXPECT_EQ(0u, bank.Count());
+  EXPECT_TRUE(std::isnan(bank.Mean(0)));
+  EXPECT_TRUE(std::isnan(bank.Mean(4)));
+
+  std::vector<double> means(4);
+  bank.Means(means.data());
+  for (size_t c = 0; c < 4; ++c)
+    EXPECT_TRUE(std::isnan(means[c]));
+
+  const double row1[4] = {1.0, 10.0, -1.0, 0.0};
+  const double row2[4] = {2.0, 20.0, -2.0, 0.0};
+  const double row3[4] = {3.0, 30.0, -3.0, 0.0};
+  const double row4[4] = {4.0, 40.0, -4.0, 0.0};
+
+  bank.Push(row1);
+  EXPECT_EQ(1u, bank.Count());
+  EXPECT_DOUBLE_EQ(1.0, bank.Mean(0));
+  EXPECT_DOUBLE_EQ(10.0, bank.Mean(1));
+
+  bank.Push(row2);
+  bank.Push(row3);
+  EXPECT_EQ(3u, bank.Count());
+  EXPECT_DOUBLE_EQ(2.0, bank.Mean(0));
+  EXPECT_DOUBLE_EQ(20.0, bank.Mean(1));
+  EXPECT_DOUBLE_EQ(-2.0, bank.Mean(2));
+  EXPECT_DOUBLE_EQ(0.0, bank.Mean(3));
+
+  // The oldest row is evicted once the window fills.
+  bank.Push(row4);
+  EXPECT_EQ(3u, bank.Count());
+  EXPECT_DOUBLE_EQ(3.0, bank.Mean(0));
+  EXPECT_DOUBLE_EQ(30.0, bank.Mean(1));
+  bank.Means(means.data());
+  EXPECT_DOUBLE_EQ(3.0, means[0]);
+  EXPECT_DOUBLE_EQ(30.0, means[1]);
+  EXPECT_DOUBLE_EQ(-3.0, means[2]);
+  EXPECT_DOUBLE_EQ(0.0, means[3]);
+
+  bank.Clear();
+  EXPECT_EQ(0u, bank.Count());
+  EXPECT_TRUE(std::isnan(bank.Mean(0)));
+
+  bank.SetWindowSize(2);
+  EXPECT_EQ(2u, bank.WindowSize());
+  bank.SetWindowSize(0);
+  EXPECT_EQ(2u, bank.WindowSize());
+
+  // A zero channel count is treated as one channel.
+  math::RollingMeanBank degenerate(0);
+  EXPECT_EQ(1u, degenerate.ChannelCount());
+}
+
+/////////////////////////////////////////////////
+TEST(RollingMeanBankTest, MatchesRollingMean)
+{
+  // Each channel of the bank reports the same mean as a standalone
+  // RollingMean fed the same sequence, including across eviction and
+  // the periodic re-summation cadence.
+  const size_t channels = 5;
+  const size_t window = 7;
+  math::RollingMeanBank bank(channels, window);
+  std::vector<std::unique_ptr<math::RollingMean>> reference;
+  for (size_t c = 0; c < channels; ++c)
+    reference.push_back(std::unique_ptr<math::RollingMean>(
+        new math::RollingMean(window)));
+
+  std::vector<double> row(channels);
+  for (int i = 0; i < 2000; ++i)
+  {
+    for (size_t c = 0; c < channels; ++c)
+    {
+      row[c] = std::sin(0.37 * i + static_cast<double>(c)) +
+          0.01 * static_cast<double>(c) * i;
+      reference[c]->Push(row[c]);
+    }
+    bank.Push(row.data());
+
+    for (size_t c = 0; c < channels; ++c)
+      EXPECT_DOUBLE_EQ(reference[c]->Mean(), bank.Mean(c)) << i << " " << c;
+  }
+  EXPECT_EQ(window, bank.Count());
+}
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/RollingMean.hh"
 
@@ -55,3 +58,66 @@ TEST(RollingMeanTest, RollingMean)
   mean.SetWindowSize(2);
   EXPECT_EQ(0u, mean.Count());
 }
+
+//////////////////////////////////////////////////
+TEST(RollingMeanTest, MinMax)
+{
+  math::RollingMean mean(3);
+  EXPECT_TRUE(std::isnan(mean.Min()));
+  EXPECT_TRUE(std::isnan(mean.Max()));
+
+  mean.Push(2.0);
+  EXPECT_DOUBLE_EQ(2.0, mean.Min());
+  EXPECT_DOUBLE_EQ(2.0, mean.Max());
+
+  mean.Push(-1.0);
+  mean.Push(5.0);
+  EXPECT_DOUBLE_EQ(-1.0, mean.Min());
+  EXPECT_DOUBLE_EQ(5.0, mean.Max());
+
+  // The 2.0 and then the -1.0 fall out of the window.
+  mean.Push(0.5);
+  EXPECT_DOUBLE_EQ(-1.0, mean.Min());
+  EXPECT_DOUBLE_EQ(5.0, mean.Max());
+  mean.Push(0.25);
+  EXPECT_DOUBLE_EQ(0.25, mean.Min());
+  EXPECT_DOUBLE_EQ(5.0, mean.Max());
+  mean.Push(0.75);
+  EXPECT_DOUBLE_EQ(0.25, mean.Min());
+  EXPECT_DOUBLE_EQ(0.75, mean.Max());
+
+  mean.Clear();
+  EXPECT_TRUE(std::isnan(mean.Min()));
+  EXPECT_TRUE(std::isnan(mean.Max()));
+}
+
+//////////////////////////////////////////////////
+TEST(RollingMeanTest, BulkPush)
+{
+  math::RollingMean bulk(4);
+  math::RollingMean oneAtATime(4);
+
+  std::vector<double> values;
+  for (int i = 0; i < 50; ++i)
+    values.push_back(std::sin(0.9 * i) * (i % 5) - 1.0);
+
+  bulk.Push(values.data(), values.size());
+  for (double value : values)
+    oneAtATime.Push(value);
+
+  EXPECT_EQ(oneAtATime.Count(), bulk.Count());
+  EXPECT_DOUBLE_EQ(oneAtATime.Mean(), bulk.Mean());
+  EXPECT_DOUBLE_EQ(oneAtATime.Min(), bulk.Min());
+  EXPECT_DOUBLE_EQ(oneAtATime.Max(), bulk.Max());
+}
+
+//////////////////////////////////////////////////
+TEST(RollingMeanTest, LongRunDrift)
+{
+  // The incremental sum is periodically rebuilt with compensated
+  // summation, so the mean stays accurate over many window turnovers.
+  math::RollingMean mean(10);
+  for (int i = 0; i < 100000; ++i)
+    mean.Push(1e9 + (i % 10));
+  EXPECT_NEAR(1e9 + 4.5, mean.Mean(), 1e-5);
+}
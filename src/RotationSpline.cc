@@ -88,6 +88,29 @@ Quaterniond RotationSpline::Interpolate(const unsigned int _fromIndex,
   return Quaterniond::Squad(_t, p, a, b, q, _useShortestPath);
 }
 
+/////////////////////////////////////////////////
+void RotationSpline::Sample(const double *_params, const size_t _count,
+    Quaterniond *_out, const bool _useShortestPath)
+{
+  const size_t numPoints = this->dataPtr->points.size();
+  if (numPoints == 0)
+  {
+    for (size_t i = 0; i < _count; ++i)
+      _out[i] = Quaterniond(INF_D, INF_D, INF_D, INF_D);
+    return;
+  }
+
+  // The point count and segment scale are loop invariants, so the
+  // per-call bounds checks of Interpolate() are hoisted out here.
+  const double scale = static_cast<double>(numPoints - 1);
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double fSeg = _params[i] * scale;
+    unsigned int segIdx = static_cast<unsigned int>(fSeg);
+    _out[i] = this->Interpolate(segIdx, fSeg - segIdx, _useShortestPath);
+  }
+}
+
 /////////////////////////////////////////////////
 void RotationSpline::RecalcTangents()
 {
@@ -119,49 +142,56 @@ void RotationSpline::RecalcTangents()
   else
     isClosed = false;
 
-  Quaterniond invp, part1, part2, preExp;
   for (i = 0; i < numPoints; ++i)
-  {
-    Quaterniond &p = this->dataPtr->points[i];
-    invp = p.Inverse();
+    this->RecalcTangent(i, isClosed);
+}
 
-    if (i == 0)
+/////////////////////////////////////////////////
+void RotationSpline::RecalcTangent(const unsigned int _index,
+                                   const bool _isClosed)
+{
+  const size_t numPoints = this->dataPtr->points.size();
+
+  Quaterniond invp, part1, part2, preExp;
+  Quaterniond &p = this->dataPtr->points[_index];
+  invp = p.Inverse();
+
+  if (_index == 0)
+  {
+    // special case start
+    part1 = (invp * this->dataPtr->points[_index+1]).Log();
+    if (_isClosed)
     {
-      // special case start
-      part1 = (invp * this->dataPtr->points[i+1]).Log();
-      if (isClosed)
-      {
-        // Use numPoints-2 since numPoints-1 == end == start == this one
-        part2 = (invp * this->dataPtr->points[numPoints-2]).Log();
-      }
-      else
-      {
-        part2 = (invp * p).Log();
-      }
+      // Use numPoints-2 since numPoints-1 == end == start == this one
+      part2 = (invp * this->dataPtr->points[numPoints-2]).Log();
     }
-    else if (i == numPoints-1)
+    else
+    {
+      part2 = (invp * p).Log();
+    }
+  }
+  else if (_index == numPoints-1)
+  {
+    // special case end
+    if (_isClosed)
     {
-      // special case end
-      if (isClosed)
-      {
-        // Wrap to [1] (not [0], this is the same as end == this one)
-        part1 = (invp * this->dataPtr->points[1]).Log();
-      }
-      else
-      {
-        part1 = (invp * p).Log();
-      }
-      part2 = (invp * this->dataPtr->points[i-1]).Log();
+      // Wrap to [1] (not [0], this is the same as end == this one)
+      part1 = (invp * this->dataPtr->points[1]).Log();
     }
     else
     {
-      part1 = (invp * this->dataPtr->points[i+1]).Log();
-      part2 = (invp * this->dataPtr->points[i-1]).Log();
+      part1 = (invp * p).Log();
     }
-
-    preExp = (part1 + part2) * -0.25;
-    this->dataPtr->tangents[i] = p * preExp.Exp();
+    part2 = (invp * this->dataPtr->points[_index-1]).Log();
   }
+  else
+  {
+    part1 = (invp * this->dataPtr->points[_index+1]).Log();
+    part2 = (invp * this->dataPtr->points[_index-1]).Log();
+  }
+
+  preExp = (part1 + part2) * -0.25;
+  this->dataPtr->tangents[_index] = p * preExp.Exp();
 }
 
 /////////////////////////////////////////////////
@@ -199,7 +229,25 @@ bool RotationSpline::UpdatePoint(const unsigned int _index,
 
   this->dataPtr->points[_index] = _value;
   if (this->dataPtr->autoCalc)
-    this->RecalcTangents();
+  {
+    const size_t numPoints = this->dataPtr->points.size();
+
+    // A tangent depends only on the point and its two neighbours, so
+    // moving an interior point of an open spline dirties just the
+    // three tangents around it. Endpoint updates can open or close the
+    // spline and couple the two ends, so they take the full path.
+    if (numPoints >= 3 && _index > 0 && _index < numPoints - 1 &&
+        this->dataPtr->tangents.size() == numPoints &&
+        this->dataPtr->points[0] != this->dataPtr->points[numPoints-1])
+    {
+      for (unsigned int i = _index - 1; i <= _index + 1; ++i)
+        this->RecalcTangent(i, false);
+    }
+    else
+    {
+      this->RecalcTangents();
+    }
+  }
 
   return true;
 }
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Vector3.hh"
 #include "ignition/math/Quaternion.hh"
@@ -97,3 +100,84 @@ TEST(RotationSplineTest, RecalcTangents)
   EXPECT_EQ(s.Interpolate(1, 0.5),
       math::Quaterniond(0.987225, 0.077057, 0.11624, 0.077057));
 }
+
+/////////////////////////////////////////////////
+TEST(RotationSplineTest, Sample)
+{
+  math::RotationSpline s;
+  s.AddPoint(math::Quaterniond(0, 0, 0));
+  s.AddPoint(math::Quaterniond(0.1, 0.4, 0));
+  s.AddPoint(math::Quaterniond(-0.2, 0.1, 0.5));
+  s.AddPoint(math::Quaterniond(0, 0.3, -0.3));
+
+  std::vector<double> params;
+  for (int i = 0; i <= 60; ++i)
+    params.push_back(i / 60.0);
+
+  std::vector<math::Quaterniond> samples(params.size());
+  s.Sample(params.data(), params.size(), samples.data());
+  for (size_t i = 0; i < params.size(); ++i)
+    EXPECT_EQ(s.Interpolate(params[i]), samples[i]) << "t " << params[i];
+
+  // An empty spline yields infinities.
+  math::RotationSpline empty;
+  math::Quaterniond out;
+  const double t = 0.5;
+  empty.Sample(&t, 1, &out);
+  EXPECT_FALSE(std::isfinite(out.W()));
+}
+
+/////////////////////////////////////////////////
+TEST(RotationSplineTest, UpdatePointLocalized)
+{
+  // Interior updates recompute only the neighbouring tangents; the
+  // result must match a spline rebuilt from scratch with the same
+  // points.
+  std::vector<math::Quaterniond> points;
+  for (int i = 0; i < 8; ++i)
+    points.push_back(math::Quaterniond(0.1 * i, -0.05 * i, 0.2 * i));
+
+  math::RotationSpline edited;
+  for (const auto &point : points)
+    edited.AddPoint(point);
+
+  for (unsigned int index : {1u, 3u, 6u, 0u, 7u})
+  {
+    points[index] = math::Quaterniond(
+        0.3 + 0.01 * index, 0.1 * index, -0.2);
+    EXPECT_TRUE(edited.UpdatePoint(index, points[index]));
+
+    math::RotationSpline rebuilt;
+    for (const auto &point : points)
+      rebuilt.AddPoint(point);
+
+    for (int i = 0; i <= 40; ++i)
+    {
+      const double t = i / 40.0;
+      EXPECT_EQ(edited.Interpolate(t), rebuilt.Interpolate(t))
+          << "index " << index << " t " << t;
+    }
+  }
+
+  // Closed splines couple the two ends and fall back to the full
+  // recompute.
+  math::RotationSpline closed;
+  closed.AddPoint(math::Quaterniond(0, 0, 0));
+  closed.AddPoint(math::Quaterniond(0.2, 0.3, 0.1));
+  closed.AddPoint(math::Quaterniond(-0.1, 0.2, 0.4));
+  closed.AddPoint(math::Quaterniond(0, 0, 0));
+  EXPECT_TRUE(closed.UpdatePoint(1, math::Quaterniond(0.4, 0.1, 0.2)));
+
+  math::RotationSpline closedRebuilt;
+  closedRebuilt.AddPoint(math::Quaterniond(0, 0, 0));
+  closedRebuilt.AddPoint(math::Quaterniond(0.4, 0.1, 0.2));
+  closedRebuilt.AddPoint(math::Quaterniond(-0.1, 0.2, 0.4));
+  closedRebuilt.AddPoint(math::Quaterniond(0, 0, 0));
+
+  for (int i = 0; i <= 40; ++i)
+  {
+    const double t = i / 40.0;
+    EXPECT_EQ(closed.Interpolate(t), closedRebuilt.Interpolate(t)) << t;
+  }
+}
+
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "ignition/math/ScopedFlushDenormals.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(ScopedFlushDenormalsTest, FlushesInScopeOnly)
+{
+  // volatile keeps the compiler from folding the arithmetic at build
+  // time, where the floating point mode would not apply.
+  volatile double denormal = 1e-320;
+  volatile double half = 0.5;
+
+  // With IEEE gradual underflow the product is a smaller denormal.
+  const double gradual = denormal * half;
+  EXPECT_GT(gradual, 0.0);
+
+  {
+    math::ScopedFlushDenormals flush;
+    const double flushed = denormal * half;
+    if (math::ScopedFlushDenormals::Supported())
+      EXPECT_DOUBLE_EQ(0.0, flushed);
+    else
+      EXPECT_GT(flushed, 0.0);
+  }
+
+  // The previous environment is restored when the guard leaves scope.
+  const double restored = denormal * half;
+  EXPECT_GT(restored, 0.0);
+}
+
+/////////////////////////////////////////////////
+TEST(ScopedFlushDenormalsTest, NestedGuards)
+{
+  volatile double denormal = 1e-320;
+  volatile double one = 1.0;
+
+  {
+    math::ScopedFlushDenormals outer;
+    {
+      math::ScopedFlushDenormals inner;
+    }
+
+    // The inner guard restored the outer guard's mode, not the
+    // default one.
+    const double product = denormal * one;
+    if (math::ScopedFlushDenormals::Supported())
+    {
+      EXPECT_DOUBLE_EQ(0.0, product);
+    }
+  }
+
+  const double restored = denormal * one;
+  EXPECT_GT(restored, 0.0);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#define IGN_MATH_PROFILER_ENABLE
+#include "ignition/math/ScopedTimer.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(ScopedTimerTest, Accumulation)
+{
+  TimerRegistry::Instance().Reset();
+
+  for (int i = 0; i < 10; ++i)
+  {
+    IGN_MATH_SCOPED_TIMER("test/accumulation");
+  }
+
+  auto totals = TimerRegistry::Instance().Totals();
+  ASSERT_EQ(1u, totals.count("test/accumulation"));
+  EXPECT_EQ(10u, totals["test/accumulation"].calls);
+
+  // Two timers can share a scope under distinct labels.
+  {
+    IGN_MATH_SCOPED_TIMER("test/outer");
+    IGN_MATH_SCOPED_TIMER("test/inner");
+  }
+  totals = TimerRegistry::Instance().Totals();
+  EXPECT_EQ(1u, totals["test/outer"].calls);
+  EXPECT_EQ(1u, totals["test/inner"].calls);
+
+  // The report mentions every label with its call count.
+  std::ostringstream report;
+  TimerRegistry::Instance().Report(report);
+  EXPECT_NE(std::string::npos,
+      report.str().find("test/accumulation: calls 10"));
+  EXPECT_NE(std::string::npos, report.str().find("test/outer"));
+
+  // Reset zeroes the counters but keeps the labels usable.
+  TimerRegistry::Instance().Reset();
+  totals = TimerRegistry::Instance().Totals();
+  EXPECT_EQ(0u, totals["test/accumulation"].calls);
+  EXPECT_EQ(0u, totals["test/accumulation"].ticks);
+}
+
+/////////////////////////////////////////////////
+TEST(ScopedTimerTest, TicksAdvance)
+{
+  TimerStats stats;
+  {
+    ScopedTimer timer(stats);
+    // Burn a little time so the measurement cannot round to zero.
+    volatile double sink = 0.0;
+    for (int i = 0; i < 100000; ++i)
+      sink = sink + 1.0;
+  }
+  EXPECT_EQ(1u, stats.calls);
+  EXPECT_LT(0u, stats.ticks);
+
+  const uint64_t before = TimerTicks();
+  const uint64_t after = TimerTicks();
+  EXPECT_LE(before, after);
+}
+
+/////////////////////////////////////////////////
+TEST(ScopedTimerTest, PerThreadAggregation)
+{
+  TimerRegistry::Instance().Reset();
+
+  // Each thread accumulates locally; the totals see all of them.
+  const unsigned int numThreads = 4;
+  const int rounds = 500;
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < numThreads; ++t)
+  {
+    threads.push_back(std::thread(
+        []()
+        {
+          for (int i = 0; i < rounds; ++i)
+          {
+            IGN_MATH_SCOPED_TIMER("test/threads");
+          }
+        }));
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  auto totals = TimerRegistry::Instance().Totals();
+  EXPECT_EQ(static_cast<uint64_t>(numThreads) * rounds,
+      totals["test/threads"].calls);
+}
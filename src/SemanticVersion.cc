@@ -15,7 +15,10 @@
  *
 */
 
+#include <algorithm>
+#include <cstdint>
 #include <sstream>
+#include <vector>
 
 #include "ignition/math/SemanticVersion.hh"
 
@@ -48,6 +51,52 @@ namespace ignition
       /// appending a plus sign and a series of dot separated identifiers
       /// immediately following the patch or pre-release version
       public: std::string build = "";
+
+      /// \brief One prerelease identifier in canonical form: either a
+      /// parsed number or the raw text.
+      public: struct PrereleaseId
+      {
+        /// \brief True when the identifier is purely numeric.
+        bool numeric = false;
+
+        /// \brief The parsed value of a numeric identifier.
+        uint64_t number = 0;
+
+        /// \brief The text of a non-numeric identifier.
+        std::string text;
+      };
+
+      /// \brief The prerelease identifiers, split at the dots once at
+      /// construction so comparisons never re-tokenize the string.
+      public: std::vector<PrereleaseId> prereleaseIds;
+
+      /// \brief Rebuild prereleaseIds from the prerelease string.
+      public: void CanonicalizePrerelease()
+      {
+        this->prereleaseIds.clear();
+        size_t start = 0;
+        while (start <= this->prerelease.size())
+        {
+          size_t end = this->prerelease.find('.', start);
+          if (end == std::string::npos)
+            end = this->prerelease.size();
+          const std::string token =
+              this->prerelease.substr(start, end - start);
+          if (!token.empty())
+          {
+            PrereleaseId id;
+            // Up to 19 digits fit a uint64_t without overflow.
+            id.numeric = token.size() <= 19 &&
+                token.find_first_not_of("0123456789") == std::string::npos;
+            if (id.numeric)
+              id.number = std::stoull(token);
+            else
+              id.text = token;
+            this->prereleaseIds.push_back(id);
+          }
+          start = end + 1;
+        }
+      }
     };
     }
   }
@@ -79,6 +128,7 @@ SemanticVersion::SemanticVersion(const unsigned int _major,
   this->dataPtr->patch = _patch;
   this->dataPtr->prerelease = _prerelease;
   this->dataPtr->build = _build;
+  this->dataPtr->CanonicalizePrerelease();
 }
 
 /////////////////////////////////////////////////
@@ -147,14 +197,43 @@ bool SemanticVersion::operator<(const SemanticVersion &_other) const
     return false;
   }
 
-  // If this version has prelrease and the _other doesn't, then this
-  // version is lower. We don't compare the prerelease strings because
-  // they can contain any alphanumeric values.
-  if (!this->dataPtr->prerelease.empty() && _other.dataPtr->prerelease.empty())
+  // A version with a prerelease has lower precedence than its
+  // release; two prereleases compare identifier by identifier over
+  // the canonical forms split at construction, so no strings are
+  // tokenized here.
+  const auto &lhs = this->dataPtr->prereleaseIds;
+  const auto &rhs = _other.dataPtr->prereleaseIds;
+  if (!lhs.empty() && rhs.empty())
     return true;
+  if (lhs.empty() && !rhs.empty())
+    return false;
+
+  const size_t common = std::min(lhs.size(), rhs.size());
+  for (size_t i = 0; i < common; ++i)
+  {
+    // Numeric identifiers have lower precedence than alphanumeric
+    // ones; within a kind the comparison is numeric or lexical.
+    if (lhs[i].numeric != rhs[i].numeric)
+      return lhs[i].numeric;
+    if (lhs[i].numeric)
+    {
+      if (lhs[i].number != rhs[i].number)
+        return lhs[i].number < rhs[i].number;
+    }
+    else if (lhs[i].text != rhs[i].text)
+    {
+      return lhs[i].text < rhs[i].text;
+    }
+  }
 
-  // _other is equal
-  return false;
+  // A larger set of equal leading identifiers has higher precedence.
+  return lhs.size() < rhs.size();
+}
+
+/////////////////////////////////////////////////
+void SemanticVersion::Sort(SemanticVersion *_versions, const size_t _count)
+{
+  std::sort(_versions, _versions + _count);
 }
 
 /////////////////////////////////////////////////
@@ -293,5 +372,7 @@ bool SemanticVersion::Parse(const std::string &_versionStr)
         break;
     };
   }
+
+  this->dataPtr->CanonicalizePrerelease();
   return true;
 }
@@ -208,10 +208,69 @@ TEST(SemVerTest, Constructor)
   EXPECT_TRUE(a.Build().empty());
 }
 
+/////////////////////////////////////////////////
+TEST(SemVerTest, PrereleasePrecedence)
+{
+  // The precedence chain from semver.org, section 11.
+  SemanticVersion versions[] =
+  {
+    SemanticVersion("1.0.0-alpha"),
+    SemanticVersion("1.0.0-alpha.1"),
+    SemanticVersion("1.0.0-alpha.beta"),
+    SemanticVersion("1.0.0-beta"),
+    SemanticVersion("1.0.0-beta.2"),
+    SemanticVersion("1.0.0-beta.11"),
+    SemanticVersion("1.0.0-rc.1"),
+    SemanticVersion("1.0.0"),
+  };
+  const size_t count = sizeof(versions) / sizeof(versions[0]);
+
+  for (size_t i = 0; i + 1 < count; ++i)
+  {
+    EXPECT_TRUE(versions[i] < versions[i + 1])
+        << versions[i].Version() << " < " << versions[i + 1].Version();
+    EXPECT_FALSE(versions[i + 1] < versions[i]);
+  }
+
+  // Identical prereleases are not ordered.
+  EXPECT_FALSE(SemanticVersion("1.0.0-rc.1") <
+      SemanticVersion("1.0.0-rc.1"));
+}
+
+/////////////////////////////////////////////////
+TEST(SemVerTest, Sort)
+{
+  SemanticVersion versions[] =
+  {
+    SemanticVersion("2.0.0"),
+    SemanticVersion("1.0.0-rc.1"),
+    SemanticVersion("1.0.0"),
+    SemanticVersion("1.2.3"),
+    SemanticVersion("1.0.0-alpha"),
+    SemanticVersion("0.9.12"),
+    SemanticVersion("1.0.0-beta.11"),
+  };
+  const size_t count = sizeof(versions) / sizeof(versions[0]);
+
+  SemanticVersion::Sort(versions, count);
+
+  EXPECT_EQ(versions[0].Version(), "0.9.12");
+  EXPECT_EQ(versions[1].Version(), "1.0.0-alpha");
+  EXPECT_EQ(versions[2].Version(), "1.0.0-beta.11");
+  EXPECT_EQ(versions[3].Version(), "1.0.0-rc.1");
+  EXPECT_EQ(versions[4].Version(), "1.0.0");
+  EXPECT_EQ(versions[5].Version(), "1.2.3");
+  EXPECT_EQ(versions[6].Version(), "2.0.0");
+
+  // Degenerate inputs are harmless.
+  SemanticVersion::Sort(versions, 0);
+  SemanticVersion::Sort(versions, 1);
+  EXPECT_EQ(versions[0].Version(), "0.9.12");
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
-
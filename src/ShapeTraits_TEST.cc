@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/ShapeTraits.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(ShapeTraitsTest, VolumeMatchesShapes)
+{
+  // The traits formulas agree with the shape classes' Volume().
+  const math::Boxd box(1.5, 2.0, 0.5);
+  const math::Sphered sphere(0.75);
+  const math::Cylinderd cylinder(2.0, 0.5);
+  const math::Capsuled capsule(1.0, 0.25);
+
+  double params[3];
+
+  math::ShapeTraits<math::Boxd>::Parameters(box, params);
+  EXPECT_DOUBLE_EQ(box.Volume(),
+      math::ShapeTraits<math::Boxd>::Volume(params));
+
+  math::ShapeTraits<math::Sphered>::Parameters(sphere, params);
+  EXPECT_NEAR(sphere.Volume(),
+      math::ShapeTraits<math::Sphered>::Volume(params), 1e-15);
+
+  math::ShapeTraits<math::Cylinderd>::Parameters(cylinder, params);
+  EXPECT_NEAR(cylinder.Volume(),
+      math::ShapeTraits<math::Cylinderd>::Volume(params), 1e-15);
+
+  math::ShapeTraits<math::Capsuled>::Parameters(capsule, params);
+  EXPECT_NEAR(capsule.Volume(),
+      math::ShapeTraits<math::Capsuled>::Volume(params), 1e-15);
+
+  // The formulas are usable at compile time.
+  constexpr double boxParams[3] = {2.0, 3.0, 4.0};
+  static_assert(
+      math::ShapeTraits<math::Boxd>::Volume(boxParams) == 24.0,
+      "constexpr box volume");
+}
+
+/////////////////////////////////////////////////
+TEST(ShapeTraitsTest, ShapeSoAQueries)
+{
+  math::ShapeSoA<math::Capsuled> soa;
+  std::vector<math::Capsuled> capsules;
+  for (int i = 1; i <= 50; ++i)
+  {
+    capsules.push_back(math::Capsuled(0.1 * i, 0.02 * i));
+    soa.PushBack(capsules.back());
+  }
+  ASSERT_EQ(capsules.size(), soa.Size());
+
+  std::vector<double> volumes(soa.Size());
+  soa.VolumeBatch(volumes.data());
+  for (size_t i = 0; i < capsules.size(); ++i)
+  {
+    EXPECT_NEAR(capsules[i].Volume(), volumes[i], 1e-12) << i;
+    EXPECT_DOUBLE_EQ(volumes[i], soa.Volume(i)) << i;
+  }
+
+  std::vector<double> masses(soa.Size(), 2.0);
+  masses[3] = -1.0;
+  std::vector<double> densities(soa.Size());
+  soa.DensityFromMassBatch(masses.data(), densities.data());
+  for (size_t i = 0; i < capsules.size(); ++i)
+  {
+    if (i == 3)
+      EXPECT_DOUBLE_EQ(-1.0, densities[i]);
+    else
+    {
+      const double expected = capsules[i].DensityFromMass(masses[i]);
+      EXPECT_NEAR(expected, densities[i], 1e-9 * expected) << i;
+    }
+  }
+
+  std::vector<math::Vector3d> mins(soa.Size()), maxs(soa.Size());
+  soa.BoundsBatch(mins.data(), maxs.data());
+  for (size_t i = 0; i < capsules.size(); ++i)
+  {
+    const double r = capsules[i].Radius();
+    const double halfZ = capsules[i].Length() / 2 + r;
+    EXPECT_EQ(math::Vector3d(-r, -r, -halfZ), mins[i]) << i;
+    EXPECT_EQ(math::Vector3d(r, r, halfZ), maxs[i]) << i;
+  }
+
+  soa.Clear();
+  EXPECT_EQ(0u, soa.Size());
+}
+
+/////////////////////////////////////////////////
+TEST(ShapeTraitsTest, Bounds)
+{
+  double params[3] = {2.0, 4.0, 6.0};
+  math::Vector3d min, max;
+
+  math::ShapeTraits<math::Boxd>::Bounds(params, min, max);
+  EXPECT_EQ(math::Vector3d(-1, -2, -3), min);
+  EXPECT_EQ(math::Vector3d(1, 2, 3), max);
+
+  params[0] = 0.5;
+  math::ShapeTraits<math::Sphered>::Bounds(params, min, max);
+  EXPECT_EQ(math::Vector3d(-0.5, -0.5, -0.5), min);
+  EXPECT_EQ(math::Vector3d(0.5, 0.5, 0.5), max);
+
+  // Cylinder and capsule pack {length, radius}.
+  params[0] = 2.0;
+  params[1] = 0.5;
+  math::ShapeTraits<math::Cylinderd>::Bounds(params, min, max);
+  EXPECT_EQ(math::Vector3d(-0.5, -0.5, -1.0), min);
+  EXPECT_EQ(math::Vector3d(0.5, 0.5, 1.0), max);
+
+  math::ShapeTraits<math::Capsuled>::Bounds(params, min, max);
+  EXPECT_EQ(math::Vector3d(-0.5, -0.5, -1.5), min);
+  EXPECT_EQ(math::Vector3d(0.5, 0.5, 1.5), max);
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/SignalPipeline.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(SignalPipelineTest, MatchesTwoPass)
+{
+  // A noisy channel.
+  std::vector<double> samples;
+  for (auto i = 0; i < 500; ++i)
+    samples.push_back(std::sin(0.05 * i) + 0.1 * ((i * 37) % 11 - 5));
+
+  // The fused pipeline: window-4 filter, keep every 3rd filtered
+  // value, accumulate mean/min/max.
+  math::SignalPipeline<> pipeline(3);
+  EXPECT_EQ(pipeline.Decimation(), 3u);
+  EXPECT_TRUE(pipeline.Stats().InsertStatistics("mean,min,max"));
+  pipeline.Process(samples.data(), samples.size());
+
+  // The two-pass reference: filter into an intermediate buffer, then
+  // feed the kept values to a separate accumulator.
+  math::FixedMovingWindowFilter<double> filter;
+  std::vector<double> intermediate;
+  for (auto i = 0u; i < samples.size(); ++i)
+  {
+    filter.Update(samples[i]);
+    if ((i + 1) % 3 == 0)
+      intermediate.push_back(filter.Value());
+  }
+  math::SignalStats reference;
+  EXPECT_TRUE(reference.InsertStatistics("mean,min,max"));
+  for (auto const &value : intermediate)
+    reference.InsertData(value);
+
+  EXPECT_EQ(pipeline.Stats().Count(), reference.Count());
+  auto fused = pipeline.Stats().Map();
+  auto twoPass = reference.Map();
+  ASSERT_EQ(fused.size(), twoPass.size());
+  for (auto const &stat : twoPass)
+    EXPECT_DOUBLE_EQ(fused.at(stat.first), stat.second) << stat.first;
+
+  // Feeding the same buffer in chunks continues the stream, as a
+  // telemetry plane does tick by tick.
+  math::SignalPipeline<> chunked(3);
+  EXPECT_TRUE(chunked.Stats().InsertStatistics("mean,min,max"));
+  for (auto i = 0u; i < samples.size(); i += 100)
+    chunked.Process(samples.data() + i, 100);
+  EXPECT_DOUBLE_EQ(chunked.Stats().Map().at("mean"), fused.at("mean"));
+
+  // Reset forgets every stage.
+  pipeline.Reset();
+  EXPECT_EQ(pipeline.Stats().Count(), 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(SignalPipelineTest, Configuration)
+{
+  // Decimation 1 inserts every filtered sample; zero is treated as 1.
+  math::SignalPipeline<> dense(0);
+  EXPECT_EQ(dense.Decimation(), 1u);
+  EXPECT_TRUE(dense.Stats().InsertStatistic("mean"));
+  const double flat[8] = {2, 2, 2, 2, 2, 2, 2, 2};
+  dense.Process(flat, 8);
+  EXPECT_EQ(dense.Stats().Count(), 8u);
+  EXPECT_DOUBLE_EQ(dense.Stats().Map().at("mean"), 2.0);
+
+  // SetDecimation restarts the phase but keeps the statistics.
+  dense.SetDecimation(4);
+  dense.Process(flat, 8);
+  EXPECT_EQ(dense.Stats().Count(), 10u);
+
+  // A wider fixed window plugs in through the template parameter.
+  math::SignalPipeline<math::FixedMovingWindowFilter<double, 8>> wide;
+  EXPECT_TRUE(wide.Stats().InsertStatistic("mean"));
+  wide.Process(flat, 8);
+  EXPECT_DOUBLE_EQ(wide.Filter().Value(), 2.0);
+}
+
+/////////////////////////////////////////////////
+TEST(SignalPipelineTest, Bank)
+{
+  // Three channels with per-channel decimation.
+  math::SignalPipelineBank<> bank(3, 1);
+  EXPECT_EQ(bank.ChannelCount(), 3u);
+  bank.Channel(2).SetDecimation(2);
+  for (auto c = 0u; c < bank.ChannelCount(); ++c)
+    EXPECT_TRUE(bank.Channel(c).Stats().InsertStatistic("mean"));
+
+  const double ones[6] = {1, 1, 1, 1, 1, 1};
+  const double twos[6] = {2, 2, 2, 2, 2, 2};
+  bank.Process(0, ones, 6);
+  bank.Process(1, twos, 6);
+  bank.Process(2, twos, 6);
+
+  EXPECT_EQ(bank.Channel(0).Stats().Count(), 6u);
+  EXPECT_DOUBLE_EQ(bank.Channel(0).Stats().Map().at("mean"), 1.0);
+  EXPECT_DOUBLE_EQ(bank.Channel(1).Stats().Map().at("mean"), 2.0);
+  EXPECT_EQ(bank.Channel(2).Stats().Count(), 3u);
+
+  bank.Reset();
+  EXPECT_EQ(bank.Channel(1).Stats().Count(), 0u);
+
+  // A zero-channel bank still holds one channel.
+  math::SignalPipelineBank<> tiny(0);
+  EXPECT_EQ(tiny.ChannelCount(), 1u);
+}
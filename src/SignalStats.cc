@@ -14,8 +14,14 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 #include <ignition/math/SignalStats.hh>
 #include "SignalStatsPrivate.hh"
 
@@ -55,6 +61,13 @@ void SignalStatistic::Reset()
   this->dataPtr->count = 0;
 }
 
+//////////////////////////////////////////////////
+void SignalStatistic::InsertData(const double *_data, size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    this->InsertData(_data[i]);
+}
+
 //////////////////////////////////////////////////
 double SignalMaximum::Value() const
 {
@@ -77,6 +90,22 @@ void SignalMaximum::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+void SignalMaximum::InsertData(const double *_data, size_t _count)
+{
+  if (_count == 0)
+    return;
+
+  double max = this->dataPtr->count == 0 ? _data[0] : this->dataPtr->data;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (_data[i] > max)
+      max = _data[i];
+  }
+  this->dataPtr->data = max;
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
 //////////////////////////////////////////////////
 double SignalMean::Value() const
 {
@@ -100,6 +129,16 @@ void SignalMean::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+void SignalMean::InsertData(const double *_data, size_t _count)
+{
+  double sum = 0.0;
+  for (size_t i = 0; i < _count; ++i)
+    sum += _data[i];
+  this->dataPtr->data += sum;
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
 //////////////////////////////////////////////////
 double SignalMinimum::Value() const
 {
@@ -122,6 +161,22 @@ void SignalMinimum::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+void SignalMinimum::InsertData(const double *_data, size_t _count)
+{
+  if (_count == 0)
+    return;
+
+  double min = this->dataPtr->count == 0 ? _data[0] : this->dataPtr->data;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (_data[i] < min)
+      min = _data[i];
+  }
+  this->dataPtr->data = min;
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
 //////////////////////////////////////////////////
 double SignalRootMeanSquare::Value() const
 {
@@ -145,6 +200,29 @@ void SignalRootMeanSquare::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+void SignalRootMeanSquare::InsertData(const double *_data, size_t _count)
+{
+  // Four independent partial sums break the dependency chain, so the
+  // loop runs at one vector multiply-add per iteration; the division
+  // and square root stay deferred to Value().
+  double sumSquares[4] = {0.0, 0.0, 0.0, 0.0};
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    sumSquares[0] += _data[i] * _data[i];
+    sumSquares[1] += _data[i + 1] * _data[i + 1];
+    sumSquares[2] += _data[i + 2] * _data[i + 2];
+    sumSquares[3] += _data[i + 3] * _data[i + 3];
+  }
+  for (; i < _count; ++i)
+    sumSquares[0] += _data[i] * _data[i];
+
+  this->dataPtr->data +=
+      (sumSquares[0] + sumSquares[1]) + (sumSquares[2] + sumSquares[3]);
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
 //////////////////////////////////////////////////
 double SignalMaxAbsoluteValue::Value() const
 {
@@ -168,6 +246,20 @@ void SignalMaxAbsoluteValue::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+void SignalMaxAbsoluteValue::InsertData(const double *_data, size_t _count)
+{
+  double maxAbs = this->dataPtr->data;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    double absData = std::abs(_data[i]);
+    if (absData > maxAbs)
+      maxAbs = absData;
+  }
+  this->dataPtr->data = maxAbs;
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
 //////////////////////////////////////////////////
 // wikipedia.org/wiki/Algorithms_for_calculating_variance#Online_algorithm
 // based on Knuth's algorithm
@@ -204,6 +296,371 @@ void SignalVariance::InsertData(const double _data)
   this->dataPtr->data += delta * (_data - this->dataPtr->extraData);
 }
 
+//////////////////////////////////////////////////
+// wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+// based on Chan et al.'s pairwise combination
+void SignalVariance::InsertData(const double *_data, size_t _count)
+{
+  if (_count == 0)
+    return;
+
+  // Knuth's per-sample update divides on every insert and chains each
+  // iteration on the previous one. Instead, accumulate the batch
+  // about a fixed pivot in four independent lanes - no divisions and
+  // no cross-iteration dependency, so the loop vectorizes - and merge
+  // the batch with the running statistics once at the end. The pivot
+  // is the running mean, keeping the squared terms small so the
+  // result matches the sequential update to rounding error.
+  const double pivot =
+      this->dataPtr->count > 0 ? this->dataPtr->extraData : _data[0];
+  double sum[4] = {0.0, 0.0, 0.0, 0.0};
+  double sumSquares[4] = {0.0, 0.0, 0.0, 0.0};
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+      const double centered = _data[i + lane] - pivot;
+      sum[lane] += centered;
+      sumSquares[lane] += centered * centered;
+    }
+  }
+  for (; i < _count; ++i)
+  {
+    const double centered = _data[i] - pivot;
+    sum[0] += centered;
+    sumSquares[0] += centered * centered;
+  }
+
+  const double batchSum = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+  const double batchSumSquares =
+      (sumSquares[0] + sumSquares[1]) + (sumSquares[2] + sumSquares[3]);
+  const double batchCount = static_cast<double>(_count);
+  const double batchMean = pivot + batchSum / batchCount;
+  const double batchM2 =
+      batchSumSquares - batchSum * batchSum / batchCount;
+
+  // Chan's combination of (count, mean, M2) pairs.
+  const double oldCount = static_cast<double>(this->dataPtr->count);
+  const double newCount = oldCount + batchCount;
+  const double delta = batchMean - this->dataPtr->extraData;
+  this->dataPtr->extraData += delta * batchCount / newCount;
+  this->dataPtr->data +=
+      batchM2 + delta * delta * oldCount * batchCount / newCount;
+  this->dataPtr->count += static_cast<unsigned int>(_count);
+}
+
+//////////////////////////////////////////////////
+SignalPercentile::SignalPercentile(const double _quantile)
+  : percentileData(new SignalPercentilePrivate)
+{
+  if (_quantile <= 0.0 || _quantile >= 1.0 || std::isnan(_quantile))
+  {
+    std::cerr << "SignalPercentile quantile ["
+              << _quantile
+              << "] must be in (0, 1), using the median."
+              << std::endl;
+  }
+  else
+  {
+    this->percentileData->quantile = _quantile;
+  }
+
+  // Build the short name once, e.g. 0.95 -> "p95".
+  std::ostringstream name;
+  name << "p" << 100.0 * this->percentileData->quantile;
+  this->percentileData->shortName = name.str();
+}
+
+//////////////////////////////////////////////////
+SignalPercentile::SignalPercentile(const SignalPercentile &_ss)
+  : SignalStatistic(_ss), percentileData(_ss.percentileData->Clone())
+{
+}
+
+//////////////////////////////////////////////////
+SignalPercentile::~SignalPercentile()
+{
+}
+
+//////////////////////////////////////////////////
+double SignalPercentile::Value() const
+{
+  const unsigned int count = this->dataPtr->count;
+  if (0 == count)
+    return 0.0;
+
+  const SignalPercentilePrivate *p = this->percentileData.get();
+  if (count < 5)
+  {
+    // The first samples are buffered; interpolate them exactly.
+    double sorted[5];
+    std::copy(p->heights, p->heights + count, sorted);
+    std::sort(sorted, sorted + count);
+    const double rank = p->quantile * (count - 1);
+    const size_t low = static_cast<size_t>(rank);
+    const size_t high = std::min<size_t>(low + 1, count - 1);
+    return sorted[low] + (rank - low) * (sorted[high] - sorted[low]);
+  }
+  return p->heights[2];
+}
+
+//////////////////////////////////////////////////
+std::string SignalPercentile::ShortName() const
+{
+  return this->percentileData->shortName;
+}
+
+//////////////////////////////////////////////////
+double SignalPercentile::Quantile() const
+{
+  return this->percentileData->quantile;
+}
+
+//////////////////////////////////////////////////
+// jain & chlamtac, "The P-square algorithm for dynamic calculation of
+// quantiles and histograms without storing observations", CACM 1985
+void SignalPercentile::InsertData(const double _data)
+{
+  SignalPercentilePrivate *p = this->percentileData.get();
+  unsigned int &count = this->dataPtr->count;
+
+  if (count < 5)
+  {
+    p->heights[count] = _data;
+    ++count;
+    if (5 == count)
+    {
+      std::sort(p->heights, p->heights + 5);
+      const double q = p->quantile;
+      for (int i = 0; i < 5; ++i)
+        p->positions[i] = i + 1;
+      p->desired[0] = 1;
+      p->desired[1] = 1 + 2 * q;
+      p->desired[2] = 1 + 4 * q;
+      p->desired[3] = 3 + 2 * q;
+      p->desired[4] = 5;
+      p->increments[0] = 0;
+      p->increments[1] = q / 2;
+      p->increments[2] = q;
+      p->increments[3] = (1 + q) / 2;
+      p->increments[4] = 1;
+    }
+    return;
+  }
+
+  // Find the marker cell containing the sample, widening the extreme
+  // markers when it falls outside.
+  int k;
+  if (_data < p->heights[0])
+  {
+    p->heights[0] = _data;
+    k = 0;
+  }
+  else if (_data >= p->heights[4])
+  {
+    p->heights[4] = _data;
+    k = 3;
+  }
+  else
+  {
+    k = 0;
+    while (k < 3 && _data >= p->heights[k + 1])
+      ++k;
+  }
+
+  for (int i = k + 1; i < 5; ++i)
+    p->positions[i] += 1;
+  for (int i = 0; i < 5; ++i)
+    p->desired[i] += p->increments[i];
+  ++count;
+
+  // Move the middle markers toward their desired positions, with a
+  // parabolic prediction when it stays between the neighbors and a
+  // linear one otherwise.
+  for (int i = 1; i <= 3; ++i)
+  {
+    const double d = p->desired[i] - p->positions[i];
+    if ((d >= 1 && p->positions[i + 1] - p->positions[i] > 1) ||
+        (d <= -1 && p->positions[i - 1] - p->positions[i] < -1))
+    {
+      const int sgn = d >= 0 ? 1 : -1;
+      const double np = p->positions[i + 1] - p->positions[i - 1];
+      const double parabolic = p->heights[i] + sgn / np *
+          ((p->positions[i] - p->positions[i - 1] + sgn) *
+           (p->heights[i + 1] - p->heights[i]) /
+           (p->positions[i + 1] - p->positions[i]) +
+           (p->positions[i + 1] - p->positions[i] - sgn) *
+           (p->heights[i] - p->heights[i - 1]) /
+           (p->positions[i] - p->positions[i - 1]));
+
+      if (p->heights[i - 1] < parabolic && parabolic < p->heights[i + 1])
+      {
+        p->heights[i] = parabolic;
+      }
+      else
+      {
+        p->heights[i] += sgn *
+            (p->heights[i + sgn] - p->heights[i]) /
+            (p->positions[i + sgn] - p->positions[i]);
+      }
+      p->positions[i] += sgn;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SignalPercentile::InsertData(const double *_data, size_t _count)
+{
+  // The marker update is inherently sequential; the loop only saves
+  // the virtual dispatch per sample.
+  for (size_t i = 0; i < _count; ++i)
+    this->SignalPercentile::InsertData(_data[i]);
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::SignalHistogram(const unsigned int _buckets)
+  : histogramData(new SignalHistogramPrivate)
+{
+  this->histogramData->buckets = std::max(2u, _buckets);
+  this->histogramData->warmup.reserve(
+      SignalHistogramPrivate::kWarmupSamples);
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::SignalHistogram(const SignalHistogram &_ss)
+  : SignalStatistic(_ss), histogramData(_ss.histogramData->Clone())
+{
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::~SignalHistogram()
+{
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Value() const
+{
+  return this->Percentile(0.5);
+}
+
+//////////////////////////////////////////////////
+std::string SignalHistogram::ShortName() const
+{
+  return "histogram";
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::InsertData(const double _data)
+{
+  SignalHistogramPrivate *h = this->histogramData.get();
+
+  if (h->counts.empty())
+  {
+    h->warmup.push_back(_data);
+    ++this->dataPtr->count;
+    if (h->warmup.size() < SignalHistogramPrivate::kWarmupSamples)
+      return;
+
+    // Fix the bucket range from the warmup samples and replay them.
+    const auto bounds =
+        std::minmax_element(h->warmup.begin(), h->warmup.end());
+    h->lower = *bounds.first;
+    double span = *bounds.second - *bounds.first;
+    if (span <= 0.0)
+      span = 1.0;
+    h->width = span / h->buckets;
+    h->counts.assign(h->buckets, 0);
+    for (const double sample : h->warmup)
+    {
+      const size_t bucket = std::min<size_t>(h->buckets - 1,
+          static_cast<size_t>((sample - h->lower) / h->width));
+      ++h->counts[bucket];
+    }
+    h->warmup.clear();
+    return;
+  }
+
+  // Out-of-range samples land in the first or last bucket.
+  size_t bucket = 0;
+  if (_data > h->lower)
+  {
+    bucket = std::min<size_t>(h->buckets - 1,
+        static_cast<size_t>((_data - h->lower) / h->width));
+  }
+  ++h->counts[bucket];
+  ++this->dataPtr->count;
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::InsertData(const double *_data, size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    this->SignalHistogram::InsertData(_data[i]);
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::Reset()
+{
+  SignalStatistic::Reset();
+  this->histogramData->warmup.clear();
+  this->histogramData->counts.clear();
+  this->histogramData->lower = 0.0;
+  this->histogramData->width = 0.0;
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Percentile(const double _quantile) const
+{
+  if (_quantile < 0.0 || _quantile > 1.0 || std::isnan(_quantile))
+  {
+    std::cerr << "SignalHistogram percentile ["
+              << _quantile
+              << "] must be in [0, 1]."
+              << std::endl;
+    return 0.0;
+  }
+
+  const SignalHistogramPrivate *h = this->histogramData.get();
+  const unsigned int count = this->dataPtr->count;
+  if (0 == count)
+    return 0.0;
+
+  if (h->counts.empty())
+  {
+    // Still in warmup: interpolate the buffered samples exactly.
+    std::vector<double> sorted(h->warmup);
+    std::sort(sorted.begin(), sorted.end());
+    const double rank = _quantile * (sorted.size() - 1);
+    const size_t low = static_cast<size_t>(rank);
+    const size_t high = std::min(low + 1, sorted.size() - 1);
+    return sorted[low] + (rank - low) * (sorted[high] - sorted[low]);
+  }
+
+  // Walk the cumulative counts and interpolate within the bucket
+  // holding the requested rank.
+  const double target = _quantile * count;
+  uint64_t cumulative = 0;
+  for (size_t b = 0; b < h->counts.size(); ++b)
+  {
+    if (cumulative + h->counts[b] >= target)
+    {
+      double fraction = 0.0;
+      if (h->counts[b] > 0)
+        fraction = (target - cumulative) / h->counts[b];
+      return h->lower + h->width * (b + fraction);
+    }
+    cumulative += h->counts[b];
+  }
+  return h->lower + h->width * h->counts.size();
+}
+
+//////////////////////////////////////////////////
+std::vector<uint64_t> SignalHistogram::Counts() const
+{
+  return this->histogramData->counts;
+}
+
 //////////////////////////////////////////////////
 SignalStats::SignalStats()
   : dataPtr(new SignalStatsPrivate)
@@ -233,21 +690,55 @@ size_t SignalStats::Count() const
 //////////////////////////////////////////////////
 std::map<std::string, double> SignalStats::Map() const
 {
+  // Seqlock read: retry while an insertion is in flight (odd counter)
+  // or completed between the two loads. The inserting thread is never
+  // blocked or slowed by readers.
   std::map<std::string, double> map;
-  for (auto const &statistic : this->dataPtr->stats)
+  uint64_t seqBefore;
+  do
   {
-    map[statistic->ShortName()] = statistic->Value();
-  }
+    do
+    {
+      seqBefore = this->dataPtr->seq.load(std::memory_order_acquire);
+    } while (seqBefore & 1);
+
+    map.clear();
+    for (auto const &statistic : this->dataPtr->stats)
+    {
+      map[statistic->ShortName()] = statistic->Value();
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while (this->dataPtr->seq.load(std::memory_order_relaxed) != seqBefore);
   return map;
 }
 
 //////////////////////////////////////////////////
 void SignalStats::InsertData(const double _data)
 {
+  this->dataPtr->seq.fetch_add(1, std::memory_order_acq_rel);
   for (auto &statistic : this->dataPtr->stats)
   {
     statistic->InsertData(_data);
   }
+  this->dataPtr->seq.fetch_add(1, std::memory_order_acq_rel);
+}
+
+//////////////////////////////////////////////////
+void SignalStats::InsertData(const double *_data, size_t _count)
+{
+  this->dataPtr->seq.fetch_add(1, std::memory_order_acq_rel);
+  for (auto &statistic : this->dataPtr->stats)
+  {
+    statistic->InsertData(_data, _count);
+  }
+  this->dataPtr->seq.fetch_add(1, std::memory_order_acq_rel);
+}
+
+//////////////////////////////////////////////////
+void SignalStats::InsertData(const std::vector<double> &_data)
+{
+  this->InsertData(_data.data(), _data.size());
 }
 
 //////////////////////////////////////////////////
@@ -291,6 +782,26 @@ bool SignalStats::InsertStatistic(const std::string &_name)
   {
     stat.reset(new SignalVariance());
   }
+  else if (_name == "histogram")
+  {
+    stat.reset(new SignalHistogram());
+  }
+  else if (_name.size() > 1 && 'p' == _name[0] &&
+      std::string::npos != _name.find_first_of("0123456789", 1) &&
+      std::string::npos == _name.find_first_not_of("0123456789.", 1))
+  {
+    // Percentile names such as "p50", "p95" or "p99.9".
+    const double percentile = std::stod(_name.substr(1));
+    if (percentile <= 0.0 || percentile >= 100.0)
+    {
+      std::cerr << "Unable to InsertStatistic ["
+                << _name
+                << "] since the percentile is out of range."
+                << std::endl;
+      return false;
+    }
+    stat.reset(new SignalPercentile(percentile / 100.0));
+  }
   else
   {
     // Unrecognized name string
@@ -357,3 +868,332 @@ SignalStats &SignalStats::operator=(const SignalStats &_s)
   this->dataPtr = _s.dataPtr->Clone();
   return *this;
 }
+
+//////////////////////////////////////////////////
+FusedSignalStats::FusedSignalStats()
+  : dataPtr(new FusedSignalStatsPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+FusedSignalStats::~FusedSignalStats()
+{
+}
+
+//////////////////////////////////////////////////
+FusedSignalStats::FusedSignalStats(const FusedSignalStats &_ss)
+  : dataPtr(new FusedSignalStatsPrivate(*_ss.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+size_t FusedSignalStats::Count() const
+{
+  return this->dataPtr->count;
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::Max() const
+{
+  return this->dataPtr->max;
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::MaxAbs() const
+{
+  return std::max(std::abs(this->dataPtr->max),
+                  std::abs(this->dataPtr->min));
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::Mean() const
+{
+  return this->dataPtr->mean;
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::Min() const
+{
+  return this->dataPtr->min;
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::RootMeanSquare() const
+{
+  if (this->dataPtr->count == 0)
+    return 0.0;
+  return sqrt(this->dataPtr->sumSquares / this->dataPtr->count);
+}
+
+//////////////////////////////////////////////////
+double FusedSignalStats::Variance() const
+{
+  if (this->dataPtr->count < 2)
+    return 0.0;
+
+  // variance = M2 / (n - 1)
+  return this->dataPtr->m2 / (this->dataPtr->count - 1);
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, double> FusedSignalStats::Map() const
+{
+  std::map<std::string, double> map;
+  map["max"] = this->Max();
+  map["maxAbs"] = this->MaxAbs();
+  map["mean"] = this->Mean();
+  map["min"] = this->Min();
+  map["rms"] = this->RootMeanSquare();
+  map["var"] = this->Variance();
+  return map;
+}
+
+//////////////////////////////////////////////////
+void FusedSignalStats::InsertData(const double _data)
+{
+  this->InsertData(&_data, 1);
+}
+
+//////////////////////////////////////////////////
+void FusedSignalStats::InsertData(const double *_data, size_t _count)
+{
+  if (_count == 0)
+    return;
+
+  // Work on locals so the loop stays register resident.
+  uint64_t count = this->dataPtr->count;
+  double mean = this->dataPtr->mean;
+  double m2 = this->dataPtr->m2;
+  double sumSquares = this->dataPtr->sumSquares;
+  double min = count > 0 ? this->dataPtr->min : _data[0];
+  double max = count > 0 ? this->dataPtr->max : _data[0];
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double x = _data[i];
+
+    // Welford update, shared by the mean and variance.
+    ++count;
+    const double delta = x - mean;
+    mean += delta / count;
+    m2 += delta * (x - mean);
+
+    sumSquares += x * x;
+
+    min = x < min ? x : min;
+    max = x > max ? x : max;
+  }
+
+  this->dataPtr->count = count;
+  this->dataPtr->mean = mean;
+  this->dataPtr->m2 = m2;
+  this->dataPtr->sumSquares = sumSquares;
+  this->dataPtr->min = min;
+  this->dataPtr->max = max;
+}
+
+//////////////////////////////////////////////////
+void FusedSignalStats::Reset()
+{
+  *this->dataPtr = FusedSignalStatsPrivate();
+}
+
+//////////////////////////////////////////////////
+FusedSignalStats &FusedSignalStats::operator=(const FusedSignalStats &_s)
+{
+  *this->dataPtr = *_s.dataPtr;
+  return *this;
+}
+
+//////////////////////////////////////////////////
+WindowedSignalStats::WindowedSignalStats(const double _window,
+    const unsigned int _buckets)
+  : dataPtr(new WindowedSignalStatsPrivate)
+{
+  this->dataPtr->window = _window > 0.0 ? _window : 1.0;
+  const unsigned int buckets = _buckets < 2 ? 2 : _buckets;
+  this->dataPtr->bucketWidth = this->dataPtr->window / buckets;
+  this->dataPtr->buckets.resize(buckets);
+}
+
+//////////////////////////////////////////////////
+WindowedSignalStats::~WindowedSignalStats()
+{
+}
+
+//////////////////////////////////////////////////
+WindowedSignalStats::WindowedSignalStats(const WindowedSignalStats &_ss)
+  : dataPtr(new WindowedSignalStatsPrivate(*_ss.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::Window() const
+{
+  return this->dataPtr->window;
+}
+
+//////////////////////////////////////////////////
+unsigned int WindowedSignalStats::BucketCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->buckets.size());
+}
+
+//////////////////////////////////////////////////
+size_t WindowedSignalStats::Count() const
+{
+  uint64_t count = 0;
+  for (const auto &bucket : this->dataPtr->buckets)
+    count += bucket.count;
+  return static_cast<size_t>(count);
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::Max() const
+{
+  return this->Map()["max"];
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::Mean() const
+{
+  return this->Map()["mean"];
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::Min() const
+{
+  return this->Map()["min"];
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::RootMeanSquare() const
+{
+  return this->Map()["rms"];
+}
+
+//////////////////////////////////////////////////
+double WindowedSignalStats::Variance() const
+{
+  return this->Map()["var"];
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, double> WindowedSignalStats::Map() const
+{
+  // Merge the live buckets with Chan's pairwise update, the parallel
+  // form of the Welford recurrence each bucket was built with.
+  uint64_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+  for (const auto &bucket : this->dataPtr->buckets)
+  {
+    if (bucket.count == 0)
+      continue;
+    if (count == 0)
+    {
+      count = bucket.count;
+      mean = bucket.mean;
+      m2 = bucket.m2;
+      min = bucket.min;
+      max = bucket.max;
+      continue;
+    }
+    const double delta = bucket.mean - mean;
+    const uint64_t merged = count + bucket.count;
+    mean += delta * static_cast<double>(bucket.count) / merged;
+    m2 += bucket.m2 + delta * delta *
+        static_cast<double>(count) *
+        static_cast<double>(bucket.count) / merged;
+    count = merged;
+    min = bucket.min < min ? bucket.min : min;
+    max = bucket.max > max ? bucket.max : max;
+  }
+
+  std::map<std::string, double> result;
+  result["max"] = max;
+  result["mean"] = mean;
+  result["min"] = min;
+  result["rms"] = count == 0 ? 0.0 :
+      sqrt(m2 / count + mean * mean);
+  result["var"] = count < 2 ? 0.0 : m2 / (count - 1);
+  return result;
+}
+
+//////////////////////////////////////////////////
+void WindowedSignalStats::InsertData(const double _time, const double _data)
+{
+  auto &d = *this->dataPtr;
+  const auto buckets = static_cast<int64_t>(d.buckets.size());
+  int64_t index = static_cast<int64_t>(floor(_time / d.bucketWidth));
+
+  if (!d.started)
+  {
+    d.currentIndex = index;
+    d.started = true;
+  }
+  else if (index > d.currentIndex)
+  {
+    // Slide the ring: zero every bucket whose time span expired. A
+    // jump of a full window or more empties the whole ring.
+    const int64_t steps = index - d.currentIndex;
+    if (steps >= buckets)
+    {
+      for (auto &bucket : d.buckets)
+        bucket = WindowedSignalStatsPrivate::Bucket();
+    }
+    else
+    {
+      for (int64_t s = 1; s <= steps; ++s)
+      {
+        // The double modulo keeps the slot non-negative for the
+        // negative indices produced by negative sample times.
+        d.buckets[static_cast<size_t>(
+            (((d.currentIndex + s) % buckets) + buckets) % buckets)] =
+            WindowedSignalStatsPrivate::Bucket();
+      }
+    }
+    d.currentIndex = index;
+  }
+  else
+  {
+    // Late samples land in the current bucket.
+    index = d.currentIndex;
+  }
+
+  auto &bucket = d.buckets[static_cast<size_t>(
+      (((index % buckets) + buckets) % buckets))];
+  if (bucket.count == 0)
+  {
+    bucket.min = _data;
+    bucket.max = _data;
+  }
+  else
+  {
+    bucket.min = _data < bucket.min ? _data : bucket.min;
+    bucket.max = _data > bucket.max ? _data : bucket.max;
+  }
+  ++bucket.count;
+  const double delta = _data - bucket.mean;
+  bucket.mean += delta / bucket.count;
+  bucket.m2 += delta * (_data - bucket.mean);
+}
+
+//////////////////////////////////////////////////
+void WindowedSignalStats::Reset()
+{
+  for (auto &bucket : this->dataPtr->buckets)
+    bucket = WindowedSignalStatsPrivate::Bucket();
+  this->dataPtr->currentIndex = 0;
+  this->dataPtr->started = false;
+}
+
+//////////////////////////////////////////////////
+WindowedSignalStats &WindowedSignalStats::operator=(
+    const WindowedSignalStats &_s)
+{
+  *this->dataPtr = *_s.dataPtr;
+  return *this;
+}
@@ -17,8 +17,13 @@
 #ifndef IGNITION_MATH_SIGNALSTATSPRIVATE_HH_
 #define IGNITION_MATH_SIGNALSTATSPRIVATE_HH_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
+#include <ignition/math/MemoryPool.hh>
 #include <ignition/math/config.hh>
 
 namespace ignition
@@ -50,6 +55,68 @@ namespace ignition
       }
     };
 
+    /// \brief Private data class for the SignalPercentile class,
+    /// holding the five P-square markers.
+    class SignalPercentilePrivate
+    {
+      /// \brief The tracked quantile, in (0, 1).
+      public: double quantile{0.5};
+
+      /// \brief Marker heights; the middle one estimates the
+      /// quantile. Doubles as a buffer for the first five samples.
+      public: double heights[5] = {0, 0, 0, 0, 0};
+
+      /// \brief Actual marker positions.
+      public: double positions[5] = {0, 0, 0, 0, 0};
+
+      /// \brief Desired marker positions.
+      public: double desired[5] = {0, 0, 0, 0, 0};
+
+      /// \brief Per-sample increments of the desired positions.
+      public: double increments[5] = {0, 0, 0, 0, 0};
+
+      /// \brief The short name, e.g. "p95", built once.
+      public: std::string shortName;
+
+      /// \brief Clone for copy semantics.
+      public: std::unique_ptr<SignalPercentilePrivate> Clone() const
+      {
+        std::unique_ptr<SignalPercentilePrivate> dataPtr(
+            new SignalPercentilePrivate(*this));
+        return dataPtr;
+      }
+    };
+
+    /// \brief Private data class for the SignalHistogram class.
+    class SignalHistogramPrivate
+    {
+      /// \brief Samples buffered before the bucket range is fixed.
+      public: static constexpr size_t kWarmupSamples = 256;
+
+      /// \brief Number of buckets.
+      public: unsigned int buckets{32};
+
+      /// \brief The warmup buffer, cleared once the range is fixed.
+      public: std::vector<double> warmup;
+
+      /// \brief Per-bucket sample counts, empty during warmup.
+      public: std::vector<uint64_t> counts;
+
+      /// \brief Lower edge of the first bucket.
+      public: double lower{0.0};
+
+      /// \brief Width of one bucket.
+      public: double width{0.0};
+
+      /// \brief Clone for copy semantics.
+      public: std::unique_ptr<SignalHistogramPrivate> Clone() const
+      {
+        std::unique_ptr<SignalHistogramPrivate> dataPtr(
+            new SignalHistogramPrivate(*this));
+        return dataPtr;
+      }
+    };
+
     class SignalStatistic;
 
     /// \def SignalStatisticPtr
@@ -60,12 +127,106 @@ namespace ignition
     /// \brief Vector of SignalStatisticPtr
     typedef std::vector<SignalStatisticPtr> SignalStatistic_V;
 
+    /// \brief Private data class for the FusedSignalStats class.
+    class FusedSignalStatsPrivate
+    {
+      /// \brief Count of inserted data values.
+      public: uint64_t count{0};
+
+      /// \brief Running mean (Welford).
+      public: double mean{0.0};
+
+      /// \brief Running sum of squared deviations from the mean
+      /// (Welford M2).
+      public: double m2{0.0};
+
+      /// \brief Running sum of squared values, for the rms.
+      public: double sumSquares{0.0};
+
+      /// \brief Smallest inserted value.
+      public: double min{0.0};
+
+      /// \brief Largest inserted value.
+      public: double max{0.0};
+    };
+
+    /// \brief Private data class for the WindowedSignalStats class.
+    class WindowedSignalStatsPrivate
+    {
+      /// \brief Partial aggregates of one ring bucket.
+      public: struct Bucket
+      {
+        /// \brief Count of samples in the bucket.
+        uint64_t count{0};
+
+        /// \brief Welford mean of the bucket's samples.
+        double mean{0.0};
+
+        /// \brief Welford sum of squared deviations.
+        double m2{0.0};
+
+        /// \brief Smallest sample in the bucket.
+        double min{0.0};
+
+        /// \brief Largest sample in the bucket.
+        double max{0.0};
+      };
+
+      /// \brief Window duration in seconds.
+      public: double window{1.0};
+
+      /// \brief Duration covered by one bucket.
+      public: double bucketWidth{1.0};
+
+      /// \brief The ring of buckets.
+      public: std::vector<Bucket> buckets;
+
+      /// \brief Global index of the bucket currently receiving
+      /// samples, i.e. floor(time / bucketWidth) of the last sample.
+      public: int64_t currentIndex{0};
+
+      /// \brief Whether any sample has been inserted since Reset.
+      public: bool started{false};
+    };
+
     /// \brief Private data class for the SignalStats class.
     class SignalStatsPrivate
     {
+      /// \brief Constructor.
+      public: SignalStatsPrivate() = default;
+
+      /// \brief Copy constructor. The sequence counter starts fresh in
+      /// the copy; only the statistics are carried over.
+      /// \param[in] _other SignalStatsPrivate to copy.
+      public: SignalStatsPrivate(const SignalStatsPrivate &_other)
+        : stats(_other.stats)
+      {
+      }
+
       /// \brief Vector of `SignalStatistic`s.
       public: SignalStatistic_V stats;
 
+      /// \brief Sequence counter implementing a seqlock: odd while an
+      /// insertion is in progress, even otherwise. Map() retries until it
+      /// observes the same even value before and after reading, so a
+      /// monitoring thread never blocks the inserting thread.
+      public: std::atomic<uint64_t> seq = {0};
+
+      /// \brief Pooled allocation for the per-instance data, since
+      /// signal monitors tend to exist one per tracked channel and are
+      /// built in large batches.
+      public: static void *operator new(std::size_t)
+      {
+        return MemoryPool<SignalStatsPrivate>::Instance().Allocate();
+      }
+
+      /// \brief Return the slot obtained from operator new.
+      /// \param[in] _ptr Pointer to the slot.
+      public: static void operator delete(void *_ptr)
+      {
+        MemoryPool<SignalStatsPrivate>::Instance().Deallocate(_ptr);
+      }
+
       /// \brief Clone the SignalStatsPrivate object. Used for implementing
       /// copy semantics.
       public: std::unique_ptr<SignalStatsPrivate> Clone() const
@@ -17,6 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+#include <thread>
+#include <vector>
+
 #include <ignition/math/Rand.hh>
 #include <ignition/math/SignalStats.hh>
 
@@ -639,3 +646,458 @@ TEST(SignalStatsTest, SignalStats)
   }
 }
 
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, BulkInsertData)
+{
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  // An independent set of statistics fed one sample at a time; note a
+  // copy would not do, since copies share the statistic objects.
+  math::SignalStats reference;
+  EXPECT_TRUE(reference.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  std::vector<double> samples;
+  for (int i = 0; i < 100; ++i)
+    samples.push_back(std::sin(0.37 * i) * (i % 7) - 2.0);
+
+  // Feed in several batches of different sizes, including empty.
+  stats.InsertData(samples.data(), 0);
+  stats.InsertData(samples.data(), 60);
+  stats.InsertData(samples.data() + 60, 40);
+
+  for (double sample : samples)
+    reference.InsertData(sample);
+
+  EXPECT_EQ(reference.Count(), stats.Count());
+
+  auto expected = reference.Map();
+  auto actual = stats.Map();
+  ASSERT_EQ(expected.size(), actual.size());
+  for (auto const &keyValue : expected)
+  {
+    ASSERT_EQ(1u, actual.count(keyValue.first));
+    EXPECT_NEAR(keyValue.second, actual.at(keyValue.first), 1e-10)
+        << keyValue.first;
+  }
+
+  // The buffer overload matches the pointer + count path.
+  math::SignalStats buffered;
+  EXPECT_TRUE(buffered.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  buffered.InsertData(samples);
+  EXPECT_EQ(stats.Count(), buffered.Count());
+  auto bufferedMap = buffered.Map();
+  for (auto const &keyValue : actual)
+  {
+    EXPECT_NEAR(keyValue.second, bufferedMap.at(keyValue.first), 1e-10)
+        << keyValue.first;
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, ConcurrentMapReads)
+{
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistics("max,mean,min"));
+
+  std::atomic<bool> done(false);
+  std::thread reader([&stats, &done]()
+  {
+    while (!done.load())
+    {
+      auto map = stats.Map();
+      // Bounds hold for every consistent snapshot below.
+      if (!map.empty() && map.at("max") != 0.0)
+      {
+        EXPECT_LE(map.at("min"), map.at("mean"));
+        EXPECT_LE(map.at("mean"), map.at("max"));
+      }
+    }
+  });
+
+  for (int i = 1; i <= 20000; ++i)
+    stats.InsertData(static_cast<double>(i));
+
+  done = true;
+  reader.join();
+
+  auto map = stats.Map();
+  EXPECT_DOUBLE_EQ(20000.0, map.at("max"));
+  EXPECT_DOUBLE_EQ(1.0, map.at("min"));
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, FusedSignalStats)
+{
+  math::FusedSignalStats fused;
+  EXPECT_EQ(0u, fused.Count());
+  EXPECT_DOUBLE_EQ(0.0, fused.Max());
+  EXPECT_DOUBLE_EQ(0.0, fused.Min());
+  EXPECT_DOUBLE_EQ(0.0, fused.Mean());
+  EXPECT_DOUBLE_EQ(0.0, fused.RootMeanSquare());
+  EXPECT_DOUBLE_EQ(0.0, fused.Variance());
+
+  // Matches the per-statistic family on the same data.
+  math::SignalStats reference;
+  EXPECT_TRUE(reference.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  std::vector<double> samples;
+  for (int i = 0; i < 500; ++i)
+    samples.push_back(std::sin(0.21 * i) * (i % 11) - 3.0);
+
+  for (double sample : samples)
+  {
+    fused.InsertData(sample);
+    reference.InsertData(sample);
+  }
+  EXPECT_EQ(samples.size(), fused.Count());
+
+  auto expected = reference.Map();
+  auto actual = fused.Map();
+  ASSERT_EQ(expected.size(), actual.size());
+  for (auto const &keyValue : expected)
+  {
+    ASSERT_EQ(1u, actual.count(keyValue.first));
+    EXPECT_NEAR(keyValue.second, actual.at(keyValue.first), 1e-9)
+        << keyValue.first;
+  }
+
+  // Batch insertion matches scalar insertion, and copies are
+  // independent.
+  math::FusedSignalStats bulk;
+  bulk.InsertData(samples.data(), samples.size());
+  EXPECT_DOUBLE_EQ(fused.Mean(), bulk.Mean());
+  EXPECT_DOUBLE_EQ(fused.Variance(), bulk.Variance());
+  EXPECT_DOUBLE_EQ(fused.RootMeanSquare(), bulk.RootMeanSquare());
+  EXPECT_DOUBLE_EQ(fused.MaxAbs(), bulk.MaxAbs());
+
+  math::FusedSignalStats copy(bulk);
+  copy.InsertData(1e6);
+  EXPECT_EQ(bulk.Count() + 1, copy.Count());
+  EXPECT_DOUBLE_EQ(1e6, copy.Max());
+  EXPECT_NE(copy.Max(), bulk.Max());
+
+  bulk.Reset();
+  EXPECT_EQ(0u, bulk.Count());
+  EXPECT_DOUBLE_EQ(0.0, bulk.Mean());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalPercentile)
+{
+  {
+    // Constructor and short name
+    math::SignalPercentile p95(0.95);
+    EXPECT_EQ(p95.ShortName(), std::string("p95"));
+    EXPECT_DOUBLE_EQ(0.95, p95.Quantile());
+    EXPECT_EQ(p95.Count(), 0u);
+    EXPECT_DOUBLE_EQ(p95.Value(), 0.0);
+
+    // An out-of-range quantile falls back to the median.
+    math::SignalPercentile bad(1.5);
+    EXPECT_DOUBLE_EQ(0.5, bad.Quantile());
+    EXPECT_EQ(bad.ShortName(), std::string("p50"));
+  }
+
+  {
+    // Fewer than five samples: the value is exact.
+    math::SignalPercentile median(0.5);
+    median.InsertData(3.0);
+    median.InsertData(1.0);
+    median.InsertData(2.0);
+    EXPECT_DOUBLE_EQ(2.0, median.Value());
+    median.InsertData(4.0);
+    EXPECT_DOUBLE_EQ(2.5, median.Value());
+  }
+
+  {
+    // A long uniform stream: the P-square estimate lands close to the
+    // analytic percentile.
+    math::SignalPercentile p50(0.5);
+    math::SignalPercentile p99(0.99);
+    std::vector<double> samples;
+    for (int i = 0; i < 10000; ++i)
+    {
+      // A deterministic shuffle of [0, 1000).
+      samples.push_back((i * 7919) % 10000 / 10.0);
+    }
+    p50.InsertData(samples.data(), samples.size());
+    p99.InsertData(samples.data(), samples.size());
+    EXPECT_EQ(samples.size(), p50.Count());
+    EXPECT_NEAR(500.0, p50.Value(), 10.0);
+    EXPECT_NEAR(990.0, p99.Value(), 10.0);
+
+    // Reset forgets the markers.
+    p50.Reset();
+    EXPECT_EQ(p50.Count(), 0u);
+    EXPECT_DOUBLE_EQ(p50.Value(), 0.0);
+  }
+
+  {
+    // Registration through the string interface.
+    math::SignalStats stats;
+    EXPECT_TRUE(stats.InsertStatistics("p50,p95"));
+    EXPECT_FALSE(stats.InsertStatistic("p50"));
+    EXPECT_FALSE(stats.InsertStatistic("p0"));
+    EXPECT_FALSE(stats.InsertStatistic("p100"));
+    EXPECT_FALSE(stats.InsertStatistic("pxx"));
+
+    for (int i = 1; i <= 1000; ++i)
+      stats.InsertData(static_cast<double>(i));
+
+    auto map = stats.Map();
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.count("p50"), 1u);
+    EXPECT_EQ(map.count("p95"), 1u);
+    EXPECT_NEAR(500.0, map["p50"], 10.0);
+    EXPECT_NEAR(950.0, map["p95"], 10.0);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalHistogram)
+{
+  {
+    // Constructor
+    math::SignalHistogram hist;
+    EXPECT_EQ(hist.ShortName(), std::string("histogram"));
+    EXPECT_EQ(hist.Count(), 0u);
+    EXPECT_DOUBLE_EQ(hist.Value(), 0.0);
+    EXPECT_TRUE(hist.Counts().empty());
+  }
+
+  {
+    // During warmup percentiles are exact.
+    math::SignalHistogram hist;
+    for (int i = 0; i <= 100; ++i)
+      hist.InsertData(static_cast<double>(i));
+    EXPECT_TRUE(hist.Counts().empty());
+    EXPECT_DOUBLE_EQ(50.0, hist.Value());
+    EXPECT_DOUBLE_EQ(95.0, hist.Percentile(0.95));
+    EXPECT_DOUBLE_EQ(0.0, hist.Percentile(0.0));
+    EXPECT_DOUBLE_EQ(100.0, hist.Percentile(1.0));
+
+    // Invalid quantiles are rejected.
+    EXPECT_DOUBLE_EQ(0.0, hist.Percentile(-0.1));
+    EXPECT_DOUBLE_EQ(0.0, hist.Percentile(1.1));
+  }
+
+  {
+    // After warmup the range is fixed and estimates stay close.
+    math::SignalHistogram hist(50);
+    std::vector<double> samples;
+    for (int i = 0; i < 5000; ++i)
+      samples.push_back((i * 7919) % 5000 / 5.0);
+    hist.InsertData(samples.data(), samples.size());
+    EXPECT_EQ(samples.size(), hist.Count());
+    EXPECT_EQ(hist.Counts().size(), 50u);
+    EXPECT_NEAR(500.0, hist.Value(), 25.0);
+    EXPECT_NEAR(950.0, hist.Percentile(0.95), 25.0);
+
+    // Out-of-range samples land in the edge buckets.
+    hist.InsertData(1e6);
+    hist.InsertData(-1e6);
+    EXPECT_EQ(samples.size() + 2, hist.Count());
+
+    // Reset returns to the warmup state.
+    hist.Reset();
+    EXPECT_EQ(hist.Count(), 0u);
+    EXPECT_TRUE(hist.Counts().empty());
+    EXPECT_DOUBLE_EQ(hist.Value(), 0.0);
+  }
+
+  {
+    // Registration through the string interface.
+    math::SignalStats stats;
+    EXPECT_TRUE(stats.InsertStatistic("histogram"));
+    stats.InsertData(1.0);
+    auto map = stats.Map();
+    EXPECT_EQ(map.count("histogram"), 1u);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, WindowedSignalStats)
+{
+  math::WindowedSignalStats stats(10.0, 10);
+  EXPECT_DOUBLE_EQ(10.0, stats.Window());
+  EXPECT_EQ(10u, stats.BucketCount());
+  EXPECT_EQ(0u, stats.Count());
+  EXPECT_DOUBLE_EQ(0.0, stats.Mean());
+  EXPECT_DOUBLE_EQ(0.0, stats.Variance());
+
+  // Constructor parameter clamping.
+  math::WindowedSignalStats degenerate(-1.0, 1);
+  EXPECT_DOUBLE_EQ(1.0, degenerate.Window());
+  EXPECT_EQ(2u, degenerate.BucketCount());
+
+  // One sample per second; after the first ten the merged window
+  // matches exact statistics over the samples still inside it.
+  for (int t = 0; t < 10; ++t)
+    stats.InsertData(t, t);
+  EXPECT_EQ(10u, stats.Count());
+  EXPECT_DOUBLE_EQ(4.5, stats.Mean());
+  EXPECT_DOUBLE_EQ(0.0, stats.Min());
+  EXPECT_DOUBLE_EQ(9.0, stats.Max());
+  // Exact variance of 0..9.
+  EXPECT_NEAR(55.0 / 6.0, stats.Variance(), 1e-12);
+  EXPECT_NEAR(std::sqrt(285.0 / 10.0), stats.RootMeanSquare(), 1e-12);
+
+  // Sliding one bucket forward expires the oldest bucket (value 0).
+  stats.InsertData(10.0, 10.0);
+  EXPECT_EQ(10u, stats.Count());
+  EXPECT_DOUBLE_EQ(1.0, stats.Min());
+  EXPECT_DOUBLE_EQ(10.0, stats.Max());
+  EXPECT_DOUBLE_EQ(5.5, stats.Mean());
+
+  auto map = stats.Map();
+  EXPECT_DOUBLE_EQ(5.5, map["mean"]);
+  EXPECT_DOUBLE_EQ(1.0, map["min"]);
+  EXPECT_DOUBLE_EQ(10.0, map["max"]);
+
+  // A jump of more than a window empties the ring before inserting.
+  stats.InsertData(100.0, 3.0);
+  EXPECT_EQ(1u, stats.Count());
+  EXPECT_DOUBLE_EQ(3.0, stats.Mean());
+  EXPECT_DOUBLE_EQ(3.0, stats.Min());
+  EXPECT_DOUBLE_EQ(3.0, stats.Max());
+
+  // Late samples are counted in the current bucket.
+  stats.InsertData(50.0, 5.0);
+  EXPECT_EQ(2u, stats.Count());
+  EXPECT_DOUBLE_EQ(4.0, stats.Mean());
+
+  // Copy and assignment carry the state.
+  math::WindowedSignalStats copy(stats);
+  EXPECT_EQ(2u, copy.Count());
+  EXPECT_DOUBLE_EQ(4.0, copy.Mean());
+  math::WindowedSignalStats assigned(1.0, 2);
+  assigned = stats;
+  EXPECT_EQ(2u, assigned.Count());
+
+  stats.Reset();
+  EXPECT_EQ(0u, stats.Count());
+  EXPECT_DOUBLE_EQ(0.0, stats.Mean());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, WindowedMatchesExact)
+{
+  // Dense samples: the merged bucket statistics agree with an exact
+  // recomputation over the samples the ring still covers.
+  const double window = 1.0;
+  const unsigned int buckets = 20;
+  math::WindowedSignalStats stats(window, buckets);
+
+  std::vector<std::pair<double, double>> samples;
+  for (int i = 0; i < 3000; ++i)
+  {
+    const double t = i * 0.001;
+    const double x = std::sin(0.013 * i) + 0.5 * std::cos(0.271 * i);
+    samples.push_back({t, x});
+    stats.InsertData(t, x);
+  }
+
+  // Samples still covered: those in buckets not yet expired. The
+  // current bucket index is floor(2.999 / 0.05); the ring covers the
+  // 20 bucket indices ending there.
+  const double bucketWidth = window / buckets;
+  const auto lastIdx = static_cast<long long>(
+      std::floor(2.999 / bucketWidth));
+  double sum = 0.0, sumSq = 0.0, minV = 0.0, maxV = 0.0;
+  size_t n = 0;
+  for (const auto &sample : samples)
+  {
+    const auto idx = static_cast<long long>(
+        std::floor(sample.first / bucketWidth));
+    if (idx <= lastIdx - static_cast<long long>(buckets))
+      continue;
+    if (n == 0)
+    {
+      minV = maxV = sample.second;
+    }
+    else
+    {
+      minV = std::min(minV, sample.second);
+      maxV = std::max(maxV, sample.second);
+    }
+    sum += sample.second;
+    sumSq += sample.second * sample.second;
+    ++n;
+  }
+
+  ASSERT_EQ(n, stats.Count());
+  EXPECT_NEAR(sum / n, stats.Mean(), 1e-12);
+  EXPECT_DOUBLE_EQ(minV, stats.Min());
+  EXPECT_DOUBLE_EQ(maxV, stats.Max());
+  EXPECT_NEAR(std::sqrt(sumSq / n), stats.RootMeanSquare(), 1e-12);
+  const double exactVar = (sumSq - sum * sum / n) / (n - 1);
+  EXPECT_NEAR(exactVar, stats.Variance(), 1e-9);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, StaticSignalStats)
+{
+  math::StaticSignalStats<math::MaxTag, math::MaxAbsTag, math::MeanTag,
+      math::MinTag, math::RmsTag, math::VarTag> stats;
+
+  // No data yet.
+  EXPECT_EQ(0u, stats.Count());
+  EXPECT_DOUBLE_EQ(0.0, stats.Value<math::MaxTag>());
+  EXPECT_DOUBLE_EQ(0.0, stats.Value<math::MeanTag>());
+  EXPECT_DOUBLE_EQ(0.0, stats.Value<math::VarTag>());
+
+  // Feed the same samples to a dynamically configured SignalStats and
+  // expect matching values under matching short names.
+  math::SignalStats dynamic;
+  EXPECT_TRUE(dynamic.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  const std::vector<double> samples =
+      {-3.5, 2.0, 0.25, -1.0, 7.5, -8.25, 4.0, 0.0, 1.5, -2.75};
+  for (auto const &sample : samples)
+  {
+    stats.InsertData(sample);
+    dynamic.InsertData(sample);
+  }
+  EXPECT_EQ(samples.size(), stats.Count());
+
+  auto expected = dynamic.Map();
+  auto map = stats.Map();
+  EXPECT_EQ(expected.size(), map.size());
+  for (auto const &entry : expected)
+  {
+    ASSERT_EQ(1u, map.count(entry.first));
+    EXPECT_NEAR(entry.second, map[entry.first], 1e-12) << entry.first;
+  }
+
+  // Value<Tag>() agrees with Map().
+  EXPECT_DOUBLE_EQ(map["max"], stats.Value<math::MaxTag>());
+  EXPECT_DOUBLE_EQ(map["maxAbs"], stats.Value<math::MaxAbsTag>());
+  EXPECT_DOUBLE_EQ(map["mean"], stats.Value<math::MeanTag>());
+  EXPECT_DOUBLE_EQ(map["min"], stats.Value<math::MinTag>());
+  EXPECT_DOUBLE_EQ(map["rms"], stats.Value<math::RmsTag>());
+  EXPECT_DOUBLE_EQ(map["var"], stats.Value<math::VarTag>());
+
+  // Batch insertion matches sample-by-sample insertion.
+  math::StaticSignalStats<math::MeanTag, math::VarTag> batch;
+  batch.InsertData(samples.data(), samples.size());
+  EXPECT_EQ(samples.size(), batch.Count());
+  EXPECT_DOUBLE_EQ(stats.Value<math::MeanTag>(),
+      batch.Value<math::MeanTag>());
+  EXPECT_DOUBLE_EQ(stats.Value<math::VarTag>(),
+      batch.Value<math::VarTag>());
+
+  // Reset forgets everything.
+  stats.Reset();
+  EXPECT_EQ(0u, stats.Count());
+  EXPECT_DOUBLE_EQ(0.0, stats.Value<math::MaxTag>());
+  EXPECT_DOUBLE_EQ(0.0, stats.Value<math::RmsTag>());
+
+  // A subset only reports its own statistics.
+  math::StaticSignalStats<math::MeanTag> meanOnly;
+  meanOnly.InsertData(1.0);
+  meanOnly.InsertData(3.0);
+  auto meanMap = meanOnly.Map();
+  EXPECT_EQ(1u, meanMap.size());
+  EXPECT_DOUBLE_EQ(2.0, meanMap["mean"]);
+}
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "ignition/math/Sphere.hh"
 
@@ -131,3 +132,89 @@ TEST(SphereTest, Mass)
   EXPECT_EQ(expectedMassMat, massMat);
   EXPECT_DOUBLE_EQ(expectedMassMat.Mass(), massMat.Mass());
 }
+
+//////////////////////////////////////////////////
+TEST(SphereTest, BatchEvaluation)
+{
+  std::vector<math::Sphered> spheres;
+  spheres.push_back(math::Sphered(1.0));
+  spheres.push_back(math::Sphered(0.0));
+  spheres.push_back(math::Sphered(2.5));
+  spheres[0].SetMaterial(math::Material(math::MaterialType::WOOD));
+  spheres[2].SetMaterial(math::Material(math::MaterialType::IRON));
+
+  std::vector<math::MassMatrix3d> massMats(spheres.size());
+  std::vector<uint8_t> valid(spheres.size(), 2);
+  math::Sphered::MassMatrixBatch(spheres.data(), spheres.size(),
+      massMats.data(), valid.data());
+
+  std::vector<double> masses = {2.0, 2.0, -1.0};
+  std::vector<double> densities(spheres.size());
+  math::Sphered::DensityFromMassBatch(spheres.data(), masses.data(),
+      densities.data(), spheres.size());
+
+  for (size_t i = 0; i < spheres.size(); ++i)
+  {
+    math::MassMatrix3d expected;
+    const bool ok = spheres[i].MassMatrix(expected);
+    EXPECT_EQ(ok ? 1 : 0, valid[i]) << i;
+    if (ok)
+    {
+      EXPECT_EQ(expected, massMats[i]) << i;
+    }
+    EXPECT_DOUBLE_EQ(spheres[i].DensityFromMass(masses[i]), densities[i])
+        << i;
+  }
+
+  // The cached volume follows radius changes.
+  math::Sphered sphere(1.0);
+  const double volume = sphere.Volume();
+  EXPECT_DOUBLE_EQ(volume, sphere.Volume());
+  sphere.SetRadius(2.0);
+  EXPECT_DOUBLE_EQ(8.0 * volume, sphere.Volume());
+}
+
+/////////////////////////////////////////////////
+TEST(SphereTest, AxisAlignedBoundingBox)
+{
+  Sphered sphere(2.0);
+
+  AxisAlignedBox box = sphere.AxisAlignedBoundingBox();
+  EXPECT_EQ(box.Min(), Vector3d(-2, -2, -2));
+  EXPECT_EQ(box.Max(), Vector3d(2, 2, 2));
+
+  // The box of a sphere ignores the rotation of the pose.
+  box = sphere.AxisAlignedBoundingBox(Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+  EXPECT_EQ(box.Min(), Vector3d(-1, 0, 1));
+  EXPECT_EQ(box.Max(), Vector3d(3, 4, 5));
+
+  const Sphered spheres[2] = {Sphered(1.0), Sphered(3.0)};
+  const Pose3d poses[2] =
+      {Pose3d(1, 0, 0, 0, 0, 0), Pose3d(0, -2, 5, 0, 0, 0)};
+  AxisAlignedBox boxes[2];
+  Sphered::AxisAlignedBoundingBoxBatch(spheres, poses, 2, boxes);
+  for (int i = 0; i < 2; ++i)
+    EXPECT_EQ(boxes[i], spheres[i].AxisAlignedBoundingBox(poses[i]));
+}
+
+/////////////////////////////////////////////////
+TEST(SphereTest, SupportPoint)
+{
+  Sphered sphere(2.0);
+
+  EXPECT_EQ(sphere.SupportPoint(Vector3d(0, 0, 5)), Vector3d(0, 0, 2));
+  EXPECT_EQ(sphere.SupportPoint(Vector3d(-1, 0, 0)), Vector3d(-2, 0, 0));
+  EXPECT_EQ(sphere.SupportPoint(Vector3d::Zero), Vector3d::Zero);
+
+  // An oblique direction lands on the surface along the direction.
+  const Vector3d point = sphere.SupportPoint(Vector3d(1, 2, -2));
+  EXPECT_DOUBLE_EQ(point.Length(), 2.0);
+  EXPECT_EQ(point.Normalized(), Vector3d(1, 2, -2).Normalized());
+
+  const Vector3d dirs[3] =
+      {Vector3d(1, 0, 0), Vector3d(1, 1, 1), Vector3d(0, -3, 4)};
+  Vector3d points[3];
+  sphere.SupportPointBatch(dirs, 3, points);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(points[i], sphere.SupportPoint(dirs[i]));
+}
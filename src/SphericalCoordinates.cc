@@ -14,7 +14,9 @@
  * limitations under the License.
  *
 */
+#include <cmath>
 #include <string>
+#include <vector>
 
 #include "ignition/math/Matrix3.hh"
 #include "ignition/math/SphericalCoordinates.hh"
@@ -26,16 +28,16 @@ using namespace math;
 // wikipedia: World_Geodetic_System#A_new_World_Geodetic_System:_WGS_84
 
 // a: Equatorial radius. Semi-major axis of the WGS84 spheroid (meters).
-const double g_EarthWGS84AxisEquatorial = 6378137.0;
+constexpr double g_EarthWGS84AxisEquatorial = 6378137.0;
 
 // b: Polar radius. Semi-minor axis of the wgs84 spheroid (meters).
-const double g_EarthWGS84AxisPolar = 6356752.314245;
+constexpr double g_EarthWGS84AxisPolar = 6356752.314245;
 
 // if: WGS84 inverse flattening parameter (no units)
-const double g_EarthWGS84Flattening = 1.0/298.257223563;
+constexpr double g_EarthWGS84Flattening = 1.0/298.257223563;
 
 // Radius of the Earth (meters).
-const double g_EarthRadius = 6371000.0;
+constexpr double g_EarthRadius = 6371000.0;
 
 // Private data for the SphericalCoordinates class.
 class ignition::math::SphericalCoordinatesPrivate
@@ -85,6 +87,62 @@ class ignition::math::SphericalCoordinatesPrivate
 
   /// \brief Cache sine head transform
   public: double sinHea;
+
+  /// \brief One cell of the tangent plane grid: the exact geodetic
+  /// coordinates of the cell center and the linearization factors
+  /// around it.
+  public: struct TangentPlaneCell
+  {
+    /// \brief Geodetic latitude of the cell center, in radians.
+    double lat0;
+
+    /// \brief Geodetic longitude of the cell center, in radians.
+    double lon0;
+
+    /// \brief Elevation of the cell center (local z of zero).
+    double elev0;
+
+    /// \brief Jacobian of the exact LOCAL to SPHERICAL transform at
+    /// the cell center: maps a local frame offset in meters to a
+    /// (latitude, longitude, elevation) offset in radians and meters.
+    /// Capturing the full Jacobian keeps the tilt between the cell's
+    /// tangent frame and the LOCAL frame, which a pair of curvature
+    /// radii would miss.
+    ignition::math::Matrix3d jac;
+
+    /// \brief Inverse of jac, for the reverse transform.
+    ignition::math::Matrix3d jacInv;
+
+    /// \brief Local frame x coordinate of the cell center.
+    double x0;
+
+    /// \brief Local frame y coordinate of the cell center.
+    double y0;
+  };
+
+  /// \brief Tangent plane grid cells, row major with x fastest.
+  /// Empty when no grid has been precomputed.
+  public: std::vector<TangentPlaneCell> gridCells;
+
+  /// \brief Minimum corner of the gridded region (local meters).
+  public: ignition::math::Vector2d gridMin;
+
+  /// \brief Grid cell edge length in meters.
+  public: double gridCellSize{0.0};
+
+  /// \brief Number of grid cells along local x.
+  public: size_t gridNx{0};
+
+  /// \brief Number of grid cells along local y.
+  public: size_t gridNy{0};
+
+  /// \brief Meters of northing per radian of latitude at the
+  /// reference point; seeds the cell guess of the reverse transform.
+  public: double refNorthPerLat{1.0};
+
+  /// \brief Meters of easting per radian of longitude at the
+  /// reference point; seeds the cell guess of the reverse transform.
+  public: double refEastPerLon{1.0};
 };
 
 //////////////////////////////////////////////////
@@ -269,6 +327,167 @@ ignition::math::Vector3d SphericalCoordinates::LocalFromSphericalPosition(
   return this->PositionTransform(result, SPHERICAL, LOCAL);
 }
 
+//////////////////////////////////////////////////
+bool SphericalCoordinates::PrecomputeTangentPlaneGrid(
+    const ignition::math::Vector2d &_min,
+    const ignition::math::Vector2d &_max,
+    const double _cellSize)
+{
+  if (_cellSize <= 0.0 || _max.X() <= _min.X() || _max.Y() <= _min.Y())
+  {
+    std::cerr << "SphericalCoordinates::PrecomputeTangentPlaneGrid() "
+              << "requires a positive cell size and a non-empty region"
+              << std::endl;
+    return false;
+  }
+
+  auto &d = *this->dataPtr;
+  const double e2 = d.ellE * d.ellE;
+
+  d.gridMin = _min;
+  d.gridCellSize = _cellSize;
+  d.gridNx = static_cast<size_t>(
+      std::ceil((_max.X() - _min.X()) / _cellSize));
+  d.gridNy = static_cast<size_t>(
+      std::ceil((_max.Y() - _min.Y()) / _cellSize));
+
+  const double refLat = d.latitudeReference.Radian();
+  const double refSinLat = sin(refLat);
+  const double refDenom = 1.0 - e2 * refSinLat * refSinLat;
+  d.refNorthPerLat = d.ellA * (1.0 - e2) / (refDenom * std::sqrt(refDenom));
+  d.refEastPerLon = d.ellA / std::sqrt(refDenom) * cos(refLat);
+
+  std::vector<SphericalCoordinatesPrivate::TangentPlaneCell> cells;
+  cells.reserve(d.gridNx * d.gridNy);
+  for (size_t iy = 0; iy < d.gridNy; ++iy)
+  {
+    for (size_t ix = 0; ix < d.gridNx; ++ix)
+    {
+      SphericalCoordinatesPrivate::TangentPlaneCell cell;
+      cell.x0 = _min.X() + (static_cast<double>(ix) + 0.5) * _cellSize;
+      cell.y0 = _min.Y() + (static_cast<double>(iy) + 0.5) * _cellSize;
+
+      // The exact geodetic coordinates of the cell center carry all
+      // of the per-cell trigonometry.
+      const ignition::math::Vector3d center(cell.x0, cell.y0, 0.0);
+      const ignition::math::Vector3d centerSph =
+          this->PositionTransform(center, LOCAL, SPHERICAL);
+      cell.lat0 = centerSph.X();
+      cell.lon0 = centerSph.Y();
+      cell.elev0 = centerSph.Z();
+
+      // Jacobian columns by central differences of the exact
+      // transform; the differencing error is quadratic in the step
+      // and far below the linearization error across a cell.
+      const double h = 1.0;
+      ignition::math::Vector3d cols[3];
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        ignition::math::Vector3d step(0, 0, 0);
+        step[axis] = h;
+        cols[axis] = (this->PositionTransform(center + step,
+            LOCAL, SPHERICAL) - this->PositionTransform(center - step,
+            LOCAL, SPHERICAL)) / (2.0 * h);
+      }
+      cell.jac = ignition::math::Matrix3d(
+          cols[0].X(), cols[1].X(), cols[2].X(),
+          cols[0].Y(), cols[1].Y(), cols[2].Y(),
+          cols[0].Z(), cols[1].Z(), cols[2].Z());
+      cell.jacInv = cell.jac.Inverse();
+      cells.push_back(cell);
+    }
+  }
+  d.gridCells = std::move(cells);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::ClearTangentPlaneGrid()
+{
+  auto &d = *this->dataPtr;
+  d.gridCells.clear();
+  d.gridCellSize = 0.0;
+  d.gridNx = 0;
+  d.gridNy = 0;
+}
+
+//////////////////////////////////////////////////
+size_t SphericalCoordinates::TangentPlaneGridCellCount() const
+{
+  return this->dataPtr->gridCells.size();
+}
+
+//////////////////////////////////////////////////
+ignition::math::Vector3d SphericalCoordinates::SphericalFromLocalPositionFast(
+    const ignition::math::Vector3d &_xyz) const
+{
+  const auto &d = *this->dataPtr;
+  if (d.gridCells.empty())
+    return this->SphericalFromLocalPosition(_xyz);
+
+  const double fx = (_xyz.X() - d.gridMin.X()) / d.gridCellSize;
+  const double fy = (_xyz.Y() - d.gridMin.Y()) / d.gridCellSize;
+  if (fx < 0.0 || fy < 0.0 ||
+      fx >= static_cast<double>(d.gridNx) ||
+      fy >= static_cast<double>(d.gridNy))
+  {
+    return this->SphericalFromLocalPosition(_xyz);
+  }
+
+  const auto &cell = d.gridCells[
+      static_cast<size_t>(fy) * d.gridNx + static_cast<size_t>(fx)];
+
+  const ignition::math::Vector3d delta = cell.jac *
+      ignition::math::Vector3d(_xyz.X() - cell.x0, _xyz.Y() - cell.y0,
+          _xyz.Z());
+
+  return ignition::math::Vector3d(
+      IGN_RTOD(cell.lat0 + delta.X()),
+      IGN_RTOD(cell.lon0 + delta.Y()),
+      cell.elev0 + delta.Z());
+}
+
+//////////////////////////////////////////////////
+ignition::math::Vector3d SphericalCoordinates::LocalFromSphericalPositionFast(
+    const ignition::math::Vector3d &_xyz) const
+{
+  const auto &d = *this->dataPtr;
+  if (d.gridCells.empty())
+    return this->LocalFromSphericalPosition(_xyz);
+
+  const double lat = IGN_DTOR(_xyz.X());
+  const double lon = IGN_DTOR(_xyz.Y());
+
+  // Guess the cell through the reference point's linearization. A
+  // guess that lands one cell off only grows the linearization
+  // distance slightly; it cannot produce a wrong cell frame.
+  const double guessEast =
+      (lon - d.longitudeReference.Radian()) * d.refEastPerLon;
+  const double guessNorth =
+      (lat - d.latitudeReference.Radian()) * d.refNorthPerLat;
+  const double guessX = -(guessEast * d.cosHea + guessNorth * d.sinHea);
+  const double guessY = guessEast * d.sinHea - guessNorth * d.cosHea;
+
+  const double fx = (guessX - d.gridMin.X()) / d.gridCellSize;
+  const double fy = (guessY - d.gridMin.Y()) / d.gridCellSize;
+  if (fx < 0.0 || fy < 0.0 ||
+      fx >= static_cast<double>(d.gridNx) ||
+      fy >= static_cast<double>(d.gridNy))
+  {
+    return this->LocalFromSphericalPosition(_xyz);
+  }
+
+  const auto &cell = d.gridCells[
+      static_cast<size_t>(fy) * d.gridNx + static_cast<size_t>(fx)];
+
+  const ignition::math::Vector3d delta = cell.jacInv *
+      ignition::math::Vector3d(lat - cell.lat0, lon - cell.lon0,
+          _xyz.Z() - cell.elev0);
+
+  return ignition::math::Vector3d(
+      cell.x0 + delta.X(), cell.y0 + delta.Y(), delta.Z());
+}
+
 //////////////////////////////////////////////////
 ignition::math::Vector3d SphericalCoordinates::GlobalFromLocalVelocity(
     const ignition::math::Vector3d &_xyz) const
@@ -302,6 +521,55 @@ double SphericalCoordinates::Distance(const ignition::math::Angle &_latA,
   return d;
 }
 
+//////////////////////////////////////////////////
+void SphericalCoordinates::DistanceBatch(const double *_latA,
+                                         const double *_lonA,
+                                         const double *_latB,
+                                         const double *_lonB,
+                                         const size_t _count,
+                                         double *_distances)
+{
+  // The haversine of Distance() over contiguous arrays, with each
+  // shared term evaluated once per pair.
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double sinHalfLat = sin(0.5 * (_latB[i] - _latA[i]));
+    const double sinHalfLon = sin(0.5 * (_lonB[i] - _lonA[i]));
+    const double a = sinHalfLat * sinHalfLat +
+        sinHalfLon * sinHalfLon * cos(_latA[i]) * cos(_latB[i]);
+    _distances[i] = 2 * g_EarthRadius * atan2(sqrt(a), sqrt(1 - a));
+  }
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::SquaredChordBatch(const double *_latA,
+                                             const double *_lonA,
+                                             const double *_latB,
+                                             const double *_lonB,
+                                             const size_t _count,
+                                             double *_chordsSq)
+{
+  // The haversine term a is the squared half chord of the unit
+  // sphere, so the squared chord is 4 R^2 a; no inverse trig and no
+  // square root per pair.
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double sinHalfLat = sin(0.5 * (_latB[i] - _latA[i]));
+    const double sinHalfLon = sin(0.5 * (_lonB[i] - _lonA[i]));
+    const double a = sinHalfLat * sinHalfLat +
+        sinHalfLon * sinHalfLon * cos(_latA[i]) * cos(_latB[i]);
+    _chordsSq[i] = 4 * g_EarthRadius * g_EarthRadius * a;
+  }
+}
+
+//////////////////////////////////////////////////
+double SphericalCoordinates::SquaredChordForDistance(
+    const double _distance)
+{
+  const double sinHalf = sin(_distance / (2 * g_EarthRadius));
+  return 4 * g_EarthRadius * g_EarthRadius * sinHalf * sinHalf;
+}
+
 //////////////////////////////////////////////////
 void SphericalCoordinates::UpdateTransformationMatrix()
 {
@@ -342,6 +610,11 @@ void SphericalCoordinates::UpdateTransformationMatrix()
     this->dataPtr->elevationReference);
   this->dataPtr->origin =
     this->PositionTransform(this->dataPtr->origin, SPHERICAL, ECEF);
+
+  // The tangent plane grid linearizes around the old reference frame;
+  // drop it so the fast conversions fall back to the exact path until
+  // the grid is precomputed again.
+  this->ClearTangentPlaneGrid();
 }
 
 /////////////////////////////////////////////////
@@ -460,7 +733,201 @@ ignition::math::Vector3d SphericalCoordinates::PositionTransform(
   return tmp;
 }
 
+/////////////////////////////////////////////////
+void SphericalCoordinates::PositionTransformBatch(
+    const ignition::math::Vector3d *_pos,
+    ignition::math::Vector3d *_out, size_t _n,
+    const CoordinateType &_inType, const CoordinateType &_outType) const
+{
+  // Validate the coordinate types once; the scalar function returns the
+  // input unchanged on error, so do the same for every element.
+  if ((_inType != LOCAL && _inType != GLOBAL &&
+       _inType != SPHERICAL && _inType != ECEF) ||
+      (_outType != LOCAL && _outType != GLOBAL &&
+       _outType != SPHERICAL && _outType != ECEF))
+  {
+    std::cerr << "Invalid coordinate type[" <<
+      (_inType != LOCAL && _inType != GLOBAL &&
+       _inType != SPHERICAL && _inType != ECEF ? _inType : _outType) << "]\n";
+    for (size_t i = 0; i < _n; ++i)
+      _out[i] = _pos[i];
+    return;
+  }
+
+  // Hoist every per-datum invariant out of the loop. Conversions that
+  // do not involve SPHERICAL coordinates then run without any
+  // per-point trigonometry.
+  const ignition::math::Matrix3d rotGlobalToECEF =
+      this->dataPtr->rotGlobalToECEF;
+  const ignition::math::Matrix3d rotECEFToGlobal =
+      this->dataPtr->rotECEFToGlobal;
+  const ignition::math::Vector3d origin = this->dataPtr->origin;
+  const double cosHea = this->dataPtr->cosHea;
+  const double sinHea = this->dataPtr->sinHea;
+  const double ellA = this->dataPtr->ellA;
+  const double ellB = this->dataPtr->ellB;
+  const double ellE = this->dataPtr->ellE;
+  const double ellP = this->dataPtr->ellP;
+  const double ellE2 = ellE * ellE;
+  const double ellB2OverA2 = (ellB * ellB) / (ellA * ellA);
+
+  for (size_t i = 0; i < _n; ++i)
+  {
+    ignition::math::Vector3d tmp = _pos[i];
+
+    // Convert whatever arrives to a more flexible ECEF coordinate
+    switch (_inType)
+    {
+      case LOCAL:
+        tmp = ignition::math::Vector3d(
+            -tmp.X() * cosHea + tmp.Y() * sinHea,
+            -tmp.X() * sinHea - tmp.Y() * cosHea,
+            tmp.Z());
+        tmp = origin + rotGlobalToECEF * tmp;
+        break;
+
+      case GLOBAL:
+        tmp = origin + rotGlobalToECEF * tmp;
+        break;
+
+      case SPHERICAL:
+        {
+          const double cosLat = cos(tmp.X());
+          const double sinLat = sin(tmp.X());
+          const double cosLon = cos(tmp.Y());
+          const double sinLon = sin(tmp.Y());
+
+          // Radius of planet curvature (meters)
+          const double curvature =
+              ellA / sqrt(1.0 - ellE2 * sinLat * sinLat);
+
+          tmp = ignition::math::Vector3d(
+              (tmp.Z() + curvature) * cosLat * cosLon,
+              (tmp.Z() + curvature) * cosLat * sinLon,
+              (ellB2OverA2 * curvature + tmp.Z()) * sinLat);
+          break;
+        }
+
+      case ECEF:
+      default:
+        break;
+    }
+
+    // Convert ECEF to the requested output coordinate system
+    switch (_outType)
+    {
+      case SPHERICAL:
+        {
+          const double p = sqrt(tmp.X() * tmp.X() + tmp.Y() * tmp.Y());
+          const double theta = atan((tmp.Z() * ellA) / (p * ellB));
+          const double sinTheta = sin(theta);
+          const double cosTheta = cos(theta);
+
+          const double lat = atan(
+              (tmp.Z() + ellP * ellP * ellB *
+               sinTheta * sinTheta * sinTheta) /
+              (p - ellE2 * ellA * cosTheta * cosTheta * cosTheta));
+          const double lon = atan2(tmp.Y(), tmp.X());
+
+          const double sinLat = sin(lat);
+          const double nCurvature =
+              ellA / sqrt(1.0 - ellE2 * sinLat * sinLat);
+
+          tmp = ignition::math::Vector3d(lat, lon,
+              p / cos(lat) - nCurvature);
+          break;
+        }
+
+      case GLOBAL:
+        tmp = rotECEFToGlobal * (tmp - origin);
+        break;
+
+      case LOCAL:
+        tmp = rotECEFToGlobal * (tmp - origin);
+        tmp = ignition::math::Vector3d(
+            tmp.X() * cosHea - tmp.Y() * sinHea,
+            tmp.X() * sinHea + tmp.Y() * cosHea,
+            tmp.Z());
+        break;
+
+      case ECEF:
+      default:
+        break;
+    }
+
+    _out[i] = tmp;
+  }
+}
+
 //////////////////////////////////////////////////
+ignition::math::Matrix4d SphericalCoordinates::ECEFFromLocalMatrix() const
+{
+  const double cosHea = this->dataPtr->cosHea;
+  const double sinHea = this->dataPtr->sinHea;
+
+  // The heading rotation PositionTransform applies to LOCAL input,
+  // followed by the GLOBAL to ECEF rotation and the origin offset.
+  const ignition::math::Matrix3d heading(
+      -cosHea, sinHea, 0,
+      -sinHea, -cosHea, 0,
+      0, 0, 1);
+  const ignition::math::Matrix3d rot =
+      this->dataPtr->rotGlobalToECEF * heading;
+  const ignition::math::Vector3d &trans = this->dataPtr->origin;
+
+  return ignition::math::Matrix4d(
+      rot(0, 0), rot(0, 1), rot(0, 2), trans.X(),
+      rot(1, 0), rot(1, 1), rot(1, 2), trans.Y(),
+      rot(2, 0), rot(2, 1), rot(2, 2), trans.Z(),
+      0, 0, 0, 1);
+}
+
+/////////////////////////////////////////////////
+ignition::math::Matrix4d SphericalCoordinates::LocalFromECEFMatrix() const
+{
+  const double cosHea = this->dataPtr->cosHea;
+  const double sinHea = this->dataPtr->sinHea;
+
+  // The ECEF to GLOBAL rotation about the shifted origin, followed by
+  // the heading rotation PositionTransform applies to LOCAL output.
+  const ignition::math::Matrix3d heading(
+      cosHea, -sinHea, 0,
+      sinHea, cosHea, 0,
+      0, 0, 1);
+  const ignition::math::Matrix3d rot =
+      heading * this->dataPtr->rotECEFToGlobal;
+  const ignition::math::Vector3d trans = -(rot * this->dataPtr->origin);
+
+  return ignition::math::Matrix4d(
+      rot(0, 0), rot(0, 1), rot(0, 2), trans.X(),
+      rot(1, 0), rot(1, 1), rot(1, 2), trans.Y(),
+      rot(2, 0), rot(2, 1), rot(2, 2), trans.Z(),
+      0, 0, 0, 1);
+}
+
+/////////////////////////////////////////////////
+void SphericalCoordinates::LocalFromECEFBatch(
+    const ignition::math::Vector3d *_ecef,
+    ignition::math::Vector3d *_local, size_t _n) const
+{
+  // Compose the rotation and translation once; each point then costs
+  // one matrix multiply and one add.
+  const ignition::math::Matrix4d mat = this->LocalFromECEFMatrix();
+  for (size_t i = 0; i < _n; ++i)
+    _local[i] = mat * _ecef[i];
+}
+
+/////////////////////////////////////////////////
+void SphericalCoordinates::ECEFFromLocalBatch(
+    const ignition::math::Vector3d *_local,
+    ignition::math::Vector3d *_ecef, size_t _n) const
+{
+  const ignition::math::Matrix4d mat = this->ECEFFromLocalMatrix();
+  for (size_t i = 0; i < _n; ++i)
+    _ecef[i] = mat * _local[i];
+}
+
+/////////////////////////////////////////////////
 ignition::math::Vector3d SphericalCoordinates::VelocityTransform(
     const ignition::math::Vector3d &_vel,
     const CoordinateType &_in, const CoordinateType &_out) const
@@ -16,6 +16,8 @@
 */
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/SphericalCoordinates.hh"
 
 using namespace ignition;
@@ -383,3 +385,270 @@ TEST(SphericalCoordinatesTest, AssignmentOp)
   math::SphericalCoordinates sc2 = sc1;
   EXPECT_EQ(sc1, sc2);
 }
+
+//////////////////////////////////////////////////
+// Batch position transforms match the scalar function for every
+// coordinate type combination.
+TEST(SphericalCoordinatesTest, PositionTransformBatch)
+{
+  auto st = math::SphericalCoordinates::EARTH_WGS84;
+  math::Angle lat(0.3), lon(-1.2), heading(0.5);
+  double elev = 354.1;
+  math::SphericalCoordinates sc(st, lat, lon, elev, heading);
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 10; ++i)
+  {
+    points.push_back(math::Vector3d(
+        0.05 * i - 0.2, 0.07 * i - 0.3, 100.0 * i));
+  }
+
+  std::vector<math::SphericalCoordinates::CoordinateType> types =
+  {
+    math::SphericalCoordinates::SPHERICAL,
+    math::SphericalCoordinates::ECEF,
+    math::SphericalCoordinates::GLOBAL,
+    math::SphericalCoordinates::LOCAL
+  };
+
+  for (auto inType : types)
+  {
+    for (auto outType : types)
+    {
+      std::vector<math::Vector3d> out(points.size());
+      sc.PositionTransformBatch(points.data(), out.data(), points.size(),
+          inType, outType);
+
+      for (size_t i = 0; i < points.size(); ++i)
+      {
+        math::Vector3d expected =
+            sc.PositionTransform(points[i], inType, outType);
+        EXPECT_NEAR(expected.X(), out[i].X(), 1e-9);
+        EXPECT_NEAR(expected.Y(), out[i].Y(), 1e-9);
+        EXPECT_NEAR(expected.Z(), out[i].Z(), 1e-9);
+      }
+    }
+  }
+
+  // In-place conversion is allowed.
+  std::vector<math::Vector3d> inPlace = points;
+  sc.PositionTransformBatch(inPlace.data(), inPlace.data(), inPlace.size(),
+      math::SphericalCoordinates::LOCAL,
+      math::SphericalCoordinates::SPHERICAL);
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    math::Vector3d expected = sc.PositionTransform(points[i],
+        math::SphericalCoordinates::LOCAL,
+        math::SphericalCoordinates::SPHERICAL);
+    EXPECT_NEAR(expected.X(), inPlace[i].X(), 1e-9);
+    EXPECT_NEAR(expected.Y(), inPlace[i].Y(), 1e-9);
+    EXPECT_NEAR(expected.Z(), inPlace[i].Z(), 1e-9);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, ECEFLocalMatrices)
+{
+  auto st = math::SphericalCoordinates::EARTH_WGS84;
+  math::Angle lat(0.3), lon(-1.2), heading(0.5);
+  double elev = 354.1;
+  math::SphericalCoordinates sc(st, lat, lon, elev, heading);
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 10; ++i)
+  {
+    points.push_back(math::Vector3d(
+        100.0 * i - 300.0, 70.0 * i - 200.0, 10.0 * i));
+  }
+
+  // The exposed matrices reproduce PositionTransform in both
+  // directions, including the heading conventions of the LOCAL frame.
+  const math::Matrix4d ecefFromLocal = sc.ECEFFromLocalMatrix();
+  const math::Matrix4d localFromECEF = sc.LocalFromECEFMatrix();
+  for (const auto &point : points)
+  {
+    math::Vector3d expected = sc.PositionTransform(point,
+        math::SphericalCoordinates::LOCAL,
+        math::SphericalCoordinates::ECEF);
+    math::Vector3d actual = ecefFromLocal * point;
+    EXPECT_NEAR(expected.X(), actual.X(), 1e-6);
+    EXPECT_NEAR(expected.Y(), actual.Y(), 1e-6);
+    EXPECT_NEAR(expected.Z(), actual.Z(), 1e-6);
+
+    expected = sc.PositionTransform(point,
+        math::SphericalCoordinates::ECEF,
+        math::SphericalCoordinates::LOCAL);
+    actual = localFromECEF * point;
+    EXPECT_NEAR(expected.X(), actual.X(), 1e-6);
+    EXPECT_NEAR(expected.Y(), actual.Y(), 1e-6);
+    EXPECT_NEAR(expected.Z(), actual.Z(), 1e-6);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, ECEFLocalBatch)
+{
+  auto st = math::SphericalCoordinates::EARTH_WGS84;
+  math::Angle lat(0.3), lon(-1.2), heading(0.5);
+  double elev = 354.1;
+  math::SphericalCoordinates sc(st, lat, lon, elev, heading);
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 10; ++i)
+  {
+    points.push_back(math::Vector3d(
+        100.0 * i - 300.0, 70.0 * i - 200.0, 10.0 * i));
+  }
+
+  std::vector<math::Vector3d> ecef(points.size());
+  sc.ECEFFromLocalBatch(points.data(), ecef.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    math::Vector3d expected = sc.PositionTransform(points[i],
+        math::SphericalCoordinates::LOCAL,
+        math::SphericalCoordinates::ECEF);
+    EXPECT_NEAR(expected.X(), ecef[i].X(), 1e-6);
+    EXPECT_NEAR(expected.Y(), ecef[i].Y(), 1e-6);
+    EXPECT_NEAR(expected.Z(), ecef[i].Z(), 1e-6);
+  }
+
+  std::vector<math::Vector3d> local(points.size());
+  sc.LocalFromECEFBatch(ecef.data(), local.data(), ecef.size());
+  for (size_t i = 0; i < ecef.size(); ++i)
+  {
+    math::Vector3d expected = sc.PositionTransform(ecef[i],
+        math::SphericalCoordinates::ECEF,
+        math::SphericalCoordinates::LOCAL);
+    EXPECT_NEAR(expected.X(), local[i].X(), 1e-6);
+    EXPECT_NEAR(expected.Y(), local[i].Y(), 1e-6);
+    EXPECT_NEAR(expected.Z(), local[i].Z(), 1e-6);
+  }
+
+  // In-place conversion is allowed.
+  std::vector<math::Vector3d> inPlace = points;
+  sc.ECEFFromLocalBatch(inPlace.data(), inPlace.data(), inPlace.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(inPlace[i], ecef[i]);
+}
+
+//////////////////////////////////////////////////
+// Test the precomputed tangent plane grid against the exact transforms
+TEST(SphericalCoordinatesTest, TangentPlaneGrid)
+{
+  auto st = math::SphericalCoordinates::EARTH_WGS84;
+  math::Angle lat(0.3), lon(-1.2), heading(0.5);
+  double elev = 354.1;
+  math::SphericalCoordinates sc(st, lat, lon, elev, heading);
+
+  // Without a grid, the fast paths are the exact paths.
+  math::Vector3d xyz(100.0, -200.0, 10.0);
+  EXPECT_EQ(sc.SphericalFromLocalPosition(xyz),
+      sc.SphericalFromLocalPositionFast(xyz));
+  EXPECT_EQ(0u, sc.TangentPlaneGridCellCount());
+
+  // Invalid parameters build no grid.
+  EXPECT_FALSE(sc.PrecomputeTangentPlaneGrid(
+      math::Vector2d(0, 0), math::Vector2d(100, 100), 0.0));
+  EXPECT_FALSE(sc.PrecomputeTangentPlaneGrid(
+      math::Vector2d(0, 0), math::Vector2d(-100, 100), 50.0));
+  EXPECT_EQ(0u, sc.TangentPlaneGridCellCount());
+
+  // A 4 km x 4 km region with 100 m cells.
+  ASSERT_TRUE(sc.PrecomputeTangentPlaneGrid(
+      math::Vector2d(-2000, -2000), math::Vector2d(2000, 2000), 100.0));
+  EXPECT_EQ(1600u, sc.TangentPlaneGridCellCount());
+
+  // The cached answers match the exact trigonometric path to well
+  // below a millimeter everywhere in the region.
+  for (double x = -1950.0; x < 2000.0; x += 487.0)
+  {
+    for (double y = -1950.0; y < 2000.0; y += 487.0)
+    {
+      const math::Vector3d local(x, y, 25.0);
+      const math::Vector3d exact = sc.SphericalFromLocalPosition(local);
+      const math::Vector3d fast = sc.SphericalFromLocalPositionFast(local);
+      // 1e-8 degrees is about a millimeter on the surface.
+      EXPECT_NEAR(exact.X(), fast.X(), 1e-8) << x << " " << y;
+      EXPECT_NEAR(exact.Y(), fast.Y(), 1e-8) << x << " " << y;
+      EXPECT_NEAR(exact.Z(), fast.Z(), 1e-3) << x << " " << y;
+
+      const math::Vector3d back = sc.LocalFromSphericalPositionFast(fast);
+      EXPECT_NEAR(local.X(), back.X(), 1e-3) << x << " " << y;
+      EXPECT_NEAR(local.Y(), back.Y(), 1e-3) << x << " " << y;
+      EXPECT_NEAR(local.Z(), back.Z(), 1e-3) << x << " " << y;
+    }
+  }
+
+  // Outside the region the fast path falls back to the exact one.
+  const math::Vector3d outside(25000.0, 0.0, 0.0);
+  EXPECT_EQ(sc.SphericalFromLocalPosition(outside),
+      sc.SphericalFromLocalPositionFast(outside));
+  EXPECT_EQ(sc.LocalFromSphericalPosition(math::Vector3d(40.0, 7.0, 0.0)),
+      sc.LocalFromSphericalPositionFast(math::Vector3d(40.0, 7.0, 0.0)));
+
+  // Changing a reference parameter invalidates the grid.
+  sc.SetElevationReference(10.0);
+  EXPECT_EQ(0u, sc.TangentPlaneGridCellCount());
+
+  sc.ClearTangentPlaneGrid();
+  EXPECT_EQ(0u, sc.TangentPlaneGridCellCount());
+}
+
+//////////////////////////////////////////////////
+// Test the batch haversine and the squared-chord comparison mode.
+TEST(SphericalCoordinatesTest, DistanceBatch)
+{
+  // A fan of point pairs around the Distance() test's location.
+  const size_t count = 64;
+  std::vector<double> latA(count), lonA(count), latB(count), lonB(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    latA[i] = IGN_DTOR(35.3954999) + 1e-4 * i;
+    lonA[i] = IGN_DTOR(-105.6183433) + 2e-4 * i;
+    latB[i] = IGN_DTOR(35.3980000) + 1.3e-4 * i;
+    lonB[i] = IGN_DTOR(-105.6185000) - 1e-4 * i;
+  }
+
+  // The batch agrees with the scalar Distance() pair by pair.
+  std::vector<double> distances(count, 0.0);
+  math::SphericalCoordinates::DistanceBatch(latA.data(), lonA.data(),
+      latB.data(), lonB.data(), count, distances.data());
+  for (size_t i = 0; i < count; ++i)
+  {
+    const double expected = math::SphericalCoordinates::Distance(
+        math::Angle(latA[i]), math::Angle(lonA[i]),
+        math::Angle(latB[i]), math::Angle(lonB[i]));
+    EXPECT_NEAR(distances[i], expected, 1e-9) << "pair " << i;
+  }
+
+  // The squared-chord mode gives the same threshold verdicts as the
+  // distances, without the inverse trig per pair.
+  std::vector<double> chordsSq(count, 0.0);
+  math::SphericalCoordinates::SquaredChordBatch(latA.data(), lonA.data(),
+      latB.data(), lonB.data(), count, chordsSq.data());
+  const double fence = 300.0;
+  const double fenceChordSq =
+      math::SphericalCoordinates::SquaredChordForDistance(fence);
+  size_t inside = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(chordsSq[i] <= fenceChordSq, distances[i] <= fence)
+        << "pair " << i;
+    if (distances[i] <= fence)
+      ++inside;
+  }
+  // The fence splits the fan, so both verdicts are exercised.
+  EXPECT_GT(inside, 0u);
+  EXPECT_LT(inside, count);
+
+  // A coincident pair has zero distance and zero chord.
+  double zero = -1.0;
+  math::SphericalCoordinates::DistanceBatch(latA.data(), lonA.data(),
+      latA.data(), lonA.data(), 1, &zero);
+  EXPECT_DOUBLE_EQ(zero, 0.0);
+  math::SphericalCoordinates::SquaredChordBatch(latA.data(), lonA.data(),
+      latA.data(), lonA.data(), 1, &zero);
+  EXPECT_DOUBLE_EQ(zero, 0.0);
+  EXPECT_DOUBLE_EQ(math::SphericalCoordinates::SquaredChordForDistance(0.0),
+      0.0);
+}
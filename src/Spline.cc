@@ -17,6 +17,8 @@
 // Note: Originally cribbed from Ogre3d. Modified to implement Cardinal
 // spline and catmull-rom spline
 
+#include <algorithm>
+
 #include "SplinePrivate.hh"
 #include "ignition/math/Helpers.hh"
 #include "ignition/math/Vector4.hh"
@@ -33,6 +35,8 @@ Spline::Spline()
   this->dataPtr->autoCalc = true;
   this->dataPtr->tension = 0.0;
   this->dataPtr->arcLength = INF_D;
+  this->dataPtr->arcLengthResolution = 0;
+  this->dataPtr->arcLengthTolerance = 0.0;
 }
 
 ///////////////////////////////////////////////////////////
@@ -81,6 +85,70 @@ double Spline::ArcLength(const unsigned int _index,
   return this->dataPtr->segments[_index].ArcLength(_t);
 }
 
+///////////////////////////////////////////////////////////
+void Spline::SetArcLengthTolerance(const double _tolerance)
+{
+  this->dataPtr->arcLengthTolerance = _tolerance;
+  this->Rebuild();
+}
+
+///////////////////////////////////////////////////////////
+double Spline::ArcLengthTolerance() const
+{
+  return this->dataPtr->arcLengthTolerance;
+}
+
+///////////////////////////////////////////////////////////
+void Spline::PrecomputeArcLength(const unsigned int _resolution)
+{
+  this->dataPtr->arcLengthResolution = std::max(2u, _resolution);
+  this->RebuildArcLengthTable();
+}
+
+///////////////////////////////////////////////////////////
+double Spline::FastArcLength(const double _t) const
+{
+  const auto &table = this->dataPtr->arcLengthTable;
+  if (table.size() < 2 || _t < 0.0 || _t > 1.0)
+    return this->ArcLength(_t);
+
+  const double x = _t * (table.size() - 1);
+  const size_t i = std::min<size_t>(
+      static_cast<size_t>(x), table.size() - 2);
+  return table[i] + (table[i + 1] - table[i]) * (x - i);
+}
+
+///////////////////////////////////////////////////////////
+double Spline::ParameterAtLength(const double _s) const
+{
+  if (this->dataPtr->segments.empty())
+    return INF_D;
+
+  const double total = this->dataPtr->arcLength;
+  const double s = clamp(_s, 0.0, total);
+
+  const auto &table = this->dataPtr->paramTable;
+  if (table.size() >= 2)
+  {
+    const double x = s / total * (table.size() - 1);
+    const size_t i = std::min<size_t>(
+        static_cast<size_t>(x), table.size() - 2);
+    return table[i] + (table[i + 1] - table[i]) * (x - i);
+  }
+
+  // No lookup table: bisect on the monotonic ArcLength mapping.
+  double lo = 0.0, hi = 1.0;
+  for (int iter = 0; iter < 48; ++iter)
+  {
+    const double mid = 0.5 * (lo + hi);
+    if (this->ArcLength(mid) < s)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return 0.5 * (lo + hi);
+}
+
 ///////////////////////////////////////////////////////////
 void Spline::AddPoint(const Vector3d &_p)
 {
@@ -294,7 +362,8 @@ void Spline::Rebuild()
   for (size_t i = 0 ; i < numSegments ; ++i)
   {
     this->dataPtr->segments[i].SetPoints(this->dataPtr->points[i],
-                                         this->dataPtr->points[i+1]);
+                                         this->dataPtr->points[i+1],
+                                         this->dataPtr->arcLengthTolerance);
 
     if (i > 0) {
       this->dataPtr->cumulativeArcLengths[i] =
@@ -308,6 +377,127 @@ void Spline::Rebuild()
   }
   this->dataPtr->arcLength = (this->dataPtr->cumulativeArcLengths.back()
                               + this->dataPtr->segments.back().ArcLength());
+
+  if (this->dataPtr->arcLengthResolution > 0)
+    this->RebuildArcLengthTable();
+}
+
+///////////////////////////////////////////////////////////
+void Spline::RebuildArcLengthTable()
+{
+  const unsigned int n = this->dataPtr->arcLengthResolution;
+  if (n < 2 || this->dataPtr->segments.empty())
+  {
+    this->dataPtr->arcLengthTable.clear();
+    this->dataPtr->paramTable.clear();
+    return;
+  }
+
+  // Forward table: arc length at uniform parameter steps.
+  auto &lengths = this->dataPtr->arcLengthTable;
+  lengths.resize(n + 1);
+  for (unsigned int i = 0; i <= n; ++i)
+    lengths[i] = this->ArcLength(static_cast<double>(i) / n);
+
+  // Inverse table: parameter at uniform arc length steps, derived from
+  // the forward table with a single two-pointer sweep.
+  auto &params = this->dataPtr->paramTable;
+  params.resize(n + 1);
+  const double total = this->dataPtr->arcLength;
+  unsigned int seg = 0;
+  for (unsigned int j = 0; j <= n; ++j)
+  {
+    const double target = total * j / n;
+    while (seg + 1 < n && lengths[seg + 1] < target)
+      ++seg;
+    const double span = lengths[seg + 1] - lengths[seg];
+    const double frac = span > 0.0 ? (target - lengths[seg]) / span : 0.0;
+    params[j] = (seg + clamp(frac, 0.0, 1.0)) / n;
+  }
+}
+
+///////////////////////////////////////////////////////////
+void Spline::Sample(const double *_params, const size_t _count,
+                    Vector3d *_out, const unsigned int _mth) const
+{
+  const auto &segments = this->dataPtr->segments;
+  const auto &lengths = this->dataPtr->cumulativeArcLengths;
+  if (segments.empty())
+  {
+    for (size_t i = 0; i < _count; ++i)
+      _out[i] = Vector3d(INF_D, INF_D, INF_D);
+    return;
+  }
+
+  const double total = this->dataPtr->arcLength;
+  const size_t numSegments = segments.size();
+
+  // Per-segment state, reloaded only when a sample lands on a new
+  // segment. Ribbon parameters arrive sorted or nearly sorted, so most
+  // samples reuse the coefficients of the previous one and skip both
+  // the binary search and the matrix access.
+  size_t seg = numSegments;
+  double invLength = 0.0;
+  Vector3d c0, c1, c2, c3;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double t = _params[i];
+    if (t < 0.0 || t > 1.0)
+    {
+      _out[i] = Vector3d(INF_D, INF_D, INF_D);
+      continue;
+    }
+
+    // Same segment mapping as MapToSegment.
+    const double tArc = t * total;
+    size_t index = seg;
+    if (equal(t, 1.0))
+    {
+      index = numSegments - 1;
+    }
+    else if (seg >= numSegments || tArc <= lengths[seg] ||
+             (seg + 1 < numSegments && lengths[seg + 1] < tArc))
+    {
+      auto it = std::lower_bound(lengths.begin(), lengths.end(), tArc);
+      index = it == lengths.begin() ? 0
+          : static_cast<size_t>(it - lengths.begin() - 1);
+    }
+
+    if (index != seg)
+    {
+      seg = index;
+      invLength = 1.0 / segments[seg].ArcLength();
+      const Matrix4d &coeffs = segments[seg].Coeffs();
+      c0.Set(coeffs(0, 0), coeffs(0, 1), coeffs(0, 2));
+      c1.Set(coeffs(1, 0), coeffs(1, 1), coeffs(1, 2));
+      c2.Set(coeffs(2, 0), coeffs(2, 1), coeffs(2, 2));
+      c3.Set(coeffs(3, 0), coeffs(3, 1), coeffs(3, 2));
+    }
+
+    const double u = equal(t, 1.0) ? 1.0
+        : (tArc - lengths[seg]) * invLength;
+
+    // Horner evaluation of the segment polynomial or its derivative.
+    switch (_mth)
+    {
+      case 0:
+        _out[i] = ((c0 * u + c1) * u + c2) * u + c3;
+        break;
+      case 1:
+        _out[i] = (c0 * (3 * u) + 2 * c1) * u + c2;
+        break;
+      case 2:
+        _out[i] = c0 * (6 * u) + 2 * c1;
+        break;
+      case 3:
+        _out[i] = 6 * c0;
+        break;
+      default:
+        _out[i] = Vector3d::Zero;
+        break;
+    }
+  }
 }
 
 ///////////////////////////////////////////////////////////
@@ -337,6 +527,18 @@ size_t Spline::PointCount() const
   return this->dataPtr->points.size();
 }
 
+///////////////////////////////////////////////////////////
+void Spline::Reserve(const size_t _capacity)
+{
+  this->dataPtr->points.reserve(_capacity);
+  this->dataPtr->fixings.reserve(_capacity);
+  if (_capacity > 0)
+  {
+    this->dataPtr->segments.reserve(_capacity - 1);
+    this->dataPtr->cumulativeArcLengths.reserve(_capacity - 1);
+  }
+}
+
 ///////////////////////////////////////////////////////////
 void Spline::Clear()
 {
@@ -371,6 +573,24 @@ bool Spline::UpdatePoint(const unsigned int _index,
   this->dataPtr->points[_index].Match(_point);
   this->dataPtr->fixings[_index] = _fixed;
 
+  const size_t numPoints = this->dataPtr->points.size();
+
+  // Moving an interior point of an open spline only affects the
+  // tangents of its neighbours and the segments touching them, so the
+  // full tangent recompute and segment rebuild can be skipped. Endpoint
+  // updates and closed splines couple distant points and take the full
+  // path.
+  const bool isClosed = numPoints >= 2 &&
+      this->dataPtr->points[0].MthDerivative(0) ==
+      this->dataPtr->points[numPoints - 1].MthDerivative(0);
+  if (numPoints >= 2 && !isClosed &&
+      _index > 0 && _index < numPoints - 1 &&
+      !this->dataPtr->segments.empty())
+  {
+    this->UpdateAffectedSegments(_index);
+    return true;
+  }
+
   if (this->dataPtr->autoCalc)
     this->RecalcTangents();
   else
@@ -378,6 +598,72 @@ bool Spline::UpdatePoint(const unsigned int _index,
   return true;
 }
 
+///////////////////////////////////////////////////////////
+void Spline::UpdateAffectedSegments(const unsigned int _index)
+{
+  const size_t numPoints = this->dataPtr->points.size();
+  const size_t numSegments = this->dataPtr->segments.size();
+
+  if (this->dataPtr->autoCalc)
+  {
+    // Catmull-Rom tangents depend on the two neighbouring points, so
+    // only tangents _index - 1 .. _index + 1 can change. Same formulas
+    // as RecalcTangents, open spline case.
+    const double t = 1.0 - this->dataPtr->tension;
+    const size_t first = _index > 1 ? _index - 1 : 0;
+    const size_t last = std::min<size_t>(_index + 1, numPoints - 1);
+    for (size_t i = first; i <= last; ++i)
+    {
+      if (this->dataPtr->fixings[i])
+        continue;
+
+      if (i == 0)
+      {
+        this->dataPtr->points[i].MthDerivative(1) =
+            ((this->dataPtr->points[1].MthDerivative(0) -
+              this->dataPtr->points[0].MthDerivative(0)) * 0.5) * t;
+      }
+      else if (i == numPoints - 1)
+      {
+        this->dataPtr->points[i].MthDerivative(1) =
+            ((this->dataPtr->points[i].MthDerivative(0) -
+              this->dataPtr->points[i-1].MthDerivative(0)) * 0.5) * t;
+      }
+      else
+      {
+        this->dataPtr->points[i].MthDerivative(1) =
+            ((this->dataPtr->points[i+1].MthDerivative(0) -
+              this->dataPtr->points[i-1].MthDerivative(0)) * 0.5) * t;
+      }
+    }
+  }
+
+  // Segment i depends on points i and i + 1 including their tangents,
+  // so segments _index - 2 .. _index + 1 need new coefficients.
+  const size_t firstSegment = _index > 2 ? _index - 2 : 0;
+  const size_t lastSegment = std::min<size_t>(_index + 1, numSegments - 1);
+  for (size_t i = firstSegment; i <= lastSegment; ++i)
+  {
+    this->dataPtr->segments[i].SetPoints(this->dataPtr->points[i],
+                                         this->dataPtr->points[i+1],
+                                         this->dataPtr->arcLengthTolerance);
+  }
+
+  // Only the cumulative arc length suffix behind the first rebuilt
+  // segment changes.
+  for (size_t i = std::max<size_t>(firstSegment, 1); i < numSegments; ++i)
+  {
+    this->dataPtr->cumulativeArcLengths[i] =
+        (this->dataPtr->segments[i-1].ArcLength()
+         + this->dataPtr->cumulativeArcLengths[i-1]);
+  }
+  this->dataPtr->arcLength = (this->dataPtr->cumulativeArcLengths.back()
+                              + this->dataPtr->segments.back().ArcLength());
+
+  if (this->dataPtr->arcLengthResolution > 0)
+    this->RebuildArcLengthTable();
+}
+
 ///////////////////////////////////////////////////////////
 void Spline::AutoCalculate(bool _autoCalc)
 {
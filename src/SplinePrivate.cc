@@ -15,6 +15,10 @@
  *
 */
 
+#include <cmath>
+
+#include "ignition/math/Helpers.hh"
+
 #include "ignition/math/Matrix4.hh"
 
 #include "SplinePrivate.hh"
@@ -25,28 +29,6 @@ namespace math
 {
 inline namespace IGNITION_MATH_VERSION_NAMESPACE
 {
-///////////////////////////////////////////////////////////
-Vector4d PolynomialPowers(const unsigned int _order,
-                          const double _t)
-{
-  // It is much faster to go over this table than
-  // delving into factorials and power computations.
-  double t2 = _t * _t;
-  double t3 = t2 * _t;
-  switch (_order) {
-    case 0:
-      return Vector4d(t3, t2, _t, 1.0);
-    case 1:
-      return Vector4d(3*t2, 2*_t, 1.0, 0.0);
-    case 2:
-      return Vector4d(6*_t, 2.0, 0.0, 0.0);
-    case 3:
-      return Vector4d(6.0, 0.0, 0.0, 0.0);
-    default:
-      return Vector4d(0.0, 0.0, 0.0, 0.0);
-  }
-}
-
 ///////////////////////////////////////////////////////////
 void ComputeCubicBernsteinHermiteCoeff(const ControlPoint &_startPoint,
                                        const ControlPoint &_endPoint,
@@ -85,14 +67,24 @@ IntervalCubicSpline::IntervalCubicSpline()
 
 ///////////////////////////////////////////////////////////
 void IntervalCubicSpline::SetPoints(const ControlPoint &_startPoint,
-                                    const ControlPoint &_endPoint)
+                                    const ControlPoint &_endPoint,
+                                    const double _arcLengthTolerance)
 {
   this->startPoint = _startPoint;
   this->endPoint = _endPoint;
+  this->arcLengthTolerance = _arcLengthTolerance;
 
   ComputeCubicBernsteinHermiteCoeff(
       this->startPoint, this->endPoint, this->coeffs);
 
+  // Extract the power-basis form: row r of the coefficients matrix
+  // multiplies t^(3-r), with the axes in the first three columns.
+  for (unsigned int row = 0; row < 4; ++row)
+  {
+    this->poly[3 - row] = Vector3d(this->coeffs(row, 0),
+        this->coeffs(row, 1), this->coeffs(row, 2));
+  }
+
   this->startPoint.MthDerivative(2) = this->DoInterpolateMthDerivative(2, 0.0);
   this->startPoint.MthDerivative(3) = this->DoInterpolateMthDerivative(3, 0.0);
   this->endPoint.MthDerivative(2) = this->DoInterpolateMthDerivative(2, 1.0);
@@ -107,32 +99,71 @@ double IntervalCubicSpline::ArcLength(const double _t) const
   if (_t < 0.0 || _t > 1.0)
     return INF_D;
 
+  const double whole = this->GaussLegendreLength(0.0, _t);
+  if (this->arcLengthTolerance <= 0.0)
+    return whole;
+
+  return this->AdaptiveArcLength(0.0, _t, whole,
+      this->arcLengthTolerance, 0);
+}
+
+///////////////////////////////////////////////////////////
+double IntervalCubicSpline::GaussLegendreLength(const double _a,
+                                                const double _b) const
+{
   // 5 Point Gauss-Legendre quadrature rule for numerical path integration
-  // TODO(anyone): generalize into a numerical integration toolkit ?
-  double w1 = 0.28444444444444444 * _t;
-  double w23 = 0.23931433524968326 * _t;
-  double w45 = 0.11846344252809456 * _t;
-  double x1 = 0.5 * _t;
-  double x2 = 0.23076534494715845 * _t;
-  double x3 = 0.7692346550528415 * _t;
-  double x4 = 0.0469100770306680 * _t;
-  double x5 = 0.9530899229693319 * _t;
-
-  double arc_length = w1 * this->InterpolateMthDerivative(1, x1).Length();
-  arc_length += w23 * this->InterpolateMthDerivative(1, x2).Length();
-  arc_length += w23 * this->InterpolateMthDerivative(1, x3).Length();
-  arc_length += w45 * this->InterpolateMthDerivative(1, x4).Length();
-  arc_length += w45 * this->InterpolateMthDerivative(1, x5).Length();
-  return arc_length;
+  // over [_a, _b], through the public fixed-order rule in Helpers.hh.
+  return GaussLegendre<5>::Integrate(
+      [this](const double _t)
+      {
+        return this->InterpolateMthDerivative(1, _t).Length();
+      }, _a, _b);
+}
+
+///////////////////////////////////////////////////////////
+double IntervalCubicSpline::AdaptiveArcLength(const double _a,
+    const double _b, const double _whole, const double _tolerance,
+    const unsigned int _depth) const
+{
+  // Bisect and compare against the whole-interval estimate: where the
+  // curve is nearly straight the two agree at once, while tight bends
+  // keep subdividing until the requested tolerance is met.
+  const double mid = 0.5 * (_a + _b);
+  const double left = this->GaussLegendreLength(_a, mid);
+  const double right = this->GaussLegendreLength(mid, _b);
+  const double sum = left + right;
+
+  // Bound the recursion; 20 splits resolve features one millionth of
+  // the parameter range wide.
+  if (std::abs(sum - _whole) <= _tolerance || _depth >= 20)
+    return sum;
+
+  return this->AdaptiveArcLength(_a, mid, left, 0.5 * _tolerance,
+             _depth + 1) +
+         this->AdaptiveArcLength(mid, _b, right, 0.5 * _tolerance,
+             _depth + 1);
 }
 
 ///////////////////////////////////////////////////////////
 Vector3d IntervalCubicSpline::DoInterpolateMthDerivative(
     const unsigned int _mth, const double _t) const
 {
-  Vector4d powers = PolynomialPowers(_mth, _t);
-  Vector4d interpolation = powers * this->coeffs;
-  return Vector3d(interpolation.X(), interpolation.Y(), interpolation.Z());
+  // Horner evaluation of the cached power-basis coefficients; a
+  // third of the multiplies of going through the coefficients matrix.
+  switch (_mth) {
+    case 0:
+      return ((this->poly[3] * _t + this->poly[2]) * _t +
+          this->poly[1]) * _t + this->poly[0];
+    case 1:
+      return (this->poly[3] * (3 * _t) + this->poly[2] * 2) * _t +
+          this->poly[1];
+    case 2:
+      return this->poly[3] * (6 * _t) + this->poly[2] * 2;
+    case 3:
+      return this->poly[3] * 6;
+    default:
+      return Vector3d(0.0, 0.0, 0.0);
+  }
 }
 
 ///////////////////////////////////////////////////////////
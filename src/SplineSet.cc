@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/SplineSet.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+/// \brief Magic bytes identifying the file format, including a
+/// format version in the last byte.
+const char kMagic[8] = {'I', 'G', 'N', 'S', 'P', 'L', 'N', '1'};
+}
+
+namespace ignition
+{
+namespace math
+{
+inline namespace IGNITION_MATH_VERSION_NAMESPACE
+{
+/// \internal
+/// \brief One stored spline: the raw data needed to rebuild it, plus
+/// the Spline object once it has been finalized.
+class SplineSetRecord
+{
+  /// \brief Catmull-Rom tension, in the range 0 to 1.
+  public: double tension{0.0};
+
+  /// \brief Arc length table resolution to use at finalization, or
+  /// zero to skip arc length precomputation.
+  public: unsigned int arcLengthResolution{0u};
+
+  /// \brief Control point positions.
+  public: std::vector<Vector3d> points;
+
+  /// \brief Precomputed control point tangents, one per point.
+  public: std::vector<Vector3d> tangents;
+
+  /// \brief Finalized spline, or nullptr until first access.
+  public: std::unique_ptr<Spline> spline;
+};
+
+/// \internal
+/// \brief Private data for the SplineSet class.
+class SplineSetPrivate
+{
+  /// \brief Spline names in insertion order.
+  public: std::vector<std::string> names;
+
+  /// \brief Records in insertion order, parallel to names.
+  public: std::vector<SplineSetRecord> records;
+
+  /// \brief Name to record index.
+  public: std::map<std::string, size_t> index;
+};
+}
+}
+}
+
+namespace
+{
+//////////////////////////////////////////////////
+/// \brief Append the raw bytes of a value to a buffer.
+template<typename T>
+void Pack(std::vector<char> &_buffer, const T &_value)
+{
+  const char *bytes = reinterpret_cast<const char *>(&_value);
+  _buffer.insert(_buffer.end(), bytes, bytes + sizeof(T));
+}
+
+//////////////////////////////////////////////////
+/// \brief Read the raw bytes of a value from a buffer, advancing the
+/// offset. Returns false when the buffer is too short.
+template<typename T>
+bool Unpack(const std::vector<char> &_buffer, size_t &_offset, T &_value)
+{
+  if (_buffer.size() - _offset < sizeof(T))
+    return false;
+  std::memcpy(&_value, _buffer.data() + _offset, sizeof(T));
+  _offset += sizeof(T);
+  return true;
+}
+}
+
+//////////////////////////////////////////////////
+SplineSet::SplineSet()
+    : dataPtr(new SplineSetPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+SplineSet::~SplineSet()
+{
+  delete this->dataPtr;
+  this->dataPtr = nullptr;
+}
+
+//////////////////////////////////////////////////
+void SplineSet::AddSpline(const std::string &_name, const Spline &_spline,
+    const unsigned int _arcLengthResolution)
+{
+  SplineSetRecord record;
+  record.tension = _spline.Tension();
+  record.arcLengthResolution = _arcLengthResolution;
+  const size_t count = _spline.PointCount();
+  record.points.reserve(count);
+  record.tangents.reserve(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    record.points.push_back(_spline.Point(i));
+    record.tangents.push_back(_spline.Tangent(i));
+  }
+
+  auto it = this->dataPtr->index.find(_name);
+  if (it != this->dataPtr->index.end())
+  {
+    this->dataPtr->records[it->second] = std::move(record);
+    return;
+  }
+
+  this->dataPtr->index[_name] = this->dataPtr->records.size();
+  this->dataPtr->names.push_back(_name);
+  this->dataPtr->records.push_back(std::move(record));
+}
+
+//////////////////////////////////////////////////
+size_t SplineSet::SplineCount() const
+{
+  return this->dataPtr->records.size();
+}
+
+//////////////////////////////////////////////////
+size_t SplineSet::FinalizedCount() const
+{
+  size_t count = 0;
+  for (const auto &record : this->dataPtr->records)
+  {
+    if (record.spline)
+      ++count;
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> SplineSet::Names() const
+{
+  return this->dataPtr->names;
+}
+
+//////////////////////////////////////////////////
+Spline *SplineSet::SplineByName(const std::string &_name) const
+{
+  auto it = this->dataPtr->index.find(_name);
+  if (it == this->dataPtr->index.end())
+    return nullptr;
+
+  SplineSetRecord &record = this->dataPtr->records[it->second];
+  if (!record.spline)
+  {
+    // Feed the stored tangents back as fixed tangents with automatic
+    // recalculation off, so the coefficient rebuild in RecalcTangents
+    // runs once instead of once per point and the authored tangents
+    // are kept verbatim.
+    record.spline.reset(new Spline);
+    record.spline->AutoCalculate(false);
+    record.spline->Tension(record.tension);
+    record.spline->Reserve(record.points.size());
+    for (size_t i = 0; i < record.points.size(); ++i)
+      record.spline->AddPoint(record.points[i], record.tangents[i]);
+    record.spline->AutoCalculate(true);
+    record.spline->RecalcTangents();
+    if (record.arcLengthResolution > 0u)
+      record.spline->PrecomputeArcLength(record.arcLengthResolution);
+  }
+  return record.spline.get();
+}
+
+//////////////////////////////////////////////////
+bool SplineSet::Save(const std::string &_path) const
+{
+  std::vector<char> buffer;
+  buffer.insert(buffer.end(), kMagic, kMagic + sizeof(kMagic));
+  Pack(buffer, static_cast<uint64_t>(this->dataPtr->records.size()));
+  for (size_t i = 0; i < this->dataPtr->records.size(); ++i)
+  {
+    const std::string &name = this->dataPtr->names[i];
+    const SplineSetRecord &record = this->dataPtr->records[i];
+    Pack(buffer, static_cast<uint64_t>(name.size()));
+    buffer.insert(buffer.end(), name.begin(), name.end());
+    Pack(buffer, record.tension);
+    Pack(buffer, static_cast<uint32_t>(record.arcLengthResolution));
+    Pack(buffer, static_cast<uint64_t>(record.points.size()));
+    for (size_t j = 0; j < record.points.size(); ++j)
+    {
+      Pack(buffer, record.points[j].X());
+      Pack(buffer, record.points[j].Y());
+      Pack(buffer, record.points[j].Z());
+      Pack(buffer, record.tangents[j].X());
+      Pack(buffer, record.tangents[j].Y());
+      Pack(buffer, record.tangents[j].Z());
+    }
+  }
+
+  std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+  if (!out.write(buffer.data(), buffer.size()))
+  {
+    std::cerr << "SplineSet::Save() failed to write [" << _path << "]"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SplineSet::Load(const std::string &_path)
+{
+  std::ifstream in(_path, std::ios::binary | std::ios::ate);
+  if (!in)
+  {
+    std::cerr << "SplineSet::Load() failed to open [" << _path << "]"
+              << std::endl;
+    return false;
+  }
+
+  // One sequential read of the whole file; records are then parsed
+  // out of the in-memory buffer.
+  std::vector<char> buffer(static_cast<size_t>(in.tellg()));
+  in.seekg(0);
+  if (!in.read(buffer.data(), buffer.size()))
+  {
+    std::cerr << "SplineSet::Load() failed to read [" << _path << "]"
+              << std::endl;
+    return false;
+  }
+
+  if (buffer.size() < sizeof(kMagic) ||
+      std::memcmp(buffer.data(), kMagic, sizeof(kMagic)) != 0)
+  {
+    std::cerr << "SplineSet::Load() unrecognized format in [" << _path
+              << "]" << std::endl;
+    return false;
+  }
+
+  // Parse into a fresh private instance so a malformed file leaves
+  // this set unchanged.
+  std::unique_ptr<SplineSetPrivate> loaded(new SplineSetPrivate);
+  size_t offset = sizeof(kMagic);
+  uint64_t recordCount = 0;
+  bool valid = Unpack(buffer, offset, recordCount);
+  for (uint64_t i = 0; valid && i < recordCount; ++i)
+  {
+    uint64_t nameLen = 0;
+    valid = Unpack(buffer, offset, nameLen) &&
+        buffer.size() - offset >= nameLen;
+    if (!valid)
+      break;
+    std::string name(buffer.data() + offset,
+        static_cast<size_t>(nameLen));
+    offset += static_cast<size_t>(nameLen);
+
+    SplineSetRecord record;
+    uint32_t resolution = 0;
+    uint64_t pointCount = 0;
+    valid = Unpack(buffer, offset, record.tension) &&
+        Unpack(buffer, offset, resolution) &&
+        Unpack(buffer, offset, pointCount) &&
+        (buffer.size() - offset) / (6 * sizeof(double)) >= pointCount;
+    if (!valid)
+      break;
+    record.arcLengthResolution = resolution;
+    record.points.reserve(static_cast<size_t>(pointCount));
+    record.tangents.reserve(static_cast<size_t>(pointCount));
+    for (uint64_t j = 0; j < pointCount; ++j)
+    {
+      double values[6];
+      for (int k = 0; k < 6; ++k)
+        Unpack(buffer, offset, values[k]);
+      record.points.push_back(Vector3d(values[0], values[1], values[2]));
+      record.tangents.push_back(Vector3d(values[3], values[4], values[5]));
+    }
+
+    if (loaded->index.find(name) != loaded->index.end())
+    {
+      valid = false;
+      break;
+    }
+    loaded->index[name] = loaded->records.size();
+    loaded->names.push_back(name);
+    loaded->records.push_back(std::move(record));
+  }
+
+  if (!valid)
+  {
+    std::cerr << "SplineSet::Load() truncated or malformed file ["
+              << _path << "]" << std::endl;
+    return false;
+  }
+
+  delete this->dataPtr;
+  this->dataPtr = loaded.release();
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SplineSet::Clear()
+{
+  this->dataPtr->names.clear();
+  this->dataPtr->records.clear();
+  this->dataPtr->index.clear();
+}
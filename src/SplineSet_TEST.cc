@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/SplineSet.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(SplineSetTest, SaveLoadRoundTrip)
+{
+  const std::string path = "SplineSet_TEST_roundtrip.bin";
+
+  math::Spline laneA;
+  laneA.Tension(0.4);
+  laneA.AddPoint(math::Vector3d(0, 0, 0));
+  laneA.AddPoint(math::Vector3d(1, 0.5, 0));
+  laneA.AddPoint(math::Vector3d(2, 0.5, 0.25));
+  laneA.AddPoint(math::Vector3d(3, 0, 0.25));
+
+  math::Spline laneB;
+  laneB.AddPoint(math::Vector3d(0, 2, 0));
+  laneB.AddPoint(math::Vector3d(1, 2, 0));
+  laneB.AddPoint(math::Vector3d(2, 3, 0));
+
+  math::SplineSet saved;
+  saved.AddSpline("laneA", laneA);
+  saved.AddSpline("laneB", laneB, 0u);
+  EXPECT_EQ(2u, saved.SplineCount());
+  ASSERT_TRUE(saved.Save(path));
+
+  math::SplineSet loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(2u, loaded.SplineCount());
+  ASSERT_EQ(2u, loaded.Names().size());
+  EXPECT_EQ("laneA", loaded.Names()[0]);
+  EXPECT_EQ("laneB", loaded.Names()[1]);
+
+  // Loading parses records only; splines are finalized on first use.
+  EXPECT_EQ(0u, loaded.FinalizedCount());
+
+  math::Spline *a = loaded.SplineByName("laneA");
+  ASSERT_NE(nullptr, a);
+  EXPECT_EQ(1u, loaded.FinalizedCount());
+  EXPECT_DOUBLE_EQ(0.4, a->Tension());
+  EXPECT_EQ(4u, a->PointCount());
+
+  // The loaded spline interpolates exactly as the original: the
+  // stored tangents are restored verbatim, not recomputed.
+  for (double t = 0.0; t <= 1.0; t += 0.125)
+  {
+    EXPECT_EQ(laneA.Interpolate(t), a->Interpolate(t)) << t;
+    EXPECT_EQ(laneA.InterpolateTangent(t), a->InterpolateTangent(t)) << t;
+  }
+  EXPECT_NEAR(laneA.ArcLength(), a->FastArcLength(1.0), 1e-3);
+
+  // Repeated access returns the same finalized object.
+  EXPECT_EQ(a, loaded.SplineByName("laneA"));
+  EXPECT_EQ(1u, loaded.FinalizedCount());
+
+  math::Spline *b = loaded.SplineByName("laneB");
+  ASSERT_NE(nullptr, b);
+  EXPECT_EQ(2u, loaded.FinalizedCount());
+  EXPECT_EQ(laneB.Interpolate(0.5), b->Interpolate(0.5));
+
+  std::remove(path.c_str());
+}
+
+/////////////////////////////////////////////////
+TEST(SplineSetTest, Errors)
+{
+  const std::string path = "SplineSet_TEST_errors.bin";
+
+  math::SplineSet set;
+  EXPECT_EQ(nullptr, set.SplineByName("missing"));
+  EXPECT_FALSE(set.Load("SplineSet_TEST_no_such_file.bin"));
+
+  // A file with the wrong magic is rejected.
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "not a spline set";
+  }
+  EXPECT_FALSE(set.Load(path));
+
+  // A truncated file is rejected and leaves the set unchanged.
+  math::Spline lane;
+  lane.AddPoint(math::Vector3d(0, 0, 0));
+  lane.AddPoint(math::Vector3d(1, 1, 0));
+  set.AddSpline("lane", lane);
+  ASSERT_TRUE(set.Save(path));
+  {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::string data(static_cast<size_t>(in.tellg()) / 2, '\0');
+    in.seekg(0);
+    in.read(&data[0], data.size());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << data;
+  }
+  EXPECT_FALSE(set.Load(path));
+  EXPECT_EQ(1u, set.SplineCount());
+  EXPECT_NE(nullptr, set.SplineByName("lane"));
+
+  // AddSpline under an existing name replaces the record.
+  math::Spline other;
+  other.AddPoint(math::Vector3d(5, 5, 5));
+  other.AddPoint(math::Vector3d(6, 6, 6));
+  set.AddSpline("lane", other);
+  EXPECT_EQ(1u, set.SplineCount());
+  EXPECT_EQ(other.Interpolate(0.5),
+      set.SplineByName("lane")->Interpolate(0.5));
+
+  set.Clear();
+  EXPECT_EQ(0u, set.SplineCount());
+  EXPECT_EQ(nullptr, set.SplineByName("lane"));
+
+  std::remove(path.c_str());
+}
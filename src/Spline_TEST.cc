@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "ignition/math/Vector3.hh"
 #include "ignition/math/Spline.hh"
 
@@ -177,3 +180,221 @@ TEST(SplineTest, RecalcTangents)
   EXPECT_EQ(s.Interpolate(0, 0.5), math::Vector3d(0.2, 0.2, 0.2));
   EXPECT_EQ(s.Interpolate(1, 0.5), math::Vector3d(0.2, 0.2, 0.2));
 }
+
+/////////////////////////////////////////////////
+TEST(SplineTest, ArcLengthLookupTable)
+{
+  math::Spline s;
+  s.AddPoint(math::Vector3d(0, 0, 0));
+  s.AddPoint(math::Vector3d(1, 1, 0));
+  s.AddPoint(math::Vector3d(3, 0, 2));
+  s.AddPoint(math::Vector3d(4, 4, 4));
+
+  // Without a table, FastArcLength falls back to the exact value and
+  // ParameterAtLength bisects.
+  EXPECT_DOUBLE_EQ(s.FastArcLength(0.35), s.ArcLength(0.35));
+  double tInv = s.ParameterAtLength(s.ArcLength(0.35));
+  EXPECT_NEAR(s.ArcLength(tInv), s.ArcLength(0.35), 1e-6);
+
+  s.PrecomputeArcLength(512);
+
+  for (double t : {0.0, 0.1, 0.35, 0.5, 0.77, 1.0})
+  {
+    const double exact = s.ArcLength(t);
+    EXPECT_NEAR(s.FastArcLength(t), exact, 1e-3 * s.ArcLength());
+
+    // Round trip: parameter -> length -> parameter.
+    const double tBack = s.ParameterAtLength(exact);
+    EXPECT_NEAR(s.ArcLength(tBack), exact, 1e-3 * s.ArcLength());
+  }
+
+  // Out of range values clamp or report errors like the exact methods.
+  EXPECT_DOUBLE_EQ(s.ParameterAtLength(-1.0), 0.0);
+  EXPECT_NEAR(s.ParameterAtLength(s.ArcLength() + 10.0), 1.0, 1e-9);
+
+  // The table refreshes when the spline changes.
+  s.AddPoint(math::Vector3d(10, 4, 4));
+  EXPECT_NEAR(s.FastArcLength(1.0), s.ArcLength(), 1e-3 * s.ArcLength());
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, Reserve)
+{
+  math::Spline s;
+  s.Reserve(50);
+  for (int i = 0; i < 50; ++i)
+    s.AddPoint(math::Vector3d(i, 2.0 * i, 0));
+  EXPECT_EQ(50u, s.PointCount());
+  EXPECT_DOUBLE_EQ(1.0, s.ArcLength(1.0) / s.ArcLength());
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, UpdatePointFastPath)
+{
+  // An open spline updated in place matches one rebuilt from scratch.
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 12; ++i)
+    points.push_back(math::Vector3d(i, std::sin(0.5 * i), 0.1 * i));
+
+  math::Spline updated;
+  for (auto const &p : points)
+    updated.AddPoint(p);
+
+  // Move interior points, the ones the fast path covers.
+  points[1] = math::Vector3d(1.5, 2.0, 0.3);
+  points[5] = math::Vector3d(4.5, -1.0, 0.7);
+  points[10] = math::Vector3d(10.2, 0.5, 1.2);
+  EXPECT_TRUE(updated.UpdatePoint(1, points[1]));
+  EXPECT_TRUE(updated.UpdatePoint(5, points[5]));
+  EXPECT_TRUE(updated.UpdatePoint(10, points[10]));
+
+  math::Spline rebuilt;
+  for (auto const &p : points)
+    rebuilt.AddPoint(p);
+
+  EXPECT_DOUBLE_EQ(rebuilt.ArcLength(), updated.ArcLength());
+  for (unsigned int i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(rebuilt.Point(i), updated.Point(i)) << "point " << i;
+    EXPECT_EQ(rebuilt.Tangent(i), updated.Tangent(i)) << "point " << i;
+  }
+  for (double t = 0.0; t <= 1.0; t += 0.05)
+  {
+    EXPECT_EQ(rebuilt.Interpolate(t), updated.Interpolate(t)) << "t " << t;
+    EXPECT_DOUBLE_EQ(rebuilt.ArcLength(t), updated.ArcLength(t))
+        << "t " << t;
+  }
+
+  // Endpoint updates still take the full recompute path.
+  points[0] = math::Vector3d(-1, -1, 0);
+  EXPECT_TRUE(updated.UpdatePoint(0, points[0]));
+  math::Spline rebuilt2;
+  for (auto const &p : points)
+    rebuilt2.AddPoint(p);
+  EXPECT_DOUBLE_EQ(rebuilt2.ArcLength(), updated.ArcLength());
+  for (unsigned int i = 0; i < points.size(); ++i)
+    EXPECT_EQ(rebuilt2.Tangent(i), updated.Tangent(i)) << "point " << i;
+
+  // Fixed-tangent updates keep the supplied tangent.
+  EXPECT_TRUE(updated.UpdatePoint(5, math::Vector3d(5, 5, 5),
+      math::Vector3d(0, 0, 1)));
+  EXPECT_EQ(math::Vector3d(0, 0, 1), updated.Tangent(5));
+
+  // Out of range updates are still rejected.
+  EXPECT_FALSE(updated.UpdatePoint(12, math::Vector3d::Zero));
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, Sample)
+{
+  math::Spline s;
+  for (int i = 0; i < 8; ++i)
+    s.AddPoint(math::Vector3d(i, std::cos(0.7 * i), std::sin(0.7 * i)));
+
+  // Sorted ribbon parameters, the intended use case.
+  std::vector<double> params;
+  for (int i = 0; i <= 200; ++i)
+    params.push_back(i / 200.0);
+
+  for (unsigned int mth = 0; mth <= 3; ++mth)
+  {
+    std::vector<math::Vector3d> samples(params.size());
+    s.Sample(params.data(), params.size(), samples.data(), mth);
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+      const math::Vector3d expected =
+          s.InterpolateMthDerivative(mth, params[i]);
+      EXPECT_NEAR(expected.X(), samples[i].X(), 1e-9)
+          << "mth " << mth << " t " << params[i];
+      EXPECT_NEAR(expected.Y(), samples[i].Y(), 1e-9)
+          << "mth " << mth << " t " << params[i];
+      EXPECT_NEAR(expected.Z(), samples[i].Z(), 1e-9)
+          << "mth " << mth << " t " << params[i];
+    }
+  }
+
+  // Unsorted parameters still map to the right segments.
+  std::vector<double> shuffled = {0.9, 0.1, 0.5, 0.95, 0.02, 0.5};
+  std::vector<math::Vector3d> samples(shuffled.size());
+  s.Sample(shuffled.data(), shuffled.size(), samples.data());
+  for (size_t i = 0; i < shuffled.size(); ++i)
+  {
+    const math::Vector3d expected = s.Interpolate(shuffled[i]);
+    EXPECT_NEAR(expected.X(), samples[i].X(), 1e-9);
+    EXPECT_NEAR(expected.Y(), samples[i].Y(), 1e-9);
+    EXPECT_NEAR(expected.Z(), samples[i].Z(), 1e-9);
+  }
+
+  // Out of range parameters yield infinities, like the scalar call.
+  const double bad[] = {-0.1, 1.1};
+  math::Vector3d badOut[2];
+  s.Sample(bad, 2, badOut);
+  EXPECT_FALSE(badOut[0].IsFinite());
+  EXPECT_FALSE(badOut[1].IsFinite());
+
+  // An empty spline yields infinities everywhere.
+  math::Spline empty;
+  math::Vector3d out;
+  const double t = 0.5;
+  empty.Sample(&t, 1, &out);
+  EXPECT_FALSE(out.IsFinite());
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, ArcLengthTolerance)
+{
+  // A hairpin: the middle segments bend sharply, where the fixed
+  // 5 point rule under-resolves the speed integrand.
+  math::Spline curve;
+  curve.AddPoint(math::Vector3d(0, 0, 0));
+  curve.AddPoint(math::Vector3d(4, 0, 0));
+  curve.AddPoint(math::Vector3d(4.2, 0.1, 0));
+  curve.AddPoint(math::Vector3d(0, 0.2, 0));
+
+  // Dense chord-length reference.
+  double reference = 0.0;
+  math::Vector3d prev = curve.Interpolate(0.0);
+  const int samples = 200000;
+  for (int i = 1; i <= samples; ++i)
+  {
+    const math::Vector3d point =
+        curve.Interpolate(static_cast<double>(i) / samples);
+    reference += point.Distance(prev);
+    prev = point;
+  }
+
+  EXPECT_DOUBLE_EQ(0.0, curve.ArcLengthTolerance());
+  const double fixedRule = curve.ArcLength();
+
+  curve.SetArcLengthTolerance(1e-10);
+  EXPECT_DOUBLE_EQ(1e-10, curve.ArcLengthTolerance());
+  const double adaptive = curve.ArcLength();
+
+  // The adaptive estimate meets the reference much more closely than
+  // the fixed rule on this curve.
+  EXPECT_NEAR(reference, adaptive, 1e-6);
+  EXPECT_LT(std::abs(reference - adaptive),
+            std::abs(reference - fixedRule));
+
+  // Partial arc lengths stay monotonic and consistent.
+  double last = 0.0;
+  for (int i = 1; i <= 10; ++i)
+  {
+    const double s = curve.ArcLength(i / 10.0);
+    EXPECT_GE(s, last);
+    last = s;
+  }
+  EXPECT_DOUBLE_EQ(adaptive, last);
+
+  // On a straight spline both rules agree with the exact length.
+  math::Spline line;
+  line.AddPoint(math::Vector3d(0, 0, 0));
+  line.AddPoint(math::Vector3d(1, 2, 2));
+  EXPECT_NEAR(3.0, line.ArcLength(), 1e-12);
+  line.SetArcLengthTolerance(1e-12);
+  EXPECT_NEAR(3.0, line.ArcLength(), 1e-12);
+
+  // Disabling the tolerance restores the fixed rule.
+  curve.SetArcLengthTolerance(0.0);
+  EXPECT_DOUBLE_EQ(fixedRule, curve.ArcLength());
+}
@@ -14,6 +14,9 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cstddef>
+#include "ignition/math/SignalStats.hh"
 #include "ignition/math/Temperature.hh"
 
 /// \brief Private data for the Temperature class.
@@ -62,12 +65,44 @@ double Temperature::KelvinToCelsius(const double _temp)
   return _temp - 273.15;
 }
 
+//////////////////////////////////////////////////
+void Temperature::KelvinToCelsius(const double *_temps, double *_out,
+    const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = _temps[i] - 273.15;
+}
+
+/////////////////////////////////////////////////
+void Temperature::KelvinToCelsiusAccumulate(const double *_temps,
+    const size_t _count, SignalStats &_stats)
+{
+  // Convert into a cache-resident chunk and hand each chunk to the
+  // batched statistics insert, so the Celsius values are consumed
+  // before they are evicted.
+  double chunk[256];
+  for (size_t i = 0; i < _count; i += 256)
+  {
+    const size_t n = std::min<size_t>(256, _count - i);
+    KelvinToCelsius(_temps + i, chunk, n);
+    _stats.InsertData(chunk, n);
+  }
+}
+
 /////////////////////////////////////////////////
 double Temperature::KelvinToFahrenheit(const double _temp)
 {
   return _temp * 1.8 - 459.67;
 }
 
+//////////////////////////////////////////////////
+void Temperature::KelvinToFahrenheit(const double *_temps, double *_out,
+    const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = _temps[i] * 1.8 - 459.67;
+}
+
 /////////////////////////////////////////////////
 double Temperature::CelsiusToFahrenheit(const double _temp)
 {
@@ -80,6 +115,14 @@ double Temperature::CelsiusToKelvin(const double _temp)
   return _temp + 273.15;
 }
 
+//////////////////////////////////////////////////
+void Temperature::CelsiusToKelvin(const double *_temps, double *_out,
+    const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = _temps[i] + 273.15;
+}
+
 /////////////////////////////////////////////////
 double Temperature::FahrenheitToCelsius(const double _temp)
 {
@@ -92,6 +135,14 @@ double Temperature::FahrenheitToKelvin(const double _temp)
   return (_temp + 459.67) / 1.8;
 }
 
+//////////////////////////////////////////////////
+void Temperature::FahrenheitToKelvin(const double *_temps, double *_out,
+    const size_t _count)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _out[i] = (_temps[i] + 459.67) / 1.8;
+}
+
 /////////////////////////////////////////////////
 void Temperature::SetKelvin(const double _temp)
 {
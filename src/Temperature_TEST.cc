@@ -15,7 +15,9 @@
  *
 */
 #include <gtest/gtest.h>
+#include <vector>
 
+#include "ignition/math/SignalStats.hh"
 #include "ignition/math/Temperature.hh"
 
 using namespace ignition;
@@ -170,6 +172,84 @@ TEST(TemperatureTest, Negative)
   EXPECT_NEAR(temp5.Kelvin(), 2.0, 1e-6);
 }
 
+/////////////////////////////////////////////////
+TEST(TemperatureTest, BatchConversions)
+{
+  std::vector<double> kelvin;
+  for (int i = 0; i < 100; ++i)
+    kelvin.push_back(200.0 + 1.5 * i);
+
+  // Each batch matches the scalar conversion element by element.
+  std::vector<double> out(kelvin.size());
+  math::Temperature::KelvinToCelsius(kelvin.data(), out.data(),
+      kelvin.size());
+  for (size_t i = 0; i < kelvin.size(); ++i)
+    EXPECT_DOUBLE_EQ(math::Temperature::KelvinToCelsius(kelvin[i]), out[i]);
+
+  math::Temperature::KelvinToFahrenheit(kelvin.data(), out.data(),
+      kelvin.size());
+  for (size_t i = 0; i < kelvin.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(math::Temperature::KelvinToFahrenheit(kelvin[i]),
+        out[i]);
+  }
+
+  // Celsius -> Kelvin -> Fahrenheit -> Kelvin round trip, in place.
+  std::vector<double> buffer(kelvin);
+  math::Temperature::KelvinToFahrenheit(buffer.data(), buffer.data(),
+      buffer.size());
+  math::Temperature::FahrenheitToKelvin(buffer.data(), buffer.data(),
+      buffer.size());
+  for (size_t i = 0; i < kelvin.size(); ++i)
+    EXPECT_NEAR(kelvin[i], buffer[i], 1e-12);
+
+  math::Temperature::KelvinToCelsius(buffer.data(), buffer.data(),
+      buffer.size());
+  math::Temperature::CelsiusToKelvin(buffer.data(), buffer.data(),
+      buffer.size());
+  for (size_t i = 0; i < kelvin.size(); ++i)
+    EXPECT_NEAR(kelvin[i], buffer[i], 1e-12);
+
+  // Zero count is a no-op.
+  math::Temperature::KelvinToCelsius(nullptr, nullptr, 0);
+}
+
+/////////////////////////////////////////////////
+TEST(TemperatureTest, ConvertAndAccumulate)
+{
+  // Enough samples to span several of the fused pass's internal
+  // chunks, with an odd tail.
+  std::vector<double> kelvin;
+  for (int i = 0; i < 1000; ++i)
+    kelvin.push_back(250.0 + 0.1 * i);
+
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistic("max"));
+  EXPECT_TRUE(stats.InsertStatistic("min"));
+  EXPECT_TRUE(stats.InsertStatistic("mean"));
+
+  math::Temperature::KelvinToCelsiusAccumulate(kelvin.data(),
+      kelvin.size(), stats);
+
+  // The fused pass matches converting then inserting sample by
+  // sample.
+  math::SignalStats expected;
+  EXPECT_TRUE(expected.InsertStatistic("max"));
+  EXPECT_TRUE(expected.InsertStatistic("min"));
+  EXPECT_TRUE(expected.InsertStatistic("mean"));
+  for (const double k : kelvin)
+    expected.InsertData(math::Temperature::KelvinToCelsius(k));
+
+  EXPECT_EQ(expected.Count(), stats.Count());
+  const auto expectedMap = expected.Map();
+  for (const auto &stat : stats.Map())
+    EXPECT_DOUBLE_EQ(expectedMap.at(stat.first), stat.second);
+
+  // Zero count leaves the statistics untouched.
+  math::Temperature::KelvinToCelsiusAccumulate(nullptr, 0, stats);
+  EXPECT_EQ(expected.Count(), stats.Count());
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "ignition/math/Matrix3.hh"
+#include "ignition/math/Matrix4.hh"
+#include "ignition/math/Pose3.hh"
+#include "ignition/math/Quaternion.hh"
+#include "ignition/math/Vector2.hh"
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/Vector4.hh"
+
+namespace ignition
+{
+namespace math
+{
+inline namespace IGNITION_MATH_VERSION_NAMESPACE
+{
+// Definitions for the explicit instantiation declarations in the
+// headers: the common instantiations compile once here instead of in
+// every translation unit that includes the headers, which cuts both
+// compile time and the duplicated weak symbols the linker would
+// otherwise fold. Keep this list in sync with the extern template
+// declarations next to each class's typedefs.
+template class Vector2<int>;
+template class Vector2<double>;
+template class Vector2<float>;
+template class Vector3<int>;
+template class Vector3<double>;
+template class Vector3<float>;
+template class Vector4<int>;
+template class Vector4<double>;
+template class Vector4<float>;
+template class Matrix3<int>;
+template class Matrix3<double>;
+template class Matrix3<float>;
+template class Matrix4<int>;
+template class Matrix4<double>;
+template class Matrix4<float>;
+template class Quaternion<int>;
+template class Quaternion<double>;
+template class Quaternion<float>;
+template class Pose3<double>;
+}
+}
+}
@@ -0,0 +1,477 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/TrajectoryLog.hh"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief File magic; the trailing digit versions the format.
+  const char kMagic[8] = {'I', 'G', 'N', 'T', 'R', 'J', '0', '1'};
+
+  /// \brief On-disk header preceding the records.
+  struct FileHeader
+  {
+    /// \brief Must equal kMagic.
+    char magic[8];
+
+    /// \brief The RecordType value of the payload.
+    uint32_t type;
+
+    /// \brief Reserved, written as zero.
+    uint32_t reserved;
+  };
+
+  /// \brief Doubles per record for a payload type, time included.
+  size_t RecordDoubles(const TrajectoryLog::RecordType _type)
+  {
+    return _type == TrajectoryLog::RecordType::POSE3 ? 8 : 4;
+  }
+}
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE
+    {
+    /// \internal
+    /// \brief Private data for the TrajectoryLog class.
+    class TrajectoryLogPrivate
+    {
+      /// \brief Stdio handle, used for appends and as the read
+      /// fallback where mapping is unavailable.
+      public: std::FILE *file = nullptr;
+
+      /// \brief Payload type of the open file.
+      public: TrajectoryLog::RecordType type =
+          TrajectoryLog::RecordType::POSE3;
+
+      /// \brief Doubles per record, time included.
+      public: size_t stride = 8;
+
+      /// \brief Records already on disk.
+      public: size_t fileRecords = 0;
+
+      /// \brief Write-behind buffer of complete records.
+      public: std::vector<double> pending;
+
+      /// \brief Records the buffer holds before it is written out.
+      public: static const size_t kPendingRecords = 1024;
+
+#ifndef _WIN32
+      /// \brief The mapped file, or nullptr before the first read.
+      public: void *map = nullptr;
+
+      /// \brief Size of the mapping in bytes.
+      public: size_t mapSize = 0;
+#endif
+
+      /// \brief Destructor.
+      public: ~TrajectoryLogPrivate()
+      {
+        this->CloseFile();
+      }
+
+      /// \brief Close the handle and drop the mapping.
+      public: void CloseFile()
+      {
+#ifndef _WIN32
+        if (this->map)
+        {
+          munmap(this->map, this->mapSize);
+          this->map = nullptr;
+          this->mapSize = 0;
+        }
+#endif
+        if (this->file)
+        {
+          std::fclose(this->file);
+          this->file = nullptr;
+        }
+        this->fileRecords = 0;
+        this->pending.clear();
+      }
+
+      /// \brief Write the pending records out.
+      /// \return True on success.
+      public: bool WritePending()
+      {
+        if (this->pending.empty())
+          return true;
+
+        const size_t records = this->pending.size() / this->stride;
+        if (std::fwrite(this->pending.data(), sizeof(double),
+            this->pending.size(), this->file) != this->pending.size())
+        {
+          std::cerr << "TrajectoryLog error: append failed" << std::endl;
+          return false;
+        }
+        std::fflush(this->file);
+        this->fileRecords += records;
+        this->pending.clear();
+        return true;
+      }
+
+      /// \brief Get a pointer to a record's doubles, remapping if the
+      /// file grew past the current mapping. Returns nullptr where
+      /// mapping is unavailable; ReadRecord then falls back to seeked
+      /// reads.
+      /// \param[in] _index Record index; must be on disk.
+      /// \return The record's doubles, or nullptr.
+      public: const double *MappedRecord(const size_t _index)
+      {
+#ifndef _WIN32
+        const size_t needed = sizeof(FileHeader) +
+            (_index + 1) * this->stride * sizeof(double);
+        if (this->mapSize < needed)
+        {
+          if (this->map)
+          {
+            munmap(this->map, this->mapSize);
+            this->map = nullptr;
+            this->mapSize = 0;
+          }
+          const size_t total = sizeof(FileHeader) +
+              this->fileRecords * this->stride * sizeof(double);
+          void *mapped = mmap(nullptr, total, PROT_READ, MAP_SHARED,
+              fileno(this->file), 0);
+          if (mapped == MAP_FAILED)
+            return nullptr;
+          this->map = mapped;
+          this->mapSize = total;
+        }
+        return reinterpret_cast<const double *>(
+            static_cast<const char *>(this->map) + sizeof(FileHeader)) +
+            _index * this->stride;
+#else
+        static_cast<void>(_index);
+        return nullptr;
+#endif
+      }
+
+      /// \brief Read one record into a stride-sized buffer.
+      /// \param[in] _index Record index; must be less than the total
+      /// record count.
+      /// \param[out] _record Destination for stride doubles.
+      /// \return True on success.
+      public: bool ReadRecord(const size_t _index, double *_record)
+      {
+        // Buffered records are still in memory.
+        if (_index >= this->fileRecords)
+        {
+          const size_t offset =
+              (_index - this->fileRecords) * this->stride;
+          std::memcpy(_record, this->pending.data() + offset,
+              this->stride * sizeof(double));
+          return true;
+        }
+
+        const double *mapped = this->MappedRecord(_index);
+        if (mapped)
+        {
+          std::memcpy(_record, mapped, this->stride * sizeof(double));
+          return true;
+        }
+
+        // Seeked-read fallback; restore the append position after.
+        const long pos = std::ftell(this->file);
+        if (std::fseek(this->file, static_cast<long>(sizeof(FileHeader) +
+            _index * this->stride * sizeof(double)), SEEK_SET) != 0 ||
+            std::fread(_record, sizeof(double), this->stride,
+            this->file) != this->stride)
+        {
+          std::fseek(this->file, pos, SEEK_SET);
+          return false;
+        }
+        std::fseek(this->file, pos, SEEK_SET);
+        return true;
+      }
+
+      /// \brief Get the time of a record, preferring the mapping so a
+      /// binary search only touches one value per probe.
+      /// \param[in] _index Record index.
+      /// \return The record time, or NaN on failure.
+      public: double RecordTime(const size_t _index)
+      {
+        if (_index >= this->fileRecords)
+        {
+          return this->pending[
+              (_index - this->fileRecords) * this->stride];
+        }
+        const double *mapped = this->MappedRecord(_index);
+        if (mapped)
+          return *mapped;
+
+        double record[8];
+        if (!this->ReadRecord(_index, record))
+          return std::numeric_limits<double>::quiet_NaN();
+        return record[0];
+      }
+    };
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+TrajectoryLog::TrajectoryLog()
+  : dataPtr(new TrajectoryLogPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+TrajectoryLog::~TrajectoryLog()
+{
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Open(const std::string &_path, const RecordType _type)
+{
+  this->Close();
+
+  // Try an existing file first, then create one.
+  bool created = false;
+  std::FILE *file = std::fopen(_path.c_str(), "r+b");
+  if (!file)
+  {
+    file = std::fopen(_path.c_str(), "w+b");
+    created = true;
+  }
+  if (!file)
+  {
+    std::cerr << "TrajectoryLog error: cannot open [" << _path << "]"
+              << std::endl;
+    return false;
+  }
+
+  FileHeader header;
+  if (created)
+  {
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.type = static_cast<uint32_t>(_type);
+    header.reserved = 0;
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1)
+    {
+      std::cerr << "TrajectoryLog error: cannot write header to ["
+                << _path << "]" << std::endl;
+      std::fclose(file);
+      return false;
+    }
+    std::fflush(file);
+  }
+  else
+  {
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.type != static_cast<uint32_t>(_type))
+    {
+      std::cerr << "TrajectoryLog error: [" << _path << "] is not a"
+                << " trajectory log of the requested type" << std::endl;
+      std::fclose(file);
+      return false;
+    }
+  }
+
+  this->dataPtr->file = file;
+  this->dataPtr->type = _type;
+  this->dataPtr->stride = RecordDoubles(_type);
+
+  // Derive the record count from the file size.
+  std::fseek(file, 0, SEEK_END);
+  const long size = std::ftell(file);
+  this->dataPtr->fileRecords = (static_cast<size_t>(size) -
+      sizeof(FileHeader)) / (this->dataPtr->stride * sizeof(double));
+
+  this->dataPtr->pending.reserve(
+      TrajectoryLogPrivate::kPendingRecords * this->dataPtr->stride);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void TrajectoryLog::Close()
+{
+  if (this->dataPtr->file)
+    this->dataPtr->WritePending();
+  this->dataPtr->CloseFile();
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Valid() const
+{
+  return this->dataPtr->file != nullptr;
+}
+
+//////////////////////////////////////////////////
+TrajectoryLog::RecordType TrajectoryLog::Type() const
+{
+  return this->dataPtr->type;
+}
+
+//////////////////////////////////////////////////
+size_t TrajectoryLog::Count() const
+{
+  return this->dataPtr->fileRecords +
+      this->dataPtr->pending.size() / this->dataPtr->stride;
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Append(const double _time, const Vector3d &_point)
+{
+  if (!this->Valid() || this->dataPtr->type != RecordType::VECTOR3)
+    return false;
+
+  this->dataPtr->pending.push_back(_time);
+  this->dataPtr->pending.push_back(_point.X());
+  this->dataPtr->pending.push_back(_point.Y());
+  this->dataPtr->pending.push_back(_point.Z());
+
+  if (this->dataPtr->pending.size() >= this->dataPtr->stride *
+      TrajectoryLogPrivate::kPendingRecords)
+  {
+    return this->dataPtr->WritePending();
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Append(const double _time, const Pose3d &_pose)
+{
+  if (!this->Valid() || this->dataPtr->type != RecordType::POSE3)
+    return false;
+
+  this->dataPtr->pending.push_back(_time);
+  this->dataPtr->pending.push_back(_pose.Pos().X());
+  this->dataPtr->pending.push_back(_pose.Pos().Y());
+  this->dataPtr->pending.push_back(_pose.Pos().Z());
+  this->dataPtr->pending.push_back(_pose.Rot().W());
+  this->dataPtr->pending.push_back(_pose.Rot().X());
+  this->dataPtr->pending.push_back(_pose.Rot().Y());
+  this->dataPtr->pending.push_back(_pose.Rot().Z());
+
+  if (this->dataPtr->pending.size() >= this->dataPtr->stride *
+      TrajectoryLogPrivate::kPendingRecords)
+  {
+    return this->dataPtr->WritePending();
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Flush()
+{
+  if (!this->Valid())
+    return false;
+  return this->dataPtr->WritePending();
+}
+
+//////////////////////////////////////////////////
+double TrajectoryLog::Time(const size_t _index) const
+{
+  if (!this->Valid() || _index >= this->Count())
+    return std::numeric_limits<double>::quiet_NaN();
+  return this->dataPtr->RecordTime(_index);
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Record(const size_t _index, double &_time,
+    Vector3d &_point) const
+{
+  if (!this->Valid() || this->dataPtr->type != RecordType::VECTOR3 ||
+      _index >= this->Count())
+  {
+    return false;
+  }
+
+  double record[4];
+  if (!this->dataPtr->ReadRecord(_index, record))
+    return false;
+  _time = record[0];
+  _point.Set(record[1], record[2], record[3]);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::Record(const size_t _index, double &_time,
+    Pose3d &_pose) const
+{
+  if (!this->Valid() || this->dataPtr->type != RecordType::POSE3 ||
+      _index >= this->Count())
+  {
+    return false;
+  }
+
+  double record[8];
+  if (!this->dataPtr->ReadRecord(_index, record))
+    return false;
+  _time = record[0];
+  _pose.Set(Vector3d(record[1], record[2], record[3]),
+      Quaterniond(record[4], record[5], record[6], record[7]));
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool TrajectoryLog::TimeRange(const double _begin, const double _end,
+    size_t &_first, size_t &_count) const
+{
+  _first = 0;
+  _count = 0;
+  if (!this->Valid() || _end < _begin)
+    return false;
+
+  const size_t total = this->Count();
+
+  // Lower bound: first record with time >= _begin.
+  size_t lo = 0;
+  size_t hi = total;
+  while (lo < hi)
+  {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (this->dataPtr->RecordTime(mid) < _begin)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  _first = lo;
+
+  // Upper bound: first record with time > _end.
+  hi = total;
+  while (lo < hi)
+  {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (this->dataPtr->RecordTime(mid) <= _end)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  _count = lo - _first;
+  return true;
+}
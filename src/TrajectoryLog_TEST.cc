@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cmath>
+#include <string>
+
+#include "ignition/math/TrajectoryLog.hh"
+
+using namespace ignition;
+
+/// \brief A scratch file removed when the test ends.
+struct ScratchFile
+{
+  explicit ScratchFile(const std::string &_name)
+    : path(::testing::UnitTest::GetInstance()->current_test_info()->name() +
+        ("_" + _name))
+  {
+    std::remove(this->path.c_str());
+  }
+
+  ~ScratchFile()
+  {
+    std::remove(this->path.c_str());
+  }
+
+  std::string path;
+};
+
+/////////////////////////////////////////////////
+TEST(TrajectoryLogTest, PoseRoundTrip)
+{
+  ScratchFile scratch("poses.igntrj");
+
+  math::TrajectoryLog log;
+  EXPECT_FALSE(log.Valid());
+  ASSERT_TRUE(log.Open(scratch.path));
+  EXPECT_TRUE(log.Valid());
+  EXPECT_EQ(math::TrajectoryLog::RecordType::POSE3, log.Type());
+  EXPECT_EQ(0u, log.Count());
+
+  const size_t count = 3000;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const math::Pose3d pose(0.1 * i, -0.2 * i, 0.3 * i,
+        0.001 * i, -0.001 * i, 0.002 * i);
+    ASSERT_TRUE(log.Append(0.01 * i, pose));
+  }
+  EXPECT_EQ(count, log.Count());
+
+  // Records read back exactly, including ones still in the buffer.
+  for (size_t i : {size_t(0), size_t(1023), size_t(1024), count - 1})
+  {
+    double time = -1.0;
+    math::Pose3d pose;
+    ASSERT_TRUE(log.Record(i, time, pose)) << i;
+    EXPECT_DOUBLE_EQ(0.01 * i, time) << i;
+    EXPECT_DOUBLE_EQ(0.1 * i, pose.Pos().X()) << i;
+    EXPECT_DOUBLE_EQ(log.Time(i), time) << i;
+  }
+
+  // A fresh handle sees everything written so far.
+  log.Close();
+  math::TrajectoryLog reader;
+  ASSERT_TRUE(reader.Open(scratch.path));
+  EXPECT_EQ(count, reader.Count());
+  double time = -1.0;
+  math::Pose3d pose;
+  ASSERT_TRUE(reader.Record(count - 1, time, pose));
+  EXPECT_DOUBLE_EQ(0.01 * (count - 1), time);
+  EXPECT_DOUBLE_EQ(0.3 * (count - 1), pose.Pos().Z());
+
+  // Reopening for append continues the sequence.
+  math::TrajectoryLog appender;
+  ASSERT_TRUE(appender.Open(scratch.path));
+  ASSERT_TRUE(appender.Append(100.0, math::Pose3d::Zero));
+  appender.Close();
+  ASSERT_TRUE(reader.Open(scratch.path));
+  EXPECT_EQ(count + 1, reader.Count());
+
+  // A type mismatch on open is rejected.
+  math::TrajectoryLog wrongType;
+  EXPECT_FALSE(wrongType.Open(scratch.path,
+      math::TrajectoryLog::RecordType::VECTOR3));
+}
+
+/////////////////////////////////////////////////
+TEST(TrajectoryLogTest, VectorLogAndTypeChecks)
+{
+  ScratchFile scratch("points.igntrj");
+
+  math::TrajectoryLog log;
+  ASSERT_TRUE(log.Open(scratch.path,
+      math::TrajectoryLog::RecordType::VECTOR3));
+
+  EXPECT_TRUE(log.Append(0.0, math::Vector3d(1, 2, 3)));
+  EXPECT_TRUE(log.Append(1.0, math::Vector3d(4, 5, 6)));
+
+  // Pose appends and reads are rejected on a point log.
+  EXPECT_FALSE(log.Append(2.0, math::Pose3d::Zero));
+  double time;
+  math::Pose3d pose;
+  EXPECT_FALSE(log.Record(0, time, pose));
+
+  math::Vector3d point;
+  ASSERT_TRUE(log.Record(1, time, point));
+  EXPECT_DOUBLE_EQ(1.0, time);
+  EXPECT_EQ(math::Vector3d(4, 5, 6), point);
+
+  // Out-of-range access fails gracefully.
+  EXPECT_FALSE(log.Record(2, time, point));
+  EXPECT_TRUE(std::isnan(log.Time(2)));
+}
+
+/////////////////////////////////////////////////
+TEST(TrajectoryLogTest, TimeRange)
+{
+  ScratchFile scratch("range.igntrj");
+
+  math::TrajectoryLog log;
+  ASSERT_TRUE(log.Open(scratch.path,
+      math::TrajectoryLog::RecordType::VECTOR3));
+
+  const size_t count = 5000;
+  for (size_t i = 0; i < count; ++i)
+    ASSERT_TRUE(log.Append(0.5 * i, math::Vector3d(1.0 * i, 0, 0)));
+
+  size_t first = 99;
+  size_t inRange = 99;
+
+  // An interior range.
+  ASSERT_TRUE(log.TimeRange(10.0, 20.0, first, inRange));
+  EXPECT_EQ(20u, first);
+  EXPECT_EQ(21u, inRange);
+
+  // A range before the first record.
+  ASSERT_TRUE(log.TimeRange(-5.0, -1.0, first, inRange));
+  EXPECT_EQ(0u, inRange);
+
+  // A range past the last record.
+  ASSERT_TRUE(log.TimeRange(1e6, 2e6, first, inRange));
+  EXPECT_EQ(0u, inRange);
+
+  // A range covering everything.
+  ASSERT_TRUE(log.TimeRange(-1.0, 1e6, first, inRange));
+  EXPECT_EQ(0u, first);
+  EXPECT_EQ(count, inRange);
+
+  // An inverted range is rejected.
+  EXPECT_FALSE(log.TimeRange(10.0, 5.0, first, inRange));
+
+  // The query works the same on a freshly opened handle.
+  log.Close();
+  ASSERT_TRUE(log.Open(scratch.path,
+      math::TrajectoryLog::RecordType::VECTOR3));
+  ASSERT_TRUE(log.TimeRange(100.0, 100.0, first, inRange));
+  EXPECT_EQ(200u, first);
+  EXPECT_EQ(1u, inRange);
+}
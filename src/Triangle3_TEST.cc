@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Triangle3.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -259,3 +261,49 @@ TEST(Triangle3Test, Area)
     EXPECT_NEAR(tri.Area(), (sqrt(2) * sqrt(1.5))*0.5, 1e-6);
   }
 }
+
+/////////////////////////////////////////////////
+TEST(Triangle3Test, PreparedTriangle)
+{
+  math::Triangle3d tri(
+      math::Vector3d(0, 0, 0),
+      math::Vector3d(0, 1, 0),
+      math::Vector3d(1, 0, 0));
+  math::PreparedTriangle3d prepared(tri);
+
+  EXPECT_EQ(tri.Normal(), prepared.Normal());
+  EXPECT_EQ(tri[1], prepared.Triangle()[1]);
+
+  // Contains agrees with the plain triangle on a grid of points.
+  for (double x = -0.25; x <= 1.25; x += 0.25)
+  {
+    for (double y = -0.25; y <= 1.25; y += 0.25)
+    {
+      math::Vector3d pt(x, y, 0);
+      EXPECT_EQ(tri.Contains(pt), prepared.Contains(pt))
+          << "point " << pt;
+    }
+  }
+  EXPECT_FALSE(prepared.Contains(math::Vector3d(0.1, 0.1, 0.5)));
+
+  // Intersects agrees with the plain triangle for crossing, missing
+  // and coplanar lines.
+  std::vector<math::Line3d> lines =
+  {
+    {math::Vector3d(0.1, 0.1, -2), math::Vector3d(0.1, 0.1, 2)},
+    {math::Vector3d(5, 5, -2), math::Vector3d(5, 5, 2)},
+    {math::Vector3d(0.1, 0.1, 0), math::Vector3d(0.2, 0.2, 0)},
+    {math::Vector3d(-1, 0.2, 0), math::Vector3d(2, 0.2, 0)}
+  };
+  for (const auto &line : lines)
+  {
+    math::Vector3d pt1, pt2;
+    bool hit1 = tri.Intersects(line, pt1);
+    bool hit2 = prepared.Intersects(line, pt2);
+    EXPECT_EQ(hit1, hit2) << "line " << line;
+    if (hit1 && hit2)
+    {
+      EXPECT_EQ(pt1, pt2) << "line " << line;
+    }
+  }
+}
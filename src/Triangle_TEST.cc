@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "ignition/math/Triangle.hh"
 #include "ignition/math/Helpers.hh"
 
@@ -192,3 +194,85 @@ TEST(TriangleTest, Area)
 
   EXPECT_NEAR(tri.Area(), 0.499999, 1e-6);
 }
+
+/////////////////////////////////////////////////
+TEST(TriangleTest, ContainsBatch)
+{
+  math::Triangled tri(math::Vector2d(0, 0),
+                      math::Vector2d(0, 1),
+                      math::Vector2d(1, 0));
+
+  // Batch results agree with per-point Contains on a mix of inside,
+  // boundary and outside points.
+  const std::vector<math::Vector2d> points =
+      {{0, 0}, {0, 1}, {1, 0}, {0.1, 0.1}, {0, 0.5}, {0.5, 0},
+       {0.5, 0.5}, {-0.01, -0.01}, {1.01, 0}, {0, 1.01}, {0.25, 0.25}};
+  std::vector<uint8_t> results(points.size(), 2);
+  tri.ContainsBatch(points.data(), points.size(), results.data());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(tri.Contains(points[i]) ? 1 : 0, results[i])
+        << "point " << points[i];
+  }
+
+  // The winding does not matter.
+  math::Triangled clockwise(math::Vector2d(0, 0),
+                            math::Vector2d(1, 0),
+                            math::Vector2d(0, 1));
+  std::vector<uint8_t> cwResults(points.size(), 2);
+  clockwise.ContainsBatch(points.data(), points.size(), cwResults.data());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(results[i], cwResults[i]) << "point " << points[i];
+
+  // A degenerate triangle contains nothing.
+  math::Triangled degenerate(math::Vector2d(0, 0),
+                             math::Vector2d(1, 1),
+                             math::Vector2d(2, 2));
+  tri.ContainsBatch(points.data(), points.size(), results.data());
+  degenerate.ContainsBatch(points.data(), points.size(), results.data());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(0, results[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(TriangleTest, ContainsGrid)
+{
+  math::Triangled tri(math::Vector2d(0, 0),
+                      math::Vector2d(0, 1),
+                      math::Vector2d(1, 0));
+
+  // The incremental grid walk matches point-by-point evaluation.
+  const math::Vector2d origin(-0.25, -0.25);
+  const math::Vector2d step(0.125, 0.125);
+  const size_t columns = 16;
+  const size_t rows = 16;
+  std::vector<uint8_t> grid(columns * rows, 2);
+  tri.ContainsGrid(origin, step, columns, rows, grid.data());
+  for (size_t r = 0; r < rows; ++r)
+  {
+    for (size_t c = 0; c < columns; ++c)
+    {
+      const math::Vector2d pt(origin.X() + c * step.X(),
+                              origin.Y() + r * step.Y());
+      EXPECT_EQ(tri.Contains(pt) ? 1 : 0, grid[r * columns + c])
+          << "point " << pt;
+    }
+  }
+
+  // Integer triangles walk the grid exactly.
+  math::Trianglei triInt(math::Vector2i(0, 0),
+                         math::Vector2i(0, 4),
+                         math::Vector2i(4, 0));
+  std::vector<uint8_t> intGrid(6 * 6, 2);
+  triInt.ContainsGrid(math::Vector2i(-1, -1), math::Vector2i(1, 1),
+      6, 6, intGrid.data());
+  for (int r = 0; r < 6; ++r)
+  {
+    for (int c = 0; c < 6; ++c)
+    {
+      const math::Vector2i pt(c - 1, r - 1);
+      EXPECT_EQ(triInt.Contains(pt) ? 1 : 0, intGrid[r * 6 + c])
+          << "point " << pt;
+    }
+  }
+}
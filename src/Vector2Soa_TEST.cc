@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/Vector2Soa.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(Vector2SoaTest, Construction)
+{
+  math::Vector2Soad batch;
+  EXPECT_EQ(batch.Size(), 0u);
+
+  math::Vector2Soad sized(5);
+  EXPECT_EQ(sized.Size(), 5u);
+  EXPECT_EQ(sized.At(4), math::Vector2d::Zero);
+
+  std::vector<math::Vector2d> pts = {{1, 2}, {3, 4}};
+  math::Vector2Soad fromAos(pts.data(), pts.size());
+  EXPECT_EQ(fromAos.Size(), 2u);
+  EXPECT_EQ(fromAos.At(0), math::Vector2d(1, 2));
+  EXPECT_EQ(fromAos.At(1), math::Vector2d(3, 4));
+
+  fromAos.Set(1, math::Vector2d(5, 6));
+  EXPECT_EQ(fromAos.At(1), math::Vector2d(5, 6));
+  fromAos.PushBack(math::Vector2d(7, 8));
+  EXPECT_EQ(fromAos.Size(), 3u);
+  EXPECT_EQ(fromAos.X().back(), 7.0);
+  EXPECT_EQ(fromAos.Y().back(), 8.0);
+
+  std::vector<math::Vector2d> out(3);
+  fromAos.ToVectors(out.data());
+  EXPECT_EQ(out[2], math::Vector2d(7, 8));
+
+  fromAos.Clear();
+  EXPECT_EQ(fromAos.Size(), 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector2SoaTest, BatchKernels)
+{
+  // Fill two batches and compare every kernel to the scalar Vector2
+  // operations.
+  const std::size_t count = 257;
+  math::Vector2Soad a, b;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    a.PushBack(math::Vector2d(0.1 * i - 5.0, -0.07 * i + 3.0));
+    b.PushBack(math::Vector2d(0.03 * i, 0.2 * i - 20.0));
+  }
+
+  std::vector<double> dots(count), crosses(count), dists(count),
+      ptDists(count);
+  a.DotBatch(b, dots.data());
+  a.CrossBatch(b, crosses.data());
+  a.DistanceBatch(b, dists.data());
+  const math::Vector2d pt(1.5, -2.5);
+  a.DistanceToPointBatch(pt, ptDists.data());
+
+  math::Vector2Soad sum = a;
+  sum.AddScaled(b, 2.0);
+
+  math::Vector2Soad normalized = a;
+  normalized.NormalizeBatch();
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const math::Vector2d va = a.At(i);
+    const math::Vector2d vb = b.At(i);
+    EXPECT_DOUBLE_EQ(dots[i], va.Dot(vb));
+    EXPECT_DOUBLE_EQ(crosses[i], va.X() * vb.Y() - va.Y() * vb.X());
+    EXPECT_DOUBLE_EQ(dists[i], va.Distance(vb));
+    EXPECT_DOUBLE_EQ(ptDists[i], va.Distance(pt));
+    EXPECT_EQ(sum.At(i), va + vb * 2.0);
+    EXPECT_EQ(normalized.At(i), math::Vector2d(va).Normalized());
+  }
+
+  // NormalizeBatch leaves zero vectors alone.
+  math::Vector2Soad zeros(3);
+  zeros.NormalizeBatch();
+  EXPECT_EQ(zeros.At(1), math::Vector2d::Zero);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector2SoaTest, InsideConvexPolygonBatch)
+{
+  // A unit square, counterclockwise.
+  std::vector<math::Vector2d> square =
+      {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+
+  math::Vector2Soad points;
+  points.PushBack(math::Vector2d(0.5, 0.5));   // interior
+  points.PushBack(math::Vector2d(1.5, 0.5));   // outside right
+  points.PushBack(math::Vector2d(0.5, -0.01));  // outside below
+  points.PushBack(math::Vector2d(1.0, 0.5));   // on an edge
+  points.PushBack(math::Vector2d(0.0, 0.0));   // on a vertex
+  points.PushBack(math::Vector2d(-3.0, 7.0));  // far outside
+
+  std::vector<uint8_t> inside(points.Size(), 2);
+  EXPECT_TRUE(points.InsideConvexPolygonBatch(
+      square.data(), square.size(), inside.data()));
+  EXPECT_EQ(inside[0], 1);
+  EXPECT_EQ(inside[1], 0);
+  EXPECT_EQ(inside[2], 0);
+  EXPECT_EQ(inside[3], 1);
+  EXPECT_EQ(inside[4], 1);
+  EXPECT_EQ(inside[5], 0);
+
+  // Clockwise winding gives the same answers.
+  std::vector<math::Vector2d> clockwise(square.rbegin(), square.rend());
+  std::vector<uint8_t> insideCw(points.Size(), 2);
+  EXPECT_TRUE(points.InsideConvexPolygonBatch(
+      clockwise.data(), clockwise.size(), insideCw.data()));
+  for (std::size_t i = 0; i < points.Size(); ++i)
+    EXPECT_EQ(insideCw[i], inside[i]);
+
+  // A degenerate polygon is rejected and all flags cleared.
+  std::vector<uint8_t> flags(points.Size(), 2);
+  EXPECT_FALSE(points.InsideConvexPolygonBatch(
+      square.data(), 2, flags.data()));
+  for (const auto flag : flags)
+    EXPECT_EQ(flag, 0);
+}
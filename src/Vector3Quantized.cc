@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Vector3Quantized.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief Number of points per chunk.
+  const size_t kChunkSize = 256;
+
+  /// \brief Largest quantized coordinate value.
+  const double kMaxCode = 65535.0;
+}
+
+/// \brief Private data for the Vector3qArray class.
+class ignition::math::Vector3qArrayPrivate
+{
+  /// \brief The quantized points, kChunkSize per chunk.
+  public: std::vector<Vector3q> codes;
+
+  /// \brief Minimum corner of each chunk's bounds.
+  public: std::vector<Vector3d> offsets;
+
+  /// \brief Size of one quantization step per axis, per chunk.
+  public: std::vector<Vector3d> steps;
+};
+
+//////////////////////////////////////////////////
+Vector3qArray::Vector3qArray()
+  : dataPtr(new Vector3qArrayPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Vector3qArray::~Vector3qArray()
+{
+}
+
+//////////////////////////////////////////////////
+size_t Vector3qArray::ChunkSize()
+{
+  return kChunkSize;
+}
+
+//////////////////////////////////////////////////
+void Vector3qArray::Encode(const Vector3d *_points, size_t _count)
+{
+  this->dataPtr->codes.resize(_count);
+  const size_t chunks = (_count + kChunkSize - 1) / kChunkSize;
+  this->dataPtr->offsets.resize(chunks);
+  this->dataPtr->steps.resize(chunks);
+
+  for (size_t c = 0; c < chunks; ++c)
+  {
+    const size_t begin = c * kChunkSize;
+    const size_t end = std::min(begin + kChunkSize, _count);
+
+    Vector3d min = _points[begin];
+    Vector3d max = _points[begin];
+    for (size_t i = begin + 1; i < end; ++i)
+    {
+      min.Min(_points[i]);
+      max.Max(_points[i]);
+    }
+
+    const Vector3d extent = max - min;
+    const Vector3d step(extent.X() / kMaxCode, extent.Y() / kMaxCode,
+        extent.Z() / kMaxCode);
+    const Vector3d invStep(
+        step.X() > 0 ? 1.0 / step.X() : 0.0,
+        step.Y() > 0 ? 1.0 / step.Y() : 0.0,
+        step.Z() > 0 ? 1.0 / step.Z() : 0.0);
+
+    this->dataPtr->offsets[c] = min;
+    this->dataPtr->steps[c] = step;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+      const Vector3d rel = _points[i] - min;
+      this->dataPtr->codes[i].x = static_cast<uint16_t>(std::min(
+          std::round(rel.X() * invStep.X()), kMaxCode));
+      this->dataPtr->codes[i].y = static_cast<uint16_t>(std::min(
+          std::round(rel.Y() * invStep.Y()), kMaxCode));
+      this->dataPtr->codes[i].z = static_cast<uint16_t>(std::min(
+          std::round(rel.Z() * invStep.Z()), kMaxCode));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+size_t Vector3qArray::Size() const
+{
+  return this->dataPtr->codes.size();
+}
+
+//////////////////////////////////////////////////
+void Vector3qArray::Clear()
+{
+  this->dataPtr->codes.clear();
+  this->dataPtr->offsets.clear();
+  this->dataPtr->steps.clear();
+}
+
+//////////////////////////////////////////////////
+void Vector3qArray::Decode(Vector3d *_points) const
+{
+  this->Decode(0, this->Size(), _points);
+}
+
+//////////////////////////////////////////////////
+void Vector3qArray::Decode(size_t _start, size_t _count,
+    Vector3d *_points) const
+{
+  const size_t total = this->Size();
+  if (_start >= total)
+    return;
+  const size_t end = std::min(_start + _count, total);
+
+  const Vector3q *codes = this->dataPtr->codes.data();
+  size_t out = 0;
+  size_t i = _start;
+  while (i < end)
+  {
+    // Decode chunk by chunk so the offset and step stay in registers.
+    const size_t chunk = i / kChunkSize;
+    const size_t chunkEnd = std::min((chunk + 1) * kChunkSize, end);
+    const Vector3d offset = this->dataPtr->offsets[chunk];
+    const Vector3d step = this->dataPtr->steps[chunk];
+
+    for (; i < chunkEnd; ++i, ++out)
+    {
+      _points[out].Set(
+          offset.X() + codes[i].x * step.X(),
+          offset.Y() + codes[i].y * step.Y(),
+          offset.Z() + codes[i].z * step.Z());
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+Vector3d Vector3qArray::At(size_t _index) const
+{
+  if (_index >= this->Size())
+    return Vector3d::Zero;
+
+  const size_t chunk = _index / kChunkSize;
+  const Vector3d &offset = this->dataPtr->offsets[chunk];
+  const Vector3d &step = this->dataPtr->steps[chunk];
+  const Vector3q &code = this->dataPtr->codes[_index];
+  return Vector3d(
+      offset.X() + code.x * step.X(),
+      offset.Y() + code.y * step.Y(),
+      offset.Z() + code.z * step.Z());
+}
+
+//////////////////////////////////////////////////
+size_t Vector3qArray::ByteSize() const
+{
+  return this->dataPtr->codes.size() * sizeof(Vector3q) +
+      this->dataPtr->offsets.size() * sizeof(Vector3d) +
+      this->dataPtr->steps.size() * sizeof(Vector3d);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/Rand.hh"
+#include "ignition/math/Vector3Quantized.hh"
+
+using namespace ignition;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(Vector3QuantizedTest, RoundTrip)
+{
+  // A wandering path, the typical shape of waypoint data.
+  Rand::Seed(42);
+  std::vector<Vector3d> points;
+  Vector3d pos(100, -50, 10);
+  for (int i = 0; i < 1000; ++i)
+  {
+    pos += Vector3d(Rand::DblUniform(-1, 1), Rand::DblUniform(-1, 1),
+        Rand::DblUniform(-0.1, 0.1));
+    points.push_back(pos);
+  }
+
+  Vector3qArray array;
+  array.Encode(points.data(), points.size());
+  EXPECT_EQ(points.size(), array.Size());
+
+  // Quantized storage is roughly a quarter of the raw footprint.
+  EXPECT_LT(array.ByteSize(), points.size() * sizeof(Vector3d) / 2);
+
+  std::vector<Vector3d> decoded(points.size());
+  array.Decode(decoded.data());
+
+  // The error per axis is bounded by half a quantization step of the
+  // chunk extent. The chunks span at most ~256 units here.
+  const double tolerance = 0.5 * 512.0 / 65535.0;
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_NEAR(points[i].X(), decoded[i].X(), tolerance) << "point " << i;
+    EXPECT_NEAR(points[i].Y(), decoded[i].Y(), tolerance) << "point " << i;
+    EXPECT_NEAR(points[i].Z(), decoded[i].Z(), tolerance) << "point " << i;
+  }
+
+  // At() agrees with the bulk decode.
+  EXPECT_EQ(decoded[0], array.At(0));
+  EXPECT_EQ(decoded[500], array.At(500));
+  EXPECT_EQ(decoded.back(), array.At(points.size() - 1));
+  EXPECT_EQ(Vector3d::Zero, array.At(points.size()));
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3QuantizedTest, RangeDecode)
+{
+  std::vector<Vector3d> points;
+  for (int i = 0; i < 600; ++i)
+    points.push_back(Vector3d(i, 2.0 * i, -i));
+
+  Vector3qArray array;
+  array.Encode(points.data(), points.size());
+
+  // A range crossing a chunk boundary.
+  std::vector<Vector3d> part(100);
+  array.Decode(200, 100, part.data());
+  for (size_t i = 0; i < part.size(); ++i)
+    EXPECT_EQ(array.At(200 + i), part[i]);
+
+  // A range truncated at the end of the array.
+  std::vector<Vector3d> tail(50, Vector3d::One);
+  array.Decode(590, 50, tail.data());
+  EXPECT_EQ(array.At(599), tail[9]);
+  EXPECT_EQ(Vector3d::One, tail[10]);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3QuantizedTest, DegenerateData)
+{
+  Vector3qArray array;
+  EXPECT_EQ(0u, array.Size());
+  EXPECT_EQ(0u, array.ByteSize());
+
+  // Identical points have zero extent and decode exactly.
+  std::vector<Vector3d> same(10, Vector3d(1.5, -2.5, 3.5));
+  array.Encode(same.data(), same.size());
+  for (size_t i = 0; i < same.size(); ++i)
+    EXPECT_EQ(same[i], array.At(i));
+
+  // A single point decodes exactly too.
+  Vector3d one(9, 8, 7);
+  array.Encode(&one, 1);
+  EXPECT_EQ(1u, array.Size());
+  EXPECT_EQ(one, array.At(0));
+
+  array.Clear();
+  EXPECT_EQ(0u, array.Size());
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ignition/math/Vector3Soa.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(Vector3SoaTest, Construction)
+{
+  math::Vector3Soad batch;
+  EXPECT_EQ(batch.Size(), 0u);
+
+  math::Vector3Soad sized(5);
+  EXPECT_EQ(sized.Size(), 5u);
+  EXPECT_EQ(sized.At(4), math::Vector3d::Zero);
+
+  std::vector<math::Vector3d> pts = {{1, 2, 3}, {4, 5, 6}};
+  math::Vector3Soad fromAos(pts.data(), pts.size());
+  EXPECT_EQ(fromAos.Size(), 2u);
+  EXPECT_EQ(fromAos.At(0), math::Vector3d(1, 2, 3));
+  EXPECT_EQ(fromAos.At(1), math::Vector3d(4, 5, 6));
+
+  std::vector<math::Vector3d> back(2);
+  fromAos.ToVectors(back.data());
+  EXPECT_EQ(back[0], pts[0]);
+  EXPECT_EQ(back[1], pts[1]);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3SoaTest, SetGetPushBack)
+{
+  math::Vector3Soad batch;
+  batch.PushBack(math::Vector3d(1, 0, 0));
+  batch.PushBack(math::Vector3d(0, 2, 0));
+  EXPECT_EQ(batch.Size(), 2u);
+
+  batch.Set(1, math::Vector3d(7, 8, 9));
+  EXPECT_EQ(batch.At(1), math::Vector3d(7, 8, 9));
+
+  EXPECT_DOUBLE_EQ(batch.X()[1], 7);
+  EXPECT_DOUBLE_EQ(batch.Y()[1], 8);
+  EXPECT_DOUBLE_EQ(batch.Z()[1], 9);
+
+  batch.Clear();
+  EXPECT_EQ(batch.Size(), 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3SoaTest, AddScaled)
+{
+  math::Vector3Soad a;
+  math::Vector3Soad b;
+  for (int i = 0; i < 4; ++i)
+  {
+    a.PushBack(math::Vector3d(i, i, i));
+    b.PushBack(math::Vector3d(1, 2, 3));
+  }
+
+  a.AddScaled(b, 2.0);
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(a.At(i), math::Vector3d(i + 2, i + 4, i + 6));
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3SoaTest, DotAndCrossBatch)
+{
+  math::Vector3Soad a;
+  math::Vector3Soad b;
+  a.PushBack(math::Vector3d(1, 0, 0));
+  a.PushBack(math::Vector3d(1, 2, 3));
+  b.PushBack(math::Vector3d(0, 1, 0));
+  b.PushBack(math::Vector3d(-4, 5, 6));
+
+  std::vector<double> dots(2);
+  a.DotBatch(b, dots.data());
+  EXPECT_DOUBLE_EQ(dots[0], 0.0);
+  EXPECT_DOUBLE_EQ(dots[1], a.At(1).Dot(b.At(1)));
+
+  math::Vector3Soad crosses;
+  a.CrossBatch(b, crosses);
+  ASSERT_EQ(crosses.Size(), 2u);
+  EXPECT_EQ(crosses.At(0), math::Vector3d::UnitZ);
+  EXPECT_EQ(crosses.At(1), a.At(1).Cross(b.At(1)));
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3SoaTest, NormalizeBatch)
+{
+  math::Vector3Soad batch;
+  batch.PushBack(math::Vector3d(3, 0, 4));
+  batch.PushBack(math::Vector3d::Zero);
+  batch.PushBack(math::Vector3d(0, -2, 0));
+
+  batch.NormalizeBatch();
+  EXPECT_EQ(batch.At(0), math::Vector3d(0.6, 0, 0.8));
+  // Zero-length vectors are left untouched.
+  EXPECT_EQ(batch.At(1), math::Vector3d::Zero);
+  EXPECT_EQ(batch.At(2), math::Vector3d(0, -1, 0));
+}
@@ -14,6 +14,12 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include <ignition/math/Vector3Stats.hh>
 #include "Vector3StatsPrivate.hh"
 
@@ -42,6 +48,32 @@ void Vector3Stats::InsertData(const Vector3d &_data)
   this->dataPtr->mag.InsertData(_data.Length());
 }
 
+//////////////////////////////////////////////////
+void Vector3Stats::InsertData(const Vector3d *_data, size_t _count)
+{
+  // Split the samples into contiguous per-component buffers so each
+  // SignalStats pays its dispatch once per batch.
+  std::vector<double> xs(_count), ys(_count), zs(_count), mags(_count);
+  for (size_t i = 0; i < _count; ++i)
+  {
+    xs[i] = _data[i].X();
+    ys[i] = _data[i].Y();
+    zs[i] = _data[i].Z();
+    mags[i] = _data[i].Length();
+  }
+
+  this->dataPtr->x.InsertData(xs.data(), _count);
+  this->dataPtr->y.InsertData(ys.data(), _count);
+  this->dataPtr->z.InsertData(zs.data(), _count);
+  this->dataPtr->mag.InsertData(mags.data(), _count);
+}
+
+//////////////////////////////////////////////////
+void Vector3Stats::InsertData(const std::vector<Vector3d> &_data)
+{
+  this->InsertData(_data.data(), _data.size());
+}
+
 //////////////////////////////////////////////////
 bool Vector3Stats::InsertStatistic(const std::string &_name)
 {
@@ -119,3 +151,243 @@ SignalStats &Vector3Stats::Mag()
   return this->dataPtr->mag;
 }
 
+//////////////////////////////////////////////////
+/// \brief Private data class for the Vector3StatsBuffered class.
+class ignition::math::Vector3StatsBufferedPrivate
+{
+  /// \brief The two buffers. The writer fills buffers[active]; the
+  /// other buffer belongs to the reader between snapshots.
+  public: Vector3Stats buffers[2];
+
+  /// \brief Index of the buffer the writer fills.
+  public: std::atomic<unsigned int> active{0};
+
+  /// \brief Insert progress counter: odd while an insert is in
+  /// flight, even when the writer is between inserts. Snapshot spins
+  /// on it to let an insert into the outgoing buffer drain.
+  public: std::atomic<uint64_t> writes{0};
+};
+
+//////////////////////////////////////////////////
+Vector3StatsBuffered::Vector3StatsBuffered()
+  : dataPtr(new Vector3StatsBufferedPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Vector3StatsBuffered::~Vector3StatsBuffered()
+{
+  delete this->dataPtr;
+  this->dataPtr = 0;
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsBuffered::InsertData(const Vector3d &_data)
+{
+  ++this->dataPtr->writes;
+  this->dataPtr->buffers[this->dataPtr->active].InsertData(_data);
+  ++this->dataPtr->writes;
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsBuffered::InsertData(const Vector3d *_data, size_t _count)
+{
+  ++this->dataPtr->writes;
+  this->dataPtr->buffers[this->dataPtr->active].InsertData(_data, _count);
+  ++this->dataPtr->writes;
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsBuffered::InsertData(const std::vector<Vector3d> &_data)
+{
+  this->InsertData(_data.data(), _data.size());
+}
+
+//////////////////////////////////////////////////
+bool Vector3StatsBuffered::InsertStatistic(const std::string &_name)
+{
+  bool front = this->dataPtr->buffers[0].InsertStatistic(_name);
+  bool back = this->dataPtr->buffers[1].InsertStatistic(_name);
+  return front && back;
+}
+
+//////////////////////////////////////////////////
+bool Vector3StatsBuffered::InsertStatistics(const std::string &_names)
+{
+  bool front = this->dataPtr->buffers[0].InsertStatistics(_names);
+  bool back = this->dataPtr->buffers[1].InsertStatistics(_names);
+  return front && back;
+}
+
+//////////////////////////////////////////////////
+const Vector3Stats &Vector3StatsBuffered::Snapshot()
+{
+  const unsigned int current = this->dataPtr->active;
+  const unsigned int next = 1 - current;
+
+  // The inactive buffer belonged to the reader since the previous
+  // snapshot; recycle it as the new active buffer.
+  this->dataPtr->buffers[next].Reset();
+  this->dataPtr->active = next;
+
+  // An insert that read the active index before the swap may still be
+  // filling the outgoing buffer; wait for it to finish. New inserts go
+  // to the fresh buffer, so this wait is bounded by one insert.
+  while (this->dataPtr->writes & 1)
+    std::this_thread::yield();
+
+  return this->dataPtr->buffers[current];
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsBuffered::Reset()
+{
+  this->dataPtr->buffers[0].Reset();
+  this->dataPtr->buffers[1].Reset();
+}
+
+//////////////////////////////////////////////////
+/// \brief Private data class for the Vector3StatsGroup class.
+class ignition::math::Vector3StatsGroupPrivate
+{
+  /// \brief Contiguous accumulators for one statistic family across
+  /// all channels and components. Index layout: component-major, with
+  /// the x/y/z/mag accumulators of all channels stored back to back,
+  /// so the per-step insert sweeps each array linearly.
+  public: struct Accumulators
+  {
+    public: std::vector<uint64_t> counts;
+    public: std::vector<double> means;
+    public: std::vector<double> m2s;
+    public: std::vector<double> sumSquares;
+    public: std::vector<double> mins;
+    public: std::vector<double> maxs;
+
+    public: void Resize(size_t _n)
+    {
+      this->counts.assign(_n, 0);
+      this->means.assign(_n, 0.0);
+      this->m2s.assign(_n, 0.0);
+      this->sumSquares.assign(_n, 0.0);
+      this->mins.assign(_n, 0.0);
+      this->maxs.assign(_n, 0.0);
+    }
+
+    public: void Insert(size_t _i, double _x)
+    {
+      uint64_t count = this->counts[_i];
+      double min = count > 0 ? this->mins[_i] : _x;
+      double max = count > 0 ? this->maxs[_i] : _x;
+
+      ++count;
+      const double delta = _x - this->means[_i];
+      this->means[_i] += delta / count;
+      this->m2s[_i] += delta * (_x - this->means[_i]);
+      this->sumSquares[_i] += _x * _x;
+      this->counts[_i] = count;
+      this->mins[_i] = _x < min ? _x : min;
+      this->maxs[_i] = _x > max ? _x : max;
+    }
+
+    public: Vector3StatsSummary Summary(size_t _i) const
+    {
+      Vector3StatsSummary summary;
+      summary.count = this->counts[_i];
+      if (summary.count == 0)
+        return summary;
+
+      summary.max = this->maxs[_i];
+      summary.min = this->mins[_i];
+      summary.maxAbs = std::max(std::abs(summary.max),
+                                std::abs(summary.min));
+      summary.mean = this->means[_i];
+      summary.rms = sqrt(this->sumSquares[_i] / summary.count);
+      if (summary.count > 1)
+        summary.variance = this->m2s[_i] / (summary.count - 1);
+      return summary;
+    }
+  };
+
+  /// \brief Number of channels.
+  public: size_t channels{0};
+
+  /// \brief Accumulators for all channels; the x accumulators of all
+  /// channels come first, then y, z and magnitude.
+  public: Accumulators accum;
+};
+
+//////////////////////////////////////////////////
+Vector3StatsGroup::Vector3StatsGroup(size_t _channels)
+  : dataPtr(new Vector3StatsGroupPrivate)
+{
+  this->dataPtr->channels = _channels;
+  this->dataPtr->accum.Resize(4 * _channels);
+}
+
+//////////////////////////////////////////////////
+Vector3StatsGroup::~Vector3StatsGroup()
+{
+  delete this->dataPtr;
+  this->dataPtr = 0;
+}
+
+//////////////////////////////////////////////////
+size_t Vector3StatsGroup::ChannelCount() const
+{
+  return this->dataPtr->channels;
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsGroup::InsertData(const Vector3d *_data)
+{
+  const size_t n = this->dataPtr->channels;
+  auto &accum = this->dataPtr->accum;
+  for (size_t i = 0; i < n; ++i)
+    accum.Insert(i, _data[i].X());
+  for (size_t i = 0; i < n; ++i)
+    accum.Insert(n + i, _data[i].Y());
+  for (size_t i = 0; i < n; ++i)
+    accum.Insert(2 * n + i, _data[i].Z());
+  for (size_t i = 0; i < n; ++i)
+    accum.Insert(3 * n + i, _data[i].Length());
+}
+
+//////////////////////////////////////////////////
+Vector3StatsSummary Vector3StatsGroup::X(size_t _channel) const
+{
+  if (_channel >= this->dataPtr->channels)
+    return Vector3StatsSummary();
+  return this->dataPtr->accum.Summary(_channel);
+}
+
+//////////////////////////////////////////////////
+Vector3StatsSummary Vector3StatsGroup::Y(size_t _channel) const
+{
+  if (_channel >= this->dataPtr->channels)
+    return Vector3StatsSummary();
+  return this->dataPtr->accum.Summary(this->dataPtr->channels + _channel);
+}
+
+//////////////////////////////////////////////////
+Vector3StatsSummary Vector3StatsGroup::Z(size_t _channel) const
+{
+  if (_channel >= this->dataPtr->channels)
+    return Vector3StatsSummary();
+  return this->dataPtr->accum.Summary(
+      2 * this->dataPtr->channels + _channel);
+}
+
+//////////////////////////////////////////////////
+Vector3StatsSummary Vector3StatsGroup::Mag(size_t _channel) const
+{
+  if (_channel >= this->dataPtr->channels)
+    return Vector3StatsSummary();
+  return this->dataPtr->accum.Summary(
+      3 * this->dataPtr->channels + _channel);
+}
+
+//////////////////////////////////////////////////
+void Vector3StatsGroup::Reset()
+{
+  this->dataPtr->accum.Resize(4 * this->dataPtr->channels);
+}
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <ignition/math/Vector3Stats.hh>
 
 using namespace ignition;
@@ -187,3 +193,169 @@ TEST_F(Vector3StatsTest, Vector3Stats)
     EXPECT_NEAR(this->Mag(name), 1.0, 1e-10);
   }
 }
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, BatchInsert)
+{
+  math::Vector3Stats batched;
+  math::Vector3Stats oneAtATime;
+  EXPECT_TRUE(batched.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  EXPECT_TRUE(oneAtATime.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  std::vector<math::Vector3d> samples;
+  for (int i = 0; i < 200; ++i)
+  {
+    samples.push_back(math::Vector3d(std::sin(0.3 * i) - 0.5,
+        0.1 * (i % 17), std::cos(0.7 * i) * 3.0));
+  }
+
+  batched.InsertData(samples.data(), samples.size());
+  for (const auto &sample : samples)
+    oneAtATime.InsertData(sample);
+
+  for (auto const &keyValue : oneAtATime.X().Map())
+  {
+    EXPECT_NEAR(keyValue.second, batched.X().Map().at(keyValue.first),
+        1e-10) << "x " << keyValue.first;
+  }
+  for (auto const &keyValue : oneAtATime.Mag().Map())
+  {
+    EXPECT_NEAR(keyValue.second, batched.Mag().Map().at(keyValue.first),
+        1e-10) << "mag " << keyValue.first;
+  }
+}
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, Group)
+{
+  const size_t channels = 5;
+  math::Vector3StatsGroup group(channels);
+  EXPECT_EQ(channels, group.ChannelCount());
+
+  // Reference: one fully populated Vector3Stats per channel.
+  std::vector<math::Vector3Stats> reference(channels);
+  for (auto &stats : reference)
+    EXPECT_TRUE(stats.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  std::vector<math::Vector3d> step(channels);
+  for (int iter = 0; iter < 300; ++iter)
+  {
+    for (size_t c = 0; c < channels; ++c)
+    {
+      step[c] = math::Vector3d(std::sin(0.11 * iter + c),
+          0.2 * ((iter + c) % 13) - 1.0, std::cos(0.23 * iter) * (c + 1.0));
+      reference[c].InsertData(step[c]);
+    }
+    group.InsertData(step.data());
+  }
+
+  for (size_t c = 0; c < channels; ++c)
+  {
+    auto checkComponent = [&](const math::Vector3StatsSummary &_summary,
+        const math::SignalStats &_expected, const std::string &_label)
+    {
+      auto map = _expected.Map();
+      EXPECT_EQ(300u, _summary.count) << _label;
+      EXPECT_NEAR(map.at("max"), _summary.max, 1e-9) << _label;
+      EXPECT_NEAR(map.at("maxAbs"), _summary.maxAbs, 1e-9) << _label;
+      EXPECT_NEAR(map.at("mean"), _summary.mean, 1e-9) << _label;
+      EXPECT_NEAR(map.at("min"), _summary.min, 1e-9) << _label;
+      EXPECT_NEAR(map.at("rms"), _summary.rms, 1e-9) << _label;
+      EXPECT_NEAR(map.at("var"), _summary.variance, 1e-9) << _label;
+    };
+    checkComponent(group.X(c), reference[c].X(), "x");
+    checkComponent(group.Y(c), reference[c].Y(), "y");
+    checkComponent(group.Z(c), reference[c].Z(), "z");
+    checkComponent(group.Mag(c), reference[c].Mag(), "mag");
+  }
+
+  // Invalid channel yields a zero summary; Reset clears everything.
+  EXPECT_EQ(0u, group.X(channels).count);
+  group.Reset();
+  EXPECT_EQ(0u, group.Mag(0).count);
+  EXPECT_DOUBLE_EQ(0.0, group.Mag(0).mean);
+}
+
+/////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, BufferInsertData)
+{
+  math::Vector3Stats stats;
+  EXPECT_TRUE(stats.InsertStatistics("max,mean,rms"));
+  math::Vector3Stats reference;
+  EXPECT_TRUE(reference.InsertStatistics("max,mean,rms"));
+
+  std::vector<math::Vector3d> samples;
+  for (int i = 0; i < 50; ++i)
+    samples.push_back(math::Vector3d(0.1 * i, std::cos(0.3 * i), -i));
+
+  stats.InsertData(samples);
+  for (const auto &sample : samples)
+    reference.InsertData(sample);
+
+  EXPECT_EQ(reference.X().Count(), stats.X().Count());
+  EXPECT_NEAR(reference.Mag().Map().at("rms"),
+      stats.Mag().Map().at("rms"), 1e-10);
+  EXPECT_NEAR(reference.Y().Map().at("mean"),
+      stats.Y().Map().at("mean"), 1e-10);
+}
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, BufferedSnapshot)
+{
+  math::Vector3StatsBuffered stats;
+  EXPECT_TRUE(stats.InsertStatistics("mean,maxAbs"));
+
+  // Each snapshot covers the samples inserted since the previous one.
+  stats.InsertData(math::Vector3d(1, 2, 4));
+  stats.InsertData(math::Vector3d(3, 2, 0));
+  {
+    const math::Vector3Stats &snapshot = stats.Snapshot();
+    EXPECT_EQ(2u, snapshot.X().Count());
+    EXPECT_DOUBLE_EQ(2.0, snapshot.X().Map().at("mean"));
+    EXPECT_DOUBLE_EQ(4.0, snapshot.Z().Map().at("maxAbs"));
+  }
+
+  stats.InsertData(math::Vector3d(10, 0, 0));
+  {
+    const math::Vector3Stats &snapshot = stats.Snapshot();
+    EXPECT_EQ(1u, snapshot.X().Count());
+    EXPECT_DOUBLE_EQ(10.0, snapshot.X().Map().at("mean"));
+  }
+
+  // An empty interval yields an empty snapshot.
+  EXPECT_EQ(0u, stats.Snapshot().X().Count());
+}
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, BufferedConcurrentWriter)
+{
+  math::Vector3StatsBuffered stats;
+  EXPECT_TRUE(stats.InsertStatistics("mean"));
+
+  // One writer inserts a fixed number of identical samples while this
+  // thread snapshots; no sample may be lost or double counted.
+  const uint64_t samples = 200000;
+  std::thread writer([&stats, samples]()
+      {
+        for (uint64_t i = 0; i < samples; ++i)
+          stats.InsertData(math::Vector3d(1, -2, 3));
+      });
+
+  uint64_t collected = 0;
+  while (collected < samples)
+  {
+    const math::Vector3Stats &snapshot = stats.Snapshot();
+    const uint64_t count = snapshot.X().Count();
+    collected += count;
+    if (count > 0)
+    {
+      EXPECT_DOUBLE_EQ(1.0, snapshot.X().Map().at("mean"));
+      EXPECT_DOUBLE_EQ(-2.0, snapshot.Y().Map().at("mean"));
+      EXPECT_DOUBLE_EQ(3.0, snapshot.Z().Map().at("mean"));
+    }
+  }
+  writer.join();
+
+  EXPECT_EQ(samples, collected);
+  EXPECT_EQ(0u, stats.Snapshot().X().Count());
+}
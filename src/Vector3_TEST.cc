@@ -19,6 +19,7 @@
 
 #include <numeric>
 #include <sstream>
+#include <vector>
 
 #include "ignition/math/Vector3.hh"
 #include "ignition/math/Helpers.hh"
@@ -455,3 +456,153 @@ TEST(Vector3dTest, NoException)
   EXPECT_NO_THROW(ss << vInf);
 }
 
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, FloatArithmetic)
+{
+  // Exercise the float instantiation, which may take the vectorized
+  // kernel paths.
+  math::Vector3f a(1.5f, -2.0f, 3.25f);
+  math::Vector3f b(-4.0f, 0.5f, 2.0f);
+
+  EXPECT_EQ(a + b, math::Vector3f(-2.5f, -1.5f, 5.25f));
+  EXPECT_EQ(a - b, math::Vector3f(5.5f, -2.5f, 1.25f));
+  EXPECT_EQ(a * b, math::Vector3f(-6.0f, -1.0f, 6.5f));
+  EXPECT_EQ(a * 2.0f, math::Vector3f(3.0f, -4.0f, 6.5f));
+  EXPECT_FLOAT_EQ(a.Dot(b), -0.5f);
+  EXPECT_FLOAT_EQ(a.SquaredLength(), 16.8125f);
+  EXPECT_EQ(a.Cross(b), math::Vector3f(-5.625f, -16.0f, -7.25f));
+  EXPECT_FLOAT_EQ(a.Normalized().Length(), 1.0f);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, FloatNormalize)
+{
+  // The float-specialized Normalize must agree with a double
+  // reference to fp32 precision over a range of magnitudes.
+  for (int i = 1; i < 500; ++i)
+  {
+    const double scale = std::pow(10.0, (i % 11) - 5);
+    const math::Vector3d ref = math::Vector3d(
+        0.3 * i, -0.7 * i + 5.0, 0.11 * i).Normalized() * scale;
+    math::Vector3f vec(ref.X(), ref.Y(), ref.Z());
+    vec.Normalize();
+    EXPECT_NEAR(vec.X(), ref.X() / scale, 5e-7) << i;
+    EXPECT_NEAR(vec.Y(), ref.Y() / scale, 5e-7) << i;
+    EXPECT_NEAR(vec.Z(), ref.Z() / scale, 5e-7) << i;
+    EXPECT_NEAR(vec.Length(), 1.0f, 5e-7) << i;
+  }
+
+  // A zero vector stays zero, as in the generic path.
+  math::Vector3f zero;
+  zero.Normalize();
+  EXPECT_EQ(zero, math::Vector3f(0, 0, 0));
+}
+
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, AddScaled)
+{
+  math::Vector3d pos(1.0, -2.0, 3.0);
+  const math::Vector3d vel(0.5, 4.0, -1.5);
+  const double dt = 0.01;
+
+  // Identical to pos += vel * dt, with no temporary.
+  math::Vector3d expected = pos + vel * dt;
+  pos.AddScaled(vel, dt);
+  EXPECT_EQ(expected, pos);
+
+  // A zero scale is a no-op.
+  pos.AddScaled(vel, 0.0);
+  EXPECT_EQ(expected, pos);
+  pos.AddScaled(vel, dt);
+  expected += vel * dt;
+  EXPECT_EQ(expected, pos);
+
+  math::Vector3f posf(1.0f, 2.0f, 3.0f);
+  posf.AddScaled(math::Vector3f(2.0f, -4.0f, 8.0f), 0.5f);
+  EXPECT_EQ(math::Vector3f(2.0f, 0.0f, 7.0f), posf);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, NormalizedFast)
+{
+  const math::Vector3d v(1.0, -2.0, 2.0);
+  const math::Vector3d n = v.NormalizedFast();
+  EXPECT_EQ(v.Normalized(), n);
+  EXPECT_NEAR(1.0, n.Length(), 1e-15);
+
+  // The float variant uses the refined reciprocal square root
+  // estimate; accept its couple-ulp error.
+  const math::Vector3f vf(3.0f, 0.0f, -4.0f);
+  const math::Vector3f nf = vf.NormalizedFast();
+  EXPECT_NEAR(0.6f, nf.X(), 1e-6f);
+  EXPECT_NEAR(0.0f, nf.Y(), 1e-6f);
+  EXPECT_NEAR(-0.8f, nf.Z(), 1e-6f);
+  EXPECT_NEAR(1.0f, nf.Length(), 1e-6f);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, EqualBatch)
+{
+  // Two nearly identical arrays with a few changed elements.
+  const size_t count = 130;
+  std::vector<math::Vector3d> a(count);
+  std::vector<math::Vector3d> b(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    a[i] = math::Vector3d(1.0 * i, 2.0 * i, 3.0 * i);
+    b[i] = a[i];
+  }
+  b[0] += math::Vector3d(0.5, 0, 0);
+  b[63] += math::Vector3d(0, -0.5, 0);
+  b[64] += math::Vector3d(0, 0, 0.5);
+  b[129] += math::Vector3d(0.5, 0.5, 0.5);
+  // A perturbation inside the tolerance is not a change.
+  b[10] += math::Vector3d(1e-9, 0, 0);
+
+  uint64_t mask[3] = {1, 2, 3};
+  math::EqualBatch(a.data(), b.data(), count, 1e-6, mask);
+
+  // The mask agrees with Equal() element by element, and the tail
+  // bits of the last word stay clear.
+  for (size_t i = 0; i < count; ++i)
+  {
+    const bool bit = (mask[i >> 6] >> (i & 63)) & 1;
+    EXPECT_EQ(bit, a[i].Equal(b[i], 1e-6)) << "element " << i;
+  }
+  EXPECT_EQ(mask[2] >> 2, 0u);
+
+  // ChangedIndices compacts the cleared bits in ascending order.
+  size_t indices[8] = {0};
+  const size_t changed = math::ChangedIndices(mask, count, indices, 8);
+  ASSERT_EQ(changed, 4u);
+  EXPECT_EQ(indices[0], 0u);
+  EXPECT_EQ(indices[1], 63u);
+  EXPECT_EQ(indices[2], 64u);
+  EXPECT_EQ(indices[3], 129u);
+
+  // A short buffer still reports the full change count.
+  size_t two[2] = {0};
+  EXPECT_EQ(math::ChangedIndices(mask, count, two, 2), 4u);
+  EXPECT_EQ(two[0], 0u);
+  EXPECT_EQ(two[1], 63u);
+
+  // Identical arrays produce no changes.
+  math::EqualBatch(a.data(), a.data(), count, 1e-6, mask);
+  EXPECT_EQ(math::ChangedIndices(mask, count, indices, 8), 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(Vector3dTest, NormalizeIntegral)
+{
+  // Integral instantiations divide element-wise; a reciprocal would
+  // truncate to zero.
+  math::Vector3i axis(0, 0, 5);
+  axis.Normalize();
+  EXPECT_EQ(axis, math::Vector3i(0, 0, 1));
+
+  math::Vector3i zero(0, 0, 0);
+  zero.Normalize();
+  EXPECT_EQ(zero, math::Vector3i(0, 0, 0));
+}
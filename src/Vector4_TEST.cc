@@ -422,3 +422,23 @@ TEST(Vector4dTest, Length)
   EXPECT_DOUBLE_EQ(v.SquaredLength(), 24.9);
 }
 
+
+/////////////////////////////////////////////////
+TEST(Vector4dTest, AddScaled)
+{
+  math::Vector4d pos(1.0, -2.0, 3.0, 0.5);
+  const math::Vector4d vel(0.5, 4.0, -1.5, 2.0);
+  const double dt = 0.01;
+
+  // Identical to pos += vel * dt, with no temporary.
+  math::Vector4d expected = pos + vel * dt;
+  pos.AddScaled(vel, dt);
+  EXPECT_EQ(expected, pos);
+
+  // A zero scale is a no-op.
+  pos.AddScaled(vel, 0.0);
+  EXPECT_EQ(expected, pos);
+  pos.AddScaled(vel, dt);
+  expected += vel * dt;
+  EXPECT_EQ(expected, pos);
+}
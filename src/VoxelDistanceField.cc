@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ignition/math/VoxelDistanceField.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ignition/math/Helpers.hh"
+
+using namespace ignition;
+using namespace math;
+
+namespace
+{
+  /// \brief A sphere primitive, reduced to what the bake needs.
+  struct SdfSphere
+  {
+    public: Pose3d pose;
+    public: double radius;
+  };
+
+  /// \brief A box primitive, reduced to its half extents.
+  struct SdfBox
+  {
+    public: Pose3d pose;
+    public: Vector3d half;
+  };
+
+  /// \brief A capsule primitive, reduced to its axis half length and
+  /// radius.
+  struct SdfCapsule
+  {
+    public: Pose3d pose;
+    public: double radius;
+    public: double halfLength;
+  };
+
+  /// \brief Transform a world point into a shape's local frame.
+  /// \param[in] _pose Pose of the shape.
+  /// \param[in] _point The world point.
+  /// \return The point in the shape's frame.
+  Vector3d ToLocal(const Pose3d &_pose, const Vector3d &_point)
+  {
+    return _pose.Rot().RotateVectorReverse(_point - _pose.Pos());
+  }
+
+  /// \brief Exact signed distance from a point to a sphere.
+  /// \param[in] _sphere The sphere.
+  /// \param[in] _point The world point.
+  /// \return The signed distance.
+  double SignedDistance(const SdfSphere &_sphere, const Vector3d &_point)
+  {
+    return (_point - _sphere.pose.Pos()).Length() - _sphere.radius;
+  }
+
+  /// \brief Exact signed distance from a point to an oriented box.
+  /// \param[in] _box The box.
+  /// \param[in] _point The world point.
+  /// \return The signed distance.
+  double SignedDistance(const SdfBox &_box, const Vector3d &_point)
+  {
+    const Vector3d local = ToLocal(_box.pose, _point);
+    const Vector3d q = local.Abs() - _box.half;
+    const Vector3d outside(std::max(q.X(), 0.0), std::max(q.Y(), 0.0),
+        std::max(q.Z(), 0.0));
+    return outside.Length() +
+        std::min(std::max(q.X(), std::max(q.Y(), q.Z())), 0.0);
+  }
+
+  /// \brief Exact signed distance from a point to a capsule.
+  /// \param[in] _capsule The capsule.
+  /// \param[in] _point The world point.
+  /// \return The signed distance.
+  double SignedDistance(const SdfCapsule &_capsule, const Vector3d &_point)
+  {
+    Vector3d local = ToLocal(_capsule.pose, _point);
+    local.Z(local.Z() - clamp(local.Z(),
+        -_capsule.halfLength, _capsule.halfLength));
+    return local.Length() - _capsule.radius;
+  }
+}
+
+/// \internal
+/// \brief Private data for the VoxelDistanceField class.
+class ignition::math::VoxelDistanceFieldPrivate
+{
+  /// \brief Region covered by the grid.
+  public: AxisAlignedBox bounds;
+
+  /// \brief Voxel edge length in meters.
+  public: double resolution = 1.0;
+
+  /// \brief Number of grid samples along each axis.
+  public: std::size_t nx = 0, ny = 0, nz = 0;
+
+  /// \brief Baked signed distances, x fastest, z slowest.
+  public: std::vector<double> distances;
+
+  /// \brief The sphere primitives.
+  public: std::vector<SdfSphere> spheres;
+
+  /// \brief The box primitives.
+  public: std::vector<SdfBox> boxes;
+
+  /// \brief The capsule primitives.
+  public: std::vector<SdfCapsule> capsules;
+
+  /// \brief Exact signed distance of the whole shape set at a point.
+  /// \param[in] _point The world point.
+  /// \return The minimum signed distance over all shapes, or MAX_D
+  /// for an empty set.
+  public: double Exact(const Vector3d &_point) const
+  {
+    double dist = MAX_D;
+    for (const auto &sphere : this->spheres)
+      dist = std::min(dist, SignedDistance(sphere, _point));
+    for (const auto &box : this->boxes)
+      dist = std::min(dist, SignedDistance(box, _point));
+    for (const auto &capsule : this->capsules)
+      dist = std::min(dist, SignedDistance(capsule, _point));
+    return dist;
+  }
+};
+
+//////////////////////////////////////////////////
+VoxelDistanceField::VoxelDistanceField(const AxisAlignedBox &_bounds,
+    const double _resolution)
+: dataPtr(new VoxelDistanceFieldPrivate)
+{
+  this->dataPtr->bounds = _bounds;
+  this->dataPtr->resolution = _resolution > 0.0 ? _resolution : 1.0;
+
+  const Vector3d size = _bounds.Size();
+  this->dataPtr->nx = static_cast<std::size_t>(
+      std::ceil(size.X() / this->dataPtr->resolution)) + 1;
+  this->dataPtr->ny = static_cast<std::size_t>(
+      std::ceil(size.Y() / this->dataPtr->resolution)) + 1;
+  this->dataPtr->nz = static_cast<std::size_t>(
+      std::ceil(size.Z() / this->dataPtr->resolution)) + 1;
+}
+
+//////////////////////////////////////////////////
+VoxelDistanceField::~VoxelDistanceField()
+{
+}
+
+//////////////////////////////////////////////////
+void VoxelDistanceField::AddSpheres(const Sphered *_spheres,
+    const Pose3d *_poses, const std::size_t _count)
+{
+  for (std::size_t i = 0; i < _count; ++i)
+    this->dataPtr->spheres.push_back({_poses[i], _spheres[i].Radius()});
+}
+
+//////////////////////////////////////////////////
+void VoxelDistanceField::AddBoxes(const Boxd *_boxes,
+    const Pose3d *_poses, const std::size_t _count)
+{
+  for (std::size_t i = 0; i < _count; ++i)
+    this->dataPtr->boxes.push_back({_poses[i], _boxes[i].Size() / 2.0});
+}
+
+//////////////////////////////////////////////////
+void VoxelDistanceField::AddCapsules(const Capsuled *_capsules,
+    const Pose3d *_poses, const std::size_t _count)
+{
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    this->dataPtr->capsules.push_back({_poses[i], _capsules[i].Radius(),
+        _capsules[i].Length() / 2.0});
+  }
+}
+
+//////////////////////////////////////////////////
+std::size_t VoxelDistanceField::Bake()
+{
+  const std::size_t nx = this->dataPtr->nx;
+  const std::size_t ny = this->dataPtr->ny;
+  const std::size_t nz = this->dataPtr->nz;
+  const double res = this->dataPtr->resolution;
+  const Vector3d min = this->dataPtr->bounds.Min();
+
+  this->dataPtr->distances.resize(nx * ny * nz);
+
+  // One tight pass over the grid; every sample is exact, so the only
+  // error a query sees is the interpolation between samples.
+  std::size_t index = 0;
+  for (std::size_t k = 0; k < nz; ++k)
+  {
+    for (std::size_t j = 0; j < ny; ++j)
+    {
+      for (std::size_t i = 0; i < nx; ++i)
+      {
+        const Vector3d sample(min.X() + i * res, min.Y() + j * res,
+            min.Z() + k * res);
+        this->dataPtr->distances[index++] = this->dataPtr->Exact(sample);
+      }
+    }
+  }
+  return index;
+}
+
+//////////////////////////////////////////////////
+bool VoxelDistanceField::Baked() const
+{
+  return !this->dataPtr->distances.empty();
+}
+
+//////////////////////////////////////////////////
+const AxisAlignedBox &VoxelDistanceField::Bounds() const
+{
+  return this->dataPtr->bounds;
+}
+
+//////////////////////////////////////////////////
+double VoxelDistanceField::Resolution() const
+{
+  return this->dataPtr->resolution;
+}
+
+//////////////////////////////////////////////////
+double VoxelDistanceField::Distance(const Vector3d &_point) const
+{
+  if (this->dataPtr->distances.empty())
+    return MAX_D;
+
+  const std::size_t nx = this->dataPtr->nx;
+  const std::size_t ny = this->dataPtr->ny;
+  const std::size_t nz = this->dataPtr->nz;
+
+  // Continuous grid coordinates, clamped onto the sample lattice.
+  const Vector3d min = this->dataPtr->bounds.Min();
+  const double gx = clamp((_point.X() - min.X()) / this->dataPtr->resolution,
+      0.0, static_cast<double>(nx - 1));
+  const double gy = clamp((_point.Y() - min.Y()) / this->dataPtr->resolution,
+      0.0, static_cast<double>(ny - 1));
+  const double gz = clamp((_point.Z() - min.Z()) / this->dataPtr->resolution,
+      0.0, static_cast<double>(nz - 1));
+
+  const std::size_t i0 =
+      std::min(static_cast<std::size_t>(gx), nx >= 2 ? nx - 2 : 0);
+  const std::size_t j0 =
+      std::min(static_cast<std::size_t>(gy), ny >= 2 ? ny - 2 : 0);
+  const std::size_t k0 =
+      std::min(static_cast<std::size_t>(gz), nz >= 2 ? nz - 2 : 0);
+  const std::size_t i1 = std::min(i0 + 1, nx - 1);
+  const std::size_t j1 = std::min(j0 + 1, ny - 1);
+  const std::size_t k1 = std::min(k0 + 1, nz - 1);
+
+  const double fx = gx - i0;
+  const double fy = gy - j0;
+  const double fz = gz - k0;
+
+  const auto &d = this->dataPtr->distances;
+  const auto at = [&](const std::size_t _i, const std::size_t _j,
+      const std::size_t _k)
+  {
+    return d[(_k * ny + _j) * nx + _i];
+  };
+
+  // Trilinear interpolation of the eight surrounding samples.
+  const double c00 = at(i0, j0, k0) * (1 - fx) + at(i1, j0, k0) * fx;
+  const double c10 = at(i0, j1, k0) * (1 - fx) + at(i1, j1, k0) * fx;
+  const double c01 = at(i0, j0, k1) * (1 - fx) + at(i1, j0, k1) * fx;
+  const double c11 = at(i0, j1, k1) * (1 - fx) + at(i1, j1, k1) * fx;
+  const double c0 = c00 * (1 - fy) + c10 * fy;
+  const double c1 = c01 * (1 - fy) + c11 * fy;
+  return c0 * (1 - fz) + c1 * fz;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "ignition/math/Helpers.hh"
+#include "ignition/math/VoxelDistanceField.hh"
+
+using namespace ignition;
+
+/////////////////////////////////////////////////
+TEST(VoxelDistanceFieldTest, EmptyAndUnbaked)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-5, -5, -5), math::Vector3d(5, 5, 5));
+  math::VoxelDistanceField field(bounds, 0.5);
+
+  EXPECT_FALSE(field.Baked());
+  EXPECT_DOUBLE_EQ(field.Distance(math::Vector3d::Zero), math::MAX_D);
+  EXPECT_EQ(field.Bounds(), bounds);
+  EXPECT_DOUBLE_EQ(field.Resolution(), 0.5);
+
+  // A baked empty set still has no obstacles anywhere.
+  EXPECT_GT(field.Bake(), 0u);
+  EXPECT_TRUE(field.Baked());
+  EXPECT_DOUBLE_EQ(field.Distance(math::Vector3d::Zero), math::MAX_D);
+
+  // A non-positive resolution falls back to one meter.
+  math::VoxelDistanceField coarse(bounds, -1.0);
+  EXPECT_DOUBLE_EQ(coarse.Resolution(), 1.0);
+}
+
+/////////////////////////////////////////////////
+TEST(VoxelDistanceFieldTest, SingleSphere)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-5, -5, -5), math::Vector3d(5, 5, 5));
+  math::VoxelDistanceField field(bounds, 0.25);
+
+  const math::Sphered sphere(1.0);
+  const math::Pose3d pose(1, 0, 0, 0, 0, 0);
+  field.AddSpheres(&sphere, &pose, 1);
+  field.Bake();
+
+  // Samples on lattice points are exact; in between the error is
+  // bounded by the resolution.
+  EXPECT_NEAR(field.Distance(math::Vector3d(4, 0, 0)), 2.0, 1e-9);
+  EXPECT_NEAR(field.Distance(math::Vector3d(1, 0, 0)), -1.0, 1e-9);
+  EXPECT_NEAR(field.Distance(math::Vector3d(1, 3, 0)), 2.0, 0.25);
+  EXPECT_NEAR(field.Distance(math::Vector3d(1.3, 0.4, -0.2)), -0.46, 0.25);
+
+  // Queries outside the grid clamp onto its boundary.
+  EXPECT_NEAR(field.Distance(math::Vector3d(100, 0, 0)),
+      field.Distance(math::Vector3d(5, 0, 0)), 1e-9);
+}
+
+/////////////////////////////////////////////////
+TEST(VoxelDistanceFieldTest, MixedShapes)
+{
+  const math::AxisAlignedBox bounds(
+      math::Vector3d(-6, -6, -6), math::Vector3d(6, 6, 6));
+  math::VoxelDistanceField field(bounds, 0.2);
+
+  const math::Sphered sphere(1.0);
+  const math::Pose3d spherePose(-4, 0, 0, 0, 0, 0);
+  field.AddSpheres(&sphere, &spherePose, 1);
+
+  const math::Boxd box(2.0, 2.0, 2.0);
+  const math::Pose3d boxPose(4, 0, 0, 0, 0, IGN_PI_4);
+  field.AddBoxes(&box, &boxPose, 1);
+
+  const math::Capsuled capsule(4.0, 0.5);
+  const math::Pose3d capsulePose(0, 4, 0, 0, 0, 0);
+  field.AddCapsules(&capsule, &capsulePose, 1);
+
+  field.Bake();
+
+  // Near each primitive the field reports that primitive's distance.
+  EXPECT_NEAR(field.Distance(math::Vector3d(-4, 0, 0)), -1.0, 1e-9);
+  // The yawed box presents a corner toward the origin at distance
+  // 4 - sqrt(2) from its center along x.
+  EXPECT_NEAR(field.Distance(math::Vector3d(0, 0, 0)),
+      4.0 - std::sqrt(2.0), 0.2);
+  // Beside the capsule axis.
+  EXPECT_NEAR(field.Distance(math::Vector3d(2, 4, 0)), 1.5, 0.2);
+  // Inside the capsule.
+  EXPECT_LT(field.Distance(math::Vector3d(0, 4, 1)), 0.0);
+
+  // The field is the minimum over the whole set: near the midpoint of
+  // sphere and capsule, whichever is closer wins.
+  const double mid = field.Distance(math::Vector3d(-2, 2, 0));
+  const double toSphere = (math::Vector3d(-2, 2, 0) -
+      math::Vector3d(-4, 0, 0)).Length() - 1.0;
+  EXPECT_NEAR(mid, std::min(toSphere, 2.0 * std::sqrt(2.0) - 0.5), 0.2);
+}
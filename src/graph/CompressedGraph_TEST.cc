@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "ignition/math/graph/CompressedGraph.hh"
+#include "ignition/math/graph/Graph.hh"
+
+using namespace ignition;
+using namespace math;
+using namespace graph;
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, Empty)
+{
+  UndirectedGraph<int, double> graph;
+  CompressedUndirectedGraph<int, double> csr(graph);
+
+  EXPECT_EQ(csr.VertexCount(), 0u);
+  EXPECT_EQ(csr.EntryCount(), 0u);
+  EXPECT_EQ(csr.IndexFromId(0), kInvalidIndex);
+  ASSERT_EQ(csr.Offsets().size(), 1u);
+  EXPECT_EQ(csr.Offsets()[0], 0u);
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, Directed)
+{
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}},
+    // Edges.
+    {{{0, 1}, 2.0, 6.0}, {{0, 2}, 3.0, 1.0}, {{2, 1}, 4.0, 5.0}}
+  });
+
+  CompressedDirectedGraph<int, double> csr(graph);
+
+  ASSERT_EQ(csr.VertexCount(), 3u);
+  // A directed edge contributes a single adjacency entry.
+  EXPECT_EQ(csr.EntryCount(), 3u);
+
+  // Indices are assigned in ascending Id order.
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(csr.IdFromIndex(i), i);
+    EXPECT_EQ(csr.IndexFromId(i), i);
+  }
+
+  EXPECT_EQ(csr.Degree(0), 2u);
+  EXPECT_EQ(csr.Degree(1), 0u);
+  EXPECT_EQ(csr.Degree(2), 1u);
+
+  // Vertex 2's single entry points at vertex 1 with weight 5.
+  auto begin = csr.Offsets()[2];
+  ASSERT_EQ(csr.Offsets()[3] - begin, 1u);
+  EXPECT_EQ(csr.Targets()[begin], 1u);
+  EXPECT_DOUBLE_EQ(csr.Weights()[begin], 5.0);
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, UndirectedMatchesGraph)
+{
+  UndirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}},
+    // Edges.
+    {{{0, 1}, 2.0, 6.0}, {{0, 3}, 3.0, 1.0},
+     {{1, 2}, 4.0, 5.0}, {{2, 3}, 2.0, 2.0}}
+  });
+
+  CompressedUndirectedGraph<int, double> csr(graph);
+
+  ASSERT_EQ(csr.VertexCount(), 4u);
+  // Undirected edges appear once per endpoint.
+  EXPECT_EQ(csr.EntryCount(), 8u);
+
+  // Every adjacency entry must correspond to an incident edge of the
+  // source graph, with a matching weight.
+  for (std::size_t i = 0; i < csr.VertexCount(); ++i)
+  {
+    auto id = csr.IdFromIndex(i);
+    auto incidents = graph.IncidentsFrom(id);
+    ASSERT_EQ(csr.Degree(i), incidents.size());
+
+    for (auto e = csr.Offsets()[i]; e < csr.Offsets()[i + 1]; ++e)
+    {
+      auto neighborId = csr.IdFromIndex(csr.Targets()[e]);
+      bool found = false;
+      for (auto const &edgePair : incidents)
+      {
+        const auto &edge = edgePair.second.get();
+        if (edge.From(id) == neighborId &&
+            math::equal(edge.Weight(), csr.Weights()[e]))
+        {
+          found = true;
+          break;
+        }
+      }
+      EXPECT_TRUE(found) << "entry " << e << " of vertex " << id;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, PayloadColumns)
+{
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 10, 0}, {"B", 20, 1}, {"C", 30, 2}},
+    // Edges.
+    {{{0, 1}, 2.0, 6.0}, {{0, 2}, 3.0, 1.0}, {{2, 1}, 4.0, 5.0}}
+  });
+
+  ColumnarDirectedGraph<int, double> csr(graph);
+
+  // The vertex payload column is indexed like the topology arrays.
+  ASSERT_EQ(csr.VertexDataColumn().size(), csr.VertexCount());
+  for (std::size_t i = 0; i < csr.VertexCount(); ++i)
+  {
+    EXPECT_EQ(csr.VertexData(i),
+        graph.VertexFromId(csr.IdFromIndex(i)).Data());
+  }
+  EXPECT_EQ(csr.VertexData(0), 10);
+  EXPECT_EQ(csr.VertexData(2), 30);
+
+  // The edge payload column is parallel to Targets() and Weights().
+  ASSERT_EQ(csr.EdgeDataColumn().size(), csr.EntryCount());
+  auto begin = csr.Offsets()[2];
+  EXPECT_DOUBLE_EQ(csr.EdgeData(begin), 4.0);
+
+  // A topology-only snapshot of the same graph keeps identical
+  // structure; payloads simply are not materialized.
+  CompressedDirectedGraph<int, double> topo(graph);
+  EXPECT_EQ(topo.Offsets(), csr.Offsets());
+  EXPECT_EQ(topo.Targets(), csr.Targets());
+  EXPECT_EQ(topo.Weights(), csr.Weights());
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, View)
+{
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices with non-contiguous Ids.
+    {{"A", 0, 2}, {"B", 0, 5}, {"C", 0, 7}, {"D", 0, 11}},
+    // Edges.
+    {{{2, 5}, 1.0, 2.0}, {{2, 7}, 1.0, 3.0}, {{7, 5}, 1.0, 4.0},
+     {{5, 11}, 1.0, 5.0}}
+  });
+
+  CompressedDirectedGraph<int, double> csr(graph);
+
+  // Wrap the snapshot's own arrays, as a shared-memory receiver would
+  // wrap a segment filled from them. No copies, no insertions.
+  CompressedGraphView view(csr.VertexCount(), csr.Offsets().data(),
+      csr.Targets().data(), csr.Weights().data(), csr.Ids().data());
+
+  EXPECT_EQ(view.VertexCount(), csr.VertexCount());
+  EXPECT_EQ(view.EntryCount(), csr.EntryCount());
+  for (std::size_t i = 0; i < csr.VertexCount(); ++i)
+  {
+    EXPECT_EQ(view.IdFromIndex(i), csr.IdFromIndex(i));
+    EXPECT_EQ(view.IndexFromId(csr.IdFromIndex(i)), i);
+    ASSERT_EQ(view.Degree(i), csr.Degree(i));
+    for (std::size_t n = 0; n < view.Degree(i); ++n)
+    {
+      EXPECT_EQ(view.Target(i, n), csr.Targets()[csr.Offsets()[i] + n]);
+      EXPECT_DOUBLE_EQ(view.Weight(i, n),
+          csr.Weights()[csr.Offsets()[i] + n]);
+    }
+  }
+
+  // Ids absent from the snapshot are rejected by the binary search.
+  EXPECT_EQ(view.IndexFromId(0), kInvalidIndex);
+  EXPECT_EQ(view.IndexFromId(6), kInvalidIndex);
+  EXPECT_EQ(view.IndexFromId(100), kInvalidIndex);
+
+  // The converting constructor wraps a snapshot in one step.
+  CompressedGraphView same(csr);
+  EXPECT_EQ(same.VertexCount(), view.VertexCount());
+  EXPECT_EQ(same.IndexFromId(11), view.IndexFromId(11));
+
+  // Without Id and weight arrays, indices are Ids and weights are 1.
+  CompressedGraphView bare(csr.VertexCount(), csr.Offsets().data(),
+      csr.Targets().data());
+  EXPECT_EQ(bare.IdFromIndex(2), VertexId(2));
+  EXPECT_EQ(bare.IndexFromId(3), 3u);
+  EXPECT_EQ(bare.IndexFromId(csr.VertexCount()), kInvalidIndex);
+  EXPECT_DOUBLE_EQ(bare.Weight(0, 0), 1.0);
+
+  // An empty view answers like an empty snapshot.
+  CompressedGraphView empty;
+  EXPECT_EQ(empty.VertexCount(), 0u);
+  EXPECT_EQ(empty.EntryCount(), 0u);
+  EXPECT_EQ(empty.IndexFromId(0), kInvalidIndex);
+}
@@ -16,7 +16,9 @@
 */
 
 #include <gtest/gtest.h>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "ignition/math/graph/Graph.hh"
 #include "ignition/math/graph/GraphAlgorithms.hh"
@@ -55,6 +57,71 @@ TYPED_TEST(GraphTestFixture, BreadthFirstSort)
   EXPECT_EQ(expected, res);
 }
 
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, VisitedBitmap)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}},
+    // Edges. Vertex 6 is only reachable through 2.
+    {{{0, 1}, 2.0}, {{0, 2}, 3.0}, {{0, 4}, 4.0},
+     {{1, 3}, 2.0}, {{1, 5}, 3.0}, {{2, 6}, 4.0},
+     {{5, 4}, 2.0}}
+  });
+
+  // The bitmap overloads match the plain ones from every start vertex
+  // and hand back the visited set for O(1) reachability tests.
+  graph::VisitedBitmap visited;
+  std::vector<VertexId> order;
+  for (VertexId from = 0; from < 7; ++from)
+  {
+    BreadthFirstSort(graph, from, visited, order);
+    EXPECT_EQ(BreadthFirstSort(graph, from), order) << from;
+    EXPECT_EQ(order.size(), visited.Count()) << from;
+    for (auto const &vId : order)
+      EXPECT_TRUE(visited.Contains(vId)) << from << " " << vId;
+
+    DepthFirstSort(graph, from, visited, order);
+    EXPECT_EQ(DepthFirstSort(graph, from), order) << from;
+    EXPECT_EQ(order.size(), visited.Count()) << from;
+  }
+
+  // A reachability query: from vertex 1 of the directed graph, vertex
+  // 6 is unreachable; in the undirected graph everything connects.
+  BreadthFirstSort(graph, 1, visited, order);
+  EXPECT_TRUE(visited.Contains(3));
+  EXPECT_EQ(graph.Edges().size() == 7u && order.size() == 7u,
+            visited.Contains(6));
+  EXPECT_FALSE(visited.Contains(99));
+
+  // An unknown starting vertex visits nothing.
+  BreadthFirstSort(graph, 99, visited, order);
+  EXPECT_TRUE(order.empty());
+  EXPECT_EQ(0u, visited.Count());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, VisitedBitmapSparseIds)
+{
+  // A vertex id far beyond the vertex count lands in the bitmap's
+  // overflow set; the traversal is unaffected.
+  DirectedGraph<int, double> graph(
+  {
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 1000000}},
+    {{{0, 1}, 1.0}, {{1, 1000000}, 1.0}}
+  });
+
+  graph::VisitedBitmap visited;
+  std::vector<VertexId> order;
+  BreadthFirstSort(graph, 0, visited, order);
+  const std::vector<VertexId> expected = {0, 1, 1000000};
+  EXPECT_EQ(expected, order);
+  EXPECT_TRUE(visited.Contains(1000000));
+  EXPECT_FALSE(visited.Contains(2));
+}
+
 /////////////////////////////////////////////////
 TEST(GraphTest, DepthFirstSortDirected)
 {
@@ -91,6 +158,99 @@ TEST(UndirectedGraphTest, DepthFirstSortUndirected)
   EXPECT_EQ(expected, res);
 }
 
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, TraversalScratch)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}},
+    // Edges.
+    {{{0, 1}, 2.0}, {{0, 2}, 3.0}, {{0, 4}, 4.0},
+     {{1, 3}, 2.0}, {{1, 5}, 3.0}, {{2, 6}, 4.0},
+     {{5, 4}, 2.0}}
+  });
+
+  // The scratch-based overloads match the plain ones from every start
+  // vertex, reusing the same scratch across calls.
+  TraversalScratch scratch;
+  std::vector<VertexId> visited;
+  for (VertexId from = 0; from < 7; ++from)
+  {
+    BreadthFirstSort(graph, from, scratch, visited);
+    EXPECT_EQ(BreadthFirstSort(graph, from), visited) << from;
+
+    DepthFirstSort(graph, from, scratch, visited);
+    EXPECT_EQ(DepthFirstSort(graph, from), visited) << from;
+  }
+
+  // An unknown starting vertex visits nothing.
+  BreadthFirstSort(graph, 99, scratch, visited);
+  EXPECT_TRUE(visited.empty());
+
+  // Repeated traversals reuse the bound structures.
+  const std::size_t boundVertices = scratch.boundVertices;
+  BreadthFirstSort(graph, 0, scratch, visited);
+  EXPECT_EQ(boundVertices, scratch.boundVertices);
+
+  // The scratch rebinds itself after the graph changes.
+  graph.AddVertex("H", 7, 7);
+  graph.AddEdge({6, 7}, 1.0);
+  BreadthFirstSort(graph, 0, scratch, visited);
+  EXPECT_EQ(BreadthFirstSort(graph, 0), visited);
+  EXPECT_EQ(8u, scratch.boundVertices);
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, Partition)
+{
+  // Two tight clusters {0,1,2} and {3,4,5} joined by one light edge.
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2},
+     {"D", 3, 3}, {"E", 4, 4}, {"F", 5, 5}},
+    // Edges.
+    {{{0, 1}, 0.0, 10.0}, {{1, 2}, 0.0, 10.0}, {{0, 2}, 0.0, 10.0},
+     {{3, 4}, 0.0, 10.0}, {{4, 5}, 0.0, 10.0}, {{3, 5}, 0.0, 10.0},
+     {{2, 3}, 0.0, 1.0}}
+  });
+
+  auto parts = Partition(graph, 2);
+  ASSERT_EQ(6u, parts.size());
+
+  // Parts are balanced and split along the light edge.
+  EXPECT_EQ(parts[0], parts[1]);
+  EXPECT_EQ(parts[0], parts[2]);
+  EXPECT_EQ(parts[3], parts[4]);
+  EXPECT_EQ(parts[3], parts[5]);
+  EXPECT_NE(parts[0], parts[3]);
+  for (const auto &entry : parts)
+    EXPECT_LT(entry.second, 2u);
+
+  // k = 1 puts everything in part 0.
+  parts = Partition(graph, 1);
+  for (const auto &entry : parts)
+    EXPECT_EQ(0u, entry.second);
+
+  // k beyond the vertex count still assigns every vertex a part below
+  // the vertex count, each part holding one vertex.
+  parts = Partition(graph, 10);
+  std::vector<int> counts(6, 0);
+  for (const auto &entry : parts)
+  {
+    ASSERT_LT(entry.second, 6u);
+    ++counts[entry.second];
+  }
+  for (const int count : counts)
+    EXPECT_EQ(1, count);
+
+  // Invalid part counts are rejected.
+  EXPECT_TRUE(Partition(graph, 0).empty());
+  EXPECT_TRUE(Partition(graph, -2).empty());
+}
+
 /////////////////////////////////////////////////
 TEST(GraphTestFixture, DijkstraUndirected)
 {
@@ -369,3 +529,889 @@ TEST(GraphTestFixture, ToUndirectedGraph)
   // std::cerr << directed << std::endl;
   // std::cerr << undirected << std::endl;
 }
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, ParallelBreadthFirstSort)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}},
+    // Edges.
+    {{{0, 1}, 2.0}, {{0, 2}, 3.0}, {{0, 4}, 4.0},
+     {{1, 3}, 2.0}, {{1, 5}, 3.0}, {{2, 6}, 4.0},
+     {{5, 4}, 2.0}}
+  });
+
+  // Inexistent source vertex.
+  EXPECT_TRUE(ParallelBreadthFirstSort(graph, 99).empty());
+
+  // The parallel variant must reproduce the sequential visit order,
+  // whatever the thread count.
+  auto expected = BreadthFirstSort(graph, 0);
+  for (unsigned int threads : {1u, 2u, 4u})
+    EXPECT_EQ(expected, ParallelBreadthFirstSort(graph, 0, threads));
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, ParallelDijkstra)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4}},
+    // Edges.
+    {{{0, 1}, 2.0, 6.0}, {{0, 3}, 3.0, 1.0},
+     {{1, 2}, 4.0, 5.0}, {{1, 3}, 4.0, 2.0}, {{1, 4}, 4.0, 2.0},
+     {{2, 4}, 2.0, 5.0},
+     {{3, 4}, 2.0, 1.0}}
+  });
+
+  // Inexistent source vertex.
+  EXPECT_TRUE(ParallelDijkstra(graph, 99).empty());
+
+  auto expected = Dijkstra(graph, 0);
+  for (unsigned int threads : {1u, 2u, 4u})
+  {
+    // Exercise the automatic and an explicit bucket width.
+    for (double delta : {0.0, 0.5})
+    {
+      auto res = ParallelDijkstra(graph, 0, delta, threads);
+      ASSERT_EQ(expected.size(), res.size());
+      for (auto const &pair : expected)
+        EXPECT_DOUBLE_EQ(pair.second.first, res[pair.first].first);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, ConnectedComponentIds)
+{
+  // Two components: {0, 1, 2} and {3, 4}; vertex 5 is isolated.
+  UndirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2},
+     {"3", 3, 3}, {"4", 4, 4}, {"5", 5, 5}},
+    {{{0, 1}, 1.0}, {{1, 2}, 1.0}, {{3, 4}, 1.0}});
+
+  auto components = ConnectedComponentIds(graph);
+  ASSERT_EQ(6u, components.size());
+
+  EXPECT_EQ(0u, components[0]);
+  EXPECT_EQ(components[0], components[1]);
+  EXPECT_EQ(components[0], components[2]);
+  EXPECT_EQ(1u, components[3]);
+  EXPECT_EQ(components[3], components[4]);
+  EXPECT_EQ(2u, components[5]);
+
+  // The labels agree with the subgraphs from ConnectedComponents.
+  auto subgraphs = ConnectedComponents(graph);
+  EXPECT_EQ(3u, subgraphs.size());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, StronglyConnectedComponents)
+{
+  // A cycle {0, 1, 2}, a cycle {3, 4} reachable from it, and a tail
+  // vertex 5.
+  DirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2},
+     {"3", 3, 3}, {"4", 4, 4}, {"5", 5, 5}},
+    {{{0, 1}, 1.0}, {{1, 2}, 1.0}, {{2, 0}, 1.0},
+     {{2, 3}, 1.0}, {{3, 4}, 1.0}, {{4, 3}, 1.0},
+     {{4, 5}, 1.0}});
+
+  auto components = StronglyConnectedComponents(graph);
+  ASSERT_EQ(6u, components.size());
+
+  EXPECT_EQ(components[0], components[1]);
+  EXPECT_EQ(components[1], components[2]);
+  EXPECT_EQ(components[3], components[4]);
+  EXPECT_NE(components[0], components[3]);
+  EXPECT_NE(components[3], components[5]);
+  EXPECT_NE(components[0], components[5]);
+
+  // Tarjan emits components in reverse topological order: the sink
+  // component {5} first, then {3, 4}, then {0, 1, 2}.
+  EXPECT_EQ(0u, components[5]);
+  EXPECT_EQ(1u, components[3]);
+  EXPECT_EQ(2u, components[0]);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, AStar)
+{
+  // A 5x5 grid of unit-weight edges with coordinates encoded in the
+  // vertex data, so the Manhattan distance is an admissible heuristic.
+  const int side = 5;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (int y = 0; y < side; ++y)
+  {
+    for (int x = 0; x < side; ++x)
+    {
+      const VertexId id = y * side + x;
+      vertices.push_back({std::to_string(id), y * side + x, id});
+      if (x + 1 < side)
+        edges.push_back({{id, id + 1}, 1.0, 1.0});
+      if (y + 1 < side)
+        edges.push_back({{id, id + side}, 1.0, 1.0});
+    }
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+
+  auto manhattan = [side](const VertexId _a, const VertexId _b)
+  {
+    return static_cast<double>(
+        std::abs(static_cast<int>(_a % side) -
+                 static_cast<int>(_b % side)) +
+        std::abs(static_cast<int>(_a / side) -
+                 static_cast<int>(_b / side)));
+  };
+
+  const VertexId from = 0;
+  const VertexId to = side * side - 1;
+
+  auto expected = Dijkstra(graph, from, to);
+  auto result = AStar(graph, from, to,
+      [&](const VertexId _v)
+      {
+        return manhattan(_v, to);
+      });
+
+  ASSERT_NE(result.end(), result.find(to));
+  EXPECT_DOUBLE_EQ(expected[to].first, result[to].first);
+  EXPECT_DOUBLE_EQ(8.0, result[to].first);
+
+  // A missing vertex yields an empty result.
+  EXPECT_TRUE(AStar(graph, from, 999,
+      [](const VertexId)
+      {
+        return 0.0;
+      }).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, BidirectionalAStar)
+{
+  const int side = 5;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (int y = 0; y < side; ++y)
+  {
+    for (int x = 0; x < side; ++x)
+    {
+      const VertexId id = y * side + x;
+      vertices.push_back({std::to_string(id), 0, id});
+      if (x + 1 < side)
+        edges.push_back({{id, id + 1}, 1.0, 1.0});
+      if (y + 1 < side)
+        edges.push_back({{id, id + side}, 1.0, 1.0});
+    }
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+
+  auto manhattan = [side](const VertexId _a, const VertexId _b)
+  {
+    return static_cast<double>(
+        std::abs(static_cast<int>(_a % side) -
+                 static_cast<int>(_b % side)) +
+        std::abs(static_cast<int>(_a / side) -
+                 static_cast<int>(_b / side)));
+  };
+
+  const VertexId from = 0;
+  const VertexId to = side * side - 1;
+
+  auto result = BidirectionalAStar(graph, from, to,
+      [&](const VertexId _v)
+      {
+        return manhattan(_v, to);
+      },
+      [&](const VertexId _v)
+      {
+        return manhattan(from, _v);
+      });
+
+  EXPECT_DOUBLE_EQ(8.0, result.first);
+  ASSERT_FALSE(result.second.empty());
+  EXPECT_EQ(from, result.second.front());
+  EXPECT_EQ(to, result.second.back());
+
+  // The path is connected and its length matches the reported cost.
+  double length = 0.0;
+  for (size_t i = 0; i + 1 < result.second.size(); ++i)
+  {
+    auto &edge = graph.EdgeFromVertices(result.second[i],
+        result.second[i + 1]);
+    ASSERT_TRUE(edge.Valid());
+    length += edge.Weight();
+  }
+  EXPECT_DOUBLE_EQ(result.first, length);
+
+  // Trivial and unreachable queries.
+  auto self = BidirectionalAStar(graph, from, from,
+      [](const VertexId) { return 0.0; },
+      [](const VertexId) { return 0.0; });
+  EXPECT_DOUBLE_EQ(0.0, self.first);
+  ASSERT_EQ(1u, self.second.size());
+
+  // Two disconnected vertices.
+  UndirectedGraph<int, double> split(
+      {{"0", 0, 0}, {"1", 1, 1}}, {});
+  auto none = BidirectionalAStar(split, 0, 1,
+      [](const VertexId) { return 0.0; },
+      [](const VertexId) { return 0.0; });
+  EXPECT_DOUBLE_EQ(MAX_D, none.first);
+  EXPECT_TRUE(none.second.empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, DijkstraContext)
+{
+  // The weighted graph from the Dijkstra documentation.
+  UndirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4}},
+    {{{0, 1}, 0.0, 6.0}, {{0, 3}, 0.0, 1.0}, {{1, 3}, 0.0, 2.0},
+     {{1, 4}, 0.0, 2.0}, {{1, 2}, 0.0, 5.0}, {{2, 4}, 0.0, 5.0},
+     {{3, 4}, 0.0, 1.0}});
+
+  DijkstraContext<int, double, UndirectedEdge<double>> context(graph);
+
+  // Full query matches Dijkstra for every destination.
+  ASSERT_TRUE(context.Run(0));
+  auto expected = Dijkstra(graph, 0);
+  for (auto const &entry : expected)
+  {
+    EXPECT_DOUBLE_EQ(entry.second.first, context.Cost(entry.first))
+        << "vertex " << entry.first;
+  }
+  EXPECT_EQ(3u, context.Previous(4));
+
+  // Path reconstruction.
+  auto path = context.Path(2);
+  ASSERT_EQ(4u, path.size());
+  EXPECT_EQ(0u, path[0]);
+  EXPECT_EQ(3u, path[1]);
+  EXPECT_EQ(4u, path[2]);
+  EXPECT_EQ(2u, path[3]);
+
+  // The context is reusable: a second query from another source.
+  ASSERT_TRUE(context.Run(2));
+  auto expected2 = Dijkstra(graph, 2);
+  for (auto const &entry : expected2)
+    EXPECT_DOUBLE_EQ(entry.second.first, context.Cost(entry.first));
+
+  // Early-exit query still answers the requested destination.
+  ASSERT_TRUE(context.Run(0, 3));
+  EXPECT_DOUBLE_EQ(1.0, context.Cost(3));
+
+  // Unknown vertices are rejected.
+  EXPECT_FALSE(context.Run(99));
+  EXPECT_FALSE(context.Run(0, 99));
+  EXPECT_DOUBLE_EQ(MAX_D, context.Cost(99));
+  EXPECT_EQ(kNullId, context.Previous(99));
+  EXPECT_TRUE(context.Path(99).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, DynamicShortestPathTree)
+{
+  // The same weighted graph used by the Dijkstra documentation.
+  DirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4},
+     {"5", 5, 5}},
+    {{{0, 1}, 0.0, 2.0}, {{0, 3}, 0.0, 1.0}, {{1, 2}, 0.0, 6.0},
+     {{1, 4}, 0.0, 4.0}, {{3, 1}, 0.0, 7.0}, {{3, 4}, 0.0, 3.0},
+     {{4, 2}, 0.0, 3.0}, {{4, 5}, 0.0, 9.0}, {{2, 5}, 0.0, 1.0}});
+
+  DynamicShortestPathTree<int, double, DirectedEdge<double>> tree(graph, 0);
+  EXPECT_EQ(0u, tree.Source());
+
+  // The initial tree agrees with a fresh Dijkstra run.
+  auto expected = Dijkstra(graph, 0);
+  for (auto const &entry : expected)
+  {
+    EXPECT_DOUBLE_EQ(entry.second.first, tree.Cost(entry.first))
+        << "vertex " << entry.first;
+  }
+  EXPECT_EQ(3u, tree.Previous(4));
+
+  // A weight decrease reroutes through the cheaper edge: with
+  // weight(1->2) = 1 the best path to 2 becomes 0->1->2 at cost 3.
+  EXPECT_TRUE(tree.UpdateEdgeWeight(1, 2, 1.0));
+  EXPECT_DOUBLE_EQ(3.0, tree.Cost(2));
+  EXPECT_EQ(1u, tree.Previous(2));
+  // And the improvement propagates to 5 through 2->5.
+  EXPECT_DOUBLE_EQ(4.0, tree.Cost(5));
+
+  // A weight increase on a tree edge repairs only the affected
+  // subtree: raising 0->1 makes 3->1 the better way in.
+  EXPECT_TRUE(tree.UpdateEdgeWeight(0, 1, 20.0));
+  EXPECT_DOUBLE_EQ(8.0, tree.Cost(1));
+  EXPECT_EQ(3u, tree.Previous(1));
+  EXPECT_DOUBLE_EQ(7.0, tree.Cost(2));
+
+  // Increasing a non-tree edge is a no-op on the distances.
+  const double cost4 = tree.Cost(4);
+  EXPECT_TRUE(tree.UpdateEdgeWeight(4, 5, 50.0));
+  EXPECT_DOUBLE_EQ(cost4, tree.Cost(4));
+
+  // After the batch of updates the tree still matches from-scratch
+  // Dijkstra on an equivalently reweighted graph.
+  DirectedGraph<int, double> updated(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4},
+     {"5", 5, 5}},
+    {{{0, 1}, 0.0, 20.0}, {{0, 3}, 0.0, 1.0}, {{1, 2}, 0.0, 1.0},
+     {{1, 4}, 0.0, 4.0}, {{3, 1}, 0.0, 7.0}, {{3, 4}, 0.0, 3.0},
+     {{4, 2}, 0.0, 3.0}, {{4, 5}, 0.0, 50.0}, {{2, 5}, 0.0, 1.0}});
+  auto reference = Dijkstra(updated, 0);
+  for (auto const &entry : reference)
+  {
+    EXPECT_DOUBLE_EQ(entry.second.first, tree.Cost(entry.first))
+        << "vertex " << entry.first;
+  }
+
+  // Unknown vertices and missing edges are rejected.
+  EXPECT_FALSE(tree.UpdateEdgeWeight(0, 99, 1.0));
+  EXPECT_FALSE(tree.UpdateEdgeWeight(2, 0, 1.0));
+  EXPECT_DOUBLE_EQ(MAX_D, tree.Cost(99));
+  EXPECT_EQ(kNullId, tree.Previous(99));
+
+  // A weight increase can disconnect part of the tree.
+  EXPECT_TRUE(tree.UpdateEdgeWeight(2, 5, 1.0));
+  DynamicShortestPathTree<int, double, DirectedEdge<double>> small(
+      DirectedGraph<int, double>(
+          {{"0", 0, 0}, {"1", 1, 1}}, {{{0, 1}, 0.0, 5.0}}), 0);
+  EXPECT_DOUBLE_EQ(5.0, small.Cost(1));
+  EXPECT_TRUE(small.UpdateEdgeWeight(0, 1, MAX_D));
+  EXPECT_DOUBLE_EQ(MAX_D, small.Cost(1));
+  EXPECT_EQ(kNullId, small.Previous(1));
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, TopologicalSort)
+{
+  // A diamond with a tail: 0 -> {1, 2} -> 3 -> 4.
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4}},
+    // Edges.
+    {{{0, 1}, 2.0}, {{0, 2}, 3.0}, {{1, 3}, 2.0}, {{2, 3}, 4.0},
+     {{3, 4}, 1.0}}
+  });
+
+  const auto sorted = TopologicalSort(graph);
+  const std::vector<VertexId> expected = {0, 1, 2, 3, 4};
+  EXPECT_EQ(expected, sorted);
+
+  // Every edge points forward in the order.
+  std::map<VertexId, size_t> position;
+  for (size_t i = 0; i < sorted.size(); ++i)
+    position[sorted[i]] = i;
+  for (const auto &e : graph.Edges())
+  {
+    EXPECT_LT(position[e.second.get().Tail()],
+              position[e.second.get().Head()]);
+  }
+
+  // A cycle yields an empty result.
+  graph.AddEdge({4, 0}, 1.0);
+  EXPECT_TRUE(TopologicalSort(graph).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, LevelSchedule)
+{
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}},
+    // Edges.
+    {{{0, 1}, 1.0}, {{0, 2}, 1.0}, {{1, 3}, 1.0}, {{2, 3}, 1.0},
+     {{3, 4}, 1.0}}
+  });
+
+  const auto schedule = LevelSchedule(graph);
+  ASSERT_EQ(4u, schedule.size());
+
+  // 5 has no dependencies so it can run with the first level.
+  const std::vector<VertexId> level0 = {0, 5};
+  const std::vector<VertexId> level1 = {1, 2};
+  const std::vector<VertexId> level2 = {3};
+  const std::vector<VertexId> level3 = {4};
+  EXPECT_EQ(level0, schedule[0]);
+  EXPECT_EQ(level1, schedule[1]);
+  EXPECT_EQ(level2, schedule[2]);
+  EXPECT_EQ(level3, schedule[3]);
+
+  // A cyclic graph cannot be scheduled.
+  graph.AddEdge({4, 1}, 1.0);
+  EXPECT_TRUE(LevelSchedule(graph).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, ToAdjacencyMatrixDirected)
+{
+  DirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}},
+    // Edges.
+    {{{0, 1}, 0.0, 2.0}, {{1, 2}, 0.0, 3.0}, {{2, 0}, 0.0, 4.0}}
+  });
+
+  std::vector<double> matrix;
+  const auto ids = ToAdjacencyMatrix(graph, matrix);
+  const std::vector<VertexId> expectedIds = {0, 1, 2};
+  EXPECT_EQ(expectedIds, ids);
+  ASSERT_EQ(9u, matrix.size());
+
+  const std::vector<double> expected = {
+    0.0, 2.0, 0.0,
+    0.0, 0.0, 3.0,
+    4.0, 0.0, 0.0};
+  EXPECT_EQ(expected, matrix);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, ToLaplacianUndirected)
+{
+  UndirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}},
+    // Edges.
+    {{{0, 1}, 0.0, 2.0}, {{1, 2}, 0.0, 3.0}}
+  });
+
+  std::vector<double> adjacency;
+  ToAdjacencyMatrix(graph, adjacency);
+  const std::vector<double> expectedAdjacency = {
+    0.0, 2.0, 0.0,
+    2.0, 0.0, 3.0,
+    0.0, 3.0, 0.0};
+  EXPECT_EQ(expectedAdjacency, adjacency);
+
+  std::vector<double> laplacian;
+  const auto ids = ToLaplacian(graph, laplacian);
+  ASSERT_EQ(3u, ids.size());
+  const std::vector<double> expectedLaplacian = {
+     2.0, -2.0,  0.0,
+    -2.0,  5.0, -3.0,
+     0.0, -3.0,  3.0};
+  EXPECT_EQ(expectedLaplacian, laplacian);
+
+  // Laplacian rows sum to zero.
+  for (size_t i = 0; i < 3; ++i)
+  {
+    double sum = 0.0;
+    for (size_t j = 0; j < 3; ++j)
+      sum += laplacian[i * 3 + j];
+    EXPECT_DOUBLE_EQ(0.0, sum);
+  }
+
+  // Parallel edges accumulate.
+  graph.AddEdge({0, 1}, 0.0, 0.5);
+  ToAdjacencyMatrix(graph, adjacency);
+  EXPECT_DOUBLE_EQ(2.5, adjacency[1]);
+  EXPECT_DOUBLE_EQ(2.5, adjacency[3]);
+
+  // An empty graph produces an empty matrix.
+  UndirectedGraph<int, double> empty;
+  const auto emptyIds = ToAdjacencyMatrix(empty, adjacency);
+  EXPECT_TRUE(emptyIds.empty());
+  EXPECT_TRUE(adjacency.empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, FrontierBreadthFirst)
+{
+  // A source fanning out to a dense middle layer and on to a wide
+  // leaf layer, so the middle frontier is dense enough to trigger
+  // the bottom-up sweep on the undirected snapshot.
+  UndirectedGraph<int, double> graph;
+  const VertexId source = graph.AddVertex("source", 0).Id();
+  std::vector<VertexId> middle, leaves;
+  for (int i = 0; i < 40; ++i)
+  {
+    middle.push_back(graph.AddVertex("m", 1).Id());
+    graph.AddEdge({source, middle.back()}, 0);
+  }
+  for (int i = 0; i < 80; ++i)
+  {
+    leaves.push_back(graph.AddVertex("l", 2).Id());
+    graph.AddEdge({middle[i % middle.size()], leaves.back()}, 0);
+  }
+
+  // Reference levels via the vertex data: 0, 1 and 2 by layer.
+  const CompressedUndirectedGraph<int, double> snapshot(graph);
+  FrontierBreadthFirst<int, double, UndirectedEdge<double>> engine;
+  std::vector<std::size_t> order;
+  engine.Traverse(snapshot, snapshot.IndexFromId(source), order);
+
+  // Every vertex appears exactly once, in level order.
+  ASSERT_EQ(snapshot.VertexCount(), order.size());
+  std::set<std::size_t> seen(order.begin(), order.end());
+  EXPECT_EQ(order.size(), seen.size());
+  int previousLevel = -1;
+  for (const std::size_t index : order)
+  {
+    const int level = graph.VertexFromId(
+        snapshot.IdFromIndex(index)).Data();
+    EXPECT_LE(previousLevel, level);
+    previousLevel = level;
+  }
+
+  // Reusing the engine reproduces the traversal.
+  std::vector<std::size_t> again;
+  engine.Traverse(snapshot, snapshot.IndexFromId(source), again);
+  EXPECT_EQ(order, again);
+
+  // An out-of-range source yields an empty order.
+  engine.Traverse(snapshot, snapshot.VertexCount(), order);
+  EXPECT_TRUE(order.empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, FrontierBreadthFirstDirected)
+{
+  // Directed graphs always run top down, and the per-level vertex
+  // sets match BreadthFirstSort.
+  DirectedGraph<int, double> graph(
+  {
+    {{"v0", 0, 0}, {"v1", 1, 1}, {"v2", 2, 2}, {"v3", 3, 3},
+     {"v4", 4, 4}, {"v5", 5, 5}, {"v6", 6, 6}},
+    {{{0, 1}, 1.0}, {{0, 2}, 1.0}, {{1, 3}, 1.0}, {{2, 3}, 1.0},
+     {{3, 4}, 1.0}, {{4, 5}, 1.0}, {{2, 6}, 1.0}}
+  });
+
+  const CompressedDirectedGraph<int, double> snapshot(graph);
+  FrontierBreadthFirst<int, double, DirectedEdge<double>> engine;
+  std::vector<std::size_t> order;
+  engine.Traverse(snapshot, snapshot.IndexFromId(0), order);
+
+  auto expected = BreadthFirstSort(graph, 0);
+  ASSERT_EQ(expected.size(), order.size());
+  std::set<VertexId> expectedIds(expected.begin(), expected.end());
+  std::set<VertexId> ids;
+  for (const std::size_t index : order)
+    ids.insert(snapshot.IdFromIndex(index));
+  EXPECT_EQ(expectedIds, ids);
+
+  // Vertex 5 is four hops away and appears last in both.
+  EXPECT_EQ(expected.back(), snapshot.IdFromIndex(order.back()));
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, MultiSourceDijkstra)
+{
+  // A directed grid-like graph with an asymmetric shortcut, so the
+  // backward search is only correct if it honors edge directions.
+  DirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4},
+     {"5", 5, 5}, {"6", 6, 6}},
+    {{{0, 1}, 0.0, 1.0}, {{1, 2}, 0.0, 1.0}, {{2, 6}, 0.0, 1.0},
+     {{0, 3}, 0.0, 2.0}, {{3, 4}, 0.0, 2.0}, {{4, 6}, 0.0, 2.0},
+     {{5, 0}, 0.0, 1.0}, {{6, 5}, 0.0, 10.0}, {{1, 4}, 0.0, 0.5}});
+
+  MultiSourceDijkstra<int, double, DirectedEdge<double>> engine(graph);
+
+  // One backward run from the shared goal answers every agent's
+  // query; costs must match a forward Dijkstra per agent.
+  ASSERT_TRUE(engine.RunToTargets({6}));
+  for (auto const &v : graph.Vertices())
+  {
+    auto solo = Dijkstra(graph, v.first, 6);
+    const double expected = solo.count(6) &&
+        !equal(solo.at(6).first, MAX_D) ? solo.at(6).first : MAX_D;
+    EXPECT_DOUBLE_EQ(expected, engine.Cost(v.first))
+        << "vertex " << v.first;
+  }
+
+  // Paths follow directed edges from the agent to the goal.
+  auto path = engine.Path(0);
+  ASSERT_EQ(4u, path.size());
+  EXPECT_EQ(0u, path[0]);
+  EXPECT_EQ(1u, path[1]);
+  EXPECT_EQ(2u, path[2]);
+  EXPECT_EQ(6u, path[3]);
+  EXPECT_EQ(6u, engine.NearestEndpoint(0));
+
+  // With several targets, each vertex routes to its nearest one.
+  ASSERT_TRUE(engine.RunToTargets({2, 4}));
+  // The 1 -> 4 shortcut (0.5) beats the 1 -> 2 edge (1.0).
+  EXPECT_DOUBLE_EQ(0.5, engine.Cost(1));
+  EXPECT_EQ(4u, engine.NearestEndpoint(1));
+  EXPECT_DOUBLE_EQ(2.0, engine.Cost(3));
+  EXPECT_EQ(4u, engine.NearestEndpoint(3));
+  EXPECT_DOUBLE_EQ(0.0, engine.Cost(2));
+
+  // Forward mode: one run from every source, nearest-source answers.
+  ASSERT_TRUE(engine.RunFromSources({0, 6}));
+  EXPECT_DOUBLE_EQ(0.0, engine.Cost(0));
+  EXPECT_DOUBLE_EQ(1.0, engine.Cost(1));
+  // Vertex 5 is cheaper from 6 (10.0) than from 0 (unreachable is
+  // not the case here: 0->...->6->5 costs 13; direct from source 6
+  // costs 10).
+  EXPECT_DOUBLE_EQ(10.0, engine.Cost(5));
+  EXPECT_EQ(6u, engine.NearestEndpoint(5));
+  auto forwardPath = engine.Path(4);
+  ASSERT_EQ(3u, forwardPath.size());
+  EXPECT_EQ(0u, forwardPath[0]);
+  EXPECT_EQ(1u, forwardPath[1]);
+  EXPECT_EQ(4u, forwardPath[2]);
+
+  // Unknown or empty seed sets are rejected.
+  EXPECT_FALSE(engine.RunToTargets({}));
+  EXPECT_FALSE(engine.RunToTargets({99}));
+  EXPECT_FALSE(engine.RunFromSources({0, 99}));
+  EXPECT_DOUBLE_EQ(MAX_D, engine.Cost(99));
+  EXPECT_EQ(kNullId, engine.NearestEndpoint(99));
+  EXPECT_TRUE(engine.Path(99).empty());
+
+  // Rebuild picks up topology changes.
+  graph.AddEdge({5, 6}, 0.0, 0.25);
+  engine.Rebuild(graph);
+  ASSERT_TRUE(engine.RunToTargets({6}));
+  EXPECT_DOUBLE_EQ(0.25, engine.Cost(5));
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, Coarsen)
+{
+  // Four pairs of vertices bound by heavy edges, chained together by
+  // light edges: heavy-edge matching must contract the pairs first.
+  UndirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3},
+     {"4", 4, 4}, {"5", 5, 5}, {"6", 6, 6}, {"7", 7, 7}},
+    {{{0, 1}, 1.0, 10.0}, {{2, 3}, 2.0, 10.0},
+     {{4, 5}, 3.0, 10.0}, {{6, 7}, 4.0, 10.0},
+     {{1, 2}, 5.0, 1.0}, {{3, 4}, 6.0, 1.0}, {{5, 6}, 7.0, 1.0}});
+
+  auto hierarchy = Coarsen(graph, 0.5);
+  ASSERT_EQ(1u, hierarchy.size());
+  const auto &level = hierarchy[0];
+  EXPECT_EQ(4u, level.graph.Vertices().size());
+  EXPECT_EQ(3u, level.graph.Edges().size());
+
+  // Every fine vertex maps to a coarse vertex of the level.
+  ASSERT_EQ(8u, level.parent.size());
+  for (const auto &pPair : level.parent)
+    EXPECT_TRUE(level.graph.VertexFromId(pPair.second).Valid());
+
+  // The heavy pairs collapsed into single clusters.
+  EXPECT_EQ(level.parent.at(0), level.parent.at(1));
+  EXPECT_EQ(level.parent.at(2), level.parent.at(3));
+  EXPECT_EQ(level.parent.at(4), level.parent.at(5));
+  EXPECT_EQ(level.parent.at(6), level.parent.at(7));
+  EXPECT_NE(level.parent.at(1), level.parent.at(2));
+
+  // Deeper coarsening produces strictly shrinking levels down to the
+  // target fraction.
+  auto deep = Coarsen(graph, 0.2);
+  ASSERT_GE(deep.size(), 2u);
+  size_t prev = graph.Vertices().size();
+  for (const auto &l : deep)
+  {
+    EXPECT_LT(l.graph.Vertices().size(), prev);
+    prev = l.graph.Vertices().size();
+  }
+  EXPECT_LE(deep.back().graph.Vertices().size(), 2u);
+
+  // Parallel fine edges merge with summed weight: contracting {0,1}
+  // and {2,3} in a square with unit cross edges yields one coarse
+  // edge of weight 2.
+  UndirectedGraph<int, int> square(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}},
+    {{{0, 1}, 0, 10.0}, {{2, 3}, 0, 10.0},
+     {{0, 2}, 0, 1.0}, {{1, 3}, 0, 1.0}});
+  auto squareHierarchy = Coarsen(square, 0.5);
+  ASSERT_EQ(1u, squareHierarchy.size());
+  ASSERT_EQ(1u, squareHierarchy[0].graph.Edges().size());
+  EXPECT_DOUBLE_EQ(2.0,
+      squareHierarchy[0].graph.Edges().begin()->second.get().Weight());
+
+  // Degenerate factors and already-small graphs yield no levels.
+  EXPECT_TRUE(Coarsen(graph, 0.0).empty());
+  EXPECT_TRUE(Coarsen(graph, 1.0).empty());
+  UndirectedGraph<int, int> single({{"0", 0, 0}}, {});
+  EXPECT_TRUE(Coarsen(single, 0.5).empty());
+
+  // An edgeless graph cannot contract: no levels either.
+  UndirectedGraph<int, int> edgeless(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}}, {});
+  EXPECT_TRUE(Coarsen(edgeless, 0.3).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, ShortestPathsTree)
+{
+  // The weighted graph from the Dijkstra documentation.
+  UndirectedGraph<int, double> graph(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}, {"3", 3, 3}, {"4", 4, 4}},
+    {{{0, 1}, 0.0, 6.0}, {{0, 3}, 0.0, 1.0}, {{1, 3}, 0.0, 2.0},
+     {{1, 4}, 0.0, 2.0}, {{1, 2}, 0.0, 5.0}, {{2, 4}, 0.0, 5.0},
+     {{3, 4}, 0.0, 1.0}});
+
+  ShortestPathsTree<int, double, UndirectedEdge<double>> tree(graph, 0);
+  ASSERT_TRUE(tree.Valid());
+  EXPECT_EQ(0u, tree.Source());
+
+  // Costs and parents match Dijkstra for every destination.
+  auto expected = Dijkstra(graph, 0);
+  for (auto const &entry : expected)
+  {
+    EXPECT_DOUBLE_EQ(entry.second.first, tree.Cost(entry.first))
+        << "vertex " << entry.first;
+  }
+  EXPECT_EQ(0u, tree.Parent(0));
+  EXPECT_EQ(3u, tree.Parent(4));
+
+  // Path extraction into caller storage.
+  VertexId path[8];
+  ASSERT_EQ(4u, tree.ExtractPath(2, path, 8));
+  EXPECT_EQ(0u, path[0]);
+  EXPECT_EQ(3u, path[1]);
+  EXPECT_EQ(4u, path[2]);
+  EXPECT_EQ(2u, path[3]);
+
+  // An exactly sized array works too.
+  VertexId exact[4];
+  EXPECT_EQ(4u, tree.ExtractPath(2, exact, 4));
+  EXPECT_EQ(2u, exact[3]);
+
+  // A short array receives the prefix; the return value reports the
+  // full length so the caller can retry.
+  VertexId prefix[2] = {kNullId, kNullId};
+  EXPECT_EQ(4u, tree.ExtractPath(2, prefix, 2));
+  EXPECT_EQ(0u, prefix[0]);
+  EXPECT_EQ(3u, prefix[1]);
+
+  // The trivial path to the source.
+  EXPECT_EQ(1u, tree.ExtractPath(0, path, 8));
+  EXPECT_EQ(0u, path[0]);
+
+  // Unknown vertices.
+  EXPECT_DOUBLE_EQ(MAX_D, tree.Cost(99));
+  EXPECT_EQ(kNullId, tree.Parent(99));
+  EXPECT_EQ(0u, tree.ExtractPath(99, path, 8));
+
+  // A disconnected vertex is unreachable: no cost, no path.
+  UndirectedGraph<int, double> split(
+    {{"0", 0, 0}, {"1", 1, 1}, {"2", 2, 2}},
+    {{{0, 1}, 0.0, 1.0}});
+  ShortestPathsTree<int, double, UndirectedEdge<double>> splitTree(split, 0);
+  ASSERT_TRUE(splitTree.Valid());
+  EXPECT_DOUBLE_EQ(1.0, splitTree.Cost(1));
+  EXPECT_DOUBLE_EQ(MAX_D, splitTree.Cost(2));
+  EXPECT_EQ(kNullId, splitTree.Parent(2));
+  EXPECT_EQ(0u, splitTree.ExtractPath(2, path, 8));
+
+  // A missing source yields an invalid, empty tree.
+  ShortestPathsTree<int, double, UndirectedEdge<double>> bad(graph, 99);
+  EXPECT_FALSE(bad.Valid());
+  EXPECT_DOUBLE_EQ(MAX_D, bad.Cost(0));
+  EXPECT_EQ(0u, bad.ExtractPath(0, path, 8));
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, AnytimeAStar)
+{
+  // The 5x5 unit grid of the AStar test, with varied edge weights so
+  // the greedy first round can differ from the optimum.
+  const int side = 5;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (int y = 0; y < side; ++y)
+  {
+    for (int x = 0; x < side; ++x)
+    {
+      const VertexId id = y * side + x;
+      vertices.push_back({std::to_string(id), y * side + x, id});
+      if (x + 1 < side)
+        edges.push_back({{id, id + 1}, 1.0, 1.0 + 0.1 * (y % 3)});
+      if (y + 1 < side)
+        edges.push_back({{id, id + side}, 1.0, 1.0 + 0.1 * (x % 3)});
+    }
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+
+  const VertexId from = 0;
+  const VertexId to = side * side - 1;
+  auto heuristic = [side, to](const VertexId _v)
+  {
+    return static_cast<double>(
+        std::abs(static_cast<int>(_v % side) -
+                 static_cast<int>(to % side)) +
+        std::abs(static_cast<int>(_v / side) -
+                 static_cast<int>(to / side)));
+  };
+
+  const double optimal = Dijkstra(graph, from, to)[to].first;
+
+  // Run to completion: the result is proven optimal.
+  AnytimeAStar<int, double, UndirectedEdge<double>> search(graph);
+  ASSERT_TRUE(search.Start(from, to, heuristic));
+  while (search.Improve(1000))
+  {
+  }
+  EXPECT_DOUBLE_EQ(search.Cost(), optimal);
+  EXPECT_DOUBLE_EQ(search.Epsilon(), 1.0);
+  auto path = search.Path();
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(path.front(), from);
+  EXPECT_EQ(path.back(), to);
+
+  // The path is connected: every hop is an edge of the graph and the
+  // weights add up to the reported cost.
+  double walked = 0.0;
+  for (auto i = 0u; i + 1 < path.size(); ++i)
+  {
+    auto hops = graph.EdgeFromVertices(path[i], path[i + 1]);
+    ASSERT_NE(hops.Id(), kNullId);
+    walked += hops.Weight();
+  }
+  EXPECT_DOUBLE_EQ(walked, search.Cost());
+
+  // Interrupted search: with a tiny per-call budget the best-so-far
+  // cost never gets worse, and once an answer exists the path is
+  // available between calls.
+  ASSERT_TRUE(search.Start(from, to, heuristic, 3.0, 0.5));
+  double best = MAX_D;
+  bool more = true;
+  while (more)
+  {
+    more = search.Improve(2);
+    EXPECT_LE(search.Cost(), best);
+    best = search.Cost();
+    if (search.Cost() < MAX_D)
+    {
+      EXPECT_EQ(search.Path().back(), to);
+    }
+  }
+  EXPECT_DOUBLE_EQ(search.Cost(), optimal);
+
+  // A first greedy round already yields a path with a bounded cost.
+  ASSERT_TRUE(search.Start(from, to, heuristic, 2.0, 1.0));
+  while (search.Cost() >= MAX_D && search.Improve(1))
+  {
+  }
+  EXPECT_LE(search.Cost(), 2.0 * optimal);
+
+  // Unknown vertices are rejected; an unreachable goal is reported
+  // once the search space is exhausted.
+  EXPECT_FALSE(search.Start(from, 999, heuristic));
+  UndirectedGraph<int, double> split(
+      {{"a", 0, 0}, {"b", 0, 1}, {"c", 0, 2}},
+      {{{0, 1}, 1.0, 1.0}});
+  AnytimeAStar<int, double, UndirectedEdge<double>> stranded(split);
+  ASSERT_TRUE(stranded.Start(0, 2, [](const VertexId) { return 0.0; }));
+  while (stranded.Improve(10))
+  {
+  }
+  EXPECT_DOUBLE_EQ(stranded.Cost(), MAX_D);
+  EXPECT_TRUE(stranded.Path().empty());
+}
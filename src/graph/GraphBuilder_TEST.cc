@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ignition/math/graph/GraphBuilder.hh"
+
+using namespace ignition;
+using namespace math;
+using namespace graph;
+
+/////////////////////////////////////////////////
+TEST(GraphBuilderTest, SingleThreadedCommit)
+{
+  ConcurrentGraphBuilder<int, double> builder(8, 8);
+
+  EXPECT_TRUE(builder.AddVertex("A", 0, 0));
+  EXPECT_TRUE(builder.AddVertex("B", 1, 1));
+  EXPECT_TRUE(builder.AddVertex("C", 2, 2));
+  EXPECT_TRUE(builder.AddEdge({0, 1}, 1.5, 2.0));
+  EXPECT_TRUE(builder.AddEdge({1, 2}, 2.5));
+  EXPECT_EQ(3u, builder.VertexCount());
+  EXPECT_EQ(2u, builder.EdgeCount());
+
+  DirectedGraph<int, double> graph;
+  // An edge on an unknown vertex is skipped at commit time.
+  builder.AddEdge({2, 99}, 0.0);
+  EXPECT_EQ(5u, builder.Commit(graph));
+
+  EXPECT_EQ(3u, graph.Vertices().size());
+  EXPECT_EQ(2u, graph.Edges().size());
+  EXPECT_EQ(1, graph.VertexFromId(1).Data());
+  EXPECT_DOUBLE_EQ(2.0, graph.EdgeFromVertices(0, 1).Weight());
+
+  // Commit cleared the buffer.
+  EXPECT_EQ(0u, builder.VertexCount());
+  EXPECT_EQ(0u, builder.EdgeCount());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphBuilderTest, Overflow)
+{
+  ConcurrentGraphBuilder<int, double> builder(2, 1);
+  EXPECT_TRUE(builder.AddVertex("A", 0, 0));
+  EXPECT_TRUE(builder.AddVertex("B", 1, 1));
+  EXPECT_FALSE(builder.AddVertex("C", 2, 2));
+  EXPECT_TRUE(builder.AddEdge({0, 1}, 0.0));
+  EXPECT_FALSE(builder.AddEdge({1, 0}, 0.0));
+  EXPECT_EQ(2u, builder.VertexCount());
+  EXPECT_EQ(1u, builder.EdgeCount());
+  EXPECT_EQ(2u, builder.Dropped());
+
+  DirectedGraph<int, double> graph;
+  EXPECT_EQ(3u, builder.Commit(graph));
+  EXPECT_EQ(0u, builder.Dropped());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphBuilderTest, ConcurrentProducers)
+{
+  const unsigned int numThreads = 8;
+  const unsigned int perThread = 500;
+  const std::size_t total =
+      static_cast<std::size_t>(numThreads) * perThread;
+
+  ConcurrentGraphBuilder<int, double> builder(total, total);
+
+  // Each thread stages a disjoint id range plus a chain of edges
+  // within it.
+  std::vector<std::thread> threads;
+  for (auto t = 0u; t < numThreads; ++t)
+  {
+    threads.push_back(std::thread([&builder, t]()
+    {
+      const VertexId base = static_cast<VertexId>(t) * perThread;
+      for (auto i = 0u; i < perThread; ++i)
+      {
+        const VertexId id = base + i;
+        EXPECT_TRUE(builder.AddVertex("v", static_cast<int>(id), id));
+        if (i > 0)
+        {
+          EXPECT_TRUE(builder.AddEdge({id - 1, id}, 1.0));
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  EXPECT_EQ(total, builder.VertexCount());
+  EXPECT_EQ(total - numThreads, builder.EdgeCount());
+  EXPECT_EQ(0u, builder.Dropped());
+
+  DirectedGraph<int, double> graph;
+  EXPECT_EQ(2 * total - numThreads, builder.Commit(graph));
+  EXPECT_EQ(total, graph.Vertices().size());
+  EXPECT_EQ(total - numThreads, graph.Edges().size());
+
+  // Every staged vertex kept its data and every chain is intact.
+  for (VertexId id = 0; id < static_cast<VertexId>(total); ++id)
+  {
+    EXPECT_EQ(static_cast<int>(id), graph.VertexFromId(id).Data());
+    if (id % perThread != 0)
+    {
+      EXPECT_TRUE(graph.EdgeFromVertices(id - 1, id).Valid());
+    }
+  }
+}
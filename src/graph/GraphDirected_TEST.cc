@@ -498,3 +498,93 @@ TEST(GraphTest, StreamInsertion)
     EXPECT_NE(std::string::npos, output.str().find(s));
   }
 }
+
+/////////////////////////////////////////////////
+TEST(GraphTest, Compact)
+{
+  DirectedGraph<int, double> graph;
+  for (int i = 0; i < 8; ++i)
+    graph.AddVertex("v" + std::to_string(i), i);
+  for (int i = 0; i < 7; ++i)
+    graph.AddEdge({static_cast<VertexId>(i),
+        static_cast<VertexId>(i + 1)}, 10.0 + i, 0.5 * i);
+
+  // Punch holes into the id spaces.
+  EXPECT_TRUE(graph.RemoveVertex(1));
+  EXPECT_TRUE(graph.RemoveVertex(4));
+  EXPECT_TRUE(graph.RemoveEdge(5));
+  ASSERT_EQ(6u, graph.Vertices().size());
+  ASSERT_EQ(2u, graph.Edges().size());
+
+  auto staleHandle = graph.VertexHandleFor(2);
+  EXPECT_EQ(graph.VertexFromId(2).Data(),
+      graph.VertexFromHandle(staleHandle).Data());
+
+  const auto translation = graph.Compact();
+  EXPECT_EQ(1u, graph.Generation());
+
+  // Ids are renumbered contiguously from zero in ascending order.
+  ASSERT_EQ(6u, translation.size());
+  VertexId expectedId = 0;
+  for (auto const &entry : translation)
+    EXPECT_EQ(expectedId++, entry.second);
+
+  // Vertex names and data survive under their translated ids.
+  for (auto const &entry : translation)
+  {
+    const auto &vertex = graph.VertexFromId(entry.second);
+    ASSERT_TRUE(vertex.Valid());
+    EXPECT_EQ("v" + std::to_string(entry.first), vertex.Name());
+    EXPECT_EQ(static_cast<int>(entry.first), vertex.Data());
+  }
+
+  // The surviving edges (2 -> 3 and 6 -> 7) follow the remapping
+  // with data and weight intact.
+  ASSERT_EQ(2u, graph.Edges().size());
+  for (auto const &edgePair : graph.Edges())
+  {
+    const auto &edge = edgePair.second.get();
+    const auto tail = graph.VertexFromId(edge.Vertices().first);
+    const auto head = graph.VertexFromId(edge.Vertices().second);
+    EXPECT_EQ(tail.Data() + 1, head.Data());
+    EXPECT_DOUBLE_EQ(10.0 + tail.Data(), edge.Data());
+    EXPECT_DOUBLE_EQ(0.5 * tail.Data(), edge.Weight());
+  }
+
+  // Adjacency was rebuilt: v2 still reaches v3 through its edge.
+  const auto adjacents = graph.AdjacentsFrom(translation.at(2));
+  ASSERT_EQ(1u, adjacents.size());
+  EXPECT_EQ(translation.at(3), adjacents.begin()->first);
+
+  // Handles from before the compaction are stale; fresh ones work.
+  EXPECT_FALSE(graph.VertexFromHandle(staleHandle).Valid());
+  auto freshHandle = graph.VertexHandleFor(translation.at(2));
+  EXPECT_EQ(2, graph.VertexFromHandle(freshHandle).Data());
+
+  // The freed low ids are handed out again.
+  EXPECT_EQ(6u, graph.AddVertex("v8", 8).Id());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, CompactJournal)
+{
+  DirectedGraph<int, double> graph;
+  graph.EnableJournal(true);
+  graph.AddVertex("v0", 0);
+  graph.AddVertex("v1", 1);
+  graph.AddEdge({0, 1}, 2.0);
+  EXPECT_TRUE(graph.RemoveVertex(0));
+
+  const uint64_t beforeCompact = graph.Version();
+  std::vector<GraphChange> changes;
+  EXPECT_TRUE(graph.ChangesSince(0, changes));
+  EXPECT_FALSE(changes.empty());
+
+  // A renumbering cannot be expressed incrementally, so consumers
+  // synchronized before the compaction must resync in full.
+  graph.Compact();
+  changes.clear();
+  EXPECT_FALSE(graph.ChangesSince(beforeCompact, changes));
+  EXPECT_TRUE(graph.ChangesSince(graph.Version(), changes));
+  EXPECT_TRUE(changes.empty());
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "ignition/math/graph/GraphIO.hh"
+
+using namespace ignition;
+using namespace math;
+using namespace graph;
+
+/////////////////////////////////////////////////
+TEST(GraphIOTest, DirectedRoundTrip)
+{
+  DirectedGraph<int, double> graph(
+    {{"a", 1, 0}, {"b", 2, 1}, {"c", 3, 2}},
+    {{{0, 1}, 0.5, 2.0}, {{1, 2}, 1.5, 3.0}});
+
+  std::stringstream stream;
+  EXPECT_TRUE(SaveBinary(stream, graph));
+
+  DirectedGraph<int, double> loaded;
+  EXPECT_TRUE(LoadBinary(stream, loaded));
+
+  EXPECT_EQ(3u, loaded.Vertices().size());
+  EXPECT_EQ(2u, loaded.Edges().size());
+
+  // Ids, names and payloads survive the round trip.
+  EXPECT_EQ("b", loaded.VertexFromId(1).Name());
+  EXPECT_EQ(2, loaded.VertexFromId(1).Data());
+  EXPECT_EQ(3, loaded.VertexFromId(2).Data());
+
+  auto edges = loaded.IncidentsFrom(1);
+  ASSERT_EQ(1u, edges.size());
+  const auto &edge = edges.begin()->second.get();
+  EXPECT_DOUBLE_EQ(1.5, edge.Data());
+  EXPECT_DOUBLE_EQ(3.0, edge.Weight());
+  EXPECT_EQ(2u, edge.Head());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphIOTest, StringPayloads)
+{
+  UndirectedGraph<std::string, std::string> graph(
+    {{"v0", "payload zero", 0}, {"v1", "payload one", 1}},
+    {{{0, 1}, "edge data", 4.0}});
+
+  std::stringstream stream;
+  EXPECT_TRUE(SaveBinary(stream, graph));
+
+  UndirectedGraph<std::string, std::string> loaded;
+  EXPECT_TRUE(LoadBinary(stream, loaded));
+
+  EXPECT_EQ("payload one", loaded.VertexFromId(1).Data());
+  auto edges = loaded.Edges();
+  ASSERT_EQ(1u, edges.size());
+  EXPECT_EQ("edge data", edges.begin()->second.get().Data());
+  EXPECT_DOUBLE_EQ(4.0, edges.begin()->second.get().Weight());
+
+  // Undirected edges remain traversable in both directions.
+  EXPECT_EQ(1u, loaded.AdjacentsFrom(1).size());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphIOTest, BadStreams)
+{
+  // Not a binary graph.
+  std::stringstream garbage("digraph { 0 -> 1 }");
+  DirectedGraph<int, int> graph;
+  EXPECT_FALSE(LoadBinary(garbage, graph));
+
+  // Truncated stream.
+  DirectedGraph<int, int> source({{"a", 1, 0}, {"b", 2, 1}},
+      {{{0, 1}, 7}});
+  std::stringstream stream;
+  EXPECT_TRUE(SaveBinary(stream, source));
+  std::string bytes = stream.str();
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 4));
+  DirectedGraph<int, int> partial;
+  EXPECT_FALSE(LoadBinary(truncated, partial));
+}
+
+/////////////////////////////////////////////////
+TEST(GraphIOTest, SaveDotMatchesInsertionOperator)
+{
+  DirectedGraph<int, double> directed(
+    {{"v0", 0, 0}, {"v1", 1, 1}, {"v2", 2, 2}},
+    {{{0, 1}, 1.0, 2.5}, {{1, 2}, 2.0, 3.0}, {{2, 0}, 3.0, 1.0}});
+
+  std::ostringstream reference;
+  reference << directed;
+
+  std::ostringstream streamed;
+  SaveDot(streamed, directed);
+  EXPECT_EQ(reference.str(), streamed.str());
+
+  UndirectedGraph<int, double> undirected(
+    {{"a", 0, 0}, {"b", 1, 1}},
+    {{{0, 1}, 1.0, 4.0}});
+
+  std::ostringstream undirectedReference;
+  undirectedReference << undirected;
+
+  std::ostringstream undirectedStreamed;
+  SaveDot(undirectedStreamed, undirected);
+  EXPECT_EQ(undirectedReference.str(), undirectedStreamed.str());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphIOTest, SaveDotChunkedAndParallel)
+{
+  // Enough elements to force several flushes with a tiny chunk size.
+  DirectedGraph<int, int> graph;
+  for (int i = 0; i < 200; ++i)
+    graph.AddVertex("v" + std::to_string(i), i, i);
+  for (int i = 0; i < 199; ++i)
+    graph.AddEdge({static_cast<VertexId>(i),
+        static_cast<VertexId>(i + 1)}, i);
+
+  std::ostringstream reference;
+  reference << graph;
+
+  std::string buffer;
+  std::ostringstream chunked;
+  SaveDot(chunked, graph, buffer, 64);
+  EXPECT_EQ(reference.str(), chunked.str());
+
+  // The buffer keeps its capacity for the next dump.
+  const size_t capacity = buffer.capacity();
+  std::ostringstream again;
+  SaveDot(again, graph, buffer, 64);
+  EXPECT_EQ(reference.str(), again.str());
+  EXPECT_GE(buffer.capacity(), capacity);
+
+  // The parallel stringify stage produces identical output.
+  std::ostringstream parallel;
+  SaveDot(parallel, graph, buffer, 64, true);
+  EXPECT_EQ(reference.str(), parallel.str());
+
+  // An empty graph is still a valid document.
+  DirectedGraph<int, int> empty;
+  std::ostringstream emptyOut;
+  SaveDot(emptyOut, empty);
+  EXPECT_EQ("digraph {\n}\n", emptyOut.str());
+}
@@ -457,3 +457,253 @@ TYPED_TEST(GraphTestFixture, EdgelessOutDegree)
     EXPECT_EQ(0u, graph.OutDegree(idVertex.first));
   }
 }
+
+/////////////////////////////////////////////////
+/// \brief Helper type that counts how often it is copied and moved.
+struct CopyCounter
+{
+  CopyCounter() = default;
+
+  explicit CopyCounter(int _value) : value(_value)
+  {
+  }
+
+  CopyCounter(const CopyCounter &_other) : value(_other.value)
+  {
+    ++copies;
+  }
+
+  CopyCounter(CopyCounter &&_other) : value(_other.value)
+  {
+    ++moves;
+  }
+
+  CopyCounter &operator=(const CopyCounter &_other)
+  {
+    this->value = _other.value;
+    ++copies;
+    return *this;
+  }
+
+  CopyCounter &operator=(CopyCounter &&_other)
+  {
+    this->value = _other.value;
+    ++moves;
+    return *this;
+  }
+
+  int value = 0;
+  static int copies;
+  static int moves;
+};
+
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+
+/////////////////////////////////////////////////
+TEST(GraphTest, MoveInsertion)
+{
+  DirectedGraph<CopyCounter, CopyCounter> graph;
+
+  // Moving the payload into the graph must not copy it.
+  CopyCounter vertexData(42);
+  CopyCounter::copies = 0;
+  auto &v0 = graph.AddVertex("v0", std::move(vertexData));
+  auto &v1 = graph.AddVertex("v1", CopyCounter(43));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(v0.Data().value, 42);
+  EXPECT_EQ(v1.Data().value, 43);
+
+  CopyCounter::copies = 0;
+  auto &e0 = graph.AddEdge({v0.Id(), v1.Id()}, CopyCounter(44));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(e0.Data().value, 44);
+
+  // The copying overloads still work.
+  CopyCounter otherVertex(45);
+  auto &v2 = graph.AddVertex("v2", otherVertex);
+  EXPECT_EQ(v2.Data().value, 45);
+  EXPECT_EQ(otherVertex.value, 45);
+
+  CopyCounter otherEdge(46);
+  auto &e1 = graph.AddEdge({v1.Id(), v2.Id()}, otherEdge);
+  EXPECT_EQ(e1.Data().value, 46);
+  EXPECT_EQ(otherEdge.value, 46);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, AllocationFreeRanges)
+{
+  DirectedGraph<int, double> graph(
+    {{"0", 10, 0}, {"1", 11, 1}, {"2", 12, 2}},
+    {{{0, 1}, 0.0, 1.5}, {{0, 2}, 0.0, 2.5}, {{1, 2}, 0.0, 3.5}});
+
+  // VertexRange visits every vertex in place.
+  int vertexSum = 0;
+  for (const auto &vertex : graph.VertexRange())
+    vertexSum += vertex.Data();
+  EXPECT_EQ(10 + 11 + 12, vertexSum);
+
+  // IncidentsFromRange matches IncidentsFrom and exposes the head
+  // vertex of each edge through Neighbor().
+  double outWeights = 0.0;
+  int adjacentSum = 0;
+  for (auto it = graph.IncidentsFromRange(0).begin();
+       it != graph.IncidentsFromRange(0).end(); ++it)
+  {
+    outWeights += (*it).Weight();
+    adjacentSum += it.Neighbor().Data();
+  }
+  EXPECT_DOUBLE_EQ(1.5 + 2.5, outWeights);
+  EXPECT_EQ(11 + 12, adjacentSum);
+  EXPECT_EQ(graph.IncidentsFrom(0).size(), 2u);
+
+  // IncidentsToRange matches IncidentsTo.
+  size_t inCount = 0;
+  double inWeights = 0.0;
+  for (const auto &edge : graph.IncidentsToRange(2))
+  {
+    ++inCount;
+    inWeights += edge.Weight();
+  }
+  EXPECT_EQ(2u, inCount);
+  EXPECT_DOUBLE_EQ(2.5 + 3.5, inWeights);
+
+  // A directed sink has no outgoing edges; the tail filter skips the
+  // incoming ones stored in the same adjacency set.
+  auto sinkRange = graph.IncidentsFromRange(2);
+  EXPECT_TRUE(sinkRange.begin() == sinkRange.end());
+
+  // Unknown vertices yield an empty range.
+  auto missing = graph.IncidentsFromRange(99);
+  EXPECT_TRUE(missing.begin() == missing.end());
+
+  // In an undirected graph both directions visit every incident edge.
+  UndirectedGraph<int, double> ugraph(
+    {{"0", 10, 0}, {"1", 11, 1}},
+    {{{0, 1}, 0.0, 7.0}});
+  size_t count = 0;
+  for (const auto &edge : ugraph.IncidentsFromRange(1))
+  {
+    EXPECT_DOUBLE_EQ(7.0, edge.Weight());
+    ++count;
+  }
+  EXPECT_EQ(1u, count);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTest, ChangeJournal)
+{
+  DirectedGraph<int, double> graph;
+  std::vector<GraphChange> changes;
+
+  // Disabled by default: callers must full-sync.
+  EXPECT_EQ(graph.Version(), 0u);
+  EXPECT_FALSE(graph.ChangesSince(0, changes));
+
+  graph.EnableJournal(true);
+  auto &v0 = graph.AddVertex("a", 10);
+  auto &v1 = graph.AddVertex("b", 20);
+  auto &e0 = graph.AddEdge({v0.Id(), v1.Id()}, 1.0);
+  EXPECT_EQ(graph.Version(), 3u);
+
+  ASSERT_TRUE(graph.ChangesSince(0, changes));
+  ASSERT_EQ(changes.size(), 3u);
+  EXPECT_EQ(changes[0].operation, GraphChange::ADD_VERTEX);
+  EXPECT_EQ(changes[0].version, 1u);
+  EXPECT_EQ(changes[0].id, v0.Id());
+  EXPECT_EQ(changes[1].operation, GraphChange::ADD_VERTEX);
+  EXPECT_EQ(changes[1].id, v1.Id());
+  EXPECT_EQ(changes[2].operation, GraphChange::ADD_EDGE);
+  EXPECT_EQ(changes[2].id, e0.Id());
+
+  // A replica at version 3 sees only what happens next.
+  graph.VertexFromId(v1.Id()).Data() = 25;
+  graph.TouchVertex(v1.Id());
+  graph.TouchEdge(e0.Id());
+  graph.TouchVertex(999);
+  graph.TouchEdge(999);
+  ASSERT_TRUE(graph.ChangesSince(3, changes));
+  ASSERT_EQ(changes.size(), 2u);
+  EXPECT_EQ(changes[0].operation, GraphChange::MODIFY_VERTEX);
+  EXPECT_EQ(changes[0].id, v1.Id());
+  EXPECT_EQ(changes[1].operation, GraphChange::MODIFY_EDGE);
+  EXPECT_EQ(changes[1].id, e0.Id());
+
+  // Removing a vertex journals its incident edge removals first.
+  EXPECT_TRUE(graph.RemoveVertex(v0.Id()));
+  ASSERT_TRUE(graph.ChangesSince(5, changes));
+  ASSERT_EQ(changes.size(), 2u);
+  EXPECT_EQ(changes[0].operation, GraphChange::REMOVE_EDGE);
+  EXPECT_EQ(changes[0].id, e0.Id());
+  EXPECT_EQ(changes[1].operation, GraphChange::REMOVE_VERTEX);
+  EXPECT_EQ(changes[1].id, v0.Id());
+
+  // A quiescent graph reports no changes.
+  ASSERT_TRUE(graph.ChangesSince(graph.Version(), changes));
+  EXPECT_TRUE(changes.empty());
+
+  // Trimming drops acknowledged records; older replicas full-sync.
+  graph.TrimJournal(5);
+  EXPECT_TRUE(graph.ChangesSince(5, changes));
+  EXPECT_EQ(changes.size(), 2u);
+  EXPECT_FALSE(graph.ChangesSince(3, changes));
+
+  // Disabling clears everything.
+  graph.EnableJournal(false);
+  EXPECT_EQ(graph.Version(), 0u);
+  EXPECT_FALSE(graph.ChangesSince(0, changes));
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, DenseVertexIndex)
+{
+  // Library-issued Ids are dense, so lookups go through the direct
+  // index; the answers must match the map in every state.
+  TypeParam graph;
+  for (int i = 0; i < 50; ++i)
+    graph.AddVertex(std::to_string(i), i);
+  for (VertexId id = 0; id < 50; ++id)
+    EXPECT_EQ(id, graph.VertexFromId(id).Id());
+  EXPECT_EQ(kNullId, graph.VertexFromId(50).Id());
+  EXPECT_EQ(kNullId, graph.VertexFromId(kNullId).Id());
+
+  // Removal leaves a tombstone; neighbors are unaffected.
+  EXPECT_TRUE(graph.RemoveVertex(25));
+  EXPECT_EQ(kNullId, graph.VertexFromId(25).Id());
+  EXPECT_EQ(24u, graph.VertexFromId(24).Id());
+  EXPECT_EQ(26u, graph.VertexFromId(26).Id());
+
+  // A caller-supplied Id can reuse the tombstone.
+  graph.AddVertex("again", -1, 25);
+  EXPECT_EQ(25u, graph.VertexFromId(25).Id());
+  EXPECT_EQ(-1, graph.VertexFromId(25).Data());
+
+  // A copy answers the same lookups (through the map; the index does
+  // not carry pointers into the source graph).
+  const TypeParam copy(graph);
+  for (VertexId id = 0; id < 50; ++id)
+    EXPECT_EQ(id, copy.VertexFromId(id).Id());
+  EXPECT_EQ(kNullId, copy.VertexFromId(50).Id());
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, SparseVertexIds)
+{
+  // A caller-supplied Id far beyond the vertex count deactivates the
+  // dense index; lookups fall back to the map and stay correct.
+  TypeParam graph;
+  graph.AddVertex("0", 0, 0);
+  graph.AddVertex("far", 1, 1000000);
+  graph.AddVertex("auto", 2);
+
+  EXPECT_EQ(0u, graph.VertexFromId(0).Id());
+  EXPECT_EQ(1000000u, graph.VertexFromId(1000000).Id());
+  // Automatic Ids keep filling the low range.
+  EXPECT_EQ(2, graph.VertexFromId(1).Data());
+  EXPECT_EQ(kNullId, graph.VertexFromId(500000).Id());
+
+  EXPECT_TRUE(graph.RemoveVertex(0));
+  EXPECT_EQ(kNullId, graph.VertexFromId(0).Id());
+  EXPECT_EQ(1000000u, graph.VertexFromId(1000000).Id());
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "ignition/math/graph/Graph.hh"
+#include "ignition/math/graph/NamePool.hh"
+
+using namespace ignition;
+using namespace math;
+using namespace graph;
+
+/////////////////////////////////////////////////
+TEST(NamePoolTest, Intern)
+{
+  NamePool pool;
+  // The empty string is pre-interned as id 0.
+  EXPECT_EQ(pool.Size(), 1u);
+  EXPECT_EQ(pool.Intern(""), 0u);
+  EXPECT_EQ(pool.Name(0), "");
+
+  const uint32_t a = pool.Intern("alpha");
+  const uint32_t b = pool.Intern("beta");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(pool.Intern("alpha"), a);
+  EXPECT_EQ(pool.Size(), 3u);
+  EXPECT_EQ(pool.Name(a), "alpha");
+  EXPECT_EQ(pool.Name(b), "beta");
+
+  // Unknown ids resolve to the empty string.
+  EXPECT_EQ(pool.Name(12345), "");
+}
+
+/////////////////////////////////////////////////
+TEST(NamePoolTest, InternedName)
+{
+  const InternedName empty;
+  const InternedName a("alpha");
+  const InternedName a2(std::string("alpha"));
+  const InternedName b("beta");
+
+  EXPECT_EQ(static_cast<const std::string &>(empty), "");
+  EXPECT_EQ(static_cast<const std::string &>(a), "alpha");
+  EXPECT_EQ(a, a2);
+  EXPECT_EQ(a.PoolId(), a2.PoolId());
+  EXPECT_NE(a, b);
+
+  // The name costs one pool id regardless of string length.
+  EXPECT_EQ(sizeof(InternedName), sizeof(uint32_t));
+}
+
+/////////////////////////////////////////////////
+TEST(NamePoolTest, VertexNamePolicy)
+{
+  // A vertex with interned names behaves like one with std::string
+  // names but stores only the pool id.
+  Vertex<int, InternedName> vertex("v1", 42, 1);
+  EXPECT_EQ(vertex.Name(), "v1");
+  EXPECT_EQ(vertex.Data(), 42);
+  vertex.SetName("v2");
+  EXPECT_EQ(vertex.Name(), "v2");
+
+  EXPECT_LT(sizeof(Vertex<int, InternedName>), sizeof(Vertex<int>));
+}
+
+/////////////////////////////////////////////////
+TEST(NamePoolTest, GraphNamePolicy)
+{
+  DirectedGraph<int, double, InternedName> graph;
+  auto &v0 = graph.AddVertex("start", 10);
+  auto &v1 = graph.AddVertex("", 20);
+  auto &v2 = graph.AddVertex("", 30);
+  EXPECT_TRUE(graph.AddEdge({v0.Id(), v1.Id()}, 1.0).Valid());
+  EXPECT_TRUE(graph.AddEdge({v1.Id(), v2.Id()}, 2.0).Valid());
+
+  EXPECT_EQ(graph.Vertices().size(), 3u);
+  EXPECT_EQ(graph.Vertices("start").size(), 1u);
+  EXPECT_EQ(graph.Vertices("").size(), 2u);
+  EXPECT_EQ(graph.VertexFromId(v0.Id()).Name(), "start");
+
+  // The DOT stream output still works through the policy.
+  std::ostringstream stream;
+  stream << graph;
+  EXPECT_NE(stream.str().find("digraph {"), std::string::npos);
+  EXPECT_NE(stream.str().find("start"), std::string::npos);
+}
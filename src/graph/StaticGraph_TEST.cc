@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+#include "ignition/math/graph/StaticGraph.hh"
+
+using namespace ignition;
+using namespace math;
+using namespace graph;
+
+namespace
+{
+  // A diamond: 0 -> {1, 2} -> 3, built at compile time.
+  constexpr std::array<int, 4> kVerts = {{10, 11, 12, 13}};
+  constexpr std::array<StaticEdgeInitializer<int>, 4> kEdges = {{
+    {0, 1, 100, 2.0},
+    {0, 2, 101, 3.0},
+    {1, 3, 102, 4.0},
+    {2, 3, 103, 5.0}
+  }};
+  constexpr StaticGraph<int, int, 4, 4> kDiamond(kVerts, kEdges);
+}
+
+/////////////////////////////////////////////////
+TEST(StaticGraphTest, CompileTimeConstruction)
+{
+  // The adjacency is available in constant expressions.
+  static_assert(kDiamond.VertexCount() == 4u, "wrong vertex count");
+  static_assert(kDiamond.EdgeCount() == 4u, "wrong edge count");
+  static_assert(kDiamond.Degree(0) == 2u, "wrong degree");
+  static_assert(kDiamond.Degree(3) == 0u, "wrong degree");
+  static_assert(kDiamond.VertexData(2) == 12, "wrong vertex data");
+  static_assert(kDiamond.EdgeData(1) == 101, "wrong edge data");
+
+  EXPECT_DOUBLE_EQ(2.0, kDiamond.EdgeWeight(0));
+  EXPECT_DOUBLE_EQ(5.0, kDiamond.EdgeWeight(3));
+}
+
+/////////////////////////////////////////////////
+TEST(StaticGraphTest, Adjacency)
+{
+  auto range = kDiamond.AdjacentsFrom(0);
+  EXPECT_EQ(2u, range.size());
+  EXPECT_EQ(1u, *range.begin());
+  EXPECT_EQ(2u, *(range.begin() + 1));
+
+  // Range-based traversal without touching the heap.
+  int sum = 0;
+  for (const VertexId adj : kDiamond.AdjacentsFrom(0))
+    sum += kDiamond.VertexData(adj);
+  EXPECT_EQ(11 + 12, sum);
+
+  EXPECT_EQ(0u, kDiamond.AdjacentsFrom(3).size());
+
+  // Edge indices follow the adjacency order.
+  EXPECT_EQ(0u, kDiamond.EdgeFrom(0, 0));
+  EXPECT_EQ(1u, kDiamond.EdgeFrom(0, 1));
+  EXPECT_EQ(3u, kDiamond.EdgeFrom(2, 0));
+}
+
+/////////////////////////////////////////////////
+TEST(StaticGraphTest, RuntimeConstruction)
+{
+  // Non-literal vertex data still works, just not at compile time.
+  std::array<std::string, 3> verts = {{"a", "b", "c"}};
+  std::array<StaticEdgeInitializer<double>, 3> edges = {{
+    {0, 1, 0.5, 1.0},
+    {1, 2, 1.5, 1.0},
+    {2, 99, 2.5, 1.0}
+  }};
+  StaticGraph<std::string, double, 3, 3> g(verts, edges);
+
+  EXPECT_EQ("b", g.VertexData(1));
+  EXPECT_EQ(1u, g.Degree(0));
+  EXPECT_EQ(1u, g.Degree(1));
+
+  // The edge with an out-of-range head is dropped from the adjacency.
+  EXPECT_EQ(0u, g.Degree(2));
+
+  // Walk the chain from 0 to the sink.
+  VertexId current = 0;
+  std::string path = g.VertexData(current);
+  while (g.Degree(current) > 0)
+  {
+    current = *g.AdjacentsFrom(current).begin();
+    path += g.VertexData(current);
+  }
+  EXPECT_EQ("abc", path);
+}
@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ignition/math/AxisAlignedBox.hh"
+#include "ignition/math/Frustum.hh"
+#include "ignition/math/Kmeans.hh"
+#include "ignition/math/Matrix4.hh"
+#include "ignition/math/Pose3.hh"
+#include "ignition/math/Quaternion.hh"
+#include "ignition/math/Rand.hh"
+#include "ignition/math/Spline.hh"
+#include "ignition/math/Vector3.hh"
+#include "ignition/math/graph/Graph.hh"
+#include "ignition/math/graph/GraphAlgorithms.hh"
+
+using namespace ignition;
+using namespace math;
+
+/// \brief Keep the optimizer from discarding a benchmark result.
+/// \param[in] _value Value that must be treated as used.
+template<typename T>
+static void DoNotOptimize(const T &_value)
+{
+  asm volatile("" : : "g"(&_value) : "memory");
+}
+
+/// \brief One benchmark's timing samples, collected for the JSON
+/// report consumed by tools/compare_benchmarks.py.
+struct BenchmarkResult
+{
+  /// \brief Benchmark name.
+  std::string name;
+
+  /// \brief Iterations per timing repeat.
+  std::size_t iterations;
+
+  /// \brief Nanoseconds per iteration, one entry per repeat.
+  std::vector<double> samplesNs;
+};
+
+/// \brief Collects every benchmark result and, when the
+/// IGN_MATH_BENCHMARK_JSON environment variable names a file, writes
+/// them there on exit in the schema compare_benchmarks.py reads:
+///
+/// \code
+/// {
+///   "schema": 1,
+///   "suite": "ignition-math",
+///   "results": [
+///     {"name": "...", "iterations": N, "samples_ns": [s0, s1, ...]}
+///   ]
+/// }
+/// \endcode
+struct BenchmarkReport
+{
+  /// \brief Get the report singleton.
+  /// \return The report.
+  static BenchmarkReport &Instance()
+  {
+    static BenchmarkReport report;
+    return report;
+  }
+
+  /// \brief Destructor; writes the JSON file if one was requested.
+  ~BenchmarkReport()
+  {
+    const char *path = std::getenv("IGN_MATH_BENCHMARK_JSON");
+    if (!path || this->results.empty())
+      return;
+
+    std::ofstream out(path);
+    if (!out)
+    {
+      std::cerr << "Cannot write benchmark report to [" << path << "]"
+                << std::endl;
+      return;
+    }
+
+    out << "{\n  \"schema\": 1,\n  \"suite\": \"ignition-math\",\n"
+        << "  \"results\": [\n";
+    for (std::size_t i = 0; i < this->results.size(); ++i)
+    {
+      const BenchmarkResult &result = this->results[i];
+      out << "    {\"name\": \"" << result.name << "\", \"iterations\": "
+          << result.iterations << ", \"samples_ns\": [";
+      for (std::size_t s = 0; s < result.samplesNs.size(); ++s)
+      {
+        out << std::fixed << std::setprecision(3)
+            << result.samplesNs[s]
+            << (s + 1 < result.samplesNs.size() ? ", " : "");
+      }
+      out << "]}" << (i + 1 < this->results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+  }
+
+  /// \brief The collected results.
+  std::vector<BenchmarkResult> results;
+};
+
+/// \brief Time \p _body and report nanoseconds per iteration.
+/// The body is run once for warmup, then timed over \p _iterations
+/// iterations, repeated five times. The median repeat goes to stdout
+/// in a fixed-width format that is easy to diff between releases, and
+/// all repeats go to the JSON report so the compare tool can tell
+/// noise from real movement.
+/// \param[in] _name Benchmark name.
+/// \param[in] _iterations Number of timed iterations.
+/// \param[in] _body Workload; receives the iteration index.
+static void RunBenchmark(const std::string &_name,
+                         const std::size_t _iterations,
+                         const std::function<void(std::size_t)> &_body)
+{
+  constexpr std::size_t kRepeats = 5;
+
+  _body(0);
+
+  std::vector<double> samples;
+  for (std::size_t repeat = 0; repeat < kRepeats; ++repeat)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; ++i)
+      _body(i);
+    auto end = std::chrono::steady_clock::now();
+
+    samples.push_back(static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            end - start).count()) / static_cast<double>(_iterations));
+  }
+
+  std::vector<double> sorted(samples);
+  std::sort(sorted.begin(), sorted.end());
+  const double ns = sorted[sorted.size() / 2];
+
+  std::cout << std::left << std::setw(36) << _name
+            << std::right << std::setw(14) << std::fixed
+            << std::setprecision(1) << ns << " ns/iter" << std::endl;
+
+  BenchmarkReport::Instance().results.push_back(
+      {_name, _iterations, samples});
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, Vector3Arithmetic)
+{
+  const std::size_t n = 1000;
+  std::vector<Vector3d> a(n), b(n), out(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    a[i].Set(0.1 * i, -0.2 * i, 0.3);
+    b[i].Set(1.0, 0.5 * i, -0.25 * i);
+  }
+
+  RunBenchmark("Vector3d add/scale/cross x1000", 2000,
+      [&](std::size_t)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          out[i] = a[i] + b[i] * 2.0 - a[i].Cross(b[i]);
+        DoNotOptimize(out);
+      });
+
+  double sum = 0;
+  RunBenchmark("Vector3d dot x1000", 2000,
+      [&](std::size_t)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          sum += a[i].Dot(b[i]);
+        DoNotOptimize(sum);
+      });
+  EXPECT_TRUE(std::isfinite(sum));
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, Matrix4Transform)
+{
+  const std::size_t n = 1000;
+  Matrix4d tf(Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+  std::vector<Vector3d> in(n), out(n);
+  for (std::size_t i = 0; i < n; ++i)
+    in[i].Set(0.01 * i, 1.0 - 0.02 * i, 0.5);
+
+  RunBenchmark("Matrix4d operator* x1000", 2000,
+      [&](std::size_t)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          out[i] = tf * in[i];
+        DoNotOptimize(out);
+      });
+
+  RunBenchmark("Matrix4d TransformPoints x1000", 2000,
+      [&](std::size_t)
+      {
+        tf.TransformPoints(in.data(), out.data(), n);
+        DoNotOptimize(out);
+      });
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, QuaternionRotate)
+{
+  const std::size_t n = 1000;
+  Quaterniond q(0.1, -0.7, 1.3);
+  std::vector<Vector3d> in(n), out(n);
+  for (std::size_t i = 0; i < n; ++i)
+    in[i].Set(0.01 * i, 1.0 - 0.02 * i, 0.5);
+
+  RunBenchmark("Quaterniond RotateVector x1000", 2000,
+      [&](std::size_t)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          out[i] = q.RotateVector(in[i]);
+        DoNotOptimize(out);
+      });
+
+  RunBenchmark("Quaterniond RotateVectors x1000", 2000,
+      [&](std::size_t)
+      {
+        q.RotateVectors(in.data(), out.data(), n);
+        DoNotOptimize(out);
+      });
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, Pose3Compose)
+{
+  const std::size_t n = 100;
+  std::vector<Pose3d> chain(n);
+  for (std::size_t i = 0; i < n; ++i)
+    chain[i] = Pose3d(0.1 * i, 0, 0.05, 0, 0.01 * i, 0.02);
+
+  RunBenchmark("Pose3d operator* chain x100", 20000,
+      [&](std::size_t)
+      {
+        Pose3d acc;
+        for (std::size_t i = 0; i < n; ++i)
+          acc = acc * chain[i];
+        DoNotOptimize(acc);
+      });
+
+  RunBenchmark("Pose3d ComposeChain x100", 20000,
+      [&](std::size_t)
+      {
+        Pose3d acc = Pose3d::ComposeChain(chain.data(), n);
+        DoNotOptimize(acc);
+      });
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, GraphTraversal)
+{
+  // A 64x64 grid graph.
+  const int side = 64;
+  graph::UndirectedGraph<int, double> g;
+  for (int i = 0; i < side * side; ++i)
+    g.AddVertex("v", i, i);
+  for (int r = 0; r < side; ++r)
+  {
+    for (int c = 0; c < side; ++c)
+    {
+      if (c + 1 < side)
+        g.AddEdge({static_cast<graph::VertexId>(r * side + c),
+                   static_cast<graph::VertexId>(r * side + c + 1)}, 1.0);
+      if (r + 1 < side)
+        g.AddEdge({static_cast<graph::VertexId>(r * side + c),
+                   static_cast<graph::VertexId>((r + 1) * side + c)}, 1.0);
+    }
+  }
+
+  RunBenchmark("BreadthFirstSort 64x64 grid", 50,
+      [&](std::size_t)
+      {
+        auto order = graph::BreadthFirstSort(g, 0);
+        DoNotOptimize(order);
+      });
+
+  RunBenchmark("Dijkstra 64x64 grid", 50,
+      [&](std::size_t)
+      {
+        auto dist = graph::Dijkstra(g, 0);
+        DoNotOptimize(dist);
+      });
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, SplineSampling)
+{
+  Spline spline;
+  for (int i = 0; i < 16; ++i)
+    spline.AddPoint(Vector3d(i, std::sin(0.5 * i), std::cos(0.3 * i)));
+  spline.PrecomputeArcLength();
+
+  RunBenchmark("Spline Interpolate x1000", 200,
+      [&](std::size_t)
+      {
+        Vector3d p;
+        for (int i = 0; i < 1000; ++i)
+          p = spline.Interpolate(i / 999.0);
+        DoNotOptimize(p);
+      });
+
+  RunBenchmark("Spline FastArcLength x1000", 200,
+      [&](std::size_t)
+      {
+        double s = 0;
+        for (int i = 0; i < 1000; ++i)
+          s += spline.FastArcLength(i / 999.0);
+        DoNotOptimize(s);
+      });
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, KmeansIteration)
+{
+  Rand::Seed(42);
+  std::vector<Vector3d> obs;
+  for (int c = 0; c < 4; ++c)
+  {
+    Vector3d center(10.0 * c, -5.0 * c, 2.0 * c);
+    for (int i = 0; i < 500; ++i)
+      obs.push_back(center + Vector3d(Rand::DblUniform(-1, 1),
+          Rand::DblUniform(-1, 1), Rand::DblUniform(-1, 1)));
+  }
+
+  Kmeans km(obs);
+  std::vector<Vector3d> centroids;
+  std::vector<unsigned int> labels;
+
+  RunBenchmark("Kmeans 2000 obs, k=4", 20,
+      [&](std::size_t)
+      {
+        km.Cluster(4, centroids, labels);
+        DoNotOptimize(labels);
+      });
+  EXPECT_EQ(4u, centroids.size());
+}
+
+/////////////////////////////////////////////////
+TEST(MathBenchmarks, FrustumCulling)
+{
+  Frustum frustum(1.0, 100.0, Angle(IGN_PI_4), 1.3);
+
+  const std::size_t n = 1000;
+  std::vector<AxisAlignedBox> boxes;
+  std::vector<uint8_t> results(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    Vector3d center(0.2 * i - 50.0, 0.1 * i - 50.0, 0.05 * i);
+    boxes.push_back(AxisAlignedBox(center - Vector3d::One,
+        center + Vector3d::One));
+  }
+
+  RunBenchmark("Frustum Contains x1000", 500,
+      [&](std::size_t)
+      {
+        int count = 0;
+        for (std::size_t i = 0; i < n; ++i)
+          count += frustum.Contains(boxes[i]) ? 1 : 0;
+        DoNotOptimize(count);
+      });
+
+  RunBenchmark("Frustum ContainsBatch x1000", 500,
+      [&](std::size_t)
+      {
+        frustum.ContainsBatch(boxes.data(), n, results.data());
+        DoNotOptimize(results);
+      });
+}
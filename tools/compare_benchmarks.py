@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2021 Open Source Robotics Foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Compare two benchmark result files and flag significant regressions.
+
+The files are written by the performance tests when the
+IGN_MATH_BENCHMARK_JSON environment variable names an output path:
+
+    IGN_MATH_BENCHMARK_JSON=current.json ./PERFORMANCE_math_benchmarks
+    tools/compare_benchmarks.py test/performance/baselines/ci.json \\
+        current.json
+
+Each benchmark carries one timing sample per repeat. A benchmark is
+reported as a regression only when the current mean is more than
+--threshold above the baseline mean AND the difference exceeds --sigma
+combined standard errors, so run-to-run noise does not fail the gate.
+The exit status is nonzero when any regression is found, making the
+script usable directly as a CI gate.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def load_results(path):
+    """Load a result file and return {name: (iterations, samples)}."""
+    with open(path) as f:
+        data = json.load(f)
+    if data.get('schema') != 1:
+        sys.exit('%s: unsupported schema %r' % (path, data.get('schema')))
+    results = {}
+    for entry in data.get('results', []):
+        results[entry['name']] = (entry['iterations'],
+                                  [float(s) for s in entry['samples_ns']])
+    return results
+
+
+def mean_and_stderr(samples):
+    """Return the mean and the standard error of the mean."""
+    n = len(samples)
+    mean = sum(samples) / n
+    if n < 2:
+        return mean, 0.0
+    var = sum((s - mean) ** 2 for s in samples) / (n - 1)
+    return mean, math.sqrt(var / n)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline', help='baseline result file')
+    parser.add_argument('current', help='current result file')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='relative slowdown to flag, e.g. 0.05 for 5%% '
+                             '(default: %(default)s)')
+    parser.add_argument('--sigma', type=float, default=3.0,
+                        help='combined standard errors a flagged slowdown '
+                             'must also exceed (default: %(default)s)')
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+
+    regressions = []
+    improvements = []
+
+    print('%-40s %12s %12s %8s' % ('benchmark', 'baseline', 'current',
+                                   'change'))
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline:
+            print('%-40s %12s %12s %8s' % (name, '-', '-', 'new'))
+            continue
+        if name not in current:
+            print('%-40s %12s %12s %8s' % (name, '-', '-', 'removed'))
+            continue
+
+        base_mean, base_err = mean_and_stderr(baseline[name][1])
+        cur_mean, cur_err = mean_and_stderr(current[name][1])
+        change = (cur_mean - base_mean) / base_mean
+        combined_err = math.sqrt(base_err ** 2 + cur_err ** 2)
+        significant = (combined_err == 0.0 or
+                       abs(cur_mean - base_mean) > args.sigma * combined_err)
+
+        verdict = ''
+        if change > args.threshold and significant:
+            verdict = 'REGRESSION'
+            regressions.append(name)
+        elif change < -args.threshold and significant:
+            verdict = 'improved'
+            improvements.append(name)
+
+        print('%-40s %10.1fns %10.1fns %+7.1f%% %s' %
+              (name, base_mean, cur_mean, 100.0 * change, verdict))
+
+    print()
+    print('%d regression(s), %d improvement(s)' %
+          (len(regressions), len(improvements)))
+    for name in regressions:
+        print('REGRESSION: %s' % name)
+
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())